@@ -95,6 +95,26 @@ if (HDF5_ENABLE_Z_LIB_SUPPORT)
   message (STATUS "Filter ZLIB is ON")
 endif ()
 
+#-----------------------------------------------------------------------------
+# Option to use libdeflate in place of zlib in the deflate filter
+#-----------------------------------------------------------------------------
+option (HDF5_ENABLE_LIBDEFLATE_SUPPORT "Use libdeflate in the deflate filter" OFF)
+if (HDF5_ENABLE_LIBDEFLATE_SUPPORT)
+  if (NOT H5_HAVE_FILTER_DEFLATE)
+    message (FATAL_ERROR " ZLib support is Required for libdeflate support in HDF5")
+  endif ()
+  find_path (LIBDEFLATE_INCLUDE_DIR NAMES libdeflate.h)
+  find_library (LIBDEFLATE_LIBRARY NAMES deflate libdeflate)
+  if (LIBDEFLATE_INCLUDE_DIR AND LIBDEFLATE_LIBRARY)
+    set (H5_HAVE_LIBDEFLATE 1)
+  else ()
+    message (FATAL_ERROR " libdeflate is Required for libdeflate support in HDF5")
+  endif ()
+  set (LINK_COMP_LIBS ${LINK_COMP_LIBS} ${LIBDEFLATE_LIBRARY})
+  INCLUDE_DIRECTORIES (${LIBDEFLATE_INCLUDE_DIR})
+  message (STATUS "Filter DEFLATE uses libdeflate")
+endif ()
+
 #-----------------------------------------------------------------------------
 # Option for SzLib support
 #-----------------------------------------------------------------------------
@@ -144,3 +164,43 @@ if (HDF5_ENABLE_SZIP_SUPPORT)
     set (EXTERNAL_FILTERS "${EXTERNAL_FILTERS} ENCODE")
   endif ()
 endif ()
+
+#-----------------------------------------------------------------------------
+# Option for LZ4 support
+#-----------------------------------------------------------------------------
+option (HDF5_ENABLE_LZ4_SUPPORT "Enable LZ4 Filter" OFF)
+if (HDF5_ENABLE_LZ4_SUPPORT)
+  find_path (LZ4_INCLUDE_DIR NAMES lz4.h)
+  find_library (LZ4_LIBRARY NAMES lz4 liblz4)
+  if (LZ4_INCLUDE_DIR AND LZ4_LIBRARY)
+    set (H5_HAVE_FILTER_LZ4 1)
+    set (H5_HAVE_LZ4_H 1)
+    set (H5_HAVE_LIBLZ4 1)
+    set (EXTERNAL_FILTERS "${EXTERNAL_FILTERS} LZ4")
+  else ()
+    message (FATAL_ERROR " LZ4 is Required for LZ4 support in HDF5")
+  endif ()
+  set (LINK_COMP_LIBS ${LINK_COMP_LIBS} ${LZ4_LIBRARY})
+  INCLUDE_DIRECTORIES (${LZ4_INCLUDE_DIR})
+  message (STATUS "Filter LZ4 is ON")
+endif ()
+
+#-----------------------------------------------------------------------------
+# Option for Zstandard support
+#-----------------------------------------------------------------------------
+option (HDF5_ENABLE_ZSTD_SUPPORT "Enable Zstandard Filter" OFF)
+if (HDF5_ENABLE_ZSTD_SUPPORT)
+  find_path (ZSTD_INCLUDE_DIR NAMES zstd.h)
+  find_library (ZSTD_LIBRARY NAMES zstd libzstd)
+  if (ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY)
+    set (H5_HAVE_FILTER_ZSTD 1)
+    set (H5_HAVE_ZSTD_H 1)
+    set (H5_HAVE_LIBZSTD 1)
+    set (EXTERNAL_FILTERS "${EXTERNAL_FILTERS} ZSTD")
+  else ()
+    message (FATAL_ERROR " Zstandard is Required for Zstandard support in HDF5")
+  endif ()
+  set (LINK_COMP_LIBS ${LINK_COMP_LIBS} ${ZSTD_LIBRARY})
+  INCLUDE_DIRECTORIES (${ZSTD_INCLUDE_DIR})
+  message (STATUS "Filter ZSTD is ON")
+endif ()
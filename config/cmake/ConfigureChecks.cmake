@@ -201,7 +201,7 @@ endif ()
 # Header-check flags set in config/cmake_ext_mod/ConfigureChecks.cmake
 # ----------------------------------------------------------------------
 option (HDF5_ENABLE_MIRROR_VFD "Build the Mirror Virtual File Driver" OFF)
-if (H5FD_ENABLE_MIRROR_VFD)
+if (HDF5_ENABLE_MIRROR_VFD)
   if ( ${HDF_PREFIX}_HAVE_NETINET_IN_H AND
        ${HDF_PREFIX}_HAVE_NETDB_H      AND
        ${HDF_PREFIX}_HAVE_ARPA_INET_H  AND
@@ -213,6 +213,24 @@ if (H5FD_ENABLE_MIRROR_VFD)
   endif()
 endif()
 
+# ----------------------------------------------------------------------
+# Check whether we can build the io_uring VFD
+# ----------------------------------------------------------------------
+if (NOT WINDOWS)
+  option (HDF5_ENABLE_IOURING_VFD "Build the Linux io_uring Virtual File Driver" ON)
+  if (HDF5_ENABLE_IOURING_VFD)
+    CHECK_INCLUDE_FILE ("linux/io_uring.h" ${HDF_PREFIX}_HAVE_LINUX_IO_URING_H)
+    CHECK_SYMBOL_EXISTS (__NR_io_uring_setup "sys/syscall.h" ${HDF_PREFIX}_HAVE_IO_URING_SYSCALLS)
+    if (${HDF_PREFIX}_HAVE_LINUX_IO_URING_H AND
+        ${HDF_PREFIX}_HAVE_IO_URING_SYSCALLS AND
+        ${HDF_PREFIX}_HAVE_SYS_MMAN_H)
+      set (${HDF_PREFIX}_HAVE_IOURING_VFD 1)
+    else ()
+      message (STATUS "The io_uring VFD cannot be built. System prerequisites are not met.")
+    endif ()
+  endif ()
+endif ()
+
 #-----------------------------------------------------------------------------
 # Check if C has __float128 extension
 #-----------------------------------------------------------------------------
@@ -387,11 +387,14 @@ H5AC_create(const H5F_t *f, H5AC_cache_config_t *config_ptr, H5AC_cache_image_co
 #endif /* H5_HAVE_PARALLEL */
 
     /* Turn on metadata cache logging, if being used
-     * This will be JSON until we create a special API call. Trace output
-     * is generated when logging is controlled by the struct.
+     * The output is JSON unless the binary format was requested with
+     * H5Pset_mdc_log_format(). Trace output is generated when logging is
+     * controlled by the struct.
      */
     if (H5F_USE_MDC_LOGGING(f))
-        if (H5C_log_set_up(f->shared->cache, H5F_MDC_LOG_LOCATION(f), H5C_LOG_STYLE_JSON,
+        if (H5C_log_set_up(f->shared->cache, H5F_MDC_LOG_LOCATION(f),
+                           (H5F_MDC_LOG_FORMAT_BINARY == H5F_MDC_LOG_FORMAT(f)) ? H5C_LOG_STYLE_BINARY
+                                                                                 : H5C_LOG_STYLE_JSON,
                            H5F_START_MDC_LOG_ON_ACCESS(f)) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "mdc logging setup failed")
 
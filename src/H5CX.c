@@ -246,6 +246,8 @@ typedef struct H5CX_t {
     hbool_t               err_detect_valid;     /* Whether error detection info is valid */
     H5Z_cb_t              filter_cb;            /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
     hbool_t               filter_cb_valid;      /* Whether filter callback function is valid */
+    unsigned              filter_threads;       /* Filter threads (H5D_XFER_FILTER_THREADS_NAME) */
+    hbool_t               filter_threads_valid; /* Whether filter threads is valid */
     H5Z_data_xform_t *    data_transform;       /* Data transform info (H5D_XFER_XFORM_NAME) */
     hbool_t               data_transform_valid; /* Whether data transform info is valid */
     H5T_vlen_alloc_info_t vl_alloc_info;        /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
@@ -376,6 +378,7 @@ typedef struct H5CX_dxpl_cache_t {
 #endif                                    /* H5_HAVE_PARALLEL */
     H5Z_EDC_t             err_detect;     /* Error detection info (H5D_XFER_EDC_NAME) */
     H5Z_cb_t              filter_cb;      /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
+    unsigned              filter_threads; /* Filter threads (H5D_XFER_FILTER_THREADS_NAME) */
     H5Z_data_xform_t *    data_transform; /* Data transform info (H5D_XFER_XFORM_NAME) */
     H5T_vlen_alloc_info_t vl_alloc_info;  /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
     H5T_conv_cb_t         dt_conv_cb;     /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
@@ -549,6 +552,10 @@ H5CX__init_package(void)
     if (H5P_get(dx_plist, H5D_XFER_FILTER_CB_NAME, &H5CX_def_dxpl_cache.filter_cb) < 0)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve filter callback function")
 
+    /* Get the number of threads for filters */
+    if (H5P_get(dx_plist, H5D_XFER_FILTER_THREADS_NAME, &H5CX_def_dxpl_cache.filter_threads) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve number of threads for filters")
+
     /* Look at the data transform property */
     /* (Note: 'peek', not 'get' - if this turns out to be a problem, we may need
      *          to copy it and free this in the H5CX terminate routine. -QAK)
@@ -2368,6 +2375,39 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX_get_filter_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_filter_threads
+ *
+ * Purpose:     Retrieves the number of threads filters may use for each
+ *              chunk for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_filter_threads(unsigned *filter_threads)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(filter_threads);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_FILTER_THREADS_NAME, filter_threads)
+
+    /* Get the value */
+    *filter_threads = (*head)->ctx.filter_threads;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_filter_threads() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5CX_get_data_transform
  *
@@ -108,6 +108,10 @@ H5C_log_set_up(H5C_t *cache, const char log_location[], H5C_log_style_t style, h
         if (H5C_log_trace_set_up(cache->log_info, log_location, mpi_rank) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to set up trace logging")
     }
+    else if (H5C_LOG_STYLE_BINARY == style) {
+        if (H5C_log_binary_set_up(cache->log_info, log_location, mpi_rank) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to set up binary logging")
+    }
     else
         HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unknown logging style")
 
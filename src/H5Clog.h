@@ -25,10 +25,66 @@
 /* Package Private Macros */
 /**************************/
 
+/* Binary log file layout
+ *
+ * A binary log starts with a header holding the signature, the format
+ * version and the record size (both 32-bit), followed by fixed-size
+ * records.  All values are little-endian.  Each record holds:
+ *
+ *      8 bytes:    Time of the operation (microseconds since the epoch)
+ *      8 bytes:    Address of the entry (of the parent, for flush
+ *                  dependencies)
+ *      8 bytes:    Operation-specific value: the entry size for inserts
+ *                  and protects, the new size for resizes, the new address
+ *                  for moves, the child address for flush dependencies and
+ *                  the maximum cache size for configuration changes
+ *      1 byte:     Operation (H5C_log_binary_op_t)
+ *      1 byte:     Entry type ID (0xff when there is no entry)
+ *      1 byte:     Status flags (H5C_LOG_BINARY_HIT, H5C_LOG_BINARY_FAILED)
+ *      1 byte:     Reserved (zero)
+ *      4 bytes:    Flags passed to the operation
+ */
+#define H5C_LOG_BINARY_SIGNATURE     "HDF5MDCL"
+#define H5C_LOG_BINARY_SIGNATURE_LEN 8
+#define H5C_LOG_BINARY_VERSION       1
+#define H5C_LOG_BINARY_HEADER_SIZE   (H5C_LOG_BINARY_SIGNATURE_LEN + 4 + 4)
+#define H5C_LOG_BINARY_RECORD_SIZE   32
+
+/* Status flags for binary log records */
+#define H5C_LOG_BINARY_HIT    0x01 /* The protected entry was already in the cache */
+#define H5C_LOG_BINARY_FAILED 0x02 /* The operation failed */
+
 /****************************/
 /* Package Private Typedefs */
 /****************************/
 
+/* Operations recorded in binary logs */
+typedef enum H5C_log_binary_op_t {
+    H5C_LOG_BINARY_START = 0,         /* Logging started */
+    H5C_LOG_BINARY_STOP,              /* Logging stopped */
+    H5C_LOG_BINARY_CREATE_CACHE,      /* Cache created */
+    H5C_LOG_BINARY_DESTROY_CACHE,     /* Cache destroyed */
+    H5C_LOG_BINARY_EVICT_CACHE,       /* All unpinned entries evicted */
+    H5C_LOG_BINARY_EXPUNGE,           /* Entry expunged */
+    H5C_LOG_BINARY_FLUSH,             /* Cache flushed */
+    H5C_LOG_BINARY_INSERT,            /* Entry inserted */
+    H5C_LOG_BINARY_MARK_DIRTY,        /* Entry marked dirty */
+    H5C_LOG_BINARY_MARK_CLEAN,        /* Entry marked clean */
+    H5C_LOG_BINARY_MARK_UNSERIALIZED, /* Entry marked unserialized */
+    H5C_LOG_BINARY_MARK_SERIALIZED,   /* Entry marked serialized */
+    H5C_LOG_BINARY_MOVE,              /* Entry moved to a new address */
+    H5C_LOG_BINARY_PIN,               /* Entry pinned */
+    H5C_LOG_BINARY_CREATE_FD,         /* Flush dependency created */
+    H5C_LOG_BINARY_PROTECT,           /* Entry protected */
+    H5C_LOG_BINARY_RESIZE,            /* Entry resized */
+    H5C_LOG_BINARY_UNPIN,             /* Entry unpinned */
+    H5C_LOG_BINARY_DESTROY_FD,        /* Flush dependency destroyed */
+    H5C_LOG_BINARY_UNPROTECT,         /* Entry unprotected */
+    H5C_LOG_BINARY_SET_CONFIG,        /* Cache configuration set */
+    H5C_LOG_BINARY_REMOVE,            /* Entry removed */
+    H5C_LOG_BINARY_NOPS               /* Number of operations (must be last) */
+} H5C_log_binary_op_t;
+
 /* Forward declaration for class struct */
 typedef struct H5C_log_info_t H5C_log_info_t;
 
@@ -135,5 +191,6 @@ H5_DLL herr_t H5C_log_write_remove_entry_msg(H5C_t *cache, const H5C_cache_entry
 /* Logging-specific setup functions */
 H5_DLL herr_t H5C_log_json_set_up(H5C_log_info_t *log_info, const char log_location[], int mpi_rank);
 H5_DLL herr_t H5C_log_trace_set_up(H5C_log_info_t *log_info, const char log_location[], int mpi_rank);
+H5_DLL herr_t H5C_log_binary_set_up(H5C_log_info_t *log_info, const char log_location[], int mpi_rank);
 
 #endif /* _H5Clog_H */
@@ -0,0 +1,1053 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Clog_binary.c
+ *
+ * Purpose:     Cache log implementation that emits compact, fixed-size
+ *              binary records (see H5Clog.h for the layout).  Records are
+ *              encoded into an in-memory buffer and written to the log
+ *              file a buffer at a time, so logging is cheap enough to
+ *              leave on in production.  The h5mdclog tool summarizes and
+ *              replays these logs.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+#include "H5Cmodule.h" /* This source code file is part of the H5C module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5Cpkg.h"      /* Cache                                    */
+#include "H5Clog.h"      /* Cache logging                            */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5MMprivate.h" /* Memory management                        */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Number of records buffered in memory between writes to the log file */
+#define H5C_LOG_BINARY_NRECORDS 4096
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+typedef struct H5C_log_binary_udata_t {
+    FILE *   outfile;  /* Log file */
+    uint8_t *records;  /* Buffer of encoded records */
+    size_t   nrecords; /* Number of records in the buffer */
+} H5C_log_binary_udata_t;
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/* Internal message handling calls */
+static herr_t H5C__binary_flush_records(H5C_log_binary_udata_t *binary_udata);
+static herr_t H5C__binary_write_record(H5C_log_binary_udata_t *binary_udata, H5C_log_binary_op_t op,
+                                       haddr_t address, uint64_t value, int type_id, unsigned flags,
+                                       unsigned status, herr_t fxn_ret_value);
+
+/* Log message callbacks */
+static herr_t H5C__binary_tear_down_logging(H5C_log_info_t *log_info);
+static herr_t H5C__binary_write_start_log_msg(void *udata);
+static herr_t H5C__binary_write_stop_log_msg(void *udata);
+static herr_t H5C__binary_write_create_cache_log_msg(void *udata, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_destroy_cache_log_msg(void *udata);
+static herr_t H5C__binary_write_evict_cache_log_msg(void *udata, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_expunge_entry_log_msg(void *udata, haddr_t address, int type_id,
+                                                      herr_t fxn_ret_value);
+static herr_t H5C__binary_write_flush_cache_log_msg(void *udata, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_insert_entry_log_msg(void *udata, haddr_t address, int type_id,
+                                                     unsigned flags, size_t size, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_entry_dirty_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                         herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_entry_clean_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                         herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_unserialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                                herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_serialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                              herr_t fxn_ret_value);
+static herr_t H5C__binary_write_move_entry_log_msg(void *udata, haddr_t old_addr, haddr_t new_addr,
+                                                   int type_id, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_pin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                  herr_t fxn_ret_value);
+static herr_t H5C__binary_write_create_fd_log_msg(void *udata, const H5C_cache_entry_t *parent,
+                                                  const H5C_cache_entry_t *child, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_protect_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                      int type_id, unsigned flags, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_resize_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                     size_t new_size, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_unpin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                    herr_t fxn_ret_value);
+static herr_t H5C__binary_write_destroy_fd_log_msg(void *udata, const H5C_cache_entry_t *parent,
+                                                   const H5C_cache_entry_t *child, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_unprotect_entry_log_msg(void *udata, haddr_t address, int type_id,
+                                                        unsigned flags, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_set_cache_config_log_msg(void *udata, const H5AC_cache_config_t *config,
+                                                         herr_t fxn_ret_value);
+static herr_t H5C__binary_write_remove_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                     herr_t fxn_ret_value);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Note that there's no cache set up call since that's the
+ * place where this struct is wired into the cache.
+ */
+static H5C_log_class_t H5C_binary_log_class_g = {"binary",
+                                                 H5C__binary_tear_down_logging,
+                                                 NULL, /* start logging */
+                                                 NULL, /* stop logging */
+                                                 H5C__binary_write_start_log_msg,
+                                                 H5C__binary_write_stop_log_msg,
+                                                 H5C__binary_write_create_cache_log_msg,
+                                                 H5C__binary_write_destroy_cache_log_msg,
+                                                 H5C__binary_write_evict_cache_log_msg,
+                                                 H5C__binary_write_expunge_entry_log_msg,
+                                                 H5C__binary_write_flush_cache_log_msg,
+                                                 H5C__binary_write_insert_entry_log_msg,
+                                                 H5C__binary_write_mark_entry_dirty_log_msg,
+                                                 H5C__binary_write_mark_entry_clean_log_msg,
+                                                 H5C__binary_write_mark_unserialized_entry_log_msg,
+                                                 H5C__binary_write_mark_serialized_entry_log_msg,
+                                                 H5C__binary_write_move_entry_log_msg,
+                                                 H5C__binary_write_pin_entry_log_msg,
+                                                 H5C__binary_write_create_fd_log_msg,
+                                                 H5C__binary_write_protect_entry_log_msg,
+                                                 H5C__binary_write_resize_entry_log_msg,
+                                                 H5C__binary_write_unpin_entry_log_msg,
+                                                 H5C__binary_write_destroy_fd_log_msg,
+                                                 H5C__binary_write_unprotect_entry_log_msg,
+                                                 H5C__binary_write_set_cache_config_log_msg,
+                                                 H5C__binary_write_remove_entry_log_msg};
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_flush_records
+ *
+ * Purpose:     Write the buffered records to the log file and empty the
+ *              buffer.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_flush_records(H5C_log_binary_udata_t *binary_udata)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(binary_udata->outfile);
+    HDassert(binary_udata->records);
+
+    if (binary_udata->nrecords > 0) {
+        if (binary_udata->nrecords != HDfwrite(binary_udata->records, H5C_LOG_BINARY_RECORD_SIZE,
+                                               binary_udata->nrecords, binary_udata->outfile))
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "error writing log records")
+        if (EOF == HDfflush(binary_udata->outfile))
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "error flushing mdc log file")
+        binary_udata->nrecords = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_flush_records() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_record
+ *
+ * Purpose:     Encode a single record into the record buffer, writing the
+ *              buffer out to the log file when it fills up.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_record(H5C_log_binary_udata_t *binary_udata, H5C_log_binary_op_t op, haddr_t address,
+                         uint64_t value, int type_id, unsigned flags, unsigned status, herr_t fxn_ret_value)
+{
+    uint8_t *p;                   /* Pointer into the record buffer */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(binary_udata->records);
+    HDassert(binary_udata->nrecords < H5C_LOG_BINARY_NRECORDS);
+    HDassert(op < H5C_LOG_BINARY_NOPS);
+
+    if (fxn_ret_value < 0)
+        status |= H5C_LOG_BINARY_FAILED;
+
+    /* Encode the record */
+    p = binary_udata->records + (binary_udata->nrecords * H5C_LOG_BINARY_RECORD_SIZE);
+    UINT64ENCODE(p, H5_now_usec());
+    UINT64ENCODE(p, (uint64_t)address);
+    UINT64ENCODE(p, value);
+    *p++ = (uint8_t)op;
+    *p++ = (uint8_t)(type_id < 0 ? 0xff : type_id);
+    *p++ = (uint8_t)status;
+    *p++ = 0;
+    UINT32ENCODE(p, flags);
+
+    /* Write the buffer out when it's full */
+    if (++binary_udata->nrecords == H5C_LOG_BINARY_NRECORDS)
+        if (H5C__binary_flush_records(binary_udata) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to write log records")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_record() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_log_binary_set_up
+ *
+ * Purpose:     Setup for binary metadata cache logging.
+ *
+ *              This opens the log file, writes the file header and
+ *              allocates the record buffer.  See H5C_log_trace_set_up()
+ *              for how logging is switched on and off.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_log_binary_set_up(H5C_log_info_t *log_info, const char log_location[], int mpi_rank)
+{
+    H5C_log_binary_udata_t *binary_udata = NULL;
+    char *                  file_name    = NULL;
+    uint8_t                 header[H5C_LOG_BINARY_HEADER_SIZE];
+    uint8_t *               p;
+    size_t                  n_chars;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(log_info);
+    HDassert(log_location);
+
+    /* Set up the class struct */
+    log_info->cls = &H5C_binary_log_class_g;
+
+    /* Allocate memory for the binary-specific data */
+    if (NULL == (log_info->udata = H5MM_calloc(sizeof(H5C_log_binary_udata_t))))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    binary_udata = (H5C_log_binary_udata_t *)(log_info->udata);
+
+    /* Allocate memory for the record buffer */
+    if (NULL == (binary_udata->records =
+                     (uint8_t *)H5MM_malloc(H5C_LOG_BINARY_NRECORDS * H5C_LOG_BINARY_RECORD_SIZE)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+
+    /* Possibly fix up the log file name (see H5C_log_trace_set_up()) */
+    n_chars = HDstrlen(log_location) + 1 + 39 + 1;
+    if (NULL == (file_name = (char *)H5MM_calloc(n_chars * sizeof(char))))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL,
+                    "can't allocate memory for mdc log file name manipulation")
+
+    /* Add the rank to the log file name when MPI is in use */
+    if (-1 == mpi_rank)
+        HDsnprintf(file_name, n_chars, "%s", log_location);
+    else
+        HDsnprintf(file_name, n_chars, "%s.%d", log_location, mpi_rank);
+
+    /* Open log file.  Records are buffered here, so leave the stream
+     * unbuffered to avoid copying them twice.
+     */
+    if (NULL == (binary_udata->outfile = HDfopen(file_name, "wb")))
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "can't create mdc log file")
+    HDsetbuf(binary_udata->outfile, NULL);
+
+    /* Write the header */
+    p = header;
+    H5MM_memcpy(p, H5C_LOG_BINARY_SIGNATURE, (size_t)H5C_LOG_BINARY_SIGNATURE_LEN);
+    p += H5C_LOG_BINARY_SIGNATURE_LEN;
+    UINT32ENCODE(p, H5C_LOG_BINARY_VERSION);
+    UINT32ENCODE(p, H5C_LOG_BINARY_RECORD_SIZE);
+    if (1 != HDfwrite(header, sizeof(header), 1, binary_udata->outfile))
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "can't write mdc log file header")
+
+done:
+    if (file_name)
+        H5MM_xfree(file_name);
+
+    /* Free and reset the log info struct on errors */
+    if (FAIL == ret_value) {
+        /* Free */
+        if (binary_udata) {
+            if (binary_udata->outfile)
+                HDfclose(binary_udata->outfile);
+            H5MM_xfree(binary_udata->records);
+            H5MM_xfree(binary_udata);
+        } /* end if */
+
+        /* Reset */
+        log_info->udata = NULL;
+        log_info->cls   = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_log_binary_set_up() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_tear_down_logging
+ *
+ * Purpose:     Tear-down for binary metadata cache logging.  Any
+ *              buffered records are written out before the log file is
+ *              closed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_tear_down_logging(H5C_log_info_t *log_info)
+{
+    H5C_log_binary_udata_t *binary_udata = NULL;
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(log_info);
+
+    /* Alias */
+    binary_udata = (H5C_log_binary_udata_t *)(log_info->udata);
+
+    /* Write out any remaining records */
+    if (H5C__binary_flush_records(binary_udata) < 0)
+        HDONE_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to write log records")
+
+    /* Free the record buffer */
+    H5MM_xfree(binary_udata->records);
+
+    /* Close log file */
+    if (EOF == HDfclose(binary_udata->outfile))
+        HDONE_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "problem closing mdc log file")
+    binary_udata->outfile = NULL;
+
+    /* Free the udata */
+    H5MM_xfree(binary_udata);
+
+    /* Reset the log class info and udata */
+    log_info->cls   = NULL;
+    log_info->udata = NULL;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_tear_down_logging() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_start_log_msg
+ *
+ * Purpose:     Write a log record for the start of logging.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_start_log_msg(void *udata)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_START, HADDR_UNDEF, 0, -1, 0, 0, SUCCEED) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_start_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_stop_log_msg
+ *
+ * Purpose:     Write a log record for the end of logging.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_stop_log_msg(void *udata)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_STOP, HADDR_UNDEF, 0, -1, 0, 0, SUCCEED) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+    /* Make the records written so far visible */
+    if (H5C__binary_flush_records(binary_udata) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to write log records")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_stop_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_create_cache_log_msg
+ *
+ * Purpose:     Write a log record for cache creation.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_create_cache_log_msg(void *udata, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_CREATE_CACHE, HADDR_UNDEF, 0, -1, 0, 0,
+                                 fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_create_cache_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_destroy_cache_log_msg
+ *
+ * Purpose:     Write a log record for cache destruction.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_destroy_cache_log_msg(void *udata)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_DESTROY_CACHE, HADDR_UNDEF, 0, -1, 0, 0,
+                                 SUCCEED) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_destroy_cache_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_evict_cache_log_msg
+ *
+ * Purpose:     Write a log record for cache eviction.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_evict_cache_log_msg(void *udata, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_EVICT_CACHE, HADDR_UNDEF, 0, -1, 0, 0,
+                                 fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_evict_cache_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_expunge_entry_log_msg
+ *
+ * Purpose:     Write a log record for expunging a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_expunge_entry_log_msg(void *udata, haddr_t address, int type_id, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_EXPUNGE, address, 0, type_id, 0, 0,
+                                 fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_expunge_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_flush_cache_log_msg
+ *
+ * Purpose:     Write a log record for cache flushes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_flush_cache_log_msg(void *udata, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_FLUSH, HADDR_UNDEF, 0, -1, 0, 0,
+                                 fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+    /* Keep the log file in step with the HDF5 file */
+    if (H5C__binary_flush_records(binary_udata) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to write log records")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_flush_cache_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_insert_entry_log_msg
+ *
+ * Purpose:     Write a log record for insertion of cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_insert_entry_log_msg(void *udata, haddr_t address, int type_id, unsigned flags, size_t size,
+                                       herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_INSERT, address, (uint64_t)size, type_id, flags,
+                                 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_insert_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_entry_dirty_log_msg
+ *
+ * Purpose:     Write a log record for marking cache entries as dirty.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_entry_dirty_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_MARK_DIRTY, entry->addr, 0, entry->type->id, 0,
+                                 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_entry_dirty_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_entry_clean_log_msg
+ *
+ * Purpose:     Write a log record for marking cache entries as clean.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_entry_clean_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_MARK_CLEAN, entry->addr, 0, entry->type->id, 0,
+                                 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_entry_clean_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_unserialized_entry_log_msg
+ *
+ * Purpose:     Write a log record for marking cache entries as unserialized.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_unserialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                  herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_MARK_UNSERIALIZED, entry->addr, 0,
+                                 entry->type->id, 0, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_unserialized_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_serialized_entry_log_msg
+ *
+ * Purpose:     Write a log record for marking cache entries as serialized.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_serialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_MARK_SERIALIZED, entry->addr, 0,
+                                 entry->type->id, 0, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_serialized_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_move_entry_log_msg
+ *
+ * Purpose:     Write a log record for moving a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_move_entry_log_msg(void *udata, haddr_t old_addr, haddr_t new_addr, int type_id,
+                                     herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_MOVE, old_addr, (uint64_t)new_addr, type_id, 0,
+                                 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_move_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_pin_entry_log_msg
+ *
+ * Purpose:     Write a log record for pinning a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_pin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_PIN, entry->addr, 0, entry->type->id, 0, 0,
+                                 fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_pin_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_create_fd_log_msg
+ *
+ * Purpose:     Write a log record for creating a flush dependency.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_create_fd_log_msg(void *udata, const H5C_cache_entry_t *parent,
+                                    const H5C_cache_entry_t *child, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(parent);
+    HDassert(child);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_CREATE_FD, parent->addr, (uint64_t)child->addr,
+                                 parent->type->id, 0, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_create_fd_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_protect_entry_log_msg
+ *
+ * Purpose:     Write a log record for protecting a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_protect_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, int type_id,
+                                        unsigned flags, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    haddr_t                 address      = HADDR_UNDEF;
+    uint64_t                size         = 0;
+    unsigned                status       = 0;
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* The entry is NULL when the protect failed */
+    if (entry) {
+        address = entry->addr;
+        size    = (uint64_t)entry->size;
+        if (entry->cache_ptr && entry->cache_ptr->last_protect_hit)
+            status |= H5C_LOG_BINARY_HIT;
+    } /* end if */
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_PROTECT, address, size, type_id, flags, status,
+                                 fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_protect_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_resize_entry_log_msg
+ *
+ * Purpose:     Write a log record for resizing a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_resize_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, size_t new_size,
+                                       herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_RESIZE, entry->addr, (uint64_t)new_size,
+                                 entry->type->id, 0, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_resize_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_unpin_entry_log_msg
+ *
+ * Purpose:     Write a log record for unpinning a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_unpin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_UNPIN, entry->addr, 0, entry->type->id, 0, 0,
+                                 fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_unpin_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_destroy_fd_log_msg
+ *
+ * Purpose:     Write a log record for destroying a flush dependency.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_destroy_fd_log_msg(void *udata, const H5C_cache_entry_t *parent,
+                                     const H5C_cache_entry_t *child, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(parent);
+    HDassert(child);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_DESTROY_FD, parent->addr, (uint64_t)child->addr,
+                                 parent->type->id, 0, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_destroy_fd_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_unprotect_entry_log_msg
+ *
+ * Purpose:     Write a log record for unprotecting a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_unprotect_entry_log_msg(void *udata, haddr_t address, int type_id, unsigned flags,
+                                          herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_UNPROTECT, address, 0, type_id, flags, 0,
+                                 fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_unprotect_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_set_cache_config_log_msg
+ *
+ * Purpose:     Write a log record for setting the cache configuration.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_set_cache_config_log_msg(void *udata, const H5AC_cache_config_t *config,
+                                           herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(config);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_SET_CONFIG, HADDR_UNDEF,
+                                 (uint64_t)config->max_size, -1, 0, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_set_cache_config_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_remove_entry_log_msg
+ *
+ * Purpose:     Write a log record for removing a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_remove_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Record the operation */
+    if (H5C__binary_write_record(binary_udata, H5C_LOG_BINARY_REMOVE, entry->addr, 0, entry->type->id, 0, 0,
+                                 fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log message")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_remove_entry_log_msg() */
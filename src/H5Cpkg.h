@@ -4340,6 +4340,11 @@ typedef struct H5C_tag_info_t {
  *    were reset.  Note that when automatic cache re-sizing is enabled,
  *    this field will be reset every automatic resize epoch.
  *
+ * last_protect_hit: Boolean flag that is set to TRUE iff the entry
+ *    returned by the most recent call to H5C_protect() was already
+ *    resident in the cache.  It is used by the binary cache logging
+ *    backend to record hits and misses without additional bookkeeping.
+ *
  *
  * Metadata cache image management related fields.
  *
@@ -4934,6 +4939,7 @@ struct H5C_t {
     /* Fields for cache hit rate collection */
     int64_t            cache_hits;
     int64_t            cache_accesses;
+    hbool_t            last_protect_hit;
 
     /* fields supporting generation of a cache image on file close */
     H5C_cache_image_ctl_t    image_ctl;
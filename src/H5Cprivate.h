@@ -2214,7 +2214,11 @@ typedef struct H5C_cache_image_ctl_t {
 } H5C_cache_image_ctl_t;
 
 /* The cache logging output style */
-typedef enum H5C_log_style_t { H5C_LOG_STYLE_JSON, H5C_LOG_STYLE_TRACE } H5C_log_style_t;
+typedef enum H5C_log_style_t {
+    H5C_LOG_STYLE_JSON,  /* Human-readable JSON */
+    H5C_LOG_STYLE_TRACE, /* Text trace */
+    H5C_LOG_STYLE_BINARY /* Compact binary records (see H5Clog.h) */
+} H5C_log_style_t;
 
 /***************************************/
 /* Library-private Function Prototypes */
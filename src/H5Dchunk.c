@@ -65,12 +65,6 @@
 /* Local Macros */
 /****************/
 
-/* Macros for iterating over chunks to operate on */
-#define H5D_CHUNK_GET_FIRST_NODE(map) (map->use_single ? (H5SL_node_t *)(1) : H5SL_first(map->sel_chunks))
-#define H5D_CHUNK_GET_NODE_INFO(map, node)                                                                   \
-    (map->use_single ? map->single_chunk_info : (H5D_chunk_info_t *)H5SL_item(node))
-#define H5D_CHUNK_GET_NEXT_NODE(map, node) (map->use_single ? (H5SL_node_t *)NULL : H5SL_next(node))
-
 /* Sanity check on chunk index types: commonly used by a lot of routines in this file */
 #define H5D_CHUNK_STORAGE_INDEX_CHK(storage)                                                                 \
     HDassert((H5D_CHUNK_IDX_EARRAY == (storage)->idx_type && H5D_COPS_EARRAY == (storage)->ops) ||           \
@@ -2471,6 +2465,13 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_
     HDassert(type_info);
     HDassert(fm);
 
+    /* Packed variable-length chunks are unpacked directly into the buffer */
+    if (H5Z_filter_in_pline(&(io_info->dset->shared->dcpl_cache.pline), H5Z_FILTER_VLPACK) > 0) {
+        if (H5D__vlpack_read(io_info, type_info, fm) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read packed chunks")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Set up "nonexistent" I/O info object */
     H5MM_memcpy(&nonexistent_io_info, io_info, sizeof(nonexistent_io_info));
     nonexistent_io_info.layout_ops = *H5D_LOPS_NONEXISTENT;
@@ -2620,6 +2621,13 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize
     HDassert(type_info);
     HDassert(fm);
 
+    /* Packed variable-length chunks are rebuilt from the buffer */
+    if (H5Z_filter_in_pline(&(io_info->dset->shared->dcpl_cache.pline), H5Z_FILTER_VLPACK) > 0) {
+        if (H5D__vlpack_write(io_info, type_info, fm) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write packed chunks")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Set up contiguous I/O info object */
     H5MM_memcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
     ctg_io_info.store      = &ctg_store;
@@ -5150,6 +5158,13 @@ H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk)
     if (H5S_select_hyperslab(udata->chunk_space, H5S_SELECT_NOTB, udata->hyper_start, NULL, count, NULL) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to select hyperslab")
 
+    /* Packed variable-length chunks have no fill value, reset the elements to nil instead */
+    if (H5Z_filter_in_pline(&(dset->shared->dcpl_cache.pline), H5Z_FILTER_VLPACK) > 0) {
+        if (H5D__vlpack_fill_nil(dset, scaled, udata->chunk_space) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to reset packed elements")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Lock the chunk into the cache, to get a pointer to the chunk buffer */
     if (NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE, FALSE)))
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to lock raw data chunk")
@@ -6248,7 +6263,8 @@ H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src, H5O_layout_chunk
         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTREGISTER, FAIL, "unable to register source file datatype")
 
     /* If there's a VLEN source datatype, set up type conversion information */
-    if (H5T_detect_class(dt_src, H5T_VLEN, FALSE) > 0) {
+    /* (Packed variable-length chunks hold no references to the global heap and are copied as-is) */
+    if (H5T_detect_class(dt_src, H5T_VLEN, FALSE) > 0 && H5Z_filter_in_pline(pline, H5Z_FILTER_VLPACK) <= 0) {
         H5T_t *  dt_dst;      /* Destination datatype */
         H5T_t *  dt_mem;      /* Memory datatype */
         size_t   mem_dt_size; /* Memory datatype size */
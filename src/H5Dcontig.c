@@ -528,14 +528,149 @@ H5D__contig_is_space_alloc(const H5O_storage_t *storage)
 hbool_t
 H5D__contig_is_data_cached(const H5D_shared_t *shared_dset)
 {
+    unsigned u;                 /* Local index variable */
+    hbool_t  ret_value = FALSE; /* Return value */
+
     FUNC_ENTER_PACKAGE_NOERR
 
     /* Sanity checks */
     HDassert(shared_dset);
 
-    FUNC_LEAVE_NOAPI(shared_dset->cache.contig.sieve_size > 0)
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++)
+        if (shared_dset->cache.contig.win[u].size > 0)
+            ret_value = TRUE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_is_data_cached() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__contig_flush_sieve
+ *
+ * Purpose:     Writes the dirty windows of a dataset's data sieve buffer
+ *              to the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_flush_sieve(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig)
+{
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(dset_contig);
+
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_rdcdc_win_t *win = &dset_contig->win[u];
+
+        if (win->size > 0 && win->dirty) {
+            /* Write dirty window to file */
+            if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, win->loc, win->size, win->buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
+
+            /* Reset window dirty flag */
+            win->dirty = FALSE;
+        } /* end if */
+    }     /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_flush_sieve() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__contig_free_sieve
+ *
+ * Purpose:     Releases the windows of a dataset's data sieve buffer,
+ *              without writing them to the file.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5D__contig_free_sieve(H5D_rdcdc_t *dset_contig)
+{
+    unsigned u; /* Local index variable */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(dset_contig);
+
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_rdcdc_win_t *win = &dset_contig->win[u];
+
+        if (win->buf)
+            win->buf = (unsigned char *)H5FL_BLK_FREE(sieve_buf, win->buf);
+        win->loc      = HADDR_UNDEF;
+        win->size     = 0;
+        win->buf_size = 0;
+        win->dirty    = FALSE;
+    } /* end for */
+    dset_contig->sieve_mem = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__contig_free_sieve() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__contig_get_mapped
+ *
+ * Purpose:     Returns in *PTR a pointer to the raw data of a contiguous
+ *              dataset inside the memory mapping of its file, so that it
+ *              can be read without copying.  This is only possible when
+ *              the data needs no conversion to MEM_TYPE, the storage has
+ *              been allocated in the HDF5 file itself and the file was
+ *              opened read-only with the mmap driver.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_get_mapped(const H5D_t *dset, const H5T_t *mem_type, const void **ptr /*out*/)
+{
+    const H5O_storage_contig_t *storage;             /* Contiguous storage info */
+    htri_t                      has_vlen;            /* Whether the type has variable-length data */
+    herr_t                      ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(mem_type);
+    HDassert(ptr);
+
+    if (H5D_CONTIGUOUS != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "dataset does not use contiguous storage")
+    if (dset->shared->dcpl_cache.efl.nused > 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "dataset is stored in external files")
+    storage = &dset->shared->layout.storage.u.contig;
+    if (!H5F_addr_defined(storage->addr) || 0 == storage->size)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "dataset storage is not allocated")
+    if (storage->size != (hsize_t)((size_t)storage->size))
+        HGOTO_ERROR(H5E_DATASET, H5E_OVERFLOW, FAIL, "dataset storage is too large to map")
+
+    /* The raw data must be usable without any datatype conversion */
+    if ((has_vlen = H5T_detect_class(dset->shared->type, H5T_VLEN, FALSE)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to detect variable-length datatype")
+    if (has_vlen || H5T_detect_class(dset->shared->type, H5T_REFERENCE, FALSE) > 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "dataset datatype requires conversion")
+    if (0 != H5T_cmp(mem_type, dset->shared->type, FALSE))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "memory datatype differs from dataset datatype")
+
+    /* Get the pointer into the file mapping */
+    if (H5F_block_get_mapped(dset->oloc.file, storage->addr, (size_t)storage->size, ptr) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to map dataset storage")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_get_mapped() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_io_init
  *
@@ -668,6 +803,258 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_write_one() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__contig_sieve_find
+ *
+ * Purpose:     Looks for a data sieve buffer window holding all of the
+ *              LEN bytes at ADDR.
+ *
+ * Return:      Pointer to the window if one holds the whole range,
+ *              NULL otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_rdcdc_win_t *
+H5D__contig_sieve_find(H5D_rdcdc_t *dset_contig, haddr_t addr, size_t len)
+{
+    unsigned         u;                /* Local index variable */
+    H5D_rdcdc_win_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_rdcdc_win_t *win = &dset_contig->win[u];
+
+        if (win->size > 0 && addr >= win->loc && (addr + len) <= (win->loc + win->size)) {
+            ret_value = win;
+            break;
+        } /* end if */
+    }     /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_find() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__contig_sieve_evict
+ *
+ * Purpose:     Writes out the dirty data sieve buffer windows (other than
+ *              KEEP) that overlap the LEN bytes at ADDR and, if
+ *              INVALIDATE is set, drops their contents.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_evict(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, const H5D_rdcdc_win_t *keep,
+                        haddr_t addr, size_t len, hbool_t invalidate)
+{
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_rdcdc_win_t *win = &dset_contig->win[u];
+
+        if (win == keep || 0 == win->size)
+            continue;
+        if (win->loc >= (addr + len) || (win->loc + win->size) <= addr)
+            continue;
+
+        /* Flush the window, if it's dirty */
+        if (win->dirty) {
+            if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, win->loc, win->size, win->buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+
+            /* Reset window dirty flag */
+            win->dirty = FALSE;
+        } /* end if */
+
+        /* Force the window to be re-read the next time */
+        if (invalidate) {
+            win->loc  = HADDR_UNDEF;
+            win->size = 0;
+        } /* end if */
+    }     /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_evict() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__contig_sieve_fill
+ *
+ * Purpose:     Loads a data sieve buffer window starting at the LEN bytes
+ *              at DST_OFF in the dataset's storage, for an access that no
+ *              window holds.
+ *
+ *              The window reused is the one the access continues (so a
+ *              strided walk through one region keeps its own window), an
+ *              empty window, a new window while the dataset's windows fit
+ *              in H5D_SIEVE_SCALE times the sieve buffer size, or else
+ *              the least recently used window.
+ *
+ *              A window's size adapts to how its previous contents were
+ *              used: it doubles when a sequential walk accessed at least
+ *              half of them and halves when less than 1/H5D_SIEVE_SCALE
+ *              of them was accessed, within H5D_SIEVE_SCALE times the
+ *              sieve buffer size either way.
+ *
+ *              For writes (IS_WRITE), the window isn't read from the file
+ *              when the access would overwrite all of it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_sieve_fill(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig, const H5D_contig_storage_t *store_contig,
+                       hsize_t dst_off, size_t len, hbool_t is_write, H5D_rdcdc_win_t **win_out)
+{
+    H5D_rdcdc_win_t *win     = NULL; /* Window to load */
+    H5D_rdcdc_win_t *stream  = NULL; /* Window the access continues */
+    H5D_rdcdc_win_t *empty   = NULL; /* Allocated window holding no data */
+    H5D_rdcdc_win_t *unalloc = NULL; /* Window without a buffer */
+    H5D_rdcdc_win_t *lru     = NULL; /* Least recently used window */
+    haddr_t          addr;           /* Actual address of the access */
+    haddr_t          rel_eoa;        /* Relative end of file address */
+    hsize_t          max_data;       /* Actual maximum size of data to cache */
+    hsize_t          min;            /* temporary minimum value (avoids some ugly macro nesting) */
+    size_t           mem_limit;      /* Limit on the memory used by all windows */
+    size_t           other_mem;      /* Memory used by the other windows */
+    size_t           new_buf_size;   /* New size of the window's buffer */
+    unsigned         u;              /* Local index variable */
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Compute offset on disk */
+    addr = store_contig->dset_addr + dst_off;
+
+    /* Classify the windows */
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        H5D_rdcdc_win_t *w = &dset_contig->win[u];
+
+        if (NULL == w->buf) {
+            if (NULL == unalloc)
+                unalloc = w;
+        } /* end if */
+        else if (0 == w->size) {
+            if (NULL == empty)
+                empty = w;
+        } /* end if */
+        else {
+            if (addr >= (w->loc + w->size) && addr < (w->loc + w->size + w->buf_size) &&
+                (NULL == stream || w->loc > stream->loc))
+                stream = w;
+            if (NULL == lru || w->last_use < lru->last_use)
+                lru = w;
+        } /* end else */
+    }     /* end for */
+
+    /* Choose the window to load */
+    mem_limit = dset_contig->sieve_buf_size * H5D_SIEVE_SCALE;
+    if (stream)
+        win = stream;
+    else if (empty)
+        win = empty;
+    else if (unalloc && (dset_contig->sieve_mem + dset_contig->sieve_buf_size) <= mem_limit)
+        win = unalloc;
+    else
+        win = lru;
+    HDassert(win);
+
+    /* Flush the window's current contents, if they're dirty */
+    if (win->dirty) {
+        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, win->loc, win->size, win->buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+
+        /* Reset window dirty flag */
+        win->dirty = FALSE;
+    } /* end if */
+
+    /* Adapt the window's size to the way its current contents were used */
+    new_buf_size = win->buf ? win->buf_size : dset_contig->sieve_buf_size;
+    if (win->size > 0) {
+        if (win == stream && win->nused >= (win->size / 2))
+            new_buf_size *= 2;
+        else if (win->nused < (win->size / H5D_SIEVE_SCALE))
+            new_buf_size /= 2;
+    } /* end if */
+    new_buf_size = MIN(new_buf_size, mem_limit);
+    new_buf_size = MAX(new_buf_size, dset_contig->sieve_buf_size / H5D_SIEVE_SCALE);
+    if (new_buf_size > store_contig->dset_size)
+        new_buf_size = (size_t)store_contig->dset_size;
+
+    /* Keep the memory used by all windows within the limit when growing */
+    if (new_buf_size > win->buf_size) {
+        other_mem = dset_contig->sieve_mem - win->buf_size;
+        if (other_mem + new_buf_size > mem_limit)
+            new_buf_size = MAX(win->buf_size, (other_mem < mem_limit ? mem_limit - other_mem : 0));
+    } /* end if */
+    new_buf_size = MAX(new_buf_size, len);
+
+    /* The window's current contents are going away */
+    win->loc  = HADDR_UNDEF;
+    win->size = 0;
+
+    /* (Re-)allocate the window's buffer */
+    if (NULL == win->buf || new_buf_size != win->buf_size) {
+        if (win->buf) {
+            win->buf = (unsigned char *)H5FL_BLK_FREE(sieve_buf, win->buf);
+            dset_contig->sieve_mem -= win->buf_size;
+            win->buf_size = 0;
+        } /* end if */
+        if (NULL == (win->buf = H5FL_BLK_MALLOC(sieve_buf, new_buf_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
+        win->buf_size = new_buf_size;
+        dset_contig->sieve_mem += new_buf_size;
+    } /* end if */
+
+    /* Flush and drop the other windows the access overlaps */
+    if (H5D__contig_sieve_evict(f_sh, dset_contig, win, addr, len, TRUE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to evict sieve buffer windows")
+
+    /* Make certain we don't read off the end of the file */
+    if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
+
+    /* Set up the buffer parameters */
+    max_data = store_contig->dset_size - dst_off;
+
+    /* Compute the size of the window.
+     * Don't read off the end of the file, don't read past
+     * the end of the data element, don't read more than
+     * the buffer size and don't overlap the windows after this one.
+     */
+    min = MIN3(rel_eoa - addr, max_data, win->buf_size);
+    for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+        const H5D_rdcdc_win_t *w = &dset_contig->win[u];
+
+        if (w != win && w->size > 0 && w->loc > addr && (w->loc - addr) < min)
+            min = w->loc - addr;
+    } /* end for */
+    H5_CHECKED_ASSIGN(win->size, size_t, min, hsize_t);
+
+    /* Read the new window, unless a write will overwrite all of it */
+    if (!is_write || win->size > len)
+        if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, win->size, win->buf) < 0) {
+            win->size = 0;
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+        } /* end if */
+
+    /* Set up the window */
+    win->loc   = addr;
+    win->nused = 0;
+    win->dirty = FALSE;
+
+    *win_out = win;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_sieve_fill() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv_sieve_cb
  *
@@ -688,148 +1075,46 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
     H5F_shared_t *f_sh        = udata->f_sh;        /* Shared file for dataset */
     H5D_rdcdc_t * dset_contig = udata->dset_contig; /* Cached information about contiguous data */
     const H5D_contig_storage_t *store_contig =
-        udata->store_contig; /* Contiguous storage info for this I/O operation */
-    unsigned char *buf;      /* Pointer to buffer to fill */
-    haddr_t        addr;     /* Actual address to read */
-    haddr_t sieve_start = HADDR_UNDEF, sieve_end = HADDR_UNDEF; /* Start & end locations of sieve buffer */
-    haddr_t contig_end;                                         /* End locations of block to write */
-    size_t  sieve_size = (size_t)-1;                            /* Size of sieve buffer */
-    haddr_t rel_eoa;                                            /* Relative end of file address	*/
-    hsize_t max_data;                                           /* Actual maximum size of data to cache */
-    hsize_t min;                 /* temporary minimum value (avoids some ugly macro nesting) */
-    herr_t  ret_value = SUCCEED; /* Return value */
+        udata->store_contig;       /* Contiguous storage info for this I/O operation */
+    H5D_rdcdc_win_t *win;          /* Sieve buffer window holding the data */
+    unsigned char *  buf;          /* Pointer to buffer to fill */
+    haddr_t          addr;         /* Actual address to read */
+    herr_t           ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Stash local copies of these value */
-    if (dset_contig->sieve_buf != NULL) {
-        sieve_start = dset_contig->sieve_loc;
-        sieve_size  = dset_contig->sieve_size;
-        sieve_end   = sieve_start + sieve_size;
-    } /* end if */
-
     /* Compute offset on disk */
     addr = store_contig->dset_addr + dst_off;
 
     /* Compute offset in memory */
     buf = udata->rbuf + src_off;
 
-    /* Check if the sieve buffer is allocated yet */
-    if (NULL == dset_contig->sieve_buf) {
+    /* Check if the entire read is within a sieve buffer window */
+    if (NULL == (win = H5D__contig_sieve_find(dset_contig, addr, len))) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
         if (len > dset_contig->sieve_buf_size) {
-            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
-        } /* end if */
-        else {
-            /* Allocate room for the data sieve buffer */
-            if (NULL == (dset_contig->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
-
-            /* Determine the new sieve buffer size & location */
-            dset_contig->sieve_loc = addr;
-
-            /* Make certain we don't read off the end of the file */
-            if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
+            /* Flush any dirty windows the read overlaps */
+            if (H5D__contig_sieve_evict(f_sh, dset_contig, NULL, addr, len, FALSE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve buffer windows")
 
-            /* Set up the buffer parameters */
-            max_data = store_contig->dset_size - dst_off;
-
-            /* Compute the size of the sieve buffer */
-            min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-            H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
-            /* Read the new sieve buffer */
-            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size,
-                                      dset_contig->sieve_buf) < 0)
+            /* Read directly into the user's buffer */
+            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
 
-            /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-            H5MM_memcpy(buf, dset_contig->sieve_buf, len);
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
 
-            /* Reset sieve buffer dirty flag */
-            dset_contig->sieve_dirty = FALSE;
-        } /* end else */
-    }     /* end if */
-    else {
-        /* Compute end of sequence to retrieve */
-        contig_end = addr + len - 1;
+        /* Load a window starting with the data */
+        if (H5D__contig_sieve_fill(f_sh, dset_contig, store_contig, dst_off, len, FALSE, &win) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to fill sieve buffer window")
+    } /* end if */
 
-        /* If entire read is within the sieve buffer, read it from the buffer */
-        if (addr >= sieve_start && contig_end < sieve_end) {
-            unsigned char *base_sieve_buf = dset_contig->sieve_buf + (addr - sieve_start);
+    /* Grab the data out of the window */
+    H5MM_memcpy(buf, win->buf + (addr - win->loc), len);
 
-            /* Grab the data out of the buffer */
-            H5MM_memcpy(buf, base_sieve_buf, len);
-        } /* end if */
-        /* Entire request is not within this data sieve buffer */
-        else {
-            /* Check if we can actually hold the I/O request in the sieve buffer */
-            if (len > dset_contig->sieve_buf_size) {
-                /* Check for any overlap with the current sieve buffer */
-                if ((sieve_start >= addr && sieve_start < (contig_end + 1)) ||
-                    ((sieve_end - 1) >= addr && (sieve_end - 1) < (contig_end + 1))) {
-                    /* Flush the sieve buffer, if it's dirty */
-                    if (dset_contig->sieve_dirty) {
-                        /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-
-                        /* Reset sieve buffer dirty flag */
-                        dset_contig->sieve_dirty = FALSE;
-                    } /* end if */
-                }     /* end if */
-
-                /* Read directly into the user's buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
-            } /* end if */
-            /* Element size fits within the buffer size */
-            else {
-                /* Flush the sieve buffer if it's dirty */
-                if (dset_contig->sieve_dirty) {
-                    /* Write to file */
-                    if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                               dset_contig->sieve_buf) < 0)
-                        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-
-                    /* Reset sieve buffer dirty flag */
-                    dset_contig->sieve_dirty = FALSE;
-                } /* end if */
-
-                /* Determine the new sieve buffer size & location */
-                dset_contig->sieve_loc = addr;
-
-                /* Make certain we don't read off the end of the file */
-                if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
-
-                /* Only need this when resizing sieve buffer */
-                max_data = store_contig->dset_size - dst_off;
-
-                /* Compute the size of the sieve buffer.
-                 * Don't read off the end of the file, don't read past
-                 * the end of the data element, and don't read more than
-                 * the buffer size.
-                 */
-                min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-                H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
-                /* Read the new sieve buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                          dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
-
-                /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-                H5MM_memcpy(buf, dset_contig->sieve_buf, len);
-
-                /* Reset sieve buffer dirty flag */
-                dset_contig->sieve_dirty = FALSE;
-            } /* end else */
-        }     /* end else */
-    }         /* end else */
+    /* Note the use of the window */
+    win->nused += len;
+    win->last_use = ++dset_contig->sieve_clock;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -955,198 +1240,76 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void
     H5F_shared_t *f_sh        = udata->f_sh;        /* Shared file for dataset */
     H5D_rdcdc_t * dset_contig = udata->dset_contig; /* Cached information about contiguous data */
     const H5D_contig_storage_t *store_contig =
-        udata->store_contig;   /* Contiguous storage info for this I/O operation */
-    const unsigned char *buf;  /* Pointer to buffer to fill */
-    haddr_t              addr; /* Actual address to read */
-    haddr_t sieve_start = HADDR_UNDEF, sieve_end = HADDR_UNDEF; /* Start & end locations of sieve buffer */
-    haddr_t contig_end;                                         /* End locations of block to write */
-    size_t  sieve_size = (size_t)-1;                            /* size of sieve buffer */
-    haddr_t rel_eoa;                                            /* Relative end of file address	*/
-    hsize_t max_data;                                           /* Actual maximum size of data to cache */
-    hsize_t min;                 /* temporary minimum value (avoids some ugly macro nesting) */
-    herr_t  ret_value = SUCCEED; /* Return value */
+        udata->store_contig;       /* Contiguous storage info for this I/O operation */
+    H5D_rdcdc_win_t *    win;      /* Sieve buffer window to hold the data */
+    const unsigned char *buf;      /* Pointer to buffer to fill */
+    haddr_t              addr;     /* Actual address to read */
+    unsigned             u;        /* Local index variable */
+    herr_t               ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Stash local copies of these values */
-    if (dset_contig->sieve_buf != NULL) {
-        sieve_start = dset_contig->sieve_loc;
-        sieve_size  = dset_contig->sieve_size;
-        sieve_end   = sieve_start + sieve_size;
-    } /* end if */
-
     /* Compute offset on disk */
     addr = store_contig->dset_addr + dst_off;
 
     /* Compute offset in memory */
     buf = udata->wbuf + src_off;
 
-    /* No data sieve buffer yet, go allocate one */
-    if (NULL == dset_contig->sieve_buf) {
+    /* Check if the entire write is within a sieve buffer window */
+    if (NULL == (win = H5D__contig_sieve_find(dset_contig, addr, len))) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
         if (len > dset_contig->sieve_buf_size) {
+            /* Flush and drop any windows the write overlaps */
+            if (H5D__contig_sieve_evict(f_sh, dset_contig, NULL, addr, len, TRUE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve buffer windows")
+
+            /* Write directly from the user's buffer */
             if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+
+            HGOTO_DONE(SUCCEED)
         } /* end if */
-        else {
-            /* Allocate room for the data sieve buffer */
-            if (NULL == (dset_contig->sieve_buf = H5FL_BLK_CALLOC(sieve_buf, dset_contig->sieve_buf_size)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "memory allocation failed")
-
-            /* Clear memory */
-            if (dset_contig->sieve_size > len)
-                HDmemset(dset_contig->sieve_buf + len, 0, (dset_contig->sieve_size - len));
-
-            /* Determine the new sieve buffer size & location */
-            dset_contig->sieve_loc = addr;
-
-            /* Make certain we don't read off the end of the file */
-            if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
-
-            /* Set up the buffer parameters */
-            max_data = store_contig->dset_size - dst_off;
-
-            /* Compute the size of the sieve buffer */
-            min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-            H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
-            /* Check if there is any point in reading the data from the file */
-            if (dset_contig->sieve_size > len) {
-                /* Read the new sieve buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                          dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
-            } /* end if */
 
-            /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-            H5MM_memcpy(dset_contig->sieve_buf, buf, len);
+        /* Check if it is possible to (exactly) prepend or append to an existing (dirty) window */
+        for (u = 0; u < H5D_SIEVE_NWINDOWS; u++) {
+            H5D_rdcdc_win_t *w = &dset_contig->win[u];
 
-            /* Set sieve buffer dirty flag */
-            dset_contig->sieve_dirty = TRUE;
+            if (w->size > 0 && w->dirty && ((addr + len) == w->loc || addr == (w->loc + w->size)) &&
+                (len + w->size) <= w->buf_size) {
+                win = w;
+                break;
+            } /* end if */
+        }     /* end for */
 
-            /* Stash local copies of these values */
-            sieve_start = dset_contig->sieve_loc;
-            sieve_size  = dset_contig->sieve_size;
-            sieve_end   = sieve_start + sieve_size;
-        } /* end else */
-    }     /* end if */
-    else {
-        /* Compute end of sequence to retrieve */
-        contig_end = addr + len - 1;
+        if (win) {
+            /* Flush and drop any other windows the new data overlaps */
+            if (H5D__contig_sieve_evict(f_sh, dset_contig, win, addr, len, TRUE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to flush sieve buffer windows")
 
-        /* If entire write is within the sieve buffer, write it to the buffer */
-        if (addr >= sieve_start && contig_end < sieve_end) {
-            unsigned char *base_sieve_buf = dset_contig->sieve_buf + (addr - sieve_start);
+            /* Prepend to the existing window */
+            if ((addr + len) == win->loc) {
+                /* Move existing sieve information to correct location */
+                HDmemmove(win->buf + len, win->buf, win->size);
 
-            /* Put the data into the sieve buffer */
-            H5MM_memcpy(base_sieve_buf, buf, len);
+                /* Adjust window location */
+                win->loc = addr;
+            } /* end if */
 
-            /* Set sieve buffer dirty flag */
-            dset_contig->sieve_dirty = TRUE;
+            /* Adjust window size */
+            win->size += len;
         } /* end if */
-        /* Entire request is not within this data sieve buffer */
-        else {
-            /* Check if we can actually hold the I/O request in the sieve buffer */
-            if (len > dset_contig->sieve_buf_size) {
-                /* Check for any overlap with the current sieve buffer */
-                if ((sieve_start >= addr && sieve_start < (contig_end + 1)) ||
-                    ((sieve_end - 1) >= addr && (sieve_end - 1) < (contig_end + 1))) {
-                    /* Flush the sieve buffer, if it's dirty */
-                    if (dset_contig->sieve_dirty) {
-                        /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-
-                        /* Reset sieve buffer dirty flag */
-                        dset_contig->sieve_dirty = FALSE;
-                    } /* end if */
-
-                    /* Force the sieve buffer to be re-read the next time */
-                    dset_contig->sieve_loc  = HADDR_UNDEF;
-                    dset_contig->sieve_size = 0;
-                } /* end if */
-
-                /* Write directly from the user's buffer */
-                if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-            } /* end if */
-            /* Element size fits within the buffer size */
-            else {
-                /* Check if it is possible to (exactly) prepend or append to existing (dirty) sieve buffer */
-                if (((addr + len) == sieve_start || addr == sieve_end) &&
-                    (len + sieve_size) <= dset_contig->sieve_buf_size && dset_contig->sieve_dirty) {
-                    /* Prepend to existing sieve buffer */
-                    if ((addr + len) == sieve_start) {
-                        /* Move existing sieve information to correct location */
-                        HDmemmove(dset_contig->sieve_buf + len, dset_contig->sieve_buf,
-                                  dset_contig->sieve_size);
-
-                        /* Copy in new information (must be first in sieve buffer) */
-                        H5MM_memcpy(dset_contig->sieve_buf, buf, len);
-
-                        /* Adjust sieve location */
-                        dset_contig->sieve_loc = addr;
-
-                    } /* end if */
-                    /* Append to existing sieve buffer */
-                    else {
-                        /* Copy in new information */
-                        H5MM_memcpy(dset_contig->sieve_buf + sieve_size, buf, len);
-                    } /* end else */
-
-                    /* Adjust sieve size */
-                    dset_contig->sieve_size += len;
-                } /* end if */
-                /* Can't add the new data onto the existing sieve buffer */
-                else {
-                    /* Flush the sieve buffer if it's dirty */
-                    if (dset_contig->sieve_dirty) {
-                        /* Write to file */
-                        if (H5F_shared_block_write(f_sh, H5FD_MEM_DRAW, sieve_start, sieve_size,
-                                                   dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
-
-                        /* Reset sieve buffer dirty flag */
-                        dset_contig->sieve_dirty = FALSE;
-                    } /* end if */
-
-                    /* Determine the new sieve buffer size & location */
-                    dset_contig->sieve_loc = addr;
-
-                    /* Make certain we don't read off the end of the file */
-                    if (HADDR_UNDEF == (rel_eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
-                        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to determine file size")
-
-                    /* Only need this when resizing sieve buffer */
-                    max_data = store_contig->dset_size - dst_off;
-
-                    /* Compute the size of the sieve buffer.
-                     * Don't read off the end of the file, don't read past
-                     * the end of the data element, and don't read more than
-                     * the buffer size.
-                     */
-                    min = MIN3(rel_eoa - dset_contig->sieve_loc, max_data, dset_contig->sieve_buf_size);
-                    H5_CHECKED_ASSIGN(dset_contig->sieve_size, size_t, min, hsize_t);
-
-                    /* Check if there is any point in reading the data from the file */
-                    if (dset_contig->sieve_size > len) {
-                        /* Read the new sieve buffer */
-                        if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, dset_contig->sieve_loc,
-                                                  dset_contig->sieve_size, dset_contig->sieve_buf) < 0)
-                            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
-                    } /* end if */
-
-                    /* Grab the data out of the buffer (must be first piece of data in buffer ) */
-                    H5MM_memcpy(dset_contig->sieve_buf, buf, len);
-
-                    /* Set sieve buffer dirty flag */
-                    dset_contig->sieve_dirty = TRUE;
-                } /* end else */
-            }     /* end else */
-        }         /* end else */
-    }             /* end else */
+        /* Can't add the new data onto an existing window */
+        else if (H5D__contig_sieve_fill(f_sh, dset_contig, store_contig, dst_off, len, TRUE, &win) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to fill sieve buffer window")
+    } /* end if */
+
+    /* Put the data into the window */
+    H5MM_memcpy(win->buf + (addr - win->loc), buf, len);
+
+    /* Set window dirty flag and note its use */
+    win->dirty = TRUE;
+    win->nused += len;
+    win->last_use = ++dset_contig->sieve_clock;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1327,10 +1490,9 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f
     hbool_t       fix_ref     = FALSE; /* Flag to indicate that ref values should be fixed */
     H5D_shared_t *shared_fo =
         (H5D_shared_t *)cpy_info->shared_fo; /* Pointer to the shared struct for dataset object */
-    hbool_t try_sieve   = FALSE;             /* Try to get data from the sieve buffer */
-    haddr_t sieve_start = HADDR_UNDEF;       /* Start location of sieve buffer */
-    haddr_t sieve_end   = HADDR_UNDEF;       /* End locations of sieve buffer */
-    herr_t  ret_value   = SUCCEED;           /* Return value */
+    hbool_t          try_sieve = FALSE;      /* Try to get data from the sieve buffer */
+    H5D_rdcdc_win_t *win;                    /* Sieve buffer window holding the data */
+    herr_t           ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -1456,11 +1618,8 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f
 
     /* If data sieving is enabled and the dataset is open in the file,
        set up to copy data out of the sieve buffer if deemed possible later */
-    if (H5F_HAS_FEATURE(f_src, H5FD_FEAT_DATA_SIEVE) && shared_fo && shared_fo->cache.contig.sieve_buf) {
-        try_sieve   = TRUE;
-        sieve_start = shared_fo->cache.contig.sieve_loc;
-        sieve_end   = sieve_start + shared_fo->cache.contig.sieve_size;
-    }
+    if (H5F_HAS_FEATURE(f_src, H5FD_FEAT_DATA_SIEVE) && shared_fo)
+        try_sieve = TRUE;
 
     while (total_src_nbytes > 0) {
         /* Check if we should reduce the number of bytes to transfer */
@@ -1487,12 +1646,9 @@ H5D__contig_copy(H5F_t *f_src, const H5O_storage_contig_t *storage_src, H5F_t *f
                 dst_nbytes = mem_nbytes = src_nbytes;
         } /* end if */
 
-        /* If the entire copy is within the sieve buffer, copy data from the sieve buffer */
-        if (try_sieve && (addr_src >= sieve_start) && ((addr_src + src_nbytes - 1) < sieve_end)) {
-            unsigned char *base_sieve_buf = shared_fo->cache.contig.sieve_buf + (addr_src - sieve_start);
-
-            H5MM_memcpy(buf, base_sieve_buf, src_nbytes);
-        }
+        /* If the entire copy is within a sieve buffer window, copy data from the window */
+        if (try_sieve && NULL != (win = H5D__contig_sieve_find(&shared_fo->cache.contig, addr_src, src_nbytes)))
+            H5MM_memcpy(buf, win->buf + (addr_src - win->loc), src_nbytes);
         else
             /* Read raw data from source file */
             if (H5F_block_read(f_src, H5FD_MEM_DRAW, addr_src, src_nbytes, buf) < 0)
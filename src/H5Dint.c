@@ -116,9 +116,6 @@ H5FL_BLK_DEFINE(vlen_fl_buf);
 H5FL_DEFINE_STATIC(H5D_t);
 H5FL_DEFINE_STATIC(H5D_shared_t);
 
-/* Declare the external PQ free list for the sieve buffer information */
-H5FL_BLK_EXTERN(sieve_buf);
-
 /* Declare the external free list to manage the H5D_chunk_info_t struct */
 H5FL_EXTERN(H5D_chunk_info_t);
 
@@ -1937,10 +1934,8 @@ H5D_close(H5D_t *dataset)
         /* Free cached information for each kind of dataset */
         switch (dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
-                /* Free the data sieve buffer, if it's been allocated */
-                if (dataset->shared->cache.contig.sieve_buf)
-                    dataset->shared->cache.contig.sieve_buf =
-                        (unsigned char *)H5FL_BLK_FREE(sieve_buf, dataset->shared->cache.contig.sieve_buf);
+                /* Free the data sieve buffer windows, if they've been allocated */
+                H5D__contig_free_sieve(&dataset->shared->cache.contig);
                 break;
 
             case H5D_CHUNKED:
@@ -2131,10 +2126,8 @@ H5D_mult_refresh_close(hid_t dset_id)
         /* Free cached information for each kind of dataset */
         switch (dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
-                /* Free the data sieve buffer, if it's been allocated */
-                if (dataset->shared->cache.contig.sieve_buf)
-                    dataset->shared->cache.contig.sieve_buf =
-                        (unsigned char *)H5FL_BLK_FREE(sieve_buf, dataset->shared->cache.contig.sieve_buf);
+                /* Free the data sieve buffer windows, if they've been allocated */
+                H5D__contig_free_sieve(&dataset->shared->cache.contig);
                 break;
 
             case H5D_CHUNKED:
@@ -3213,20 +3206,9 @@ H5D__flush_sieve_buf(H5D_t *dataset)
     /* Check args */
     HDassert(dataset);
 
-    /* Flush the raw data buffer, if we have a dirty one */
-    if (dataset->shared->cache.contig.sieve_buf && dataset->shared->cache.contig.sieve_dirty) {
-        HDassert(dataset->shared->layout.type !=
-                 H5D_COMPACT); /* We should never have a sieve buffer for compact storage */
-
-        /* Write dirty data sieve buffer to file */
-        if (H5F_shared_block_write(
-                H5F_SHARED(dataset->oloc.file), H5FD_MEM_DRAW, dataset->shared->cache.contig.sieve_loc,
-                dataset->shared->cache.contig.sieve_size, dataset->shared->cache.contig.sieve_buf) < 0)
-            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
-
-        /* Reset sieve buffer dirty flag */
-        dataset->shared->cache.contig.sieve_dirty = FALSE;
-    } /* end if */
+    /* Flush the raw data buffer windows, if we have dirty ones */
+    if (H5D__contig_flush_sieve(H5F_SHARED(dataset->oloc.file), &dataset->shared->cache.contig) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -3826,6 +3808,12 @@ H5D_get_access_plist(const H5D_t *dset)
         0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set VDS printf gap")
 
+    /* Set the VDS source I/O options */
+    if (H5P_set(new_plist, H5D_ACS_VDS_PREFETCH_NAME, &(dset->shared->layout.storage.u.virt.prefetch)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set VDS source read-ahead threads")
+    if (H5P_set(new_plist, H5D_ACS_VDS_MAX_OPEN_NAME, &(dset->shared->layout.storage.u.virt.max_open)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set VDS max. open source datasets")
+
     /* Set the vds prefix option */
     if (H5P_set(new_plist, H5D_ACS_VDS_PREFIX_NAME, &(dset->shared->vds_prefix)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set vds prefix")
@@ -228,6 +228,52 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread_chunk() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_mapped
+ *
+ * Purpose:     Returns in *BUF a pointer to the entire contents of a
+ *              dataset inside the memory mapping of its file, instead of
+ *              copying the data into an application buffer.
+ *
+ *              This only succeeds for contiguous datasets whose storage
+ *              has been allocated, whose datatype is the same as
+ *              MEM_TYPE_ID (so no conversion is needed), and whose file
+ *              was opened read-only with the H5FD_MMAP driver.  In all
+ *              other cases, the application should fall back to H5Dread.
+ *
+ *              The data must not be modified through the pointer, which
+ *              remains valid until the file is closed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_mapped(hid_t dset_id, hid_t mem_type_id, const void **buf /*out*/)
+{
+    H5VL_object_t *vol_obj   = NULL;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iix", dset_id, mem_type_id, buf);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    if (H5I_DATATYPE != H5I_get_type(mem_type_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "mem_type_id is not a datatype ID")
+    if (!buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf cannot be NULL")
+
+    /* Get the pointer to the mapped data */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_READ_MAPPED, H5P_DATASET_XFER_DEFAULT,
+                              H5_REQUEST_NULL, mem_type_id, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't get pointer to mapped data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_mapped() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dwrite
  *
@@ -81,6 +81,14 @@
 /* Macros to represent the regularity of the selection for multiple chunk IO case. */
 #define H5D_CHUNK_SELECT_REG 1
 
+/***** Macros for filtered collective IO case. *****/
+/* The process which assigns the owner of a chunk during the redistribution of shared
+ * chunks. The chunk index is scrambled first, so that regular patterns of chunk
+ * selections are spread evenly across the processes.
+ */
+#define H5D_FILTERED_CHUNK_ASSIGNER(IDX, MPI_SIZE)                                                           \
+    ((int)((((hsize_t)(IDX) * (hsize_t)0x9E3779B97F4A7C15ULL) >> 32) % (hsize_t)(MPI_SIZE)))
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -207,6 +215,34 @@ typedef struct H5D_filtered_collective_io_info_t {
     } async_info;
 } H5D_filtered_collective_io_info_t;
 
+/*
+ * Information about a process' selection in a chunk, exchanged with the process which
+ * assigns the chunk's owner in H5D__chunk_redistribute_shared_chunks(). The fields
+ * have the same meaning as the matching fields of H5D_filtered_collective_io_info_t.
+ */
+typedef struct H5D_chunk_redistribute_info_t {
+    hsize_t index;
+    size_t  num_writers;
+    int     original_owner;
+    int     new_owner;
+} H5D_chunk_redistribute_info_t;
+
+/*
+ * Information about a chunk written during a collective filtered write, which every
+ * process needs for the collective re-allocation of the chunk in the file and the
+ * collective re-insertion of the chunk into the chunk index. The chunk's scaled
+ * coordinates are computed from its index, so they are not exchanged.
+ *
+ *   need_insert - Whether the chunk's record in the chunk index must be updated. This
+ *                 field is set after the chunk has been re-allocated.
+ */
+typedef struct H5D_chunk_alloc_info_t {
+    hsize_t     index;
+    H5F_block_t chunk_current;
+    H5F_block_t new_chunk;
+    hbool_t     need_insert;
+} H5D_chunk_alloc_info_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -257,9 +293,12 @@ static herr_t H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io
 static int    H5D__cmp_chunk_addr(const void *chunk_addr_info1, const void *chunk_addr_info2);
 static int    H5D__cmp_filtered_collective_io_info_entry(const void *filtered_collective_io_info_entry1,
                                                          const void *filtered_collective_io_info_entry2);
+static int    H5D__cmp_chunk_alloc_info(const void *chunk_alloc_info1, const void *chunk_alloc_info2);
 #if MPI_VERSION >= 3
-static int H5D__cmp_filtered_collective_io_info_entry_owner(const void *filtered_collective_io_info_entry1,
-                                                            const void *filtered_collective_io_info_entry2);
+static int H5D__cmp_chunk_redistribute_info(const void *chunk_redistribute_info1,
+                                            const void *chunk_redistribute_info2);
+static int H5D__cmp_chunk_redistribute_info_owner(const void *chunk_redistribute_info1,
+                                                  const void *chunk_redistribute_info2);
 #endif
 
 /*********************/
@@ -1297,9 +1336,10 @@ done:
  *                 operation
  *                 A. If any chunk is being written to by more than 1
  *                    process, the process writing to the chunk which
- *                    currently has the least amount of chunks assigned
- *                    to it becomes the new owner (in the case of ties,
- *                    the lowest MPI rank becomes the new owner)
+ *                    has the least amount of chunks assigned to it by
+ *                    the chunk's assigning process becomes the new
+ *                    owner (in the case of ties, the lowest MPI rank
+ *                    becomes the new owner)
  *              2. If the operation is a write operation
  *                 A. Loop through each chunk in the operation
  *                    I. If this is not a full overwrite of the chunk
@@ -1314,7 +1354,8 @@ done:
  *                    IV. Filter the chunk
  *                 B. Contribute the modified chunks to an array gathered
  *                    by all processes which contains the new sizes of
- *                    every chunk modified in the collective IO operation
+ *                    every chunk modified in the collective IO operation,
+ *                    sorted in increasing order of chunk index
  *                 C. All processes collectively re-allocate each chunk
  *                    from the gathered array with their new sizes after
  *                    the filter operation
@@ -1323,8 +1364,9 @@ done:
  *                    file to write out the process' selected chunks to the
  *                    file
  *                 E. Perform the collective write
- *                 F. All processes collectively re-insert each modified
- *                    chunk from the gathered array into the chunk index
+ *                 F. All processes collectively re-insert each chunk
+ *                    from the gathered array which was re-allocated into
+ *                    the chunk index
  *
  *
  * Return:      Non-negative on success/Negative on failure
@@ -1338,19 +1380,19 @@ static herr_t
 H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                                        H5D_chunk_map_t *fm)
 {
-    H5D_filtered_collective_io_info_t *chunk_list = NULL; /* The list of chunks being read/written */
-    H5D_filtered_collective_io_info_t *collective_chunk_list =
-        NULL;                /* The list of chunks used during collective operations */
+    H5D_filtered_collective_io_info_t *chunk_list       = NULL; /* The list of chunks being read/written */
+    H5D_chunk_alloc_info_t *           local_alloc_info = NULL; /* Allocation info for this process' chunks */
+    H5D_chunk_alloc_info_t *           collective_alloc_info =
+        NULL;                /* Allocation info for the chunks written by all processes */
     H5D_storage_t ctg_store; /* Chunk storage information as contiguous dataset */
     MPI_Datatype  mem_type             = MPI_BYTE;
     MPI_Datatype  file_type            = MPI_BYTE;
     hbool_t       mem_type_is_derived  = FALSE;
     hbool_t       file_type_is_derived = FALSE;
     size_t        chunk_list_num_entries;
-    size_t        collective_chunk_list_num_entries;
-    size_t *      num_chunks_selected_array = NULL; /* Array of number of chunks selected on each process */
-    size_t        i;                                /* Local index variable */
-    int           mpi_rank, mpi_size, mpi_code;
+    size_t        collective_alloc_info_num_entries;
+    size_t        i; /* Local index variable */
+    int           mpi_rank, mpi_code;
     herr_t        ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
@@ -1359,11 +1401,9 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
     HDassert(type_info);
     HDassert(fm);
 
-    /* Obtain the current rank of the process and the number of processes */
+    /* Obtain the current rank of the process */
     if ((mpi_rank = H5F_mpi_get_rank(io_info->dset->oloc.file)) < 0)
         HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi rank")
-    if ((mpi_size = H5F_mpi_get_size(io_info->dset->oloc.file)) < 0)
-        HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi size")
 
     /* Set the actual-chunk-opt-mode property. */
     H5CX_set_mpio_actual_chunk_opt(H5D_MPIO_LINK_CHUNK);
@@ -1381,6 +1421,7 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
     if (io_info->op_type == H5D_IO_OP_WRITE) { /* Filtered collective write */
         H5D_chk_idx_info_t index_info;
         H5D_chunk_ud_t     udata;
+        hsize_t            scaled[H5O_LAYOUT_NDIMS] = {0};
         hsize_t            mpi_buf_count;
 
         /* Construct chunked index info */
@@ -1404,54 +1445,64 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
                     HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entry")
 
         /* Gather the new chunk sizes to all processes for a collective reallocation
-         * of the chunks in the file.
+         * of the chunks in the file. Only the information needed to re-allocate and
+         * re-insert each chunk is gathered, sorted in increasing order of chunk index
+         * so that every process allocates the chunks in the same order and the
+         * chunks are laid out in the file in the order of the chunk index.
          */
-        if (H5D__mpio_array_gatherv(chunk_list, chunk_list_num_entries,
-                                    sizeof(H5D_filtered_collective_io_info_t),
-                                    (void **)&collective_chunk_list, &collective_chunk_list_num_entries, true,
-                                    0, io_info->comm, NULL) < 0)
+        if (chunk_list_num_entries) {
+            if (NULL == (local_alloc_info = (H5D_chunk_alloc_info_t *)H5MM_malloc(
+                             chunk_list_num_entries * sizeof(H5D_chunk_alloc_info_t))))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk allocation info array")
+
+            for (i = 0; i < chunk_list_num_entries; i++) {
+                local_alloc_info[i].index         = chunk_list[i].index;
+                local_alloc_info[i].chunk_current = chunk_list[i].chunk_states.chunk_current;
+                local_alloc_info[i].new_chunk     = chunk_list[i].chunk_states.new_chunk;
+                local_alloc_info[i].need_insert   = FALSE;
+            } /* end for */
+        }     /* end if */
+
+        if (H5D__mpio_array_gatherv(local_alloc_info, chunk_list_num_entries, sizeof(H5D_chunk_alloc_info_t),
+                                    (void **)&collective_alloc_info, &collective_alloc_info_num_entries, true,
+                                    0, io_info->comm, H5D__cmp_chunk_alloc_info) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGATHER, FAIL, "couldn't gather new chunk sizes")
 
         /* Collectively re-allocate the modified chunks (from each process) in the file */
-        for (i = 0; i < collective_chunk_list_num_entries; i++) {
-            hbool_t insert;
+        for (i = 0; i < collective_alloc_info_num_entries; i++) {
+            H5VM_array_calc_pre(collective_alloc_info[i].index, fm->f_ndims, fm->layout->u.chunk.down_chunks,
+                                scaled);
 
-            if (H5D__chunk_file_alloc(&index_info, &collective_chunk_list[i].chunk_states.chunk_current,
-                                      &collective_chunk_list[i].chunk_states.new_chunk, &insert,
-                                      collective_chunk_list[i].scaled) < 0)
+            if (H5D__chunk_file_alloc(&index_info, &collective_alloc_info[i].chunk_current,
+                                      &collective_alloc_info[i].new_chunk,
+                                      &collective_alloc_info[i].need_insert, scaled) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
         } /* end for */
 
-        if (NULL == (num_chunks_selected_array = (size_t *)H5MM_malloc((size_t)mpi_size * sizeof(size_t))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate num chunks selected array")
-
-        if (MPI_SUCCESS !=
-            (mpi_code = MPI_Allgather(&chunk_list_num_entries, 1, MPI_UNSIGNED_LONG_LONG,
-                                      num_chunks_selected_array, 1, MPI_UNSIGNED_LONG_LONG, io_info->comm)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
-
         /* If this process has any chunks selected, create a MPI type for collectively
          * writing out the chunks to file. Otherwise, the process contributes to the
          * collective write with a none type.
          */
         if (chunk_list_num_entries) {
-            size_t offset;
-
             /* During the collective re-allocation of chunks in the file, the record for each
              * chunk is only updated in the collective array, not in the local copy of chunks on each
-             * process. However, each process needs the updated chunk records so that they can create
-             * a MPI type for the collective write that will write to the chunk's possible new locations
-             * in the file instead of the old ones. This ugly hack seems to be the best solution to
-             * copy the information back to the local array and avoid having to modify the collective
-             * write type function in an ugly way so that it will accept the collective array instead
-             * of the local array. This works correctly because the array gather function guarantees
-             * that the chunk data in the collective array is ordered in blocks by rank.
+             * process. Each process needs the updated chunk records so that they can create a MPI
+             * type for the collective write that will write to the chunk's possible new locations
+             * in the file instead of the old ones, so look each of its chunks up in the collective
+             * array.
              */
-            for (i = 0, offset = 0; i < (size_t)mpi_rank; i++)
-                offset += num_chunks_selected_array[i];
+            for (i = 0; i < chunk_list_num_entries; i++) {
+                H5D_chunk_alloc_info_t *alloc_info;
+
+                if (NULL == (alloc_info = (H5D_chunk_alloc_info_t *)HDbsearch(
+                                 &local_alloc_info[i], collective_alloc_info,
+                                 collective_alloc_info_num_entries, sizeof(H5D_chunk_alloc_info_t),
+                                 H5D__cmp_chunk_alloc_info)))
+                    HGOTO_ERROR(H5E_DATASET, H5E_NOTFOUND, FAIL,
+                                "can't locate chunk in allocation info array")
 
-            H5MM_memcpy(chunk_list, &collective_chunk_list[offset],
-                        num_chunks_selected_array[mpi_rank] * sizeof(H5D_filtered_collective_io_info_t));
+                chunk_list[i].chunk_states.new_chunk = alloc_info->new_chunk;
+            } /* end for */
 
             /* Create single MPI type encompassing each selection in the dataspace */
             if (H5D__mpio_filtered_collective_write_type(chunk_list, chunk_list_num_entries, &mem_type,
@@ -1477,12 +1528,19 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
             HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "couldn't finish MPI-IO")
 
         /* Participate in the collective re-insertion of all chunks modified
-         * in this iteration into the chunk index
+         * in this iteration into the chunk index. Chunks which kept their place
+         * in the file already have the correct record in the index.
          */
-        for (i = 0; i < collective_chunk_list_num_entries; i++) {
-            udata.chunk_block   = collective_chunk_list[i].chunk_states.new_chunk;
-            udata.common.scaled = collective_chunk_list[i].scaled;
-            udata.chunk_idx     = collective_chunk_list[i].index;
+        for (i = 0; i < collective_alloc_info_num_entries; i++) {
+            if (!collective_alloc_info[i].need_insert)
+                continue;
+
+            H5VM_array_calc_pre(collective_alloc_info[i].index, fm->f_ndims, fm->layout->u.chunk.down_chunks,
+                                scaled);
+
+            udata.chunk_block   = collective_alloc_info[i].new_chunk;
+            udata.common.scaled = scaled;
+            udata.chunk_idx     = collective_alloc_info[i].index;
 
             if ((index_info.storage->ops->insert)(&index_info, &udata, io_info->dset) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk address into index")
@@ -1499,10 +1557,10 @@ done:
         H5MM_free(chunk_list);
     } /* end if */
 
-    if (num_chunks_selected_array)
-        H5MM_free(num_chunks_selected_array);
-    if (collective_chunk_list)
-        H5MM_free(collective_chunk_list);
+    if (local_alloc_info)
+        H5MM_free(local_alloc_info);
+    if (collective_alloc_info)
+        H5MM_free(collective_alloc_info);
 
     /* Free the MPI buf and file types, if they were derived */
     if (mem_type_is_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&mem_type)))
@@ -1728,9 +1786,10 @@ done:
  *                 operation
  *                 A. If any chunk is being written to by more than 1
  *                    process, the process writing to the chunk which
- *                    currently has the least amount of chunks assigned
- *                    to it becomes the new owner (in the case of ties,
- *                    the lowest MPI rank becomes the new owner)
+ *                    has the least amount of chunks assigned to it by
+ *                    the chunk's assigning process becomes the new
+ *                    owner (in the case of ties, the lowest MPI rank
+ *                    becomes the new owner)
  *              2. If the operation is a read operation
  *                 A. Loop through each chunk in the operation
  *                    I. Read the chunk from the file
@@ -2238,40 +2297,99 @@ H5D__cmp_filtered_collective_io_info_entry(const void *filtered_collective_io_in
     FUNC_LEAVE_NOAPI(H5F_addr_cmp(addr1, addr2))
 } /* end H5D__cmp_filtered_collective_io_info_entry() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cmp_chunk_alloc_info
+ *
+ * Purpose:     Routine to compare chunk allocation info entries by chunk
+ *              index
+ *
+ * Description: Callback for qsort() and bsearch() to compare chunk
+ *              allocation info entries
+ *
+ * Return:      -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__cmp_chunk_alloc_info(const void *chunk_alloc_info1, const void *chunk_alloc_info2)
+{
+    hsize_t index1 = 0, index2 = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    index1 = ((const H5D_chunk_alloc_info_t *)chunk_alloc_info1)->index;
+    index2 = ((const H5D_chunk_alloc_info_t *)chunk_alloc_info2)->index;
+
+    FUNC_LEAVE_NOAPI((index1 > index2) - (index1 < index2))
+} /* end H5D__cmp_chunk_alloc_info() */
+
 #if MPI_VERSION >= 3
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__cmp_filtered_collective_io_info_entry_owner
+ * Function:    H5D__cmp_chunk_redistribute_info
  *
- * Purpose:     Routine to compare filtered collective chunk io info
- *              entries's original owner fields
+ * Purpose:     Routine to compare chunk redistribution info entries by
+ *              chunk index, then by original owner
  *
- * Description: Callback for qsort() to compare filtered collective chunk
- *              io info entries's original owner fields
+ * Description: Callback for qsort() to compare chunk redistribution info
+ *              entries
  *
- * Return:      The difference between the two
- *              H5D_filtered_collective_io_info_t's original owner fields
+ * Return:      -1, 0, 1
  *
- * Programmer:  Jordan Henderson
- *              Monday, Apr. 10th, 2017
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__cmp_chunk_redistribute_info(const void *chunk_redistribute_info1, const void *chunk_redistribute_info2)
+{
+    const H5D_chunk_redistribute_info_t *info1 =
+        (const H5D_chunk_redistribute_info_t *)chunk_redistribute_info1;
+    const H5D_chunk_redistribute_info_t *info2 =
+        (const H5D_chunk_redistribute_info_t *)chunk_redistribute_info2;
+    int                                  ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (info1->index != info2->index)
+        ret_value = (info1->index > info2->index) ? 1 : -1;
+    else
+        ret_value = (info1->original_owner > info2->original_owner) -
+                    (info1->original_owner < info2->original_owner);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cmp_chunk_redistribute_info() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cmp_chunk_redistribute_info_owner
+ *
+ * Purpose:     Routine to compare chunk redistribution info entries by
+ *              original owner, then by chunk index
+ *
+ * Description: Callback for qsort() to compare chunk redistribution info
+ *              entries
+ *
+ * Return:      -1, 0, 1
  *
  *-------------------------------------------------------------------------
  */
 static int
-H5D__cmp_filtered_collective_io_info_entry_owner(const void *filtered_collective_io_info_entry1,
-                                                 const void *filtered_collective_io_info_entry2)
+H5D__cmp_chunk_redistribute_info_owner(const void *chunk_redistribute_info1,
+                                       const void *chunk_redistribute_info2)
 {
-    int owner1 = -1, owner2 = -1;
+    const H5D_chunk_redistribute_info_t *info1 =
+        (const H5D_chunk_redistribute_info_t *)chunk_redistribute_info1;
+    const H5D_chunk_redistribute_info_t *info2 =
+        (const H5D_chunk_redistribute_info_t *)chunk_redistribute_info2;
+    int                                  ret_value = 0;
 
     FUNC_ENTER_STATIC_NOERR
 
-    owner1 = ((const H5D_filtered_collective_io_info_t *)filtered_collective_io_info_entry1)
-                 ->owners.original_owner;
-    owner2 = ((const H5D_filtered_collective_io_info_t *)filtered_collective_io_info_entry2)
-                 ->owners.original_owner;
+    if (info1->original_owner != info2->original_owner)
+        ret_value = (info1->original_owner > info2->original_owner) ? 1 : -1;
+    else
+        ret_value = (info1->index > info2->index) - (info1->index < info2->index);
 
-    FUNC_LEAVE_NOAPI(owner1 - owner2)
-} /* end H5D__cmp_filtered_collective_io_info_entry_owner() */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cmp_chunk_redistribute_info_owner() */
 #endif
 
 /*-------------------------------------------------------------------------
@@ -2738,26 +2856,26 @@ done:
  *
  *              The current implementation follows this 3-phase process:
  *
- *              - Collect everyone's list of chunks into one large list,
- *                sort the list in increasing order of chunk offset in the
- *                file and hand the list off to rank 0
- *
- *              - Rank 0 scans the list looking for matching runs of chunk
- *                offset in the file (corresponding to a shared chunk which
- *                has been selected by more than one rank in the I/O
- *                operation) and for each shared chunk, it redistributes
- *                the chunk to the process writing to the chunk which
- *                currently has the least amount of chunks assigned to it
- *                by modifying the "new_owner" field in each of the list
- *                entries corresponding to that chunk
- *
- *              - After the chunks have been redistributed, rank 0 re-sorts
- *                the list in order of previous owner so that each rank
- *                will get back exactly the array that they contributed to
- *                the redistribution operation, with the "new_owner" field
- *                of each chunk they are modifying having possibly been
- *                modified. Rank 0 then scatters each segment of the list
- *                back to its corresponding rank
+ *              - Each chunk is assigned to an "assigning" process by
+ *                hashing its index. Every process sends a small record
+ *                for each chunk it has selected to the chunk's assigning
+ *                process with a single MPI_Alltoallv call, so no process
+ *                ever holds more than its share of the records
+ *
+ *              - Each assigning process sorts the records it received by
+ *                chunk index and scans them for runs of the same index
+ *                (corresponding to a shared chunk which has been selected
+ *                by more than one rank in the I/O operation). For each
+ *                chunk, it picks the new owner among the processes
+ *                writing to the chunk, choosing the process to which it
+ *                has assigned the least amount of chunks so far, and
+ *                records the number of processes writing to the chunk
+ *
+ *              - The assigning processes re-sort their records by
+ *                original owner and send them back with a second
+ *                MPI_Alltoallv call, so that each process gets back its
+ *                records in the order that it sent them, with the
+ *                "new_owner" field of each chunk possibly modified
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -2772,21 +2890,25 @@ H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_ty
                                       H5D_filtered_collective_io_info_t *local_chunk_array,
                                       size_t *                           local_chunk_array_num_entries)
 {
-    H5D_filtered_collective_io_info_t *shared_chunks_info_array =
-        NULL;                        /* The list of all chunks selected in the operation by all processes */
+    H5D_chunk_redistribute_info_t *send_info_array =
+        NULL; /* Records for the chunks this process has selected, grouped by assigning process */
+    H5D_chunk_redistribute_info_t *recv_info_array =
+        NULL;                        /* Records for the chunks this process assigns owners to */
     H5S_sel_iter_t *mem_iter = NULL; /* Memory iterator for H5D__gather_mem */
     unsigned char **mod_data =
         NULL; /* Array of chunk modification data buffers sent by a process to new chunk owners */
     MPI_Request *send_requests = NULL; /* Array of MPI_Isend chunk modification data send requests */
     MPI_Status * send_statuses = NULL; /* Array of MPI_Isend chunk modification send statuses */
     hbool_t      mem_iter_init = FALSE;
-    size_t       shared_chunks_info_array_num_entries = 0;
-    size_t       num_send_requests                    = 0;
-    size_t *     num_assigned_chunks_array            = NULL;
+    size_t       recv_info_array_num_entries = 0;
+    size_t       num_send_requests           = 0;
+    size_t *     num_assigned_chunks_array   = NULL;
     size_t       i, last_assigned_idx;
     int *        send_counts        = NULL;
     int *        send_displacements = NULL;
-    int          scatter_recvcount_int;
+    int *        recv_counts        = NULL;
+    int *        recv_displacements = NULL;
+    int *        send_positions     = NULL;
     int          mpi_rank, mpi_size, mpi_code;
     herr_t       ret_value = SUCCEED;
 
@@ -2805,93 +2927,161 @@ H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_ty
     /* Set to latest format for encoding dataspace */
     H5CX_set_libver_bounds(NULL);
 
-    if (*local_chunk_array_num_entries)
+    if (*local_chunk_array_num_entries) {
         if (NULL == (send_requests =
                          (MPI_Request *)H5MM_malloc(*local_chunk_array_num_entries * sizeof(MPI_Request))))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate send requests buffer")
 
+        if (NULL == (send_info_array = (H5D_chunk_redistribute_info_t *)H5MM_malloc(
+                         *local_chunk_array_num_entries * sizeof(H5D_chunk_redistribute_info_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                        "couldn't allocate chunk redistribution send buffer")
+    } /* end if */
+
     if (NULL == (mem_iter = (H5S_sel_iter_t *)H5MM_malloc(sizeof(H5S_sel_iter_t))))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate memory iterator")
 
-    /* Gather every rank's list of chunks to rank 0 to allow it to perform the redistribution operation. After
-     * this call, the gathered list will initially be sorted in increasing order of chunk offset in the file.
+    if (NULL == (send_counts = (int *)H5MM_calloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate send counts buffer")
+    if (NULL == (send_displacements = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate send displacements buffer")
+    if (NULL == (recv_counts = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate receive counts buffer")
+    if (NULL == (recv_displacements = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate receive displacements buffer")
+    if (NULL == (send_positions = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate send positions buffer")
+
+    /* Count the records this process sends to each assigning process and exchange
+     * the counts, so that each assigning process knows how many records to expect
      */
-    if (H5D__mpio_array_gatherv(local_chunk_array, *local_chunk_array_num_entries,
-                                sizeof(H5D_filtered_collective_io_info_t), (void **)&shared_chunks_info_array,
-                                &shared_chunks_info_array_num_entries, false, 0, io_info->comm,
-                                H5D__cmp_filtered_collective_io_info_entry) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTGATHER, FAIL, "couldn't gather array")
+    for (i = 0; i < *local_chunk_array_num_entries; i++)
+        send_counts[H5D_FILTERED_CHUNK_ASSIGNER(local_chunk_array[i].index, mpi_size)]++;
 
-    /* Rank 0 redistributes any shared chunks to new owners as necessary */
-    if (mpi_rank == 0) {
-        if (NULL == (send_counts = (int *)H5MM_calloc((size_t)mpi_size * sizeof(int))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate send counts buffer")
+    if (MPI_SUCCESS !=
+        (mpi_code = MPI_Alltoall(send_counts, 1, MPI_INT, recv_counts, 1, MPI_INT, io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Alltoall failed", mpi_code)
 
-        if (NULL == (send_displacements = (int *)H5MM_malloc((size_t)mpi_size * sizeof(int))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate send displacements buffer")
+    send_displacements[0] = recv_displacements[0] = 0;
+    for (i = 1; i < (size_t)mpi_size; i++) {
+        send_displacements[i] = send_displacements[i - 1] + send_counts[i - 1];
+        recv_displacements[i] = recv_displacements[i - 1] + recv_counts[i - 1];
+    } /* end for */
+    recv_info_array_num_entries =
+        (size_t)recv_displacements[mpi_size - 1] + (size_t)recv_counts[mpi_size - 1];
 
+    /* Pack the records, grouped by assigning process. The local chunk list is built
+     * in increasing order of chunk index, so the records sent to each assigning
+     * process are also in increasing order of chunk index.
+     */
+    H5MM_memcpy(send_positions, send_displacements, (size_t)mpi_size * sizeof(int));
+    for (i = 0; i < *local_chunk_array_num_entries; i++) {
+        H5D_chunk_redistribute_info_t *info =
+            &send_info_array[send_positions[H5D_FILTERED_CHUNK_ASSIGNER(local_chunk_array[i].index,
+                                                                        mpi_size)]++];
+
+        HDassert(i == 0 || local_chunk_array[i - 1].index < local_chunk_array[i].index);
+
+        info->index          = local_chunk_array[i].index;
+        info->num_writers    = 0;
+        info->original_owner = local_chunk_array[i].owners.original_owner;
+        info->new_owner      = local_chunk_array[i].owners.new_owner;
+    } /* end for */
+
+    if (recv_info_array_num_entries)
+        if (NULL == (recv_info_array = (H5D_chunk_redistribute_info_t *)H5MM_malloc(
+                         recv_info_array_num_entries * sizeof(H5D_chunk_redistribute_info_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                        "couldn't allocate chunk redistribution receive buffer")
+
+    /* The records are sent as bytes, so convert the counts and displacements */
+    for (i = 0; i < (size_t)mpi_size; i++) {
+        H5_CHECKED_ASSIGN(send_counts[i], int,
+                          (size_t)send_counts[i] * sizeof(H5D_chunk_redistribute_info_t), size_t);
+        H5_CHECKED_ASSIGN(send_displacements[i], int,
+                          (size_t)send_displacements[i] * sizeof(H5D_chunk_redistribute_info_t), size_t);
+        H5_CHECKED_ASSIGN(recv_counts[i], int,
+                          (size_t)recv_counts[i] * sizeof(H5D_chunk_redistribute_info_t), size_t);
+        H5_CHECKED_ASSIGN(recv_displacements[i], int,
+                          (size_t)recv_displacements[i] * sizeof(H5D_chunk_redistribute_info_t), size_t);
+    } /* end for */
+
+    /* Send each record to the process which assigns the chunk's owner */
+    if (MPI_SUCCESS != (mpi_code = MPI_Alltoallv(send_info_array, send_counts, send_displacements, MPI_BYTE,
+                                                 recv_info_array, recv_counts, recv_displacements, MPI_BYTE,
+                                                 io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
+
+    /* Assign an owner to each of the chunks this process is responsible for */
+    if (recv_info_array_num_entries) {
         if (NULL == (num_assigned_chunks_array = (size_t *)H5MM_calloc((size_t)mpi_size * sizeof(size_t))))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
                         "unable to allocate number of assigned chunks array")
 
-        for (i = 0; i < shared_chunks_info_array_num_entries;) {
-            H5D_filtered_collective_io_info_t chunk_entry;
-            haddr_t last_seen_addr  = shared_chunks_info_array[i].chunk_states.chunk_current.offset;
+        /* Bring the records for the same chunk together, in increasing order of rank */
+        if (recv_info_array_num_entries > 1)
+            HDqsort(recv_info_array, recv_info_array_num_entries, sizeof(H5D_chunk_redistribute_info_t),
+                    H5D__cmp_chunk_redistribute_info);
+
+        for (i = 0; i < recv_info_array_num_entries;) {
+            hsize_t chunk_index     = recv_info_array[i].index;
             size_t  set_begin_index = i;
             size_t  num_writers     = 0;
-            int     new_chunk_owner = shared_chunks_info_array[i].owners.original_owner;
+            int     new_chunk_owner = recv_info_array[i].original_owner;
 
             /* Process each set of duplicate entries caused by another process writing to the same chunk */
             do {
-                chunk_entry = shared_chunks_info_array[i];
-
-                send_counts[chunk_entry.owners.original_owner] += (int)sizeof(chunk_entry);
-
                 /* The new owner of the chunk is determined by the process
                  * writing to the chunk which currently has the least amount
                  * of chunks assigned to it
                  */
-                if (num_assigned_chunks_array[chunk_entry.owners.original_owner] <
+                if (num_assigned_chunks_array[recv_info_array[i].original_owner] <
                     num_assigned_chunks_array[new_chunk_owner])
-                    new_chunk_owner = chunk_entry.owners.original_owner;
+                    new_chunk_owner = recv_info_array[i].original_owner;
 
                 num_writers++;
-            } while (++i < shared_chunks_info_array_num_entries &&
-                     shared_chunks_info_array[i].chunk_states.chunk_current.offset == last_seen_addr);
+            } while (++i < recv_info_array_num_entries && recv_info_array[i].index == chunk_index);
 
             /* Set all of the chunk entries' "new_owner" fields */
             for (; set_begin_index < i; set_begin_index++) {
-                shared_chunks_info_array[set_begin_index].owners.new_owner = new_chunk_owner;
-                shared_chunks_info_array[set_begin_index].num_writers      = num_writers;
+                recv_info_array[set_begin_index].new_owner   = new_chunk_owner;
+                recv_info_array[set_begin_index].num_writers = num_writers;
             } /* end for */
 
             num_assigned_chunks_array[new_chunk_owner]++;
         } /* end for */
 
-        /* Sort the new list in order of previous owner so that each original owner of a chunk
-         * entry gets that entry back, with the possibly newly-modified "new_owner" field
+        /* Sort the records back into the order in which they were received, so that each
+         * original owner of a chunk gets its records back in the order it sent them
          */
-        if (shared_chunks_info_array_num_entries > 1)
-            HDqsort(shared_chunks_info_array, shared_chunks_info_array_num_entries,
-                    sizeof(H5D_filtered_collective_io_info_t),
-                    H5D__cmp_filtered_collective_io_info_entry_owner);
-
-        send_displacements[0] = 0;
-        for (i = 1; i < (size_t)mpi_size; i++)
-            send_displacements[i] = send_displacements[i - 1] + send_counts[i - 1];
+        if (recv_info_array_num_entries > 1)
+            HDqsort(recv_info_array, recv_info_array_num_entries, sizeof(H5D_chunk_redistribute_info_t),
+                    H5D__cmp_chunk_redistribute_info_owner);
     } /* end if */
 
-    /* Scatter the segments of the list back to each process */
-    H5_CHECKED_ASSIGN(scatter_recvcount_int, int,
-                      *local_chunk_array_num_entries * sizeof(H5D_filtered_collective_io_info_t), size_t);
-    if (MPI_SUCCESS !=
-        (mpi_code = MPI_Scatterv(shared_chunks_info_array, send_counts, send_displacements, MPI_BYTE,
-                                 local_chunk_array, scatter_recvcount_int, MPI_BYTE, 0, io_info->comm)))
-        HMPI_GOTO_ERROR(FAIL, "unable to scatter shared chunks info buffer", mpi_code)
+    /* Send the records back to their original owners */
+    if (MPI_SUCCESS != (mpi_code = MPI_Alltoallv(recv_info_array, recv_counts, recv_displacements, MPI_BYTE,
+                                                 send_info_array, send_counts, send_displacements, MPI_BYTE,
+                                                 io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
+
+    /* Update the local chunk list from the returned records */
+    for (i = 0; i < (size_t)mpi_size; i++)
+        send_positions[i] = (int)((size_t)send_displacements[i] / sizeof(H5D_chunk_redistribute_info_t));
+    for (i = 0; i < *local_chunk_array_num_entries; i++) {
+        H5D_chunk_redistribute_info_t *info =
+            &send_info_array[send_positions[H5D_FILTERED_CHUNK_ASSIGNER(local_chunk_array[i].index,
+                                                                        mpi_size)]++];
+
+        HDassert(info->index == local_chunk_array[i].index);
+
+        local_chunk_array[i].owners.new_owner = info->new_owner;
+        local_chunk_array[i].num_writers      = info->num_writers;
+    } /* end for */
 
-    if (shared_chunks_info_array) {
-        H5MM_free(shared_chunks_info_array);
-        shared_chunks_info_array = NULL;
+    if (recv_info_array) {
+        H5MM_free(recv_info_array);
+        recv_info_array = NULL;
     } /* end if */
 
     /* Now that the chunks have been redistributed, each process must send its modification data
@@ -3039,6 +3229,14 @@ done:
         H5MM_free(send_counts);
     if (send_displacements)
         H5MM_free(send_displacements);
+    if (recv_counts)
+        H5MM_free(recv_counts);
+    if (recv_displacements)
+        H5MM_free(recv_displacements);
+    if (send_positions)
+        H5MM_free(send_positions);
+    if (send_info_array)
+        H5MM_free(send_info_array);
     if (mod_data)
         H5MM_free(mod_data);
     if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
@@ -3047,8 +3245,8 @@ done:
         H5MM_free(mem_iter);
     if (num_assigned_chunks_array)
         H5MM_free(num_assigned_chunks_array);
-    if (shared_chunks_info_array)
-        H5MM_free(shared_chunks_info_array);
+    if (recv_info_array)
+        H5MM_free(recv_info_array);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_redistribute_shared_chunks() */
@@ -62,6 +62,21 @@
 #define H5D_MARK_SPACE  0x01
 #define H5D_MARK_LAYOUT 0x02
 
+/* Number of independent windows in a contiguous dataset's data sieve buffer */
+#define H5D_SIEVE_NWINDOWS 4
+
+/* Factor by which a sieve window may grow beyond (or shrink below) the
+ * file's sieve buffer size.  The memory used by all windows of a dataset
+ * is also capped at this many times the sieve buffer size.
+ */
+#define H5D_SIEVE_SCALE 8
+
+/* Macros for iterating over chunks to operate on */
+#define H5D_CHUNK_GET_FIRST_NODE(map) (map->use_single ? (H5SL_node_t *)(1) : H5SL_first(map->sel_chunks))
+#define H5D_CHUNK_GET_NODE_INFO(map, node)                                                                   \
+    (map->use_single ? map->single_chunk_info : (H5D_chunk_info_t *)H5SL_item(node))
+#define H5D_CHUNK_GET_NEXT_NODE(map, node) (map->use_single ? (H5SL_node_t *)NULL : H5SL_next(node))
+
 /* Default creation parameters for chunk index data structures */
 /* See H5O_layout_chunk_t */
 
@@ -423,13 +438,23 @@ typedef struct H5D_rdcc_t {
     unsigned scaled_encode_bits[H5S_MAX_RANK]; /* The number of bits needed to encode the scaled dim sizes */
 } H5D_rdcc_t;
 
+/* One window of the raw data contiguous data cache */
+typedef struct H5D_rdcdc_win_t {
+    unsigned char *buf;      /* Buffer to hold the window's data */
+    haddr_t        loc;      /* File location (offset) of the window */
+    size_t         size;     /* Size of the window used (in bytes), 0 if empty */
+    size_t         buf_size; /* Size of the window's buffer allocated (in bytes) */
+    size_t         nused;    /* # of bytes accessed in the window since it was filled */
+    uint64_t       last_use; /* Access "time" of the window, for LRU replacement */
+    hbool_t        dirty;    /* Flag to indicate that the window is dirty */
+} H5D_rdcdc_win_t;
+
 /* The raw data contiguous data cache */
 typedef struct H5D_rdcdc_t {
-    unsigned char *sieve_buf;      /* Buffer to hold data sieve buffer */
-    haddr_t        sieve_loc;      /* File location (offset) of the data sieve buffer */
-    size_t         sieve_size;     /* Size of the data sieve buffer used (in bytes) */
-    size_t         sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
-    hbool_t        sieve_dirty;    /* Flag to indicate that the data sieve buffer is dirty */
+    H5D_rdcdc_win_t win[H5D_SIEVE_NWINDOWS]; /* Data sieve buffer windows */
+    size_t          sieve_buf_size;          /* Nominal size of a data sieve buffer window (in bytes) */
+    size_t          sieve_mem;               /* Memory allocated for all windows (in bytes) */
+    uint64_t        sieve_clock;             /* Counter of window accesses */
 } H5D_rdcdc_t;
 
 /*
@@ -614,6 +639,9 @@ H5_DLL herr_t H5D__layout_oh_write(const H5D_t *dataset, H5O_t *oh, unsigned upd
 H5_DLL herr_t  H5D__contig_alloc(H5F_t *f, H5O_storage_contig_t *storage);
 H5_DLL hbool_t H5D__contig_is_space_alloc(const H5O_storage_t *storage);
 H5_DLL hbool_t H5D__contig_is_data_cached(const H5D_shared_t *shared_dset);
+H5_DLL herr_t  H5D__contig_flush_sieve(H5F_shared_t *f_sh, H5D_rdcdc_t *dset_contig);
+H5_DLL void    H5D__contig_free_sieve(H5D_rdcdc_t *dset_contig);
+H5_DLL herr_t  H5D__contig_get_mapped(const H5D_t *dset, const H5T_t *mem_type, const void **ptr);
 H5_DLL herr_t  H5D__contig_fill(const H5D_io_info_t *io_info);
 H5_DLL herr_t  H5D__contig_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
                                 const H5S_t *file_space, const H5S_t *mem_space, H5D_chunk_map_t *fm);
@@ -660,6 +688,11 @@ H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
 H5_DLL herr_t H5D__chunk_format_convert(H5D_t *dset, H5D_chk_idx_info_t *idx_info,
                                         H5D_chk_idx_info_t *new_idx_info);
 
+/* Functions that operate on packed variable-length chunks */
+H5_DLL herr_t H5D__vlpack_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, H5D_chunk_map_t *fm);
+H5_DLL herr_t H5D__vlpack_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, H5D_chunk_map_t *fm);
+H5_DLL herr_t H5D__vlpack_fill_nil(const H5D_t *dset, const hsize_t *scaled, const H5S_t *space);
+
 /* Functions that operate on compact dataset storage */
 H5_DLL herr_t H5D__compact_fill(const H5D_t *dset);
 H5_DLL herr_t H5D__compact_copy(H5F_t *f_src, H5O_storage_compact_t *storage_src, H5F_t *f_dst,
@@ -53,6 +53,8 @@
 #define H5D_ACS_VDS_VIEW_NAME             "vds_view"             /* VDS view option */
 #define H5D_ACS_VDS_PRINTF_GAP_NAME       "vds_printf_gap"       /* VDS printf gap size */
 #define H5D_ACS_VDS_PREFIX_NAME           "vds_prefix"           /* VDS file prefix */
+#define H5D_ACS_VDS_PREFETCH_NAME         "vds_prefetch"         /* VDS source read-ahead */
+#define H5D_ACS_VDS_MAX_OPEN_NAME         "vds_max_open"         /* Max. VDS source datasets kept open */
 #define H5D_ACS_APPEND_FLUSH_NAME         "append_flush"         /* Append flush actions */
 #define H5D_ACS_EFILE_PREFIX_NAME         "external file prefix" /* External file prefix */
 
@@ -80,10 +82,11 @@
     "local_no_collective_cause" /* cause of broken collective I/O in each process */
 #define H5D_MPIO_GLOBAL_NO_COLLECTIVE_CAUSE_NAME                                                             \
     "global_no_collective_cause"                 /* cause of broken collective I/O in all processes */
-#define H5D_XFER_EDC_NAME       "err_detect"     /* EDC */
-#define H5D_XFER_FILTER_CB_NAME "filter_cb"      /* Filter callback function */
-#define H5D_XFER_CONV_CB_NAME   "type_conv_cb"   /* Type conversion callback function */
-#define H5D_XFER_XFORM_NAME     "data_transform" /* Data transform */
+#define H5D_XFER_EDC_NAME            "err_detect"     /* EDC */
+#define H5D_XFER_FILTER_CB_NAME      "filter_cb"      /* Filter callback function */
+#define H5D_XFER_FILTER_THREADS_NAME "filter_threads" /* Threads for each chunk's filters */
+#define H5D_XFER_CONV_CB_NAME        "type_conv_cb"   /* Type conversion callback function */
+#define H5D_XFER_XFORM_NAME          "data_transform" /* Data transform */
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
 /* Collective chunk instrumentation properties */
 #define H5D_XFER_COLL_CHUNK_LINK_HARD_NAME        "coll_chunk_link_hard"
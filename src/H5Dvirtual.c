@@ -56,6 +56,7 @@
 #include "H5Dpkg.h"      /* Dataset functions                    */
 #include "H5Eprivate.h"  /* Error handling                       */
 #include "H5Fprivate.h"  /* Files                                */
+#include "H5FDprivate.h" /* File drivers                         */
 #include "H5FLprivate.h" /* Free Lists                           */
 #include "H5Gprivate.h"  /* Groups                               */
 #include "H5HGprivate.h" /* Global Heaps                         */
@@ -65,6 +66,7 @@
 #include "H5Pprivate.h"  /* Property Lists                       */
 #include "H5Sprivate.h"  /* Dataspaces                           */
 #include "H5VLprivate.h" /* Virtual Object Layer                 */
+#include "H5VMprivate.h" /* Vectors and arrays                   */
 
 /****************/
 /* Local Macros */
@@ -73,10 +75,55 @@
 /* Default size for sub_dset array */
 #define H5D_VIRTUAL_DEF_SUB_DSET_SIZE 128
 
+/* Minimum number of indexable mappings for which the spatial index is built.
+ * Below this a linear scan over the mappings is cheap enough. */
+#define H5D_VIRTUAL_INDEX_MIN_MAPPINGS 32
+
+/* Number of children per node in the mapping index */
+#define H5D_VIRTUAL_INDEX_FANOUT 16
+
+/* Maximum number of levels in the mapping index (enough for SIZE_MAX
+ * mappings with the fanout above) */
+#define H5D_VIRTUAL_INDEX_MAX_LEVELS 17
+
+/* Whether a mapping's virtual selection is fixed, independent of the extent
+ * of the VDS, so the mapping can be placed in the mapping index */
+#define H5D_VIRTUAL_INDEXABLE(ENT)                                                                           \
+    (!(ENT)->psfn_nsubs && !(ENT)->psdn_nsubs && (ENT)->unlim_dim_virtual < 0 &&                             \
+     (H5S_GET_SELECT_TYPE((ENT)->source_dset.virtual_select) == H5S_SEL_HYPERSLABS ||                       \
+      H5S_GET_SELECT_TYPE((ENT)->source_dset.virtual_select) == H5S_SEL_POINTS))
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Sort key for one mapping while packing the mapping index */
+typedef struct H5D_virtual_index_key_t {
+    hsize_t key; /* Center of the mapping's bounding box in the dimension being sorted */
+    size_t  pos; /* Position of the mapping in the list of indexed mappings */
+} H5D_virtual_index_key_t;
+
+/* Spatial index over the virtual selections of a VDS' mappings.  This is a
+ * static R-tree, bulk loaded with the Sort-Tile-Recursive algorithm, over the
+ * bounding boxes of all mappings whose virtual selection does not change with
+ * the extent of the VDS.  Mappings with unlimited or "printf" virtual
+ * selections are kept in a separate list and always take part in I/O.  Boxes
+ * are stored as rank start coordinates followed by rank end coordinates
+ * (inclusive). */
+typedef struct H5D_virtual_index_t {
+    size_t   list_nused;                                 /* Number of mappings when the index was built */
+    unsigned rank;                                       /* Rank of the virtual dataset */
+    size_t   nitems;                                     /* Number of indexed mappings */
+    size_t * order;                                      /* Mapping indices of the leaves, in packed order */
+    unsigned nlevels;                                    /* Number of levels in the tree */
+    size_t   level_nboxes[H5D_VIRTUAL_INDEX_MAX_LEVELS]; /* Number of nodes in each level (leaves first) */
+    hsize_t *level_boxes[H5D_VIRTUAL_INDEX_MAX_LEVELS];  /* Bounding boxes of the nodes in each level */
+    size_t   nunindexed;                                 /* Number of mappings not in the tree */
+    size_t * unindexed;                                  /* Mapping indices of mappings not in the tree */
+    size_t   io_nused;                                   /* Number of mappings in the current I/O */
+    size_t * io_list;                                    /* Mappings in the current I/O, in list order */
+} H5D_virtual_index_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -103,9 +150,24 @@ static herr_t H5D__virtual_build_source_name(char *
                                              size_t static_strlen, size_t nsubs, hsize_t blockno,
                                              char **built_name);
 static herr_t H5D__virtual_init_all(const H5D_t *dset);
+static herr_t H5D__virtual_build_index(H5O_storage_virtual_t *storage, unsigned rank);
+static void   H5D__virtual_index_pack(H5D_virtual_index_key_t *keys, size_t nkeys, unsigned dim,
+                                      unsigned rank, const hsize_t *boxes);
+static void   H5D__virtual_index_search(H5D_virtual_index_t *index, unsigned level, size_t node,
+                                        const hsize_t *start, const hsize_t *end);
+static void   H5D__virtual_free_index(H5D_virtual_index_t *index);
+static int    H5D__virtual_index_key_cmp(const void *_key1, const void *_key2);
+static int    H5D__virtual_index_idx_cmp(const void *_idx1, const void *_idx2);
 static herr_t H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage,
                                   const H5S_t *file_space, const H5S_t *mem_space, hsize_t *tot_nelmts);
 static herr_t H5D__virtual_post_io(H5O_storage_virtual_t *storage);
+static herr_t H5D__virtual_close_lru_sources(H5O_storage_virtual_t *storage);
+static int    H5D__virtual_last_used_cmp(const void *_srcdset1, const void *_srcdset2);
+#ifdef H5_HAVE_POSIX_FADVISE
+static herr_t H5D__virtual_prefetch(H5O_storage_virtual_t *storage, const H5S_t *file_space);
+static herr_t H5D__virtual_prefetch_one(H5O_storage_virtual_srcdset_t *source_dset, const H5S_t *file_space);
+static herr_t H5D__virtual_prefetch_chunks(const H5D_t *dset, const H5S_t *src_space, int fd);
+#endif /* H5_HAVE_POSIX_FADVISE */
 static herr_t H5D__virtual_read_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                                     const H5S_t *file_space, H5O_storage_virtual_srcdset_t *source_dset);
 static herr_t H5D__virtual_write_one(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
@@ -568,6 +630,14 @@ H5D__virtual_copy_layout(H5O_layout_t *layout)
     orig_list         = virt->list;
     virt->list        = NULL;
 
+    /* The mapping index belongs to the original layout, a new one will be
+     * built at the first I/O */
+    virt->index = NULL;
+
+    /* Source datasets are not copied */
+    virt->nopen     = 0;
+    virt->use_clock = 0;
+
     /* Copy entry list */
     if (virt->list_nused > 0) {
         HDassert(orig_list);
@@ -767,6 +837,13 @@ H5D__virtual_reset_layout(H5O_layout_t *layout)
         virt->source_dapl = -1;
     }
 
+    /* Free the mapping index */
+    H5D__virtual_free_index(virt->index);
+    virt->index = NULL;
+
+    /* All source datasets are closed */
+    virt->nopen = 0;
+
     /* The list is no longer initialized */
     virt->init = FALSE;
 
@@ -897,6 +974,22 @@ H5D__virtual_open_source_dset(const H5D_t *vdset, H5O_storage_virtual_ent_t *vir
     /* Check if we need to open the source file */
     if (HDstrcmp(source_dset->file_name, ".")) {
         unsigned intent; /* File access permissions */
+        htri_t   exists; /* Whether the source file exists */
+
+        /* If the source file was missing at the last attempt, just check
+         * whether it still is, which is much cheaper than failing to open it
+         * again.  Readers of "printf" mappings probe past the last source
+         * dataset every time the extent is evaluated. */
+        if (source_dset->file_missing) {
+            if ((exists = H5F_prefix_file_exists(vdset->oloc.file, H5F_PREFIX_VDS, vdset->shared->vds_prefix,
+                                                 source_dset->file_name)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check whether source file exists")
+            if (!exists) {
+                source_dset->dset_exists = FALSE;
+                HGOTO_DONE(SUCCEED)
+            } /* end if */
+            source_dset->file_missing = FALSE;
+        } /* end if */
 
         /* Get the virtual dataset's file open flags ("intent") */
         intent = H5F_INTENT(vdset->oloc.file);
@@ -909,10 +1002,20 @@ H5D__virtual_open_source_dset(const H5D_t *vdset, H5O_storage_virtual_ent_t *vir
         /* If we opened the source file here, we should close it when leaving */
         if (src_file)
             src_file_open = TRUE;
-        else
+        else {
             /* Reset the error stack */
             H5E_clear_stack(NULL);
-    } /* end if */
+
+            /* Remember whether the open failed because the file does not
+             * exist, if existence can be checked by name */
+            if (vdset->shared->layout.storage.u.virt.stat_sources) {
+                if ((exists = H5F_prefix_file_exists(vdset->oloc.file, H5F_PREFIX_VDS,
+                                                     vdset->shared->vds_prefix, source_dset->file_name)) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check whether source file exists")
+                source_dset->file_missing = !exists;
+            } /* end if */
+        }     /* end else */
+    }         /* end if */
     else
         /* Source file is ".", use the virtual dataset's file */
         src_file = vdset->oloc.file;
@@ -938,9 +1041,15 @@ H5D__virtual_open_source_dset(const H5D_t *vdset, H5O_storage_virtual_ent_t *vir
             source_dset->dset_exists = FALSE;
         } /* end if */
         else {
+            H5O_storage_virtual_t *storage = &vdset->shared->layout.storage.u.virt;
+
             /* Dataset exists */
             source_dset->dset_exists = TRUE;
 
+            /* Count it as open and most recently used */
+            storage->nopen++;
+            source_dset->last_used = ++storage->use_clock;
+
             /* Patch the source selection if necessary */
             if (virtual_ent->source_space_status != H5O_VIRTUAL_STATUS_CORRECT) {
                 if (H5S_extent_copy(virtual_ent->source_select, source_dset->dset->shared->space) < 0)
@@ -1661,6 +1770,7 @@ H5D__virtual_set_extent_unlim(const H5D_t *dset)
                                 HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL,
                                             "unable to close source dataset")
                             storage->list[i].sub_dset[j].dset = NULL;
+                            storage->nopen--;
                         } /* end if */
                     }     /* end else */
                 }         /* end for */
@@ -2177,6 +2287,8 @@ H5D__virtual_init(H5F_t *f, const H5D_t *dset, hid_t dapl_id)
 {
     H5O_storage_virtual_t *storage;                      /* Convenience pointer */
     H5P_genplist_t *       dapl;                         /* Data access property list object pointer */
+    const H5FD_class_t *   driver;                       /* Source file driver */
+    unsigned long          driver_flags = 0;             /* Source file driver feature flags */
     hssize_t               old_offset[H5O_LAYOUT_NDIMS]; /* Old selection offset (unused) */
     size_t                 i;                            /* Local index variables */
     herr_t                 ret_value = SUCCEED;          /* Return value */
@@ -2236,11 +2348,25 @@ H5D__virtual_init(H5F_t *f, const H5D_t *dset, hid_t dapl_id)
     else
         storage->printf_gap = (hsize_t)0;
 
+    /* Get source dataset I/O options */
+    if (H5P_get(dapl, H5D_ACS_VDS_PREFETCH_NAME, &storage->prefetch) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get virtual source read-ahead threads")
+    if (H5P_get(dapl, H5D_ACS_VDS_MAX_OPEN_NAME, &storage->max_open) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get virtual max. open source datasets")
+
     /* Retrieve VDS file FAPL to layout */
     if (storage->source_fapl <= 0)
         if ((storage->source_fapl = H5F_get_access_plist(f, FALSE)) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get fapl")
 
+    /* Check whether source files are stored under their names as single
+     * POSIX files, so that their existence can be checked with stat() */
+    if (NULL == (driver = H5FD_get_class(storage->source_fapl)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get source file driver")
+    if (H5FD_driver_query(driver, &driver_flags) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't query source file driver features")
+    storage->stat_sources = (driver_flags & H5FD_FEAT_POSIX_COMPAT_HANDLE) ? TRUE : FALSE;
+
     /* Copy DAPL to layout */
     if (storage->source_dapl <= 0)
         if ((storage->source_dapl = H5P_copy_plist(dapl, FALSE)) < 0)
@@ -2333,6 +2459,340 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__virtual_is_data_cached() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_index_key_cmp
+ *
+ * Purpose:     Comparison callback for qsort, used to order mappings by
+ *              the center of their bounding boxes while packing the
+ *              mapping index.  Ties are broken by list position so the
+ *              packing is deterministic.
+ *
+ * Return:      <0, 0 or >0
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__virtual_index_key_cmp(const void *_key1, const void *_key2)
+{
+    const H5D_virtual_index_key_t *key1 = (const H5D_virtual_index_key_t *)_key1;
+    const H5D_virtual_index_key_t *key2      = (const H5D_virtual_index_key_t *)_key2;
+    int                            ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (key1->key != key2->key)
+        ret_value = key1->key < key2->key ? -1 : 1;
+    else if (key1->pos != key2->pos)
+        ret_value = key1->pos < key2->pos ? -1 : 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_index_key_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_index_idx_cmp
+ *
+ * Purpose:     Comparison callback for qsort, used to put the mappings
+ *              selected for an I/O operation back into list order.
+ *
+ * Return:      <0, 0 or >0
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__virtual_index_idx_cmp(const void *_idx1, const void *_idx2)
+{
+    size_t idx1      = *(const size_t *)_idx1;
+    size_t idx2      = *(const size_t *)_idx2;
+    int    ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (idx1 != idx2)
+        ret_value = idx1 < idx2 ? -1 : 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_index_idx_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_index_pack
+ *
+ * Purpose:     Orders the mappings in KEYS for the leaf level of the
+ *              mapping index using the Sort-Tile-Recursive algorithm:
+ *              the mappings are sorted along dimension DIM, cut into
+ *              slabs of whole leaf nodes, and each slab is packed
+ *              recursively along the next dimension.  BOXES holds the
+ *              bounding box of each mapping, indexed by the pos field of
+ *              its key.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__virtual_index_pack(H5D_virtual_index_key_t *keys, size_t nkeys, unsigned dim, unsigned rank,
+                        const hsize_t *boxes)
+{
+    size_t nleaves;   /* Number of leaf nodes needed for these mappings */
+    size_t nslabs;    /* Number of slabs to cut along this dimension */
+    size_t slab_size; /* Number of mappings per slab */
+    size_t u;         /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sort the mappings by the center of their boxes in this dimension */
+    for (u = 0; u < nkeys; u++) {
+        const hsize_t *box = &boxes[keys[u].pos * 2 * rank];
+
+        keys[u].key = box[dim] + ((box[rank + dim] - box[dim]) / 2);
+    } /* end for */
+    HDqsort(keys, nkeys, sizeof(keys[0]), H5D__virtual_index_key_cmp);
+
+    /* Cut into slabs and pack each along the next dimension, unless this is
+     * the last dimension or there is at most one leaf */
+    nleaves = (nkeys + H5D_VIRTUAL_INDEX_FANOUT - 1) / H5D_VIRTUAL_INDEX_FANOUT;
+    if (dim + 1 < rank && nleaves > 1) {
+        /* Use the smallest number of slabs whose (rank - dim)th power
+         * covers the leaves, so the leaves are roughly square */
+        for (nslabs = 2;; nslabs++) {
+            size_t   power = 1;
+            unsigned v;
+
+            for (v = dim; v < rank && power < nleaves; v++)
+                power *= nslabs;
+            if (power >= nleaves)
+                break;
+        } /* end for */
+        slab_size = H5D_VIRTUAL_INDEX_FANOUT * ((nleaves + nslabs - 1) / nslabs);
+
+        for (u = 0; u < nkeys; u += slab_size)
+            H5D__virtual_index_pack(&keys[u], MIN(slab_size, nkeys - u), dim + 1, rank, boxes);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__virtual_index_pack() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_build_index
+ *
+ * Purpose:     Builds the spatial index over the virtual selections of
+ *              the mappings in STORAGE.  If there are too few mappings
+ *              with fixed virtual selections to make the tree worthwhile
+ *              no tree is built and all mappings are put in the
+ *              unindexed list.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_build_index(H5O_storage_virtual_t *storage, unsigned rank)
+{
+    H5D_virtual_index_t *    index      = NULL;    /* New index */
+    H5D_virtual_index_key_t *keys       = NULL;    /* Sort keys used to pack the leaves */
+    hsize_t *                boxes      = NULL;    /* Bounding boxes of the indexable mappings */
+    size_t *                 map        = NULL;    /* List index of each indexable mapping */
+    size_t                   nindexable = 0;       /* Number of mappings that can be indexed */
+    size_t                   box_size;             /* Number of coordinates in a bounding box */
+    size_t                   i, u;                 /* Local index variables */
+    herr_t                   ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(storage);
+    HDassert(!storage->index);
+    HDassert(rank > 0);
+
+    box_size = 2 * (size_t)rank;
+
+    /* Allocate the index and the lists sized by the number of mappings */
+    if (NULL == (index = (H5D_virtual_index_t *)H5MM_calloc(sizeof(H5D_virtual_index_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate virtual mapping index")
+    index->list_nused = storage->list_nused;
+    index->rank       = rank;
+    if (storage->list_nused > 0) {
+        if (NULL == (index->io_list = (size_t *)H5MM_malloc(storage->list_nused * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate virtual mapping I/O list")
+        if (NULL == (index->unindexed = (size_t *)H5MM_malloc(storage->list_nused * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate unindexed mapping list")
+    } /* end if */
+
+    /* Count the mappings whose virtual selections are fixed */
+    for (i = 0; i < storage->list_nused; i++)
+        if (H5D_VIRTUAL_INDEXABLE(&storage->list[i]))
+            nindexable++;
+
+    if (nindexable >= H5D_VIRTUAL_INDEX_MIN_MAPPINGS) {
+        hsize_t *parent_boxes; /* Bounding boxes of the level being built */
+        size_t   nchildren;    /* Number of nodes in the level below */
+
+        /* Allocate temporary arrays */
+        if (NULL == (keys = (H5D_virtual_index_key_t *)H5MM_malloc(nindexable * sizeof(keys[0]))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate index sort keys")
+        if (NULL == (boxes = (hsize_t *)H5MM_malloc(nindexable * box_size * sizeof(hsize_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate mapping bounding boxes")
+        if (NULL == (map = (size_t *)H5MM_malloc(nindexable * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate mapping index map")
+
+        /* Get the bounding boxes of the indexable mappings, and put the rest
+         * in the unindexed list */
+        for (i = 0, u = 0; i < storage->list_nused; i++)
+            if (H5D_VIRTUAL_INDEXABLE(&storage->list[i])) {
+                if (H5S_SELECT_BOUNDS(storage->list[i].source_dset.virtual_select, &boxes[u * box_size],
+                                      &boxes[(u * box_size) + rank]) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get selection bounds")
+                map[u]      = i;
+                keys[u].pos = u;
+                u++;
+            } /* end if */
+            else
+                index->unindexed[index->nunindexed++] = i;
+
+        /* Order the leaves */
+        H5D__virtual_index_pack(keys, nindexable, 0, rank, boxes);
+
+        /* Build the leaf level */
+        if (NULL == (index->order = (size_t *)H5MM_malloc(nindexable * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate mapping index leaves")
+        if (NULL == (index->level_boxes[0] = (hsize_t *)H5MM_malloc(nindexable * box_size * sizeof(hsize_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate mapping index leaves")
+        for (u = 0; u < nindexable; u++) {
+            index->order[u] = map[keys[u].pos];
+            H5MM_memcpy(&index->level_boxes[0][u * box_size], &boxes[keys[u].pos * box_size],
+                        box_size * sizeof(hsize_t));
+        } /* end for */
+        index->level_nboxes[0] = nindexable;
+        index->nlevels         = 1;
+        index->nitems          = nindexable;
+
+        /* Build the upper levels, each node covering the boxes of up to
+         * H5D_VIRTUAL_INDEX_FANOUT nodes in the level below, until a single
+         * root remains */
+        while ((nchildren = index->level_nboxes[index->nlevels - 1]) > 1) {
+            const hsize_t *child_boxes = index->level_boxes[index->nlevels - 1]; /* Level below */
+            size_t         nparents; /* Number of nodes in the new level */
+
+            nparents = (nchildren + H5D_VIRTUAL_INDEX_FANOUT - 1) / H5D_VIRTUAL_INDEX_FANOUT;
+
+            HDassert(index->nlevels < H5D_VIRTUAL_INDEX_MAX_LEVELS);
+
+            if (NULL == (parent_boxes = (hsize_t *)H5MM_malloc(nparents * box_size * sizeof(hsize_t))))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate mapping index nodes")
+            index->level_boxes[index->nlevels]  = parent_boxes;
+            index->level_nboxes[index->nlevels] = nparents;
+            index->nlevels++;
+
+            for (u = 0; u < nparents; u++) {
+                hsize_t *parent    = &parent_boxes[u * box_size];
+                size_t   child_end = MIN((u + 1) * H5D_VIRTUAL_INDEX_FANOUT, nchildren);
+                size_t   child;
+                unsigned d;
+
+                H5MM_memcpy(parent, &child_boxes[u * H5D_VIRTUAL_INDEX_FANOUT * box_size],
+                            box_size * sizeof(hsize_t));
+                for (child = (u * H5D_VIRTUAL_INDEX_FANOUT) + 1; child < child_end; child++)
+                    for (d = 0; d < rank; d++) {
+                        parent[d]        = MIN(parent[d], child_boxes[(child * box_size) + d]);
+                        parent[rank + d] = MAX(parent[rank + d], child_boxes[(child * box_size) + rank + d]);
+                    } /* end for */
+            }         /* end for */
+        }             /* end while */
+    }                 /* end if */
+    else
+        /* Too few mappings to index, all take part in every I/O */
+        for (i = 0; i < storage->list_nused; i++)
+            index->unindexed[index->nunindexed++] = i;
+
+    /* Attach the index to the layout */
+    storage->index = index;
+    index          = NULL;
+
+done:
+    /* Release temporary arrays */
+    keys  = (H5D_virtual_index_key_t *)H5MM_xfree(keys);
+    boxes = (hsize_t *)H5MM_xfree(boxes);
+    map   = (size_t *)H5MM_xfree(map);
+
+    /* Release the index on failure */
+    if (index) {
+        HDassert(ret_value < 0);
+        H5D__virtual_free_index(index);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_build_index() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_index_search
+ *
+ * Purpose:     Appends the mappings below NODE at LEVEL of the mapping
+ *              index whose bounding boxes intersect the box between
+ *              START and END (inclusive) to the index's I/O list.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__virtual_index_search(H5D_virtual_index_t *index, unsigned level, size_t node, const hsize_t *start,
+                          const hsize_t *end)
+{
+    const hsize_t *box = &index->level_boxes[level][node * 2 * index->rank]; /* Bounding box of node */
+    unsigned       d;                                                         /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check for intersection with the query box */
+    for (d = 0; d < index->rank; d++)
+        if (box[d] > end[d] || box[index->rank + d] < start[d])
+            break;
+
+    if (d == index->rank) {
+        if (level == 0)
+            /* Leaf, add the mapping */
+            index->io_list[index->io_nused++] = index->order[node];
+        else {
+            size_t child_end =
+                MIN((node + 1) * H5D_VIRTUAL_INDEX_FANOUT, index->level_nboxes[level - 1]);
+            size_t child;
+
+            /* Descend into the children */
+            for (child = node * H5D_VIRTUAL_INDEX_FANOUT; child < child_end; child++)
+                H5D__virtual_index_search(index, level - 1, child, start, end);
+        } /* end else */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__virtual_index_search() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_free_index
+ *
+ * Purpose:     Frees a virtual mapping index.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__virtual_free_index(H5D_virtual_index_t *index)
+{
+    unsigned u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (index) {
+        for (u = 0; u < index->nlevels; u++)
+            H5MM_xfree(index->level_boxes[u]);
+        H5MM_xfree(index->order);
+        H5MM_xfree(index->unindexed);
+        H5MM_xfree(index->io_list);
+        H5MM_xfree(index);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__virtual_free_index() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__virtual_pre_io
  *
@@ -2352,13 +2812,14 @@ static herr_t
 H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, const H5S_t *file_space,
                     const H5S_t *mem_space, hsize_t *tot_nelmts)
 {
-    hssize_t select_nelmts;              /* Number of elements in selection */
-    hsize_t  bounds_start[H5S_MAX_RANK]; /* Selection bounds start */
-    hsize_t  bounds_end[H5S_MAX_RANK];   /* Selection bounds end */
-    int      rank;
-    hbool_t  bounds_init = FALSE; /* Whether bounds_start, bounds_end, and rank are valid */
-    size_t   i, j, k;             /* Local index variables */
-    herr_t   ret_value = SUCCEED; /* Return value */
+    H5D_virtual_index_t *index;                      /* Spatial index over the mappings */
+    hssize_t             select_nelmts;              /* Number of elements in selection */
+    hsize_t              bounds_start[H5S_MAX_RANK]; /* Selection bounds start */
+    hsize_t              bounds_end[H5S_MAX_RANK];   /* Selection bounds end */
+    int                  rank;
+    hbool_t              bounds_init = FALSE; /* Whether bounds_start, bounds_end, and rank are valid */
+    size_t               i, j, k, u;          /* Local index variables */
+    herr_t               ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -2373,11 +2834,60 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
         if (H5D__virtual_init_all(io_info->dset) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize virtual layout")
 
+    /* Build the mapping index if necessary */
+    if (!storage->index || storage->index->list_nused != storage->list_nused) {
+        H5D__virtual_free_index(storage->index);
+        storage->index = NULL;
+        if ((rank = H5S_GET_EXTENT_NDIMS(io_info->dset->shared->space)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get number of dimensions")
+        if (H5D__virtual_build_index(storage, (unsigned)rank) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't build virtual mapping index")
+    } /* end if */
+    index = storage->index;
+
+    /* Select the mappings taking part in this I/O: the indexed mappings whose
+     * bounding boxes intersect the bounds of file_space, plus all mappings
+     * that are not in the index */
+    index->io_nused = 0;
+    if (index->nitems > 0) {
+        if ((select_nelmts = (hssize_t)H5S_GET_SELECT_NPOINTS(file_space)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCOUNT, FAIL, "unable to get number of elements in selection")
+        if (select_nelmts > (hssize_t)0) {
+            /* Get selection bounds */
+            if (H5S_SELECT_BOUNDS(file_space, bounds_start, bounds_end) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get selection bounds")
+
+            /* Search the index */
+            HDassert(index->level_nboxes[index->nlevels - 1] == 1);
+            H5D__virtual_index_search(index, index->nlevels - 1, 0, bounds_start, bounds_end);
+
+            /* Adjust bounds_end to represent the extent just enclosing them
+             * (add 1), for use by "printf" mappings below */
+            rank = (int)index->rank;
+            for (j = 0; j < (size_t)rank; j++)
+                bounds_end[j]++;
+
+            /* Bounds are now initialized */
+            bounds_init = TRUE;
+        } /* end if */
+    }     /* end if */
+    if (index->nunindexed > 0) {
+        H5MM_memcpy(&index->io_list[index->io_nused], index->unindexed, index->nunindexed * sizeof(size_t));
+        index->io_nused += index->nunindexed;
+    } /* end if */
+
+    /* Put the mappings back in list order, so overlapping mappings are
+     * handled as before */
+    if (index->nitems > 0 && index->io_nused > 1)
+        HDqsort(index->io_list, index->io_nused, sizeof(size_t), H5D__virtual_index_idx_cmp);
+
     /* Initialize tot_nelmts */
     *tot_nelmts = 0;
 
-    /* Iterate over mappings */
-    for (i = 0; i < storage->list_nused; i++) {
+    /* Iterate over mappings taking part in the I/O */
+    for (u = 0; u < index->io_nused; u++) {
+        i = index->io_list[u];
+
         /* Sanity check that the virtual space has been patched by now */
         HDassert(storage->list[i].virtual_space_status == H5O_VIRTUAL_STATUS_CORRECT);
 
@@ -2523,9 +3033,12 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
                                             "unable to open source dataset")
 
                         /* If the source dataset is not open, mark the selected
-                         * elements as zero so projected_mem_space is freed */
+                         * elements as zero so projected_mem_space is freed,
+                         * otherwise mark it as most recently used */
                         if (!storage->list[i].sub_dset[j].dset)
                             select_nelmts = (hssize_t)0;
+                        else
+                            storage->list[i].sub_dset[j].last_used = ++storage->use_clock;
                     } /* end if */
 
                     /* If there are not elements selected in this mapping, free
@@ -2567,9 +3080,12 @@ H5D__virtual_pre_io(H5D_io_info_t *io_info, H5O_storage_virtual_t *storage, cons
                             HGOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "unable to open source dataset")
 
                     /* If the source dataset is not open, mark the selected elements
-                     * as zero so projected_mem_space is freed */
+                     * as zero so projected_mem_space is freed, otherwise mark it
+                     * as most recently used */
                     if (!storage->list[i].source_dset.dset)
                         select_nelmts = (hssize_t)0;
+                    else
+                        storage->list[i].source_dset.last_used = ++storage->use_clock;
                 } /* end if */
 
                 /* If there are not elements selected in this mapping, free
@@ -2613,7 +3129,8 @@ done:
 static herr_t
 H5D__virtual_post_io(H5O_storage_virtual_t *storage)
 {
-    size_t i, j;                /* Local index variables */
+    size_t n;                   /* Number of mappings to clean up */
+    size_t i, j, u;             /* Local index variables */
     herr_t ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -2621,8 +3138,12 @@ H5D__virtual_post_io(H5O_storage_virtual_t *storage)
     /* Sanity check */
     HDassert(storage);
 
-    /* Iterate over mappings */
-    for (i = 0; i < storage->list_nused; i++)
+    /* Iterate over mappings taking part in the I/O, or all mappings if
+     * H5D__virtual_pre_io() failed before the index was built */
+    n = storage->index ? storage->index->io_nused : storage->list_nused;
+    for (u = 0; u < n; u++) {
+        i = storage->index ? storage->index->io_list[u] : u;
+
         /* Check for "printf" source dataset resolution */
         if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
             /* Iterate over sub-source dsets */
@@ -2641,12 +3162,325 @@ H5D__virtual_post_io(H5O_storage_virtual_t *storage)
                 HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close temporary space")
             storage->list[i].source_dset.projected_mem_space = NULL;
         } /* end if */
+    }     /* end for */
+
+    /* Close the least recently used source datasets if too many are open */
+    if (storage->max_open > 0 && storage->nopen > storage->max_open)
+        if (H5D__virtual_close_lru_sources(storage) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close least recently used source datasets")
 
     /* Note the lack of a done: label.  This is because there are no HGOTO_ERROR
      * calls.  If one is added, a done: label must also be added */
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__virtual_post_io() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_last_used_cmp
+ *
+ * Purpose:     Compare two source datasets by the time they were last
+ *              used, for HDqsort().
+ *
+ * Return:      <0, 0 or >0 if the first source dataset was used before,
+ *              at the same time as or after the second one
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__virtual_last_used_cmp(const void *_srcdset1, const void *_srcdset2)
+{
+    const H5O_storage_virtual_srcdset_t *srcdset1 = *(H5O_storage_virtual_srcdset_t *const *)_srcdset1;
+    const H5O_storage_virtual_srcdset_t *srcdset2 = *(H5O_storage_virtual_srcdset_t *const *)_srcdset2;
+    int                                  ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (srcdset1->last_used < srcdset2->last_used)
+        ret_value = -1;
+    else if (srcdset1->last_used > srcdset2->last_used)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_last_used_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_close_lru_sources
+ *
+ * Purpose:     Close the least recently used source datasets until no
+ *              more than storage->max_open remain open.  Closed source
+ *              datasets are reopened on demand by the next I/O that
+ *              touches them.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_close_lru_sources(H5O_storage_virtual_t *storage)
+{
+    H5O_storage_virtual_srcdset_t **open_dsets = NULL;    /* Open source datasets */
+    size_t                          nopen      = 0;       /* Number of entries in open_dsets */
+    size_t                          i, j;                 /* Local index variables */
+    herr_t                          ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(storage);
+    HDassert(storage->max_open > 0);
+    HDassert(storage->nopen > storage->max_open);
+
+    /* Collect all open source datasets */
+    if (NULL == (open_dsets = (H5O_storage_virtual_srcdset_t **)H5MM_malloc(
+                     storage->nopen * sizeof(H5O_storage_virtual_srcdset_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate open source dataset list")
+    for (i = 0; i < storage->list_nused; i++)
+        if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
+            for (j = 0; j < storage->list[i].sub_dset_nused; j++)
+                if (storage->list[i].sub_dset[j].dset) {
+                    HDassert(nopen < storage->nopen);
+                    open_dsets[nopen++] = &storage->list[i].sub_dset[j];
+                } /* end if */
+        }         /* end if */
+        else if (storage->list[i].source_dset.dset) {
+            HDassert(nopen < storage->nopen);
+            open_dsets[nopen++] = &storage->list[i].source_dset;
+        } /* end if */
+    HDassert(nopen == storage->nopen);
+
+    /* Close the oldest ones */
+    HDqsort(open_dsets, nopen, sizeof(open_dsets[0]), H5D__virtual_last_used_cmp);
+    for (i = 0; i < nopen - storage->max_open; i++) {
+        if (H5D_close(open_dsets[i]->dset) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to close source dataset")
+        open_dsets[i]->dset = NULL;
+        storage->nopen--;
+    } /* end for */
+
+done:
+    H5MM_xfree(open_dsets);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_close_lru_sources() */
+
+#ifdef H5_HAVE_POSIX_FADVISE
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_prefetch_chunks
+ *
+ * Purpose:     Ask the OS to start reading the allocated chunks of a
+ *              chunked source dataset that intersect the selection in
+ *              it.  Chunks that are in the chunk cache are skipped.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_prefetch_chunks(const H5D_t *dset, const H5S_t *src_space, int fd)
+{
+    const H5O_layout_chunk_t *layout = &dset->shared->layout.u.chunk; /* Chunk layout */
+    hsize_t                   dims[H5S_MAX_RANK];                     /* Source dataset dimensions */
+    hsize_t                   sel_start[H5S_MAX_RANK];                /* Start of the selection bounds */
+    hsize_t                   sel_end[H5S_MAX_RANK];                  /* End of the selection bounds */
+    hsize_t                   scaled_start[H5S_MAX_RANK];             /* First chunk in the bounds */
+    hsize_t                   scaled_end[H5S_MAX_RANK];               /* Last chunk in the bounds */
+    hsize_t                   scaled[H5S_MAX_RANK + 1];               /* Current chunk */
+    hsize_t                   chunk_start[H5S_MAX_RANK];              /* First element of current chunk */
+    hsize_t                   chunk_end[H5S_MAX_RANK];                /* Last element of current chunk */
+    H5D_chunk_ud_t            udata;                                  /* Chunk index lookup info */
+    htri_t                    intersect;                              /* Whether the chunk is selected */
+    unsigned                  rank;                                   /* Source dataset rank */
+    unsigned                  u;                                      /* Local index variable */
+    int                       i;                                      /* Local index variable */
+    herr_t                    ret_value = SUCCEED;                    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Nothing to do if no chunk has been written yet */
+    if (!(dset->shared->layout.ops->is_space_alloc)(&dset->shared->layout.storage))
+        HGOTO_DONE(SUCCEED)
+
+    /* Get the range of chunks the selection's bounds touch */
+    rank = layout->ndims - 1;
+    if (H5S_get_simple_extent_dims(dset->shared->space, dims, NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get source dataset dimensions")
+    if (H5S_SELECT_BOUNDS(src_space, sel_start, sel_end) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get selection bounds")
+    for (u = 0; u < rank; u++) {
+        scaled_start[u] = sel_start[u] / layout->dim[u];
+        scaled_end[u]   = sel_end[u] / layout->dim[u];
+        scaled[u]       = scaled_start[u];
+    } /* end for */
+    scaled[rank] = 0;
+
+    /* Visit the chunks in the bounds, in row-major order */
+    while (1) {
+        for (u = 0; u < rank; u++) {
+            chunk_start[u] = scaled[u] * layout->dim[u];
+            chunk_end[u]   = MIN(chunk_start[u] + layout->dim[u], dims[u]) - 1;
+        } /* end for */
+
+        /* Issue a hint for the chunk if it's selected and on disk */
+        if ((intersect = H5S_SELECT_INTERSECT_BLOCK(src_space, chunk_start, chunk_end)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't check chunk for intersection")
+        if (intersect) {
+            if (H5D__chunk_lookup(dset, scaled, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+            if (UINT_MAX == udata.idx_hint && H5F_addr_defined(udata.chunk_block.offset))
+                (void)HDposix_fadvise(fd,
+                                      (HDoff_t)(H5F_BASE_ADDR(dset->oloc.file) + udata.chunk_block.offset),
+                                      (HDoff_t)udata.chunk_block.length, POSIX_FADV_WILLNEED);
+        } /* end if */
+
+        /* Move to the next chunk */
+        for (i = (int)rank - 1; i >= 0; i--) {
+            if (scaled[i] < scaled_end[i]) {
+                scaled[i]++;
+                break;
+            } /* end if */
+            scaled[i] = scaled_start[i];
+        } /* end for */
+        if (i < 0)
+            break;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_prefetch_chunks() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_prefetch_one
+ *
+ * Purpose:     Ask the OS to start reading the parts of a single source
+ *              dataset that the current read will access.  Contiguous and
+ *              chunked source datasets in files with a POSIX file
+ *              descriptor are handled, others are skipped.  Hints are
+ *              advisory, so failures to issue them are ignored.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_prefetch_one(H5O_storage_virtual_srcdset_t *source_dset, const H5S_t *file_space)
+{
+    H5S_t * projected_src_space = NULL;  /* File space for selection in the source dataset */
+    H5D_t * dset;                        /* Source dataset */
+    hsize_t dims[H5S_MAX_RANK];          /* Source dataset dimensions */
+    hsize_t start[H5S_MAX_RANK];         /* Start of the selection bounds */
+    hsize_t end[H5S_MAX_RANK];           /* End of the selection bounds */
+    hsize_t first, last;                 /* First and last element of the range */
+    size_t  elmt_size;                   /* Size of a source dataset element */
+    int     rank;                        /* Source dataset rank */
+    int     fd;                          /* POSIX file descriptor of the source file */
+    void *  handle;                      /* VFD handle of the source file */
+    herr_t  ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Skip mappings that take no part in this read and source datasets
+     * whose storage isn't in a POSIX file */
+    if (!source_dset->projected_mem_space)
+        HGOTO_DONE(SUCCEED)
+    dset = source_dset->dset;
+    HDassert(dset);
+    if (!H5F_HAS_FEATURE(dset->oloc.file, H5FD_FEAT_POSIX_COMPAT_HANDLE))
+        HGOTO_DONE(SUCCEED)
+    if (dset->shared->layout.type == H5D_CONTIGUOUS) {
+        if (!H5F_addr_defined(dset->shared->layout.storage.u.contig.addr))
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+    else if (dset->shared->layout.type != H5D_CHUNKED)
+        HGOTO_DONE(SUCCEED)
+
+    /* Find the selection in the source dataset */
+    if (H5S_select_project_intersection(source_dset->clipped_virtual_select, source_dset->clipped_source_select,
+                                        file_space, &projected_src_space, TRUE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCLIP, FAIL, "can't project virtual intersection onto source space")
+    if (H5S_GET_SELECT_NPOINTS(projected_src_space) == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Get the file descriptor.  Some drivers that advertise a POSIX
+     * compatible handle only have one while the file is open on disk, so a
+     * failure here just means no hint. */
+    if (H5F_get_vfd_handle(dset->oloc.file, H5P_FILE_ACCESS_DEFAULT, &handle) < 0 || !handle) {
+        H5E_clear_stack(NULL);
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    fd = *(int *)handle;
+
+    if (dset->shared->layout.type == H5D_CHUNKED) {
+        if (H5D__virtual_prefetch_chunks(dset, projected_src_space, fd) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to issue read-ahead for source chunks")
+    } /* end if */
+    else {
+        /* Issue one hint for the range between the selection's bounds */
+        if (H5S_SELECT_BOUNDS(projected_src_space, start, end) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get selection bounds")
+        if ((rank = H5S_get_simple_extent_dims(dset->shared->space, dims, NULL)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get source dataset dimensions")
+        elmt_size = H5T_GET_SIZE(dset->shared->type);
+        first     = rank > 0 ? H5VM_array_offset((unsigned)rank, dims, start) : 0;
+        last      = rank > 0 ? H5VM_array_offset((unsigned)rank, dims, end) : 0;
+        (void)HDposix_fadvise(fd,
+                              (HDoff_t)(H5F_BASE_ADDR(dset->oloc.file) +
+                                        dset->shared->layout.storage.u.contig.addr + first * elmt_size),
+                              (HDoff_t)((last - first + 1) * elmt_size), POSIX_FADV_WILLNEED);
+    } /* end else */
+
+done:
+    if (projected_src_space && H5S_close(projected_src_space) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close projected source space")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_prefetch_one() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_prefetch
+ *
+ * Purpose:     Ask the OS to start reading the parts of all source
+ *              datasets that the current read will access.  The hints
+ *              are issued on the calling thread before any source dataset
+ *              is read.  The source datasets are then still read one
+ *              after the other, but mostly from the page cache, so the
+ *              latencies of the source files overlap instead of adding
+ *              up.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_prefetch(H5O_storage_virtual_t *storage, const H5S_t *file_space)
+{
+    size_t i, j, u;             /* Local index variables */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(storage);
+    HDassert(storage->index);
+    HDassert(storage->prefetch);
+
+    /* Issue hints for all source datasets taking part in the read */
+    for (u = 0; u < storage->index->io_nused; u++) {
+        i = storage->index->io_list[u];
+
+        if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
+            for (j = storage->list[i].sub_dset_io_start; j < storage->list[i].sub_dset_io_end; j++)
+                if (H5D__virtual_prefetch_one(&storage->list[i].sub_dset[j], file_space) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to issue read-ahead hint")
+        } /* end if */
+        else if (H5D__virtual_prefetch_one(&storage->list[i].source_dset, file_space) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to issue read-ahead hint")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_prefetch() */
+#endif /* H5_HAVE_POSIX_FADVISE */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__virtual_read_one
  *
@@ -2726,7 +3560,7 @@ H5D__virtual_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsiz
     H5O_storage_virtual_t *storage;             /* Convenient pointer into layout struct */
     hsize_t                tot_nelmts;          /* Total number of elements mapped to mem_space */
     H5S_t *                fill_space = NULL;   /* Space to fill with fill value */
-    size_t                 i, j;                /* Local index variables */
+    size_t                 i, j, u;             /* Local index variables */
     herr_t                 ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -2751,8 +3585,17 @@ H5D__virtual_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsiz
     if (H5D__virtual_pre_io(io_info, storage, file_space, mem_space, &tot_nelmts) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTCLIP, FAIL, "unable to prepare for I/O operation")
 
-    /* Iterate over mappings */
-    for (i = 0; i < storage->list_nused; i++) {
+#ifdef H5_HAVE_POSIX_FADVISE
+    /* Let the OS start reading from all source datasets at once */
+    if (storage->prefetch)
+        if (H5D__virtual_prefetch(storage, file_space) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to issue read-ahead for source datasets")
+#endif /* H5_HAVE_POSIX_FADVISE */
+
+    /* Iterate over mappings taking part in the I/O */
+    for (u = 0; u < storage->index->io_nused; u++) {
+        i = storage->index->io_list[u];
+
         /* Sanity check that the virtual space has been patched by now */
         HDassert(storage->list[i].virtual_space_status == H5O_VIRTUAL_STATUS_CORRECT);
 
@@ -2783,8 +3626,10 @@ H5D__virtual_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsiz
             if (NULL == (fill_space = H5S_copy(mem_space, FALSE, TRUE)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "unable to copy memory selection")
 
-            /* Iterate over mappings */
-            for (i = 0; i < storage->list_nused; i++)
+            /* Iterate over mappings taking part in the I/O */
+            for (u = 0; u < storage->index->io_nused; u++) {
+                i = storage->index->io_list[u];
+
                 /* Check for "printf" source dataset resolution */
                 if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
                     /* Iterate over sub-source dsets */
@@ -2798,6 +3643,7 @@ H5D__virtual_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsiz
                     /* Subtract projected memory space from fill space */
                     if (H5S_select_subtract(fill_space, storage->list[i].source_dset.projected_mem_space) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTCLIP, FAIL, "unable to clip fill selection")
+            } /* end for */
 
             /* Write fill values to memory buffer */
             if (H5D__fill(io_info->dset->shared->dcpl_cache.fill.buf, io_info->dset->shared->type,
@@ -2917,7 +3763,7 @@ H5D__virtual_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsi
 {
     H5O_storage_virtual_t *storage;             /* Convenient pointer into layout struct */
     hsize_t                tot_nelmts;          /* Total number of elements mapped to mem_space */
-    size_t                 i, j;                /* Local index variables */
+    size_t                 i, j, u;             /* Local index variables */
     herr_t                 ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -2948,8 +3794,10 @@ H5D__virtual_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsi
         HGOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
                     "write requested to unmapped portion of virtual dataset")
 
-    /* Iterate over mappings */
-    for (i = 0; i < storage->list_nused; i++) {
+    /* Iterate over mappings taking part in the I/O */
+    for (u = 0; u < storage->index->io_nused; u++) {
+        i = storage->index->io_list[u];
+
         /* Sanity check that virtual space has been patched by now */
         HDassert(storage->list[i].virtual_space_status == H5O_VIRTUAL_STATUS_CORRECT);
 
@@ -3097,7 +3945,16 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5D__virtual_refresh_source_dset
  *
- * Purpose:     Refresh a source dataset
+ * Purpose:     Refresh a source dataset.
+ *
+ *              A refresh only has to pick up changes made to the source
+ *              file by other processes, which also change the file's
+ *              modification time or size.  For source files that are
+ *              single POSIX files, these are remembered at each refresh,
+ *              and the refresh is skipped when they have not changed
+ *              since.  The modification time only has a resolution of a
+ *              second, so it is not trusted when it is the same second
+ *              the file was last checked in.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -3107,17 +3964,34 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__virtual_refresh_source_dset(H5D_t **dset)
+H5D__virtual_refresh_source_dset(H5O_storage_virtual_srcdset_t *source_dset)
 {
-    hid_t          temp_id   = H5I_INVALID_HID; /* Temporary dataset identifier */
-    H5VL_object_t *vol_obj   = NULL;            /* VOL object stored with the ID */
-    herr_t         ret_value = SUCCEED;         /* Return value */
+    H5D_t **       dset      = &source_dset->dset; /* Source dataset */
+    hid_t          temp_id   = H5I_INVALID_HID;    /* Temporary dataset identifier */
+    H5VL_object_t *vol_obj   = NULL;               /* VOL object stored with the ID */
+    h5_stat_t      st;                             /* Source file information */
+    time_t         now;                            /* Time the source file was checked */
+    hbool_t        have_stat = FALSE;              /* Whether st is valid */
+    herr_t         ret_value = SUCCEED;            /* Return value */
 
     FUNC_ENTER_STATIC
 
     /* Sanity check */
     HDassert(dset && *dset);
 
+    /* Skip the refresh if the source file has not changed since the last one */
+    if (H5F_HAS_FEATURE((*dset)->oloc.file, H5FD_FEAT_POSIX_COMPAT_HANDLE)) {
+        now = HDtime(NULL);
+        if (0 == HDstat(H5F_ACTUAL_NAME((*dset)->oloc.file), &st)) {
+            have_stat = TRUE;
+            if (source_dset->stat_valid && st.st_mtime == source_dset->stat_mtime &&
+                (hsize_t)st.st_size == source_dset->stat_size &&
+                source_dset->stat_mtime < source_dset->stat_time)
+                HGOTO_DONE(SUCCEED)
+        } /* end if */
+    }     /* end if */
+    source_dset->stat_valid = FALSE;
+
     /* Get a temporary identifier for this source dataset */
     if ((temp_id = H5VL_wrap_register(H5I_DATASET, *dset, FALSE)) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTREGISTER, FAIL, "can't register (temporary) source dataset ID")
@@ -3133,6 +4007,14 @@ H5D__virtual_refresh_source_dset(H5D_t **dset)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve library object from VOL object")
     vol_obj->data = NULL;
 
+    /* Remember the state of the source file before the refresh */
+    if (have_stat) {
+        source_dset->stat_valid = TRUE;
+        source_dset->stat_time  = now;
+        source_dset->stat_mtime = st.st_mtime;
+        source_dset->stat_size  = (hsize_t)st.st_size;
+    } /* end if */
+
 done:
     if (vol_obj && H5VL_free_object(vol_obj) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "unable to free VOL object")
@@ -3178,14 +4060,14 @@ H5D__virtual_refresh_source_dsets(H5D_t *dset)
                 /* Check if sub-source dataset is open */
                 if (storage->list[i].sub_dset[j].dset)
                     /* Refresh sub-source dataset */
-                    if (H5D__virtual_refresh_source_dset(&storage->list[i].sub_dset[j].dset) < 0)
+                    if (H5D__virtual_refresh_source_dset(&storage->list[i].sub_dset[j]) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to refresh source dataset")
         } /* end if */
         else
             /* Check if source dataset is open */
             if (storage->list[i].source_dset.dset)
             /* Refresh source dataset */
-            if (H5D__virtual_refresh_source_dset(&storage->list[i].source_dset.dset) < 0)
+            if (H5D__virtual_refresh_source_dset(&storage->list[i].source_dset) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to refresh source dataset")
 
 done:
@@ -0,0 +1,910 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	Packed storage for chunks of variable-length data.
+ *
+ *		When the H5Z_FILTER_VLPACK filter is in a dataset's pipeline,
+ *		each chunk holds the element data itself instead of global
+ *		heap IDs.  A packed chunk of N elements is laid out as (all
+ *		integers are little-endian):
+ *
+ *			uint32	N
+ *			uint32	end[N]		End offset of each element's data
+ *			uint8	nil[(N + 7) / 8]	Bitmap of nil elements
+ *			uint8	data[end[N - 1]]	Element data, concatenated
+ *
+ *		The packed chunk then goes through the rest of the filter
+ *		pipeline like any other chunk.  Reads and writes of packed
+ *		datasets bypass the chunk cache and never touch the global
+ *		heap.
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Dmodule.h" /* This source code file is part of the H5D module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5CXprivate.h" /* API Contexts                         */
+#include "H5Dpkg.h"      /* Datasets				*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5FLprivate.h" /* Free Lists                           */
+#include "H5Iprivate.h"  /* IDs			  		*/
+#include "H5MMprivate.h" /* Memory management			*/
+#include "H5Sprivate.h"  /* Dataspaces				*/
+#include "H5Zprivate.h"  /* Data filters				*/
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Size of the header of a packed chunk with N elements */
+#define H5D_VLPACK_HDR_SIZE(N) ((size_t)4 + ((size_t)4 * (N)) + (((N) + 7) / 8))
+
+/* Number of selection sequences to retrieve at a time */
+#define H5D_VLPACK_NSEQ 64
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* Settings for an operation on a packed dataset */
+typedef struct H5D_vlpack_info_t {
+    H5T_t *   mtype;        /* Memory form of the dataset's datatype */
+    hid_t     mtype_id;     /* ID for the memory form of the datatype */
+    hbool_t   is_str;       /* Whether the datatype is a variable-length string */
+    size_t    base_size;    /* Size of a sequence element in the file */
+    size_t    chunk_nelmts; /* Number of elements in a chunk */
+    H5Z_EDC_t err_detect;   /* Error detection info for the filter pipeline */
+    H5Z_cb_t  filter_cb;    /* Filter failure callback */
+} H5D_vlpack_info_t;
+
+/* Unpacked view of a chunk */
+typedef struct H5D_vlpack_chunk_t {
+    void *    buf; /* Unfiltered chunk, NULL for a chunk that doesn't exist */
+    uint8_t **ptr; /* Data for each element */
+    size_t *  len; /* Size of each element's data, in bytes */
+    hbool_t * nil; /* Whether each element is nil */
+} H5D_vlpack_chunk_t;
+
+/********************/
+/* Local Prototypes */
+/********************/
+static herr_t H5D__vlpack_init(const H5D_t *dset, hbool_t need_mtype, H5D_vlpack_info_t *info,
+                               H5D_vlpack_chunk_t *chunk);
+static herr_t H5D__vlpack_term(H5D_vlpack_info_t *info, H5D_vlpack_chunk_t *chunk);
+static herr_t H5D__vlpack_load(const H5D_t *dset, const H5D_vlpack_info_t *info, const hsize_t *scaled,
+                               H5D_vlpack_chunk_t *chunk);
+static herr_t H5D__vlpack_store(const H5D_t *dset, const H5D_vlpack_info_t *info, const hsize_t *scaled,
+                                const H5D_vlpack_chunk_t *chunk);
+static herr_t H5D__vlpack_sel_index(const H5S_t *space, size_t nelmts, size_t *idx);
+static void * H5D__vlpack_alloc(const H5T_vlen_alloc_info_t *vl_alloc_info, size_t size);
+static void   H5D__vlpack_free_elmts(const H5D_vlpack_info_t *info, void *elmts, size_t nelmts,
+                                     const H5T_vlen_alloc_info_t *vl_alloc_info);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare extern free list to manage the H5S_sel_iter_t struct */
+H5FL_EXTERN(H5S_sel_iter_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__vlpack_init
+ *
+ * Purpose:     Set up the information needed for an operation on a
+ *              packed dataset, and allocate the unpacked chunk view.
+ *
+ *              When NEED_MTYPE is set, also create the memory form of
+ *              the dataset's datatype, which packed elements are
+ *              converted through on their way to or from the
+ *              application's buffer.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__vlpack_init(const H5D_t *dset, hbool_t need_mtype, H5D_vlpack_info_t *info, H5D_vlpack_chunk_t *chunk)
+{
+    const H5T_t *type  = dset->shared->type; /* Dataset's datatype */
+    H5T_t *      super = NULL;               /* Base type of the dataset's datatype */
+    htri_t       is_str;                     /* Whether the datatype is a string */
+    herr_t       ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDmemset(info, 0, sizeof(*info));
+    info->mtype_id = H5I_INVALID_HID;
+    HDmemset(chunk, 0, sizeof(*chunk));
+
+    /* Retrieve the shape of the datatype */
+    if ((is_str = H5T_is_variable_str(type)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check for variable-length string")
+    info->is_str = (hbool_t)is_str;
+    if (NULL == (super = H5T_get_super(type)))
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get base datatype")
+    if (0 == (info->base_size = H5T_get_size(super)))
+        HGOTO_ERROR(H5E_DATATYPE, H5E_BADSIZE, FAIL, "invalid base datatype size")
+    info->chunk_nelmts = dset->shared->layout.u.chunk.size / H5T_get_size(type);
+
+    /* Retrieve the filter pipeline settings from the API context */
+    if (H5CX_get_err_detect(&info->err_detect) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve error detection info")
+    if (H5CX_get_filter_cb(&info->filter_cb) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve filter callback")
+
+    /* Allocate the unpacked chunk view */
+    if (NULL == (chunk->ptr = (uint8_t **)H5MM_malloc(info->chunk_nelmts * sizeof(uint8_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for element pointers")
+    if (NULL == (chunk->len = (size_t *)H5MM_malloc(info->chunk_nelmts * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for element sizes")
+    if (NULL == (chunk->nil = (hbool_t *)H5MM_malloc(info->chunk_nelmts * sizeof(hbool_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for nil flags")
+
+    /* Create the memory form of the datatype */
+    if (need_mtype) {
+        if (NULL == (info->mtype = H5T_copy(type, H5T_COPY_TRANSIENT)))
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, FAIL, "unable to copy datatype")
+        if (H5T_set_loc(info->mtype, NULL, H5T_LOC_MEMORY) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't set datatype location")
+        if ((info->mtype_id = H5I_register(H5I_DATATYPE, info->mtype, FALSE)) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTREGISTER, FAIL, "unable to register datatype")
+    } /* end if */
+
+done:
+    if (super && H5T_close_real(super) < 0)
+        HDONE_ERROR(H5E_DATATYPE, H5E_CANTCLOSEOBJ, FAIL, "can't close base datatype")
+    if (ret_value < 0 && H5D__vlpack_term(info, chunk) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release packed chunk info")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__vlpack_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__vlpack_term
+ *
+ * Purpose:     Release the resources set up by H5D__vlpack_init.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__vlpack_term(H5D_vlpack_info_t *info, H5D_vlpack_chunk_t *chunk)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (info->mtype_id >= 0) {
+        if (H5I_dec_ref(info->mtype_id) < 0)
+            HDONE_ERROR(H5E_DATATYPE, H5E_CANTDEC, FAIL, "can't decrement datatype ID")
+    } /* end if */
+    else if (info->mtype && H5T_close_real(info->mtype) < 0)
+        HDONE_ERROR(H5E_DATATYPE, H5E_CANTCLOSEOBJ, FAIL, "can't close datatype")
+    info->mtype    = NULL;
+    info->mtype_id = H5I_INVALID_HID;
+
+    chunk->buf = H5MM_xfree(chunk->buf);
+    chunk->ptr = (uint8_t **)H5MM_xfree(chunk->ptr);
+    chunk->len = (size_t *)H5MM_xfree(chunk->len);
+    chunk->nil = (hbool_t *)H5MM_xfree(chunk->nil);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__vlpack_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__vlpack_load
+ *
+ * Purpose:     Read the chunk at SCALED from the file, run it back
+ *              through the filter pipeline and set up CHUNK to point at
+ *              the data for each of its elements.  A chunk that doesn't
+ *              exist in the file is loaded as all nil elements.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__vlpack_load(const H5D_t *dset, const H5D_vlpack_info_t *info, const hsize_t *scaled,
+                 H5D_vlpack_chunk_t *chunk)
+{
+    H5D_chunk_ud_t udata;                        /* Chunk index query info */
+    size_t         nelmts   = info->chunk_nelmts; /* Number of elements in the chunk */
+    size_t         hdr_size = H5D_VLPACK_HDR_SIZE(nelmts); /* Size of the chunk's header */
+    size_t         nbytes;                                 /* Size of the unfiltered chunk */
+    size_t         buf_size;                               /* Size of the chunk buffer */
+    unsigned       filter_mask;                            /* Filters skipped for the chunk */
+    const uint8_t *p;                                      /* Pointer into the header */
+    uint8_t *      bitmap;                                 /* Nil element bitmap */
+    uint8_t *      data;                                   /* Element data */
+    size_t         start;                                  /* Start of an element's data */
+    size_t         u;                                      /* Local index variable */
+    herr_t         ret_value = SUCCEED;                    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    chunk->buf = H5MM_xfree(chunk->buf);
+
+    /* Find the chunk in the file */
+    if (H5D__chunk_lookup(dset, scaled, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+    /* A missing chunk holds nothing but nil elements */
+    if (!H5F_addr_defined(udata.chunk_block.offset)) {
+        for (u = 0; u < nelmts; u++) {
+            chunk->ptr[u] = NULL;
+            chunk->len[u] = 0;
+            chunk->nil[u] = TRUE;
+        } /* end for */
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Read the chunk and undo the filter pipeline */
+    H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
+    buf_size = nbytes;
+    if (NULL == (chunk->buf = H5MM_malloc(buf_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+    if (H5F_shared_block_read(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, udata.chunk_block.offset, nbytes,
+                              chunk->buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+    filter_mask = udata.filter_mask;
+    if (H5Z_pipeline(&(dset->shared->dcpl_cache.pline), H5Z_FLAG_REVERSE, &filter_mask, info->err_detect,
+                     info->filter_cb, &nbytes, &buf_size, &chunk->buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "data pipeline read failed")
+
+    /* Decode the header */
+    if (nbytes < hdr_size)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "packed chunk is too small")
+    p = (const uint8_t *)chunk->buf;
+    UINT32DECODE(p, u);
+    if (u != nelmts)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "wrong number of elements in packed chunk")
+    bitmap = (uint8_t *)chunk->buf + 4 + (4 * nelmts);
+    data   = (uint8_t *)chunk->buf + hdr_size;
+
+    /* Point at each element's data */
+    for (u = 0, start = 0; u < nelmts; u++) {
+        uint32_t end; /* End of the element's data */
+
+        UINT32DECODE(p, end);
+        if (end < start || end > nbytes - hdr_size)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "corrupt element offset in packed chunk")
+
+        chunk->nil[u] = (hbool_t)((bitmap[u / 8] >> (u % 8)) & 1);
+        chunk->ptr[u] = data + start;
+        chunk->len[u] = end - start;
+        start         = end;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__vlpack_load() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__vlpack_store
+ *
+ * Purpose:     Pack the elements described by CHUNK, run the result
+ *              through the filter pipeline and write it as the chunk at
+ *              SCALED, replacing any previous version of the chunk.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__vlpack_store(const H5D_t *dset, const H5D_vlpack_info_t *info, const hsize_t *scaled,
+                  const H5D_vlpack_chunk_t *chunk)
+{
+    hsize_t  offset[H5O_LAYOUT_NDIMS];                /* Offset of the chunk in the dataset */
+    size_t   nelmts    = info->chunk_nelmts;          /* Number of elements in the chunk */
+    size_t   hdr_size  = H5D_VLPACK_HDR_SIZE(nelmts); /* Size of the chunk's header */
+    size_t   data_size = 0;                           /* Size of the element data */
+    size_t   nbytes;                                  /* Size of the filtered chunk */
+    size_t   buf_size;                                /* Size of the chunk buffer */
+    void *   buf = NULL;                              /* Chunk buffer */
+    unsigned filter_mask = 0;                         /* Filters skipped for the chunk */
+    uint8_t *p;                                       /* Pointer into the header */
+    uint8_t *bitmap;                                  /* Nil element bitmap */
+    uint8_t *data;                                    /* Element data */
+    uint32_t end;                                     /* End of an element's data */
+    unsigned u;                                       /* Local index variable */
+    herr_t   ret_value = SUCCEED;                     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Compute the size of the packed chunk */
+    for (u = 0; u < nelmts; u++) {
+        data_size += chunk->len[u];
+        if (data_size > (size_t)UINT32_MAX)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "too much variable-length data in one chunk")
+    } /* end for */
+    nbytes = buf_size = hdr_size + data_size;
+    if (NULL == (buf = H5MM_malloc(buf_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+
+    /* Pack the elements */
+    p = (uint8_t *)buf;
+    UINT32ENCODE(p, nelmts);
+    bitmap = p + (4 * nelmts);
+    HDmemset(bitmap, 0, (nelmts + 7) / 8);
+    data = (uint8_t *)buf + hdr_size;
+    for (u = 0, end = 0; u < nelmts; u++) {
+        if (chunk->nil[u])
+            bitmap[u / 8] |= (uint8_t)(1 << (u % 8));
+        else if (chunk->len[u] > 0) {
+            H5MM_memcpy(data + end, chunk->ptr[u], chunk->len[u]);
+            end += (uint32_t)chunk->len[u];
+        } /* end if */
+        UINT32ENCODE(p, end);
+    } /* end for */
+
+    /* Apply the filter pipeline */
+    if (H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &filter_mask, info->err_detect, info->filter_cb,
+                     &nbytes, &buf_size, &buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
+#if H5_SIZEOF_SIZE_T > 4
+    /* Check for the chunk expanding too much to encode in a 32-bit value */
+    if (nbytes > ((size_t)0xffffffff))
+        HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk too large for 32-bit length")
+#endif /* H5_SIZEOF_SIZE_T > 4 */
+
+    /* Write the chunk, allocating space for it as needed */
+    for (u = 0; u < dset->shared->ndims; u++)
+        offset[u] = scaled[u] * dset->shared->layout.u.chunk.dim[u];
+    offset[u] = 0;
+    if (H5D__chunk_direct_write(dset, filter_mask, offset, (uint32_t)nbytes, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write packed chunk")
+
+done:
+    H5MM_xfree(buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__vlpack_store() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__vlpack_sel_index
+ *
+ * Purpose:     Retrieve the index within the chunk of each of the NELMTS
+ *              elements selected in SPACE, in selection iteration order.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__vlpack_sel_index(const H5S_t *space, size_t nelmts, size_t *idx)
+{
+    H5S_sel_iter_t *iter      = NULL;          /* Selection iterator */
+    hbool_t         iter_init = FALSE;         /* Whether the iterator has been initialized */
+    hsize_t         off[H5D_VLPACK_NSEQ];      /* Sequence offsets */
+    size_t          len[H5D_VLPACK_NSEQ];      /* Sequence lengths */
+    size_t          nseq;                      /* Number of sequences retrieved */
+    size_t          nelem;                     /* Number of elements in the sequences */
+    size_t          n = 0;                     /* Number of elements indexed */
+    size_t          u, v;                      /* Local index variables */
+    herr_t          ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (NULL == (iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate selection iterator")
+    if (H5S_select_iter_init(iter, space, (size_t)1, 0) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
+    iter_init = TRUE;
+
+    /* With an element size of one, sequence offsets are element indices */
+    while (n < nelmts) {
+        if (H5S_SELECT_ITER_GET_SEQ_LIST(iter, (size_t)H5D_VLPACK_NSEQ, nelmts - n, &nseq, &nelem, off, len) <
+            0)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+        if (0 == nseq)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "selection ended early")
+
+        for (u = 0; u < nseq; u++)
+            for (v = 0; v < len[u]; v++)
+                idx[n++] = (size_t)off[u] + v;
+    } /* end while */
+
+done:
+    if (iter_init && H5S_SELECT_ITER_RELEASE(iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release selection iterator")
+    if (iter)
+        iter = H5FL_FREE(H5S_sel_iter_t, iter);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__vlpack_sel_index() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__vlpack_alloc
+ *
+ * Purpose:     Allocate memory for variable-length data returned to the
+ *              application, with the application's allocator if it set
+ *              one.
+ *
+ * Return:      Success:    Pointer to the new memory
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5D__vlpack_alloc(const H5T_vlen_alloc_info_t *vl_alloc_info, size_t size)
+{
+    void *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (vl_alloc_info->alloc_func)
+        ret_value = (vl_alloc_info->alloc_func)(size, vl_alloc_info->alloc_info);
+    else
+        ret_value = HDmalloc(size);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__vlpack_alloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__vlpack_free_elmts
+ *
+ * Purpose:     Release the data of NELMTS memory-form elements that were
+ *              produced by a datatype conversion.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__vlpack_free_elmts(const H5D_vlpack_info_t *info, void *elmts, size_t nelmts,
+                       const H5T_vlen_alloc_info_t *vl_alloc_info)
+{
+    size_t u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < nelmts; u++) {
+        void *p = info->is_str ? (void *)((char **)elmts)[u] : ((hvl_t *)elmts)[u].p;
+
+        if (p) {
+            if (vl_alloc_info->free_func)
+                (vl_alloc_info->free_func)(p, vl_alloc_info->free_info);
+            else
+                HDfree(p);
+        } /* end if */
+    }     /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__vlpack_free_elmts() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__vlpack_read
+ *
+ * Purpose:     Read the selection from a packed dataset.  The selected
+ *              elements of each chunk are unpacked into the memory form
+ *              of the dataset's datatype, converted to the memory
+ *              datatype and scattered to the application's buffer.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__vlpack_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, H5D_chunk_map_t *fm)
+{
+    const H5D_t *         dset = io_info->dset;       /* Dataset being read */
+    H5D_vlpack_info_t     info;                       /* Packed dataset info */
+    H5D_vlpack_chunk_t    chunk;                      /* Unpacked chunk */
+    hbool_t               info_init = FALSE;          /* Whether INFO has been set up */
+    H5T_path_t *          tpath;                      /* Conversion path to the memory datatype */
+    hbool_t               is_noop;                    /* Whether the conversion is a no-op */
+    H5T_vlen_alloc_info_t vl_alloc_info;              /* Application's VL allocation info */
+    H5SL_node_t *         chunk_node;                 /* Current node in chunk skip list */
+    H5S_sel_iter_t *      mem_iter      = NULL;       /* Memory selection iterator */
+    hbool_t               mem_iter_init = FALSE;      /* Whether the iterator has been initialized */
+    size_t *              idx           = NULL;       /* Chunk index of each selected element */
+    uint8_t *             tconv         = NULL;       /* Conversion buffer */
+    uint8_t *             bkg           = NULL;       /* Background buffer */
+    char *                strbuf        = NULL;       /* Terminated copies of strings */
+    size_t                strbuf_size   = 0;          /* Size of STRBUF */
+    size_t                elmt_size;                  /* Size of an element in TCONV */
+    size_t                max_nelmts;                 /* Most elements selected in one chunk */
+    hbool_t               skip_missing_chunks = FALSE; /* Whether to skip missing chunks */
+    herr_t                ret_value           = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(io_info->u.rbuf);
+    HDassert(type_info);
+    HDassert(fm);
+
+    if (H5D__vlpack_init(dset, TRUE, &info, &chunk) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up packed chunk info")
+    info_init = TRUE;
+
+    /* Packed datasets have no user-defined fill value, so leave the buffer
+     * alone for missing chunks only if fill values are never written.
+     */
+    if (dset->shared->dcpl_cache.fill.fill_time == H5D_FILL_TIME_NEVER)
+        skip_missing_chunks = TRUE;
+
+    /* Find the conversion to the memory datatype */
+    if (NULL == (tpath = H5T_path_find(info.mtype, type_info->mem_type)))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to convert between src and dest datatype")
+    is_noop = H5T_path_noop(tpath);
+
+    /* Without a conversion, elements are copied straight into memory
+     * allocated for the application
+     */
+    if (is_noop && H5CX_get_vlen_alloc_info(&vl_alloc_info) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to retrieve VL allocation info")
+
+    /* Allocate buffers for the largest possible selection in a chunk */
+    elmt_size  = MAX(H5T_get_size(info.mtype), type_info->dst_type_size);
+    max_nelmts = (size_t)MIN((hsize_t)info.chunk_nelmts, fm->nelmts);
+    if (NULL == (idx = (size_t *)H5MM_malloc(max_nelmts * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for element indices")
+    if (NULL == (tconv = (uint8_t *)H5MM_malloc(max_nelmts * elmt_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
+    if (!is_noop && H5T_path_bkg(tpath) != H5T_BKG_NO)
+        if (NULL == (bkg = (uint8_t *)H5MM_malloc(max_nelmts * elmt_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for background buffer")
+    if (NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory iterator")
+
+    /* Iterate through nodes in chunk skip list */
+    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
+    while (chunk_node) {
+        H5D_chunk_info_t *chunk_info;             /* Chunk information */
+        size_t            nsel;                   /* Number of elements selected in chunk */
+        size_t            str_off = 0;            /* Offset in STRBUF */
+        size_t            u;                      /* Local index variable */
+
+        /* Get the actual chunk information from the skip list node */
+        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+        nsel       = (size_t)chunk_info->chunk_points;
+
+        /* Load and unpack the chunk */
+        if (H5D__vlpack_load(dset, &info, chunk_info->scaled, &chunk) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to load packed chunk")
+
+        if (chunk.buf || !skip_missing_chunks) {
+            if (H5D__vlpack_sel_index(chunk_info->fspace, nsel, idx) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected elements")
+
+            /* Make room for terminated copies of the selected strings */
+            if (info.is_str && !is_noop) {
+                size_t str_size = 0; /* Size of the copies */
+
+                for (u = 0; u < nsel; u++)
+                    if (!chunk.nil[idx[u]])
+                        str_size += chunk.len[idx[u]] + 1;
+                if (str_size > strbuf_size) {
+                    char *new_strbuf; /* Resized STRBUF */
+
+                    if (NULL == (new_strbuf = (char *)H5MM_realloc(strbuf, str_size)))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for strings")
+                    strbuf      = new_strbuf;
+                    strbuf_size = str_size;
+                } /* end if */
+            }     /* end if */
+
+            /* Build the memory form of the selected elements */
+            for (u = 0; u < nsel; u++) {
+                size_t i = idx[u]; /* Index of the element in the chunk */
+
+                if (info.is_str) {
+                    char *s = NULL; /* String for the element */
+
+                    if (!chunk.nil[i]) {
+                        if (!is_noop) {
+                            s = strbuf + str_off;
+                            str_off += chunk.len[i] + 1;
+                        } /* end if */
+                        else if (NULL ==
+                                 (s = (char *)H5D__vlpack_alloc(&vl_alloc_info, chunk.len[i] + 1)))
+                            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL,
+                                        "memory allocation failed for string")
+                        if (chunk.len[i] > 0)
+                            H5MM_memcpy(s, chunk.ptr[i], chunk.len[i]);
+                        s[chunk.len[i]] = '\0';
+                    } /* end if */
+                    ((char **)tconv)[u] = s;
+                } /* end if */
+                else {
+                    hvl_t vl = {0, NULL}; /* Sequence for the element */
+
+                    if (!chunk.nil[i] && chunk.len[i] > 0) {
+                        vl.len = chunk.len[i] / info.base_size;
+                        if (!is_noop)
+                            vl.p = chunk.ptr[i];
+                        else {
+                            if (NULL == (vl.p = H5D__vlpack_alloc(&vl_alloc_info, chunk.len[i])))
+                                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL,
+                                            "memory allocation failed for sequence")
+                            H5MM_memcpy(vl.p, chunk.ptr[i], chunk.len[i]);
+                        } /* end else */
+                    }     /* end if */
+                    ((hvl_t *)tconv)[u] = vl;
+                } /* end else */
+            }     /* end for */
+
+            /* Convert to the memory datatype */
+            if (!is_noop) {
+                if (bkg)
+                    HDmemset(bkg, 0, nsel * elmt_size);
+                if (H5T_convert(tpath, info.mtype_id, type_info->dst_type_id, nsel, (size_t)0, (size_t)0,
+                                tconv, bkg) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+            } /* end if */
+
+            /* Scatter the elements to the application's buffer */
+            if (H5S_select_iter_init(mem_iter, chunk_info->mspace, type_info->dst_type_size, 0) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                            "unable to initialize memory selection information")
+            mem_iter_init = TRUE;
+            if (H5D__scatter_mem(tconv, mem_iter, nsel, io_info->u.rbuf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "scatter failed")
+            if (H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release selection iterator")
+            mem_iter_init = FALSE;
+        } /* end if */
+
+        /* Advance to next chunk in list */
+        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+    } /* end while */
+
+done:
+    if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release selection iterator")
+    if (mem_iter)
+        mem_iter = H5FL_FREE(H5S_sel_iter_t, mem_iter);
+    H5MM_xfree(idx);
+    H5MM_xfree(tconv);
+    H5MM_xfree(bkg);
+    H5MM_xfree(strbuf);
+    if (info_init && H5D__vlpack_term(&info, &chunk) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release packed chunk info")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__vlpack_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__vlpack_write
+ *
+ * Purpose:     Write the selection to a packed dataset.  The selected
+ *              elements for each chunk are gathered from the application's
+ *              buffer and converted to the memory form of the dataset's
+ *              datatype, then replace the chunk's existing elements and
+ *              the chunk is packed and written again.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__vlpack_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, H5D_chunk_map_t *fm)
+{
+    const H5D_t *         dset = io_info->dset;  /* Dataset being written */
+    H5D_vlpack_info_t     info;                  /* Packed dataset info */
+    H5D_vlpack_chunk_t    chunk;                 /* Unpacked chunk */
+    hbool_t               info_init = FALSE;     /* Whether INFO has been set up */
+    H5T_path_t *          tpath;                 /* Conversion path from the memory datatype */
+    hbool_t               is_noop;               /* Whether the conversion is a no-op */
+    H5T_vlen_alloc_info_t vl_alloc_info;         /* VL allocation info for conversions */
+    H5SL_node_t *         chunk_node;            /* Current node in chunk skip list */
+    H5S_sel_iter_t *      mem_iter      = NULL;  /* Memory selection iterator */
+    hbool_t               mem_iter_init = FALSE; /* Whether the iterator has been initialized */
+    size_t *              idx           = NULL;  /* Chunk index of each selected element */
+    uint8_t *             tconv         = NULL;  /* Conversion buffer */
+    uint8_t *             bkg           = NULL;  /* Background buffer */
+    size_t                nconv         = 0;     /* Number of converted elements to release */
+    size_t                elmt_size;             /* Size of an element in TCONV */
+    size_t                max_nelmts;            /* Most elements selected in one chunk */
+    herr_t                ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(io_info->u.wbuf);
+    HDassert(type_info);
+    HDassert(fm);
+
+    if (H5D__vlpack_init(dset, TRUE, &info, &chunk) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up packed chunk info")
+    info_init = TRUE;
+
+    /* Find the conversion from the memory datatype */
+    if (NULL == (tpath = H5T_path_find(type_info->mem_type, info.mtype)))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to convert between src and dest datatype")
+    is_noop = H5T_path_noop(tpath);
+
+    /* Converted elements are allocated with the VL allocation routines */
+    if (!is_noop && H5CX_get_vlen_alloc_info(&vl_alloc_info) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to retrieve VL allocation info")
+
+    /* Allocate buffers for the largest possible selection in a chunk */
+    elmt_size  = MAX(H5T_get_size(info.mtype), type_info->src_type_size);
+    max_nelmts = (size_t)MIN((hsize_t)info.chunk_nelmts, fm->nelmts);
+    if (NULL == (idx = (size_t *)H5MM_malloc(max_nelmts * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for element indices")
+    if (NULL == (tconv = (uint8_t *)H5MM_malloc(max_nelmts * elmt_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
+    if (!is_noop && H5T_path_bkg(tpath) != H5T_BKG_NO)
+        if (NULL == (bkg = (uint8_t *)H5MM_malloc(max_nelmts * elmt_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for background buffer")
+    if (NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory iterator")
+
+    /* Iterate through nodes in chunk skip list */
+    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
+    while (chunk_node) {
+        H5D_chunk_info_t *chunk_info; /* Chunk information */
+        size_t            nsel;       /* Number of elements selected in chunk */
+        size_t            u;          /* Local index variable */
+
+        /* Get the actual chunk information from the skip list node */
+        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+        nsel       = (size_t)chunk_info->chunk_points;
+
+        /* Load and unpack the chunk's existing elements */
+        if (H5D__vlpack_load(dset, &info, chunk_info->scaled, &chunk) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to load packed chunk")
+        if (H5D__vlpack_sel_index(chunk_info->fspace, nsel, idx) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected elements")
+
+        /* Gather the elements from the application's buffer */
+        if (H5S_select_iter_init(mem_iter, chunk_info->mspace, type_info->src_type_size, 0) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize memory selection information")
+        mem_iter_init = TRUE;
+        if (nsel != H5D__gather_mem(io_info->u.wbuf, mem_iter, nsel, tconv))
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "mem gather failed")
+        if (H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release selection iterator")
+        mem_iter_init = FALSE;
+
+        /* Convert to the memory form of the dataset's datatype */
+        if (!is_noop) {
+            if (bkg)
+                HDmemset(bkg, 0, nsel * elmt_size);
+            if (H5T_convert(tpath, type_info->src_type_id, info.mtype_id, nsel, (size_t)0, (size_t)0, tconv,
+                            bkg) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+            nconv = nsel;
+        } /* end if */
+
+        /* Replace the selected elements */
+        for (u = 0; u < nsel; u++) {
+            size_t i = idx[u]; /* Index of the element in the chunk */
+
+            if (info.is_str) {
+                char *s = ((char **)tconv)[u]; /* String for the element */
+
+                chunk.nil[i] = (hbool_t)(NULL == s);
+                chunk.ptr[i] = (uint8_t *)s;
+                chunk.len[i] = s ? HDstrlen(s) : 0;
+            } /* end if */
+            else {
+                hvl_t *vl = &((hvl_t *)tconv)[u]; /* Sequence for the element */
+
+                chunk.nil[i] = (hbool_t)(0 == vl->len || NULL == vl->p);
+                chunk.ptr[i] = chunk.nil[i] ? NULL : (uint8_t *)vl->p;
+                chunk.len[i] = chunk.nil[i] ? 0 : vl->len * info.base_size;
+            } /* end else */
+        }     /* end for */
+
+        /* Pack and write the chunk */
+        if (H5D__vlpack_store(dset, &info, chunk_info->scaled, &chunk) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to store packed chunk")
+
+        /* Release the converted elements */
+        if (nconv > 0) {
+            H5D__vlpack_free_elmts(&info, tconv, nconv, &vl_alloc_info);
+            nconv = 0;
+        } /* end if */
+
+        /* Advance to next chunk in list */
+        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+    } /* end while */
+
+done:
+    if (nconv > 0)
+        H5D__vlpack_free_elmts(&info, tconv, nconv, &vl_alloc_info);
+    if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release selection iterator")
+    if (mem_iter)
+        mem_iter = H5FL_FREE(H5S_sel_iter_t, mem_iter);
+    H5MM_xfree(idx);
+    H5MM_xfree(tconv);
+    H5MM_xfree(bkg);
+    if (info_init && H5D__vlpack_term(&info, &chunk) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release packed chunk info")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__vlpack_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__vlpack_fill_nil
+ *
+ * Purpose:     Reset the elements selected in SPACE of the packed chunk
+ *              at SCALED to nil, as is done with the fill value for
+ *              other datasets when they shrink.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__vlpack_fill_nil(const H5D_t *dset, const hsize_t *scaled, const H5S_t *space)
+{
+    H5D_vlpack_info_t  info;                /* Packed dataset info */
+    H5D_vlpack_chunk_t chunk;               /* Unpacked chunk */
+    hbool_t            info_init = FALSE;   /* Whether INFO has been set up */
+    size_t *           idx       = NULL;    /* Chunk index of each selected element */
+    hssize_t           snsel;               /* Number of selected elements (signed) */
+    size_t             nsel;                /* Number of selected elements */
+    size_t             u;                   /* Local index variable */
+    herr_t             ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(dset);
+    HDassert(scaled);
+    HDassert(space);
+
+    if (H5D__vlpack_init(dset, FALSE, &info, &chunk) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up packed chunk info")
+    info_init = TRUE;
+
+    /* Load the chunk, there's nothing to do if it doesn't exist */
+    if (H5D__vlpack_load(dset, &info, scaled, &chunk) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to load packed chunk")
+    if (NULL == chunk.buf)
+        HGOTO_DONE(SUCCEED)
+
+    /* Reset the selected elements */
+    if ((snsel = H5S_GET_SELECT_NPOINTS(space)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOUNT, FAIL, "can't get number of elements selected")
+    H5_CHECKED_ASSIGN(nsel, size_t, snsel, hssize_t);
+    if (NULL == (idx = (size_t *)H5MM_malloc(MAX(nsel, 1) * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for element indices")
+    if (H5D__vlpack_sel_index(space, nsel, idx) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected elements")
+    for (u = 0; u < nsel; u++) {
+        chunk.nil[idx[u]] = TRUE;
+        chunk.ptr[idx[u]] = NULL;
+        chunk.len[idx[u]] = 0;
+    } /* end for */
+
+    /* Pack and write the chunk */
+    if (H5D__vlpack_store(dset, &info, scaled, &chunk) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to store packed chunk")
+
+done:
+    H5MM_xfree(idx);
+    if (info_init && H5D__vlpack_term(&info, &chunk) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release packed chunk info")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__vlpack_fill_nil() */
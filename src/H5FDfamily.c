@@ -30,6 +30,11 @@
  *        can be quite time consuming on file systems that don't
  *        implement holes, like nfs).
  *
+ *        A request that spans several members can be transferred with
+ *        one worker thread per member, and members can be opened on
+ *        demand with a limit on how many are open at once (see
+ *        H5Pset_fapl_family_io).
+ *
  */
 
 #include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
@@ -40,6 +45,9 @@
 #include "H5Fprivate.h"  /* File access                */
 #include "H5FDprivate.h" /* File drivers                */
 #include "H5FDfamily.h"  /* Family file driver             */
+#include "H5FDiouring.h" /* io_uring file driver            */
+#include "H5FDmmap.h"    /* Memory-mapped file driver       */
+#include "H5FDsec2.h"    /* Posix unbuffered I/O file driver  */
 #include "H5Iprivate.h"  /* IDs                      */
 #include "H5MMprivate.h" /* Memory management            */
 #include "H5Pprivate.h"  /* Property lists            */
@@ -47,6 +55,9 @@
 /* The size of the member name buffers */
 #define H5FD_FAM_MEMB_NAME_BUF_SIZE 4096
 
+/* Requests smaller than this are never split across worker threads */
+#define H5FD_FAM_PARALLEL_MIN_SIZE (1024 * 1024)
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_FAMILY_g = 0;
 
@@ -69,14 +80,39 @@ typedef struct H5FD_family_t {
     hbool_t repart_members; /* Whether to mark the superblock dirty
                              * when it is loaded, so that the family
                              * member sizes can be re-encoded       */
+
+    /* Parallel member I/O and on-demand opening of members */
+    unsigned  max_threads;  /*threads for requests spanning members */
+    hbool_t   direct_fds;   /*members are plain POSIX files whose
+                             * descriptors workers may use directly */
+    unsigned  max_open;     /*max members open at once, 0 for all */
+    unsigned  nopen;        /*number of members currently open    */
+    uint64_t  lru_clock;    /*last value handed out to memb_used  */
+    uint64_t *memb_used;    /*when each open member was last used */
+    haddr_t * memb_eof;     /*EOF of each member that is closed    */
+    hbool_t   locked;       /*whether the members are locked      */
+    hbool_t   lock_rw;      /*lock type, for members opened later */
 } H5FD_family_t;
 
 /* Driver-specific file access properties */
 typedef struct H5FD_family_fapl_t {
-    hsize_t memb_size;    /*size of each member            */
-    hid_t   memb_fapl_id; /*file access property list of each memb*/
+    hsize_t  memb_size;    /*size of each member            */
+    hid_t    memb_fapl_id; /*file access property list of each memb*/
+    unsigned max_threads;  /*threads for requests spanning members */
+    unsigned max_open;     /*max members open at once, 0 for all */
 } H5FD_family_fapl_t;
 
+/* One member's part of a request that spans several members */
+typedef struct H5FD_family_piece_t {
+    H5FD_t *             memb;  /*member file                        */
+    haddr_t              addr;  /*address in the member              */
+    size_t               size;  /*bytes in this member               */
+    int                  fd;    /*member's file descriptor           */
+    unsigned char *      rbuf;  /*where to read to, for reads        */
+    const unsigned char *wbuf;  /*what to write, for writes          */
+    int                  error; /*errno of a failed transfer, or 0  */
+} H5FD_family_piece_t;
+
 /* Callback prototypes */
 static herr_t  H5FD__family_term(void);
 static void *  H5FD__family_fapl_get(H5FD_t *_file);
@@ -102,6 +138,17 @@ static herr_t  H5FD__family_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closi
 static herr_t  H5FD__family_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__family_unlock(H5FD_t *_file);
 
+/* Helper routines */
+static herr_t  H5FD__family_grow(H5FD_family_t *file, unsigned n);
+static haddr_t H5FD__family_memb_eoa(const H5FD_family_t *file, unsigned u);
+static herr_t  H5FD__family_close_memb(H5FD_family_t *file, unsigned u);
+static H5FD_t *H5FD__family_get_memb(H5FD_family_t *file, unsigned u);
+#ifdef H5_HAVE_PREADWRITE
+static herr_t H5FD__family_io_task(size_t task, void *_pieces);
+#endif
+static htri_t  H5FD__family_parallel_io(H5FD_family_t *file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+                                        size_t size, void *rbuf, const void *wbuf);
+
 /* The class struct */
 static const H5FD_class_t H5FD_family_g = {
     "family",                   /* name            */
@@ -240,7 +287,7 @@ herr_t
 H5Pset_fapl_family(hid_t fapl_id, hsize_t msize, hid_t memb_fapl_id)
 {
     herr_t             ret_value;
-    H5FD_family_fapl_t fa = {0, -1};
+    H5FD_family_fapl_t fa = {0, -1, H5FD_FAMILY_DEFAULT_THREADS, 0};
     H5P_genplist_t *   plist; /* Property list pointer */
 
     FUNC_ENTER_API(FAIL)
@@ -309,6 +356,99 @@ done:
     FUNC_LEAVE_API(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_family_io
+ *
+ * Purpose:     Sets how the family driver set on FAPL_ID with
+ *              H5Pset_fapl_family() accesses its members.
+ *
+ *              A large request that spans several members is transferred
+ *              with one task per member, run on up to MAX_THREADS
+ *              threads.  This is only done when the members use the sec2
+ *              or io_uring driver.  A value of 1 transfers the members
+ *              one after another.
+ *
+ *              If MAX_OPEN_MEMBERS is zero, all members are opened when
+ *              the family is opened.  Otherwise only the first member is,
+ *              and the others are opened when they are accessed, closing
+ *              the least recently used one whenever MAX_OPEN_MEMBERS are
+ *              open.  This requires members that are single files (the
+ *              sec2, mmap or io_uring driver); for other member drivers
+ *              all members are opened.  A member's file lock is released
+ *              while it is closed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_family_io(hid_t fapl_id, unsigned max_threads, unsigned max_open_members)
+{
+    H5P_genplist_t *          plist; /* Property list pointer */
+    const H5FD_family_fapl_t *old_fa;
+    H5FD_family_fapl_t        fa;
+    herr_t                    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iIuIu", fapl_id, max_threads, max_open_members);
+
+    /* Check arguments */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if (H5FD_FAMILY != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (old_fa = (const H5FD_family_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if (0 == max_threads)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be positive")
+    if (1 == max_open_members)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "at least two members must be allowed to be open")
+
+    /* Update a copy of the driver info (H5P_set_driver copies it again) */
+    H5MM_memcpy(&fa, old_fa, sizeof(H5FD_family_fapl_t));
+    fa.max_threads = max_threads;
+    fa.max_open    = max_open_members;
+    if (H5P_set_driver(plist, H5FD_FAMILY, &fa) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set family driver info")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_family_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_family_io
+ *
+ * Purpose:     Returns the settings made with H5Pset_fapl_family_io().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_family_io(hid_t fapl_id, unsigned *max_threads /*out*/, unsigned *max_open_members /*out*/)
+{
+    H5P_genplist_t *          plist; /* Property list pointer */
+    const H5FD_family_fapl_t *fa;
+    herr_t                    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", fapl_id, max_threads, max_open_members);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_FAMILY != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_family_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if (max_threads)
+        *max_threads = fa->max_threads;
+    if (max_open_members)
+        *max_open_members = fa->max_open;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_family_io() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__family_fapl_get
  *
@@ -337,7 +477,9 @@ H5FD__family_fapl_get(H5FD_t *_file)
     if (NULL == (fa = (H5FD_family_fapl_t *)H5MM_calloc(sizeof(H5FD_family_fapl_t))))
         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
 
-    fa->memb_size = file->memb_size;
+    fa->memb_size   = file->memb_size;
+    fa->max_threads = file->max_threads;
+    fa->max_open    = file->max_open;
     if (NULL == (plist = (H5P_genplist_t *)H5I_object(file->memb_fapl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
     fa->memb_fapl_id = H5P_copy_plist(plist, FALSE);
@@ -558,6 +700,193 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__family_sb_decode() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_grow
+ *
+ * Purpose:     Makes room for at least N members in the member arrays.
+ *              New slots hold no open member.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__family_grow(H5FD_family_t *file, unsigned n)
+{
+    unsigned  amembs;              /* New number of slots */
+    H5FD_t ** memb;                /* New member array */
+    uint64_t *memb_used;           /* New LRU stamp array */
+    haddr_t * memb_eof;            /* New EOF array */
+    herr_t    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (n > file->amembs) {
+        amembs = MAX(MAX(64, 2 * file->amembs), n);
+
+        if (NULL == (memb = (H5FD_t **)H5MM_realloc(file->memb, amembs * sizeof(H5FD_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to reallocate members")
+        file->memb = memb;
+        if (NULL == (memb_used = (uint64_t *)H5MM_realloc(file->memb_used, amembs * sizeof(uint64_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to reallocate member use stamps")
+        file->memb_used = memb_used;
+        if (NULL == (memb_eof = (haddr_t *)H5MM_realloc(file->memb_eof, amembs * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to reallocate member EOFs")
+        file->memb_eof = memb_eof;
+
+        HDmemset(file->memb + file->amembs, 0, (amembs - file->amembs) * sizeof(H5FD_t *));
+        HDmemset(file->memb_used + file->amembs, 0, (amembs - file->amembs) * sizeof(uint64_t));
+        HDmemset(file->memb_eof + file->amembs, 0, (amembs - file->amembs) * sizeof(haddr_t));
+        file->amembs = amembs;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_grow() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_memb_eoa
+ *
+ * Purpose:     Computes the EOA marker of member U from the EOA marker of
+ *              the family, the same way H5FD__family_set_eoa() does.
+ *
+ * Return:      The member's EOA marker (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__family_memb_eoa(const H5FD_family_t *file, unsigned u)
+{
+    haddr_t start = (haddr_t)u * (haddr_t)file->memb_size; /* Family address of the member */
+    haddr_t addr;                                           /* Part of the EOA in the member */
+    haddr_t ret_value = HADDR_UNDEF;                        /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    addr = (file->eoa > start) ? (file->eoa - start) : 0;
+    if (addr > (haddr_t)file->memb_size)
+        ret_value = (haddr_t)file->memb_size - file->pub.base_addr;
+    else
+        ret_value = addr - file->pub.base_addr;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_memb_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_close_memb
+ *
+ * Purpose:     Closes member U, remembering its EOF for
+ *              H5FD__family_get_eof().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__family_close_memb(H5FD_family_t *file, unsigned u)
+{
+    haddr_t eof;                 /* Member's EOF */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(u > 0 && u < file->nmembs && file->memb[u]);
+
+    if (HADDR_UNDEF == (eof = H5FD_get_eof(file->memb[u], H5FD_MEM_DEFAULT)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to get member eof")
+    if (H5FD_close(file->memb[u]) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "unable to close member file")
+    file->memb[u]     = NULL;
+    file->memb_eof[u] = eof;
+    file->nopen--;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_close_memb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_get_memb
+ *
+ * Purpose:     Returns member U, opening it first if it is closed.  When
+ *              members are opened on demand and the limit on open members
+ *              has been reached, the least recently used member other
+ *              than the first is closed to make room.  If U is one past
+ *              the last member, a new member is created.
+ *
+ * Return:      Success:    The member
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+/* Disable warning for "format not a string literal" here */
+H5_GCC_DIAG_OFF("format-nonliteral")
+static H5FD_t *
+H5FD__family_get_memb(H5FD_family_t *file, unsigned u)
+{
+    char *   memb_name = NULL; /* Name of the member */
+    unsigned flags;            /* Flags to open the member with */
+    unsigned lru;              /* Least recently used open member */
+    unsigned v;                /* Local index variable */
+    H5FD_t * ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(u <= file->nmembs);
+
+    /* Already open? */
+    if (u < file->nmembs && file->memb[u]) {
+        file->memb_used[u] = ++file->lru_clock;
+        HGOTO_DONE(file->memb[u])
+    } /* end if */
+
+    HDassert(file->max_open > 0);
+    if (H5FD__family_grow(file, u + 1) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to reallocate members")
+
+    /* Make room.  The first member always stays open. */
+    if (file->nopen >= file->max_open) {
+        for (v = 1, lru = 0; v < file->nmembs; v++)
+            if (file->memb[v] && (0 == lru || file->memb_used[v] < file->memb_used[lru]))
+                lru = v;
+        if (lru > 0 && H5FD__family_close_memb(file, lru) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, NULL, "unable to close member file")
+    } /* end if */
+
+    /* Existing members were truncated (if requested) when the family was
+     * opened and must not be truncated again */
+    if (u < file->nmembs)
+        flags = file->flags & ~(unsigned)(H5F_ACC_TRUNC | H5F_ACC_EXCL | H5F_ACC_CREAT);
+    else
+        flags = file->flags | H5F_ACC_CREAT;
+
+    if (NULL == (memb_name = (char *)H5MM_malloc(H5FD_FAM_MEMB_NAME_BUF_SIZE)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, NULL, "unable to allocate member name")
+    HDsnprintf(memb_name, H5FD_FAM_MEMB_NAME_BUF_SIZE, file->name, u);
+
+    H5_CHECK_OVERFLOW(file->memb_size, hsize_t, haddr_t);
+    if (NULL == (file->memb[u] = H5FD_open(memb_name, flags, file->memb_fapl_id, (haddr_t)file->memb_size)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open member file")
+    file->nopen++;
+    file->memb_used[u] = ++file->lru_clock;
+    if (u == file->nmembs)
+        file->nmembs++;
+
+    /* Restore the state the member would have if it had stayed open */
+    if (H5FD_set_eoa(file->memb[u], H5FD_MEM_DEFAULT, H5FD__family_memb_eoa(file, u)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to set file eoa")
+    if (file->locked && H5FD_lock(file->memb[u], file->lock_rw) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTLOCKFILE, NULL, "unable to lock member file")
+
+    ret_value = file->memb[u];
+
+done:
+    if (memb_name)
+        H5MM_xfree(memb_name);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_get_memb() */
+H5_GCC_DIAG_ON("format-nonliteral")
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__family_open
  *
@@ -608,7 +937,8 @@ H5FD__family_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
         file->memb_size   = 1024 * 1024 * 1024; /*1GB. Actual member size to be updated later */
         file->pmem_size   = 1024 * 1024 * 1024; /*1GB. Member size passed in through property */
         file->mem_newsize = 0;                  /*New member size used by h5repart only       */
-    }                                           /* end if */
+        file->max_threads = H5FD_FAMILY_DEFAULT_THREADS;
+    } /* end if */
     else {
         H5P_genplist_t *          plist; /* Property list pointer */
         const H5FD_family_fapl_t *fa;
@@ -638,9 +968,11 @@ H5FD__family_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
             file->memb_fapl_id = H5P_copy_plist(plist, FALSE);
         }                                /* end else */
-        file->memb_size = fa->memb_size; /* Actual member size to be updated later */
-        file->pmem_size = fa->memb_size; /* Member size passed in through property */
-    }                                    /* end else */
+        file->memb_size   = fa->memb_size; /* Actual member size to be updated later */
+        file->pmem_size   = fa->memb_size; /* Member size passed in through property */
+        file->max_threads = fa->max_threads;
+        file->max_open    = fa->max_open;
+    } /* end else */
     file->name  = H5MM_strdup(name);
     file->flags = flags;
 
@@ -656,21 +988,14 @@ H5FD__family_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
     if (!HDstrcmp(memb_name, temp))
         HGOTO_ERROR(H5E_FILE, H5E_FILEEXISTS, NULL, "file names not unique")
 
-    /* Open all the family members */
+    /* Open all the family members, or only the first if the others are
+     * opened on demand */
     while (1) {
         HDsnprintf(memb_name, H5FD_FAM_MEMB_NAME_BUF_SIZE, name, file->nmembs);
 
         /* Enlarge member array */
-        if (file->nmembs >= file->amembs) {
-            unsigned n = MAX(64, 2 * file->amembs);
-            H5FD_t **x;
-
-            HDassert(n > 0);
-            if (NULL == (x = (H5FD_t **)H5MM_realloc(file->memb, n * sizeof(H5FD_t *))))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to reallocate members")
-            file->amembs = n;
-            file->memb   = x;
-        } /* end if */
+        if (H5FD__family_grow(file, file->nmembs + 1) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to reallocate members")
 
         /*
          * Attempt to open file. If the first file cannot be opened then fail;
@@ -690,7 +1015,46 @@ H5FD__family_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
             break;
         }
         file->nmembs++;
-    }
+
+        if (1 == file->nmembs) {
+            hid_t driver_id = file->memb[0]->driver_id;
+
+            /* Worker threads may only bypass drivers that do plain POSIX I/O,
+             * and members can only be found without opening them if each is
+             * the single file with the member's name */
+            file->direct_fds = (driver_id == H5FD_SEC2 || driver_id == H5FD_IOURING);
+            if (!file->direct_fds && driver_id != H5FD_MMAP)
+                file->max_open = 0;
+            if (file->max_open > 0)
+                break;
+        } /* end if */
+    }     /* end while */
+    file->nopen = file->nmembs;
+
+    /* Find the remaining members.  Truncate them now if requested, since
+     * they are not truncated again when they are opened. */
+    if (file->max_open > 0)
+        while (1) {
+            h5_stat_t sb;
+
+            HDsnprintf(memb_name, H5FD_FAM_MEMB_NAME_BUF_SIZE, name, file->nmembs);
+            if (HDstat(memb_name, &sb) < 0)
+                break;
+
+            if (H5FD__family_grow(file, file->nmembs + 1) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to reallocate members")
+            file->memb_eof[file->nmembs] = (haddr_t)sb.st_size;
+            if (flags & H5F_ACC_TRUNC) {
+                H5FD_t *memb;
+
+                if (NULL == (memb = H5FD_open(memb_name, t_flags, file->memb_fapl_id, HADDR_UNDEF)))
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open member file")
+                if (H5FD_close(memb) < 0)
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, NULL, "unable to close member file")
+                file->memb_eof[file->nmembs] = 0;
+            } /* end if */
+            file->nmembs++;
+        } /* end while */
 
     /* If the file is reopened and there's only one member file existing, this file may be
      * smaller than the size specified through H5Pset_fapl_family().  Update the actual
@@ -724,6 +1088,10 @@ done:
 
         if (file->memb)
             H5MM_xfree(file->memb);
+        if (file->memb_used)
+            H5MM_xfree(file->memb_used);
+        if (file->memb_eof)
+            H5MM_xfree(file->memb_eof);
         if (H5I_dec_ref(file->memb_fapl_id) < 0)
             HDONE_ERROR(H5E_VFL, H5E_CANTDEC, NULL, "can't close driver ID")
         if (file->name)
@@ -780,6 +1148,8 @@ H5FD__family_close(H5FD_t *_file)
         /* Push error, but keep going*/
         HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close driver ID")
     H5MM_xfree(file->memb);
+    H5MM_xfree(file->memb_used);
+    H5MM_xfree(file->memb_eof);
     H5MM_xfree(file->name);
     H5MM_xfree(file);
 
@@ -922,19 +1292,16 @@ H5FD__family_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t abs_eoa)
     for (u = 0; addr || u < file->nmembs; u++) {
 
         /* Enlarge member array */
-        if (u >= file->amembs) {
-            unsigned n = MAX(64, 2 * file->amembs);
-            H5FD_t **x = (H5FD_t **)H5MM_realloc(file->memb, n * sizeof(H5FD_t *));
-
-            if (!x)
-                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate memory block")
-            file->amembs = n;
-            file->memb   = x;
-            file->nmembs = u;
-        } /* end if */
+        if (H5FD__family_grow(file, u + 1) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate memory block")
 
-        /* Create another file if necessary */
-        if (u >= file->nmembs || !file->memb[u]) {
+        /* Create another file if necessary.  (Existing members that are
+         * closed get their EOA marker when they are reopened.) */
+        if (file->max_open > 0 && u >= file->nmembs) {
+            if (NULL == H5FD__family_get_memb(file, u))
+                HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open member file")
+        } /* end if */
+        else if (file->max_open == 0 && (u >= file->nmembs || !file->memb[u])) {
             file->nmembs = MAX(file->nmembs, u + 1);
             HDsnprintf(memb_name, H5FD_FAM_MEMB_NAME_BUF_SIZE, file->name, u);
             H5E_BEGIN_TRY
@@ -952,12 +1319,13 @@ H5FD__family_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t abs_eoa)
         /* (Note compensating for base address addition in internal routine) */
         H5_CHECK_OVERFLOW(file->memb_size, hsize_t, haddr_t);
         if (addr > (haddr_t)file->memb_size) {
-            if (H5FD_set_eoa(file->memb[u], type, ((haddr_t)file->memb_size - file->pub.base_addr)) < 0)
+            if (file->memb[u] &&
+                H5FD_set_eoa(file->memb[u], type, ((haddr_t)file->memb_size - file->pub.base_addr)) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "unable to set file eoa")
             addr -= file->memb_size;
         } /* end if */
         else {
-            if (H5FD_set_eoa(file->memb[u], type, (addr - file->pub.base_addr)) < 0)
+            if (file->memb[u] && H5FD_set_eoa(file->memb[u], type, (addr - file->pub.base_addr)) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "unable to set file eoa")
             addr = 0;
         } /* end else */
@@ -1004,11 +1372,13 @@ H5FD__family_get_eof(const H5FD_t *_file, H5FD_mem_t type)
     /*
      * Find the last member that has a non-zero EOF and break out of the loop
      * with `i' equal to that member. If all members have zero EOF then exit
-     * loop with i==0.
+     * loop with i==0.  Members that are closed use the EOF they had when
+     * they were closed (or found).
      */
     HDassert(file->nmembs > 0);
     for (i = (int)file->nmembs - 1; i >= 0; --i) {
-        if ((eof = H5FD_get_eof(file->memb[i], type)) != 0)
+        eof = file->memb[i] ? H5FD_get_eof(file->memb[i], type) : file->memb_eof[i];
+        if (eof != 0)
             break;
         if (0 == i)
             break;
@@ -1048,6 +1418,7 @@ H5FD__family_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle)
     H5P_genplist_t *plist;
     hsize_t         offset;
     int             memb;
+    H5FD_t *        memb_file;
     herr_t          ret_value = FAIL; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -1062,12 +1433,197 @@ H5FD__family_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle)
         HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "offset is bigger than file size")
     memb = (int)(offset / file->memb_size);
 
-    ret_value = H5FD_get_vfd_handle(file->memb[memb], fapl, file_handle);
+    if (NULL == (memb_file = H5FD__family_get_memb(file, (unsigned)memb)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open member file")
+    ret_value = H5FD_get_vfd_handle(memb_file, fapl, file_handle);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_io_task
+ *
+ * Purpose:     Transfers one piece of a request handled by
+ *              H5FD__family_parallel_io().  Runs on a worker thread, so
+ *              it only uses the member's file descriptor and reports
+ *              failure through the piece's error field.  Reads past the
+ *              end of the member return zeros, as in the sec2 driver.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifdef H5_HAVE_PREADWRITE
+static herr_t
+H5FD__family_io_task(size_t task, void *_pieces)
+{
+    H5FD_family_piece_t *piece  = (H5FD_family_piece_t *)_pieces + task;
+    HDoff_t              offset = (HDoff_t)piece->addr;
+    size_t               size   = piece->size;
+    size_t               done   = 0;
+
+    while (size > 0) {
+        h5_posix_io_t     bytes_in;
+        h5_posix_io_ret_t bytes_out;
+
+        bytes_in = (size > H5_POSIX_MAX_IO_BYTES) ? H5_POSIX_MAX_IO_BYTES : (h5_posix_io_t)size;
+
+        do {
+            if (piece->rbuf)
+                bytes_out = HDpread(piece->fd, piece->rbuf + done, bytes_in, offset);
+            else
+                bytes_out = HDpwrite(piece->fd, piece->wbuf + done, bytes_in, offset);
+        } while (-1 == bytes_out && EINTR == errno);
+
+        if (-1 == bytes_out) {
+            piece->error = errno;
+            return FAIL;
+        } /* end if */
+        if (0 == bytes_out) {
+            if (!piece->rbuf) {
+                piece->error = EIO;
+                return FAIL;
+            } /* end if */
+            HDmemset(piece->rbuf + done, 0, size);
+            break;
+        } /* end if */
+
+        size -= (size_t)bytes_out;
+        done += (size_t)bytes_out;
+        offset += (HDoff_t)bytes_out;
+    } /* end while */
+
+    return SUCCEED;
+} /* end H5FD__family_io_task() */
+#endif /* H5_HAVE_PREADWRITE */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__family_parallel_io
+ *
+ * Purpose:     Reads into RBUF or writes from WBUF a request that spans
+ *              several members, transferring each member's part on its
+ *              own worker thread with pread/pwrite on the member's file
+ *              descriptor.  The last byte of each written part goes
+ *              through the member driver afterwards, so the driver's
+ *              notion of its EOF stays correct.
+ *
+ *              This is only done for large requests on members that are
+ *              plain POSIX files.  Requests that extend past a member's
+ *              EOA marker are left to the member driver, which reports
+ *              the error.
+ *
+ * Return:      TRUE if the request was transferred, FALSE if it must be
+ *              transferred one member after another, negative on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5FD__family_parallel_io(H5FD_family_t *file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+                         void *rbuf, const void *wbuf)
+{
+#ifdef H5_HAVE_PREADWRITE
+    H5FD_family_piece_t *pieces = NULL;     /* One piece per member */
+    unsigned             first, last;       /* First and last member of the request */
+    unsigned             npieces;           /* Number of members in the request */
+    unsigned             k;                 /* Local index variable */
+    size_t               done = 0;          /* Bytes assigned to pieces so far */
+#endif /* H5_HAVE_PREADWRITE */
+    htri_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+#ifdef H5_HAVE_PREADWRITE
+    if (!file->direct_fds || file->max_threads < 2 || size < H5FD_FAM_PARALLEL_MIN_SIZE)
+        HGOTO_DONE(FALSE)
+    H5_CHECKED_ASSIGN(first, unsigned, addr / file->memb_size, hsize_t);
+    H5_CHECKED_ASSIGN(last, unsigned, (addr + size - 1) / file->memb_size, hsize_t);
+    if (first == last)
+        HGOTO_DONE(FALSE)
+
+    /* All the members must be open at the same time */
+    npieces = (last - first) + 1;
+    if (file->max_open > 0 && npieces >= file->max_open)
+        HGOTO_DONE(FALSE)
+
+    if (NULL == (pieces = (H5FD_family_piece_t *)H5MM_calloc(npieces * sizeof(H5FD_family_piece_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate member pieces")
+
+    for (k = 0; k < npieces; k++) {
+        H5FD_family_piece_t *piece = &pieces[k];
+        hsize_t              tempreq;
+        void *               handle = NULL;
+
+        piece->addr = (addr + done) % file->memb_size;
+        tempreq     = file->memb_size - piece->addr;
+        piece->size = MIN(size - done, (tempreq > SIZET_MAX) ? SIZET_MAX : (size_t)tempreq);
+
+        HDassert(first + k < file->nmembs);
+        if (NULL == (piece->memb = H5FD__family_get_memb(file, first + k)))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open member file")
+        if ((piece->addr + piece->size) > H5FD_get_eoa(piece->memb, type))
+            HGOTO_DONE(FALSE)
+        if (H5FD_get_vfd_handle(piece->memb, file->memb_fapl_id, &handle) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get member file handle")
+        piece->fd = *((int *)handle);
+
+        if (rbuf)
+            piece->rbuf = (unsigned char *)rbuf + done;
+        else
+            piece->wbuf = (const unsigned char *)wbuf + done;
+        done += piece->size;
+    } /* end for */
+    HDassert(done == size);
+
+    /* Hold back the last byte of each written piece */
+    if (wbuf)
+        for (k = 0; k < npieces; k++)
+            pieces[k].size--;
+
+    /* Translate to file offsets for the workers */
+    for (k = 0; k < npieces; k++)
+        pieces[k].addr += pieces[k].memb->base_addr;
+
+    if (H5TS_run_tasks(file->max_threads, (size_t)npieces, H5FD__family_io_task, pieces) < 0) {
+        for (k = 0; k < npieces; k++)
+            if (pieces[k].error)
+                HGOTO_ERROR(H5E_IO, rbuf ? H5E_READERROR : H5E_WRITEERROR, FAIL,
+                            "member file %s failed, errno = %d, error message = '%s'",
+                            rbuf ? "read" : "write", pieces[k].error, HDstrerror(pieces[k].error))
+        HGOTO_ERROR(H5E_IO, rbuf ? H5E_READERROR : H5E_WRITEERROR, FAIL, "member file I/O failed")
+    } /* end if */
+
+    /* Write the held-back bytes through the member drivers */
+    if (wbuf)
+        for (k = 0; k < npieces; k++) {
+            haddr_t last_addr = (pieces[k].addr - pieces[k].memb->base_addr) + pieces[k].size;
+
+            if (H5FDwrite(pieces[k].memb, type, dxpl_id, last_addr, (size_t)1,
+                          pieces[k].wbuf + pieces[k].size) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file write failed")
+        } /* end for */
+
+    ret_value = TRUE;
+#else
+    (void)file;
+    (void)type;
+    (void)dxpl_id;
+    (void)addr;
+    (void)size;
+    (void)rbuf;
+    (void)wbuf;
+    HGOTO_DONE(FALSE)
+#endif /* H5_HAVE_PREADWRITE */
+
+done:
+#ifdef H5_HAVE_PREADWRITE
+    if (pieces)
+        H5MM_xfree(pieces);
+#endif /* H5_HAVE_PREADWRITE */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__family_parallel_io() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__family_read
  *
@@ -1095,6 +1651,8 @@ H5FD__family_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, s
     size_t          req;
     hsize_t         tempreq;
     unsigned        u;                   /* Local index variable */
+    H5FD_t *        memb;                /* Member to read from */
+    htri_t          parallel;            /* Whether the members were read concurrently */
     H5P_genplist_t *plist;               /* Property list pointer */
     herr_t          ret_value = SUCCEED; /* Return value */
 
@@ -1107,6 +1665,12 @@ H5FD__family_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, s
     if (NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
 
+    /* Read from several members at once, if possible */
+    if ((parallel = H5FD__family_parallel_io(file, type, dxpl_id, addr, size, buf, NULL)) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file read failed")
+    if (parallel)
+        HGOTO_DONE(SUCCEED)
+
     /* Read from each member */
     while (size > 0) {
         H5_CHECKED_ASSIGN(u, unsigned, addr / file->memb_size, hsize_t);
@@ -1123,7 +1687,9 @@ H5FD__family_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, s
 
         HDassert(u < file->nmembs);
 
-        if (H5FDread(file->memb[u], type, dxpl_id, sub, req, buf) < 0)
+        if (NULL == (memb = H5FD__family_get_memb(file, u)))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open member file")
+        if (H5FDread(memb, type, dxpl_id, sub, req, buf) < 0)
             HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file read failed")
 
         addr += req;
@@ -1160,6 +1726,8 @@ H5FD__family_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     size_t               req;
     hsize_t              tempreq;
     unsigned             u;                   /* Local index variable */
+    H5FD_t *             memb;                /* Member to write to */
+    htri_t               parallel;            /* Whether the members were written concurrently */
     H5P_genplist_t *     plist;               /* Property list pointer */
     herr_t               ret_value = SUCCEED; /* Return value */
 
@@ -1172,6 +1740,12 @@ H5FD__family_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     if (NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
 
+    /* Write to several members at once, if possible */
+    if ((parallel = H5FD__family_parallel_io(file, type, dxpl_id, addr, size, NULL, buf)) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file write failed")
+    if (parallel)
+        HGOTO_DONE(SUCCEED)
+
     /* Write to each member */
     while (size > 0) {
         H5_CHECKED_ASSIGN(u, unsigned, addr / file->memb_size, hsize_t);
@@ -1188,7 +1762,9 @@ H5FD__family_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
 
         HDassert(u < file->nmembs);
 
-        if (H5FDwrite(file->memb[u], type, dxpl_id, sub, req, buf) < 0)
+        if (NULL == (memb = H5FD__family_get_memb(file, u)))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open member file")
+        if (H5FDwrite(memb, type, dxpl_id, sub, req, buf) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file write failed")
 
         addr += req;
@@ -1256,9 +1832,15 @@ H5FD__family_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closi
 
     FUNC_ENTER_STATIC
 
-    for (u = 0; u < file->nmembs; u++)
+    for (u = 0; u < file->nmembs; u++) {
+        /* Reopen closed members that don't have the right size */
+        if (!file->memb[u] && file->max_open > 0 && file->memb_eof[u] != H5FD__family_memb_eoa(file, u))
+            if (NULL == H5FD__family_get_memb(file, u))
+                nerrors++;
+
         if (file->memb[u] && H5FD_truncate(file->memb[u], closing) < 0)
             nerrors++;
+    } /* end for */
 
     if (nerrors)
         HGOTO_ERROR(H5E_IO, H5E_BADVALUE, FAIL, "unable to flush member files")
@@ -1303,13 +1885,17 @@ H5FD__family_lock(H5FD_t *_file, hbool_t rw)
         unsigned v; /* Local index variable */
 
         for (v = 0; v < u; v++) {
-            if (H5FD_unlock(file->memb[v]) < 0)
+            if (file->memb[v] && H5FD_unlock(file->memb[v]) < 0)
                 /* Push error, but keep going */
                 HDONE_ERROR(H5E_IO, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock member files")
         } /* end for */
         HGOTO_ERROR(H5E_IO, H5E_CANTLOCKFILE, FAIL, "unable to lock member files")
     } /* end if */
 
+    /* Remember the lock for members that are opened later */
+    file->locked  = TRUE;
+    file->lock_rw = rw;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__family_lock() */
@@ -1339,6 +1925,7 @@ H5FD__family_unlock(H5FD_t *_file)
         if (file->memb[u])
             if (H5FD_unlock(file->memb[u]) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock member files")
+    file->locked = FALSE;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
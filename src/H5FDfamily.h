@@ -22,6 +22,9 @@
 
 #define H5FD_FAMILY (H5FD_family_init())
 
+/* Default number of threads used for a request that spans several members */
+#define H5FD_FAMILY_DEFAULT_THREADS 4
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -29,6 +32,9 @@ extern "C" {
 H5_DLL hid_t  H5FD_family_init(void);
 H5_DLL herr_t H5Pset_fapl_family(hid_t fapl_id, hsize_t memb_size, hid_t memb_fapl_id);
 H5_DLL herr_t H5Pget_fapl_family(hid_t fapl_id, hsize_t *memb_size /*out*/, hid_t *memb_fapl_id /*out*/);
+H5_DLL herr_t H5Pset_fapl_family_io(hid_t fapl_id, unsigned max_threads, unsigned max_open_members);
+H5_DLL herr_t H5Pget_fapl_family_io(hid_t fapl_id, unsigned *max_threads /*out*/,
+                                    unsigned *max_open_members /*out*/);
 
 #ifdef __cplusplus
 }
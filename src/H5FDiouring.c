@@ -0,0 +1,1632 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The Linux io_uring driver.  Reads and writes are issued through
+ *          an io_uring submission queue instead of one pread()/pwrite()
+ *          system call per request, so that many requests can be in flight
+ *          at once and are submitted with a single io_uring_enter() call.
+ *
+ *          Requests larger than the configured I/O size are split into
+ *          pieces which are submitted together.  The pieces of a read are
+ *          waited for before the read returns.  Writes are copied into
+ *          per-slot staging buffers and H5FD_write returns as soon as they
+ *          are queued; they are completed in the background and drained
+ *          before any read, truncate, flush or close that depends on them.
+ *          A write that fails in the background is reported by the next
+ *          read, write, flush or close of the file.
+ *
+ *          The kernel interface is used directly through the io_uring
+ *          system calls and the ring memory mappings, so the driver does
+ *          not depend on liburing.  If the kernel does not provide
+ *          io_uring (or it is disabled), the driver falls back to
+ *          synchronous pread()/pwrite().
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"    /* Generic Functions        */
+#include "H5Eprivate.h"   /* Error handling           */
+#include "H5Fprivate.h"   /* File access              */
+#include "H5FDprivate.h"  /* File drivers             */
+#include "H5FDiouring.h"  /* io_uring file driver     */
+#include "H5FLprivate.h"  /* Free Lists               */
+#include "H5Iprivate.h"   /* IDs                      */
+#include "H5MMprivate.h"  /* Memory management        */
+#include "H5Pprivate.h"   /* Property lists           */
+
+#ifdef H5_HAVE_IOURING_VFD
+
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_IOURING_g = 0;
+
+/* Whether to ignore file locks when disabled (env var value) */
+static htri_t ignore_disabled_file_locks_s = FAIL;
+
+/* Largest queue depth the kernel accepts for a ring */
+#define H5FD_IOURING_MAX_QUEUE_DEPTH 32768
+
+/* The submission and completion queues shared with the kernel.  The
+ * pointers point into the memory mappings of the ring; 'sq_tail_local'
+ * counts the entries that were filled in, of which the last 'to_submit'
+ * have not been handed to the kernel yet.
+ */
+typedef struct H5FD_iouring_ring_t {
+    int                  fd;            /* ring file descriptor, -1 if none */
+    void *               sq_map;        /* submission queue ring mapping    */
+    size_t               sq_map_size;   /* # of bytes in 'sq_map'           */
+    void *               cq_map;        /* completion queue ring mapping    */
+    size_t               cq_map_size;   /* # of bytes in 'cq_map'           */
+    struct io_uring_sqe *sqes;          /* submission queue entries         */
+    size_t               sqes_size;     /* # of bytes in 'sqes'             */
+    unsigned *           sq_tail;       /* kernel's view of the SQ tail     */
+    unsigned *           sq_array;      /* SQ index array                   */
+    unsigned             sq_mask;       /* SQ ring index mask               */
+    unsigned *           cq_head;       /* CQ head, advanced by the driver  */
+    unsigned *           cq_tail;       /* CQ tail, advanced by the kernel  */
+    unsigned             cq_mask;       /* CQ ring index mask               */
+    struct io_uring_cqe *cqes;          /* completion queue entries         */
+    unsigned             sq_tail_local; /* SQ tail including unsubmitted    */
+    unsigned             to_submit;     /* # of entries not yet submitted   */
+} H5FD_iouring_ring_t;
+
+/* A queue slot, describing one piece of I/O that is queued or in flight.
+ * Writes always go through the slot's staging buffer 'buf'.  Reads go
+ * directly into the application's buffer, unless they use O_DIRECT, in
+ * which case an aligned window around the request is read into 'buf' and
+ * 'dest_len' bytes starting 'skip' bytes into it are copied to 'dest'.
+ */
+typedef struct H5FD_iouring_slot_t {
+    hbool_t        in_use;   /* slot is queued or in flight              */
+    hbool_t        is_write; /* write (TRUE) or read (FALSE)             */
+    hbool_t        staged;   /* I/O uses the staging buffer              */
+    int            fd;       /* descriptor the I/O was issued on         */
+    haddr_t        addr;     /* file offset of the I/O                   */
+    struct iovec   iov;      /* memory of the I/O                        */
+    unsigned char *buf;      /* staging buffer                           */
+    unsigned char *dest;     /* for staged reads, where the data goes    */
+    size_t         skip;     /* for staged reads, offset of data in 'buf' */
+    size_t         dest_len; /* for staged reads, # of bytes for 'dest'  */
+} H5FD_iouring_slot_t;
+
+/* The description of a file belonging to this driver.  The 'eoa' and 'eof'
+ * have the same meaning as for the sec2 driver, except that 'eof' already
+ * accounts for writes that are still in flight.  'direct_fd' is a second
+ * descriptor for the file opened with O_DIRECT, or -1.
+ */
+typedef struct H5FD_iouring_t {
+    H5FD_t               pub;         /* public stuff, must be first      */
+    int                  fd;          /* the filesystem file descriptor   */
+    int                  direct_fd;   /* O_DIRECT file descriptor, or -1  */
+    haddr_t              eoa;         /* end of allocated region          */
+    haddr_t              eof;         /* end of file; current file size   */
+    H5FD_iouring_fapl_t  fa;          /* driver-specific file access properties */
+    H5FD_iouring_ring_t  ring;        /* the io_uring instance            */
+    H5FD_iouring_slot_t *slots;       /* queue slots                      */
+    unsigned *           free_slots;  /* stack of unused slot indices     */
+    unsigned             nfree;       /* # of entries in 'free_slots'     */
+    unsigned             nwrites;     /* # of writes queued or in flight  */
+    unsigned             nreads;      /* # of read pieces not yet done    */
+    unsigned             batch;       /* # of queued writes that triggers a submit */
+    unsigned char *      bufs;        /* memory of all staging buffers    */
+    size_t               buf_size;    /* size of each staging buffer      */
+    size_t               guard;       /* granularity of write overlap checks */
+    hbool_t              fixed_bufs;  /* staging buffers are registered   */
+    int                  read_errno;  /* error of the current read        */
+    int                  write_errno; /* first error of a background write */
+    haddr_t              write_err_addr; /* file offset of that write     */
+    hbool_t              ignore_disabled_file_locks;
+    char                 filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+
+    /* On most systems the combination of device and i-node number uniquely
+     * identify a file.
+     */
+    dev_t device; /* file device number   */
+    ino_t inode;  /* file i-node number   */
+} H5FD_iouring_t;
+
+/*
+ * These macros check for overflow of various quantities.  They are the
+ * same as those used by the sec2 driver.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Prototypes */
+static herr_t  H5FD__iouring_term(void);
+static void *  H5FD__iouring_fapl_get(H5FD_t *_file);
+static void *  H5FD__iouring_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__iouring_close(H5FD_t *_file);
+static int     H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__iouring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                  void *buf);
+static herr_t  H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                   const void *buf);
+static herr_t  H5FD__iouring_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__iouring_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__iouring_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__iouring_unlock(H5FD_t *_file);
+
+static herr_t H5FD__iouring_ring_create(H5FD_iouring_t *file);
+static void   H5FD__iouring_ring_destroy(H5FD_iouring_t *file);
+static void   H5FD__iouring_queue(H5FD_iouring_t *file, unsigned idx);
+static herr_t H5FD__iouring_submit(H5FD_iouring_t *file, unsigned min_complete);
+static void   H5FD__iouring_complete(H5FD_iouring_t *file, unsigned idx, int res);
+static herr_t H5FD__iouring_wait(H5FD_iouring_t *file);
+static herr_t H5FD__iouring_drain(H5FD_iouring_t *file);
+static herr_t H5FD__iouring_get_slot(H5FD_iouring_t *file, unsigned *idx);
+static hbool_t H5FD__iouring_write_pending(const H5FD_iouring_t *file, haddr_t addr, size_t size);
+static int     H5FD__iouring_sync_io(int fd, void *rbuf, const void *wbuf, size_t size, haddr_t addr);
+
+static const H5FD_class_t H5FD_iouring_g = {
+    "iouring",                   /* name                 */
+    MAXADDR,                     /* maxaddr              */
+    H5F_CLOSE_WEAK,              /* fc_degree            */
+    H5FD__iouring_term,          /* terminate            */
+    NULL,                        /* sb_size              */
+    NULL,                        /* sb_encode            */
+    NULL,                        /* sb_decode            */
+    sizeof(H5FD_iouring_fapl_t), /* fapl_size            */
+    H5FD__iouring_fapl_get,      /* fapl_get             */
+    H5FD__iouring_fapl_copy,     /* fapl_copy            */
+    NULL,                        /* fapl_free            */
+    0,                           /* dxpl_size            */
+    NULL,                        /* dxpl_copy            */
+    NULL,                        /* dxpl_free            */
+    H5FD__iouring_open,          /* open                 */
+    H5FD__iouring_close,         /* close                */
+    H5FD__iouring_cmp,           /* cmp                  */
+    H5FD__iouring_query,         /* query                */
+    NULL,                        /* get_type_map         */
+    NULL,                        /* alloc                */
+    NULL,                        /* free                 */
+    H5FD__iouring_get_eoa,       /* get_eoa              */
+    H5FD__iouring_set_eoa,       /* set_eoa              */
+    H5FD__iouring_get_eof,       /* get_eof              */
+    H5FD__iouring_get_handle,    /* get_handle           */
+    H5FD__iouring_read,          /* read                 */
+    H5FD__iouring_write,         /* write                */
+    H5FD__iouring_flush,         /* flush                */
+    H5FD__iouring_truncate,      /* truncate             */
+    H5FD__iouring_lock,          /* lock                 */
+    H5FD__iouring_unlock,        /* unlock               */
+    H5FD_FLMAP_DICHOTOMY         /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_iouring_t struct */
+H5FL_DEFINE_STATIC(H5FD_iouring_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    char * lock_env_var = NULL; /* Environment variable pointer */
+    herr_t ret_value    = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Check the use disabled file locks environment variable */
+    lock_env_var = HDgetenv("HDF5_USE_FILE_LOCKING");
+    if (lock_env_var && !HDstrcmp(lock_env_var, "BEST_EFFORT"))
+        ignore_disabled_file_locks_s = TRUE; /* Override: Ignore disabled locks */
+    else if (lock_env_var && (!HDstrcmp(lock_env_var, "TRUE") || !HDstrcmp(lock_env_var, "1")))
+        ignore_disabled_file_locks_s = FALSE; /* Override: Don't ignore disabled locks */
+    else
+        ignore_disabled_file_locks_s = FAIL; /* Environment variable not set, or not set correctly */
+
+    if (H5FD_iouring_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize io_uring VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_iouring_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if (H5I_VFL != H5I_get_type(H5FD_IOURING_g))
+        H5FD_IOURING_g = H5FD_register(&H5FD_iouring_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_IOURING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__iouring_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_term(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Reset VFL ID */
+    H5FD_IOURING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_iouring
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_IOURING driver defined in this source file.  If FA is
+ *              NULL, the default queue depth and I/O size are used and
+ *              O_DIRECT is not.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_iouring(hid_t fapl_id, const H5FD_iouring_fapl_t *fa)
+{
+    H5P_genplist_t *    plist;               /* Property list pointer */
+    H5FD_iouring_fapl_t default_fa;          /* Configuration used when FA is NULL */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*x", fapl_id, fa);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    if (NULL == fa) {
+        default_fa.version     = H5FD_CURR_IOURING_FAPL_T_VERSION;
+        default_fa.queue_depth = H5FD_IOURING_DEFAULT_QUEUE_DEPTH;
+        default_fa.io_size     = H5FD_IOURING_DEFAULT_IO_SIZE;
+        default_fa.direct_io   = FALSE;
+        default_fa.alignment   = H5FD_IOURING_DEFAULT_ALIGNMENT;
+        fa                     = &default_fa;
+    } /* end if */
+    else {
+        if (H5FD_CURR_IOURING_FAPL_T_VERSION != fa->version)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown io_uring fapl version")
+        if (0 == fa->queue_depth || fa->queue_depth > H5FD_IOURING_MAX_QUEUE_DEPTH)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "queue depth out of range")
+        if (0 == fa->io_size || fa->io_size > H5_POSIX_MAX_IO_BYTES)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "I/O size out of range")
+        if (fa->direct_io && (0 == fa->alignment || 0 != (fa->alignment & (fa->alignment - 1))))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "alignment must be a power of two")
+    } /* end else */
+
+    ret_value = H5P_set_driver(plist, H5FD_IOURING, fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_iouring
+ *
+ * Purpose:     Returns the io_uring driver configuration of a file access
+ *              property list that uses the io_uring driver.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_iouring(hid_t fapl_id, H5FD_iouring_fapl_t *fa_out /*out*/)
+{
+    H5P_genplist_t *           plist; /* Property list pointer */
+    const H5FD_iouring_fapl_t *fa;
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, fa_out);
+
+    if (NULL == fa_out)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "fa_out is NULL")
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_IOURING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    H5MM_memcpy(fa_out, fa, sizeof(H5FD_iouring_fapl_t));
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_get
+ *
+ * Purpose:     Returns a copy of the file access properties the file was
+ *              opened with.
+ *
+ * Return:      Success:    Ptr to new file access properties
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_get(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    void *          ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__iouring_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_copy
+ *
+ * Purpose:     Copies the io_uring-specific file access properties.
+ *
+ * Return:      Success:    Ptr to new file access properties
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_copy(const void *_old_fa)
+{
+    const H5FD_iouring_fapl_t *old_fa = (const H5FD_iouring_fapl_t *)_old_fa;
+    H5FD_iouring_fapl_t *      new_fa = NULL;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (NULL != (new_fa = (H5FD_iouring_fapl_t *)H5MM_malloc(sizeof(H5FD_iouring_fapl_t))))
+        H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_iouring_fapl_t));
+
+    FUNC_LEAVE_NOAPI(new_fa)
+} /* end H5FD__iouring_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_create
+ *
+ * Purpose:     Creates the io_uring instance of a file, maps its queues
+ *              and allocates (and if possible registers) the staging
+ *              buffers of the queue slots.
+ *
+ *              If the kernel does not support io_uring, the ring's file
+ *              descriptor is left at -1 and the file uses synchronous
+ *              I/O; this is not an error.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_ring_create(H5FD_iouring_t *file)
+{
+    H5FD_iouring_ring_t *  ring = &file->ring;
+    struct io_uring_params params;
+    struct iovec *         iovs = NULL; /* Staging buffers to register */
+    unsigned               depth;       /* # of queue slots */
+    size_t                 buf_align;   /* Alignment of the staging buffers */
+    void *                 map;
+    unsigned               u;
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(-1 == ring->fd);
+
+    depth = file->fa.queue_depth;
+
+    /* Create the ring.  Failure means io_uring is not available. */
+    HDmemset(&params, 0, sizeof(params));
+    if ((ring->fd = (int)syscall(__NR_io_uring_setup, depth, &params)) < 0) {
+        ring->fd = -1;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    HDassert(params.sq_entries >= depth);
+
+    /* Map the submission queue, the completion queue and the array of
+     * submission queue entries
+     */
+    ring->sq_map_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    map = HDmmap(NULL, ring->sq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                 (HDoff_t)IORING_OFF_SQ_RING);
+    if (MAP_FAILED == map)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to map io_uring submission queue")
+    ring->sq_map = map;
+
+    ring->cq_map_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    map = HDmmap(NULL, ring->cq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                 (HDoff_t)IORING_OFF_CQ_RING);
+    if (MAP_FAILED == map)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to map io_uring completion queue")
+    ring->cq_map = map;
+
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    map = HDmmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                 (HDoff_t)IORING_OFF_SQES);
+    if (MAP_FAILED == map)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to map io_uring submission entries")
+    ring->sqes = (struct io_uring_sqe *)map;
+
+    ring->sq_tail       = (unsigned *)((unsigned char *)ring->sq_map + params.sq_off.tail);
+    ring->sq_array      = (unsigned *)((unsigned char *)ring->sq_map + params.sq_off.array);
+    ring->sq_mask       = *(unsigned *)((unsigned char *)ring->sq_map + params.sq_off.ring_mask);
+    ring->sq_tail_local = *ring->sq_tail;
+    ring->cq_head       = (unsigned *)((unsigned char *)ring->cq_map + params.cq_off.head);
+    ring->cq_tail       = (unsigned *)((unsigned char *)ring->cq_map + params.cq_off.tail);
+    ring->cq_mask       = *(unsigned *)((unsigned char *)ring->cq_map + params.cq_off.ring_mask);
+    ring->cqes          = (struct io_uring_cqe *)((unsigned char *)ring->cq_map + params.cq_off.cqes);
+
+    /* Allocate the queue slots and their staging buffers.  O_DIRECT reads
+     * widen a piece to the alignment on both ends.
+     */
+    buf_align      = file->direct_fd >= 0 ? file->fa.alignment : (size_t)H5FD_IOURING_DEFAULT_ALIGNMENT;
+    file->buf_size = file->fa.io_size;
+    if (file->direct_fd >= 0)
+        file->buf_size += 2 * file->fa.alignment;
+    file->buf_size = (file->buf_size + buf_align - 1) & ~(buf_align - 1);
+    if (HDposix_memalign((void **)&file->bufs, buf_align, depth * file->buf_size) != 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate staging buffers")
+    if (NULL == (file->slots = (H5FD_iouring_slot_t *)H5MM_calloc(depth * sizeof(H5FD_iouring_slot_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate queue slots")
+    if (NULL == (file->free_slots = (unsigned *)H5MM_malloc(depth * sizeof(unsigned))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate queue slot list")
+    if (NULL == (iovs = (struct iovec *)H5MM_malloc(depth * sizeof(struct iovec))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate staging buffer list")
+    for (u = 0; u < depth; u++) {
+        file->slots[u].buf      = file->bufs + (size_t)u * file->buf_size;
+        file->free_slots[u]     = depth - u - 1;
+        iovs[u].iov_base        = file->slots[u].buf;
+        iovs[u].iov_len         = file->buf_size;
+    } /* end for */
+    file->nfree = depth;
+    file->batch = MAX(1, depth / 4);
+
+    /* Register the staging buffers with the kernel, which saves mapping
+     * them for every request.  This may fail (e.g. because of the locked
+     * memory limit), in which case they are used as ordinary buffers.
+     */
+    file->fixed_bufs = (syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_BUFFERS, iovs, depth) == 0);
+
+done:
+    H5MM_xfree(iovs);
+    if (ret_value < 0)
+        H5FD__iouring_ring_destroy(file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_ring_create() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_destroy
+ *
+ * Purpose:     Releases the io_uring instance of a file and the queue
+ *              slots.  No I/O may be in flight.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_ring_destroy(H5FD_iouring_t *file)
+{
+    H5FD_iouring_ring_t *ring = &file->ring;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (ring->sqes)
+        HDmunmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_map)
+        HDmunmap(ring->cq_map, ring->cq_map_size);
+    if (ring->sq_map)
+        HDmunmap(ring->sq_map, ring->sq_map_size);
+    if (ring->fd >= 0)
+        HDclose(ring->fd);
+    HDmemset(ring, 0, sizeof(H5FD_iouring_ring_t));
+    ring->fd = -1;
+
+    if (file->bufs)
+        HDfree(file->bufs);
+    file->bufs       = NULL;
+    file->slots      = (H5FD_iouring_slot_t *)H5MM_xfree(file->slots);
+    file->free_slots = (unsigned *)H5MM_xfree(file->free_slots);
+    file->nfree      = 0;
+    file->fixed_bufs = FALSE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_ring_destroy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_queue
+ *
+ * Purpose:     Fills in a submission queue entry for the I/O described by
+ *              queue slot IDX.  The entry is handed to the kernel by the
+ *              next H5FD__iouring_submit().
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_queue(H5FD_iouring_t *file, unsigned idx)
+{
+    H5FD_iouring_ring_t *ring = &file->ring;
+    H5FD_iouring_slot_t *slot = &file->slots[idx];
+    struct io_uring_sqe *sqe;
+    unsigned             index;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    index = ring->sq_tail_local & ring->sq_mask;
+    sqe   = &ring->sqes[index];
+    HDmemset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->fd        = slot->fd;
+    sqe->off       = (uint64_t)slot->addr;
+    sqe->user_data = (uint64_t)idx;
+    if (slot->staged && file->fixed_bufs) {
+        sqe->opcode    = (uint8_t)(slot->is_write ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED);
+        sqe->addr      = (uint64_t)(uintptr_t)slot->iov.iov_base;
+        sqe->len       = (uint32_t)slot->iov.iov_len;
+        sqe->buf_index = (uint16_t)idx;
+    } /* end if */
+    else {
+        sqe->opcode = (uint8_t)(slot->is_write ? IORING_OP_WRITEV : IORING_OP_READV);
+        sqe->addr   = (uint64_t)(uintptr_t)&slot->iov;
+        sqe->len    = 1;
+    } /* end else */
+    ring->sq_array[index] = index;
+
+    ring->sq_tail_local++;
+    ring->to_submit++;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_queue() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_submit
+ *
+ * Purpose:     Hands all queued submission entries to the kernel and, if
+ *              MIN_COMPLETE is positive, waits until at least that many
+ *              completions are available.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_submit(H5FD_iouring_t *file, unsigned min_complete)
+{
+    H5FD_iouring_ring_t *ring = &file->ring;
+    unsigned             enter_flags = min_complete > 0 ? IORING_ENTER_GETEVENTS : 0;
+    long                 nsubmitted;
+    herr_t               ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (0 == ring->to_submit && 0 == min_complete)
+        HGOTO_DONE(SUCCEED)
+
+    /* Publish the new entries before the kernel looks at the tail */
+    __atomic_store_n(ring->sq_tail, ring->sq_tail_local, __ATOMIC_RELEASE);
+
+    do {
+        nsubmitted =
+            syscall(__NR_io_uring_enter, ring->fd, ring->to_submit, min_complete, enter_flags, NULL, 0);
+    } while (nsubmitted < 0 && EINTR == errno);
+    if (nsubmitted < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTINIT, FAIL, "unable to submit I/O to io_uring")
+
+    HDassert((unsigned)nsubmitted <= ring->to_submit);
+    ring->to_submit -= (unsigned)nsubmitted;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_submit() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_sync_io
+ *
+ * Purpose:     Synchronously reads SIZE bytes at file offset ADDR into
+ *              RBUF or, if RBUF is NULL, writes them from WBUF, being
+ *              careful of interrupted system calls and partial results.
+ *              Reads past the end of the file return zeros.
+ *
+ * Return:      0 on success, otherwise an errno value
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__iouring_sync_io(int fd, void *rbuf, const void *wbuf, size_t size, haddr_t addr)
+{
+    HDoff_t offset    = (HDoff_t)addr;
+    int     ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    while (size > 0) {
+        h5_posix_io_t     bytes_in  = 0;  /* # of bytes to transfer */
+        h5_posix_io_ret_t bytes_out = -1; /* # of bytes transferred */
+
+        /* Trying to transfer more bytes than the return type can handle is
+         * undefined behavior in POSIX.
+         */
+        if (size > H5_POSIX_MAX_IO_BYTES)
+            bytes_in = H5_POSIX_MAX_IO_BYTES;
+        else
+            bytes_in = (h5_posix_io_t)size;
+
+        do {
+            if (rbuf)
+                bytes_out = HDpread(fd, rbuf, bytes_in, offset);
+            else
+                bytes_out = HDpwrite(fd, wbuf, bytes_in, offset);
+        } while (-1 == bytes_out && EINTR == errno);
+
+        if (-1 == bytes_out)
+            HGOTO_DONE(errno)
+        if (0 == bytes_out) {
+            if (!rbuf)
+                HGOTO_DONE(EIO)
+
+            /* End of file but not end of format address space */
+            HDmemset(rbuf, 0, size);
+            break;
+        } /* end if */
+
+        HDassert((size_t)bytes_out <= size);
+
+        size -= (size_t)bytes_out;
+        offset += bytes_out;
+        if (rbuf)
+            rbuf = (unsigned char *)rbuf + bytes_out;
+        else
+            wbuf = (const unsigned char *)wbuf + bytes_out;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_sync_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_complete
+ *
+ * Purpose:     Finishes the I/O of queue slot IDX, whose completion result
+ *              is RES, and returns the slot to the free list.
+ *
+ *              Short transfers are finished synchronously through the
+ *              buffered descriptor, which also zero-fills reads past the
+ *              end of the file.  Errors are recorded in the file and
+ *              reported by the caller that waits for the I/O.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_complete(H5FD_iouring_t *file, unsigned idx, int res)
+{
+    H5FD_iouring_slot_t *slot = &file->slots[idx];
+    size_t               len  = slot->iov.iov_len;
+    int                  err  = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (res < 0)
+        err = -res;
+    else if ((size_t)res < len) {
+        unsigned char *rest = (unsigned char *)slot->iov.iov_base + res;
+
+        err = H5FD__iouring_sync_io(file->fd, slot->is_write ? NULL : rest, rest, len - (size_t)res,
+                                    slot->addr + (haddr_t)res);
+    } /* end if */
+
+    if (slot->is_write) {
+        if (err && 0 == file->write_errno) {
+            file->write_errno    = err;
+            file->write_err_addr = slot->addr;
+        } /* end if */
+        file->nwrites--;
+    } /* end if */
+    else {
+        if (err && 0 == file->read_errno)
+            file->read_errno = err;
+        else if (!err && slot->dest)
+            H5MM_memcpy(slot->dest, slot->buf + slot->skip, slot->dest_len);
+        file->nreads--;
+    } /* end else */
+
+    slot->in_use                    = FALSE;
+    file->free_slots[file->nfree++] = idx;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_complete() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_wait
+ *
+ * Purpose:     Submits the queued I/O, waits until at least one request
+ *              completes and processes all available completions.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_wait(H5FD_iouring_t *file)
+{
+    H5FD_iouring_ring_t *ring = &file->ring;
+    unsigned             head, tail;
+    herr_t               ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file->nfree < file->fa.queue_depth);
+
+    if (H5FD__iouring_submit(file, 1) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTINIT, FAIL, "unable to wait for io_uring completions")
+
+    head = *ring->cq_head;
+    tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+    while (head != tail) {
+        struct io_uring_cqe *cqe = &ring->cqes[head & ring->cq_mask];
+        unsigned             idx = (unsigned)cqe->user_data;
+        int                  res = cqe->res;
+
+        /* Release the completion queue entry before acting on it */
+        head++;
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+
+        HDassert(idx < file->fa.queue_depth);
+        H5FD__iouring_complete(file, idx, res);
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_wait() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_drain
+ *
+ * Purpose:     Waits for all queued and in-flight I/O of a file, then
+ *              reports (and clears) the first error of a background write.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_drain(H5FD_iouring_t *file)
+{
+    int    err;
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (file->ring.fd >= 0)
+        while (file->nfree < file->fa.queue_depth)
+            if (H5FD__iouring_wait(file) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTINIT, FAIL, "unable to complete queued I/O")
+
+    if (0 != (err = file->write_errno)) {
+        file->write_errno = 0;
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL,
+                    "queued file write failed: filename = '%s', errno = %d, error message = '%s', "
+                    "offset = %llu",
+                    file->filename, err, HDstrerror(err), (unsigned long long)file->write_err_addr)
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_drain() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_slot
+ *
+ * Purpose:     Returns in *IDX an unused queue slot, waiting for queued
+ *              I/O to complete if all slots are in use.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_get_slot(H5FD_iouring_t *file, unsigned *idx)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    while (0 == file->nfree)
+        if (H5FD__iouring_wait(file) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTINIT, FAIL, "unable to wait for a free queue slot")
+
+    *idx                     = file->free_slots[--file->nfree];
+    file->slots[*idx].in_use = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_get_slot() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write_pending
+ *
+ * Purpose:     Checks whether a queued or in-flight write touches the SIZE
+ *              bytes at ADDR.  The kernel may execute queued requests in
+ *              any order, so such a write must finish before the region
+ *              is read or written again.
+ *
+ *              When O_DIRECT is in use, the regions are compared at the
+ *              granularity of 'guard', so that buffered and direct writes
+ *              never touch the same page at once.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5FD__iouring_write_pending(const H5FD_iouring_t *file, haddr_t addr, size_t size)
+{
+    haddr_t  start = addr & ~(haddr_t)(file->guard - 1);
+    haddr_t  end   = (addr + size + file->guard - 1) & ~(haddr_t)(file->guard - 1);
+    unsigned u;
+    hbool_t  ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (0 == file->nwrites)
+        HGOTO_DONE(FALSE)
+
+    for (u = 0; u < file->fa.queue_depth; u++) {
+        const H5FD_iouring_slot_t *slot = &file->slots[u];
+
+        if (slot->in_use && slot->is_write && slot->addr < end && start < slot->addr + slot->iov.iov_len)
+            HGOTO_DONE(TRUE)
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write_pending() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file and sets up its
+ *              io_uring instance.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_iouring_t *           file = NULL; /* io_uring VFD info        */
+    int                        fd   = -1;   /* File descriptor          */
+    int                        o_flags;     /* Flags for open() call    */
+    h5_stat_t                  sb;
+    H5P_genplist_t *           plist;            /* Property list pointer */
+    const H5FD_iouring_fapl_t *fa;               /* Driver properties     */
+    H5FD_t *                   ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if (H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if (H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if (H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+
+    /* Open the file */
+    if ((fd = HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(
+            H5E_FILE, H5E_CANTOPENFILE, NULL,
+            "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x",
+            name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+
+    if (HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_iouring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->fd        = fd;
+    file->direct_fd = -1;
+    file->ring.fd   = -1;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->device = sb.st_dev;
+    file->inode  = sb.st_ino;
+
+    /* Get the FAPL */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_VFL, H5E_BADTYPE, NULL, "not a file access property list")
+    if (NULL != (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        H5MM_memcpy(&file->fa, fa, sizeof(H5FD_iouring_fapl_t));
+    else {
+        file->fa.version     = H5FD_CURR_IOURING_FAPL_T_VERSION;
+        file->fa.queue_depth = H5FD_IOURING_DEFAULT_QUEUE_DEPTH;
+        file->fa.io_size     = H5FD_IOURING_DEFAULT_IO_SIZE;
+        file->fa.direct_io   = FALSE;
+        file->fa.alignment   = H5FD_IOURING_DEFAULT_ALIGNMENT;
+    } /* end else */
+
+    /* Check the file locking flags in the fapl */
+    if (ignore_disabled_file_locks_s != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = ignore_disabled_file_locks_s;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property")
+    }
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+#ifdef O_DIRECT
+    /* Open a second descriptor for aligned I/O that bypasses the page
+     * cache.  File systems without O_DIRECT support just use buffered I/O.
+     */
+    if (file->fa.direct_io)
+        file->direct_fd = HDopen(name, (o_flags & ~(O_CREAT | O_TRUNC | O_EXCL)) | O_DIRECT);
+#endif /* O_DIRECT */
+    file->guard = 1;
+    if (file->direct_fd >= 0)
+        file->guard = MAX(file->fa.alignment, (size_t)HDsysconf(_SC_PAGESIZE));
+
+    /* Set up the ring */
+    if (H5FD__iouring_ring_create(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTOPENFILE, NULL, "unable to set up io_uring")
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (NULL == ret_value) {
+        if (fd >= 0)
+            HDclose(fd);
+        if (file) {
+            if (file->direct_fd >= 0)
+                HDclose(file->direct_fd);
+            file = H5FL_FREE(H5FD_iouring_t, file);
+        } /* end if */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_close
+ *
+ * Purpose:     Completes all queued I/O and closes an HDF5 file.  The file
+ *              is closed even if a queued write failed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_close(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Complete the writes still in flight */
+    if (H5FD__iouring_drain(file) < 0)
+        HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to complete queued I/O")
+
+    /* Release the ring */
+    H5FD__iouring_ring_destroy(file);
+
+    /* Close the underlying file */
+    if (file->direct_fd >= 0 && HDclose(file->direct_fd) < 0)
+        HSYS_DONE_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+    if (HDclose(file->fd) < 0)
+        HSYS_DONE_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_iouring_t, file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_iouring_t *f1        = (const H5FD_iouring_t *)_f1;
+    const H5FD_iouring_t *f2        = (const H5FD_iouring_t *)_f2;
+    int                   ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1)
+    if (f1->device > f2->device)
+        HGOTO_DONE(1)
+#else  /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) < 0)
+        HGOTO_DONE(-1)
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) > 0)
+        HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1)
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ *              SWMR is not supported: queued writes may reach the file in
+ *              any order, so a concurrent reader could observe metadata
+ *              before the data it refers to.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
+        *flags |= H5FD_FEAT_DATA_SIEVE; /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE; /* get_handle callback returns a POSIX file descriptor */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
+                                                       VFD      */
+    }                                               /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__iouring_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the size of the
+ *              filesystem file once all queued writes have completed.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              filesystem file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__iouring_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_handle
+ *
+ * Purpose:     Returns the file descriptor of the io_uring file driver,
+ *              after completing all queued writes so that the descriptor
+ *              reflects them.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    if (H5FD__iouring_drain(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to complete queued I/O")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF.  The request is split into pieces of at
+ *              most 'io_size' bytes, which are submitted together, and the
+ *              call returns when all of them have completed.  Bytes past
+ *              the end of the file are returned as zeros.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                   haddr_t addr, size_t size, void *buf /*out*/)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    int             err;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    /* Synchronous I/O when io_uring is not available */
+    if (file->ring.fd < 0) {
+        if (0 != (err = H5FD__iouring_sync_io(file->fd, buf, NULL, size, addr)))
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                        "file read failed: filename = '%s', errno = %d, error message = '%s', size = %llu, "
+                        "offset = %llu",
+                        file->filename, err, HDstrerror(err), (unsigned long long)size,
+                        (unsigned long long)addr)
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Writes to the region must reach the file first */
+    if (H5FD__iouring_write_pending(file, addr, size))
+        if (H5FD__iouring_drain(file) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to complete queued writes")
+
+    /* Queue the pieces of the read */
+    HDassert(0 == file->nreads);
+    file->read_errno = 0;
+    while (size > 0) {
+        H5FD_iouring_slot_t *slot;
+        size_t               piece = MIN(size, file->fa.io_size);
+        unsigned             idx;
+
+        if (H5FD__iouring_get_slot(file, &idx) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to get a queue slot")
+        slot = &file->slots[idx];
+
+        slot->is_write = FALSE;
+        if (file->direct_fd >= 0) {
+            /* Read the aligned window around the piece into the staging
+             * buffer, then copy the piece out of it
+             */
+            haddr_t mask  = (haddr_t)(file->fa.alignment - 1);
+            haddr_t start = addr & ~mask;
+            haddr_t end   = (addr + piece + mask) & ~mask;
+
+            slot->staged       = TRUE;
+            slot->fd           = file->direct_fd;
+            slot->addr         = start;
+            slot->iov.iov_base = slot->buf;
+            slot->iov.iov_len  = (size_t)(end - start);
+            slot->dest         = (unsigned char *)buf;
+            slot->skip         = (size_t)(addr - start);
+            slot->dest_len     = piece;
+            HDassert(slot->iov.iov_len <= file->buf_size);
+        } /* end if */
+        else {
+            slot->staged       = FALSE;
+            slot->fd           = file->fd;
+            slot->addr         = addr;
+            slot->iov.iov_base = buf;
+            slot->iov.iov_len  = piece;
+            slot->dest         = NULL;
+        } /* end else */
+
+        H5FD__iouring_queue(file, idx);
+        file->nreads++;
+
+        size -= piece;
+        addr += piece;
+        buf = (unsigned char *)buf + piece;
+    } /* end while */
+
+    /* Submit the pieces and wait for all of them */
+    while (file->nreads > 0)
+        if (H5FD__iouring_wait(file) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to complete queued reads")
+
+    if (0 != (err = file->read_errno))
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                    "file read failed: filename = '%s', errno = %d, error message = '%s'", file->filename,
+                    err, HDstrerror(err))
+
+    /* Report a failed background write, too */
+    if (0 != file->write_errno && H5FD__iouring_drain(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to complete queued writes")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF.  The data is copied into the staging
+ *              buffers of free queue slots in pieces of at most 'io_size'
+ *              bytes and the call returns once all pieces are queued.
+ *              Queued writes are submitted in batches.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                    haddr_t addr, size_t size, const void *buf)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    int             err;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                    (unsigned long long)addr, (unsigned long long)size)
+
+    /* Report a failed background write before accepting more */
+    if (0 != file->write_errno && H5FD__iouring_drain(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to complete queued writes")
+
+    /* Synchronous I/O when io_uring is not available */
+    if (file->ring.fd < 0) {
+        if (0 != (err = H5FD__iouring_sync_io(file->fd, NULL, buf, size, addr)))
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL,
+                        "file write failed: filename = '%s', errno = %d, error message = '%s', "
+                        "size = %llu, offset = %llu",
+                        file->filename, err, HDstrerror(err), (unsigned long long)size,
+                        (unsigned long long)addr)
+        addr += size;
+        size = 0;
+    } /* end if */
+
+    while (size > 0) {
+        H5FD_iouring_slot_t *slot;
+        size_t               piece = MIN(size, file->fa.io_size);
+        unsigned             idx;
+
+        /* Queued writes may complete in any order */
+        if (H5FD__iouring_write_pending(file, addr, piece))
+            if (H5FD__iouring_drain(file) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to complete queued writes")
+
+        if (H5FD__iouring_get_slot(file, &idx) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to get a queue slot")
+        slot = &file->slots[idx];
+
+        H5MM_memcpy(slot->buf, buf, piece);
+        slot->is_write     = TRUE;
+        slot->staged       = TRUE;
+        slot->addr         = addr;
+        slot->iov.iov_base = slot->buf;
+        slot->iov.iov_len  = piece;
+        slot->dest         = NULL;
+
+        /* Aligned pieces bypass the page cache */
+        slot->fd = file->fd;
+        if (file->direct_fd >= 0 && 0 == (addr & (haddr_t)(file->fa.alignment - 1)) &&
+            0 == (piece & (file->fa.alignment - 1)))
+            slot->fd = file->direct_fd;
+
+        H5FD__iouring_queue(file, idx);
+        file->nwrites++;
+
+        if (file->ring.to_submit >= file->batch)
+            if (H5FD__iouring_submit(file, 0) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to submit queued writes")
+
+        size -= piece;
+        addr += piece;
+        buf = (const unsigned char *)buf + piece;
+    } /* end while */
+
+    /* Update eof */
+    if (addr > file->eof)
+        file->eof = addr;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_flush
+ *
+ * Purpose:     Completes all queued writes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (H5FD__iouring_drain(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to complete queued writes")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same as the
+ *              end-of-address, after completing all queued writes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (H5FD__iouring_drain(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to complete queued writes")
+
+    /* Extend the file to make sure it's large enough */
+    if (!H5F_addr_eq(file->eoa, file->eof)) {
+        if (-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    int             lock_flags;                     /* file locking flags       */
+    herr_t          ret_value = SUCCEED;            /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if (HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_unlock(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    herr_t          ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (HDflock(file->fd, LOCK_UN) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_unlock() */
+
+#endif /* H5_HAVE_IOURING_VFD */
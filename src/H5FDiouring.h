@@ -0,0 +1,95 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the Linux io_uring driver.
+ */
+#ifndef H5FDiouring_H
+#define H5FDiouring_H
+
+#ifdef H5_HAVE_IOURING_VFD
+#define H5FD_IOURING (H5FD_iouring_init())
+#else
+#define H5FD_IOURING (H5I_INVALID_HID)
+#endif /* H5_HAVE_IOURING_VFD */
+
+#ifdef H5_HAVE_IOURING_VFD
+
+/****************************************************************************
+ *
+ * Structure: H5FD_iouring_fapl_t
+ *
+ * Purpose:
+ *
+ *     Configuration of the io_uring VFD, passed to H5Pset_fapl_iouring()
+ *     and returned by H5Pget_fapl_iouring().
+ *
+ * `version` (int32_t)
+ *
+ *     Version number of the structure.  This field should be set to
+ *     H5FD_CURR_IOURING_FAPL_T_VERSION.
+ *
+ * `queue_depth` (unsigned)
+ *
+ *     Maximum number of reads and writes the driver keeps in flight at
+ *     once.  This is also the size of the submission queue of the ring.
+ *
+ * `io_size` (size_t)
+ *
+ *     Requests larger than this are split into pieces of at most this
+ *     many bytes, which are submitted together.  Each queue slot also owns
+ *     a buffer of this size, into which write data is copied so that
+ *     writes can complete after H5FDwrite returns.
+ *
+ * `direct_io` (hbool_t)
+ *
+ *     If TRUE, the file is also opened with O_DIRECT, and pieces whose
+ *     file offset and length are multiples of `alignment` bypass the
+ *     operating system's page cache.  Other pieces use buffered I/O.  If
+ *     the file system does not support O_DIRECT, all I/O is buffered.
+ *
+ * `alignment` (size_t)
+ *
+ *     Required alignment of O_DIRECT file offsets, lengths and memory
+ *     buffers.  Must be a power of two.  Ignored if `direct_io` is FALSE.
+ *
+ ****************************************************************************/
+
+#define H5FD_CURR_IOURING_FAPL_T_VERSION 1
+
+#define H5FD_IOURING_DEFAULT_QUEUE_DEPTH 32
+#define H5FD_IOURING_DEFAULT_IO_SIZE     (64 * 1024)
+#define H5FD_IOURING_DEFAULT_ALIGNMENT   4096
+
+typedef struct H5FD_iouring_fapl_t {
+    int32_t  version;
+    unsigned queue_depth;
+    size_t   io_size;
+    hbool_t  direct_io;
+    size_t   alignment;
+} H5FD_iouring_fapl_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+H5_DLL hid_t  H5FD_iouring_init(void);
+H5_DLL herr_t H5Pset_fapl_iouring(hid_t fapl_id, const H5FD_iouring_fapl_t *fa);
+H5_DLL herr_t H5Pget_fapl_iouring(hid_t fapl_id, H5FD_iouring_fapl_t *fa_out /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_IOURING_VFD */
+
+#endif
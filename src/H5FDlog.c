@@ -36,6 +36,14 @@
 #include "H5MMprivate.h" /* Memory management    */
 #include "H5Pprivate.h"  /* Property lists       */
 
+/* Default number of records buffered in memory in binary mode */
+#define H5FD_LOG_BINARY_NRECORDS 4096
+
+/* The flags that are meaningful in binary mode */
+#define H5FD_LOG_BINARY_FLAGS                                                                                \
+    (H5FD_LOG_BINARY | H5FD_LOG_LOC_READ | H5FD_LOG_LOC_WRITE | H5FD_LOG_TRUNCATE | H5FD_LOG_ALLOC |         \
+     H5FD_LOG_FREE)
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_LOG_g = 0;
 
@@ -132,6 +140,15 @@ typedef struct H5FD_log_t {
     size_t             iosize;              /* Size of I/O information buffers                  */
     FILE *             logfp;               /* Log file pointer                                 */
     H5FD_log_fapl_t    fa;                  /* Driver-specific file access properties           */
+
+    /* Fields for binary logging.  In binary mode 'fa.flags' is just
+     * H5FD_LOG_BINARY, so that none of the text logging above is done, and
+     * the flags that select the recorded operations are kept here.
+     */
+    unsigned long long binary_flags; /* Flags from the FAPL, when in binary mode (0 otherwise) */
+    uint8_t *          records;      /* Buffer of encoded binary log records                 */
+    size_t             nrecords;     /* Number of records in the buffer                      */
+    size_t             max_records;  /* Capacity of the buffer, in records                   */
 } H5FD_log_t;
 
 /*
@@ -177,6 +194,9 @@ static herr_t  H5FD__log_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, ha
 static herr_t  H5FD__log_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__log_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__log_unlock(H5FD_t *_file);
+static herr_t  H5FD__log_binary_flush(H5FD_log_t *file);
+static herr_t  H5FD__log_binary_record(H5FD_log_t *file, unsigned op, H5FD_mem_t type, haddr_t addr,
+                                       hsize_t size, uint64_t start, uint64_t end, hbool_t failed);
 
 static const H5FD_class_t H5FD_log_g = {
     "log",                   /* name			*/
@@ -378,6 +398,10 @@ H5FD__log_fapl_get(H5FD_t *_file)
     /* Set return value */
     ret_value = H5FD__log_fapl_copy(&(file->fa));
 
+    /* Return the flags that were set, when in binary mode */
+    if (ret_value && file->binary_flags)
+        ((H5FD_log_fapl_t *)ret_value)->flags = file->binary_flags;
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__log_fapl_get() */
 
@@ -484,8 +508,9 @@ H5FD__log_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
 #ifdef H5_HAVE_WIN32_API
     struct _BY_HANDLE_FILE_INFORMATION fileinfo;
 #endif
-    H5_timer_t open_timer; /* Timer for open() call */
-    H5_timer_t stat_timer; /* Timer for stat() call */
+    H5_timer_t open_timer;     /* Timer for open() call */
+    H5_timer_t stat_timer;     /* Timer for stat() call */
+    uint64_t   open_start = 0; /* Start time of the open, for binary logging */
     h5_stat_t  sb;
     H5FD_t *   ret_value = NULL; /* Return value */
 
@@ -518,6 +543,8 @@ H5FD__log_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
         HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, NULL, "bad VFL driver info")
 
     /* Start timer for open() call */
+    if (fa->flags & H5FD_LOG_BINARY)
+        open_start = H5_now_usec();
     if (fa->flags & H5FD_LOG_TIME_OPEN) {
         H5_timer_init(&open_timer);
         H5_timer_start(&open_timer);
@@ -580,7 +607,12 @@ H5FD__log_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     file->filename[sizeof(file->filename) - 1] = '\0';
 
     /* Get the flags for logging */
-    file->fa.flags = fa->flags;
+    if (fa->flags & H5FD_LOG_BINARY) {
+        file->binary_flags = fa->flags & H5FD_LOG_BINARY_FLAGS;
+        file->fa.flags     = H5FD_LOG_BINARY;
+    } /* end if */
+    else
+        file->fa.flags = fa->flags;
     if (fa->logfile)
         file->fa.logfile = H5MM_strdup(fa->logfile);
     else
@@ -588,7 +620,43 @@ H5FD__log_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     file->fa.buf_size = fa->buf_size;
 
     /* Check if we are doing any logging at all */
-    if (file->fa.flags != 0) {
+    if (file->binary_flags) {
+        uint8_t  header[H5FD_LOG_BINARY_HEADER_SIZE];
+        uint8_t *p;
+
+        if (NULL == fa->logfile)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "binary logging requires a log file name")
+
+        /* Allocate the record buffer, which is all the memory binary logging uses */
+        if (fa->buf_size > 0)
+            file->max_records = MAX(fa->buf_size / H5FD_LOG_BINARY_RECORD_SIZE, 1);
+        else
+            file->max_records = H5FD_LOG_BINARY_NRECORDS;
+        if (NULL == (file->records = (uint8_t *)H5MM_malloc(file->max_records * H5FD_LOG_BINARY_RECORD_SIZE)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate log record buffer")
+
+        /* Open the log file.  Records are buffered here, so leave the stream
+         * unbuffered to avoid copying them twice.
+         */
+        if (NULL == (file->logfp = HDfopen(fa->logfile, "wb")))
+            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open log file")
+        HDsetbuf(file->logfp, NULL);
+
+        /* Write the header */
+        p = header;
+        H5MM_memcpy(p, H5FD_LOG_BINARY_SIGNATURE, (size_t)H5FD_LOG_BINARY_SIGNATURE_LEN);
+        p += H5FD_LOG_BINARY_SIGNATURE_LEN;
+        UINT32ENCODE(p, H5FD_LOG_BINARY_VERSION);
+        UINT32ENCODE(p, H5FD_LOG_BINARY_RECORD_SIZE);
+        if (1 != HDfwrite(header, sizeof(header), 1, file->logfp))
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, NULL, "unable to write log file header")
+
+        /* Record the open, with the size of the file */
+        if (H5FD__log_binary_record(file, H5FD_LOG_OP_OPEN, H5FD_MEM_NOLIST, (haddr_t)0, (hsize_t)file->eof,
+                                    open_start, H5_now_usec(), FALSE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, NULL, "unable to write log record")
+    } /* end if */
+    else if (file->fa.flags != 0) {
         /* Allocate buffers for tracking file accesses and data "flavor" */
         file->iosize = fa->buf_size;
         if (file->fa.flags & H5FD_LOG_FILE_READ) {
@@ -654,9 +722,14 @@ done:
     if (NULL == ret_value) {
         if (fd >= 0)
             HDclose(fd);
-        if (file)
+        if (file) {
+            if (file->logfp && file->logfp != stderr)
+                HDfclose(file->logfp);
+            H5MM_xfree(file->records);
+            H5MM_xfree(file->fa.logfile);
             file = H5FL_FREE(H5FD_log_t, file);
-    } /* end if */
+        } /* end if */
+    }     /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__log_open() */
@@ -679,7 +752,8 @@ H5FD__log_close(H5FD_t *_file)
 {
     H5FD_log_t *file = (H5FD_log_t *)_file;
     H5_timer_t  close_timer;         /* Timer for close() call */
-    herr_t      ret_value = SUCCEED; /* Return value */
+    uint64_t    close_start = 0;     /* Start time of the close, for binary logging */
+    herr_t      ret_value   = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -687,6 +761,8 @@ H5FD__log_close(H5FD_t *_file)
     HDassert(file);
 
     /* Start timer for close() call */
+    if (file->binary_flags)
+        close_start = H5_now_usec();
     if (file->fa.flags & H5FD_LOG_TIME_CLOSE) {
         H5_timer_init(&close_timer);
         H5_timer_start(&close_timer);
@@ -700,8 +776,19 @@ H5FD__log_close(H5FD_t *_file)
     if (file->fa.flags & H5FD_LOG_TIME_CLOSE)
         H5_timer_stop(&close_timer);
 
+    /* Finish the binary log */
+    if (file->binary_flags) {
+        if (H5FD__log_binary_record(file, H5FD_LOG_OP_CLOSE, H5FD_MEM_NOLIST, (haddr_t)0, (hsize_t)file->eof,
+                                    close_start, H5_now_usec(), FALSE) < 0)
+            HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write log record")
+        else if (H5FD__log_binary_flush(file) < 0)
+            HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write log records")
+        file->records = (uint8_t *)H5MM_xfree(file->records);
+        if (EOF == HDfclose(file->logfp))
+            HDONE_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close log file")
+    } /* end if */
     /* Dump I/O information */
-    if (file->fa.flags != 0) {
+    else if (file->fa.flags != 0) {
         haddr_t       addr;
         haddr_t       last_addr;
         unsigned char last_val;
@@ -945,7 +1032,7 @@ H5FD__log_alloc(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, hs
     haddr_t     addr;
     haddr_t     ret_value = HADDR_UNDEF; /* Return value */
 
-    FUNC_ENTER_STATIC_NOERR
+    FUNC_ENTER_STATIC
 
     /* Compute the address for the block to allocate */
     addr = file->eoa;
@@ -953,6 +1040,14 @@ H5FD__log_alloc(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, hs
     /* Extend the end-of-allocated space address */
     file->eoa = addr + size;
 
+    /* Record the allocation in the binary log */
+    if (file->binary_flags & H5FD_LOG_ALLOC) {
+        uint64_t now = H5_now_usec();
+
+        if (H5FD__log_binary_record(file, H5FD_LOG_OP_ALLOC, type, addr, size, now, now, FALSE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, HADDR_UNDEF, "unable to write log record")
+    } /* end if */
+
     /* Retain the (first) flavor of the information written to the file */
     if (file->fa.flags != 0) {
         if (file->fa.flags & H5FD_LOG_FLAVOR) {
@@ -970,6 +1065,7 @@ H5FD__log_alloc(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, hs
     /* Set return value */
     ret_value = addr;
 
+done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__log_alloc() */
 
@@ -988,9 +1084,18 @@ H5FD__log_alloc(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, hs
 static herr_t
 H5FD__log_free(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr, hsize_t size)
 {
-    H5FD_log_t *file = (H5FD_log_t *)_file;
+    H5FD_log_t *file      = (H5FD_log_t *)_file;
+    herr_t      ret_value = SUCCEED; /* Return value */
 
-    FUNC_ENTER_STATIC_NOERR
+    FUNC_ENTER_STATIC
+
+    /* Record the release in the binary log */
+    if (file->binary_flags & H5FD_LOG_FREE) {
+        uint64_t now = H5_now_usec();
+
+        if (H5FD__log_binary_record(file, H5FD_LOG_OP_FREE, type, addr, size, now, now, FALSE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write log record")
+    } /* end if */
 
     if (file->fa.flags != 0) {
         /* Reset the flavor of the information in the file */
@@ -1006,7 +1111,8 @@ H5FD__log_free(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
                       addr, (haddr_t)((addr + size) - 1), size, flavors[type]);
     } /* end if */
 
-    FUNC_LEAVE_NOAPI(SUCCEED)
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__log_free() */
 
 /*-------------------------------------------------------------------------
@@ -1041,7 +1147,7 @@ H5FD__log_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
  *              called shortly after an existing HDF5 file is opened in order
  *              to tell the driver where the end of the HDF5 data is located.
  *
- * Return:      SUCCEED (Can't fail)
+ * Return:      SUCCEED/FAIL
  *
  * Programmer:  Robb Matzke
  *              Thursday, July 29, 1999
@@ -1051,9 +1157,25 @@ H5FD__log_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
 static herr_t
 H5FD__log_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
 {
-    H5FD_log_t *file = (H5FD_log_t *)_file;
+    H5FD_log_t *file      = (H5FD_log_t *)_file;
+    herr_t      ret_value = SUCCEED; /* Return value */
 
-    FUNC_ENTER_STATIC_NOERR
+    FUNC_ENTER_STATIC
+
+    /* Record extensions and shrinks like allocations and frees in the binary log */
+    if (file->binary_flags && H5F_addr_gt(addr, 0) && H5F_addr_ne(addr, file->eoa)) {
+        uint64_t now = H5_now_usec();
+
+        if (H5F_addr_gt(addr, file->eoa) && (file->binary_flags & H5FD_LOG_ALLOC)) {
+            if (H5FD__log_binary_record(file, H5FD_LOG_OP_ALLOC, type, file->eoa, (hsize_t)(addr - file->eoa),
+                                        now, now, FALSE) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write log record")
+        } /* end if */
+        else if (H5F_addr_lt(addr, file->eoa) && (file->binary_flags & H5FD_LOG_FREE))
+            if (H5FD__log_binary_record(file, H5FD_LOG_OP_FREE, type, addr, (hsize_t)(file->eoa - addr), now,
+                                        now, FALSE) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write log record")
+    } /* end if */
 
     if (file->fa.flags != 0) {
         /* Check for increasing file size */
@@ -1095,7 +1217,8 @@ H5FD__log_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
 
     file->eoa = addr;
 
-    FUNC_LEAVE_NOAPI(SUCCEED)
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__log_set_eoa() */
 
 /*-------------------------------------------------------------------------
@@ -1183,14 +1306,19 @@ H5FD__log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
     H5_timer_t    seek_timer; /* Timer for seek operation */
     H5_timevals_t seek_times; /* Elapsed time for seek operation */
 #endif                        /* H5_HAVE_PREADWRITE */
-    HDoff_t offset    = (HDoff_t)addr;
-    herr_t  ret_value = SUCCEED; /* Return value */
+    uint64_t io_start  = 0;      /* Start time of the read, when recorded in the binary log */
+    HDoff_t  offset    = (HDoff_t)addr;
+    herr_t   ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
     HDassert(file && file->pub.cls);
     HDassert(buf);
 
+    /* Note the start time of the read for the binary log */
+    if (file->binary_flags & H5FD_LOG_LOC_READ)
+        io_start = H5_now_usec();
+
     /* Check for overflow conditions */
     if (!H5F_addr_defined(addr))
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
@@ -1367,6 +1495,12 @@ done:
         file->op  = OP_UNKNOWN;
     } /* end if */
 
+    /* Record the read (or failed read) in the binary log */
+    if (io_start > 0)
+        if (H5FD__log_binary_record(file, H5FD_LOG_OP_READ, type, orig_addr, (hsize_t)orig_size, io_start,
+                                    H5_now_usec(), (hbool_t)(ret_value < 0)) < 0)
+            HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write log record")
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__log_read() */
 
@@ -1397,8 +1531,9 @@ H5FD__log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, ha
     H5_timer_t    seek_timer; /* Timer for seek operation */
     H5_timevals_t seek_times; /* Elapsed time for seek operation */
 #endif                        /* H5_HAVE_PREADWRITE */
-    HDoff_t offset    = (HDoff_t)addr;
-    herr_t  ret_value = SUCCEED; /* Return value */
+    uint64_t io_start  = 0;      /* Start time of the write, when recorded in the binary log */
+    HDoff_t  offset    = (HDoff_t)addr;
+    herr_t   ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -1406,6 +1541,10 @@ H5FD__log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, ha
     HDassert(size > 0);
     HDassert(buf);
 
+    /* Note the start time of the write for the binary log */
+    if (file->binary_flags & H5FD_LOG_LOC_WRITE)
+        io_start = H5_now_usec();
+
     /* Verify that we are writing out the type of data we allocated in this location */
     if (file->flavor) {
         HDassert(type == H5FD_MEM_DEFAULT || type == (H5FD_mem_t)file->flavor[addr] ||
@@ -1584,6 +1723,12 @@ done:
         file->op  = OP_UNKNOWN;
     } /* end if */
 
+    /* Record the write (or failed write) in the binary log */
+    if (io_start > 0)
+        if (H5FD__log_binary_record(file, H5FD_LOG_OP_WRITE, type, orig_addr, (hsize_t)orig_size, io_start,
+                                    H5_now_usec(), (hbool_t)(ret_value < 0)) < 0)
+            HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write log record")
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__log_write() */
 
@@ -1612,8 +1757,13 @@ H5FD__log_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_
 
     /* Extend the file to make sure it's large enough */
     if (!H5F_addr_eq(file->eoa, file->eof)) {
-        H5_timer_t    trunc_timer; /* Timer for truncate operation */
-        H5_timevals_t trunc_times; /* Elapsed time for truncate operation */
+        H5_timer_t    trunc_timer;    /* Timer for truncate operation */
+        H5_timevals_t trunc_times;    /* Elapsed time for truncate operation */
+        uint64_t      trunc_start = 0; /* Start time of the truncate, for binary logging */
+
+        /* Note the start time of the truncate for the binary log */
+        if (file->binary_flags & H5FD_LOG_TRUNCATE)
+            trunc_start = H5_now_usec();
 
         /* Start timer for truncate operation */
         if (file->fa.flags & H5FD_LOG_TIME_TRUNCATE) {
@@ -1682,6 +1832,12 @@ H5FD__log_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_
                 HDfprintf(file->logfp, "\n");
         } /* end if */
 
+        /* Record the truncate in the binary log */
+        if (trunc_start > 0)
+            if (H5FD__log_binary_record(file, H5FD_LOG_OP_TRUNCATE, H5FD_MEM_NOLIST, file->eof,
+                                        (hsize_t)file->eoa, trunc_start, H5_now_usec(), FALSE) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write log record")
+
         /* Update the eof value */
         file->eof = file->eoa;
 
@@ -1772,3 +1928,86 @@ H5FD__log_unlock(H5FD_t *_file)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__log_unlock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__log_binary_flush
+ *
+ * Purpose:     Write the buffered binary log records to the log file and
+ *              empty the buffer.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__log_binary_flush(H5FD_log_t *file)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->logfp);
+    HDassert(file->records);
+
+    if (file->nrecords > 0) {
+        if (file->nrecords !=
+            HDfwrite(file->records, H5FD_LOG_BINARY_RECORD_SIZE, file->nrecords, file->logfp))
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "error writing log records")
+        file->nrecords = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__log_binary_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__log_binary_record
+ *
+ * Purpose:     Encode a record for an operation that ran from START to END
+ *              (microseconds, from H5_now_usec()) into the record buffer,
+ *              writing the buffer out to the log file when it fills up.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__log_binary_record(H5FD_log_t *file, unsigned op, H5FD_mem_t type, haddr_t addr, hsize_t size,
+                        uint64_t start, uint64_t end, hbool_t failed)
+{
+    uint8_t *p;                   /* Pointer into the record buffer */
+    uint64_t duration;            /* Duration of the operation */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->records);
+    HDassert(file->nrecords < file->max_records);
+    HDassert(op < H5FD_LOG_NOPS);
+
+    /* Saturate the duration to 32 bits (a bit over an hour) */
+    duration = end > start ? end - start : 0;
+    if (duration > UINT32_MAX)
+        duration = UINT32_MAX;
+
+    /* Encode the record */
+    p = file->records + (file->nrecords * H5FD_LOG_BINARY_RECORD_SIZE);
+    UINT64ENCODE(p, start);
+    UINT64ENCODE(p, (uint64_t)addr);
+    UINT64ENCODE(p, (uint64_t)size);
+    UINT32ENCODE(p, duration);
+    *p++ = (uint8_t)op;
+    *p++ = (uint8_t)(type < H5FD_MEM_DEFAULT ? 0xff : type);
+    *p++ = (uint8_t)(failed ? H5FD_LOG_STATUS_FAILED : 0);
+    *p++ = 0;
+
+    /* Write the buffer out when it's full */
+    if (++file->nrecords == file->max_records)
+        if (H5FD__log_binary_flush(file) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write log records")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__log_binary_record() */
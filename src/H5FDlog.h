@@ -60,6 +60,51 @@
 #define H5FD_LOG_ALL                                                                                         \
     (H5FD_LOG_FREE | H5FD_LOG_ALLOC | H5FD_LOG_TIME_IO | H5FD_LOG_NUM_IO | H5FD_LOG_FLAVOR |                 \
      H5FD_LOG_FILE_IO | H5FD_LOG_LOC_IO | H5FD_LOG_META_IO)
+/* Flag for writing fixed-size binary records to the log file instead of text.
+ * In this mode H5FD_LOG_LOC_READ, H5FD_LOG_LOC_WRITE, H5FD_LOG_TRUNCATE,
+ * H5FD_LOG_ALLOC and H5FD_LOG_FREE select the operations that are recorded,
+ * the other flags are ignored, and the 'buf_size' parameter of
+ * H5Pset_fapl_log() is the size of the in-memory record buffer (0 for the
+ * default).  A log file name is required.
+ */
+#define H5FD_LOG_BINARY 0x00100000
+
+/* Binary log file layout
+ *
+ * A binary log starts with a header holding the signature, the format
+ * version and the record size (both 32-bit), followed by fixed-size
+ * records.  All values are little-endian.  Each record holds:
+ *
+ *      8 bytes:    Start time of the operation (microseconds)
+ *      8 bytes:    File address
+ *      8 bytes:    Size of the operation, in bytes.  For opens and closes
+ *                  this is the size of the file, and for truncates the
+ *                  address is the old size of the file and this is the
+ *                  new one.
+ *      4 bytes:    Duration of the operation (microseconds, saturated)
+ *      1 byte:     Operation (H5FD_LOG_OP_*)
+ *      1 byte:     Memory type (H5FD_mem_t, 0xff when there is none)
+ *      1 byte:     Status flags (H5FD_LOG_STATUS_FAILED)
+ *      1 byte:     Reserved (zero)
+ */
+#define H5FD_LOG_BINARY_SIGNATURE     "HDF5FDLG"
+#define H5FD_LOG_BINARY_SIGNATURE_LEN 8
+#define H5FD_LOG_BINARY_VERSION       1
+#define H5FD_LOG_BINARY_HEADER_SIZE   (H5FD_LOG_BINARY_SIGNATURE_LEN + 4 + 4)
+#define H5FD_LOG_BINARY_RECORD_SIZE   32
+
+/* Operations in binary log records */
+#define H5FD_LOG_OP_OPEN     0
+#define H5FD_LOG_OP_CLOSE    1
+#define H5FD_LOG_OP_READ     2
+#define H5FD_LOG_OP_WRITE    3
+#define H5FD_LOG_OP_TRUNCATE 4
+#define H5FD_LOG_OP_ALLOC    5
+#define H5FD_LOG_OP_FREE     6
+#define H5FD_LOG_NOPS        7
+
+/* Status flags in binary log records */
+#define H5FD_LOG_STATUS_FAILED 0x01 /* The operation failed */
 
 #ifdef __cplusplus
 extern "C" {
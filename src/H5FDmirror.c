@@ -36,13 +36,19 @@ static hid_t H5FD_MIRROR_g = 0;
 
 /* Virtual file structure for a Mirror Driver */
 typedef struct H5FD_mirror_t {
-    H5FD_t             pub;     /* Public stuff, must be first            */
-    H5FD_mirror_fapl_t fa;      /* Configuration structure                */
-    haddr_t            eoa;     /* End of allocated region                */
-    haddr_t            eof;     /* End of file; current file size         */
-    int                sock_fd; /* Handle of socket to remote operator    */
-    H5FD_mirror_xmit_t xmit;    /* Primary communication header           */
-    uint32_t           xmit_i;  /* Counter of transmission sent and rec'd */
+    H5FD_t             pub;       /* Public stuff, must be first               */
+    H5FD_mirror_fapl_t fa;        /* Configuration structure                   */
+    haddr_t            eoa;       /* End of allocated region                   */
+    haddr_t            eof;       /* End of file; current file size            */
+    int                sock_fd;   /* Handle of socket to remote operator       */
+    H5FD_mirror_xmit_t xmit;      /* Primary communication header              */
+    uint32_t           xmit_i;    /* Counter of commands sent                  */
+    uint32_t           reply_i;   /* Count of the command answered next        */
+    unsigned           npending;  /* Commands sent but not yet answered        */
+    unsigned char *    wbuf;      /* Coalesced writes, after room for the xmit */
+    size_t             wbuf_len;  /* Bytes of data gathered in wbuf            */
+    haddr_t            wbuf_addr; /* File address of the first gathered byte   */
+    H5FD_mem_t         wbuf_type; /* Memory type of the gathered writes        */
 } H5FD_mirror_t;
 
 /*
@@ -153,11 +159,17 @@ static herr_t  H5FD__mirror_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id,
                                   const void *buf);
 static herr_t  H5FD__mirror_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                  void *buf);
+static herr_t  H5FD__mirror_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__mirror_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__mirror_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__mirror_unlock(H5FD_t *_file);
 
+static herr_t H5FD__mirror_xmit_send(H5FD_mirror_t *file, const void *buf, size_t size);
 static herr_t H5FD__mirror_verify_reply(H5FD_mirror_t *file);
+static herr_t H5FD__mirror_wait_replies(H5FD_mirror_t *file);
+static herr_t H5FD__mirror_send_command(H5FD_mirror_t *file, const unsigned char *xmit_buf, size_t xmit_size,
+                                        const void *data, size_t data_size, hbool_t wait);
+static herr_t H5FD__mirror_flush_writes(H5FD_mirror_t *file);
 
 static const H5FD_class_t H5FD_mirror_g = {
     "mirror",               /* name                 */
@@ -187,7 +199,7 @@ static const H5FD_class_t H5FD_mirror_g = {
     NULL,                   /* get_handle           */
     H5FD__mirror_read,      /* read                 */
     H5FD__mirror_write,     /* write                */
-    NULL,                   /* flush                */
+    H5FD__mirror_flush,     /* flush                */
     H5FD__mirror_truncate,  /* truncate             */
     H5FD__mirror_lock,      /* lock                 */
     H5FD__mirror_unlock,    /* unlock               */
@@ -1106,6 +1118,43 @@ H5FD_mirror_xmit_is_xmit(const H5FD_mirror_xmit_t *xmit)
     return TRUE;
 } /* end H5FD_mirror_xmit_is_xmit() */
 
+/* ----------------------------------------------------------------------------
+ * Function:    H5FD__mirror_xmit_send
+ *
+ * Purpose:     Transmit all SIZE bytes of BUF to the remote Writer,
+ *              continuing after partial or interrupted socket writes.
+ *
+ * Return:      SUCCEED if ok, else FAIL.
+ * ----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_xmit_send(H5FD_mirror_t *file, const void *buf, size_t size)
+{
+    const unsigned char *ptr       = (const unsigned char *)buf;
+    ssize_t              nbytes    = 0;
+    herr_t               ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->sock_fd >= 0);
+    HDassert(buf || 0 == size);
+
+    while (size > 0) {
+        nbytes = HDwrite(file->sock_fd, ptr, size);
+        if (nbytes < 0) {
+            if (EINTR == errno)
+                continue;
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit: %s", HDstrerror(errno))
+        } /* end if */
+        HDassert((size_t)nbytes <= size);
+        ptr += nbytes;
+        size -= (size_t)nbytes;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mirror_xmit_send() */
+
 /* ----------------------------------------------------------------------------
  * Function:    H5FD__mirror_verify_reply
  *
@@ -1114,14 +1163,18 @@ H5FD_mirror_xmit_is_xmit(const H5FD_mirror_xmit_t *xmit)
  *              If all checks pass, inspect the reply contents and handle
  *              reported error, if not an OK reply.
  *
+ *              Replies arrive in the order the commands were sent, so the
+ *              reply must answer the oldest outstanding command.
+ *
  * Return:      SUCCEED if ok, else FAIL.
  * ----------------------------------------------------------------------------
  */
 static herr_t
 H5FD__mirror_verify_reply(H5FD_mirror_t *file)
 {
-    unsigned char *                 xmit_buf = NULL;
+    unsigned char                   xmit_buf[H5FD_MIRROR_XMIT_REPLY_SIZE];
     struct H5FD_mirror_xmit_reply_t reply;
+    size_t                          nread     = 0;
     ssize_t                         read_ret  = 0;
     herr_t                          ret_value = SUCCEED;
 
@@ -1130,18 +1183,21 @@ H5FD__mirror_verify_reply(H5FD_mirror_t *file)
     LOG_OP_CALL(FUNC);
 
     HDassert(file && file->sock_fd);
-
-    xmit_buf = H5FL_BLK_MALLOC(xmit, H5FD_MIRROR_XMIT_BUFFER_MAX);
-    if (NULL == xmit_buf)
-        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate xmit buffer");
-
-    read_ret = HDread(file->sock_fd, xmit_buf, H5FD_MIRROR_XMIT_REPLY_SIZE);
-    if (read_ret < 0)
-        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to read reply");
-    if (read_ret != H5FD_MIRROR_XMIT_REPLY_SIZE)
-        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unexpected read size");
-
-    LOG_XMIT_BYTES("reply", xmit_buf, read_ret);
+    HDassert(file->npending > 0);
+
+    while (nread < H5FD_MIRROR_XMIT_REPLY_SIZE) {
+        read_ret = HDread(file->sock_fd, xmit_buf + nread, H5FD_MIRROR_XMIT_REPLY_SIZE - nread);
+        if (read_ret < 0) {
+            if (EINTR == errno)
+                continue;
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to read reply")
+        } /* end if */
+        if (read_ret == 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unexpected read size")
+        nread += (size_t)read_ret;
+    } /* end while */
+
+    LOG_XMIT_BYTES("reply", xmit_buf, nread);
 
     if (H5FD_mirror_xmit_decode_reply(&reply, xmit_buf) != H5FD_MIRROR_XMIT_REPLY_SIZE)
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "unable to decode reply xmit");
@@ -1151,18 +1207,133 @@ H5FD__mirror_verify_reply(H5FD_mirror_t *file)
 
     if (reply.pub.session_token != file->xmit.session_token)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "wrong session");
-    if (reply.pub.xmit_count != (file->xmit_i)++)
+    if (reply.pub.xmit_count != (file->reply_i)++)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "xmit out of sync");
+    file->npending--;
     if (reply.status != H5FD_MIRROR_STATUS_OK)
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "%s", (const char *)(reply.message));
 
 done:
-    if (xmit_buf)
-        xmit_buf = H5FL_BLK_FREE(xmit, xmit_buf);
-
     FUNC_LEAVE_NOAPI(ret_value);
 } /* end H5FD__mirror_verify_reply() */
 
+/* ----------------------------------------------------------------------------
+ * Function:    H5FD__mirror_wait_replies
+ *
+ * Purpose:     Read and verify the replies to every outstanding command.
+ *
+ * Return:      SUCCEED if ok, else FAIL.
+ * ----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_wait_replies(H5FD_mirror_t *file)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    while (file->npending > 0)
+        if (H5FD__mirror_verify_reply(file) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mirror_wait_replies() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    H5FD__mirror_send_command
+ *
+ * Purpose:     Transmit an encoded command, followed by DATA_SIZE bytes of
+ *              DATA if any, to the remote Writer.
+ *
+ *              Up to `pipeline_depth` commands may be awaiting their reply;
+ *              if the window is full, the oldest reply is read first. If
+ *              WAIT is true, the replies to all outstanding commands
+ *              (including this one) are read before returning.
+ *
+ *              The caller must have assigned the command's xmit_count.
+ *
+ * Return:      SUCCEED if ok, else FAIL.
+ * ----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_send_command(H5FD_mirror_t *file, const unsigned char *xmit_buf, size_t xmit_size,
+                          const void *data, size_t data_size, hbool_t wait)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(xmit_buf);
+
+    while (file->npending >= file->fa.pipeline_depth)
+        if (H5FD__mirror_verify_reply(file) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply")
+
+    if (H5FD__mirror_xmit_send(file, xmit_buf, xmit_size) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit command")
+    if (data_size > 0 && H5FD__mirror_xmit_send(file, data, data_size) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit data")
+    file->npending++;
+
+    if (wait && H5FD__mirror_wait_replies(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mirror_send_command() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    H5FD__mirror_flush_writes
+ *
+ * Purpose:     Send the writes gathered in the coalescing buffer to the
+ *              remote Writer as a single write command.
+ *
+ * Return:      SUCCEED if ok, else FAIL.
+ * ----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_flush_writes(H5FD_mirror_t *file)
+{
+    H5FD_mirror_xmit_write_t xmit_write;
+    size_t                   len       = 0;
+    herr_t                   ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (0 == file->wbuf_len)
+        HGOTO_DONE(SUCCEED)
+
+    /* Reset first, so a failed transfer is not sent again */
+    len            = file->wbuf_len;
+    file->wbuf_len = 0;
+
+    file->xmit.xmit_count = (file->xmit_i)++;
+    file->xmit.op         = H5FD_MIRROR_OP_WRITE;
+
+    xmit_write.pub    = file->xmit;
+    xmit_write.size   = (uint64_t)len;
+    xmit_write.offset = (uint64_t)file->wbuf_addr;
+    xmit_write.type   = (uint8_t)file->wbuf_type;
+
+    /* The data already follows the space reserved for the xmit */
+    if (H5FD_mirror_xmit_encode_write(file->wbuf, &xmit_write) != H5FD_MIRROR_XMIT_WRITE_SIZE)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to encode write");
+
+    LOG_XMIT_BYTES("write", file->wbuf, H5FD_MIRROR_XMIT_WRITE_SIZE);
+
+    if (H5FD__mirror_send_command(file, file->wbuf, H5FD_MIRROR_XMIT_WRITE_SIZE + len, NULL, 0, FALSE) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit write");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mirror_flush_writes() */
+
 /* -------------------------------------------------------------------------
  * Function:    H5FD__mirror_fapl_get
  *
@@ -1268,6 +1439,10 @@ H5FD__mirror_fapl_free(void *_fa)
  * Purpose:     Get the configuration information for this fapl.
  *              Data is memcopied into the fa_out pointer.
  *
+ *              Will fail if fa_out is received without a valid version.
+ *              Only the fields present in that version of the structure
+ *              are filled in, and the version is left unchanged.
+ *
  * Return:      SUCCEED/FAIL
  * -------------------------------------------------------------------------
  */
@@ -1276,6 +1451,7 @@ H5Pget_fapl_mirror(hid_t fapl_id, H5FD_mirror_fapl_t *fa_out)
 {
     const H5FD_mirror_fapl_t *fa        = NULL;
     H5P_genplist_t *          plist     = NULL;
+    uint32_t                  version   = 0;
     herr_t                    ret_value = SUCCEED;
 
     FUNC_ENTER_API(FAIL)
@@ -1285,6 +1461,8 @@ H5Pget_fapl_mirror(hid_t fapl_id, H5FD_mirror_fapl_t *fa_out)
 
     if (NULL == fa_out)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "fa_out is NULL");
+    if (fa_out->version < 1 || fa_out->version > H5FD_MIRROR_CURR_FAPL_T_VERSION)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "fa_out version unsafe");
 
     plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS);
     if (NULL == plist)
@@ -1298,7 +1476,13 @@ H5Pget_fapl_mirror(hid_t fapl_id, H5FD_mirror_fapl_t *fa_out)
 
     HDassert(fa->magic == H5FD_MIRROR_FAPL_MAGIC); /* sanity check */
 
-    HDmemcpy(fa_out, fa, sizeof(H5FD_mirror_fapl_t));
+    /* A version 1 structure ends before the transport settings */
+    version = fa_out->version;
+    if (1 == version)
+        HDmemcpy(fa_out, fa, offsetof(H5FD_mirror_fapl_t, pipeline_depth));
+    else
+        HDmemcpy(fa_out, fa, sizeof(H5FD_mirror_fapl_t));
+    fa_out->version = version;
 
 done:
     FUNC_LEAVE_API(ret_value);
@@ -1316,8 +1500,9 @@ done:
 herr_t
 H5Pset_fapl_mirror(hid_t fapl_id, H5FD_mirror_fapl_t *fa)
 {
-    H5P_genplist_t *plist     = NULL;
-    herr_t          ret_value = FAIL;
+    H5FD_mirror_fapl_t fa_curr;
+    H5P_genplist_t *   plist     = NULL;
+    herr_t             ret_value = FAIL;
 
     FUNC_ENTER_API(FAIL)
     H5TRACE2("e", "i*x", fapl_id, fa);
@@ -1331,10 +1516,26 @@ H5Pset_fapl_mirror(hid_t fapl_id, H5FD_mirror_fapl_t *fa)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null fapl_t pointer");
     if (H5FD_MIRROR_FAPL_MAGIC != fa->magic)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid fapl_t magic");
-    if (H5FD_MIRROR_CURR_FAPL_T_VERSION != fa->version)
+    if (fa->version < 1 || fa->version > H5FD_MIRROR_CURR_FAPL_T_VERSION)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown fapl_t version");
 
-    ret_value = H5P_set_driver(plist, H5FD_MIRROR, (const void *)fa);
+    /* Always store the current version; a version 1 structure ends before
+     * the transport settings, which take their defaults.
+     */
+    HDmemset(&fa_curr, 0, sizeof(H5FD_mirror_fapl_t));
+    if (1 == fa->version) {
+        HDmemcpy(&fa_curr, fa, offsetof(H5FD_mirror_fapl_t, pipeline_depth));
+        fa_curr.pipeline_depth = H5FD_MIRROR_DEFAULT_PIPELINE_DEPTH;
+        fa_curr.coalesce_size  = H5FD_MIRROR_DEFAULT_COALESCE_SIZE;
+    } /* end if */
+    else
+        HDmemcpy(&fa_curr, fa, sizeof(H5FD_mirror_fapl_t));
+    fa_curr.version = H5FD_MIRROR_CURR_FAPL_T_VERSION;
+
+    if (0 == fa_curr.pipeline_depth)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "pipeline depth must be positive");
+
+    ret_value = H5P_set_driver(plist, H5FD_MIRROR, (const void *)&fa_curr);
 
 done:
     FUNC_LEAVE_API(ret_value)
@@ -1360,6 +1561,7 @@ H5FD__mirror_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
     int                      live_socket = -1;
     struct sockaddr_in       target_addr;
     socklen_t                addr_size;
+    int                      nodelay  = 1;
     unsigned char *          xmit_buf = NULL;
     H5FD_mirror_fapl_t       fa;
     H5FD_mirror_t *          file      = NULL;
@@ -1383,6 +1585,7 @@ H5FD__mirror_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
     if (ADDR_OVERFLOW(maxaddr))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr");
 
+    fa.version = H5FD_MIRROR_CURR_FAPL_T_VERSION;
     if (H5Pget_fapl_mirror(fapl_id, &fa) == FAIL)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "can't get config info");
     if (H5FD_MIRROR_FAPL_MAGIC != fa.magic)
@@ -1407,6 +1610,10 @@ H5FD__mirror_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
     if (HDconnect(live_socket, (struct sockaddr *)&target_addr, addr_size) < 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "can't connect to remote server");
 
+    /* Small writes are gathered here, so don't let the kernel hold them back */
+    if (HDsetsockopt(live_socket, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay)) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTSET, NULL, "can't disable Nagle's algorithm on socket");
+
     /* ------------- */
     /* Open the file */
     /* ------------- */
@@ -1417,6 +1624,16 @@ H5FD__mirror_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
 
     file->sock_fd = live_socket;
     file->xmit_i  = 0;
+    file->reply_i = 0;
+
+    file->fa = fa;
+    if (file->fa.pipeline_depth > H5FD_MIRROR_MAX_PIPELINE_DEPTH)
+        file->fa.pipeline_depth = H5FD_MIRROR_MAX_PIPELINE_DEPTH;
+    if (file->fa.coalesce_size > 0) {
+        file->wbuf = (unsigned char *)H5MM_malloc(H5FD_MIRROR_XMIT_WRITE_SIZE + file->fa.coalesce_size);
+        if (NULL == file->wbuf)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, NULL, "unable to allocate write-coalescing buffer");
+    } /* end if */
 
     file->xmit.magic         = H5FD_MIRROR_XMIT_MAGIC;
     file->xmit.version       = H5FD_MIRROR_XMIT_CURR_VERSION;
@@ -1444,18 +1661,17 @@ H5FD__mirror_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxad
 
     LOG_XMIT_BYTES("open", xmit_buf, H5FD_MIRROR_XMIT_OPEN_SIZE);
 
-    if (HDwrite(file->sock_fd, xmit_buf, H5FD_MIRROR_XMIT_OPEN_SIZE) < 0)
+    if (H5FD__mirror_send_command(file, xmit_buf, H5FD_MIRROR_XMIT_OPEN_SIZE, NULL, 0, TRUE) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, NULL, "unable to transmit open");
 
-    if (H5FD__mirror_verify_reply(file) == FAIL)
-        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, NULL, "invalid reply");
-
     ret_value = (H5FD_t *)file;
 
 done:
     if (NULL == ret_value) {
-        if (file)
+        if (file) {
+            H5MM_xfree(file->wbuf);
             file = H5FL_FREE(H5FD_mirror_t, file);
+        } /* end if */
         if (live_socket >= 0 && HDclose(live_socket) < 0)
             HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, NULL, "can't close socket");
     }
@@ -1473,8 +1689,9 @@ done:
  *
  * Purpose:     Closes the HDF5 file.
  *
- *              Tries to send a CLOSE op to the remote Writer and expects
- *              a valid reply, then closes the socket.
+ *              Sends any coalesced writes, then tries to send a CLOSE op
+ *              to the remote Writer and expects a valid reply to it and to
+ *              every outstanding command, then closes the socket.
  *              In error, attempts to send a deliberately invalid xmit to the
  *              Writer to get it to close/abort, then attempts to close the
  *              socket.
@@ -1499,6 +1716,9 @@ H5FD__mirror_close(H5FD_t *_file)
     HDassert(file);
     HDassert(file->sock_fd >= 0);
 
+    if (H5FD__mirror_flush_writes(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit coalesced writes");
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_CLOSE;
 
@@ -1512,12 +1732,9 @@ H5FD__mirror_close(H5FD_t *_file)
 
     LOG_XMIT_BYTES("close", xmit_buf, H5FD_MIRROR_XMIT_HEADER_SIZE);
 
-    if (HDwrite(file->sock_fd, xmit_buf, H5FD_MIRROR_XMIT_HEADER_SIZE) < 0)
+    if (H5FD__mirror_send_command(file, xmit_buf, H5FD_MIRROR_XMIT_HEADER_SIZE, NULL, 0, TRUE) < 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to transmit close");
 
-    if (H5FD__mirror_verify_reply(file) == FAIL)
-        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply");
-
     if (HDclose(file->sock_fd) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "can't close socket");
 
@@ -1544,6 +1761,7 @@ done:
                 HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "can't close socket");
     } /* end if error */
 
+    H5MM_xfree(file->wbuf);
     file = H5FL_FREE(H5FD_mirror_t, file); /* always release resources */
 
     if (xmit_buf)
@@ -1616,6 +1834,9 @@ H5FD__mirror_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
  *              called shortly after an existing HDF5 file is opened in order
  *              to tell the driver where the end of the HDF5 data is located.
  *
+ *              The command is pipelined; coalesced writes are sent first
+ *              only if the new marker falls before their end.
+ *
  * Return:      SUCCEED / FAIL
  *-------------------------------------------------------------------------
  */
@@ -1623,7 +1844,7 @@ static herr_t
 H5FD__mirror_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
 {
     H5FD_mirror_xmit_eoa_t xmit_eoa;
-    unsigned char *        xmit_buf  = NULL;
+    unsigned char          xmit_buf[H5FD_MIRROR_XMIT_EOA_SIZE];
     H5FD_mirror_t *        file      = (H5FD_mirror_t *)_file;
     herr_t                 ret_value = SUCCEED;
 
@@ -1635,6 +1856,11 @@ H5FD__mirror_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
 
     file->eoa = addr; /* local copy */
 
+    /* Gathered writes are only valid against the old, larger marker */
+    if (file->wbuf_len > 0 && H5F_addr_lt(addr, file->wbuf_addr + file->wbuf_len))
+        if (H5FD__mirror_flush_writes(file) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit coalesced writes");
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_SET_EOA;
 
@@ -1642,25 +1868,15 @@ H5FD__mirror_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
     xmit_eoa.type     = (uint8_t)type;
     xmit_eoa.eoa_addr = (uint64_t)addr;
 
-    xmit_buf = H5FL_BLK_MALLOC(xmit, H5FD_MIRROR_XMIT_BUFFER_MAX);
-    if (NULL == xmit_buf)
-        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate xmit buffer");
-
     if (H5FD_mirror_xmit_encode_set_eoa(xmit_buf, &xmit_eoa) != H5FD_MIRROR_XMIT_EOA_SIZE)
         HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to encode set-eoa");
 
     LOG_XMIT_BYTES("set-eoa", xmit_buf, H5FD_MIRROR_XMIT_EOA_SIZE);
 
-    if (HDwrite(file->sock_fd, xmit_buf, H5FD_MIRROR_XMIT_EOA_SIZE) < 0)
+    if (H5FD__mirror_send_command(file, xmit_buf, H5FD_MIRROR_XMIT_EOA_SIZE, NULL, 0, FALSE) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit set-eoa");
 
-    if (H5FD__mirror_verify_reply(file) == FAIL)
-        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply");
-
 done:
-    if (xmit_buf)
-        xmit_buf = H5FL_BLK_FREE(xmit, xmit_buf);
-
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__mirror_set_eoa() */
 
@@ -1717,12 +1933,14 @@ H5FD__mirror_read(H5FD_t H5_ATTR_UNUSED *_file, H5FD_mem_t H5_ATTR_UNUSED type,
  *              from buffer BUF according to data transfer properties in
  *              DXPL_ID.
  *
- *              Send metadata regarding the write (location, size) to the
- *              remote Writer, then separately transmits the data.
- *              Both transmission expect an OK reply from the Writer.
- *              This two-exchange approach incurs significant overhead,
- *              but is a simple and modular approach.
- *              Start optimizations here.
+ *              Writes smaller than the `coalesce_size` are gathered while
+ *              they are adjacent in the file and sent as one command once
+ *              the run is broken or the buffer fills; larger writes are
+ *              sent directly, with the data following the command.
+ *
+ *              Writes are pipelined, so a failure reported by the remote
+ *              Writer surfaces from a later call, at the latest from the
+ *              next flush, truncate, lock, unlock or close.
  *
  * Return:      SUCCEED/FAIL
  *-------------------------------------------------------------------------
@@ -1732,7 +1950,7 @@ H5FD__mirror_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id,
                    const void *buf)
 {
     H5FD_mirror_xmit_write_t xmit_write;
-    unsigned char *          xmit_buf  = NULL;
+    unsigned char            xmit_buf[H5FD_MIRROR_XMIT_WRITE_SIZE];
     H5FD_mirror_t *          file      = (H5FD_mirror_t *)_file;
     herr_t                   ret_value = SUCCEED;
 
@@ -1743,45 +1961,78 @@ H5FD__mirror_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id,
     HDassert(file);
     HDassert(buf);
 
-    file->xmit.xmit_count = (file->xmit_i)++;
-    file->xmit.op         = H5FD_MIRROR_OP_WRITE;
-
-    xmit_write.pub    = file->xmit;
-    xmit_write.size   = (uint64_t)size;
-    xmit_write.offset = (uint64_t)addr;
-    xmit_write.type   = (uint8_t)type;
-
-    xmit_buf = H5FL_BLK_MALLOC(xmit, H5FD_MIRROR_XMIT_BUFFER_MAX);
-    if (NULL == xmit_buf)
-        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate xmit buffer");
+    /* Send gathered writes that this one does not extend */
+    if (file->wbuf_len > 0 && (!H5F_addr_eq(addr, file->wbuf_addr + file->wbuf_len) ||
+                               size > file->fa.coalesce_size - file->wbuf_len))
+        if (H5FD__mirror_flush_writes(file) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit coalesced writes");
+
+    if (size < file->fa.coalesce_size) {
+        if (0 == file->wbuf_len) {
+            file->wbuf_addr = addr;
+            file->wbuf_type = type;
+        } /* end if */
+        else if (type != file->wbuf_type)
+            file->wbuf_type = H5FD_MEM_DEFAULT;
+
+        H5MM_memcpy(file->wbuf + H5FD_MIRROR_XMIT_WRITE_SIZE + file->wbuf_len, buf, size);
+        file->wbuf_len += size;
+
+        if (file->wbuf_len == file->fa.coalesce_size)
+            if (H5FD__mirror_flush_writes(file) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit coalesced writes");
+    } /* end if */
+    else {
+        file->xmit.xmit_count = (file->xmit_i)++;
+        file->xmit.op         = H5FD_MIRROR_OP_WRITE;
+
+        xmit_write.pub    = file->xmit;
+        xmit_write.size   = (uint64_t)size;
+        xmit_write.offset = (uint64_t)addr;
+        xmit_write.type   = (uint8_t)type;
+
+        if (H5FD_mirror_xmit_encode_write(xmit_buf, &xmit_write) != H5FD_MIRROR_XMIT_WRITE_SIZE)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to encode write");
+
+        LOG_XMIT_BYTES("write", xmit_buf, H5FD_MIRROR_XMIT_WRITE_SIZE);
+
+        if (H5FD__mirror_send_command(file, xmit_buf, H5FD_MIRROR_XMIT_WRITE_SIZE, buf, size, FALSE) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit write");
+    } /* end else */
 
-    /* Notify Writer of incoming data to write. */
-    if (H5FD_mirror_xmit_encode_write(xmit_buf, &xmit_write) != H5FD_MIRROR_XMIT_WRITE_SIZE)
-        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to encode write");
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mirror_write() */
 
-    LOG_XMIT_BYTES("write", xmit_buf, H5FD_MIRROR_XMIT_WRITE_SIZE);
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mirror_flush
+ *
+ * Purpose:     Sends any coalesced writes and waits until the remote
+ *              Writer has answered every outstanding command.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mirror_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_mirror_t *file      = (H5FD_mirror_t *)_file;
+    herr_t         ret_value = SUCCEED;
 
-    if (HDwrite(file->sock_fd, xmit_buf, H5FD_MIRROR_XMIT_WRITE_SIZE) < 0)
-        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit write");
+    FUNC_ENTER_STATIC
 
-    /* Check that our write xmission was received */
-    if (H5FD__mirror_verify_reply(file) == FAIL)
-        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply");
+    LOG_OP_CALL(FUNC);
 
-    /* Send the data to be written */
-    if (HDwrite(file->sock_fd, buf, size) < 0)
-        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit data");
+    HDassert(file);
 
-    /* Writer should reply that it got the data and is still okay/ready */
-    if (H5FD__mirror_verify_reply(file) == FAIL)
+    if (H5FD__mirror_flush_writes(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit coalesced writes");
+    if (H5FD__mirror_wait_replies(file) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply");
 
 done:
-    if (xmit_buf)
-        xmit_buf = H5FL_BLK_FREE(xmit, xmit_buf);
-
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5FD__mirror_write() */
+} /* end H5FD__mirror_flush() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD__mirror_truncate
@@ -1803,6 +2054,9 @@ H5FD__mirror_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_AT
 
     LOG_OP_CALL(FUNC);
 
+    if (H5FD__mirror_flush_writes(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit coalesced writes");
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_TRUNCATE;
 
@@ -1815,12 +2069,9 @@ H5FD__mirror_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_AT
 
     LOG_XMIT_BYTES("truncate", xmit_buf, H5FD_MIRROR_XMIT_HEADER_SIZE);
 
-    if (HDwrite(file->sock_fd, xmit_buf, H5FD_MIRROR_XMIT_HEADER_SIZE) < 0)
+    if (H5FD__mirror_send_command(file, xmit_buf, H5FD_MIRROR_XMIT_HEADER_SIZE, NULL, 0, TRUE) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit truncate");
 
-    if (H5FD__mirror_verify_reply(file) == FAIL)
-        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply");
-
 done:
     if (xmit_buf)
         xmit_buf = H5FL_BLK_FREE(xmit, xmit_buf);
@@ -1851,6 +2102,9 @@ H5FD__mirror_lock(H5FD_t *_file, hbool_t rw)
 
     LOG_OP_CALL(FUNC);
 
+    if (H5FD__mirror_flush_writes(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit coalesced writes");
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_LOCK;
 
@@ -1866,12 +2120,9 @@ H5FD__mirror_lock(H5FD_t *_file, hbool_t rw)
 
     LOG_XMIT_BYTES("lock", xmit_buf, H5FD_MIRROR_XMIT_LOCK_SIZE);
 
-    if (HDwrite(file->sock_fd, xmit_buf, H5FD_MIRROR_XMIT_LOCK_SIZE) < 0)
+    if (H5FD__mirror_send_command(file, xmit_buf, H5FD_MIRROR_XMIT_LOCK_SIZE, NULL, 0, TRUE) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit lock");
 
-    if (H5FD__mirror_verify_reply(file) == FAIL)
-        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply");
-
 done:
     if (xmit_buf)
         xmit_buf = H5FL_BLK_FREE(xmit, xmit_buf);
@@ -1898,6 +2149,9 @@ H5FD__mirror_unlock(H5FD_t *_file)
 
     LOG_OP_CALL(FUNC);
 
+    if (H5FD__mirror_flush_writes(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit coalesced writes");
+
     file->xmit.xmit_count = (file->xmit_i)++;
     file->xmit.op         = H5FD_MIRROR_OP_UNLOCK;
 
@@ -1910,12 +2164,9 @@ H5FD__mirror_unlock(H5FD_t *_file)
 
     LOG_XMIT_BYTES("unlock", xmit_buf, H5FD_MIRROR_XMIT_HEADER_SIZE);
 
-    if (HDwrite(file->sock_fd, xmit_buf, H5FD_MIRROR_XMIT_HEADER_SIZE) < 0)
+    if (H5FD__mirror_send_command(file, xmit_buf, H5FD_MIRROR_XMIT_HEADER_SIZE, NULL, 0, TRUE) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to transmit unlock");
 
-    if (H5FD__mirror_verify_reply(file) == FAIL)
-        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid reply");
-
 done:
     if (xmit_buf)
         xmit_buf = H5FL_BLK_FREE(xmit, xmit_buf);
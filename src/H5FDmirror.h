@@ -49,16 +49,41 @@ extern "C" {
  *
  * `remote_ip` (char[])
  *      IP address string of "Mirror Server" remote host.
+ *
+ * `pipeline_depth` (unsigned)
+ *      Maximum number of commands sent to the remote Writer before the VFD
+ *      waits for their replies. 1 sends each command and waits for its
+ *      reply before continuing; values are clamped to
+ *      H5FD_MIRROR_MAX_PIPELINE_DEPTH.
+ *      Flush, truncate, lock, unlock and close always wait until every
+ *      outstanding command has been answered.
+ *      (Version 2 and later.)
+ *
+ * `coalesce_size` (size_t)
+ *      Writes smaller than this many bytes are gathered in a buffer of this
+ *      size while they are adjacent in the file, and sent to the Writer as
+ *      a single write command. 0 disables coalescing.
+ *      (Version 2 and later.)
+ *
+ * A version 1 structure (without the last two fields) is still accepted by
+ * `H5Pset_fapl_mirror()`; the defaults below are used in its place.
+ * `H5Pget_fapl_mirror()` fills in the fields of the version set in the
+ * structure it is given.
  * ---------------------------------------------------------------------------
  */
-#define H5FD_MIRROR_FAPL_MAGIC          0xF8DD514C
-#define H5FD_MIRROR_CURR_FAPL_T_VERSION 1
-#define H5FD_MIRROR_MAX_IP_LEN          32
+#define H5FD_MIRROR_FAPL_MAGIC             0xF8DD514C
+#define H5FD_MIRROR_CURR_FAPL_T_VERSION    2
+#define H5FD_MIRROR_MAX_IP_LEN             32
+#define H5FD_MIRROR_DEFAULT_PIPELINE_DEPTH 32
+#define H5FD_MIRROR_MAX_PIPELINE_DEPTH     128
+#define H5FD_MIRROR_DEFAULT_COALESCE_SIZE  (64 * 1024)
 typedef struct H5FD_mirror_fapl_t {
     uint32_t magic;
     uint32_t version;
     int      handshake_port;
     char     remote_ip[H5FD_MIRROR_MAX_IP_LEN + 1];
+    unsigned pipeline_depth;
+    size_t   coalesce_size;
 } H5FD_mirror_fapl_t;
 
 H5_DLL hid_t  H5FD_mirror_init(void);
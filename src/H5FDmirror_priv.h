@@ -33,7 +33,11 @@ extern "C" {
  * steps by the Writer. */
 #define H5FD_MIRROR_DATA_BUFFER_MAX H5_GB /* 1 Gigabyte */
 
-#define H5FD_MIRROR_XMIT_CURR_VERSION 1
+/* Version 2 of the protocol sends the data of a write immediately after the
+ * write xmit and answers it with a single reply; replies echo the xmit_count
+ * of the command they answer, which lets the VFD keep several commands in
+ * flight before it waits on their replies. */
+#define H5FD_MIRROR_XMIT_CURR_VERSION 2
 #define H5FD_MIRROR_XMIT_MAGIC        0x87F8005B
 
 #define H5FD_MIRROR_OP_OPEN     1
@@ -93,9 +97,10 @@ extern "C" {
  *      remote receiver/worker/writer. Exists to help sanity-check.
  *
  * `xmit_count` (uint32_t)
- *      Which transmission this is since the session began.
+ *      Which command this is since the session began.
  *      Used to sanity-check transmission errors.
  *      First xmit (file-open) must be 0.
+ *      A reply carries the count of the command it answers.
  *
  * `op` (uint8_t)
  *      Number identifying which operation to perform.
@@ -237,10 +242,9 @@ typedef struct H5FD_mirror_xmit_reply_t {
  *
  * Structure containing data-write information from VFD sender.
  *
- * The data to be written is transmitted in subsequent, packets
- * and may be broken up into more than one transmission buffer.
- * The VFD sender and remote receiver/worker/writer must coordinate
- * the receipt of data.
+ * The `size` bytes of data to be written immediately follow the encoded
+ * xmit on the wire; the remote receiver/worker/writer replies once, after
+ * all of the data has been received and written.
  *
  * `pub` (H5FD_mirror_xmit_t)
  *      Common transmission header, containing session information.
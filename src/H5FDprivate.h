@@ -141,6 +141,11 @@ H5_DLL herr_t  H5FD_set_base_addr(H5FD_t *file, haddr_t base_addr);
 H5_DLL haddr_t H5FD_get_base_addr(const H5FD_t *file);
 H5_DLL herr_t  H5FD_set_paged_aggr(H5FD_t *file, hbool_t paged);
 
+/* Function prototypes for the memory-mapped VFD */
+#ifdef H5_HAVE_SYS_MMAN_H
+H5_DLL herr_t H5FD_mmap_get_ptr(H5FD_t *file, haddr_t addr, size_t size, const void **ptr /*out*/);
+#endif /* H5_HAVE_SYS_MMAN_H */
+
 /* Function prototypes for MPI based VFDs*/
 #ifdef H5_HAVE_PARALLEL
 /* General routines */
@@ -32,6 +32,8 @@
 #include "H5FLprivate.h" /* Free Lists               */
 #include "H5Iprivate.h"  /* IDs                      */
 #include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+#include "H5SLprivate.h" /* Skip lists               */
 #include "H5FDs3comms.h" /* S3 Communications        */
 
 #ifdef H5_HAVE_ROS3_VFD
@@ -48,6 +50,10 @@
  */
 static hid_t H5FD_ROS3_g = 0;
 
+/* Name of the fapl property holding the block cache configuration
+ */
+#define ROS3_CACHE_CONFIG_PROP_NAME "ros3_cache_config"
+
 #if ROS3_STATS
 
 /* arbitrarily large value, such that any reasonable size read will be "less"
@@ -129,6 +135,46 @@ typedef struct {
 
 #endif /* ROS3_STATS */
 
+/***************************************************************************
+ *
+ * Structure: H5FD_ros3_block_t
+ *
+ * Purpose:
+ *
+ *     One block of the file held in the block cache of an H5FD_ros3_t.
+ *
+ *     Blocks are indexed by address in the file's `cache_index` skip list
+ *     and linked in order of use, most recently used first.
+ *
+ *
+ *
+ * `addr` (haddr_t)
+ *
+ *     Address of the first byte of the block; a multiple of the block size.
+ *
+ * `size` (size_t)
+ *
+ *     Number of bytes held.  Equal to the block size except for the block
+ *     at the end of the file.
+ *
+ * `data` (unsigned char *)
+ *
+ *     The bytes of the file from `addr` to `addr + size`.
+ *
+ * `prev`, `next` (H5FD_ros3_block_t *)
+ *
+ *     Neighbors in the LRU list, toward the more and the less recently
+ *     used ends respectively.
+ *
+ ***************************************************************************/
+typedef struct H5FD_ros3_block_t {
+    haddr_t                   addr;
+    size_t                    size;
+    unsigned char *           data;
+    struct H5FD_ros3_block_t *prev;
+    struct H5FD_ros3_block_t *next;
+} H5FD_ros3_block_t;
+
 /***************************************************************************
  *
  * Structure: H5FD_ros3_t
@@ -166,6 +212,32 @@ typedef struct {
  *     Responsible for communicating with remote host and presenting file
  *     contents as indistinguishable from a file on the local filesystem.
  *
+ * `cache_config` (H5FD_ros3_cache_config_t)
+ *
+ *     Block cache configuration in effect, taken from the fapl on open.
+ *     The remaining cache fields are unused if its `block_size` is zero.
+ *
+ * `cache_index` (H5SL_t *)
+ *
+ *     Skip list of the cached blocks (H5FD_ros3_block_t), keyed by address.
+ *
+ * `cache_head`, `cache_tail` (H5FD_ros3_block_t *)
+ *
+ *     Most and least recently used cached blocks.
+ *
+ * `cache_nblocks` (size_t)
+ *
+ *     Number of blocks currently cached.
+ *
+ * `seq_next` (haddr_t)
+ *
+ *     Address just past the end of the previous read, used to detect
+ *     sequential access.
+ *
+ * `read_ahead` (size_t)
+ *
+ *     Current read-ahead window, in blocks.
+ *
  * *** present only if ROS3_SATS is flagged to enable stats collection ***
  *
  * `meta` (ros3_statsbin[])
@@ -182,6 +254,13 @@ typedef struct {
  *     determined by the size of the read.  The last bin of each type is
  *     reserved for "big" reads, with no defined upper bound.
  *
+ * `cache_hits` (unsigned long long)
+ * `cache_misses` (unsigned long long)
+ * `requests` (unsigned long long)
+ *
+ *     Number of requested blocks found in and missing from the block cache,
+ *     and number of range requests sent to the server.
+ *
  * *** end ROS3_STATS ***
  *
  *
@@ -190,13 +269,23 @@ typedef struct {
  *
  ***************************************************************************/
 typedef struct H5FD_ros3_t {
-    H5FD_t           pub;
-    H5FD_ros3_fapl_t fa;
-    haddr_t          eoa;
-    s3r_t *          s3r_handle;
+    H5FD_t                   pub;
+    H5FD_ros3_fapl_t         fa;
+    haddr_t                  eoa;
+    s3r_t *                  s3r_handle;
+    H5FD_ros3_cache_config_t cache_config;
+    H5SL_t *                 cache_index;
+    H5FD_ros3_block_t *      cache_head;
+    H5FD_ros3_block_t *      cache_tail;
+    size_t                   cache_nblocks;
+    haddr_t                  seq_next;
+    size_t                   read_ahead;
 #if ROS3_STATS
-    ros3_statsbin meta[ROS3_STATS_BIN_COUNT + 1];
-    ros3_statsbin raw[ROS3_STATS_BIN_COUNT + 1];
+    ros3_statsbin      meta[ROS3_STATS_BIN_COUNT + 1];
+    ros3_statsbin      raw[ROS3_STATS_BIN_COUNT + 1];
+    unsigned long long cache_hits;
+    unsigned long long cache_misses;
+    unsigned long long requests;
 #endif
 } H5FD_ros3_t;
 
@@ -235,6 +324,16 @@ static herr_t  H5FD__ros3_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__ros3_unlock(H5FD_t *_file);
 
 static herr_t H5FD__ros3_validate_config(const H5FD_ros3_fapl_t *fa);
+static herr_t H5FD__ros3_validate_cache_config(const H5FD_ros3_cache_config_t *config);
+static herr_t H5FD__ros3_get_cache_config(H5P_genplist_t *plist, H5FD_ros3_cache_config_t *config);
+
+static herr_t H5FD__ros3_read_ranges(H5FD_ros3_t *file, size_t count, const haddr_t addrs[],
+                                     const size_t sizes[], void *bufs[]);
+static herr_t H5FD__ros3_read_direct(H5FD_ros3_t *file, haddr_t addr, size_t size, void *buf);
+static herr_t H5FD__ros3_cache_insert(H5FD_ros3_t *file, haddr_t addr, const unsigned char *data,
+                                      size_t size);
+static herr_t H5FD__ros3_cache_read(H5FD_ros3_t *file, haddr_t addr, size_t size, void *buf);
+static herr_t H5FD__ros3_cache_dest(H5FD_ros3_t *file);
 
 static const H5FD_class_t H5FD_ros3_g = {
     "ros3",                   /* name                 */
@@ -274,6 +373,9 @@ static const H5FD_class_t H5FD_ros3_g = {
 /* Declare a free list to manage the H5FD_ros3_t struct */
 H5FL_DEFINE_STATIC(H5FD_ros3_t);
 
+/* Declare a free list to manage the H5FD_ros3_block_t struct */
+H5FL_DEFINE_STATIC(H5FD_ros3_block_t);
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__init_package
  *
@@ -506,6 +608,181 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_fapl_ros3() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_ros3_cache
+ *
+ * Purpose:     Set the block cache, read-ahead and concurrent request
+ *              configuration used by the ros3 driver for files opened
+ *              with this file access property list.
+ *
+ *              May be called before or after H5Pset_fapl_ros3().  Has no
+ *              effect on files opened with other drivers.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_ros3_cache(hid_t fapl_id, const H5FD_ros3_cache_config_t *config)
+{
+    H5P_genplist_t *         plist = NULL; /* Property list pointer */
+    H5FD_ros3_cache_config_t config_copy;
+    htri_t                   exists;
+    herr_t                   ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*x", fapl_id, config);
+
+#if ROS3_DEBUG
+    HDfprintf(stdout, "H5Pset_fapl_ros3_cache() called.\n");
+#endif
+
+    if (config == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "config is NULL")
+
+    plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS);
+    if (plist == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    if (FAIL == H5FD__ros3_validate_cache_config(config))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid ros3 cache config")
+
+    HDmemcpy(&config_copy, config, sizeof(H5FD_ros3_cache_config_t));
+
+    if ((exists = H5P_exist_plist(plist, ROS3_CACHE_CONFIG_PROP_NAME)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for ros3 cache config property")
+    if (exists) {
+        if (H5P_set(plist, ROS3_CACHE_CONFIG_PROP_NAME, &config_copy) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set ros3 cache config")
+    } /* end if */
+    else {
+        if (H5P_insert(plist, ROS3_CACHE_CONFIG_PROP_NAME, sizeof(H5FD_ros3_cache_config_t), &config_copy,
+                       NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTREGISTER, FAIL, "can't register ros3 cache config property")
+    } /* end else */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_ros3_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_ros3_cache
+ *
+ * Purpose:     Returns the block cache configuration the ros3 driver will
+ *              use for files opened with this file access property list:
+ *              the one set with H5Pset_fapl_ros3_cache(), or the defaults
+ *              if none was set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_ros3_cache(hid_t fapl_id, H5FD_ros3_cache_config_t *config_out)
+{
+    H5P_genplist_t *plist     = NULL;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*x", fapl_id, config_out);
+
+#if ROS3_DEBUG
+    HDfprintf(stdout, "H5Pget_fapl_ros3_cache() called.\n");
+#endif
+
+    if (config_out == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "config_out is NULL")
+
+    plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS);
+    if (plist == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+
+    if (FAIL == H5FD__ros3_get_cache_config(plist, config_out))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get ros3 cache config")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_ros3_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__ros3_validate_cache_config()
+ *
+ * Purpose:     Test to see if the supplied instance of
+ *              H5FD_ros3_cache_config_t contains internally consistent
+ *              data.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_validate_cache_config(const H5FD_ros3_cache_config_t *config)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(config != NULL);
+
+    if (config->version != H5FD_CURR_ROS3_CACHE_CONFIG_VERSION)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unknown H5FD_ros3_cache_config_t version")
+
+    /* The remaining fields are ignored if the cache is disabled */
+    if (config->block_size > 0) {
+        if (config->max_blocks == 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cache must hold at least one block")
+        if (config->max_read_ahead >= config->max_blocks)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "read-ahead must be smaller than the cache")
+        if (config->max_requests == 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "at least one request must be allowed")
+        if (config->max_blocks > ((size_t)-1) / config->block_size)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "cache size overflows")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_validate_cache_config() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__ros3_get_cache_config()
+ *
+ * Purpose:     Retrieve the block cache configuration from a file access
+ *              property list, falling back to the defaults if none has
+ *              been set.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_get_cache_config(H5P_genplist_t *plist, H5FD_ros3_cache_config_t *config)
+{
+    htri_t exists;
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(plist != NULL);
+    HDassert(config != NULL);
+
+    if ((exists = H5P_exist_plist(plist, ROS3_CACHE_CONFIG_PROP_NAME)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for ros3 cache config property")
+    if (exists) {
+        if (H5P_get(plist, ROS3_CACHE_CONFIG_PROP_NAME, config) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get ros3 cache config")
+    } /* end if */
+    else {
+        config->version        = H5FD_CURR_ROS3_CACHE_CONFIG_VERSION;
+        config->block_size     = H5FD_ROS3_DEFAULT_BLOCK_SIZE;
+        config->max_blocks     = H5FD_ROS3_DEFAULT_MAX_BLOCKS;
+        config->max_read_ahead = H5FD_ROS3_DEFAULT_MAX_READ_AHEAD;
+        config->max_requests   = H5FD_ROS3_DEFAULT_MAX_REQUESTS;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_get_cache_config() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__ros3_fapl_get
  *
@@ -661,6 +938,10 @@ ros3_reset_stats(H5FD_ros3_t *file)
         file->meta[i].max   = 0;
     }
 
+    file->cache_hits   = 0;
+    file->cache_misses = 0;
+    file->requests     = 0;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value);
 } /* end ros3_reset_stats() */
@@ -700,13 +981,15 @@ done:
 static H5FD_t *
 H5FD__ros3_open(const char *url, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
 {
-    H5FD_ros3_t *    file = NULL;
-    struct tm *      now  = NULL;
-    char             iso8601now[ISO8601_SIZE];
-    unsigned char    signing_key[SHA256_DIGEST_LENGTH];
-    s3r_t *          handle = NULL;
-    H5FD_ros3_fapl_t fa;
-    H5FD_t *         ret_value = NULL;
+    H5FD_ros3_t *            file = NULL;
+    struct tm *              now  = NULL;
+    char                     iso8601now[ISO8601_SIZE];
+    unsigned char            signing_key[SHA256_DIGEST_LENGTH];
+    s3r_t *                  handle = NULL;
+    H5FD_ros3_fapl_t         fa;
+    H5FD_ros3_cache_config_t cache_config;
+    H5P_genplist_t *         plist     = NULL;
+    H5FD_t *                 ret_value = NULL;
 
     FUNC_ENTER_STATIC
 
@@ -730,6 +1013,11 @@ H5FD__ros3_open(const char *url, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     if (FAIL == H5Pget_fapl_ros3(fapl_id, &fa))
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "can't get property list")
 
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if (FAIL == H5FD__ros3_get_cache_config(plist, &cache_config))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get ros3 cache config")
+
     if (CURLE_OK != curl_global_init(CURL_GLOBAL_DEFAULT))
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "unable to initialize curl global (placeholder flags)")
 
@@ -770,6 +1058,13 @@ H5FD__ros3_open(const char *url, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     file->s3r_handle = handle;
     HDmemcpy(&(file->fa), &fa, sizeof(H5FD_ros3_fapl_t));
 
+    /* Set up the block cache */
+    HDmemcpy(&(file->cache_config), &cache_config, sizeof(H5FD_ros3_cache_config_t));
+    if (cache_config.block_size > 0)
+        if (NULL == (file->cache_index = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCREATE, NULL, "can't create block cache index")
+    file->seq_next = HADDR_UNDEF;
+
 #if ROS3_STATS
     if (FAIL == ros3_reset_stats(file))
         HGOTO_ERROR(H5E_INTERNAL, H5E_UNINITIALIZED, NULL, "unable to reset file statistics")
@@ -782,8 +1077,11 @@ done:
         if (handle != NULL)
             if (FAIL == H5FD_s3comms_s3r_close(handle))
                 HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, NULL, "unable to close s3 file handle")
-        if (file != NULL)
+        if (file != NULL) {
+            if (file->cache_index != NULL)
+                H5SL_close(file->cache_index);
             file = H5FL_FREE(H5FD_ros3_t, file);
+        } /* end if */
         curl_global_cleanup(); /* early cleanup because open failed */
     }                          /* end if null return value (error) */
 
@@ -931,6 +1229,8 @@ ros3_fprint_stats(FILE *stream, const H5FD_ros3_t *file)
               count_raw);
     HDfprintf(stream, "TOTAL BYTES: %llu  (%llu meta, %llu raw)\n", bytes_raw + bytes_meta, bytes_meta,
               bytes_raw);
+    HDfprintf(stream, "CACHE: %llu blocks hit, %llu blocks missed, %llu requests\n", file->cache_hits,
+              file->cache_misses, file->requests);
 
     if (count_raw + count_meta == 0)
         goto done;
@@ -1108,6 +1408,10 @@ H5FD__ros3_close(H5FD_t H5_ATTR_UNUSED *_file)
     if (FAIL == H5FD_s3comms_s3r_close(file->s3r_handle))
         HGOTO_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "unable to close S3 request handle")
 
+    /* Release the block cache */
+    if (FAIL == H5FD__ros3_cache_dest(file))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to release block cache")
+
 #if ROS3_STATS
     /* TODO: mechanism to re-target stats printout */
     if (ros3_fprint_stats(stdout, file) == FAIL)
@@ -1426,6 +1730,414 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__ros3_get_handle() */
 
+/*-------------------------------------------------------------------------
+ *
+ * Function: H5FD__ros3_read_ranges()
+ *
+ * Purpose:
+ *
+ *     Read `count` byte ranges of the file from the server, issuing up to
+ *     the configured number of range requests concurrently.
+ *
+ * Return:
+ *
+ *     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_read_ranges(H5FD_ros3_t *file, size_t count, const haddr_t addrs[], const size_t sizes[],
+                       void *bufs[])
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file != NULL);
+    HDassert(file->cache_config.max_requests > 0);
+
+    if (FAIL == H5FD_s3comms_s3r_read_multi(file->s3r_handle, count, addrs, sizes, bufs,
+                                            file->cache_config.max_requests))
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to execute read")
+
+#if ROS3_STATS
+    file->requests += count;
+#endif /* ROS3_STATS */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_read_ranges() */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function: H5FD__ros3_read_direct()
+ *
+ * Purpose:
+ *
+ *     Read a range too large to be cached straight into the caller's
+ *     buffer, split along block boundaries into as many concurrent range
+ *     requests as the configuration allows.
+ *
+ * Return:
+ *
+ *     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_read_direct(H5FD_ros3_t *file, haddr_t addr, size_t size, void *_buf)
+{
+    unsigned char *buf    = (unsigned char *)_buf;
+    haddr_t *      addrs  = NULL;
+    size_t *       sizes  = NULL;
+    void **        bufs   = NULL;
+    size_t         bsize  = file->cache_config.block_size;
+    size_t         nparts = 0;
+    size_t         part_size;
+    size_t         offset;
+    size_t         u;
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(bsize > 0);
+    HDassert(size > 0);
+
+    /* Split into at most max_requests parts of whole blocks */
+    nparts = MIN(file->cache_config.max_requests, (size + bsize - 1) / bsize);
+    HDassert(nparts > 0);
+    part_size = (size + nparts - 1) / nparts;
+    part_size = ((part_size + bsize - 1) / bsize) * bsize;
+
+    if (NULL == (addrs = (haddr_t *)H5MM_malloc(nparts * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if (NULL == (sizes = (size_t *)H5MM_malloc(nparts * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if (NULL == (bufs = (void **)H5MM_malloc(nparts * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+    for (u = 0, offset = 0; offset < size; u++) {
+        HDassert(u < nparts);
+        addrs[u] = addr + offset;
+        sizes[u] = MIN(part_size, size - offset);
+        bufs[u]  = buf + offset;
+        offset += sizes[u];
+    } /* end for */
+
+    if (FAIL == H5FD__ros3_read_ranges(file, u, addrs, sizes, bufs))
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to read range")
+
+done:
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_read_direct() */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function: H5FD__ros3_cache_insert()
+ *
+ * Purpose:
+ *
+ *     Add a copy of the block at `addr` to the block cache as its most
+ *     recently used block, evicting the least recently used block if the
+ *     cache is full.
+ *
+ * Return:
+ *
+ *     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_cache_insert(H5FD_ros3_t *file, haddr_t addr, const unsigned char *data, size_t size)
+{
+    H5FD_ros3_block_t *block     = NULL;
+    herr_t             ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file->cache_index != NULL);
+    HDassert(NULL == H5SL_search(file->cache_index, &addr));
+
+    /* Make room, reusing the evicted block if it has the same size */
+    if (file->cache_nblocks >= file->cache_config.max_blocks) {
+        block = file->cache_tail;
+        HDassert(block != NULL);
+
+        if (NULL == H5SL_remove(file->cache_index, &block->addr))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTDELETE, FAIL, "can't remove block from cache index")
+        file->cache_tail = block->prev;
+        if (file->cache_tail != NULL)
+            file->cache_tail->next = NULL;
+        else
+            file->cache_head = NULL;
+        file->cache_nblocks--;
+
+        if (block->size != size)
+            block->data = (unsigned char *)H5MM_xfree(block->data);
+    } /* end if */
+    else if (NULL == (block = H5FL_CALLOC(H5FD_ros3_block_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate cache block")
+
+    if (block->data == NULL)
+        if (NULL == (block->data = (unsigned char *)H5MM_malloc(size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate cache block data")
+    HDmemcpy(block->data, data, size);
+    block->addr = addr;
+    block->size = size;
+
+    if (H5SL_insert(file->cache_index, block, &block->addr) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, FAIL, "can't insert block into cache index")
+
+    /* Link as most recently used */
+    block->prev = NULL;
+    block->next = file->cache_head;
+    if (file->cache_head != NULL)
+        file->cache_head->prev = block;
+    else
+        file->cache_tail = block;
+    file->cache_head = block;
+    file->cache_nblocks++;
+    block = NULL;
+
+done:
+    if (block != NULL) {
+        H5MM_xfree(block->data);
+        block = H5FL_FREE(H5FD_ros3_block_t, block);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_cache_insert() */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function: H5FD__ros3_cache_read()
+ *
+ * Purpose:
+ *
+ *     Satisfy a read through the block cache.
+ *
+ *     Every block overlapping the read is looked up in the cache; missing
+ *     blocks, together with any read-ahead blocks, are grouped into runs
+ *     of adjacent blocks and fetched with one range request per run, the
+ *     runs being split so that the configured number of requests can be
+ *     in flight at once.
+ *
+ *     The read-ahead window grows (1, 2, 4, ... blocks up to the
+ *     configured maximum) while each read starts where the previous one
+ *     ended, and collapses as soon as access is not sequential.
+ *
+ *     Reads spanning more than half the cache bypass it.
+ *
+ * Return:
+ *
+ *     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_cache_read(H5FD_ros3_t *file, haddr_t addr, size_t size, void *_buf)
+{
+    const H5FD_ros3_cache_config_t *config     = &file->cache_config;
+    unsigned char *                 buf        = (unsigned char *)_buf;
+    haddr_t                         bsize      = (haddr_t)config->block_size;
+    haddr_t                         eof        = 0;
+    haddr_t                         first      = 0; /* First block of the read             */
+    haddr_t                         last       = 0; /* Last block of the read              */
+    haddr_t                         fetch_last = 0; /* Last block of the read-ahead window */
+    haddr_t                         b;
+    size_t                          span     = 0; /* Number of blocks in the read        */
+    size_t                          nmissing = 0; /* Number of blocks to fetch           */
+    size_t                          run_max  = 0; /* Max number of blocks per request    */
+    size_t                          nruns    = 0;
+    haddr_t *                       addrs    = NULL;
+    size_t *                        sizes    = NULL;
+    void **                         bufs     = NULL;
+    size_t                          u;
+    herr_t                          ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file->cache_index != NULL);
+    HDassert(size > 0);
+
+    eof   = (haddr_t)H5FD_s3comms_s3r_get_filesize(file->s3r_handle);
+    first = addr / bsize;
+    last  = (addr + size - 1) / bsize;
+    span  = (size_t)(last - first + 1);
+
+    /* Large reads go straight to the server */
+    if (span > MAX(1, config->max_blocks / 2)) {
+        if (FAIL == H5FD__ros3_read_direct(file, addr, size, buf))
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to read range")
+        file->seq_next   = addr + size;
+        file->read_ahead = 0;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Adapt the read-ahead window, never letting it push blocks of this
+     * read out of the cache
+     */
+    if (addr == file->seq_next && config->max_read_ahead > 0)
+        file->read_ahead = MIN(MAX(1, 2 * file->read_ahead), config->max_read_ahead);
+    else
+        file->read_ahead = 0;
+    file->read_ahead = MIN(file->read_ahead, config->max_blocks - span);
+    file->seq_next   = addr + size;
+
+    fetch_last = MIN(last + file->read_ahead, (eof - 1) / bsize);
+
+    /* Mark requested blocks already cached as most recently used, and count
+     * the blocks to fetch
+     */
+    for (b = first; b <= fetch_last; b++) {
+        haddr_t            baddr = b * bsize;
+        H5FD_ros3_block_t *block = (H5FD_ros3_block_t *)H5SL_search(file->cache_index, &baddr);
+
+        if (block == NULL)
+            nmissing++;
+        else if (b <= last && block != file->cache_head) {
+            block->prev->next = block->next;
+            if (block->next != NULL)
+                block->next->prev = block->prev;
+            else
+                file->cache_tail = block->prev;
+            block->prev            = NULL;
+            block->next            = file->cache_head;
+            file->cache_head->prev = block;
+            file->cache_head       = block;
+        } /* end if */
+
+#if ROS3_STATS
+        if (b <= last) {
+            if (block == NULL)
+                file->cache_misses++;
+            else
+                file->cache_hits++;
+        } /* end if */
+#endif /* ROS3_STATS */
+    }     /* end for */
+
+    /* Fetch missing blocks in runs of adjacent blocks */
+    if (nmissing > 0) {
+        size_t max_runs;
+
+        run_max  = MAX(1, (nmissing + config->max_requests - 1) / config->max_requests);
+        max_runs = nmissing;
+
+        if (NULL == (addrs = (haddr_t *)H5MM_malloc(max_runs * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        if (NULL == (sizes = (size_t *)H5MM_malloc(max_runs * sizeof(size_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        if (NULL == (bufs = (void **)H5MM_calloc(max_runs * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+        for (b = first; b <= fetch_last; b++) {
+            haddr_t baddr = b * bsize;
+            haddr_t bend  = MIN(baddr + bsize, eof);
+
+            if (NULL != H5SL_search(file->cache_index, &baddr))
+                continue;
+
+            /* Extend the current run, or start a new one */
+            if (nruns > 0 && addrs[nruns - 1] + sizes[nruns - 1] == baddr &&
+                sizes[nruns - 1] < run_max * (size_t)bsize)
+                sizes[nruns - 1] += (size_t)(bend - baddr);
+            else {
+                HDassert(nruns < max_runs);
+                addrs[nruns] = baddr;
+                sizes[nruns] = (size_t)(bend - baddr);
+                nruns++;
+            } /* end else */
+        }     /* end for */
+
+        for (u = 0; u < nruns; u++)
+            if (NULL == (bufs[u] = H5MM_malloc(sizes[u])))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+        if (FAIL == H5FD__ros3_read_ranges(file, nruns, addrs, sizes, bufs))
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to read blocks")
+
+        /* Cache the fetched blocks, read-ahead included */
+        for (u = 0; u < nruns; u++) {
+            size_t offset;
+
+            for (offset = 0; offset < sizes[u]; offset += (size_t)bsize)
+                if (FAIL == H5FD__ros3_cache_insert(file, addrs[u] + offset,
+                                                    (const unsigned char *)bufs[u] + offset,
+                                                    MIN((size_t)bsize, sizes[u] - offset)))
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, FAIL, "unable to cache block")
+        } /* end for */
+    }     /* end if */
+
+    /* Copy the requested bytes out of the cache */
+    for (b = first; b <= last; b++) {
+        haddr_t                  baddr = b * bsize;
+        const H5FD_ros3_block_t *block = (const H5FD_ros3_block_t *)H5SL_search(file->cache_index, &baddr);
+        haddr_t                  start, end;
+
+        HDassert(block != NULL);
+        start = MAX(addr, baddr);
+        end   = MIN(addr + size, baddr + block->size);
+        HDmemcpy(buf + (start - addr), block->data + (start - baddr), (size_t)(end - start));
+    } /* end for */
+
+done:
+    if (bufs != NULL)
+        for (u = 0; u < nruns; u++)
+            H5MM_xfree(bufs[u]);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_cache_read() */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function: H5FD__ros3_cache_dest()
+ *
+ * Purpose:
+ *
+ *     Discard all cached blocks and the cache index.
+ *
+ * Return:
+ *
+ *     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__ros3_cache_dest(H5FD_ros3_t *file)
+{
+    H5FD_ros3_block_t *block     = NULL;
+    herr_t             ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file != NULL);
+
+    while (NULL != (block = file->cache_head)) {
+        file->cache_head = block->next;
+        H5MM_xfree(block->data);
+        block = H5FL_FREE(H5FD_ros3_block_t, block);
+    } /* end while */
+    file->cache_tail    = NULL;
+    file->cache_nblocks = 0;
+
+    if (file->cache_index != NULL) {
+        if (H5SL_close(file->cache_index) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCLOSEOBJ, FAIL, "can't close block cache index")
+        file->cache_index = NULL;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__ros3_cache_dest() */
+
 /*-------------------------------------------------------------------------
  *
  * Function: H5FD__ros3_read()
@@ -1435,6 +2147,8 @@ done:
  *     Reads SIZE bytes of data from FILE beginning at address ADDR
  *     into buffer BUF according to data transfer properties in DXPL_ID.
  *
+ *     Goes through the block cache unless it has been disabled.
+ *
  * Return:
  *
  *     Success: `SUCCEED`
@@ -1476,7 +2190,11 @@ H5FD__ros3_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
     if ((addr > filesize) || ((addr + size) > filesize))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "range exceeds file address")
 
-    if (H5FD_s3comms_s3r_read(file->s3r_handle, addr, size, buf) == FAIL)
+    if (file->cache_index != NULL && size > 0) {
+        if (H5FD__ros3_cache_read(file, addr, size, buf) == FAIL)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to read through block cache")
+    } /* end if */
+    else if (H5FD_s3comms_s3r_read(file->s3r_handle, addr, size, buf) == FAIL)
         HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to execute read")
 
 #if ROS3_STATS
@@ -85,6 +85,73 @@ typedef struct H5FD_ros3_fapl_t {
     char    secret_key[H5FD_ROS3_MAX_SECRET_KEY_LEN + 1];
 } H5FD_ros3_fapl_t;
 
+/****************************************************************************
+ *
+ * Structure: H5FD_ros3_cache_config_t
+ *
+ * Purpose:
+ *
+ *     H5FD_ros3_cache_config_t is a public structure that is used to tune
+ *     the in-memory block cache and request scheduling of the ros3 VFD.
+ *     A pointer to an instance of this structure is a parameter to
+ *     H5Pset_fapl_ros3_cache() and H5Pget_fapl_ros3_cache().
+ *
+ *     The file is divided into blocks of `block_size` bytes, aligned on
+ *     multiples of `block_size`.  Reads are satisfied from cached blocks
+ *     where possible; missing blocks are fetched from the server and the
+ *     least recently used blocks are discarded to make room.
+ *
+ *
+ *
+ * `version` (int32_t)
+ *
+ *     Version number of the H5FD_ros3_cache_config_t structure.  Any
+ *     instance passed to the above calls must have a recognized version
+ *     number, or an error will be flagged.
+ *
+ *     This field should be set to H5FD_CURR_ROS3_CACHE_CONFIG_VERSION.
+ *
+ * `block_size` (size_t)
+ *
+ *     Size in bytes of a cached block.  Zero disables the cache, read-ahead
+ *     and concurrent requests: every read becomes one range request.
+ *
+ * `max_blocks` (size_t)
+ *
+ *     Maximum number of blocks held in the cache.  Reads spanning more than
+ *     half this number of blocks bypass the cache.  Must be positive if the
+ *     cache is enabled.
+ *
+ * `max_read_ahead` (size_t)
+ *
+ *     Maximum number of blocks fetched beyond the end of a read once
+ *     sequential access is detected.  The read-ahead window starts at one
+ *     block and doubles with each consecutive sequential read, up to this
+ *     limit.  Zero disables read-ahead.  Must be less than `max_blocks`.
+ *
+ * `max_requests` (size_t)
+ *
+ *     Maximum number of range requests in flight at the same time when a
+ *     read requires several blocks.  One issues the requests one after
+ *     another.  Must be positive if the cache is enabled.
+ *
+ ****************************************************************************/
+
+#define H5FD_CURR_ROS3_CACHE_CONFIG_VERSION 1
+
+#define H5FD_ROS3_DEFAULT_BLOCK_SIZE     (64 * 1024)
+#define H5FD_ROS3_DEFAULT_MAX_BLOCKS     256
+#define H5FD_ROS3_DEFAULT_MAX_READ_AHEAD 16
+#define H5FD_ROS3_DEFAULT_MAX_REQUESTS   4
+
+typedef struct H5FD_ros3_cache_config_t {
+    int32_t version;
+    size_t  block_size;
+    size_t  max_blocks;
+    size_t  max_read_ahead;
+    size_t  max_requests;
+} H5FD_ros3_cache_config_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -92,6 +159,8 @@ extern "C" {
 H5_DLL hid_t  H5FD_ros3_init(void);
 H5_DLL herr_t H5Pget_fapl_ros3(hid_t fapl_id, H5FD_ros3_fapl_t *fa_out);
 H5_DLL herr_t H5Pset_fapl_ros3(hid_t fapl_id, H5FD_ros3_fapl_t *fa);
+H5_DLL herr_t H5Pget_fapl_ros3_cache(hid_t fapl_id, H5FD_ros3_cache_config_t *config_out);
+H5_DLL herr_t H5Pset_fapl_ros3_cache(hid_t fapl_id, const H5FD_ros3_cache_config_t *config);
 
 #ifdef __cplusplus
 }
@@ -94,6 +94,9 @@ size_t curlwritecallback(char *ptr, size_t size, size_t nmemb, void *userdata);
 
 herr_t H5FD_s3comms_s3r_getsize(s3r_t *handle);
 
+static herr_t H5FD__s3comms_s3r_configure_request(s3r_t *handle, CURL *curlh, haddr_t offset, size_t len,
+                                                  struct curl_slist **curlheaders);
+
 /*********************/
 /* Package Variables */
 /*********************/
@@ -1163,101 +1166,51 @@ done:
 
 /*----------------------------------------------------------------------------
  *
- * Function: H5FD_s3comms_s3r_read()
+ * Function: H5FD__s3comms_s3r_configure_request()
  *
  * Purpose:
  *
- *     Read file pointed to by request handle, writing specified
- *     `offset` .. `offset + len` bytes to buffer `dest`.
- *
- *     If `len` is 0, reads entirety of file starting at `offset`.
- *     If `offset` and `len` are both 0, reads entire file.
- *
- *     If `offset` or `offset+len` is greater than the file size, read is
- *     aborted and returns `FAIL`.
+ *     Prepare curl easy handle `curlh` to request bytes `offset` ..
+ *     `offset + len` of the resource identified by `handle`.
  *
- *     Uses configured "curl easy handle" to perform request.
+ *     Sets the HTTP Range (if any) and, if `handle` is set to authenticate,
+ *     generates the AWS4 authorization headers for the request.
  *
- *     In event of error, buffer should remain unaltered.
+ *     The curl header list set in `curlh` is returned through `curlheaders`
+ *     and must remain valid until the request has been performed, after
+ *     which the caller is responsible for freeing it with
+ *     `curl_slist_free_all()`.  `*curlheaders` is NULL if no headers were
+ *     required.
  *
- *     If handle is set to authorize a request, creates a new (temporary)
- *     HTTP Request object (hrb_t) for generating requisite headers,
- *     which is then translated to a `curl slist` and set in the curl handle
- *     for the request.
- *
- *     `dest` _may_ be NULL, but no body data will be recorded.
- *
- *     - In general practice, NULL should never be passed in as `dest`.
- *     - NULL `dest` passed in by internal function `s3r_getsize()`, in
- *       conjunction with CURLOPT_NOBODY to preempt transmission of file data
- *       from server.
+ *     `len` and `offset` are interpreted as in `H5FD_s3comms_s3r_read()`.
  *
  * Return:
  *
  *     - SUCCESS: `SUCCEED`
  *     - FAILURE: `FAIL`
  *
- * Programmer: Jacob Smith
- *             2017-08-22
- *
  *----------------------------------------------------------------------------
  */
-herr_t
-H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
+static herr_t
+H5FD__s3comms_s3r_configure_request(s3r_t *handle, CURL *curlh, haddr_t offset, size_t len,
+                                    struct curl_slist **curlheaders)
 {
-    CURL *             curlh         = NULL;
-    CURLcode           p_status      = CURLE_OK;
-    struct curl_slist *curlheaders   = NULL;
-    hrb_node_t *       headers       = NULL;
-    hrb_node_t *       node          = NULL;
-    struct tm *        now           = NULL;
-    char *             rangebytesstr = NULL;
-    hrb_t *            request       = NULL;
-    int                ret           = 0; /* working variable to check  */
-                                          /* return value of HDsnprintf  */
-    struct s3r_datastruct *sds       = NULL;
-    herr_t                 ret_value = SUCCEED;
-
-    FUNC_ENTER_NOAPI_NOINIT
+    hrb_node_t *headers       = NULL;
+    hrb_node_t *node          = NULL;
+    struct tm * now           = NULL;
+    char *      rangebytesstr = NULL;
+    hrb_t *     request       = NULL;
+    int         ret           = 0; /* working variable to check  */
+                                   /* return value of HDsnprintf  */
+    herr_t ret_value = SUCCEED;
 
-#if S3COMMS_DEBUG
-    HDfprintf(stdout, "called H5FD_s3comms_s3r_read.\n");
-#endif
+    FUNC_ENTER_STATIC
 
-    /**************************************
-     * ABSOLUTELY NECESSARY SANITY-CHECKS *
-     **************************************/
+    HDassert(handle != NULL);
+    HDassert(curlh != NULL);
+    HDassert(curlheaders != NULL);
 
-    if (handle == NULL)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle cannot be null.");
-    if (handle->magic != S3COMMS_S3R_MAGIC)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has invalid magic.");
-    if (handle->curlhandle == NULL)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has bad (null) curlhandle.")
-    if (handle->purl == NULL)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has bad (null) url.")
-    HDassert(handle->purl->magic == S3COMMS_PARSED_URL_MAGIC);
-    if (offset > handle->filesize || (len + offset) > handle->filesize)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to read past EoF")
-
-    curlh = handle->curlhandle;
-
-    /*********************
-     * PREPARE WRITEDATA *
-     *********************/
-
-    if (dest != NULL) {
-        sds = (struct s3r_datastruct *)H5MM_malloc(sizeof(struct s3r_datastruct));
-        if (sds == NULL)
-            HGOTO_ERROR(H5E_ARGS, H5E_CANTALLOC, FAIL, "could not malloc destination datastructure.");
-
-        sds->magic = S3COMMS_CALLBACK_DATASTRUCT_MAGIC;
-        sds->data  = (char *)dest;
-        sds->size  = 0;
-        if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_WRITEDATA, sds))
-            HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL,
-                        "error while setting CURL option (CURLOPT_WRITEDATA).");
-    }
+    *curlheaders = NULL;
 
     /*********************
      * FORMAT HTTP RANGE *
@@ -1296,6 +1249,7 @@ H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
             bytesrange_ptr++; /* move to first char past '=' */
             HDassert(*bytesrange_ptr != '\0');
 
+            /* curl keeps its own copy of the string */
             if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_RANGE, bytesrange_ptr))
                 HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL,
                             "error while setting CURL option (CURLOPT_RANGE). ");
@@ -1422,23 +1376,142 @@ H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
         node = request->first_header;
         while (node != NULL) {
             HDassert(node->magic == S3COMMS_HRB_NODE_MAGIC);
-            curlheaders = curl_slist_append(curlheaders, (const char *)node->cat);
-            if (curlheaders == NULL)
+            *curlheaders = curl_slist_append(*curlheaders, (const char *)node->cat);
+            if (*curlheaders == NULL)
                 HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not append header to curl slist.");
             node = node->next;
         }
 
         /* sanity-check */
-        if (curlheaders == NULL)
+        if (*curlheaders == NULL)
             /* above loop was probably never run */
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "curlheaders was never populated.");
 
         /* finally, set http headers in curl handle */
-        if (curl_easy_setopt(curlh, CURLOPT_HTTPHEADER, curlheaders) != CURLE_OK)
+        if (curl_easy_setopt(curlh, CURLOPT_HTTPHEADER, *curlheaders) != CURLE_OK)
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
                         "error while setting CURL option (CURLOPT_HTTPHEADER).");
     } /* end if should authenticate (info provided) */
 
+done:
+    if (rangebytesstr != NULL)
+        H5MM_xfree(rangebytesstr);
+    if (request != NULL) {
+        while (headers != NULL)
+            if (FAIL == H5FD_s3comms_hrb_node_set(&headers, headers->name, NULL))
+                HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot release header node")
+        HDassert(NULL == headers);
+        if (FAIL == H5FD_s3comms_hrb_destroy(&request))
+            HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot release header request structure")
+        HDassert(NULL == request);
+    }
+    if (ret_value < 0 && *curlheaders != NULL) {
+        curl_easy_setopt(curlh, CURLOPT_HTTPHEADER, NULL);
+        curl_slist_free_all(*curlheaders);
+        *curlheaders = NULL;
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__s3comms_s3r_configure_request() */
+
+/*----------------------------------------------------------------------------
+ *
+ * Function: H5FD_s3comms_s3r_read()
+ *
+ * Purpose:
+ *
+ *     Read file pointed to by request handle, writing specified
+ *     `offset` .. `offset + len` bytes to buffer `dest`.
+ *
+ *     If `len` is 0, reads entirety of file starting at `offset`.
+ *     If `offset` and `len` are both 0, reads entire file.
+ *
+ *     If `offset` or `offset+len` is greater than the file size, read is
+ *     aborted and returns `FAIL`.
+ *
+ *     Uses configured "curl easy handle" to perform request.
+ *
+ *     In event of error, buffer should remain unaltered.
+ *
+ *     If handle is set to authorize a request, creates a new (temporary)
+ *     HTTP Request object (hrb_t) for generating requisite headers,
+ *     which is then translated to a `curl slist` and set in the curl handle
+ *     for the request.
+ *
+ *     `dest` _may_ be NULL, but no body data will be recorded.
+ *
+ *     - In general practice, NULL should never be passed in as `dest`.
+ *     - NULL `dest` passed in by internal function `s3r_getsize()`, in
+ *       conjunction with CURLOPT_NOBODY to preempt transmission of file data
+ *       from server.
+ *
+ * Return:
+ *
+ *     - SUCCESS: `SUCCEED`
+ *     - FAILURE: `FAIL`
+ *
+ * Programmer: Jacob Smith
+ *             2017-08-22
+ *
+ *----------------------------------------------------------------------------
+ */
+herr_t
+H5FD_s3comms_s3r_read(s3r_t *handle, haddr_t offset, size_t len, void *dest)
+{
+    CURL *                 curlh       = NULL;
+    CURLcode               p_status    = CURLE_OK;
+    struct curl_slist *    curlheaders = NULL;
+    struct s3r_datastruct *sds         = NULL;
+    herr_t                 ret_value   = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+#if S3COMMS_DEBUG
+    HDfprintf(stdout, "called H5FD_s3comms_s3r_read.\n");
+#endif
+
+    /**************************************
+     * ABSOLUTELY NECESSARY SANITY-CHECKS *
+     **************************************/
+
+    if (handle == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle cannot be null.");
+    if (handle->magic != S3COMMS_S3R_MAGIC)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has invalid magic.");
+    if (handle->curlhandle == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has bad (null) curlhandle.")
+    if (handle->purl == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has bad (null) url.")
+    HDassert(handle->purl->magic == S3COMMS_PARSED_URL_MAGIC);
+    if (offset > handle->filesize || (len + offset) > handle->filesize)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to read past EoF")
+
+    curlh = handle->curlhandle;
+
+    /*********************
+     * PREPARE WRITEDATA *
+     *********************/
+
+    if (dest != NULL) {
+        sds = (struct s3r_datastruct *)H5MM_malloc(sizeof(struct s3r_datastruct));
+        if (sds == NULL)
+            HGOTO_ERROR(H5E_ARGS, H5E_CANTALLOC, FAIL, "could not malloc destination datastructure.");
+
+        sds->magic = S3COMMS_CALLBACK_DATASTRUCT_MAGIC;
+        sds->data  = (char *)dest;
+        sds->size  = 0;
+        if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_WRITEDATA, sds))
+            HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL,
+                        "error while setting CURL option (CURLOPT_WRITEDATA).");
+    }
+
+    /*******************
+     * COMPILE REQUEST *
+     *******************/
+
+    if (FAIL == H5FD__s3comms_s3r_configure_request(handle, curlh, offset, len, &curlheaders))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to configure request")
+
     /*******************
      * PERFORM REQUEST *
      *******************/
@@ -1498,23 +1571,10 @@ done:
         curl_slist_free_all(curlheaders);
         curlheaders = NULL;
     }
-    if (rangebytesstr != NULL) {
-        H5MM_xfree(rangebytesstr);
-        rangebytesstr = NULL;
-    }
     if (sds != NULL) {
         H5MM_xfree(sds);
         sds = NULL;
     }
-    if (request != NULL) {
-        while (headers != NULL)
-            if (FAIL == H5FD_s3comms_hrb_node_set(&headers, headers->name, NULL))
-                HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot release header node")
-        HDassert(NULL == headers);
-        if (FAIL == H5FD_s3comms_hrb_destroy(&request))
-            HDONE_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "cannot release header request structure")
-        HDassert(NULL == request);
-    }
 
     if (curlh != NULL) {
         /* clear any Range */
@@ -1529,6 +1589,188 @@ done:
     FUNC_LEAVE_NOAPI(ret_value);
 } /* H5FD_s3comms_s3r_read */
 
+/*----------------------------------------------------------------------------
+ *
+ * Function: H5FD_s3comms_s3r_read_multi()
+ *
+ * Purpose:
+ *
+ *     Read `count` byte ranges of the file pointed to by request handle,
+ *     writing bytes `offsets[i]` .. `offsets[i] + lens[i]` to buffer
+ *     `dests[i]`.
+ *
+ *     Requests are issued concurrently through a curl "multi handle", with
+ *     at most `max_active` transfers in flight at any time.  Each transfer
+ *     uses its own curl easy handle, duplicated from the handle's
+ *     configured one.  If `max_active` is 1 (or `count` is 1), the ranges
+ *     are read one after another with `H5FD_s3comms_s3r_read()`.
+ *
+ *     Unlike `H5FD_s3comms_s3r_read()`, every length must be non-zero and
+ *     every destination buffer must be non-NULL.
+ *
+ *     In event of error, the contents of all destination buffers are
+ *     undefined.
+ *
+ * Return:
+ *
+ *     - SUCCESS: `SUCCEED`
+ *     - FAILURE: `FAIL`
+ *
+ *----------------------------------------------------------------------------
+ */
+herr_t
+H5FD_s3comms_s3r_read_multi(s3r_t *handle, size_t count, const haddr_t offsets[], const size_t lens[],
+                            void *dests[], size_t max_active)
+{
+    CURLM *                multih      = NULL;
+    CURL **                easyh       = NULL; /* one easy handle per range  */
+    struct curl_slist **   curlheaders = NULL; /* one header list per range  */
+    struct s3r_datastruct *sds         = NULL; /* one write target per range */
+    size_t                 n_started   = 0;
+    size_t                 n_active    = 0;
+    size_t                 n_done      = 0;
+    size_t                 u;
+    herr_t                 ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+#if S3COMMS_DEBUG
+    HDfprintf(stdout, "called H5FD_s3comms_s3r_read_multi.\n");
+#endif
+
+    if (handle == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle cannot be null.");
+    if (handle->magic != S3COMMS_S3R_MAGIC)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has invalid magic.");
+    if (handle->curlhandle == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "handle has bad (null) curlhandle.")
+    if (count > 0 && (offsets == NULL || lens == NULL || dests == NULL))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "range arrays cannot be null.")
+    for (u = 0; u < count; u++) {
+        if (lens[u] == 0 || dests[u] == NULL)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "empty range or null destination.")
+        if (offsets[u] > handle->filesize || (lens[u] + offsets[u]) > handle->filesize)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to read past EoF")
+    } /* end for */
+
+    /* Nothing to overlap, use the configured handle directly */
+    if (count <= 1 || max_active <= 1) {
+        for (u = 0; u < count; u++)
+            if (FAIL == H5FD_s3comms_s3r_read(handle, offsets[u], lens[u], dests[u]))
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to read range")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /*********************
+     * PREPARE TRANSFERS *
+     *********************/
+
+    if (NULL == (multih = curl_multi_init()))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "problem creating curl multi handle!");
+    if (NULL == (easyh = (CURL **)H5MM_calloc(count * sizeof(CURL *))))
+        HGOTO_ERROR(H5E_ARGS, H5E_CANTALLOC, FAIL, "could not malloc curl handle array.");
+    if (NULL == (curlheaders = (struct curl_slist **)H5MM_calloc(count * sizeof(struct curl_slist *))))
+        HGOTO_ERROR(H5E_ARGS, H5E_CANTALLOC, FAIL, "could not malloc curl header array.");
+    if (NULL == (sds = (struct s3r_datastruct *)H5MM_malloc(count * sizeof(struct s3r_datastruct))))
+        HGOTO_ERROR(H5E_ARGS, H5E_CANTALLOC, FAIL, "could not malloc destination datastructures.");
+
+    /*********************
+     * PERFORM TRANSFERS *
+     *********************/
+
+    while (n_done < count) {
+        CURLMsg *msg         = NULL;
+        int      msgs_left   = 0;
+        int      still_alive = 0;
+
+        /* Keep the pipe full */
+        while (n_active < max_active && n_started < count) {
+            u = n_started;
+
+            if (NULL == (easyh[u] = curl_easy_duphandle(handle->curlhandle)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "problem duplicating curl easy handle!");
+
+            sds[u].magic = S3COMMS_CALLBACK_DATASTRUCT_MAGIC;
+            sds[u].data  = (char *)dests[u];
+            sds[u].size  = 0;
+            if (CURLE_OK != curl_easy_setopt(easyh[u], CURLOPT_WRITEDATA, &sds[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_UNINITIALIZED, FAIL,
+                            "error while setting CURL option (CURLOPT_WRITEDATA).");
+
+            if (FAIL ==
+                H5FD__s3comms_s3r_configure_request(handle, easyh[u], offsets[u], lens[u], &curlheaders[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to configure request")
+
+            if (CURLM_OK != curl_multi_add_handle(multih, easyh[u]))
+                HGOTO_ERROR(H5E_VFL, H5E_CANTOPENFILE, FAIL, "unable to add request to curl multi handle")
+
+            n_started++;
+            n_active++;
+        } /* end while */
+
+        if (CURLM_OK != curl_multi_perform(multih, &still_alive))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTOPENFILE, FAIL, "curl cannot perform requests")
+
+        /* Retire finished transfers */
+        while (NULL != (msg = curl_multi_info_read(multih, &msgs_left))) {
+            if (msg->msg != CURLMSG_DONE)
+                continue;
+
+            for (u = 0; u < n_started; u++)
+                if (easyh[u] == msg->easy_handle)
+                    break;
+            HDassert(u < n_started);
+
+            if (msg->data.result != CURLE_OK) {
+#if S3COMMS_CURL_VERBOSITY > 0
+                HDfprintf(stderr, "CURL ERROR CODE: %d\n%s\n", msg->data.result,
+                          curl_easy_strerror(msg->data.result));
+#endif
+                HGOTO_ERROR(H5E_VFL, H5E_CANTOPENFILE, FAIL, "curl cannot perform request")
+            } /* end if */
+            if (sds[u].size != lens[u])
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "server returned unexpected number of bytes")
+
+            curl_multi_remove_handle(multih, easyh[u]);
+            curl_easy_cleanup(easyh[u]);
+            easyh[u] = NULL;
+            curl_slist_free_all(curlheaders[u]);
+            curlheaders[u] = NULL;
+
+            n_active--;
+            n_done++;
+        } /* end while */
+
+        /* Wait for activity on any of the remaining transfers */
+        if (n_done < count && still_alive > 0)
+            if (CURLM_OK != curl_multi_wait(multih, NULL, 0, 1000, NULL))
+                HGOTO_ERROR(H5E_VFL, H5E_CANTOPENFILE, FAIL, "curl cannot wait on requests")
+    } /* end while */
+
+done:
+    if (easyh != NULL) {
+        for (u = 0; u < count; u++)
+            if (easyh[u] != NULL) {
+                if (multih != NULL)
+                    curl_multi_remove_handle(multih, easyh[u]);
+                curl_easy_cleanup(easyh[u]);
+            } /* end if */
+        H5MM_xfree(easyh);
+    } /* end if */
+    if (curlheaders != NULL) {
+        for (u = 0; u < count; u++)
+            if (curlheaders[u] != NULL)
+                curl_slist_free_all(curlheaders[u]);
+        H5MM_xfree(curlheaders);
+    } /* end if */
+    if (sds != NULL)
+        H5MM_xfree(sds);
+    if (multih != NULL)
+        curl_multi_cleanup(multih);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_s3comms_s3r_read_multi() */
+
 /****************************************************************************
  * MISCELLANEOUS FUNCTIONS
  ****************************************************************************/
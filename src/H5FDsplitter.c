@@ -23,12 +23,21 @@
 #include "H5Eprivate.h"   /* Error handling           */
 #include "H5Fprivate.h"   /* File access              */
 #include "H5FDprivate.h"  /* File drivers             */
+#include "H5FDsec2.h"     /* Posix unbuffered I/O     */
 #include "H5FDsplitter.h" /* Splitter file driver     */
 #include "H5FLprivate.h"  /* Free Lists               */
 #include "H5Iprivate.h"   /* IDs                      */
 #include "H5MMprivate.h"  /* Memory management        */
 #include "H5Pprivate.h"   /* Property lists           */
 
+/* Writes to the W/O channel can be queued for a background thread, which
+ * needs worker thread support and pwrite()
+ */
+#if defined(H5_HAVE_WORKER_THREADS) && defined(H5_HAVE_PREADWRITE)
+#define H5FD_SPLITTER_WRITE_BEHIND
+#include <pthread.h>
+#endif
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_SPLITTER_g = 0;
 
@@ -39,8 +48,38 @@ typedef struct H5FD_splitter_fapl_t {
     char    wo_path[H5FD_SPLITTER_PATH_MAX + 1];       /* file name for the W/O channel */
     char    log_file_path[H5FD_SPLITTER_PATH_MAX + 1]; /* file to record errors reported by the W/O channel */
     hbool_t ignore_wo_errs;                            /* TRUE to ignore errors on the W/O channel */
+    size_t  wo_queue_size;                             /* bytes of W/O writes that may be queued */
 } H5FD_splitter_fapl_t;
 
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+/* A write queued for the W/O channel */
+typedef struct H5FD_splitter_wb_op_t {
+    struct H5FD_splitter_wb_op_t *next; /* next (newer) queued write */
+    haddr_t                       addr; /* file address of the write */
+    size_t                        size; /* number of bytes to write */
+    unsigned char *               buf;  /* copy of the data to write */
+} H5FD_splitter_wb_op_t;
+
+/* Write-behind queue for the W/O channel, applied in order by a background
+ * thread.  The thread writes directly to the W/O file's descriptor and
+ * never calls back into the library.
+ */
+typedef struct H5FD_splitter_wb_t {
+    pthread_t              thread;    /* thread applying the queued writes */
+    pthread_mutex_t        mutex;     /* protects the fields below */
+    pthread_cond_t         queued;    /* signalled when a write is queued or on shutdown */
+    pthread_cond_t         done;      /* signalled when a queued write completes */
+    int                    fd;        /* W/O file descriptor */
+    size_t                 max_bytes; /* maximum bytes queued or being written */
+    size_t                 nbytes;    /* bytes queued or being written */
+    H5FD_splitter_wb_op_t *head;      /* oldest queued write */
+    H5FD_splitter_wb_op_t *tail;      /* newest queued write */
+    hbool_t                shutdown;  /* TRUE to stop the thread once the queue is empty */
+    hbool_t                failed;    /* TRUE if a queued write failed since last checked */
+    hbool_t                dirty;     /* TRUE if writes were queued since the last truncate */
+} H5FD_splitter_wb_t;
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
+
 /* The information of this splitter */
 typedef struct H5FD_splitter_t {
     H5FD_t               pub;     /* public stuff, must be first    */
@@ -49,6 +88,9 @@ typedef struct H5FD_splitter_t {
     H5FD_t *             rw_file; /* pointer of R/W channel */
     H5FD_t *             wo_file; /* pointer of W/O channel */
     FILE *               logfp;   /* Log file pointer */
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    H5FD_splitter_wb_t *wb; /* W/O channel write-behind queue, NULL if writes are synchronous */
+#endif
 } H5FD_splitter_t;
 
 /*
@@ -101,6 +143,14 @@ typedef struct H5FD_splitter_t {
 /* Print error messages from W/O channel to log file */
 static herr_t H5FD__splitter_log_error(const H5FD_splitter_t *file, const char *atfunc, const char *msg);
 static int    H5FD__copy_plist(hid_t fapl_id, hid_t *id_out_ptr);
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+static herr_t H5FD__splitter_wb_start(H5FD_splitter_t *file);
+static void * H5FD__splitter_wb_thread(void *_wb);
+static herr_t H5FD__splitter_wb_queue(H5FD_splitter_wb_t *wb, haddr_t addr, size_t size, const void *buf,
+                                      hbool_t *failed);
+static void   H5FD__splitter_wb_drain(H5FD_splitter_wb_t *wb, hbool_t *failed);
+static void   H5FD__splitter_wb_stop(H5FD_splitter_wb_t *wb, hbool_t *failed);
+#endif
 
 /* Prototypes */
 static herr_t  H5FD__splitter_term(void);
@@ -303,7 +353,7 @@ H5Pset_fapl_splitter(hid_t fapl_id, H5FD_splitter_vfd_config_t *vfd_config)
 
     if (H5FD_SPLITTER_MAGIC != vfd_config->magic)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid configuration (magic number mismatch)")
-    if (H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION != vfd_config->version)
+    if (vfd_config->version < 1 || H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION < vfd_config->version)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid config (version number mismatch)")
     if (NULL == (plist_ptr = (H5P_genplist_t *)H5I_object(fapl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a valid property list")
@@ -339,6 +389,8 @@ H5Pset_fapl_splitter(hid_t fapl_id, H5FD_splitter_vfd_config_t *vfd_config)
         HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate file access property list struct")
 
     info->ignore_wo_errs = vfd_config->ignore_wo_errs;
+    if (vfd_config->version >= 2)
+        info->wo_queue_size = vfd_config->wo_queue_size;
     HDstrncpy(info->wo_path, vfd_config->wo_path, H5FD_SPLITTER_PATH_MAX);
     HDstrncpy(info->log_file_path, vfd_config->log_file_path, H5FD_SPLITTER_PATH_MAX);
     info->rw_fapl_id = H5P_FILE_ACCESS_DEFAULT; /* pre-set value */
@@ -372,7 +424,8 @@ done:
  *              list through the structure config_out.
  *
  *              Will fail if config_out is received without pre-set valid
- *              magic and version information.
+ *              magic and version information.  The fields present in that
+ *              version of the structure are filled in.
  *
  * Return:      SUCCEED/FAIL
  *-------------------------------------------------------------------------
@@ -396,7 +449,7 @@ H5Pget_fapl_splitter(hid_t fapl_id, H5FD_splitter_vfd_config_t *config_out)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "config_out pointer is null")
     if (H5FD_SPLITTER_MAGIC != config_out->magic)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "info-out pointer invalid (magic number mismatch)")
-    if (H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION != config_out->version)
+    if (config_out->version < 1 || H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION < config_out->version)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "info-out pointer invalid (version unsafe)")
 
     /* Pre-set out FAPL IDs with intent to replace these values */
@@ -414,6 +467,8 @@ H5Pget_fapl_splitter(hid_t fapl_id, H5FD_splitter_vfd_config_t *config_out)
     HDstrncpy(config_out->wo_path, fapl_ptr->wo_path, H5FD_SPLITTER_PATH_MAX);
     HDstrncpy(config_out->log_file_path, fapl_ptr->log_file_path, H5FD_SPLITTER_PATH_MAX);
     config_out->ignore_wo_errs = fapl_ptr->ignore_wo_errs;
+    if (config_out->version >= 2)
+        config_out->wo_queue_size = fapl_ptr->wo_queue_size;
 
     /* Copy R/W and W/O FAPLs */
     if (H5FD__copy_plist(fapl_ptr->rw_fapl_id, &(config_out->rw_fapl_id)) < 0)
@@ -428,7 +483,8 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5FD__splitter_flush
  *
- * Purpose:     Flushes all data to disk for both channels.
+ * Purpose:     Flushes all data to disk for both channels, after
+ *              waiting for any queued writes to the W/O channel.
  *
  * Return:      SUCCEED/FAIL
  *-------------------------------------------------------------------------
@@ -446,6 +502,17 @@ H5FD__splitter_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closin
     /* Public API for dxpl "context" */
     if (H5FDflush(file->rw_file, dxpl_id, closing) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTFLUSH, FAIL, "unable to flush R/W file")
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    if (file->wb) {
+        hbool_t failed = FALSE;
+
+        /* Wait for the queued W/O writes */
+        H5FD__splitter_wb_drain(file->wb, &failed);
+        if (failed)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL,
+                                   "queued write to W/O file failed")
+    } /* end if */
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
     if (H5FDflush(file->wo_file, dxpl_id, closing) < 0)
         H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTFLUSH, FAIL, "unable to flush W/O file")
 
@@ -503,6 +570,10 @@ done:
  *              at address ADDR from buffer BUF according to data transfer
  *              properties in DXPL_ID.
  *
+ *              If the W/O channel has a write-behind queue, the W/O write
+ *              is copied into the queue and this returns once the R/W
+ *              write completes.
+ *
  * Return:      SUCCEED/FAIL
  *-------------------------------------------------------------------------
  */
@@ -525,6 +596,28 @@ H5FD__splitter_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr
     /* Public API for dxpl "context" */
     if (H5FDwrite(file->rw_file, type, dxpl_id, addr, size, buf) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "R/W file write failed")
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    if (file->wb) {
+        hbool_t failed = FALSE;
+        hbool_t queued = FALSE;
+
+        /* Queue the W/O write if it fits in the queue and would pass the
+         * W/O driver's own EOA check.  Otherwise, wait for the queue to
+         * empty and write synchronously, so that writes stay in order.
+         */
+        if (size <= file->wb->max_bytes && !H5F_addr_gt(addr + size, H5FDget_eoa(file->wo_file, type)))
+            if (H5FD__splitter_wb_queue(file->wb, addr, size, buf, &failed) >= 0)
+                queued = TRUE;
+        if (!queued)
+            H5FD__splitter_wb_drain(file->wb, &failed);
+
+        if (failed)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL,
+                                   "queued write to W/O file failed")
+        if (queued)
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
     if (H5FDwrite(file->wo_file, type, dxpl_id, addr, size, buf) < 0)
         H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write W/O file")
 
@@ -690,6 +783,7 @@ H5FD__splitter_open(const char *name, unsigned flags, hid_t splitter_fapl_id, ha
     HDstrncpy(file_ptr->fa.wo_path, fapl_ptr->wo_path, H5FD_SPLITTER_PATH_MAX);
     HDstrncpy(file_ptr->fa.log_file_path, fapl_ptr->log_file_path, H5FD_SPLITTER_PATH_MAX);
     file_ptr->fa.ignore_wo_errs = fapl_ptr->ignore_wo_errs;
+    file_ptr->fa.wo_queue_size  = fapl_ptr->wo_queue_size;
 
     /* Copy R/W and W/O channel FAPLs. */
     if (H5FD__copy_plist(fapl_ptr->rw_fapl_id, &(file_ptr->fa.rw_fapl_id)) < 0)
@@ -717,6 +811,15 @@ H5FD__splitter_open(const char *name, unsigned flags, hid_t splitter_fapl_id, ha
     if (!file_ptr->wo_file)
         H5FD_SPLITTER_WO_ERROR(file_ptr, FUNC, H5E_VFL, H5E_CANTOPENFILE, NULL, "unable to open W/O file")
 
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    /* Queue W/O writes for a background thread, if requested.  The thread
+     * writes to the file descriptor, so this is limited to the sec2 driver.
+     */
+    if (file_ptr->wo_file && file_ptr->fa.wo_queue_size > 0 && H5FD_SEC2 == file_ptr->wo_file->driver_id)
+        if (H5FD__splitter_wb_start(file_ptr) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to start W/O write-behind thread")
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
+
     ret_value = (H5FD_t *)file_ptr;
 
 done:
@@ -752,6 +855,7 @@ static herr_t
 H5FD__splitter_close(H5FD_t *_file)
 {
     H5FD_splitter_t *file      = (H5FD_splitter_t *)_file;
+    hbool_t          wb_failed = FALSE; /* Whether a queued W/O write failed */
     herr_t           ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
@@ -761,6 +865,14 @@ H5FD__splitter_close(H5FD_t *_file)
     /* Sanity check */
     HDassert(file);
 
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    /* Apply the queued W/O writes and stop the write-behind thread */
+    if (file->wb) {
+        H5FD__splitter_wb_stop(file->wb, &wb_failed);
+        file->wb = NULL;
+    } /* end if */
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
+
     if (H5I_dec_ref(file->fa.rw_fapl_id) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_ARGS, FAIL, "can't close R/W FAPL")
     if (H5I_dec_ref(file->fa.wo_fapl_id) < 0)
@@ -772,6 +884,8 @@ H5FD__splitter_close(H5FD_t *_file)
     if (file->wo_file)
         if (H5FD_close(file->wo_file) == FAIL)
             H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "unable to close W/O file")
+    if (wb_failed)
+        H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL, "queued write to W/O file failed")
 
     if (file->logfp) {
         HDfclose(file->logfp);
@@ -912,6 +1026,33 @@ H5FD__splitter_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
     if (H5FDtruncate(file->rw_file, dxpl_id, closing) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTUPDATE, FAIL, "unable to truncate R/W file")
 
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+    if (file->wb) {
+        hbool_t failed = FALSE;
+
+        /* Wait for the queued W/O writes */
+        H5FD__splitter_wb_drain(file->wb, &failed);
+        if (failed)
+            H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_WRITEERROR, FAIL,
+                                   "queued write to W/O file failed")
+
+        /* The sec2 driver's notion of the W/O file's EOF doesn't include
+         * the queued writes, so it can't be relied on to decide whether
+         * the file needs truncating.  Set the file size to the EOA here.
+         */
+        if (file->wb->dirty) {
+            haddr_t   eoa = H5FDget_eoa(file->wo_file, H5FD_MEM_DEFAULT);
+            h5_stat_t sb;
+
+            file->wb->dirty = FALSE;
+            if (HADDR_UNDEF == eoa || HDfstat(file->wb->fd, &sb) < 0 ||
+                ((haddr_t)sb.st_size != eoa && HDftruncate(file->wb->fd, (HDoff_t)eoa) < 0))
+                H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTUPDATE, FAIL,
+                                       "unable to truncate W/O file")
+        } /* end if */
+    }     /* end if */
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
+
     if (H5FDtruncate(file->wo_file, dxpl_id, closing) < 0)
         H5FD_SPLITTER_WO_ERROR(file, FUNC, H5E_VFL, H5E_CANTUPDATE, FAIL, "unable to truncate W/O file")
 
@@ -1312,3 +1453,272 @@ H5FD__splitter_log_error(const H5FD_splitter_t *file, const char *atfunc, const
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__splitter_log_error() */
+
+#ifdef H5FD_SPLITTER_WRITE_BEHIND
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wb_start
+ *
+ * Purpose:     Creates the write-behind queue for the W/O channel and
+ *              starts the thread that applies it.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__splitter_wb_start(H5FD_splitter_t *file)
+{
+    H5FD_splitter_wb_t *wb        = NULL;
+    void *              handle    = NULL;
+    hbool_t             have_sync = FALSE;
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    H5FD_SPLITTER_LOG_CALL(FUNC);
+
+    HDassert(file);
+    HDassert(file->wo_file);
+    HDassert(file->fa.wo_queue_size > 0);
+
+    if (H5FDget_vfd_handle(file->wo_file, file->fa.wo_fapl_id, &handle) < 0 || NULL == handle)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get W/O file handle")
+
+    if (NULL == (wb = (H5FD_splitter_wb_t *)H5MM_calloc(sizeof(H5FD_splitter_wb_t))))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate W/O write-behind queue")
+    wb->fd        = *((int *)handle);
+    wb->max_bytes = file->fa.wo_queue_size;
+
+    if (0 != pthread_mutex_init(&wb->mutex, NULL))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize W/O write-behind mutex")
+    if (0 != pthread_cond_init(&wb->queued, NULL)) {
+        pthread_mutex_destroy(&wb->mutex);
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize W/O write-behind condition")
+    } /* end if */
+    if (0 != pthread_cond_init(&wb->done, NULL)) {
+        pthread_cond_destroy(&wb->queued);
+        pthread_mutex_destroy(&wb->mutex);
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize W/O write-behind condition")
+    } /* end if */
+    have_sync = TRUE;
+
+    if (0 != pthread_create(&wb->thread, NULL, H5FD__splitter_wb_thread, wb))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCREATE, FAIL, "unable to create W/O write-behind thread")
+
+    file->wb = wb;
+
+done:
+    if (ret_value < 0 && wb) {
+        if (have_sync) {
+            pthread_cond_destroy(&wb->done);
+            pthread_cond_destroy(&wb->queued);
+            pthread_mutex_destroy(&wb->mutex);
+        } /* end if */
+        H5MM_xfree(wb);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__splitter_wb_start() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wb_thread
+ *
+ * Purpose:     Body of the write-behind thread.  Writes the queued
+ *              operations to the W/O file in order until the queue is
+ *              empty and shutdown has been requested.
+ *
+ *              This runs outside the library and must not call any
+ *              library routine.  A failed write is recorded in the queue
+ *              and reported by the library thread.
+ *
+ * Return:      NULL
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__splitter_wb_thread(void *_wb)
+{
+    H5FD_splitter_wb_t *wb = (H5FD_splitter_wb_t *)_wb;
+
+    pthread_mutex_lock(&wb->mutex);
+    for (;;) {
+        H5FD_splitter_wb_op_t *op;
+        const unsigned char *  buf;
+        HDoff_t                offset;
+        size_t                 size;
+        hbool_t                ok = TRUE;
+
+        while (NULL == wb->head && !wb->shutdown)
+            pthread_cond_wait(&wb->queued, &wb->mutex);
+        if (NULL == (op = wb->head))
+            break;
+        if (NULL == (wb->head = op->next))
+            wb->tail = NULL;
+        pthread_mutex_unlock(&wb->mutex);
+
+        /* Write the data, being careful of interrupted system calls and
+         * partial results
+         */
+        buf    = op->buf;
+        offset = (HDoff_t)op->addr;
+        size   = op->size;
+        while (size > 0) {
+            h5_posix_io_t     bytes_in;
+            h5_posix_io_ret_t bytes_wrote;
+
+            if (size > H5_POSIX_MAX_IO_BYTES)
+                bytes_in = H5_POSIX_MAX_IO_BYTES;
+            else
+                bytes_in = (h5_posix_io_t)size;
+
+            do {
+                bytes_wrote = HDpwrite(wb->fd, buf, bytes_in, offset);
+            } while (-1 == bytes_wrote && EINTR == errno);
+
+            if (bytes_wrote <= 0) {
+                ok = FALSE;
+                break;
+            } /* end if */
+
+            size -= (size_t)bytes_wrote;
+            offset += (HDoff_t)bytes_wrote;
+            buf += bytes_wrote;
+        } /* end while */
+
+        pthread_mutex_lock(&wb->mutex);
+        wb->nbytes -= op->size;
+        if (!ok)
+            wb->failed = TRUE;
+        pthread_cond_broadcast(&wb->done);
+        HDfree(op);
+    } /* end for */
+    pthread_mutex_unlock(&wb->mutex);
+
+    return NULL;
+} /* end H5FD__splitter_wb_thread() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wb_queue
+ *
+ * Purpose:     Copies a W/O write into the write-behind queue, first
+ *              waiting for earlier writes to complete if the queue
+ *              doesn't have room for it.
+ *
+ *              FAILED is set if a queued write failed since the queue
+ *              was last checked.
+ *
+ * Return:      SUCCEED/FAIL (the copy could not be allocated; no error
+ *              is pushed and the caller should write synchronously)
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__splitter_wb_queue(H5FD_splitter_wb_t *wb, haddr_t addr, size_t size, const void *buf, hbool_t *failed)
+{
+    H5FD_splitter_wb_op_t *op        = NULL;
+    herr_t                 ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(wb);
+    HDassert(size <= wb->max_bytes);
+    HDassert(buf);
+    HDassert(failed);
+
+    /* Plain malloc, since the write-behind thread frees the operation */
+    if (NULL == (op = (H5FD_splitter_wb_op_t *)HDmalloc(sizeof(H5FD_splitter_wb_op_t) + size)))
+        HGOTO_DONE(FAIL)
+    op->next = NULL;
+    op->addr = addr;
+    op->size = size;
+    op->buf  = (unsigned char *)(op + 1);
+    H5MM_memcpy(op->buf, buf, size);
+
+    pthread_mutex_lock(&wb->mutex);
+    while (wb->nbytes + size > wb->max_bytes)
+        pthread_cond_wait(&wb->done, &wb->mutex);
+    if (wb->tail)
+        wb->tail->next = op;
+    else
+        wb->head = op;
+    wb->tail = op;
+    wb->nbytes += size;
+    wb->dirty = TRUE;
+    if (wb->failed)
+        *failed = TRUE;
+    wb->failed = FALSE;
+    pthread_cond_signal(&wb->queued);
+    pthread_mutex_unlock(&wb->mutex);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__splitter_wb_queue() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wb_drain
+ *
+ * Purpose:     Waits until all queued W/O writes have been written.
+ *
+ *              FAILED is set if a queued write failed since the queue
+ *              was last checked.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__splitter_wb_drain(H5FD_splitter_wb_t *wb, hbool_t *failed)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(wb);
+    HDassert(failed);
+
+    pthread_mutex_lock(&wb->mutex);
+    while (wb->nbytes > 0)
+        pthread_cond_wait(&wb->done, &wb->mutex);
+    if (wb->failed)
+        *failed = TRUE;
+    wb->failed = FALSE;
+    pthread_mutex_unlock(&wb->mutex);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__splitter_wb_drain() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__splitter_wb_stop
+ *
+ * Purpose:     Writes the remaining queued W/O writes, stops the
+ *              write-behind thread and frees the queue.
+ *
+ *              FAILED is set if a queued write failed since the queue
+ *              was last checked.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__splitter_wb_stop(H5FD_splitter_wb_t *wb, hbool_t *failed)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(wb);
+    HDassert(failed);
+
+    pthread_mutex_lock(&wb->mutex);
+    wb->shutdown = TRUE;
+    pthread_cond_signal(&wb->queued);
+    pthread_mutex_unlock(&wb->mutex);
+
+    /* The thread empties the queue before it exits */
+    pthread_join(wb->thread, NULL);
+    HDassert(NULL == wb->head);
+    if (wb->failed)
+        *failed = TRUE;
+
+    pthread_cond_destroy(&wb->done);
+    pthread_cond_destroy(&wb->queued);
+    pthread_mutex_destroy(&wb->mutex);
+    H5MM_xfree(wb);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__splitter_wb_stop() */
+
+#endif /* H5FD_SPLITTER_WRITE_BEHIND */
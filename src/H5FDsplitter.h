@@ -20,7 +20,7 @@
 #define H5FD_SPLITTER (H5FD_splitter_init())
 
 /* The version of the H5FD_splitter_vfd_config_t structure used */
-#define H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION 1
+#define H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION 2
 
 /* Maximum length of a filename/path string in the Write-Only channel,
  * including the NULL-terminator.
@@ -46,6 +46,7 @@
  *      Version number of this structure -- informs component membership.
  *      If not H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION, the structure (and/or
  *      pointer to) must be considered invalid.
+ *      Version 1 structures (without wo_queue_size) are still accepted.
  *
  * rw_fapl_id (hid_t)
  *      Library-given identification number of the Read/Write channel driver
@@ -72,6 +73,17 @@
  *      Toggle flag for how judiciously to respond to errors on the Write-Only
  *      channel.
  *
+ * wo_queue_size (size_t)
+ *      Maximum number of bytes of Write-Only channel writes that may be
+ *      queued for a background thread instead of being written before the
+ *      splitter's write call returns.  Queued writes are applied in order
+ *      and are complete once the file is flushed, truncated or closed.
+ *      Errors from queued writes are reported (or logged and ignored,
+ *      according to ignore_wo_errs) by the next write, flush, truncate or
+ *      close.  Writes larger than this are written directly.
+ *      If 0, or if the Write-Only channel does not use the sec2 driver,
+ *      all Write-Only channel writes are synchronous.
+ *
  * ----------------------------------------------------------------------------
  */
 typedef struct H5FD_splitter_vfd_config_t {
@@ -82,6 +94,7 @@ typedef struct H5FD_splitter_vfd_config_t {
     char         wo_path[H5FD_SPLITTER_PATH_MAX + 1];
     char         log_file_path[H5FD_SPLITTER_PATH_MAX + 1];
     hbool_t      ignore_wo_errs;
+    size_t       wo_queue_size;
 } H5FD_splitter_vfd_config_t;
 
 #ifdef __cplusplus
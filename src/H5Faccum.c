@@ -48,6 +48,7 @@
 #define H5F_ACCUM_THROTTLE  8
 #define H5F_ACCUM_THRESHOLD 2048
 #define H5F_ACCUM_MAX_SIZE  (1024 * 1024) /* Max. accum. buf size (max. I/Os will be 1/2 this size) */
+#define H5F_ACCUM_MAX_TOTAL (2 * H5F_ACCUM_MAX_SIZE) /* Max. size of all accum. bufs together */
 
 /******************/
 /* Local Typedefs */
@@ -66,6 +67,14 @@ typedef enum {
 /********************/
 /* Local Prototypes */
 /********************/
+static H5F_meta_accum_t *H5F__accum_find(H5F_shared_t *f_sh, haddr_t addr, size_t size);
+static H5F_meta_accum_t *H5F__accum_choose(H5F_shared_t *f_sh);
+static herr_t            H5F__accum_flush_one(H5FD_t *file, H5F_meta_accum_t *accum);
+static void              H5F__accum_discard(H5F_meta_accum_t *accum);
+static herr_t H5F__accum_evict(H5F_shared_t *f_sh, const H5F_meta_accum_t *keep, haddr_t addr, size_t size);
+static herr_t H5F__accum_limit(H5F_shared_t *f_sh, const H5F_meta_accum_t *keep);
+static herr_t H5F__accum_free_one(H5FD_t *file, H5F_meta_accum_t *accum, H5FD_mem_t type, haddr_t addr,
+                                  hsize_t size);
 
 /*********************/
 /* Package Variables */
@@ -82,6 +91,222 @@ typedef enum {
 /* Declare a PQ free list to manage the metadata accumulator buffer */
 H5FL_BLK_DEFINE_STATIC(meta_accum);
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_find
+ *
+ * Purpose:     Locate the metadata accumulator that a block of the file
+ *              overlaps, or failing that, one that it adjoins.
+ *
+ *              The accumulators always hold disjoint regions of the file,
+ *              so at most one of them can overlap a block that is already
+ *              cached.
+ *
+ * Return:      Pointer to the accumulator on success/NULL if none match
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5F_meta_accum_t *
+H5F__accum_find(H5F_shared_t *f_sh, haddr_t addr, size_t size)
+{
+    H5F_meta_accum_t *adjoin    = NULL; /* Accumulator adjoining the block */
+    unsigned          u;                /* Local index variable */
+    H5F_meta_accum_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < H5F_ACCUM_NUM; u++) {
+        H5F_meta_accum_t *accum = &f_sh->accum[u]; /* Alias for the accumulator */
+
+        /* Skip accumulators not holding any metadata */
+        if (0 == accum->size)
+            continue;
+
+        if (H5F_addr_overlap(addr, size, accum->loc, accum->size))
+            HGOTO_DONE(accum)
+        if (NULL == adjoin && ((addr + size) == accum->loc || (accum->loc + accum->size) == addr))
+            adjoin = accum;
+    } /* end for */
+
+    ret_value = adjoin;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_find() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_choose
+ *
+ * Purpose:     Choose the metadata accumulator to cache metadata that
+ *              isn't next to any accumulated metadata: an idle one if
+ *              possible, otherwise the least recently used one.
+ *
+ * Return:      Pointer to the accumulator (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5F_meta_accum_t *
+H5F__accum_choose(H5F_shared_t *f_sh)
+{
+    unsigned          u;                /* Local index variable */
+    H5F_meta_accum_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < H5F_ACCUM_NUM; u++) {
+        H5F_meta_accum_t *accum = &f_sh->accum[u]; /* Alias for the accumulator */
+
+        if (0 == accum->size)
+            HGOTO_DONE(accum)
+        if (NULL == ret_value || accum->last_use < ret_value->last_use)
+            ret_value = accum;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_choose() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_flush_one
+ *
+ * Purpose:     Write the dirty region of a metadata accumulator to the
+ *              file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_flush_one(H5FD_t *file, H5F_meta_accum_t *accum)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (accum->dirty) {
+        /* Flush the metadata contents */
+        if (H5FD_write(file, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off, accum->dirty_len,
+                       accum->buf + accum->dirty_off) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+        /* Reset the dirty flag */
+        accum->dirty = FALSE;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_flush_one() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_discard
+ *
+ * Purpose:     Release a metadata accumulator's buffer and forget its
+ *              contents, without flushing them.
+ *
+ * Return:      none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5F__accum_discard(H5F_meta_accum_t *accum)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Free the buffer */
+    if (accum->buf)
+        accum->buf = H5FL_BLK_FREE(meta_accum, accum->buf);
+
+    /* Reset the buffer sizes & location */
+    accum->alloc_size = accum->size = 0;
+    accum->loc                      = HADDR_UNDEF;
+    accum->dirty                    = FALSE;
+    accum->dirty_len                = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F__accum_discard() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_evict
+ *
+ * Purpose:     Flush and empty every metadata accumulator other than
+ *              KEEP that overlaps a block of the file, before KEEP grows
+ *              to cover the block.  This keeps the accumulators disjoint.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_evict(H5F_shared_t *f_sh, const H5F_meta_accum_t *keep, haddr_t addr, size_t size)
+{
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    for (u = 0; u < H5F_ACCUM_NUM; u++) {
+        H5F_meta_accum_t *accum = &f_sh->accum[u]; /* Alias for the accumulator */
+
+        if (accum != keep && accum->size > 0 && H5F_addr_overlap(addr, size, accum->loc, accum->size)) {
+            if (H5F__accum_flush_one(f_sh->lf, accum) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush metadata accumulator")
+
+            /* Empty the accumulator, but keep its buffer */
+            accum->loc  = HADDR_UNDEF;
+            accum->size = 0;
+        } /* end if */
+    }     /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_evict() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_limit
+ *
+ * Purpose:     Flush and release the least recently used metadata
+ *              accumulators (never KEEP) until the buffers of all the
+ *              accumulators together fit in H5F_ACCUM_MAX_TOTAL bytes.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_limit(H5F_shared_t *f_sh, const H5F_meta_accum_t *keep)
+{
+    H5F_meta_accum_t *victim;              /* Accumulator to release */
+    size_t            total;               /* Total size of accumulator buffers */
+    unsigned          u;                   /* Local index variable */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    do {
+        /* Tally the buffers and find the least recently used one to release */
+        total  = 0;
+        victim = NULL;
+        for (u = 0; u < H5F_ACCUM_NUM; u++) {
+            H5F_meta_accum_t *accum = &f_sh->accum[u]; /* Alias for the accumulator */
+
+            total += accum->alloc_size;
+            if (accum != keep && accum->alloc_size > 0 &&
+                (NULL == victim || accum->last_use < victim->last_use))
+                victim = accum;
+        } /* end for */
+
+        if (total > H5F_ACCUM_MAX_TOTAL && victim) {
+            if (H5F__accum_flush_one(f_sh->lf, victim) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush metadata accumulator")
+            H5F__accum_discard(victim);
+        } /* end if */
+        else
+            victim = NULL;
+    } while (victim);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_limit() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5F__accum_read
  *
@@ -102,8 +327,9 @@ H5FL_BLK_DEFINE_STATIC(meta_accum);
 herr_t
 H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t size, void *buf /*out*/)
 {
-    H5FD_t *file;                /* File driver pointer */
-    herr_t  ret_value = SUCCEED; /* Return value */
+    H5FD_t * file;                /* File driver pointer */
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -116,22 +342,25 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
 
     /* Check if this information is in the metadata accumulator */
     if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type != H5FD_MEM_DRAW) {
-        H5F_meta_accum_t *accum; /* Alias for file's metadata accumulator */
-
-        /* Set up alias for file's metadata accumulator info */
-        accum = &f_sh->accum;
+        H5F_meta_accum_t *accum; /* Alias for a metadata accumulator */
 
         if (size < H5F_ACCUM_MAX_SIZE) {
-            /* Sanity check */
-            HDassert(!accum->buf || (accum->alloc_size >= accum->size));
-
-            /* Current read adjoins or overlaps with metadata accumulator */
-            if (H5F_addr_overlap(addr, size, accum->loc, accum->size) || ((addr + size) == accum->loc) ||
-                (accum->loc + accum->size) == addr) {
+            /* Current read adjoins or overlaps with a metadata accumulator */
+            if (NULL != (accum = H5F__accum_find(f_sh, addr, size))) {
                 size_t  amount_before; /* Amount to read before current accumulator */
                 haddr_t new_addr;      /* New address of the accumulator buffer */
                 size_t  new_size;      /* New size of the accumulator buffer */
 
+                /* Sanity check */
+                HDassert(!accum->buf || (accum->alloc_size >= accum->size));
+
+                /* Retire any other accumulator that the read overlaps, so that
+                 *  the pieces read from the file below are current.
+                 */
+                if (H5F__accum_evict(f_sh, accum, addr, size) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush metadata accumulator")
+                accum->last_use = ++f_sh->accum_clock;
+
                 /* Compute new values for accumulator */
                 new_addr = MIN(addr, accum->loc);
                 new_size = (size_t)(MAX((addr + size), (accum->loc + accum->size)) - new_addr);
@@ -194,6 +423,10 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
                 /* Adjust the accumulator address & size */
                 accum->loc  = new_addr;
                 accum->size = new_size;
+
+                /* Keep the accumulators within their shared memory limit */
+                if (H5F__accum_limit(f_sh, accum) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush metadata accumulator")
             } /* end if */
             /* Current read doesn't overlap with metadata accumulator, read it from file */
             else {
@@ -207,45 +440,49 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
             if (H5FD_read(file, map_type, addr, size, buf) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
 
-            /* Check for overlap w/dirty accumulator */
+            /* Check for overlap w/dirty accumulators */
             /* (Note that this could be improved by updating the non-dirty
              *  information in the accumulator with [some of] the information
              *  just read in. -QAK)
              */
-            if (accum->dirty &&
-                H5F_addr_overlap(addr, size, accum->loc + accum->dirty_off, accum->dirty_len)) {
-                haddr_t dirty_loc = accum->loc + accum->dirty_off; /* File offset of dirty information */
-                size_t  buf_off;                                   /* Offset of dirty region in buffer */
-                size_t  dirty_off;                                 /* Offset within dirty region */
-                size_t  overlap_size;                              /* Size of overlap with dirty region */
-
-                /* Check for read starting before beginning dirty region */
-                if (H5F_addr_le(addr, dirty_loc)) {
-                    /* Compute offset of dirty region within buffer */
-                    buf_off = (size_t)(dirty_loc - addr);
-
-                    /* Compute offset within dirty region */
-                    dirty_off = 0;
-
-                    /* Check for read ending within dirty region */
-                    if (H5F_addr_lt(addr + size, dirty_loc + accum->dirty_len))
-                        overlap_size = (size_t)((addr + size) - buf_off);
-                    else /* Access covers whole dirty region */
-                        overlap_size = accum->dirty_len;
-                }      /* end if */
-                else { /* Read starts after beginning of dirty region */
-                    /* Compute dirty offset within buffer and overlap size */
-                    buf_off      = 0;
-                    dirty_off    = (size_t)(addr - dirty_loc);
-                    overlap_size = (size_t)((dirty_loc + accum->dirty_len) - addr);
-                } /* end else */
+            for (u = 0; u < H5F_ACCUM_NUM; u++) {
+                accum = &f_sh->accum[u];
+
+                if (accum->dirty &&
+                    H5F_addr_overlap(addr, size, accum->loc + accum->dirty_off, accum->dirty_len)) {
+                    haddr_t dirty_loc = accum->loc + accum->dirty_off; /* File offset of dirty information */
+                    size_t  buf_off;                                   /* Offset of dirty region in buffer */
+                    size_t  dirty_off;                                 /* Offset within dirty region */
+                    size_t  overlap_size;                              /* Size of overlap with dirty region */
+
+                    /* Check for read starting before beginning dirty region */
+                    if (H5F_addr_le(addr, dirty_loc)) {
+                        /* Compute offset of dirty region within buffer */
+                        buf_off = (size_t)(dirty_loc - addr);
+
+                        /* Compute offset within dirty region */
+                        dirty_off = 0;
+
+                        /* Check for read ending within dirty region */
+                        if (H5F_addr_lt(addr + size, dirty_loc + accum->dirty_len))
+                            overlap_size = (size_t)((addr + size) - buf_off);
+                        else /* Access covers whole dirty region */
+                            overlap_size = accum->dirty_len;
+                    }      /* end if */
+                    else { /* Read starts after beginning of dirty region */
+                        /* Compute dirty offset within buffer and overlap size */
+                        buf_off      = 0;
+                        dirty_off    = (size_t)(addr - dirty_loc);
+                        overlap_size = (size_t)((dirty_loc + accum->dirty_len) - addr);
+                    } /* end else */
 
-                /* Copy the dirty region to buffer */
-                H5MM_memcpy((unsigned char *)buf + buf_off,
-                            (unsigned char *)accum->buf + accum->dirty_off + dirty_off, overlap_size);
-            } /* end if */
-        }     /* end else */
-    }         /* end if */
+                    /* Copy the dirty region to buffer */
+                    H5MM_memcpy((unsigned char *)buf + buf_off,
+                                (unsigned char *)accum->buf + accum->dirty_off + dirty_off, overlap_size);
+                } /* end if */
+            }     /* end for */
+        }         /* end else */
+    }             /* end if */
     else {
         /* Read the data */
         if (H5FD_read(file, map_type, addr, size, buf) < 0)
@@ -412,8 +649,9 @@ done:
 herr_t
 H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t size, const void *buf)
 {
-    H5FD_t *file;                /* File driver pointer */
-    herr_t  ret_value = SUCCEED; /* Return value */
+    H5FD_t * file;                /* File driver pointer */
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
@@ -427,12 +665,20 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
 
     /* Check for accumulating metadata */
     if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type != H5FD_MEM_DRAW) {
-        H5F_meta_accum_t *accum; /* Alias for file's metadata accumulator */
-
-        /* Set up alias for file's metadata accumulator info */
-        accum = &f_sh->accum;
+        H5F_meta_accum_t *accum; /* Alias for a metadata accumulator */
 
         if (size < H5F_ACCUM_MAX_SIZE) {
+            /* Look for an accumulator that the new metadata adjoins or overlaps */
+            if (NULL != (accum = H5F__accum_find(f_sh, addr, size))) {
+                /* Retire any other accumulator that the new metadata overlaps */
+                if (H5F__accum_evict(f_sh, accum, addr, size) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush metadata accumulator")
+            } /* end if */
+            else
+                /* Use an idle accumulator, or restart the least recently used one */
+                accum = H5F__accum_choose(f_sh);
+            accum->last_use = ++f_sh->accum_clock;
+
             /* Sanity check */
             HDassert(!accum->buf || (accum->alloc_size >= accum->size));
 
@@ -729,7 +975,11 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                 accum->dirty_len = size;
                 accum->dirty     = TRUE;
             } /* end else */
-        }     /* end if */
+
+            /* Keep the accumulators within their shared memory limit */
+            if (H5F__accum_limit(f_sh, accum) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush metadata accumulator")
+        } /* end if */
         else {
             /* Make certain that data in accumulator is visible before new write */
             if ((H5F_SHARED_INTENT(f_sh) & H5F_ACC_SWMR_WRITE) > 0)
@@ -741,19 +991,64 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
             if (H5FD_write(file, map_type, addr, size, buf) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
 
-            /* Check for overlap w/accumulator */
+            /* Check for overlap w/accumulators */
             /* (Note that this could be improved by updating the accumulator
              *  with [some of] the information just read in. -QAK)
              */
-            if (H5F_addr_overlap(addr, size, accum->loc, accum->size)) {
-                /* Check for write starting before beginning of accumulator */
-                if (H5F_addr_le(addr, accum->loc)) {
-                    /* Check for write ending within accumulator */
-                    if (H5F_addr_le(addr + size, accum->loc + accum->size)) {
+            for (u = 0; u < H5F_ACCUM_NUM; u++) {
+                accum = &f_sh->accum[u];
+
+                if (H5F_addr_overlap(addr, size, accum->loc, accum->size)) {
+                    /* Check for write starting before beginning of accumulator */
+                    if (H5F_addr_le(addr, accum->loc)) {
+                        /* Check for write ending within accumulator */
+                        if (H5F_addr_le(addr + size, accum->loc + accum->size)) {
+                            size_t overlap_size; /* Size of overlapping region */
+
+                            /* Compute overlap size */
+                            overlap_size = (size_t)((addr + size) - accum->loc);
+
+                            /* Check for dirty region */
+                            if (accum->dirty) {
+                                haddr_t dirty_start =
+                                    accum->loc + accum->dirty_off; /* File address of start of dirty region */
+                                haddr_t dirty_end =
+                                    dirty_start + accum->dirty_len; /* File address of end of dirty region */
+
+                                /* Check if entire dirty region is overwritten */
+                                if (H5F_addr_le(dirty_end, addr + size)) {
+                                    accum->dirty     = FALSE;
+                                    accum->dirty_len = 0;
+                                } /* end if */
+                                else {
+                                    /* Check for dirty region falling after write */
+                                    if (H5F_addr_le(addr + size, dirty_start))
+                                        accum->dirty_off = overlap_size;
+                                    else { /* Dirty region overlaps w/written region */
+                                        accum->dirty_off = 0;
+                                        accum->dirty_len -= (size_t)((addr + size) - dirty_start);
+                                    } /* end else */
+                                }     /* end if */
+                            }         /* end if */
+
+                            /* Trim bottom of accumulator off */
+                            accum->loc += overlap_size;
+                            accum->size -= overlap_size;
+                            HDmemmove(accum->buf, accum->buf + overlap_size, accum->size);
+                        }      /* end if */
+                        else { /* Access covers whole accumulator */
+                            /* Reset accumulator, but don't flush */
+                            H5F__accum_discard(accum);
+                        }                    /* end else */
+                    }                        /* end if */
+                    else {                   /* Write starts after beginning of accumulator */
                         size_t overlap_size; /* Size of overlapping region */
 
+                        /* Sanity check */
+                        HDassert(H5F_addr_gt(addr + size, accum->loc + accum->size));
+
                         /* Compute overlap size */
-                        overlap_size = (size_t)((addr + size) - accum->loc);
+                        overlap_size = (size_t)((accum->loc + accum->size) - addr);
 
                         /* Check for dirty region */
                         if (accum->dirty) {
@@ -763,68 +1058,26 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                                 dirty_start + accum->dirty_len; /* File address of end of dirty region */
 
                             /* Check if entire dirty region is overwritten */
-                            if (H5F_addr_le(dirty_end, addr + size)) {
+                            if (H5F_addr_ge(dirty_start, addr)) {
                                 accum->dirty     = FALSE;
                                 accum->dirty_len = 0;
                             } /* end if */
                             else {
-                                /* Check for dirty region falling after write */
-                                if (H5F_addr_le(addr + size, dirty_start))
-                                    accum->dirty_off = overlap_size;
-                                else { /* Dirty region overlaps w/written region */
-                                    accum->dirty_off = 0;
-                                    accum->dirty_len -= (size_t)((addr + size) - dirty_start);
-                                } /* end else */
-                            }     /* end if */
-                        }         /* end if */
-
-                        /* Trim bottom of accumulator off */
-                        accum->loc += overlap_size;
-                        accum->size -= overlap_size;
-                        HDmemmove(accum->buf, accum->buf + overlap_size, accum->size);
-                    }      /* end if */
-                    else { /* Access covers whole accumulator */
-                        /* Reset accumulator, but don't flush */
-                        if (H5F__accum_reset(f_sh, FALSE) < 0)
-                            HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't reset accumulator")
-                    }                    /* end else */
-                }                        /* end if */
-                else {                   /* Write starts after beginning of accumulator */
-                    size_t overlap_size; /* Size of overlapping region */
-
-                    /* Sanity check */
-                    HDassert(H5F_addr_gt(addr + size, accum->loc + accum->size));
-
-                    /* Compute overlap size */
-                    overlap_size = (size_t)((accum->loc + accum->size) - addr);
-
-                    /* Check for dirty region */
-                    if (accum->dirty) {
-                        haddr_t dirty_start =
-                            accum->loc + accum->dirty_off; /* File address of start of dirty region */
-                        haddr_t dirty_end =
-                            dirty_start + accum->dirty_len; /* File address of end of dirty region */
-
-                        /* Check if entire dirty region is overwritten */
-                        if (H5F_addr_ge(dirty_start, addr)) {
-                            accum->dirty     = FALSE;
-                            accum->dirty_len = 0;
-                        } /* end if */
-                        else {
-                            /* Check for dirty region falling before write */
-                            if (H5F_addr_le(dirty_end, addr))
-                                ; /* noop */
-                            else  /* Dirty region overlaps w/written region */
-                                accum->dirty_len = (size_t)(addr - dirty_start);
-                        } /* end if */
-                    }     /* end if */
+                                /* Check for dirty region falling before write */
+                                if (H5F_addr_le(dirty_end, addr))
+                                    ; /* noop */
+                                else  /* Dirty region overlaps w/written region */
+                                    accum->dirty_len = (size_t)(addr - dirty_start);
+                            } /* end if */
+                        }     /* end if */
 
-                    /* Trim top of accumulator off */
-                    accum->size -= overlap_size;
-                } /* end else */
-            }     /* end if */
-        }         /* end else */
-    }             /* end if */
+                        /* Trim top of accumulator off */
+                        accum->size -= overlap_size;
+                    } /* end else */
+                }     /* end if */
+            }         /* end for */
+        }             /* end else */
+    }                 /* end if */
     else {
         /* Write the data */
         if (H5FD_write(file, map_type, addr, size, buf) < 0)
@@ -849,26 +1102,47 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr, hsize_t size)
+H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, hsize_t size)
 {
-    H5F_meta_accum_t *accum;               /* Alias for file's metadata accumulator */
-    H5FD_t *          file;                /* File driver pointer */
-    herr_t            ret_value = SUCCEED; /* Return value */
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
     /* check arguments */
     HDassert(f_sh);
 
-    /* Set up alias for file's metadata accumulator info */
-    accum = &f_sh->accum;
+    /* Remove the freed block from each metadata accumulator it overlaps */
+    if (f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA)
+        for (u = 0; u < H5F_ACCUM_NUM; u++)
+            if (H5F__accum_free_one(f_sh->lf, &f_sh->accum[u], type, addr, size) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTFREE, FAIL, "can't adjust metadata accumulator")
 
-    /* Translate to file driver pointer */
-    file = f_sh->lf;
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__accum_free_one
+ *
+ * Purpose:     Remove a block being freed from one metadata accumulator,
+ *              writing out any of its dirty region the block doesn't
+ *              cover.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_free_one(H5FD_t *file, H5F_meta_accum_t *accum, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr,
+                    hsize_t size)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
 
     /* Adjust the metadata accumulator to remove the freed block, if it overlaps */
-    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) &&
-        H5F_addr_overlap(addr, size, accum->loc, accum->size)) {
+    if (H5F_addr_overlap(addr, size, accum->loc, accum->size)) {
         size_t overlap_size; /* Size of overlap with accumulator */
 
         /* Sanity check */
@@ -1000,12 +1274,12 @@ H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5F__accum_free() */
+} /* end H5F__accum_free_one() */
 
 /*-------------------------------------------------------------------------
  * Function:	H5F__accum_flush
  *
- * Purpose:	Flush the metadata accumulator to the file
+ * Purpose:	Flush the metadata accumulators to the file
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -1024,20 +1298,22 @@ H5F__accum_flush(H5F_shared_t *f_sh)
     /* Sanity checks */
     HDassert(f_sh);
 
-    /* Check if we need to flush out the metadata accumulator */
-    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && f_sh->accum.dirty) {
-        H5FD_t *file; /* File driver pointer */
+    /* Check if we need to flush out the metadata accumulators */
+    if (f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) {
+        H5F_meta_accum_t *accum; /* Next accumulator to flush */
 
-        /* Translate to file driver pointer */
-        file = f_sh->lf;
+        /* Flush the dirty accumulators in increasing address order */
+        do {
+            unsigned u; /* Local index variable */
 
-        /* Flush the metadata contents */
-        if (H5FD_write(file, H5FD_MEM_DEFAULT, f_sh->accum.loc + f_sh->accum.dirty_off, f_sh->accum.dirty_len,
-                       f_sh->accum.buf + f_sh->accum.dirty_off) < 0)
-            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+            accum = NULL;
+            for (u = 0; u < H5F_ACCUM_NUM; u++)
+                if (f_sh->accum[u].dirty && (NULL == accum || H5F_addr_lt(f_sh->accum[u].loc, accum->loc)))
+                    accum = &f_sh->accum[u];
 
-        /* Reset the dirty flag */
-        f_sh->accum.dirty = FALSE;
+            if (accum && H5F__accum_flush_one(f_sh->lf, accum) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        } while (accum);
     } /* end if */
 
 done:
@@ -1047,7 +1323,7 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5F__accum_reset
  *
- * Purpose:	Reset the metadata accumulator for the file
+ * Purpose:	Reset the metadata accumulators for the file
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -1073,15 +1349,10 @@ H5F__accum_reset(H5F_shared_t *f_sh, hbool_t flush)
 
     /* Check if we need to reset the metadata accumulator information */
     if (f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) {
-        /* Free the buffer */
-        if (f_sh->accum.buf)
-            f_sh->accum.buf = H5FL_BLK_FREE(meta_accum, f_sh->accum.buf);
-
-        /* Reset the buffer sizes & location */
-        f_sh->accum.alloc_size = f_sh->accum.size = 0;
-        f_sh->accum.loc                           = HADDR_UNDEF;
-        f_sh->accum.dirty                         = FALSE;
-        f_sh->accum.dirty_len                     = 0;
+        unsigned u; /* Local index variable */
+
+        for (u = 0; u < H5F_ACCUM_NUM; u++)
+            H5F__accum_discard(&f_sh->accum[u]);
     } /* end if */
 
 done:
@@ -48,6 +48,17 @@
 /* Local Typedefs */
 /******************/
 
+/* Callback for H5F__prefix_search(), tries one name for a prefixed file */
+typedef htri_t (*H5F_prefix_try_func_t)(const char *name, void *udata);
+
+/* User data for H5F__prefix_try_open() */
+typedef struct H5F_prefix_open_ud_t {
+    H5F_t *  primary_file; /* File that refers to the prefixed file */
+    unsigned file_intent;  /* Flags to open the prefixed file with */
+    hid_t    fapl_id;      /* File access property list for the prefixed file */
+    H5F_t *  src_file;     /* Prefixed file, once opened */
+} H5F_prefix_open_ud_t;
+
 /* Struct only used by functions H5F__get_objects and H5F__get_objects_cb */
 typedef struct H5F_olist_t {
     H5I_type_t obj_type;     /* Type of object to look for */
@@ -79,6 +90,10 @@ static herr_t H5F__get_objects(const H5F_t *f, unsigned types, size_t max_index,
 static int    H5F__get_objects_cb(void *obj_ptr, hid_t obj_id, void *key);
 static herr_t H5F__build_name(const char *prefix, const char *file_name, char **full_name /*out*/);
 static char * H5F__getenv_prefix_name(char **env_prefix /*in,out*/);
+static htri_t H5F__prefix_search(H5F_t *primary_file, H5F_prefix_open_t prefix_type, const char *prop_prefix,
+                                 const char *file_name, H5F_prefix_try_func_t try_func, void *udata);
+static htri_t H5F__prefix_try_open(const char *name, void *udata);
+static htri_t H5F__prefix_try_stat(const char *name, void *udata);
 static H5F_t *H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5FD_t *lf);
 static herr_t H5F__check_if_using_file_locks(H5P_genplist_t *fapl, hbool_t *use_file_locking);
 static herr_t H5F__build_actual_name(const H5F_t *f, const H5P_genplist_t *fapl, const char *name,
@@ -426,6 +441,13 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
             0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, H5I_INVALID_HID,
                         "can't set minimum raw data fraction of page buffer")
+        if (H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_POLICY_NAME, &(f->shared->page_buf->policy)) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, H5I_INVALID_HID, "can't set page buffer replacement policy")
+        if (H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_NAME, &(f->shared->page_buf->write_behind)) <
+            0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, H5I_INVALID_HID, "can't set page buffer write-behind size")
+        if (H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME, &(f->shared->page_buf->read_ahead)) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, H5I_INVALID_HID, "can't set page buffer read-ahead")
     } /* end if */
 #ifdef H5_HAVE_PARALLEL
     if (H5P_set(new_plist, H5_COLL_MD_READ_FLAG_NAME, &(f->shared->coll_md_read)) < 0)
@@ -810,46 +832,42 @@ H5F__getenv_prefix_name(char **env_prefix /*in,out*/)
 } /* end H5F__getenv_prefix_name() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5F_prefix_open_file
+ * Function:    H5F__prefix_search
  *
- * Purpose:     Attempts to open a dataset file.
+ * Purpose:     Calls TRY_FUNC for each name under which a prefixed file
+ *              is looked for, in order, until it returns TRUE.
  *
- * Return:      Pointer to an opened file on success / NULL on failure
+ * Return:      TRUE if TRY_FUNC returned TRUE for a name / FALSE if it
+ *              did not for any name / Negative on failure
  *-------------------------------------------------------------------------
  */
-H5F_t *
-H5F_prefix_open_file(H5F_t *primary_file, H5F_prefix_open_t prefix_type, const char *prop_prefix,
-                     const char *file_name, unsigned file_intent, hid_t fapl_id)
+static htri_t
+H5F__prefix_search(H5F_t *primary_file, H5F_prefix_open_t prefix_type, const char *prop_prefix,
+                   const char *file_name, H5F_prefix_try_func_t try_func, void *udata)
 {
-    H5F_t *src_file         = NULL; /* Source file */
-    char * full_name        = NULL; /* File name with prefix */
-    char * actual_file_name = NULL; /* File's actual name */
-    char * temp_file_name   = NULL; /* Temporary pointer to file name */
-    size_t temp_file_name_len;      /* Length of temporary file name */
-    H5F_t *ret_value = NULL;        /* Return value  */
+    char * full_name        = NULL;  /* File name with prefix */
+    char * actual_file_name = NULL;  /* File's actual name */
+    char * temp_file_name   = NULL;  /* Temporary pointer to file name */
+    size_t temp_file_name_len;       /* Length of temporary file name */
+    htri_t found     = FALSE;        /* Whether the file was found under a name */
+    htri_t ret_value = FALSE;        /* Return value  */
 
-    FUNC_ENTER_NOAPI_NOINIT
-
-    /* Simplify intent flags for open calls */
-    file_intent &= (H5F_ACC_RDWR | H5F_ACC_SWMR_WRITE | H5F_ACC_SWMR_READ);
+    FUNC_ENTER_STATIC
 
     /* Copy the file name to use */
     if (NULL == (temp_file_name = H5MM_strdup(file_name)))
-        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
     temp_file_name_len = HDstrlen(temp_file_name);
 
     /* Target file_name is an absolute pathname: see RM for detailed description */
     if (H5_CHECK_ABSOLUTE(file_name) || H5_CHECK_ABS_PATH(file_name)) {
         /* Try opening file */
-        src_file = H5F__efc_open(primary_file, file_name, file_intent, H5P_FILE_CREATE_DEFAULT, fapl_id);
+        found = (*try_func)(file_name, udata);
 
         /* Adjust temporary file name if file not opened */
-        if (NULL == src_file) {
+        if (!found) {
             char *ptr;
 
-            /* Reset the error stack */
-            H5E_clear_stack(NULL);
-
             /* Get last component of file_name */
             H5_GET_LAST_DELIMITER(file_name, ptr)
             HDassert(ptr);
@@ -864,13 +882,10 @@ H5F_prefix_open_file(H5F_t *primary_file, H5F_prefix_open_t prefix_type, const c
     }     /* end if */
     else if (H5_CHECK_ABS_DRIVE(file_name)) {
         /* Try opening file */
-        src_file = H5F__efc_open(primary_file, file_name, file_intent, H5P_FILE_CREATE_DEFAULT, fapl_id);
+        found = (*try_func)(file_name, udata);
 
         /* Adjust temporary file name if file not opened */
-        if (NULL == src_file) {
-            /* Reset the error stack */
-            H5E_clear_stack(NULL);
-
+        if (!found) {
             /* Strip "<drive-letter>:" */
             HDstrncpy(temp_file_name, &file_name[2], temp_file_name_len);
             temp_file_name[temp_file_name_len - 1] = '\0';
@@ -878,7 +893,7 @@ H5F_prefix_open_file(H5F_t *primary_file, H5F_prefix_open_t prefix_type, const c
     }     /* end if */
 
     /* Try searching from paths set in the environment variable */
-    if (src_file == NULL) {
+    if (!found) {
         char *env_prefix;
 
         /* Get the appropriate environment variable */
@@ -887,7 +902,7 @@ H5F_prefix_open_file(H5F_t *primary_file, H5F_prefix_open_t prefix_type, const c
         else if (H5F_PREFIX_ELINK == prefix_type)
             env_prefix = HDgetenv("HDF5_EXT_PREFIX");
         else
-            HGOTO_ERROR(H5E_FILE, H5E_BADTYPE, NULL, "prefix type is not sensible")
+            HGOTO_ERROR(H5E_FILE, H5E_BADTYPE, FAIL, "prefix type is not sensible")
 
         /* If environment variable is defined, iterate through prefixes it defines */
         if (NULL != env_prefix) {
@@ -895,7 +910,7 @@ H5F_prefix_open_file(H5F_t *primary_file, H5F_prefix_open_t prefix_type, const c
 
             /* Make a copy of the environment variable string */
             if (NULL == (saved_env = tmp_env_prefix = H5MM_strdup(env_prefix)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
 
             /* Loop over prefixes in environment variable */
             while ((tmp_env_prefix) && (*tmp_env_prefix)) {
@@ -905,24 +920,18 @@ H5F_prefix_open_file(H5F_t *primary_file, H5F_prefix_open_t prefix_type, const c
                 if (out_prefix_name && (*out_prefix_name)) {
                     if (H5F__build_name(out_prefix_name, temp_file_name, &full_name /*out*/) < 0) {
                         saved_env = (char *)H5MM_xfree(saved_env);
-                        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't prepend prefix to filename")
+                        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't prepend prefix to filename")
                     } /* end if */
 
                     /* Try opening file */
-                    src_file =
-                        H5F__efc_open(primary_file, full_name, file_intent, H5P_FILE_CREATE_DEFAULT, fapl_id);
+                    found = (*try_func)(full_name, udata);
 
                     /* Release copy of file name */
                     full_name = (char *)H5MM_xfree(full_name);
 
-                    /* Check for file not opened */
-                    if (NULL == src_file)
-                        /* Reset the error stack */
-                        H5E_clear_stack(NULL);
                     /* Leave if file was opened */
-                    else
+                    if (found)
                         break;
-                    H5E_clear_stack(NULL);
                 } /* end if */
             }     /* end while */
 
@@ -931,63 +940,47 @@ H5F_prefix_open_file(H5F_t *primary_file, H5F_prefix_open_t prefix_type, const c
     }     /* end if */
 
     /* Try searching from property list */
-    if (src_file == NULL && prop_prefix) {
+    if (!found && prop_prefix) {
         /* Construct name to open */
         if (H5F__build_name(prop_prefix, temp_file_name, &full_name /*out*/) < 0)
-            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't prepend prefix to filename")
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't prepend prefix to filename")
 
         /* Try opening file */
-        src_file = H5F__efc_open(primary_file, full_name, file_intent, H5P_FILE_CREATE_DEFAULT, fapl_id);
+        found = (*try_func)(full_name, udata);
 
         /* Release name */
         full_name = (char *)H5MM_xfree(full_name);
-
-        /* Check for file not opened */
-        if (NULL == src_file)
-            /* Reset the error stack */
-            H5E_clear_stack(NULL);
     } /* end if */
 
     /* Try searching from main file's "extpath": see description in H5F_open() & H5_build_extpath() */
-    if (src_file == NULL) {
+    if (!found) {
         char *dspath;
 
         if (NULL != (dspath = H5F_EXTPATH(primary_file))) {
             /* Construct name to open */
             if (H5F__build_name(dspath, temp_file_name, &full_name /*out*/) < 0)
-                HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't prepend prefix to filename")
+                HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't prepend prefix to filename")
 
             /* Try opening file */
-            src_file = H5F__efc_open(primary_file, full_name, file_intent, H5P_FILE_CREATE_DEFAULT, fapl_id);
+            found = (*try_func)(full_name, udata);
 
             /* Release name */
             full_name = (char *)H5MM_xfree(full_name);
-
-            /* Check for file not opened */
-            if (NULL == src_file)
-                /* Reset the error stack */
-                H5E_clear_stack(NULL);
         } /* end if */
     }     /* end if */
 
     /* Try the relative file_name stored in temp_file_name */
-    if (src_file == NULL) {
+    if (!found)
         /* Try opening file */
-        src_file = H5F__efc_open(primary_file, temp_file_name, file_intent, H5P_FILE_CREATE_DEFAULT, fapl_id);
-
-        /* Check for file not opened */
-        if (NULL == src_file)
-            /* Reset the error stack */
-            H5E_clear_stack(NULL);
-    } /* end if */
+        found = (*try_func)(temp_file_name, udata);
 
     /* try the 'resolved' name for the virtual file */
-    if (src_file == NULL) {
+    if (!found) {
         char *ptr = NULL;
 
         /* Copy resolved file name */
         if (NULL == (actual_file_name = H5MM_strdup(H5F_ACTUAL_NAME(primary_file))))
-            HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, NULL, "can't duplicate resolved file name string")
+            HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "can't duplicate resolved file name string")
 
         /* get last component of file_name */
         H5_GET_LAST_DELIMITER(actual_file_name, ptr)
@@ -997,28 +990,20 @@ H5F_prefix_open_file(H5F_t *primary_file, H5F_prefix_open_t prefix_type, const c
 
         /* Build new file name for the external file */
         if (H5F__build_name((ptr ? actual_file_name : ""), temp_file_name, &full_name /*out*/) < 0)
-            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't prepend prefix to filename")
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't prepend prefix to filename")
         actual_file_name = (char *)H5MM_xfree(actual_file_name);
 
         /* Try opening with the resolved name */
-        src_file = H5F__efc_open(primary_file, full_name, file_intent, H5P_FILE_CREATE_DEFAULT, fapl_id);
+        found = (*try_func)(full_name, udata);
 
         /* Release name */
         full_name = (char *)H5MM_xfree(full_name);
-
-        /* Check for file not opened */
-        if (NULL == src_file)
-            /* Reset the error stack */
-            H5E_clear_stack(NULL);
     } /* end if */
 
-    /* Set return value (possibly NULL or valid H5F_t *) */
-    ret_value = src_file;
+    /* Set return value */
+    ret_value = found;
 
 done:
-    if ((NULL == ret_value) && src_file)
-        if (H5F_efc_close(primary_file, src_file) < 0)
-            HDONE_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, NULL, "can't close source file")
     if (full_name)
         full_name = (char *)H5MM_xfree(full_name);
     if (temp_file_name)
@@ -1026,9 +1011,132 @@ done:
     if (actual_file_name)
         actual_file_name = (char *)H5MM_xfree(actual_file_name);
 
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5F__prefix_search() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__prefix_try_open
+ *
+ * Purpose:     H5F__prefix_search() callback that tries to open the file
+ *              under NAME.
+ *
+ * Return:      TRUE if the file was opened / FALSE if it was not
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5F__prefix_try_open(const char *name, void *_udata)
+{
+    H5F_prefix_open_ud_t *udata     = (H5F_prefix_open_ud_t *)_udata;
+    htri_t                ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Try opening file */
+    udata->src_file =
+        H5F__efc_open(udata->primary_file, name, udata->file_intent, H5P_FILE_CREATE_DEFAULT, udata->fapl_id);
+
+    /* Check for file not opened */
+    if (NULL == udata->src_file)
+        /* Reset the error stack */
+        H5E_clear_stack(NULL);
+    else
+        ret_value = TRUE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5F__prefix_try_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F__prefix_try_stat
+ *
+ * Purpose:     H5F__prefix_search() callback that checks whether a file
+ *              exists under NAME.
+ *
+ * Return:      TRUE if the file exists / FALSE if it does not
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5F__prefix_try_stat(const char *name, void H5_ATTR_UNUSED *udata)
+{
+    h5_stat_t st;                /* File information */
+    htri_t    ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (0 == HDstat(name, &st))
+        ret_value = TRUE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5F__prefix_try_stat() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_prefix_open_file
+ *
+ * Purpose:     Attempts to open a dataset file.
+ *
+ * Return:      Pointer to an opened file on success / NULL on failure
+ *-------------------------------------------------------------------------
+ */
+H5F_t *
+H5F_prefix_open_file(H5F_t *primary_file, H5F_prefix_open_t prefix_type, const char *prop_prefix,
+                     const char *file_name, unsigned file_intent, hid_t fapl_id)
+{
+    H5F_prefix_open_ud_t udata;            /* User data for H5F__prefix_try_open() */
+    H5F_t *              ret_value = NULL; /* Return value  */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Set up user data, simplifying intent flags for open calls */
+    udata.primary_file = primary_file;
+    udata.file_intent  = file_intent & (H5F_ACC_RDWR | H5F_ACC_SWMR_WRITE | H5F_ACC_SWMR_READ);
+    udata.fapl_id      = fapl_id;
+    udata.src_file     = NULL;
+
+    /* Try opening the file under each name it could have */
+    if (H5F__prefix_search(primary_file, prefix_type, prop_prefix, file_name, H5F__prefix_try_open, &udata) <
+        0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "can't search for prefixed file")
+
+    /* Set return value (possibly NULL or valid H5F_t *) */
+    ret_value = udata.src_file;
+
+done:
+    if ((NULL == ret_value) && udata.src_file)
+        if (H5F_efc_close(primary_file, udata.src_file) < 0)
+            HDONE_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, NULL, "can't close source file")
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5F_prefix_open_file() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F_prefix_file_exists
+ *
+ * Purpose:     Checks whether a file exists under any of the names that
+ *              H5F_prefix_open_file() would try to open it under.  This
+ *              is much cheaper than a failed open, but is only meaningful
+ *              for file drivers that store a file under its name as a
+ *              single POSIX file.
+ *
+ * Return:      TRUE if the file exists / FALSE if it does not /
+ *              Negative on failure
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5F_prefix_file_exists(H5F_t *primary_file, H5F_prefix_open_t prefix_type, const char *prop_prefix,
+                       const char *file_name)
+{
+    htri_t ret_value = FAIL; /* Return value  */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Look for the file under each name it could have */
+    if ((ret_value = H5F__prefix_search(primary_file, prefix_type, prop_prefix, file_name,
+                                        H5F__prefix_try_stat, NULL)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't search for prefixed file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5F_prefix_file_exists() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5F__is_hdf5
  *
@@ -1111,8 +1219,9 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
         f->shared->flags     = flags;
         f->shared->sohm_addr = HADDR_UNDEF;
         f->shared->sohm_vers = HDF5_SHAREDHEADER_VERSION;
-        f->shared->accum.loc = HADDR_UNDEF;
         f->shared->lf        = lf;
+        for (u = 0; u < NELMTS(f->shared->accum); u++)
+            f->shared->accum[u].loc = HADDR_UNDEF;
 
         /* Initialization for handling file space */
         for (u = 0; u < NELMTS(f->shared->fs_addr); u++) {
@@ -1191,6 +1300,8 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get 'use mdc logging' flag")
         if (H5P_get(plist, H5F_ACS_START_MDC_LOG_ON_ACCESS_NAME, &(f->shared->start_mdc_log_on_access)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get 'start mdc log on access' flag")
+        if (H5P_get(plist, H5F_ACS_MDC_LOG_FORMAT_NAME, &(f->shared->mdc_log_format)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get 'mdc log format'")
         if (H5P_get(plist, H5F_ACS_META_BLOCK_SIZE_NAME, &(f->shared->meta_aggr.alloc_size)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get metadata cache size")
         f->shared->meta_aggr.feature_flag = H5FD_FEAT_AGGREGATE_METADATA;
@@ -1736,23 +1847,26 @@ done:
 H5F_t *
 H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id)
 {
-    H5F_t *            file   = NULL; /*the success return value      */
-    H5F_shared_t *     shared = NULL; /*shared part of `file'         */
-    H5FD_t *           lf     = NULL; /*file driver part of `shared'  */
-    unsigned           tent_flags;    /*tentative flags               */
-    H5FD_class_t *     drvr;          /*file driver class info        */
-    H5P_genplist_t *   a_plist;       /*file access property list     */
-    H5F_close_degree_t fc_degree;     /*file close degree             */
-    size_t             page_buf_size;
-    unsigned           page_buf_min_meta_perc = 0;
-    unsigned           page_buf_min_raw_perc  = 0;
-    hbool_t            set_flag               = FALSE; /*set the status_flags in the superblock */
-    hbool_t            clear                  = FALSE; /*clear the status_flags         */
-    hbool_t            evict_on_close;                 /* evict on close value from plist  */
-    hbool_t            use_file_locking = TRUE;        /* Using file locks? */
-    hbool_t            ci_load          = FALSE;       /* whether MDC ci load requested */
-    hbool_t            ci_write         = FALSE;       /* whether MDC CI write requested */
-    H5F_t *            ret_value        = NULL;        /*actual return value           */
+    H5F_t *               file   = NULL; /*the success return value      */
+    H5F_shared_t *        shared = NULL; /*shared part of `file'         */
+    H5FD_t *              lf     = NULL; /*file driver part of `shared'  */
+    unsigned              tent_flags;    /*tentative flags               */
+    H5FD_class_t *        drvr;          /*file driver class info        */
+    H5P_genplist_t *      a_plist;       /*file access property list     */
+    H5F_close_degree_t    fc_degree;     /*file close degree             */
+    size_t                page_buf_size;
+    unsigned              page_buf_min_meta_perc = 0;
+    unsigned              page_buf_min_raw_perc  = 0;
+    H5F_page_buf_policy_t page_buf_policy        = H5F_PAGE_BUF_POLICY_LRU;
+    size_t                page_buf_write_behind  = 0;
+    unsigned              page_buf_read_ahead    = 0;
+    hbool_t               set_flag               = FALSE; /*set the status_flags in the superblock */
+    hbool_t               clear                  = FALSE; /*clear the status_flags         */
+    hbool_t               evict_on_close;                 /* evict on close value from plist  */
+    hbool_t               use_file_locking = TRUE;        /* Using file locks? */
+    hbool_t               ci_load          = FALSE;       /* whether MDC ci load requested */
+    hbool_t               ci_write         = FALSE;       /* whether MDC CI write requested */
+    H5F_t *               ret_value        = NULL;        /*actual return value           */
 
     FUNC_ENTER_NOAPI(NULL)
 
@@ -1916,6 +2030,12 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id)
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get minimum metadata fraction of page buffer")
         if (H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, &page_buf_min_raw_perc) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get minimum raw data fraction of page buffer")
+        if (H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_POLICY_NAME, &page_buf_policy) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get page buffer replacement policy")
+        if (H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_NAME, &page_buf_write_behind) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get page buffer write-behind size")
+        if (H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME, &page_buf_read_ahead) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get page buffer read-ahead")
     } /* end if */
 
     /*
@@ -1931,7 +2051,8 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id)
 
         /* Create the page buffer before initializing the superblock */
         if (page_buf_size)
-            if (H5PB_create(shared, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc) < 0)
+            if (H5PB_create(shared, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc,
+                            page_buf_policy, page_buf_write_behind, page_buf_read_ahead) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to create page buffer")
 
         /* Initialize information about the superblock and allocate space for it */
@@ -1953,7 +2074,8 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id)
 
         /* Create the page buffer before initializing the superblock */
         if (page_buf_size)
-            if (H5PB_create(shared, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc) < 0)
+            if (H5PB_create(shared, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc,
+                            page_buf_policy, page_buf_write_behind, page_buf_read_ahead) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to create page buffer")
 
         /* Open the root group */
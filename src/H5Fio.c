@@ -151,6 +151,53 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F_block_get_mapped
+ *
+ * Purpose:     Returns in *PTR a pointer to SIZE bytes of raw data at
+ *              relative address ADDR inside the memory mapping of a file
+ *              opened read-only with the mmap driver, instead of copying
+ *              them into a caller-supplied buffer.
+ *
+ *              The page buffer and the metadata accumulator are bypassed,
+ *              which is safe because neither can hold modified data in a
+ *              read-only file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_block_get_mapped(H5F_t *f, haddr_t addr, size_t size, const void **ptr /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(ptr);
+    HDassert(H5F_addr_defined(addr));
+
+    /* Check for attempting I/O on 'temporary' file address */
+    if (H5F_addr_le(f->shared->tmp_addr, (addr + size)))
+        HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+    if (H5F_INTENT(f) & H5F_ACC_RDWR)
+        HGOTO_ERROR(H5E_IO, H5E_UNSUPPORTED, FAIL, "file must be opened read-only")
+
+#ifdef H5_HAVE_SYS_MMAN_H
+    if (H5FD_mmap_get_ptr(f->shared->lf, addr, size, ptr) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't get pointer into file mapping")
+#else  /* H5_HAVE_SYS_MMAN_H */
+    HGOTO_ERROR(H5E_IO, H5E_UNSUPPORTED, FAIL, "memory-mapped file I/O is not supported")
+#endif /* H5_HAVE_SYS_MMAN_H */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_get_mapped() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5F_shared_block_write
  *
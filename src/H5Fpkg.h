@@ -186,6 +186,9 @@ struct H5F_blk_aggr_t {
     haddr_t       addr;         /* Location of block left */
 };
 
+/* Number of metadata accumulators per file */
+#define H5F_ACCUM_NUM 4
+
 /* Structure for metadata accumulator fields */
 typedef struct H5F_meta_accum_t {
     unsigned char *buf;        /* Buffer to hold the accumulated metadata */
@@ -195,6 +198,7 @@ typedef struct H5F_meta_accum_t {
     size_t         dirty_off;  /* Offset of the dirty region in the accumulator buffer */
     size_t         dirty_len;  /* Length of the dirty region in the accumulator buffer */
     hbool_t        dirty;      /* Flag to indicate that the accumulated metadata is dirty */
+    uint64_t       last_use;   /* Value of the accumulator clock when last used */
 } H5F_meta_accum_t;
 
 /* A record of the mount table */
@@ -286,6 +290,7 @@ struct H5F_shared_t {
     hbool_t start_mdc_log_on_access;                 /* set when mdc logging should  */
                                                      /* begin on file access/create          */
     char *             mdc_log_location;             /* location of mdc log               */
+    H5F_mdc_log_format_t mdc_log_format;             /* format of mdc log                 */
     hid_t              fcpl_id;                      /* File creation property list ID 	*/
     H5F_close_degree_t fc_degree;                    /* File close behavior degree	*/
     hbool_t  evict_on_close; /* If the file's objects should be evicted from the metadata cache on close */
@@ -346,7 +351,8 @@ struct H5F_shared_t {
     size_t  pgend_meta_thres; /* Do not track page end meta section <= this threshold */
 
     /* Metadata accumulator information */
-    H5F_meta_accum_t accum; /* Metadata accumulator info */
+    H5F_meta_accum_t accum[H5F_ACCUM_NUM]; /* Metadata accumulators, each over a disjoint file region */
+    uint64_t         accum_clock;          /* Clock for finding the least recently used accumulator */
 
     /* Metadata retry info */
     unsigned  read_attempts;        /* The # of reads to try when reading metadata with checksum */
@@ -372,6 +372,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_USE_MDC_LOGGING(F)         ((F)->shared->use_mdc_logging)
 #define H5F_START_MDC_LOG_ON_ACCESS(F) ((F)->shared->start_mdc_log_on_access)
 #define H5F_MDC_LOG_LOCATION(F)        ((F)->shared->mdc_log_location)
+#define H5F_MDC_LOG_FORMAT(F)          ((F)->shared->mdc_log_format)
 #define H5F_ALIGNMENT(F)               ((F)->shared->alignment)
 #define H5F_THRESHOLD(F)               ((F)->shared->threshold)
 #define H5F_PGEND_META_THRES(F)        ((F)->shared->fs.pgend_meta_thres)
@@ -435,6 +436,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_USE_MDC_LOGGING(F)         (H5F_use_mdc_logging(F))
 #define H5F_START_MDC_LOG_ON_ACCESS(F) (H5F_start_mdc_log_on_access(F))
 #define H5F_MDC_LOG_LOCATION(F)        (H5F_mdc_log_location(F))
+#define H5F_MDC_LOG_FORMAT(F)          (H5F_mdc_log_format(F))
 #define H5F_ALIGNMENT(F)               (H5F_get_alignment(F))
 #define H5F_THRESHOLD(F)               (H5F_get_threshold(F))
 #define H5F_PGEND_META_THRES(F)        (H5F_get_pgend_meta_thres(F))
@@ -598,6 +600,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_ACS_MDC_LOG_LOCATION_NAME "mdc_log_location" /* Name of metadata cache log location */
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_NAME                                                                 \
     "start_mdc_log_on_access" /* Whether logging starts on file create/open */
+#define H5F_ACS_MDC_LOG_FORMAT_NAME "mdc_log_format" /* Format of the metadata cache log */
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_NAME                                                                     \
     "evict_on_close_flag" /* Whether or not the metadata cache will evict objects on close */
 #define H5F_ACS_COLL_MD_WRITE_FLAG_NAME                                                                      \
@@ -610,6 +613,12 @@ typedef struct H5F_t H5F_t;
     "page_buffer_min_meta_perc" /* the min metadata percentage for the page buffer cache */
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME                                                                \
     "page_buffer_min_raw_perc" /* the min raw data percentage for the page buffer cache */
+#define H5F_ACS_PAGE_BUFFER_POLICY_NAME                                                                      \
+    "page_buffer_policy" /* the replacement policy for the page buffer cache */
+#define H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_NAME                                                                \
+    "page_buffer_write_behind" /* the dirty raw data budget for page buffer write-behind */
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME                                                                  \
+    "page_buffer_read_ahead" /* the max # of raw data pages the page buffer reads ahead */
 #define H5F_ACS_USE_FILE_LOCKING_NAME                                                                        \
     "use_file_locking" /* whether or not we use file locks for SWMR control and to prevent multiple writers  \
                         */
@@ -894,9 +903,10 @@ H5_DLL hsize_t            H5F_get_threshold(const H5F_t *f);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL H5P_coll_md_read_flag_t H5F_coll_md_read(const H5F_t *f);
 #endif /* H5_HAVE_PARALLEL */
-H5_DLL hbool_t H5F_use_mdc_logging(const H5F_t *f);
-H5_DLL hbool_t H5F_start_mdc_log_on_access(const H5F_t *f);
-H5_DLL char *  H5F_mdc_log_location(const H5F_t *f);
+H5_DLL hbool_t              H5F_use_mdc_logging(const H5F_t *f);
+H5_DLL hbool_t              H5F_start_mdc_log_on_access(const H5F_t *f);
+H5_DLL char *               H5F_mdc_log_location(const H5F_t *f);
+H5_DLL H5F_mdc_log_format_t H5F_mdc_log_format(const H5F_t *f);
 
 /* Functions that retrieve values from VFD layer */
 H5_DLL hid_t   H5F_get_driver_id(const H5F_t *f);
@@ -917,6 +927,7 @@ H5_DLL herr_t  H5F_flush_mounts(H5F_t *f);
 H5_DLL herr_t H5F_shared_block_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
                                     void *buf /*out*/);
 H5_DLL herr_t H5F_block_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, void *buf /*out*/);
+H5_DLL herr_t H5F_block_get_mapped(H5F_t *f, haddr_t addr, size_t size, const void **ptr /*out*/);
 H5_DLL herr_t H5F_shared_block_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
                                      const void *buf);
 H5_DLL herr_t H5F_block_write(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
@@ -972,6 +983,8 @@ H5_DLL herr_t H5F_efc_close(H5F_t *parent, H5F_t *file);
 H5_DLL H5F_t *H5F_prefix_open_file(H5F_t *primary_file, H5F_prefix_open_t prefix_type,
                                    const char *prop_prefix, const char *file_name, unsigned file_intent,
                                    hid_t fapl_id);
+H5_DLL htri_t H5F_prefix_file_exists(H5F_t *primary_file, H5F_prefix_open_t prefix_type,
+                                     const char *prop_prefix, const char *file_name);
 
 /* Global heap CWFS routines */
 H5_DLL herr_t H5F_cwfs_add(H5F_t *f, struct H5HG_heap_t *heap);
@@ -200,6 +200,21 @@ typedef enum H5F_fspace_strategy_t {
     H5F_FSPACE_STRATEGY_NTYPES    /* must be last */
 } H5F_fspace_strategy_t;
 
+/* Page buffer replacement policy */
+typedef enum H5F_page_buf_policy_t {
+    H5F_PAGE_BUF_POLICY_LRU = 0, /* Least recently used (the library default) */
+    H5F_PAGE_BUF_POLICY_2Q  = 1, /* Scan resistant "2Q" policy: pages referenced once can't push out */
+                                 /* pages that have been referenced repeatedly */
+    H5F_PAGE_BUF_POLICY_NTYPES   /* must be last */
+} H5F_page_buf_policy_t;
+
+/* Metadata cache log file format */
+typedef enum H5F_mdc_log_format_t {
+    H5F_MDC_LOG_FORMAT_JSON   = 0, /* Human-readable JSON (the library default) */
+    H5F_MDC_LOG_FORMAT_BINARY = 1, /* Compact fixed-size binary records, for use with h5mdclog */
+    H5F_MDC_LOG_FORMAT_NTYPES      /* must be last */
+} H5F_mdc_log_format_t;
+
 /* Deprecated: File space handling strategy for release 1.10.0 */
 /* They are mapped to H5F_fspace_strategy_t as defined above from release 1.10.1 onwards */
 typedef enum H5F_file_space_type_t {
@@ -1116,6 +1116,29 @@ H5F_mdc_log_location(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->mdc_log_location)
 } /* end H5F_mdc_log_location() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5F_mdc_log_format
+ *
+ * Purpose:  Quick and dirty routine to retrieve the MDC log format
+ *           for this file.
+ *           (Mainly added to stop non-file routines from poking about in the
+ *           H5F_t data structure)
+ *
+ * Return:   The log format on success/abort on failure (shouldn't fail)
+ *-------------------------------------------------------------------------
+ */
+H5F_mdc_log_format_t
+H5F_mdc_log_format(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->mdc_log_format)
+} /* end H5F_mdc_log_format() */
+
 /*-------------------------------------------------------------------------
  * Function: H5F_get_alignment
  *
@@ -79,6 +79,7 @@
 
 static haddr_t H5HG__create(H5F_t *f, size_t size);
 static size_t  H5HG__alloc(H5F_t *f, H5HG_heap_t *heap, size_t size, unsigned *heap_flags_ptr);
+static int     H5HG__read_cmp(const void *_obj1, const void *_obj2);
 
 /*********************/
 /* Package Variables */
@@ -634,6 +635,116 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5HG_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5HG__read_cmp
+ *
+ * Purpose:	Compares two objects to read by their location in the
+ *		global heap, for sorting with HDqsort().
+ *
+ * Return:	An integer less than, equal to, or greater than zero if
+ *		the first object is located before, at, or after the
+ *		second object.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5HG__read_cmp(const void *_obj1, const void *_obj2)
+{
+    const H5HG_read_t *obj1 = (const H5HG_read_t *)_obj1;
+    const H5HG_read_t *obj2 = (const H5HG_read_t *)_obj2;
+    int                ret_value;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (H5F_addr_lt(obj1->hobj.addr, obj2->hobj.addr))
+        ret_value = -1;
+    else if (H5F_addr_gt(obj1->hobj.addr, obj2->hobj.addr))
+        ret_value = 1;
+    else if (obj1->hobj.idx < obj2->hobj.idx)
+        ret_value = -1;
+    else if (obj1->hobj.idx > obj2->hobj.idx)
+        ret_value = 1;
+    else
+        ret_value = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5HG__read_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_read_multi
+ *
+ * Purpose:	Reads a batch of global heap objects into the buffers
+ *		supplied by the caller.  The objects are sorted (in place)
+ *		by their location, so that each heap collection is
+ *		protected only once, and its objects are copied out in a
+ *		single pass over it.
+ *
+ *		The size of each object must match the expected size given
+ *		for it, and objects with an expected size of zero are
+ *		skipped.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_read_multi(H5F_t *f, size_t nobjs, H5HG_read_t *objs)
+{
+    H5HG_heap_t *heap      = NULL;        /* Pointer to global heap object */
+    haddr_t      heap_addr = HADDR_UNDEF; /* Address of protected heap */
+    size_t       u;                       /* Local index variable */
+    herr_t       ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(H5AC__GLOBALHEAP_TAG, FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(objs || nobjs == 0);
+
+    /* Group the objects by heap collection */
+    if (nobjs > 1)
+        HDqsort(objs, nobjs, sizeof(H5HG_read_t), H5HG__read_cmp);
+
+    for (u = 0; u < nobjs; u++) {
+        H5HG_read_t *obj = &objs[u]; /* Object to read */
+
+        if (0 == obj->size)
+            continue;
+        HDassert(obj->buf);
+
+        /* Switch to the object's heap collection, if necessary */
+        if (NULL == heap || !H5F_addr_eq(obj->hobj.addr, heap_addr)) {
+            if (heap) {
+                if (H5AC_unprotect(f, H5AC_GHEAP, heap_addr, heap, H5AC__NO_FLAGS_SET) < 0)
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release global heap")
+                heap = NULL;
+            } /* end if */
+
+            if (NULL == (heap = H5HG__protect(f, obj->hobj.addr, H5AC__READ_ONLY_FLAG)))
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect global heap")
+            heap_addr = obj->hobj.addr;
+
+            /* Advance the heap in the CWFS list */
+            if (heap->obj[0].begin)
+                if (H5F_cwfs_advance_heap(f, heap, FALSE) < 0)
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTMODIFY, FAIL, "can't adjust file's CWFS")
+        } /* end if */
+
+        /* Copy the object */
+        if (obj->hobj.idx >= heap->nused || NULL == heap->obj[obj->hobj.idx].begin)
+            HGOTO_ERROR(H5E_HEAP, H5E_BADVALUE, FAIL, "invalid global heap object index")
+        if (heap->obj[obj->hobj.idx].size != obj->size)
+            HGOTO_ERROR(H5E_HEAP, H5E_BADVALUE, FAIL, "global heap object size does not match")
+        H5MM_memcpy(obj->buf, heap->obj[obj->hobj.idx].begin + H5HG_SIZEOF_OBJHDR(f), obj->size);
+    } /* end for */
+
+done:
+    if (heap && H5AC_unprotect(f, H5AC_GHEAP, heap_addr, heap, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release global heap")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5HG_read_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5HG_link
  *
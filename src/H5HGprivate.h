@@ -27,6 +27,13 @@ typedef struct H5HG_t {
     size_t  idx;  /*object ID within collection	*/
 } H5HG_t;
 
+/* Information for reading an object with H5HG_read_multi() */
+typedef struct H5HG_read_t {
+    H5HG_t hobj; /* Location of object in global heap */
+    size_t size; /* Expected size of object */
+    void * buf;  /* Buffer to read object into */
+} H5HG_read_t;
+
 /* Typedef for heap in memory (defined in H5HGpkg.h) */
 typedef struct H5HG_heap_t H5HG_heap_t;
 
@@ -55,6 +62,7 @@ typedef struct H5HG_heap_t H5HG_heap_t;
 /* Main global heap routines */
 H5_DLL herr_t H5HG_insert(H5F_t *f, size_t size, const void *obj, H5HG_t *hobj /*out*/);
 H5_DLL void * H5HG_read(H5F_t *f, H5HG_t *hobj, void *object, size_t *buf_size /*out*/);
+H5_DLL herr_t H5HG_read_multi(H5F_t *f, size_t nobjs, H5HG_read_t *objs);
 H5_DLL int    H5HG_link(H5F_t *f, const H5HG_t *hobj, int adjust);
 H5_DLL herr_t H5HG_get_obj_size(H5F_t *f, H5HG_t *hobj, size_t *obj_size);
 H5_DLL herr_t H5HG_remove(H5F_t *f, H5HG_t *hobj);
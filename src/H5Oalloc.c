@@ -965,6 +965,7 @@ H5O__alloc_chunk(H5F_t *f, H5O_t *oh, size_t size, size_t found_null, const H5O_
                         if (u < oh->nmesgs - 1)
                             HDmemmove(curr_msg, curr_msg + 1, ((oh->nmesgs - 1) - u) * sizeof(H5O_mesg_t));
                         oh->nmesgs--;
+                        H5O__attr_index_reset(oh); /* Later messages have shifted */
                     } /* end if */
                     else {
                         HDassert(curr_msg->type->id != H5O_CONT_ID);
@@ -1065,6 +1066,7 @@ H5O__alloc_chunk(H5F_t *f, H5O_t *oh, size_t size, size_t found_null, const H5O_
                 /* Decrement # of messages */
                 /* (Don't bother reducing size of message array for now -QAK) */
                 oh->nmesgs--;
+                H5O__attr_index_reset(oh); /* Later messages have shifted */
 
                 /* Adjust message index for new NULL message */
                 found_null--;
@@ -1375,6 +1377,10 @@ H5O__release_mesg(H5F_t *f, H5O_t *oh, H5O_mesg_t *mesg, hbool_t adj_link)
     if (NULL == (chk_proxy = H5O__chunk_protect(f, oh, mesg->chunkno)))
         HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to protect object header chunk")
 
+    /* Remove an attribute from the compact attribute name index */
+    if (H5O_MSG_ATTR == mesg->type)
+        H5O__attr_index_remove(oh, (size_t)(mesg - oh->mesg));
+
     /* Free any native information */
     H5O__msg_free_mesg(mesg);
 
@@ -1539,6 +1545,7 @@ H5O__move_cont(H5F_t *f, H5O_t *oh, unsigned cont_u)
                     HDmemmove(&oh->mesg[cont_u], &oh->mesg[cont_u + 1],
                               ((oh->nmesgs - 1) - cont_u) * sizeof(H5O_mesg_t));
                 oh->nmesgs--;
+                H5O__attr_index_reset(oh); /* Later messages have shifted */
             } /* end else */
 
             /* Move message(s) forward into continuation message */
@@ -1557,6 +1564,7 @@ H5O__move_cont(H5F_t *f, H5O_t *oh, unsigned cont_u)
                             HDmemmove(&oh->mesg[v], &oh->mesg[v + 1],
                                       ((oh->nmesgs - 1) - v) * sizeof(H5O_mesg_t));
                         oh->nmesgs--;
+                        H5O__attr_index_reset(oh); /* Later messages have shifted */
                     } /* end if */
                 }     /* end if */
 
@@ -2062,6 +2070,7 @@ H5O__merge_null(H5F_t *f, H5O_t *oh)
                             /* Decrement # of messages */
                             /* (Don't bother reducing size of message array for now -QAK) */
                             oh->nmesgs--;
+                            H5O__attr_index_reset(oh); /* Later messages have shifted */
 
                             /* The merge null message might span the entire chunk: scan for empty chunk to
                              * remove */
@@ -2238,6 +2247,7 @@ H5O__remove_empty_chunks(H5F_t *f, H5O_t *oh)
                 /* Decrement # of messages */
                 /* (Don't bother reducing size of message array for now -QAK) */
                 oh->nmesgs--;
+                H5O__attr_index_reset(oh); /* Later messages have shifted */
 
                 /* Adjust chunk # for messages in chunks after deleted chunk */
                 for (u = 0, curr_msg = &oh->mesg[0]; u < oh->nmesgs; u++, curr_msg++) {
@@ -2432,6 +2442,7 @@ H5O__alloc_shrink_chunk(H5F_t *f, H5O_t *oh, unsigned chunkno)
             /* Decrement # of messages */
             /* (Don't bother reducing size of message array for now) */
             oh->nmesgs--;
+            H5O__attr_index_reset(oh); /* Later messages have shifted */
         } /* end if */
     }     /* end for */
 
@@ -33,6 +33,7 @@
 #include "H5private.h"   /* Generic Functions                        */
 #include "H5Apkg.h"      /* Attributes                               */
 #include "H5Eprivate.h"  /* Error handling                           */
+#include "H5FLprivate.h" /* Free Lists                               */
 #include "H5MMprivate.h" /* Memory management                        */
 #include "H5Opkg.h"      /* Object headers                           */
 #include "H5SMprivate.h" /* Shared Object Header Messages            */
@@ -43,10 +44,22 @@
 /* Local Macros */
 /****************/
 
+/* Minimum number of slots in a compact attribute name index */
+#define H5O_ATTR_INDEX_MIN_SLOTS 16
+
+/* Message index for an unused compact attribute name index slot */
+#define H5O_ATTR_INDEX_EMPTY SIZET_MAX
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Slot in a compact attribute name index */
+typedef struct H5O_attr_index_slot_t {
+    uint32_t hash;    /* Hash of the attribute's name */
+    size_t   msg_idx; /* Index of the attribute's message in the object header */
+} H5O_attr_index_slot_t;
+
 /* User data for iteration when converting attributes to dense storage */
 typedef struct {
     H5F_t *      f;     /* Pointer to file for insertion */
@@ -97,6 +110,19 @@ typedef struct {
 /* Package Typedefs */
 /********************/
 
+/* Index of compact attribute messages by name.  This is an open-addressed
+ * hash table (with linear probing) that maps the hash of an attribute's name
+ * to the index of its message in the object header, and is built on demand
+ * for the header's first by-name lookup.  Entries are verified against the
+ * message when they are used, so an entry left behind for a message that was
+ * released without being decoded is harmless.
+ */
+struct H5O_attr_index_t {
+    size_t                 nslots; /* Number of slots in table (a power of two) */
+    size_t                 nused;  /* Number of slots in use */
+    H5O_attr_index_slot_t *slot;   /* Array of slots */
+};
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -119,6 +145,11 @@ static herr_t H5O__attr_remove_cb(H5O_t *oh, H5O_mesg_t *mesg, unsigned H5_ATTR_
 static herr_t H5O__attr_exists_cb(H5O_t H5_ATTR_UNUSED *oh, H5O_mesg_t *mesg,
                                   unsigned H5_ATTR_UNUSED sequence, unsigned H5_ATTR_UNUSED *oh_modified,
                                   void *_udata);
+static void   H5O__attr_index_add(H5O_attr_index_t *aindex, uint32_t hash, size_t msg_idx);
+static herr_t H5O__attr_index_build(H5F_t *f, H5O_t *oh);
+static htri_t H5O__attr_index_find(H5F_t *f, H5O_t *oh, const char *name, size_t *msg_idx);
+static herr_t H5O__attr_op_by_name(H5F_t *f, H5O_t *oh, const char *name, const H5O_mesg_operator_t *op,
+                                   void *op_data);
 
 /*********************/
 /* Package Variables */
@@ -132,6 +163,12 @@ static herr_t H5O__attr_exists_cb(H5O_t H5_ATTR_UNUSED *oh, H5O_mesg_t *mesg,
 /* Local Variables */
 /*******************/
 
+/* Declare a free list to manage the H5O_attr_index_t struct */
+H5FL_DEFINE_STATIC(H5O_attr_index_t);
+
+/* Declare a free list to manage sequences of H5O_attr_index_slot_t */
+H5FL_SEQ_DEFINE_STATIC(H5O_attr_index_slot_t);
+
 /*-------------------------------------------------------------------------
  * Function:    H5O__attr_to_dense_cb
  *
@@ -483,10 +520,10 @@ H5O__attr_open_by_name(const H5O_loc_t *loc, const char *name)
             udata.name = name;
             udata.attr = NULL;
 
-            /* Iterate over attributes, to locate correct one to open */
+            /* Look up attribute by name, to open it */
             op.op_type  = H5O_MESG_OP_LIB;
             op.u.lib_op = H5O__attr_open_cb;
-            if (H5O__msg_iterate_real(loc->file, oh, H5O_MSG_ATTR, &op, &udata) < 0)
+            if (H5O__attr_op_by_name(loc->file, oh, name, &op, &udata) < 0)
                 HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, NULL, "error updating attribute")
 
             /* Check that we found the attribute */
@@ -677,6 +714,10 @@ H5O__attr_find_opened_attr(const H5O_loc_t *loc, H5A_t **attr, const char *name_
             if (NULL == (*attr = (H5A_t *)H5VL_object_verify(attr_id_list[u], H5I_ATTR)))
                 HGOTO_ERROR(H5E_ATTR, H5E_BADTYPE, FAIL, "not an attribute")
 
+            /* Skip attributes on other objects before comparing names */
+            if (loc->addr != (*attr)->oloc.addr)
+                continue;
+
             /* Get file serial number for attribute */
             if (H5F_get_fileno((*attr)->oloc.file, &attr_fnum) < 0)
                 HGOTO_ERROR(H5E_ATTR, H5E_BADVALUE, FAIL, "can't get file serial number")
@@ -685,8 +726,7 @@ H5O__attr_find_opened_attr(const H5O_loc_t *loc, H5A_t **attr, const char *name_
              *  address to which the attribute is attached, and file serial
              *  number should all match.
              */
-            if (!HDstrcmp(name_to_open, (*attr)->shared->name) && loc->addr == (*attr)->oloc.addr &&
-                loc_fnum == attr_fnum) {
+            if (loc_fnum == attr_fnum && !HDstrcmp(name_to_open, (*attr)->shared->name)) {
                 ret_value = TRUE;
                 break;
             } /* end if */
@@ -907,10 +947,10 @@ H5O__attr_write(const H5O_loc_t *loc, H5A_t *attr)
         udata.attr  = attr;
         udata.found = FALSE;
 
-        /* Iterate over attributes, to locate correct one to update */
+        /* Look up attribute by name, to update it */
         op.op_type  = H5O_MESG_OP_LIB;
         op.u.lib_op = H5O__attr_write_cb;
-        if (H5O__msg_iterate_real(loc->file, oh, H5O_MSG_ATTR, &op, &udata) < 0)
+        if (H5O__attr_op_by_name(loc->file, oh, attr->shared->name, &op, &udata) < 0)
             HGOTO_ERROR(H5E_ATTR, H5E_CANTUPDATE, FAIL, "error updating attribute")
 
         /* Check that we found the attribute */
@@ -1006,11 +1046,15 @@ H5O__attr_rename_mod_cb(H5O_t *oh, H5O_mesg_t *mesg /*in,out*/, unsigned H5_ATTR
     /* Find correct attribute message to rename */
     if (HDstrcmp(((H5A_t *)mesg->native)->shared->name, udata->old_name) == 0) {
         unsigned old_version = ((H5A_t *)mesg->native)->shared->version; /* Old version of the attribute */
+        size_t   msg_idx     = (size_t)(mesg - oh->mesg); /* Index of the attribute's message */
 
         /* Protect chunk */
         if (NULL == (chk_proxy = H5O__chunk_protect(udata->f, oh, mesg->chunkno)))
             HGOTO_ERROR(H5E_ATTR, H5E_CANTPROTECT, H5_ITER_ERROR, "unable to load object header chunk")
 
+        /* Remove the old name from the compact attribute name index */
+        H5O__attr_index_remove(oh, msg_idx);
+
         /* Change the name for the attribute */
         H5MM_xfree(((H5A_t *)mesg->native)->shared->name);
         ((H5A_t *)mesg->native)->shared->name = H5MM_xstrdup(udata->new_name);
@@ -1034,6 +1078,9 @@ H5O__attr_rename_mod_cb(H5O_t *oh, H5O_mesg_t *mesg /*in,out*/, unsigned H5_ATTR
             if (H5O__attr_update_shared(udata->f, oh, (H5A_t *)mesg->native, NULL) < 0)
                 HGOTO_ERROR(H5E_ATTR, H5E_CANTUPDATE, H5_ITER_ERROR,
                             "unable to update attribute in shared storage")
+
+            /* Index the attribute under its new name */
+            H5O__attr_index_insert(oh, msg_idx);
         } /* end if */
         else {
             /* Sanity check */
@@ -1080,7 +1127,10 @@ H5O__attr_rename_mod_cb(H5O_t *oh, H5O_mesg_t *mesg /*in,out*/, unsigned H5_ATTR
                 /* Close the local copy of the attribute */
                 H5A__close(attr);
             } /* end if */
-        }     /* end else */
+            else
+                /* Index the attribute under its new name */
+                H5O__attr_index_insert(oh, msg_idx);
+        } /* end else */
 
         /* Indicate that the object header was modified */
         *oh_modified |= H5O_MODIFY;
@@ -1154,20 +1204,20 @@ H5O__attr_rename(const H5O_loc_t *loc, const char *old_name, const char *new_nam
         udata.new_name = new_name;
         udata.found    = FALSE;
 
-        /* Iterate over attributes, to check if "new name" exists already */
+        /* Look up "new name", to check if it exists already */
         op.op_type  = H5O_MESG_OP_LIB;
         op.u.lib_op = H5O__attr_rename_chk_cb;
-        if (H5O__msg_iterate_real(loc->file, oh, H5O_MSG_ATTR, &op, &udata) < 0)
+        if (H5O__attr_op_by_name(loc->file, oh, new_name, &op, &udata) < 0)
             HGOTO_ERROR(H5E_ATTR, H5E_CANTUPDATE, FAIL, "error updating attribute")
 
         /* If the new name was found, indicate an error */
         if (udata.found)
             HGOTO_ERROR(H5E_ATTR, H5E_EXISTS, FAIL, "attribute with new name already exists")
 
-        /* Iterate over attributes again, to actually rename attribute with old name */
+        /* Look up "old name", to actually rename the attribute */
         op.op_type  = H5O_MESG_OP_LIB;
         op.u.lib_op = H5O__attr_rename_mod_cb;
-        if (H5O__msg_iterate_real(loc->file, oh, H5O_MSG_ATTR, &op, &udata) < 0)
+        if (H5O__attr_op_by_name(loc->file, oh, old_name, &op, &udata) < 0)
             HGOTO_ERROR(H5E_ATTR, H5E_CANTUPDATE, FAIL, "error updating attribute")
 
         /* Check that we found the attribute to rename */
@@ -1535,10 +1585,10 @@ H5O__attr_remove(const H5O_loc_t *loc, const char *name)
         udata.name  = name;
         udata.found = FALSE;
 
-        /* Iterate over attributes, to locate correct one to delete */
+        /* Look up attribute by name, to delete it */
         op.op_type  = H5O_MESG_OP_LIB;
         op.u.lib_op = H5O__attr_remove_cb;
-        if (H5O__msg_iterate_real(loc->file, oh, H5O_MSG_ATTR, &op, &udata) < 0)
+        if (H5O__attr_op_by_name(loc->file, oh, udata.name, &op, &udata) < 0)
             HGOTO_ERROR(H5E_ATTR, H5E_CANTDELETE, FAIL, "error deleting attribute")
 
         /* Check that we found the attribute */
@@ -1624,10 +1674,10 @@ H5O__attr_remove_by_idx(const H5O_loc_t *loc, H5_index_t idx_type, H5_iter_order
         udata.name  = ((atable.attrs[n])->shared)->name;
         udata.found = FALSE;
 
-        /* Iterate over attributes, to locate correct one to delete */
+        /* Look up attribute by name, to delete it */
         op.op_type  = H5O_MESG_OP_LIB;
         op.u.lib_op = H5O__attr_remove_cb;
-        if (H5O__msg_iterate_real(loc->file, oh, H5O_MSG_ATTR, &op, &udata) < 0)
+        if (H5O__attr_op_by_name(loc->file, oh, udata.name, &op, &udata) < 0)
             HGOTO_ERROR(H5E_ATTR, H5E_CANTDELETE, FAIL, "error deleting attribute")
 
         /* Check that we found the attribute */
@@ -1796,10 +1846,10 @@ H5O__attr_exists(const H5O_loc_t *loc, const char *name)
         udata.name  = name;
         udata.found = FALSE;
 
-        /* Iterate over existing attributes, checking for attribute with same name */
+        /* Look up attribute by name, checking for attribute with same name */
         op.op_type  = H5O_MESG_OP_LIB;
         op.u.lib_op = H5O__attr_exists_cb;
-        if (H5O__msg_iterate_real(loc->file, oh, H5O_MSG_ATTR, &op, &udata) < 0)
+        if (H5O__attr_op_by_name(loc->file, oh, name, &op, &udata) < 0)
             HGOTO_ERROR(H5E_ATTR, H5E_BADITER, FAIL, "error checking for existence of attribute")
 
         /* Check that we found the attribute */
@@ -1895,3 +1945,371 @@ done:
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5O__attr_bh_info() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_index_add
+ *
+ * Purpose:     Add an entry to a compact attribute name index, unless the
+ *              message is already indexed under the same name hash.  The
+ *              index must have an unused slot.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5O__attr_index_add(H5O_attr_index_t *aindex, uint32_t hash, size_t msg_idx)
+{
+    size_t mask = aindex->nslots - 1; /* Mask for wrapping slot indices */
+    size_t u;                         /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(aindex->nused < aindex->nslots);
+
+    /* Probe for the message's entry or an unused slot */
+    u = hash & mask;
+    while (aindex->slot[u].msg_idx != H5O_ATTR_INDEX_EMPTY &&
+           !(aindex->slot[u].msg_idx == msg_idx && aindex->slot[u].hash == hash))
+        u = (u + 1) & mask;
+
+    /* Fill the unused slot */
+    if (aindex->slot[u].msg_idx == H5O_ATTR_INDEX_EMPTY) {
+        aindex->slot[u].hash    = hash;
+        aindex->slot[u].msg_idx = msg_idx;
+        aindex->nused++;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5O__attr_index_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_index_build
+ *
+ * Purpose:     Build the compact attribute name index for an object header,
+ *              decoding any attribute messages that aren't decoded yet.
+ *
+ *              The table is sized for a load factor of at most 1/4, so
+ *              that attributes can be added to the header for a while
+ *              before the index has to be rebuilt.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__attr_index_build(H5F_t *f, H5O_t *oh)
+{
+    H5O_attr_index_t *aindex    = NULL;    /* New index */
+    size_t            nattrs    = 0;       /* Number of attribute messages */
+    size_t            u;                   /* Local index variable */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(oh);
+    HDassert(NULL == oh->attr_index);
+
+    /* Count the attribute messages */
+    for (u = 0; u < oh->nmesgs; u++)
+        if (H5O_MSG_ATTR == oh->mesg[u].type)
+            nattrs++;
+
+    /* Allocate the index */
+    if (NULL == (aindex = H5FL_MALLOC(H5O_attr_index_t)))
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, FAIL, "memory allocation failed for attribute name index")
+    aindex->nused = 0;
+    aindex->slot  = NULL;
+    for (aindex->nslots = H5O_ATTR_INDEX_MIN_SLOTS; aindex->nslots < 4 * nattrs; aindex->nslots *= 2)
+        ;
+    if (NULL == (aindex->slot = H5FL_SEQ_MALLOC(H5O_attr_index_slot_t, aindex->nslots)))
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, FAIL, "memory allocation failed for attribute name index")
+    for (u = 0; u < aindex->nslots; u++)
+        aindex->slot[u].msg_idx = H5O_ATTR_INDEX_EMPTY;
+
+    /* Add each attribute message to the index */
+    for (u = 0; u < oh->nmesgs; u++) {
+        H5O_mesg_t *mesg = &oh->mesg[u]; /* Current message */
+
+        if (H5O_MSG_ATTR == mesg->type) {
+            const char *name; /* Attribute's name */
+
+            /* Decode the message if necessary */
+            H5O_LOAD_NATIVE(f, 0, oh, mesg, FAIL)
+
+            name = ((H5A_t *)mesg->native)->shared->name;
+            H5O__attr_index_add(aindex, H5_checksum_lookup3(name, HDstrlen(name), 0), u);
+        } /* end if */
+    }     /* end for */
+
+    /* Attach the index to the object header */
+    oh->attr_index = aindex;
+
+done:
+    if (ret_value < 0 && aindex) {
+        if (aindex->slot)
+            aindex->slot = H5FL_SEQ_FREE(H5O_attr_index_slot_t, aindex->slot);
+        aindex = H5FL_FREE(H5O_attr_index_t, aindex);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__attr_index_build() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_index_find
+ *
+ * Purpose:     Look up the compact attribute message with a given name,
+ *              building the object header's attribute name index if it
+ *              doesn't exist yet.
+ *
+ * Return:      TRUE if the attribute was found (its message index is
+ *              returned in MSG_IDX), FALSE if it wasn't, FAIL on error
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5O__attr_index_find(H5F_t *f, H5O_t *oh, const char *name, size_t *msg_idx)
+{
+    H5O_attr_index_t *aindex;            /* Attribute name index */
+    uint32_t          hash;              /* Hash of attribute's name */
+    size_t            mask;              /* Mask for wrapping slot indices */
+    size_t            u;                 /* Local index variable */
+    htri_t            ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(oh);
+    HDassert(name);
+    HDassert(msg_idx);
+
+    /* Build the index, if the header doesn't have one */
+    if (NULL == oh->attr_index)
+        if (H5O__attr_index_build(f, oh) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "can't build attribute name index")
+    aindex = oh->attr_index;
+
+    /* Probe the entries with a matching hash */
+    hash = H5_checksum_lookup3(name, HDstrlen(name), 0);
+    mask = aindex->nslots - 1;
+    for (u = hash & mask; aindex->slot[u].msg_idx != H5O_ATTR_INDEX_EMPTY; u = (u + 1) & mask)
+        if (aindex->slot[u].hash == hash) {
+            size_t      idx = aindex->slot[u].msg_idx; /* Index of candidate message */
+            H5O_mesg_t *mesg;                          /* Candidate message */
+
+            /* Skip entries that don't refer to an attribute message any longer */
+            if (idx >= oh->nmesgs || H5O_MSG_ATTR != oh->mesg[idx].type)
+                continue;
+            mesg = &oh->mesg[idx];
+
+            /* Decode the message if necessary */
+            H5O_LOAD_NATIVE(f, 0, oh, mesg, FAIL)
+
+            /* Check for the attribute's name */
+            if (0 == HDstrcmp(((H5A_t *)mesg->native)->shared->name, name)) {
+                *msg_idx = idx;
+                HGOTO_DONE(TRUE)
+            } /* end if */
+        }     /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__attr_index_find() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_index_insert
+ *
+ * Purpose:     Add the attribute message at index IDX in an object header
+ *              to the header's compact attribute name index, if it has
+ *              one.  The message must be decoded.
+ *
+ *              When the index is too full to take another entry, it is
+ *              discarded instead, and rebuilt with more room on the next
+ *              lookup.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5O__attr_index_insert(H5O_t *oh, size_t idx)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(oh);
+    HDassert(idx < oh->nmesgs);
+    HDassert(H5O_MSG_ATTR == oh->mesg[idx].type);
+    HDassert(oh->mesg[idx].native);
+
+    if (oh->attr_index) {
+        if (2 * (oh->attr_index->nused + 1) > oh->attr_index->nslots)
+            H5O__attr_index_reset(oh);
+        else {
+            const char *name = ((H5A_t *)oh->mesg[idx].native)->shared->name; /* Attribute's name */
+
+            H5O__attr_index_add(oh->attr_index, H5_checksum_lookup3(name, HDstrlen(name), 0), idx);
+        } /* end else */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5O__attr_index_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_index_remove
+ *
+ * Purpose:     Remove the attribute message at index IDX in an object
+ *              header from the header's compact attribute name index, if
+ *              it has one.  Nothing is done for a message that isn't
+ *              decoded, since its entry (if any) is skipped by lookups
+ *              once the message is released.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5O__attr_index_remove(H5O_t *oh, size_t idx)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(oh);
+    HDassert(idx < oh->nmesgs);
+    HDassert(H5O_MSG_ATTR == oh->mesg[idx].type);
+
+    if (oh->attr_index && oh->mesg[idx].native) {
+        H5O_attr_index_t *aindex = oh->attr_index; /* Attribute name index */
+        const char *      name;                    /* Attribute's name */
+        uint32_t          hash;                    /* Hash of attribute's name */
+        size_t            mask;                    /* Mask for wrapping slot indices */
+        size_t            u;                       /* Local index variable */
+
+        /* Locate the message's entry */
+        name = ((H5A_t *)oh->mesg[idx].native)->shared->name;
+        hash = H5_checksum_lookup3(name, HDstrlen(name), 0);
+        mask = aindex->nslots - 1;
+        u    = hash & mask;
+        while (aindex->slot[u].msg_idx != H5O_ATTR_INDEX_EMPTY &&
+               !(aindex->slot[u].msg_idx == idx && aindex->slot[u].hash == hash))
+            u = (u + 1) & mask;
+
+        if (aindex->slot[u].msg_idx != H5O_ATTR_INDEX_EMPTY) {
+            size_t v; /* Local index variable */
+
+            /* Shift later entries in the probe sequence back over the removed
+             * entry, so no lookup stops short at the unused slot */
+            for (v = (u + 1) & mask; aindex->slot[v].msg_idx != H5O_ATTR_INDEX_EMPTY; v = (v + 1) & mask) {
+                size_t home = aindex->slot[v].hash & mask; /* Entry's preferred slot */
+
+                if (((v - home) & mask) >= ((v - u) & mask)) {
+                    aindex->slot[u] = aindex->slot[v];
+                    u               = v;
+                } /* end if */
+            }     /* end for */
+            aindex->slot[u].msg_idx = H5O_ATTR_INDEX_EMPTY;
+            aindex->nused--;
+        } /* end if */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5O__attr_index_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_index_reset
+ *
+ * Purpose:     Discard the compact attribute name index for an object
+ *              header.  Called when messages in the header are moved to
+ *              different indices.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5O__attr_index_reset(H5O_t *oh)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(oh);
+
+    if (oh->attr_index) {
+        oh->attr_index->slot = H5FL_SEQ_FREE(H5O_attr_index_slot_t, oh->attr_index->slot);
+        oh->attr_index       = H5FL_FREE(H5O_attr_index_t, oh->attr_index);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5O__attr_index_reset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_op_by_name
+ *
+ * Purpose:     Make an "internal" object header iterator callback for the
+ *              compact attribute with a given name, using the object
+ *              header's attribute name index.  This is equivalent to
+ *              H5O__msg_iterate_real() over the attribute messages with a
+ *              callback that ignores other names, without visiting them.
+ *              The callback isn't made if there's no such attribute.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__attr_op_by_name(H5F_t *f, H5O_t *oh, const char *name, const H5O_mesg_operator_t *op, void *op_data)
+{
+    size_t   idx;                 /* Index of attribute's message */
+    unsigned oh_modified = 0;     /* Whether the callback modified the object header */
+    htri_t   found;               /* Whether the attribute was found */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(oh);
+    HDassert(name);
+    HDassert(op);
+    HDassert(op->op_type == H5O_MESG_OP_LIB);
+
+    /* Look up the attribute's message */
+    if ((found = H5O__attr_index_find(f, oh, name, &idx)) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't look up attribute in name index")
+
+    if (found) {
+        unsigned sequence = 0; /* Relative index of message among attribute messages */
+        size_t   u;            /* Local index variable */
+
+        /* Determine the sequence value the iterator would have passed */
+        for (u = 0; u < idx; u++)
+            if (H5O_MSG_ATTR == oh->mesg[u].type)
+                sequence++;
+
+        if ((op->u.lib_op)(oh, &oh->mesg[idx], sequence, &oh_modified, op_data) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_BADITER, FAIL, "attribute operator failed")
+    } /* end if */
+
+done:
+    /* Check if object message was modified */
+    if (oh_modified) {
+        /* Try to condense object header info */
+        if (oh_modified & H5O_MODIFY_CONDENSE)
+            if (H5O__condense_header(f, oh) < 0)
+                HDONE_ERROR(H5E_ATTR, H5E_CANTPACK, FAIL, "can't pack object header")
+
+        /* Mark object header as changed */
+        if (H5O_touch_oh(f, oh, FALSE) < 0)
+            HDONE_ERROR(H5E_ATTR, H5E_CANTUPDATE, FAIL, "unable to update time on object")
+
+        /* Mark object header as dirty in cache */
+        if (H5AC_mark_entry_dirty(oh) < 0)
+            HDONE_ERROR(H5E_ATTR, H5E_CANTMARKDIRTY, FAIL, "unable to mark object header as dirty")
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__attr_op_by_name() */
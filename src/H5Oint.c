@@ -3053,6 +3053,9 @@ H5O__free(H5O_t *oh)
         oh->mesg = (H5O_mesg_t *)H5FL_SEQ_FREE(H5O_mesg_t, oh->mesg);
     } /* end if */
 
+    /* Destroy the compact attribute name index */
+    H5O__attr_index_reset(oh);
+
     /* Destroy the proxy */
     if (oh->proxy)
         if (H5AC_proxy_entry_dest(oh->proxy) < 0)
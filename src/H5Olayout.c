@@ -381,14 +381,20 @@ H5O__layout_decode(H5F_t *f, H5O_t H5_ATTR_UNUSED *open_oh, unsigned H5_ATTR_UNU
                 UINT32DECODE(p, mesg->storage.u.virt.serial_list_hobjid.idx);
 
                 /* Initialize other fields */
-                mesg->storage.u.virt.list_nused  = 0;
-                mesg->storage.u.virt.list        = NULL;
-                mesg->storage.u.virt.list_nalloc = 0;
-                mesg->storage.u.virt.view        = H5D_VDS_ERROR;
-                mesg->storage.u.virt.printf_gap  = HSIZE_UNDEF;
-                mesg->storage.u.virt.source_fapl = -1;
-                mesg->storage.u.virt.source_dapl = -1;
-                mesg->storage.u.virt.init        = FALSE;
+                mesg->storage.u.virt.list_nused   = 0;
+                mesg->storage.u.virt.list         = NULL;
+                mesg->storage.u.virt.list_nalloc  = 0;
+                mesg->storage.u.virt.view         = H5D_VDS_ERROR;
+                mesg->storage.u.virt.printf_gap   = HSIZE_UNDEF;
+                mesg->storage.u.virt.source_fapl  = -1;
+                mesg->storage.u.virt.source_dapl  = -1;
+                mesg->storage.u.virt.init         = FALSE;
+                mesg->storage.u.virt.index        = NULL;
+                mesg->storage.u.virt.prefetch     = FALSE;
+                mesg->storage.u.virt.max_open     = 0;
+                mesg->storage.u.virt.nopen        = 0;
+                mesg->storage.u.virt.use_clock    = 0;
+                mesg->storage.u.virt.stat_sources = FALSE;
 
                 /* Decode heap block if it exists */
                 if (mesg->storage.u.virt.serial_list_hobjid.addr != HADDR_UNDEF) {
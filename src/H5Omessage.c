@@ -1905,6 +1905,10 @@ H5O__copy_mesg(H5F_t *f, H5O_t *oh, size_t idx, const H5O_msg_class_t *type, con
     /* Update the message flags */
     idx_msg->flags = (uint8_t)mesg_flags;
 
+    /* Keep the compact attribute name index up to date */
+    if (H5O_MSG_ATTR == type)
+        H5O__attr_index_insert(oh, idx);
+
     /* Mark the message as modified */
     idx_msg->dirty = TRUE;
     chk_dirtied    = TRUE;
@@ -262,6 +262,9 @@ typedef struct H5O_chunk_t {
     struct H5O_chunk_proxy_t *chunk_proxy; /* Pointer to a chunk's proxy when chunk protected */
 } H5O_chunk_t;
 
+/* Index of compact attribute messages by name (defined in H5Oattribute.c) */
+typedef struct H5O_attr_index_t H5O_attr_index_t;
+
 struct H5O_t {
     H5AC_info_t cache_info; /* Information for metadata cache functions, _must_ be */
                             /* first field in structure */
@@ -308,6 +311,9 @@ struct H5O_t {
     size_t      link_msgs_seen; /* # of link messages seen when loading header */
     size_t      attr_msgs_seen; /* # of attribute messages seen when loading header */
 
+    /* Attribute name index (not stored) */
+    H5O_attr_index_t *attr_index; /* Index of compact attribute messages by name */
+
     /* Chunk management (not stored) */
     size_t       nchunks;       /*number of chunks		     */
     size_t       alloc_nchunks; /*chunks allocated		     */
@@ -616,6 +622,11 @@ H5_DLL herr_t H5O__attr_delete(H5F_t *f, H5O_t *open_oh, void *_mesg);
 H5_DLL herr_t H5O__attr_link(H5F_t *f, H5O_t *open_oh, void *_mesg);
 H5_DLL herr_t H5O__attr_count_real(H5F_t *f, H5O_t *oh, hsize_t *nattrs);
 
+/* Compact attribute name index routines */
+H5_DLL void H5O__attr_index_insert(H5O_t *oh, size_t idx);
+H5_DLL void H5O__attr_index_remove(H5O_t *oh, size_t idx);
+H5_DLL void H5O__attr_index_reset(H5O_t *oh);
+
 /* Arrays of versions for:
  * Object header, Attribute/Fill value/Filter pipeline messages
  */
@@ -511,6 +511,12 @@ typedef struct H5O_storage_virtual_srcdset_t {
     struct H5S_t *clipped_virtual_select; /* Clipped version of virtual_select */
     struct H5D_t *dset;                   /* Source dataset                     */
     hbool_t       dset_exists;            /* Whether the dataset exists (was opened successfully) */
+    uint64_t      last_used;              /* Value of the layout's use clock when dset was last used */
+    hbool_t       file_missing;           /* Whether the source file did not exist at the last open attempt */
+    hbool_t       stat_valid;             /* Whether the stat_* fields are valid */
+    time_t        stat_time;              /* Time the source file was checked at the last refresh */
+    time_t        stat_mtime;             /* Modification time of the source file at the last refresh */
+    hsize_t       stat_size;              /* Size of the source file at the last refresh */
 
     /* Temporary - only used during I/O operation, NULL at all other times */
     struct H5S_t *projected_mem_space; /* Selection within mem_space for this mapping */
@@ -583,6 +589,12 @@ typedef struct H5O_storage_virtual_t {
     hid_t   source_fapl; /* FAPL to use to open source files */
     hid_t   source_dapl; /* DAPL to use to open source datasets */
     hbool_t init;        /* Whether all information has been completely initialized */
+    struct H5D_virtual_index_t *index; /* Spatial index over the mappings' virtual selections */
+    hbool_t  prefetch;      /* Whether to issue read-ahead hints for source datasets */
+    size_t   max_open;      /* Max. number of source datasets kept open between I/O (0 = no limit) */
+    size_t   nopen;         /* Number of source datasets currently open */
+    uint64_t use_clock;     /* Incremented each time a source dataset is used, for LRU closing */
+    hbool_t  stat_sources;  /* Whether source files can be checked for with stat() */
 } H5O_storage_virtual_t;
 
 typedef struct H5O_storage_t {
@@ -77,6 +77,61 @@
         (len)--;                                                                                             \
     }
 
+/* Hash function for the page index: the page number, modulo the (power of 2) table size */
+#define H5PB__HASH_FCN(page_buf, addr, table_size)                                                           \
+    ((size_t)((addr) / (page_buf)->page_size) & ((table_size)-1))
+
+#define H5PB__HT_INSERT(page_buf, table, table_size, page_ptr)                                               \
+    {                                                                                                        \
+        size_t k = H5PB__HASH_FCN(page_buf, (page_ptr)->addr, table_size);                                   \
+                                                                                                             \
+        HDassert((page_ptr)->ht_next == NULL);                                                               \
+        HDassert((page_ptr)->ht_prev == NULL);                                                               \
+        if ((table)[k] != NULL) {                                                                            \
+            (page_ptr)->ht_next = (table)[k];                                                                \
+            (table)[k]->ht_prev = (page_ptr);                                                                \
+        } /* end if */                                                                                       \
+        (table)[k] = (page_ptr);                                                                             \
+    } /* H5PB__HT_INSERT() */
+
+#define H5PB__HT_DELETE(page_buf, table, table_size, page_ptr)                                               \
+    {                                                                                                        \
+        size_t k = H5PB__HASH_FCN(page_buf, (page_ptr)->addr, table_size);                                   \
+                                                                                                             \
+        if ((page_ptr)->ht_next)                                                                             \
+            (page_ptr)->ht_next->ht_prev = (page_ptr)->ht_prev;                                              \
+        if ((page_ptr)->ht_prev)                                                                             \
+            (page_ptr)->ht_prev->ht_next = (page_ptr)->ht_next;                                              \
+        if ((table)[k] == (page_ptr))                                                                        \
+            (table)[k] = (page_ptr)->ht_next;                                                                \
+        (page_ptr)->ht_next = NULL;                                                                          \
+        (page_ptr)->ht_prev = NULL;                                                                          \
+    } /* H5PB__HT_DELETE() */
+
+#define H5PB__HT_SEARCH(page_buf, table, table_size, search_addr, page_ptr)                                  \
+    {                                                                                                        \
+        (page_ptr) = (table)[H5PB__HASH_FCN(page_buf, search_addr, table_size)];                             \
+        while ((page_ptr) != NULL && (page_ptr)->addr != (search_addr))                                      \
+            (page_ptr) = (page_ptr)->ht_next;                                                                \
+    } /* H5PB__HT_SEARCH() */
+
+#define H5PB__INSERT_IN_INDEX(page_buf, page_ptr)                                                            \
+    {                                                                                                        \
+        H5PB__HT_INSERT(page_buf, (page_buf)->index, (page_buf)->index_size, page_ptr)                       \
+        (page_buf)->index_len++;                                                                             \
+        HDassert((page_buf)->index_len * (page_buf)->page_size <= (page_buf)->max_size);                     \
+    } /* H5PB__INSERT_IN_INDEX() */
+
+#define H5PB__DELETE_FROM_INDEX(page_buf, page_ptr)                                                          \
+    {                                                                                                        \
+        HDassert((page_buf)->index_len > 0);                                                                 \
+        H5PB__HT_DELETE(page_buf, (page_buf)->index, (page_buf)->index_size, page_ptr)                       \
+        (page_buf)->index_len--;                                                                             \
+    } /* H5PB__DELETE_FROM_INDEX() */
+
+#define H5PB__SEARCH_INDEX(page_buf, search_addr, page_ptr)                                                  \
+    H5PB__HT_SEARCH(page_buf, (page_buf)->index, (page_buf)->index_size, search_addr, page_ptr)
+
 #define H5PB__INSERT_LRU(page_buf, page_ptr)                                                                 \
     {                                                                                                        \
         HDassert(page_buf);                                                                                  \
@@ -106,16 +161,67 @@
                       (page_buf)->LRU_list_len)                                                              \
     }
 
+/* Update the replacement policy for an access to a resident page.
+ * Pages on the 2Q "A1in" queue stay in place: only a reference after they
+ * have aged out of A1in promotes them to the "Am" queue.
+ */
+#define H5PB__UPDATE_RP_FOR_ACCESS(page_buf, page_ptr)                                                       \
+    {                                                                                                        \
+        if (H5PB_QUEUE_LRU == (page_ptr)->queue)                                                             \
+            H5PB__MOVE_TO_TOP_LRU(page_buf, page_ptr)                                                        \
+    } /* H5PB__UPDATE_RP_FOR_ACCESS() */
+
+/* Remove a resident page from the replacement policy queue it is on */
+#define H5PB__UPDATE_RP_FOR_REMOVAL(page_buf, page_ptr)                                                      \
+    {                                                                                                        \
+        if (H5PB_QUEUE_LRU == (page_ptr)->queue)                                                             \
+            H5PB__REMOVE_LRU(page_buf, page_ptr)                                                             \
+        else {                                                                                               \
+            HDassert(H5PB_QUEUE_A1IN == (page_ptr)->queue);                                                  \
+            H5PB__REMOVE((page_ptr), (page_buf)->A1in_head_ptr, (page_buf)->A1in_tail_ptr,                   \
+                         (page_buf)->A1in_list_len)                                                          \
+        } /* end else */                                                                                     \
+        (page_ptr)->queue = H5PB_QUEUE_NONE;                                                                 \
+    } /* H5PB__UPDATE_RP_FOR_REMOVAL() */
+
+/* Whether a page holds raw data (as opposed to metadata) */
+#define H5PB__IS_RAW(type) (H5F_MEM_PAGE_DRAW == (type) || H5F_MEM_PAGE_GHEAP == (type))
+
+/* Mark a page dirty or clean, keeping track of the number of dirty raw data pages */
+#define H5PB__MARK_DIRTY(page_buf, page_ptr)                                                                 \
+    {                                                                                                        \
+        if (!(page_ptr)->is_dirty && H5PB__IS_RAW((page_ptr)->type))                                         \
+            (page_buf)->dirty_raw_count++;                                                                   \
+        (page_ptr)->is_dirty = TRUE;                                                                         \
+    } /* H5PB__MARK_DIRTY() */
+
+#define H5PB__MARK_CLEAN(page_buf, page_ptr)                                                                 \
+    {                                                                                                        \
+        if ((page_ptr)->is_dirty && H5PB__IS_RAW((page_ptr)->type)) {                                        \
+            HDassert((page_buf)->dirty_raw_count > 0);                                                       \
+            (page_buf)->dirty_raw_count--;                                                                   \
+        } /* end if */                                                                                       \
+        (page_ptr)->is_dirty = FALSE;                                                                        \
+    } /* H5PB__MARK_CLEAN() */
+
+/* Update the aggregate (metadata / raw data) and per-type statistics */
+#define H5PB__UPDATE_STATS(page_buf, field, type)                                                            \
+    {                                                                                                        \
+        HDassert((int)(type) >= 0 && (int)(type) < H5FD_MEM_NTYPES);                                         \
+        if (H5PB__IS_RAW(type))                                                                              \
+            (page_buf)->field[1]++;                                                                          \
+        else                                                                                                 \
+            (page_buf)->field[0]++;                                                                          \
+        (page_buf)->type_stats[(type)].field++;                                                              \
+    } /* H5PB__UPDATE_STATS() */
+
+/* Limit on the number of buckets in the page index */
+#define H5PB__MAX_INDEX_SIZE ((size_t)1 << 20)
+
 /******************/
 /* Local Typedefs */
 /******************/
 
-/* Iteration context for destroying page buffer */
-typedef struct {
-    H5PB_t *page_buf;
-    hbool_t actual_slist;
-} H5PB_ud1_t;
-
 /********************/
 /* Package Typedefs */
 /********************/
@@ -124,8 +230,18 @@ typedef struct {
 /* Local Prototypes */
 /********************/
 static herr_t H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry);
+static H5PB_entry_t *H5PB__find_victim(const H5PB_t *page_buf, H5PB_entry_t *tail_ptr,
+                                       H5FD_mem_t inserted_type);
 static htri_t H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type);
 static herr_t H5PB__write_entry(H5F_shared_t *f_sh, H5PB_entry_t *page_entry);
+static herr_t H5PB__write_batch(H5F_shared_t *f_sh, H5PB_t *page_buf, H5PB_entry_t **entries, size_t nentries,
+                                uint8_t *batch_buf);
+static herr_t H5PB__flush_entries(H5F_shared_t *f_sh, H5PB_t *page_buf, hbool_t raw_only);
+static herr_t H5PB__read_ahead(H5F_shared_t *f_sh, H5PB_t *page_buf, haddr_t addr, haddr_t eoa,
+                               size_t *npages_read);
+static void   H5PB__free_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry);
+static int    H5PB__entry_addr_cmp(const void *_entry1, const void *_entry2);
+static size_t H5PB__hash_table_size(size_t nentries);
 
 /*********************/
 /* Package Variables */
@@ -179,6 +295,8 @@ H5PB_reset_stats(H5PB_t *page_buf)
     page_buf->evictions[1] = 0;
     page_buf->bypasses[0]  = 0;
     page_buf->bypasses[1]  = 0;
+    HDmemset(page_buf->type_stats, 0, sizeof(page_buf->type_stats));
+    page_buf->batched_writes = 0;
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5PB_reset_stats() */
@@ -225,6 +343,38 @@ H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2], unsigned hits[2], u
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5PB_get_stats */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5PB_get_type_stats
+ *
+ * Purpose:     Retrieve the page buffer statistics collected for a single
+ *              file memory type.  Unlike H5PB_get_stats(), which lumps
+ *              all metadata together, this distinguishes e.g. object
+ *              header pages from B-tree pages.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_get_type_stats(const H5PB_t *page_buf, H5FD_mem_t type, H5PB_type_stats_t *stats)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(page_buf);
+    HDassert(stats);
+
+    if (type < H5FD_MEM_DEFAULT || type >= H5FD_MEM_NTYPES)
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "invalid file memory type")
+
+    *stats = page_buf->type_stats[type];
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5PB_get_type_stats */
+
 /*-------------------------------------------------------------------------
  * Function:    H5PB_print_stats()
  *
@@ -242,6 +392,10 @@ H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2], unsigned hits[2], u
 herr_t
 H5PB_print_stats(const H5PB_t *page_buf)
 {
+    static const char *type_names[H5FD_MEM_NTYPES] = {"default", "super", "btree", "draw",
+                                                      "gheap",   "lheap", "ohdr"};
+    int                type;
+
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
     HDassert(page_buf);
@@ -265,7 +419,26 @@ H5PB_print_stats(const H5PB_t *page_buf)
     HDprintf("\t Evictions: %u\n", page_buf->evictions[1]);
     HDprintf("\t Bypasses: %u\n", page_buf->bypasses[1]);
     HDprintf("\t Hit Rate = %f%%\n",
-             ((double)page_buf->hits[1] / (page_buf->accesses[1] - page_buf->bypasses[0])) * 100);
+             ((double)page_buf->hits[1] / (page_buf->accesses[1] - page_buf->bypasses[1])) * 100);
+    HDprintf("\t Pages Read Ahead: %u\n", page_buf->type_stats[H5FD_MEM_DRAW].read_aheads);
+    HDprintf("\t Batched Writes: %u\n", page_buf->batched_writes);
+    HDprintf("*****************\n\n");
+
+    HDprintf("******* BY MEMORY TYPE (%s policy)\n",
+             H5F_PAGE_BUF_POLICY_2Q == page_buf->policy ? "2Q" : "LRU");
+    HDprintf("\t %-8s %10s %10s %10s %10s %10s %9s\n", "Type", "Accesses", "Hits", "Misses", "Evictions",
+             "Bypasses", "Hit Rate");
+    for (type = H5FD_MEM_DEFAULT; type < H5FD_MEM_NTYPES; type++) {
+        const H5PB_type_stats_t *stats = &page_buf->type_stats[type];
+
+        if (0 == stats->accesses && 0 == stats->evictions)
+            continue;
+        HDprintf("\t %-8s %10u %10u %10u %10u %10u %8.2f%%\n", type_names[type], stats->accesses, stats->hits,
+                 stats->misses, stats->evictions, stats->bypasses,
+                 stats->accesses > stats->bypasses
+                     ? ((double)stats->hits / (stats->accesses - stats->bypasses)) * 100
+                     : 0.0);
+    } /* end for */
     HDprintf("*****************\n\n");
 
     FUNC_LEAVE_NOAPI(SUCCEED)
@@ -283,9 +456,11 @@ H5PB_print_stats(const H5PB_t *page_buf)
  *-------------------------------------------------------------------------
  */
 herr_t
-H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc)
+H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc,
+            H5F_page_buf_policy_t policy, size_t write_behind, unsigned read_ahead)
 {
-    H5PB_t *page_buf  = NULL;
+    H5PB_t *page_buf = NULL;
+    size_t  max_pages;           /* Maximum # of pages held in the page buffer */
     herr_t  ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -305,6 +480,11 @@ H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, un
     } /* end if */
     else if (0 != size % f_sh->fs_page_size)
         HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINIT, FAIL, "Page Buffer size must be >= to the page size")
+    if (policy < H5F_PAGE_BUF_POLICY_LRU || policy >= H5F_PAGE_BUF_POLICY_NTYPES)
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "invalid page buffer replacement policy")
+    if (write_behind > 0 && (write_behind < f_sh->fs_page_size || write_behind > size))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL,
+                    "page buffer write-behind size must be between the page size and the page buffer size")
 
     /* Allocate the new page buffering structure */
     if (NULL == (page_buf = H5FL_CALLOC(H5PB_t)))
@@ -314,6 +494,10 @@ H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, un
     H5_CHECKED_ASSIGN(page_buf->page_size, size_t, f_sh->fs_page_size, hsize_t);
     page_buf->min_meta_perc = page_buf_min_meta_perc;
     page_buf->min_raw_perc  = page_buf_min_raw_perc;
+    page_buf->policy        = policy;
+    page_buf->write_behind  = write_behind;
+    page_buf->read_ahead    = read_ahead;
+    page_buf->next_raw_addr = HADDR_UNDEF;
 
     /* Calculate the minimum page count for metadata and raw data
      * based on the fractions provided
@@ -321,8 +505,25 @@ H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, un
     page_buf->min_meta_count = (unsigned)((size * page_buf_min_meta_perc) / (f_sh->fs_page_size * 100));
     page_buf->min_raw_count  = (unsigned)((size * page_buf_min_raw_perc) / (f_sh->fs_page_size * 100));
 
-    if (NULL == (page_buf->slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
-        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCREATE, FAIL, "can't create skip list")
+    /* Create the page index, sized for the maximum number of pages */
+    max_pages            = size / page_buf->page_size;
+    page_buf->index_size = H5PB__hash_table_size(max_pages);
+    if (NULL == (page_buf->index = H5MM_calloc(page_buf->index_size * sizeof(H5PB_entry_t *))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate page index")
+
+    /* Set up the 2Q queues, using the queue sizes suggested by Johnson &
+     * Shasha: A1in holds 25% of the pages and A1out remembers the addresses
+     * of half as many pages as the page buffer holds.
+     */
+    if (H5F_PAGE_BUF_POLICY_2Q == policy) {
+        page_buf->A1in_max_len     = MAX(max_pages / 4, 1);
+        page_buf->A1out_max_len    = MAX(max_pages / 2, 1);
+        page_buf->ghost_index_size = H5PB__hash_table_size(page_buf->A1out_max_len);
+        if (NULL ==
+            (page_buf->ghost_index = H5MM_calloc(page_buf->ghost_index_size * sizeof(H5PB_entry_t *))))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate page buffer A1out index")
+    } /* end if */
+
     if (NULL == (page_buf->mf_slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
         HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCREATE, FAIL, "can't create skip list")
 
@@ -334,8 +535,10 @@ H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, un
 done:
     if (ret_value < 0) {
         if (page_buf != NULL) {
-            if (page_buf->slist_ptr != NULL)
-                H5SL_close(page_buf->slist_ptr);
+            if (page_buf->index != NULL)
+                page_buf->index = (H5PB_entry_t **)H5MM_xfree(page_buf->index);
+            if (page_buf->ghost_index != NULL)
+                page_buf->ghost_index = (H5PB_entry_t **)H5MM_xfree(page_buf->ghost_index);
             if (page_buf->mf_slist_ptr != NULL)
                 H5SL_close(page_buf->mf_slist_ptr);
             if (page_buf->page_fac != NULL)
@@ -347,43 +550,11 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5PB_create */
 
-/*-------------------------------------------------------------------------
- * Function:    H5PB__flush_cb
- *
- * Purpose:     Callback to flush PB skiplist entries.
- *
- * Return:      Non-negative on success/Negative on failure
- *
- * Programmer:  Mohamad Chaarawi
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5PB__flush_cb(void *item, void H5_ATTR_UNUSED *key, void *_op_data)
-{
-    H5PB_entry_t *page_entry = (H5PB_entry_t *)item; /* Pointer to page entry node */
-    H5F_shared_t *f_sh       = (H5F_shared_t *)_op_data;
-    herr_t        ret_value  = SUCCEED; /* Return value */
-
-    FUNC_ENTER_STATIC
-
-    /* Sanity checks */
-    HDassert(page_entry);
-    HDassert(f_sh);
-
-    /* Flush the page if it's dirty */
-    if (page_entry->is_dirty)
-        if (H5PB__write_entry(f_sh, page_entry) < 0)
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
-
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* H5PB__flush_cb() */
-
 /*-------------------------------------------------------------------------
  * Function:    H5PB_flush
  *
- * Purpose:     Flush/Free all the PB entries to the file.
+ * Purpose:     Flush all the dirty PB entries to the file, in increasing
+ *              address order.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -401,14 +572,10 @@ H5PB_flush(H5F_shared_t *f_sh)
     /* Sanity check */
     HDassert(f_sh);
 
-    /* Flush all the entries in the PB skiplist, if we have write access on the file */
-    if (f_sh->page_buf && (H5F_ACC_RDWR & H5F_SHARED_INTENT(f_sh))) {
-        H5PB_t *page_buf = f_sh->page_buf;
-
-        /* Iterate over all entries in page buffer skip list */
-        if (H5SL_iterate(page_buf->slist_ptr, H5PB__flush_cb, f_sh))
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_BADITER, FAIL, "can't flush page buffer skip list")
-    } /* end if */
+    /* Flush all the dirty entries in the PB, if we have write access on the file */
+    if (f_sh->page_buf && (H5F_ACC_RDWR & H5F_SHARED_INTENT(f_sh)))
+        if (H5PB__flush_entries(f_sh, f_sh->page_buf, FALSE) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTFLUSH, FAIL, "can't flush page buffer entries")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -417,7 +584,8 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5PB__dest_cb
  *
- * Purpose:     Callback to free PB skiplist entries.
+ * Purpose:     Callback to free the PB skiplist entries for new pages
+ *              from the MF layer.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -426,23 +594,17 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5PB__dest_cb(void *item, void H5_ATTR_UNUSED *key, void *_op_data)
+H5PB__dest_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *_op_data)
 {
     H5PB_entry_t *page_entry = (H5PB_entry_t *)item; /* Pointer to page entry node */
-    H5PB_ud1_t *  op_data    = (H5PB_ud1_t *)_op_data;
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Sanity checking */
     HDassert(page_entry);
-    HDassert(op_data);
-    HDassert(op_data->page_buf);
 
-    /* Remove entry from LRU list */
-    if (op_data->actual_slist) {
-        H5PB__REMOVE_LRU(op_data->page_buf, page_entry)
-        page_entry->page_buf_ptr = H5FL_FAC_FREE(op_data->page_buf->page_fac, page_entry->page_buf_ptr);
-    } /* end if */
+    /* New pages from the MF layer don't have a buffer yet */
+    HDassert(NULL == page_entry->page_buf_ptr);
 
     /* Free page entry */
     page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
@@ -473,23 +635,42 @@ H5PB_dest(H5F_shared_t *f_sh)
 
     /* flush and destroy the page buffer, if it exists */
     if (f_sh->page_buf) {
-        H5PB_t *   page_buf = f_sh->page_buf;
-        H5PB_ud1_t op_data; /* Iteration context */
+        H5PB_t *page_buf = f_sh->page_buf;
 
         if (H5PB_flush(f_sh) < 0)
             HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTFLUSH, FAIL, "can't flush page buffer")
 
-        /* Set up context info */
-        op_data.page_buf = page_buf;
+        /* Release all the resident entries in the PB */
+        while (page_buf->LRU_head_ptr) {
+            H5PB_entry_t *page_entry = page_buf->LRU_head_ptr;
 
-        /* Destroy the skip list containing all the entries in the PB */
-        op_data.actual_slist = TRUE;
-        if (H5SL_destroy(page_buf->slist_ptr, H5PB__dest_cb, &op_data))
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCLOSEOBJ, FAIL, "can't destroy page buffer skip list")
+            H5PB__DELETE_FROM_INDEX(page_buf, page_entry)
+            H5PB__UPDATE_RP_FOR_REMOVAL(page_buf, page_entry)
+            H5PB__free_entry(page_buf, page_entry);
+        } /* end while */
+        while (page_buf->A1in_head_ptr) {
+            H5PB_entry_t *page_entry = page_buf->A1in_head_ptr;
+
+            H5PB__DELETE_FROM_INDEX(page_buf, page_entry)
+            H5PB__UPDATE_RP_FOR_REMOVAL(page_buf, page_entry)
+            H5PB__free_entry(page_buf, page_entry);
+        } /* end while */
+        HDassert(0 == page_buf->index_len);
+        page_buf->index = (H5PB_entry_t **)H5MM_xfree(page_buf->index);
+
+        /* Release the 2Q A1out entries */
+        while (page_buf->A1out_head_ptr) {
+            H5PB_entry_t *page_entry = page_buf->A1out_head_ptr;
+
+            H5PB__REMOVE(page_entry, page_buf->A1out_head_ptr, page_buf->A1out_tail_ptr,
+                         page_buf->A1out_list_len)
+            page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
+        } /* end while */
+        if (page_buf->ghost_index)
+            page_buf->ghost_index = (H5PB_entry_t **)H5MM_xfree(page_buf->ghost_index);
 
         /* Destroy the skip list containing the new entries */
-        op_data.actual_slist = FALSE;
-        if (H5SL_destroy(page_buf->mf_slist_ptr, H5PB__dest_cb, &op_data))
+        if (H5SL_destroy(page_buf->mf_slist_ptr, H5PB__dest_cb, NULL))
             HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCLOSEOBJ, FAIL, "can't destroy page buffer skip list")
 
         /* Destroy the page factory */
@@ -593,7 +774,7 @@ H5PB_update_entry(H5PB_t *page_buf, haddr_t addr, size_t size, const void *buf)
     page_addr = (addr / page_buf->page_size) * page_buf->page_size;
 
     /* search for the page and update if found */
-    page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&page_addr));
+    H5PB__SEARCH_INDEX(page_buf, page_addr, page_entry)
     if (page_entry) {
         haddr_t offset;
 
@@ -601,8 +782,8 @@ H5PB_update_entry(H5PB_t *page_buf, haddr_t addr, size_t size, const void *buf)
         offset = addr - page_addr;
         H5MM_memcpy((uint8_t *)page_entry->page_buf_ptr + offset, buf, size);
 
-        /* move to top of LRU list */
-        H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+        /* Update the replacement policy */
+        H5PB__UPDATE_RP_FOR_ACCESS(page_buf, page_entry)
     } /* end if */
 
     FUNC_LEAVE_NOAPI(SUCCEED)
@@ -626,40 +807,68 @@ H5PB_update_entry(H5PB_t *page_buf, haddr_t addr, size_t size, const void *buf)
 herr_t
 H5PB_remove_entry(const H5F_shared_t *f_sh, haddr_t addr)
 {
-    H5PB_t *      page_buf;             /* Page buffer to operate on */
-    H5PB_entry_t *page_entry = NULL;    /* Pointer to the page entry being searched */
-    herr_t        ret_value  = SUCCEED; /* Return value */
+    H5PB_t *      page_buf;          /* Page buffer to operate on */
+    H5PB_entry_t *page_entry = NULL; /* Pointer to the page entry being searched */
 
-    FUNC_ENTER_NOAPI(FAIL)
+    FUNC_ENTER_NOAPI_NOERR
 
     /* Sanity checks */
     HDassert(f_sh);
     page_buf = f_sh->page_buf;
     HDassert(page_buf);
 
-    /* Search for address in the skip list */
-    page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&addr));
+    /* Search for address in the page index */
+    H5PB__SEARCH_INDEX(page_buf, addr, page_entry)
 
     /* If found, remove the entry from the PB cache */
     if (page_entry) {
         HDassert(page_entry->type != H5F_MEM_PAGE_DRAW);
-        if (NULL == H5SL_remove(page_buf->slist_ptr, &(page_entry->addr)))
-            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Page Entry is not in skip list")
 
-        /* Remove from LRU list */
-        H5PB__REMOVE_LRU(page_buf, page_entry)
-        HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
+        /* Remove from the page index and the replacement policy */
+        H5PB__DELETE_FROM_INDEX(page_buf, page_entry)
+        H5PB__UPDATE_RP_FOR_REMOVAL(page_buf, page_entry)
+        HDassert(page_buf->index_len == page_buf->LRU_list_len + page_buf->A1in_list_len);
 
         page_buf->meta_count--;
 
-        page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
-        page_entry               = H5FL_FREE(H5PB_entry_t, page_entry);
+        H5PB__free_entry(page_buf, page_entry);
     } /* end if */
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
+    FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5PB_remove_entry */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5PB_page_exists
+ *
+ * Purpose:     Test-only routine: report whether the page at ADDR is
+ *              resident in the page buffer.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_page_exists(H5F_shared_t *f_sh, haddr_t addr, hbool_t *page_exists)
+{
+    H5PB_t *      page_buf;          /* Page buffer to operate on */
+    H5PB_entry_t *page_entry = NULL; /* Pointer to the page entry being searched */
+
+    FUNC_ENTER_NOAPI_NOERR
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    page_buf = f_sh->page_buf;
+    HDassert(page_buf);
+    HDassert(page_exists);
+
+    /* Search for address in the page index */
+    H5PB__SEARCH_INDEX(page_buf, addr, page_entry)
+
+    *page_exists = (page_entry != NULL);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5PB_page_exists */
+
 /*-------------------------------------------------------------------------
  * Function:    H5PB_read
  *
@@ -721,12 +930,8 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
             HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "read through metadata accumulator failed")
 
         /* Update statistics */
-        if (page_buf) {
-            if (type == H5FD_MEM_DRAW)
-                page_buf->bypasses[1]++;
-            else
-                page_buf->bypasses[0]++;
-        } /* end if */
+        if (page_buf)
+            H5PB__UPDATE_STATS(page_buf, bypasses, type)
 
         /* If page buffering is disabled, or if this is a large metadata access,
          * or if this is parallel raw data access, we are done here
@@ -737,12 +942,8 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
     } /* end if */
 
     /* Update statistics */
-    if (page_buf) {
-        if (type == H5FD_MEM_DRAW)
-            page_buf->accesses[1]++;
-        else
-            page_buf->accesses[0]++;
-    } /* end if */
+    if (page_buf)
+        H5PB__UPDATE_STATS(page_buf, accesses, type)
 
     /* Calculate the aligned address of the first page */
     first_page_addr = (addr / page_buf->page_size) * page_buf->page_size;
@@ -773,70 +974,49 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
     /* Copy raw data from dirty pages into the read buffer if the read
        request spans pages in the page buffer*/
     if (H5FD_MEM_DRAW == type && size >= page_buf->page_size) {
-        H5SL_node_t *node;
-
         /* For each touched page in the page buffer, check if it
          * exists in the page Buffer and is dirty. If it does, we
          * update the buffer with what's in the page so we get the up
          * to date data into the buffer after the big read from the file.
          */
-        node = H5SL_find(page_buf->slist_ptr, (void *)(&first_page_addr));
-        for (i = 0; i < num_touched_pages; i++) {
+        for (i = 0; i < num_touched_pages && page_buf->index_len > 0; i++) {
             search_addr = i * page_buf->page_size + first_page_addr;
 
-            /* if we still haven't located a starting page, search again */
-            if (!node && i != 0)
-                node = H5SL_find(page_buf->slist_ptr, (void *)(&search_addr));
+            /* Lookup the page in the page index */
+            H5PB__SEARCH_INDEX(page_buf, search_addr, page_entry)
 
-            /* if the current page is in the Page Buffer, do the updates */
-            if (node) {
-                page_entry = (H5PB_entry_t *)H5SL_item(node);
-
-                HDassert(page_entry);
+            /* if the current page is in the Page Buffer and is dirty, do the updates */
+            if (page_entry && page_entry->is_dirty) {
+                /* special handling for the first page if it is not a full page access */
+                if (i == 0 && first_page_addr != addr) {
+                    offset = addr - first_page_addr;
+                    HDassert(page_buf->page_size > offset);
 
-                /* If the current page address falls out of the access
-                   block, then there are no more pages to go over */
-                if (page_entry->addr >= addr + size)
-                    break;
+                    H5MM_memcpy(buf, (uint8_t *)page_entry->page_buf_ptr + offset,
+                                page_buf->page_size - (size_t)offset);
 
-                HDassert(page_entry->addr == search_addr);
+                    /* Update the replacement policy */
+                    H5PB__UPDATE_RP_FOR_ACCESS(page_buf, page_entry)
+                } /* end if */
+                /* special handling for the last page if it is not a full page access */
+                else if (num_touched_pages > 1 && i == num_touched_pages - 1 && search_addr < addr + size) {
+                    offset = last_page_addr - addr;
 
-                if (page_entry->is_dirty) {
-                    /* special handling for the first page if it is not a full page access */
-                    if (i == 0 && first_page_addr != addr) {
-                        offset = addr - first_page_addr;
-                        HDassert(page_buf->page_size > offset);
+                    H5MM_memcpy((uint8_t *)buf + offset, page_entry->page_buf_ptr,
+                                (size_t)((addr + size) - last_page_addr));
 
-                        H5MM_memcpy(buf, (uint8_t *)page_entry->page_buf_ptr + offset,
-                                    page_buf->page_size - (size_t)offset);
+                    /* Update the replacement policy */
+                    H5PB__UPDATE_RP_FOR_ACCESS(page_buf, page_entry)
+                } /* end else-if */
+                /* copy the entire fully accessed pages */
+                else {
+                    offset = search_addr - addr;
 
-                        /* move to top of LRU list */
-                        H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
-                    } /* end if */
-                    /* special handling for the last page if it is not a full page access */
-                    else if (num_touched_pages > 1 && i == num_touched_pages - 1 &&
-                             search_addr < addr + size) {
-                        offset = (num_touched_pages - 2) * page_buf->page_size +
-                                 (page_buf->page_size - (addr - first_page_addr));
-
-                        H5MM_memcpy((uint8_t *)buf + offset, page_entry->page_buf_ptr,
-                                    (size_t)((addr + size) - last_page_addr));
-
-                        /* move to top of LRU list */
-                        H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
-                    } /* end else-if */
-                    /* copy the entire fully accessed pages */
-                    else {
-                        offset = i * page_buf->page_size;
-
-                        H5MM_memcpy((uint8_t *)buf + (i * page_buf->page_size), page_entry->page_buf_ptr,
-                                    page_buf->page_size);
-                    } /* end else */
-                }     /* end if */
-                node = H5SL_next(node);
-            } /* end if */
-        }     /* end for */
-    }         /* end if */
+                    H5MM_memcpy((uint8_t *)buf + offset, page_entry->page_buf_ptr, page_buf->page_size);
+                } /* end else */
+            }     /* end if */
+        }         /* end for */
+    }             /* end if */
     else {
         /* A raw data access could span 1 or 2 PB entries at this point so
            we need to handle that */
@@ -844,7 +1024,7 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
         for (i = 0; i < num_touched_pages; i++) {
             haddr_t buf_offset;
 
-            /* Calculate the aligned address of the page to search for it in the skip list */
+            /* Calculate the aligned address of the page to search for it in the page index */
             search_addr = (0 == i ? first_page_addr : last_page_addr);
 
             /* Calculate the access size if the access spans more than 1 page */
@@ -854,8 +1034,8 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                 access_size = (0 == i ? (size_t)((first_page_addr + page_buf->page_size) - addr)
                                       : (size - access_size));
 
-            /* Lookup the page in the skip list */
-            page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&search_addr));
+            /* Lookup the page in the page index */
+            H5PB__SEARCH_INDEX(page_buf, search_addr, page_entry)
 
             /* if found */
             if (page_entry) {
@@ -866,14 +1046,11 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                 H5MM_memcpy((uint8_t *)buf + buf_offset, (uint8_t *)page_entry->page_buf_ptr + offset,
                             access_size);
 
-                /* Update LRU */
-                H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+                /* Update the replacement policy */
+                H5PB__UPDATE_RP_FOR_ACCESS(page_buf, page_entry)
 
                 /* Update statistics */
-                if (type == H5FD_MEM_DRAW)
-                    page_buf->hits[1]++;
-                else
-                    page_buf->hits[0]++;
+                H5PB__UPDATE_STATS(page_buf, hits, type)
             } /* end if */
             /* if not found */
             else {
@@ -882,7 +1059,7 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                 haddr_t eoa;
 
                 /* make space for new entry */
-                if ((H5SL_count(page_buf->slist_ptr) * page_buf->page_size) >= page_buf->max_size) {
+                if ((page_buf->index_len * page_buf->page_size) >= page_buf->max_size) {
                     htri_t can_make_space;
 
                     /* check if we can make space in page buffer */
@@ -948,13 +1125,26 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                     HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTSET, FAIL, "error inserting new page in page buffer")
 
                 /* Update statistics */
-                if (type == H5FD_MEM_DRAW)
-                    page_buf->misses[1]++;
-                else
-                    page_buf->misses[0]++;
-            } /* end else */
-        }     /* end for */
-    }         /* end else */
+                H5PB__UPDATE_STATS(page_buf, misses, type)
+
+                /* If this miss continues a sequential scan of raw data pages,
+                 * read the following pages in with a single request
+                 */
+                if (H5FD_MEM_DRAW == type && page_buf->read_ahead > 0) {
+                    haddr_t next_addr = search_addr + page_buf->page_size;
+
+                    if (H5F_addr_eq(search_addr, page_buf->next_raw_addr)) {
+                        size_t npages_read;
+
+                        if (H5PB__read_ahead(f_sh, page_buf, next_addr, eoa, &npages_read) < 0)
+                            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "page buffer read-ahead failed")
+                        next_addr += npages_read * page_buf->page_size;
+                    } /* end if */
+                    page_buf->next_raw_addr = next_addr;
+                } /* end if */
+            }     /* end else */
+        }         /* end for */
+    }             /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1021,12 +1211,8 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
             HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "write through metadata accumulator failed")
 
         /* Update statistics */
-        if (page_buf) {
-            if (type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP)
-                page_buf->bypasses[1]++;
-            else
-                page_buf->bypasses[0]++;
-        } /* end if */
+        if (page_buf)
+            H5PB__UPDATE_STATS(page_buf, bypasses, type)
 
         /* If page buffering is disabled, or if this is a large metadata access,
          * or if this is a parallel raw data access, we are done here
@@ -1045,12 +1231,8 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
     } /* end if */
 
     /* Update statistics */
-    if (page_buf) {
-        if (type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP)
-            page_buf->accesses[1]++;
-        else
-            page_buf->accesses[0]++;
-    } /* end if */
+    if (page_buf)
+        H5PB__UPDATE_STATS(page_buf, accesses, type)
 
     /* Calculate the aligned address of the first page */
     first_page_addr = (addr / page_buf->page_size) * page_buf->page_size;
@@ -1086,70 +1268,66 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
         for (i = 0; i < num_touched_pages; i++) {
             search_addr = i * page_buf->page_size + first_page_addr;
 
+            /* Lookup the page in the page index */
+            H5PB__SEARCH_INDEX(page_buf, search_addr, page_entry)
+            if (NULL == page_entry)
+                continue;
+
             /* Special handling for the first page if it is not a full page update */
             if (i == 0 && first_page_addr != addr) {
-                /* Lookup the page in the skip list */
-                page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&search_addr));
-                if (page_entry) {
-                    offset = addr - first_page_addr;
-                    HDassert(page_buf->page_size > offset);
+                offset = addr - first_page_addr;
+                HDassert(page_buf->page_size > offset);
 
-                    /* Update page's data */
-                    H5MM_memcpy((uint8_t *)page_entry->page_buf_ptr + offset, buf,
-                                page_buf->page_size - (size_t)offset);
+                /* Update page's data */
+                H5MM_memcpy((uint8_t *)page_entry->page_buf_ptr + offset, buf,
+                            page_buf->page_size - (size_t)offset);
 
-                    /* Mark page dirty and push to top of LRU */
-                    page_entry->is_dirty = TRUE;
-                    H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
-                } /* end if */
-            }     /* end if */
+                /* Mark page dirty and update the replacement policy */
+                H5PB__MARK_DIRTY(page_buf, page_entry)
+                H5PB__UPDATE_RP_FOR_ACCESS(page_buf, page_entry)
+            } /* end if */
             /* Special handling for the last page if it is not a full page update */
             else if (num_touched_pages > 1 && i == (num_touched_pages - 1) &&
                      (search_addr + page_buf->page_size) != (addr + size)) {
                 HDassert(search_addr + page_buf->page_size > addr + size);
 
-                /* Lookup the page in the skip list */
-                page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&search_addr));
-                if (page_entry) {
-                    offset = (num_touched_pages - 2) * page_buf->page_size +
-                             (page_buf->page_size - (addr - first_page_addr));
+                offset = last_page_addr - addr;
 
-                    /* Update page's data */
-                    H5MM_memcpy(page_entry->page_buf_ptr, (const uint8_t *)buf + offset,
-                                (size_t)((addr + size) - last_page_addr));
+                /* Update page's data */
+                H5MM_memcpy(page_entry->page_buf_ptr, (const uint8_t *)buf + offset,
+                            (size_t)((addr + size) - last_page_addr));
 
-                    /* Mark page dirty and push to top of LRU */
-                    page_entry->is_dirty = TRUE;
-                    H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
-                } /* end if */
-            }     /* end else-if */
+                /* Mark page dirty and update the replacement policy */
+                H5PB__MARK_DIRTY(page_buf, page_entry)
+                H5PB__UPDATE_RP_FOR_ACCESS(page_buf, page_entry)
+            } /* end else-if */
             /* Discard all fully written pages from the page buffer */
             else {
-                page_entry = (H5PB_entry_t *)H5SL_remove(page_buf->slist_ptr, (void *)(&search_addr));
-                if (page_entry) {
-                    /* Remove from LRU list */
-                    H5PB__REMOVE_LRU(page_buf, page_entry)
-
-                    /* Decrement page count of appropriate type */
-                    if (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
-                        page_buf->raw_count--;
-                    else
-                        page_buf->meta_count--;
-
-                    /* Free page info */
-                    page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
-                    page_entry               = H5FL_FREE(H5PB_entry_t, page_entry);
-                } /* end if */
-            }     /* end else */
-        }         /* end for */
-    }             /* end if */
+                /* The page's (possibly dirty) contents have been overwritten */
+                H5PB__MARK_CLEAN(page_buf, page_entry)
+
+                /* Remove from the page index and the replacement policy */
+                H5PB__DELETE_FROM_INDEX(page_buf, page_entry)
+                H5PB__UPDATE_RP_FOR_REMOVAL(page_buf, page_entry)
+
+                /* Decrement page count of appropriate type */
+                if (H5PB__IS_RAW(page_entry->type))
+                    page_buf->raw_count--;
+                else
+                    page_buf->meta_count--;
+
+                /* Free page info */
+                H5PB__free_entry(page_buf, page_entry);
+            } /* end else */
+        }     /* end for */
+    }         /* end if */
     else {
         /* An access could span 1 or 2 PBs at this point so we need to handle that */
         HDassert(1 == num_touched_pages || 2 == num_touched_pages);
         for (i = 0; i < num_touched_pages; i++) {
             haddr_t buf_offset;
 
-            /* Calculate the aligned address of the page to search for it in the skip list */
+            /* Calculate the aligned address of the page to search for it in the page index */
             search_addr = (0 == i ? first_page_addr : last_page_addr);
 
             /* Calculate the access size if the access spans more than 1 page */
@@ -1159,8 +1337,8 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                 access_size =
                     (0 == i ? (size_t)(first_page_addr + page_buf->page_size - addr) : (size - access_size));
 
-            /* Lookup the page in the skip list */
-            page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&search_addr));
+            /* Lookup the page in the page index */
+            H5PB__SEARCH_INDEX(page_buf, search_addr, page_entry)
 
             /* If found */
             if (page_entry) {
@@ -1171,15 +1349,12 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                 H5MM_memcpy((uint8_t *)page_entry->page_buf_ptr + offset, (const uint8_t *)buf + buf_offset,
                             access_size);
 
-                /* Mark page dirty and push to top of LRU */
-                page_entry->is_dirty = TRUE;
-                H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+                /* Mark page dirty and update the replacement policy */
+                H5PB__MARK_DIRTY(page_buf, page_entry)
+                H5PB__UPDATE_RP_FOR_ACCESS(page_buf, page_entry)
 
                 /* Update statistics */
-                if (type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP)
-                    page_buf->hits[1]++;
-                else
-                    page_buf->hits[0]++;
+                H5PB__UPDATE_STATS(page_buf, hits, type)
             } /* end if */
             /* If not found */
             else {
@@ -1187,7 +1362,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                 size_t page_size = page_buf->page_size;
 
                 /* Make space for new entry */
-                if ((H5SL_count(page_buf->slist_ptr) * page_buf->page_size) >= page_buf->max_size) {
+                if ((page_buf->index_len * page_buf->page_size) >= page_buf->max_size) {
                     htri_t can_make_space;
 
                     /* Check if we can make space in page buffer */
@@ -1233,10 +1408,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                     page_entry->page_buf_ptr = new_page_buf;
 
                     /* Update statistics */
-                    if (type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP)
-                        page_buf->hits[1]++;
-                    else
-                        page_buf->hits[0]++;
+                    H5PB__UPDATE_STATS(page_buf, hits, type)
                 } /* end if */
                 /* Otherwise read page through the VFD layer, but make sure we don't read past the EOA. */
                 else {
@@ -1281,10 +1453,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                             HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
 
                         /* Update statistics */
-                        if (type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP)
-                            page_buf->misses[1]++;
-                        else
-                            page_buf->misses[0]++;
+                        H5PB__UPDATE_STATS(page_buf, misses, type)
                     } /* end if */
                 }     /* end else */
 
@@ -1292,7 +1461,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                 H5MM_memcpy((uint8_t *)new_page_buf + offset, (const uint8_t *)buf + buf_offset, access_size);
 
                 /* Page is dirty now */
-                page_entry->is_dirty = TRUE;
+                H5PB__MARK_DIRTY(page_buf, page_entry)
 
                 /* Insert page into PB, evicting other pages as necessary */
                 if (H5PB__insert_entry(page_buf, page_entry) < 0)
@@ -1301,6 +1470,14 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
         }     /* end for */
     }         /* end else */
 
+    /* With write-behind, the dirty raw data pages are written out together
+     * once they have used up their budget
+     */
+    if (page_buf->write_behind > 0 &&
+        page_buf->dirty_raw_count * page_buf->page_size >= page_buf->write_behind)
+        if (H5PB__flush_entries(f_sh, page_buf, TRUE) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "can't write behind raw data pages")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PB_write() */
@@ -1312,7 +1489,7 @@ done:
  *              What follows is my best understanding of Mohamad's intent.
  *
  *              Insert the supplied page into the page buffer, both the
- *              skip list and the LRU.
+ *              page index and the replacement policy queues.
  *
  *              As best I can tell, this function imposes no limit on the
  *              number of entries in the page buffer beyond an assertion
@@ -1330,28 +1507,90 @@ done:
 static herr_t
 H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
-
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_STATIC_NOERR
 
-    /* Insert entry in skip list */
-    if (H5SL_insert(page_buf->slist_ptr, page_entry, &(page_entry->addr)) < 0)
-        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINSERT, FAIL, "can't insert entry in skip list")
-    HDassert(H5SL_count(page_buf->slist_ptr) * page_buf->page_size <= page_buf->max_size);
+    /* Insert entry in the page index */
+    H5PB__INSERT_IN_INDEX(page_buf, page_entry)
 
     /* Increment appropriate page count */
-    if (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
+    if (H5PB__IS_RAW(page_entry->type))
         page_buf->raw_count++;
     else
         page_buf->meta_count++;
 
-    /* Insert entry in LRU */
-    H5PB__INSERT_LRU(page_buf, page_entry)
+    /* Insert entry in the replacement policy */
+    if (H5F_PAGE_BUF_POLICY_2Q == page_buf->policy) {
+        H5PB_entry_t *ghost_entry; /* A1out entry for the page's address */
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
+        /* If the page was evicted from A1in recently, it's being referenced
+         * a second time, so it goes on the "Am" LRU.  Otherwise it goes on
+         * the A1in FIFO, where it can only displace other pages that have
+         * been referenced once.
+         */
+        H5PB__HT_SEARCH(page_buf, page_buf->ghost_index, page_buf->ghost_index_size, page_entry->addr,
+                        ghost_entry)
+        if (ghost_entry) {
+            H5PB__HT_DELETE(page_buf, page_buf->ghost_index, page_buf->ghost_index_size, ghost_entry)
+            H5PB__REMOVE(ghost_entry, page_buf->A1out_head_ptr, page_buf->A1out_tail_ptr,
+                         page_buf->A1out_list_len)
+            ghost_entry = H5FL_FREE(H5PB_entry_t, ghost_entry);
+
+            page_entry->queue = H5PB_QUEUE_LRU;
+            H5PB__INSERT_LRU(page_buf, page_entry)
+        } /* end if */
+        else {
+            page_entry->queue = H5PB_QUEUE_A1IN;
+            H5PB__PREPEND(page_entry, page_buf->A1in_head_ptr, page_buf->A1in_tail_ptr,
+                          page_buf->A1in_list_len)
+        } /* end else */
+    }     /* end if */
+    else {
+        page_entry->queue = H5PB_QUEUE_LRU;
+        H5PB__INSERT_LRU(page_buf, page_entry)
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5PB__insert_entry() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__find_victim()
+ *
+ * Purpose:     Walk a replacement policy queue from its tail looking for
+ *              a page that can be evicted without dropping its type
+ *              (metadata or raw data) below its minimum page count.
+ *
+ * Return:      The eviction candidate, or NULL if every page on the queue
+ *              is protected by the minimum page counts.
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5PB_entry_t *
+H5PB__find_victim(const H5PB_t *page_buf, H5PB_entry_t *tail_ptr, H5FD_mem_t inserted_type)
+{
+    H5PB_entry_t *page_entry;       /* Pointer to page eviction candidate */
+    H5PB_entry_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (page_entry = tail_ptr; page_entry; page_entry = page_entry->prev) {
+        if (H5FD_MEM_DRAW == inserted_type) {
+            /* check the metadata threshold before evicting metadata items */
+            if (!H5PB__IS_RAW(page_entry->type) && page_buf->min_meta_count >= page_buf->meta_count)
+                continue;
+        } /* end if */
+        else {
+            /* check the raw data threshold before evicting raw data items */
+            if (H5PB__IS_RAW(page_entry->type) && page_buf->min_raw_count >= page_buf->raw_count)
+                continue;
+        } /* end else */
+
+        ret_value = page_entry;
+        break;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__find_victim() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5PB__make_space()
  *
@@ -1365,6 +1604,12 @@ done:
  *
  *                                             JRM -- 12/22/16
  *
+ *              With the 2Q policy, pages are evicted from the A1in queue
+ *              while it is over its target length, and from the LRU
+ *              ("Am") queue otherwise.  Pages evicted from A1in leave
+ *              their address behind on the A1out queue, so that a quick
+ *              re-reference promotes them straight to the LRU.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Mohamad Chaarawi
@@ -1375,6 +1620,9 @@ static htri_t
 H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
 {
     H5PB_entry_t *page_entry;       /* Pointer to page eviction candidate */
+    H5PB_entry_t *first_tail_ptr;   /* Tail of the queue to evict from first */
+    H5PB_entry_t *second_tail_ptr;  /* Tail of the queue to evict from next */
+    H5PB_queue_t  queue;            /* Queue the evicted page was on */
     htri_t        ret_value = TRUE; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -1383,9 +1631,6 @@ H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
     HDassert(f_sh);
     HDassert(page_buf);
 
-    /* Get oldest entry */
-    page_entry = page_buf->LRU_tail_ptr;
-
     if (H5FD_MEM_DRAW == inserted_type) {
         /* If threshould is 100% metadata and page buffer is full of
            metadata, then we can't make space for raw data */
@@ -1393,15 +1638,6 @@ H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
             HDassert(page_buf->meta_count * page_buf->page_size == page_buf->max_size);
             HGOTO_DONE(FALSE)
         } /* end if */
-
-        /* check the metadata threshold before evicting metadata items */
-        while (1) {
-            if (page_entry->prev && H5F_MEM_PAGE_META == page_entry->type &&
-                page_buf->min_meta_count >= page_buf->meta_count)
-                page_entry = page_entry->prev;
-            else
-                break;
-        } /* end while */
     }     /* end if */
     else {
         /* If threshould is 100% raw data and page buffer is full of
@@ -1410,46 +1646,75 @@ H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
             HDassert(page_buf->raw_count * page_buf->page_size == page_buf->max_size);
             HGOTO_DONE(FALSE)
         } /* end if */
-
-        /* check the raw data threshold before evicting raw data items */
-        while (1) {
-            if (page_entry->prev &&
-                (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type) &&
-                page_buf->min_raw_count >= page_buf->raw_count)
-                page_entry = page_entry->prev;
-            else
-                break;
-        } /* end while */
     }     /* end else */
 
-    /* Remove from page index */
-    if (NULL == H5SL_remove(page_buf->slist_ptr, &(page_entry->addr)))
-        HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "Tail Page Entry is not in skip list")
+    /* Pick the order in which to search the replacement policy queues */
+    if (page_buf->A1in_list_len > page_buf->A1in_max_len || NULL == page_buf->LRU_tail_ptr) {
+        first_tail_ptr  = page_buf->A1in_tail_ptr;
+        second_tail_ptr = page_buf->LRU_tail_ptr;
+    } /* end if */
+    else {
+        first_tail_ptr  = page_buf->LRU_tail_ptr;
+        second_tail_ptr = page_buf->A1in_tail_ptr;
+    } /* end else */
+    HDassert(first_tail_ptr);
+
+    /* Get the oldest entry that isn't protected by the minimum page counts,
+     * falling back to the most recently used entry of the first queue
+     */
+    if (NULL == (page_entry = H5PB__find_victim(page_buf, first_tail_ptr, inserted_type)))
+        if (NULL == (page_entry = H5PB__find_victim(page_buf, second_tail_ptr, inserted_type)))
+            page_entry = (first_tail_ptr == page_buf->LRU_tail_ptr ? page_buf->LRU_head_ptr
+                                                                   : page_buf->A1in_head_ptr);
+
+    /* Flush page if dirty.  With write-behind, a dirty raw data page is
+     * written out along with all the other dirty raw data pages.
+     */
+    if (page_entry->is_dirty) {
+        if (page_buf->write_behind > 0 && H5PB__IS_RAW(page_entry->type)) {
+            if (H5PB__flush_entries(f_sh, page_buf, TRUE) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "can't write behind raw data pages")
+        } /* end if */
+        else if (H5PB__write_entry(f_sh, page_entry) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
+    } /* end if */
+    HDassert(!page_entry->is_dirty);
 
-    /* Remove entry from LRU list */
-    H5PB__REMOVE_LRU(page_buf, page_entry)
-    HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
+    /* Remove from page index and the replacement policy */
+    queue = page_entry->queue;
+    H5PB__DELETE_FROM_INDEX(page_buf, page_entry)
+    H5PB__UPDATE_RP_FOR_REMOVAL(page_buf, page_entry)
+    HDassert(page_buf->index_len == page_buf->LRU_list_len + page_buf->A1in_list_len);
 
     /* Decrement appropriate page type counter */
-    if (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
+    if (H5PB__IS_RAW(page_entry->type))
         page_buf->raw_count--;
     else
         page_buf->meta_count--;
 
-    /* Flush page if dirty */
-    if (page_entry->is_dirty)
-        if (H5PB__write_entry(f_sh, page_entry) < 0)
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
-
     /* Update statistics */
-    if (page_entry->type == H5F_MEM_PAGE_DRAW || H5F_MEM_PAGE_GHEAP == page_entry->type)
-        page_buf->evictions[1]++;
-    else
-        page_buf->evictions[0]++;
+    H5PB__UPDATE_STATS(page_buf, evictions, page_entry->type)
 
     /* Release page */
-    page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
-    page_entry               = H5FL_FREE(H5PB_entry_t, page_entry);
+    if (H5PB_QUEUE_A1IN == queue) {
+        /* Keep the entry around (without its data) on the A1out queue */
+        page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
+        page_entry->queue        = H5PB_QUEUE_A1OUT;
+        H5PB__HT_INSERT(page_buf, page_buf->ghost_index, page_buf->ghost_index_size, page_entry)
+        H5PB__PREPEND(page_entry, page_buf->A1out_head_ptr, page_buf->A1out_tail_ptr,
+                      page_buf->A1out_list_len)
+
+        /* Forget the oldest A1out entry, if the queue is full */
+        if (page_buf->A1out_list_len > page_buf->A1out_max_len) {
+            page_entry = page_buf->A1out_tail_ptr;
+            H5PB__HT_DELETE(page_buf, page_buf->ghost_index, page_buf->ghost_index_size, page_entry)
+            H5PB__REMOVE(page_entry, page_buf->A1out_head_ptr, page_buf->A1out_tail_ptr,
+                         page_buf->A1out_list_len)
+            page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
+        } /* end if */
+    }     /* end if */
+    else
+        H5PB__free_entry(page_buf, page_entry);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1504,8 +1769,333 @@ H5PB__write_entry(H5F_shared_t *f_sh, H5PB_entry_t *page_entry)
             HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
     } /* end if */
 
-    page_entry->is_dirty = FALSE;
+    H5PB__MARK_CLEAN(f_sh->page_buf, page_entry)
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PB__write_entry() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__write_batch()
+ *
+ * Purpose:     Write out a run of NENTRIES dirty pages of the same type at
+ *              adjacent addresses with a single write, staging the pages
+ *              in BATCH_BUF.  As with H5PB__write_entry(), nothing beyond
+ *              the EOA is written.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__write_batch(H5F_shared_t *f_sh, H5PB_t *page_buf, H5PB_entry_t **entries, size_t nentries,
+                  uint8_t *batch_buf)
+{
+    H5FD_mem_t type;                /* Type of the pages */
+    haddr_t    addr;                /* Address of the first page */
+    haddr_t    eoa;                 /* Current EOA for the file */
+    size_t     u;                   /* Local index variable */
+    herr_t     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f_sh);
+    HDassert(page_buf);
+    HDassert(entries);
+    HDassert(nentries > 1);
+    HDassert(batch_buf);
+
+    type = (H5FD_mem_t)entries[0]->type;
+    addr = entries[0]->addr;
+
+    /* Retrieve the 'eoa' for the file */
+    if (HADDR_UNDEF == (eoa = H5F_shared_get_eoa(f_sh, type)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed")
+
+    /* Combine the pages that start before the EOA into a single write */
+    if (addr < eoa) {
+        size_t write_size = nentries * page_buf->page_size;
+
+        if (addr + write_size > eoa)
+            write_size = (size_t)(eoa - addr);
+
+        for (u = 0; u < nentries && u * page_buf->page_size < write_size; u++) {
+            HDassert(entries[u]->type == entries[0]->type);
+            HDassert(entries[u]->addr == addr + u * page_buf->page_size);
+            H5MM_memcpy(batch_buf + u * page_buf->page_size, entries[u]->page_buf_ptr, page_buf->page_size);
+        } /* end for */
+
+        if (H5FD_write(f_sh->lf, type, addr, write_size, batch_buf) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
+
+        page_buf->batched_writes++;
+    } /* end if */
+
+    for (u = 0; u < nentries; u++)
+        H5PB__MARK_CLEAN(page_buf, entries[u])
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__write_batch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__flush_entries()
+ *
+ * Purpose:     Write out the dirty pages in the page buffer (only the raw
+ *              data pages, if RAW_ONLY is set), in increasing address
+ *              order.  When write-behind is enabled, runs of adjacent
+ *              pages of the same type are combined into writes of up to
+ *              the write-behind size.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__flush_entries(H5F_shared_t *f_sh, H5PB_t *page_buf, hbool_t raw_only)
+{
+    H5PB_entry_t **dirty_entries = NULL; /* Array of the dirty page entries */
+    uint8_t *      batch_buf     = NULL; /* Buffer for combining adjacent pages into one write */
+    size_t         max_batch_len;        /* Max # of pages combined into one write */
+    size_t         num_dirty = 0;        /* Number of dirty page entries */
+    size_t         u, v;                 /* Local index variables */
+    herr_t         ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f_sh);
+    HDassert(page_buf);
+
+    if (0 == page_buf->index_len)
+        HGOTO_DONE(SUCCEED)
+
+    if (NULL ==
+        (dirty_entries = (H5PB_entry_t **)H5MM_malloc(page_buf->index_len * sizeof(H5PB_entry_t *))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate dirty page list")
+
+    /* Gather the dirty entries from the page index */
+    for (u = 0; u < page_buf->index_size; u++) {
+        H5PB_entry_t *page_entry;
+
+        for (page_entry = page_buf->index[u]; page_entry; page_entry = page_entry->ht_next)
+            if (page_entry->is_dirty && (!raw_only || H5PB__IS_RAW(page_entry->type)))
+                dirty_entries[num_dirty++] = page_entry;
+    } /* end for */
+
+    /* Write the pages out in address order, so the file driver sees
+     * sequential I/O whenever the dirty pages are adjacent
+     */
+    if (num_dirty > 1)
+        HDqsort(dirty_entries, num_dirty, sizeof(H5PB_entry_t *), H5PB__entry_addr_cmp);
+    max_batch_len = page_buf->write_behind / page_buf->page_size;
+    for (u = 0; u < num_dirty; u = v) {
+        /* Find the end of the run of adjacent pages of the same type */
+        for (v = u + 1; v < num_dirty && (v - u) < max_batch_len; v++)
+            if (dirty_entries[v]->type != dirty_entries[u]->type ||
+                dirty_entries[v]->addr != dirty_entries[v - 1]->addr + page_buf->page_size)
+                break;
+
+        if (1 == v - u) {
+            if (H5PB__write_entry(f_sh, dirty_entries[u]) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
+        } /* end if */
+        else {
+            if (NULL == batch_buf &&
+                NULL == (batch_buf = (uint8_t *)H5MM_malloc(max_batch_len * page_buf->page_size)))
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate write-behind buffer")
+            if (H5PB__write_batch(f_sh, page_buf, &dirty_entries[u], v - u, batch_buf) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
+        } /* end else */
+    }     /* end for */
+
+done:
+    if (batch_buf)
+        batch_buf = (uint8_t *)H5MM_xfree(batch_buf);
+    if (dirty_entries)
+        dirty_entries = (H5PB_entry_t **)H5MM_xfree(dirty_entries);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__flush_entries() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__read_ahead()
+ *
+ * Purpose:     Read in the raw data pages starting at ADDR with a single
+ *              request and insert them in the page buffer.  Reading stops
+ *              at the EOA, at the first page that's already resident, and
+ *              after as many pages as can be held without the new pages
+ *              evicting each other.  The number of pages inserted is
+ *              returned in *NPAGES_READ.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__read_ahead(H5F_shared_t *f_sh, H5PB_t *page_buf, haddr_t addr, haddr_t eoa, size_t *npages_read)
+{
+    H5PB_entry_t *page_entry = NULL;   /* Pointer to the page entry being inserted */
+    uint8_t *     read_buf   = NULL;   /* Buffer holding the pages read */
+    size_t        max_pages;           /* Max # of pages to read ahead */
+    size_t        npages;              /* # of pages to read ahead */
+    size_t        read_size;           /* Size of the read request */
+    size_t        u;                   /* Local index variable */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f_sh);
+    HDassert(page_buf);
+    HDassert(npages_read);
+
+    *npages_read = 0;
+
+    /* Pages read ahead have been referenced only once, so with the 2Q policy
+     * they compete for the A1in queue.  Otherwise, limit the read-ahead to
+     * half the page buffer.
+     */
+    if (H5F_PAGE_BUF_POLICY_2Q == page_buf->policy)
+        max_pages = page_buf->A1in_max_len;
+    else
+        max_pages = (page_buf->max_size / page_buf->page_size) / 2;
+    max_pages = MIN(max_pages, page_buf->read_ahead);
+
+    /* Stop at the EOA, or at a page that's resident or newly allocated */
+    for (npages = 0; npages < max_pages; npages++) {
+        haddr_t page_addr = addr + npages * page_buf->page_size;
+
+        if (page_addr >= eoa)
+            break;
+        H5PB__SEARCH_INDEX(page_buf, page_addr, page_entry)
+        if (page_entry || H5SL_search(page_buf->mf_slist_ptr, &page_addr))
+            break;
+    } /* end for */
+    if (0 == npages)
+        HGOTO_DONE(SUCCEED)
+
+    /* Read the pages, without going beyond the EOA */
+    read_size = npages * page_buf->page_size;
+    if (addr + read_size > eoa)
+        read_size = (size_t)(eoa - addr);
+    if (NULL == (read_buf = (uint8_t *)H5MM_malloc(read_size)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "can't allocate read-ahead buffer")
+    if (H5FD_read(f_sh->lf, H5FD_MEM_DRAW, addr, read_size, read_buf) < 0)
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
+
+    /* Insert the pages in the page buffer */
+    for (u = 0; u < npages; u++) {
+        void * new_page_buf;                     /* Page being inserted */
+        size_t offset = u * page_buf->page_size; /* Offset of page in the read buffer */
+
+        /* Make space for new entry */
+        if ((page_buf->index_len * page_buf->page_size) >= page_buf->max_size) {
+            htri_t can_make_space;
+
+            if ((can_make_space = H5PB__make_space(f_sh, page_buf, H5FD_MEM_DRAW)) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "make space in Page buffer Failed")
+            if (0 == can_make_space)
+                break;
+        } /* end if */
+
+        if (NULL == (new_page_buf = H5FL_FAC_MALLOC(page_buf->page_fac)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for page buffer entry")
+        H5MM_memcpy(new_page_buf, read_buf + offset, MIN(page_buf->page_size, read_size - offset));
+
+        if (NULL == (page_entry = H5FL_CALLOC(H5PB_entry_t))) {
+            new_page_buf = H5FL_FAC_FREE(page_buf->page_fac, new_page_buf);
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed")
+        } /* end if */
+        page_entry->page_buf_ptr = new_page_buf;
+        page_entry->addr         = addr + offset;
+        page_entry->type         = H5F_MEM_PAGE_DRAW;
+        page_entry->is_dirty     = FALSE;
+
+        /* Insert page into PB */
+        if (H5PB__insert_entry(page_buf, page_entry) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTSET, FAIL, "error inserting new page in page buffer")
+
+        /* Update statistics */
+        page_buf->type_stats[H5FD_MEM_DRAW].read_aheads++;
+        (*npages_read)++;
+    } /* end for */
+
+done:
+    if (read_buf)
+        read_buf = (uint8_t *)H5MM_xfree(read_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__read_ahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__free_entry()
+ *
+ * Purpose:     Release a page entry and its page, once it has been removed
+ *              from the page index and the replacement policy.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5PB__free_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(page_buf);
+    HDassert(page_entry);
+    HDassert(H5PB_QUEUE_NONE == page_entry->queue);
+
+    if (page_entry->page_buf_ptr)
+        page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
+    page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5PB__free_entry() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__entry_addr_cmp()
+ *
+ * Purpose:     Callback for qsort() to sort page entries by address.
+ *
+ * Return:      -1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5PB__entry_addr_cmp(const void *_entry1, const void *_entry2)
+{
+    const H5PB_entry_t *entry1 = *(const H5PB_entry_t *const *)_entry1;
+    const H5PB_entry_t *entry2 = *(const H5PB_entry_t *const *)_entry2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(entry1->addr, entry2->addr))
+} /* end H5PB__entry_addr_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__hash_table_size()
+ *
+ * Purpose:     Compute the number of buckets for a hash table that will
+ *              hold up to NENTRIES page entries: the smallest power of 2
+ *              that is not smaller than NENTRIES, within limits.
+ *
+ * Return:      The number of buckets
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5PB__hash_table_size(size_t nentries)
+{
+    size_t table_size = 1;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    while (table_size < nentries && table_size < H5PB__MAX_INDEX_SIZE)
+        table_size <<= 1;
+
+    FUNC_LEAVE_NOAPI(table_size)
+} /* end H5PB__hash_table_size() */
@@ -31,15 +31,28 @@
 /* Package Private Typedefs */
 /****************************/
 
+/* Replacement policy queue a page entry is on */
+typedef enum H5PB_queue_t {
+    H5PB_QUEUE_NONE = 0, /* Not on any queue (e.g. new pages from the MF layer) */
+    H5PB_QUEUE_LRU,      /* The LRU list (the "Am" queue for the 2Q policy) */
+    H5PB_QUEUE_A1IN,     /* The 2Q "A1in" queue */
+    H5PB_QUEUE_A1OUT     /* The 2Q "A1out" queue (no page data) */
+} H5PB_queue_t;
+
 typedef struct H5PB_entry_t {
     void *         page_buf_ptr; /* Pointer to the buffer containing the data */
     haddr_t        addr;         /* Address of the page in the file */
     H5F_mem_page_t type;         /* Type of the page entry (H5F_MEM_PAGE_RAW/META) */
     hbool_t        is_dirty;     /* Flag indicating whether the page has dirty data or not */
 
+    /* Fields supporting the page index */
+    struct H5PB_entry_t *ht_next; /* next pointer in the hash bucket */
+    struct H5PB_entry_t *ht_prev; /* previous pointer in the hash bucket */
+
     /* Fields supporting replacement policies */
-    struct H5PB_entry_t *next; /* next pointer in the LRU list */
-    struct H5PB_entry_t *prev; /* previous pointer in the LRU list */
+    H5PB_queue_t         queue; /* Replacement policy queue the entry is on */
+    struct H5PB_entry_t *next;  /* next pointer in the LRU list */
+    struct H5PB_entry_t *prev;  /* previous pointer in the LRU list */
 } H5PB_entry_t;
 
 /*****************************/
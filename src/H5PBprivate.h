@@ -45,32 +45,74 @@
 /* Forward declaration for a page buffer entry */
 struct H5PB_entry_t;
 
+/* Per file memory type page buffer statistics */
+typedef struct H5PB_type_stats_t {
+    unsigned accesses;    /* Number of accesses to the page buffer */
+    unsigned hits;        /* Number of accesses satisfied by a resident page */
+    unsigned misses;      /* Number of accesses that had to load a page */
+    unsigned evictions;   /* Number of pages evicted */
+    unsigned bypasses;    /* Number of accesses that bypassed the page buffer */
+    unsigned read_aheads; /* Number of pages loaded by read-ahead */
+} H5PB_type_stats_t;
+
 /* Typedef for the main structure for the page buffer */
 typedef struct H5PB_t {
-    size_t   max_size;       /* The total page buffer size */
-    size_t   page_size;      /* Size of a single page */
-    unsigned min_meta_perc;  /* Minimum ratio of metadata entries required before evicting meta entries */
-    unsigned min_raw_perc;   /* Minimum ratio of raw data entries required before evicting raw entries */
-    unsigned meta_count;     /* Number of entries for metadata */
-    unsigned raw_count;      /* Number of entries for raw data */
-    unsigned min_meta_count; /* Minimum # of entries for metadata */
-    unsigned min_raw_count;  /* Minimum # of entries for raw data */
-
-    H5SL_t *slist_ptr;    /* Skip list with all the active page entries */
+    size_t                max_size;       /* The total page buffer size */
+    size_t                page_size;      /* Size of a single page */
+    unsigned              min_meta_perc;  /* Minimum ratio of metadata entries required before evicting meta entries */
+    unsigned              min_raw_perc;   /* Minimum ratio of raw data entries required before evicting raw entries */
+    unsigned              meta_count;     /* Number of entries for metadata */
+    unsigned              raw_count;      /* Number of entries for raw data */
+    unsigned              min_meta_count; /* Minimum # of entries for metadata */
+    unsigned              min_raw_count;  /* Minimum # of entries for raw data */
+    H5F_page_buf_policy_t policy;         /* Replacement policy */
+
+    /* Hash table index of the resident page entries */
+    size_t                index_size; /* Number of buckets in the index (always a power of 2) */
+    size_t                index_len;  /* Number of entries in the index */
+    struct H5PB_entry_t **index;      /* Hash table buckets, indexed by page number */
+
     H5SL_t *mf_slist_ptr; /* Skip list containing newly allocated page entries inserted from the MF layer */
 
-    size_t               LRU_list_len; /* Number of entries in the LRU (identical to slist_ptr count) */
+    /* LRU list.  When the 2Q policy is in use, this is the "Am" queue of
+     * pages which have been referenced more than once.
+     */
+    size_t               LRU_list_len; /* Number of entries in the LRU */
     struct H5PB_entry_t *LRU_head_ptr; /* Head pointer of the LRU */
     struct H5PB_entry_t *LRU_tail_ptr; /* Tail pointer of the LRU */
 
+    /* 2Q "A1in" FIFO of pages which have been referenced only once */
+    size_t               A1in_max_len;  /* Target number of entries in the A1in queue */
+    size_t               A1in_list_len; /* Number of entries in the A1in queue */
+    struct H5PB_entry_t *A1in_head_ptr; /* Head pointer of the A1in queue */
+    struct H5PB_entry_t *A1in_tail_ptr; /* Tail pointer of the A1in queue */
+
+    /* 2Q "A1out" FIFO of the addresses of pages recently evicted from the
+     * A1in queue.  These entries hold no page data.
+     */
+    size_t                A1out_max_len;    /* Maximum number of entries in the A1out queue */
+    size_t                A1out_list_len;   /* Number of entries in the A1out queue */
+    struct H5PB_entry_t * A1out_head_ptr;   /* Head pointer of the A1out queue */
+    struct H5PB_entry_t * A1out_tail_ptr;   /* Tail pointer of the A1out queue */
+    size_t                ghost_index_size; /* Number of buckets in the A1out index (always a power of 2) */
+    struct H5PB_entry_t **ghost_index;      /* Hash table of the A1out entries */
+
+    /* Raw data write-behind and read-ahead */
+    size_t   write_behind;        /* Budget (in bytes) for dirty raw data pages, or 0 for no write-behind */
+    unsigned read_ahead;          /* Max # of raw data pages to read ahead, or 0 for no read-ahead */
+    size_t   dirty_raw_count;     /* Number of dirty raw data pages */
+    haddr_t  next_raw_addr;       /* Address following the last raw data page read from the file */
+    unsigned batched_writes;      /* Number of writes that combined several adjacent dirty pages */
+
     H5FL_fac_head_t *page_fac; /* Factory for allocating pages */
 
     /* Statistics */
-    unsigned accesses[2];
-    unsigned hits[2];
-    unsigned misses[2];
-    unsigned evictions[2];
-    unsigned bypasses[2];
+    unsigned          accesses[2];
+    unsigned          hits[2];
+    unsigned          misses[2];
+    unsigned          evictions[2];
+    unsigned          bypasses[2];
+    H5PB_type_stats_t type_stats[H5FD_MEM_NTYPES]; /* Statistics by file memory type */
 } H5PB_t;
 
 /*****************************/
@@ -83,12 +125,14 @@ typedef struct H5PB_t {
 
 /* General routines */
 H5_DLL herr_t H5PB_create(H5F_shared_t *f_sh, size_t page_buffer_size, unsigned page_buf_min_meta_perc,
-                          unsigned page_buf_min_raw_perc);
+                          unsigned page_buf_min_raw_perc, H5F_page_buf_policy_t policy,
+                          size_t write_behind, unsigned read_ahead);
 H5_DLL herr_t H5PB_flush(H5F_shared_t *f_sh);
 H5_DLL herr_t H5PB_dest(H5F_shared_t *f_sh);
 H5_DLL herr_t H5PB_add_new_page(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t page_addr);
 H5_DLL herr_t H5PB_update_entry(H5PB_t *page_buf, haddr_t addr, size_t size, const void *buf);
 H5_DLL herr_t H5PB_remove_entry(const H5F_shared_t *f_sh, haddr_t addr);
+H5_DLL herr_t H5PB_page_exists(H5F_shared_t *f_sh, haddr_t addr, hbool_t *page_exists);
 H5_DLL herr_t H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *buf /*out*/);
 H5_DLL herr_t H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
 
@@ -96,6 +140,7 @@ H5_DLL herr_t H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size
 H5_DLL herr_t H5PB_reset_stats(H5PB_t *page_buf);
 H5_DLL herr_t H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2], unsigned hits[2],
                              unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
+H5_DLL herr_t H5PB_get_type_stats(const H5PB_t *page_buf, H5FD_mem_t type, H5PB_type_stats_t *stats);
 H5_DLL herr_t H5PB_print_stats(const H5PB_t *page_buf);
 
 #endif /* !_H5PBprivate_H */
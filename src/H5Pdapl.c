@@ -69,6 +69,16 @@
 #define H5D_ACS_VDS_PRINTF_GAP_DEF  (hsize_t)0
 #define H5D_ACS_VDS_PRINTF_GAP_ENC  H5P__encode_hsize_t
 #define H5D_ACS_VDS_PRINTF_GAP_DEC  H5P__decode_hsize_t
+/* Definitions for VDS source read-ahead threads */
+#define H5D_ACS_VDS_PREFETCH_SIZE sizeof(hbool_t)
+#define H5D_ACS_VDS_PREFETCH_DEF  FALSE
+#define H5D_ACS_VDS_PREFETCH_ENC  H5P__encode_hbool_t
+#define H5D_ACS_VDS_PREFETCH_DEC  H5P__decode_hbool_t
+/* Definitions for maximum number of open VDS source datasets */
+#define H5D_ACS_VDS_MAX_OPEN_SIZE sizeof(size_t)
+#define H5D_ACS_VDS_MAX_OPEN_DEF  0
+#define H5D_ACS_VDS_MAX_OPEN_ENC  H5P__encode_size_t
+#define H5D_ACS_VDS_MAX_OPEN_DEC  H5P__decode_size_t
 /* Definitions for VDS file prefix */
 #define H5D_ACS_VDS_PREFIX_SIZE  sizeof(char *)
 #define H5D_ACS_VDS_PREFIX_DEF   NULL /*default is no prefix */
@@ -195,6 +205,8 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
     double rdcc_w0     = H5D_ACS_PREEMPT_READ_CHUNKS_DEF;     /* Default raw data chunk cache dirty ratio */
     H5D_vds_view_t virtual_view = H5D_ACS_VDS_VIEW_DEF;       /* Default VDS view option */
     hsize_t        printf_gap   = H5D_ACS_VDS_PRINTF_GAP_DEF; /* Default VDS printf gap */
+    hbool_t        prefetch     = H5D_ACS_VDS_PREFETCH_DEF;   /* Default VDS source read-ahead */
+    size_t         max_open     = H5D_ACS_VDS_MAX_OPEN_DEF;   /* Default max. open VDS source datasets */
     herr_t         ret_value    = SUCCEED;                    /* Return value */
 
     FUNC_ENTER_STATIC
@@ -228,6 +240,18 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
                            NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the VDS source read-ahead flag */
+    if (H5P__register_real(pclass, H5D_ACS_VDS_PREFETCH_NAME, H5D_ACS_VDS_PREFETCH_SIZE, &prefetch, NULL,
+                           NULL, NULL, H5D_ACS_VDS_PREFETCH_ENC, H5D_ACS_VDS_PREFETCH_DEC, NULL, NULL, NULL,
+                           NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the maximum number of open VDS source datasets */
+    if (H5P__register_real(pclass, H5D_ACS_VDS_MAX_OPEN_NAME, H5D_ACS_VDS_MAX_OPEN_SIZE, &max_open, NULL,
+                           NULL, NULL, H5D_ACS_VDS_MAX_OPEN_ENC, H5D_ACS_VDS_MAX_OPEN_DEC, NULL, NULL, NULL,
+                           NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register property for vds prefix */
     if (H5P__register_real(pclass, H5D_ACS_VDS_PREFIX_NAME, H5D_ACS_VDS_PREFIX_SIZE, &H5D_def_vds_prefix_g,
                            NULL, H5D_ACS_VDS_PREFIX_SET, H5D_ACS_VDS_PREFIX_GET, H5D_ACS_VDS_PREFIX_ENC,
@@ -1267,6 +1291,89 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_virtual_printf_gap() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_virtual_source_io
+ *
+ * Purpose:     Sets how a virtual dataset accesses its source datasets.
+ *
+ *              If PREFETCH is TRUE, a read first asks the operating
+ *              system to start reading the parts of all contiguous and
+ *              chunked source datasets that it will access.  The reads
+ *              of the source datasets themselves are still serial, one
+ *              after another, but the operating system can fetch the
+ *              data from many source files at once while they happen.
+ *              Hints are only issued for source files whose driver uses
+ *              POSIX file descriptors.  FALSE (the default) disables
+ *              read-ahead hints.
+ *
+ *              MAX_OPEN is the maximum number of source datasets the
+ *              virtual dataset keeps open between I/O operations.  Once
+ *              more are open, the least recently used ones are closed,
+ *              and reopened when they are accessed again.  Zero (the
+ *              default) keeps all source datasets open until the virtual
+ *              dataset is closed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_virtual_source_io(hid_t plist_id, hbool_t prefetch, size_t max_open)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ibz", plist_id, prefetch, max_open);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_ACS_VDS_PREFETCH_NAME, &prefetch) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+    if (H5P_set(plist, H5D_ACS_VDS_MAX_OPEN_NAME, &max_open) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_virtual_source_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_virtual_source_io
+ *
+ * Purpose:     Gets whether read-ahead hints are issued and the maximum
+ *              number of open source datasets for a virtual dataset,
+ *              set with H5Pset_virtual_source_io.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_virtual_source_io(hid_t plist_id, hbool_t *prefetch /*out*/, size_t *max_open /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", plist_id, prefetch, max_open);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get values from property list */
+    if (prefetch)
+        if (H5P_get(plist, H5D_ACS_VDS_PREFETCH_NAME, prefetch) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+    if (max_open)
+        if (H5P_get(plist, H5D_ACS_VDS_MAX_OPEN_NAME, max_open) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_virtual_source_io() */
+
 /*-------------------------------------------------------------------------
  * Function: H5Pset_append_flush
  *
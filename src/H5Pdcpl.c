@@ -91,7 +91,7 @@
     {                                                                                                        \
         {HADDR_UNDEF, 0}, 0, NULL, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,                       \
                                        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},                      \
-            H5D_VDS_ERROR, HSIZE_UNDEF, -1, -1, FALSE                                                        \
+            H5D_VDS_ERROR, HSIZE_UNDEF, -1, -1, FALSE, NULL, 0, 0, 0, 0, FALSE                               \
     }
 #ifdef H5_HAVE_C99_DESIGNATED_INITIALIZER
 #define H5D_DEF_STORAGE_COMPACT                                                                              \
@@ -3149,6 +3149,52 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_nbit() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_vlpack
+ *
+ * Purpose:     Sets the variable-length packing filter for a dataset
+ *              creation property list.  Chunks of a dataset with this
+ *              filter store the data of their variable-length strings or
+ *              sequences directly, as element offsets followed by the
+ *              concatenated data, instead of as references to the global
+ *              heap.  It must be the first filter set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_vlpack(hid_t plist_id)
+{
+    H5O_pline_t     pline;
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", plist_id);
+
+    /* Check arguments */
+    if (TRUE != H5P_isa_class(plist_id, H5P_DATASET_CREATE))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset creation property list")
+
+    /* Get the plist structure */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Add the vlpack filter */
+    if (H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+    if (pline.nused > 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FAIL, "vlpack must be the first filter in the pipeline")
+    if (H5Z_append(&pline, H5Z_FILTER_VLPACK, H5Z_FLAG_MANDATORY, (size_t)0, NULL) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add vlpack filter to pipeline")
+    if (H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_vlpack() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_scaleoffset
  *
@@ -3224,6 +3270,198 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_scaleoffset() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_lz4
+ *
+ * Purpose:     Adds the LZ4 compression filter to the filter pipeline of a
+ *              dataset creation property list.  The data is compressed in
+ *              blocks of BLOCK_SIZE bytes, or as a single block if
+ *              BLOCK_SIZE is zero.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_lz4(hid_t plist_id, unsigned block_size)
+{
+    H5O_pline_t     pline;
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, block_size);
+
+    /* Check arguments */
+    if (block_size > H5Z_LZ4_MAX_BLOCK_SIZE)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "block size is too large")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Add the LZ4 filter */
+    if (H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+    if (H5Z_append(&pline, H5Z_FILTER_LZ4, H5Z_FLAG_OPTIONAL, (size_t)H5Z_LZ4_USER_NPARMS, &block_size) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add lz4 filter to pipeline")
+    if (H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_lz4() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_zstd
+ *
+ * Purpose:     Adds the Zstandard compression filter to the filter
+ *              pipeline of a dataset creation property list.  LEVEL is
+ *              the compression level, up to H5Z_ZSTD_MAX_LEVEL, with zero
+ *              selecting Zstandard's default and negative levels trading
+ *              compression for speed.
+ *
+ *              If DICT is not NULL, the DICT_SIZE bytes it points to are
+ *              used as a dictionary for compressing and uncompressing
+ *              each chunk.  The dictionary is stored with the filter's
+ *              parameters, so it can be at most H5Z_ZSTD_MAX_DICT_SIZE
+ *              bytes.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_zstd(hid_t plist_id, int level, const void *dict, size_t dict_size)
+{
+    H5O_pline_t     pline;
+    H5P_genplist_t *plist;               /* Property list pointer */
+    unsigned *      cd_values = NULL;    /* Filter parameters */
+    size_t          cd_nelmts;           /* Number of filter parameters */
+    size_t          u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iIs*xz", plist_id, level, dict, dict_size);
+
+    /* Check arguments */
+    if (level > H5Z_ZSTD_MAX_LEVEL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid compression level")
+    if (dict && 0 == dict_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dictionary is empty")
+    if (dict_size > H5Z_ZSTD_MAX_DICT_SIZE)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dictionary is too large")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set the parameters for the filter, packing the dictionary's bytes
+     * four to a value, least significant byte first
+     */
+    cd_nelmts = dict ? H5Z_ZSTD_PARM_DICT + (dict_size + 3) / 4 : H5Z_ZSTD_USER_NPARMS;
+    if (NULL == (cd_values = (unsigned *)H5MM_calloc(cd_nelmts * sizeof(unsigned))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate filter parameters")
+    cd_values[H5Z_ZSTD_PARM_LEVEL] = (unsigned)level;
+    if (dict) {
+        cd_values[H5Z_ZSTD_PARM_DICT_SIZE] = (unsigned)dict_size;
+        for (u = 0; u < dict_size; u++)
+            cd_values[H5Z_ZSTD_PARM_DICT + u / 4] |= (unsigned)((const uint8_t *)dict)[u] << (8 * (u % 4));
+    } /* end if */
+
+    /* Add the Zstandard filter */
+    if (H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+    if (H5Z_append(&pline, H5Z_FILTER_ZSTD, H5Z_FLAG_OPTIONAL, cd_nelmts, cd_values) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add zstd filter to pipeline")
+    if (H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to set pipeline")
+
+done:
+    if (cd_values)
+        H5MM_xfree(cd_values);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_zstd() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_blocked
+ *
+ * Purpose:     Adds the blocked compression filter to the filter pipeline
+ *              of a dataset creation property list.  The filter splits
+ *              each chunk into blocks of BLOCK_SIZE bytes, or
+ *              H5Z_BLOCKED_DEF_BLOCK_SIZE if BLOCK_SIZE is zero, and
+ *              compresses them separately with CODEC, which is
+ *              H5Z_FILTER_DEFLATE, H5Z_FILTER_LZ4 or H5Z_FILTER_ZSTD.
+ *              LEVEL is the compression level for deflate and Zstandard,
+ *              and is ignored for LZ4.
+ *
+ *              The blocks of a chunk can be compressed and uncompressed
+ *              by several threads at once; see H5Pset_filter_threads.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_blocked(hid_t plist_id, H5Z_filter_t codec, int level, unsigned block_size)
+{
+    H5O_pline_t     pline;
+    H5P_genplist_t *plist;                              /* Property list pointer */
+    unsigned        cd_values[H5Z_BLOCKED_USER_NPARMS]; /* Filter parameters */
+    herr_t          ret_value = SUCCEED;                /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iZfIsIu", plist_id, codec, level, block_size);
+
+    /* Check arguments */
+    switch (codec) {
+#ifdef H5_HAVE_FILTER_DEFLATE
+        case H5Z_FILTER_DEFLATE:
+            if (level < 0 || level > 9)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid deflate level")
+            break;
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
+#ifdef H5_HAVE_FILTER_LZ4
+        case H5Z_FILTER_LZ4:
+            level = 0;
+            break;
+#endif /* H5_HAVE_FILTER_LZ4 */
+
+#ifdef H5_HAVE_FILTER_ZSTD
+        case H5Z_FILTER_ZSTD:
+            if (level > H5Z_ZSTD_MAX_LEVEL)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid Zstandard level")
+            break;
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "compression method is not available")
+    } /* end switch */
+    if (block_size > H5Z_BLOCKED_MAX_BLOCK_SIZE)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "block size is too large")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Add the blocked filter */
+    cd_values[H5Z_BLOCKED_PARM_CODEC]      = (unsigned)codec;
+    cd_values[H5Z_BLOCKED_PARM_LEVEL]      = (unsigned)level;
+    cd_values[H5Z_BLOCKED_PARM_BLOCK_SIZE] = block_size;
+    if (H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+    if (H5Z_append(&pline, H5Z_FILTER_BLOCKED, H5Z_FLAG_OPTIONAL, (size_t)H5Z_BLOCKED_USER_NPARMS,
+                   cd_values) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add blocked filter to pipeline")
+    if (H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_blocked() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_fill_value
  *
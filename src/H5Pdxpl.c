@@ -142,6 +142,11 @@
     {                                                                                                        \
         NULL, NULL                                                                                           \
     }
+/* Definitions for filter threads property */
+#define H5D_XFER_FILTER_THREADS_SIZE sizeof(unsigned)
+#define H5D_XFER_FILTER_THREADS_DEF  1
+#define H5D_XFER_FILTER_THREADS_ENC  H5P__encode_unsigned
+#define H5D_XFER_FILTER_THREADS_DEC  H5P__decode_unsigned
 /* Definitions for type conversion callback function property */
 #define H5D_XFER_CONV_CB_SIZE sizeof(H5T_conv_cb_t)
 #define H5D_XFER_CONV_CB_DEF                                                                                 \
@@ -260,6 +265,8 @@ static const H5D_mpio_no_collective_cause_t H5D_def_mpio_no_collective_cause_g =
     H5D_MPIO_NO_COLLECTIVE_CAUSE_DEF;
 static const H5Z_EDC_t H5D_def_enable_edc_g = H5D_XFER_EDC_DEF;       /* Default value for EDC property */
 static const H5Z_cb_t  H5D_def_filter_cb_g  = H5D_XFER_FILTER_CB_DEF; /* Default value for filter callback */
+static const unsigned  H5D_def_filter_threads_g =
+    H5D_XFER_FILTER_THREADS_DEF; /* Default value for filter threads */
 static const H5T_conv_cb_t H5D_def_conv_cb_g =
     H5D_XFER_CONV_CB_DEF; /* Default value for datatype conversion callback */
 static const void *H5D_def_xfer_xform_g = H5D_XFER_XFORM_DEF; /* Default value for data transform */
@@ -407,6 +414,12 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
                            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the filter threads property */
+    if (H5P__register_real(pclass, H5D_XFER_FILTER_THREADS_NAME, H5D_XFER_FILTER_THREADS_SIZE,
+                           &H5D_def_filter_threads_g, NULL, NULL, NULL, H5D_XFER_FILTER_THREADS_ENC,
+                           H5D_XFER_FILTER_THREADS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the type conversion callback property */
     /* (Note: this property should not have an encode/decode callback -QAK) */
     if (H5P__register_real(pclass, H5D_XFER_CONV_CB_NAME, H5D_XFER_CONV_CB_SIZE, &H5D_def_conv_cb_g, NULL,
@@ -1331,6 +1344,76 @@ done:
     FUNC_LEAVE_API(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_filter_threads
+ *
+ * Purpose:     Sets the number of threads that filters may use for each
+ *              chunk they process.  Only filters that split a chunk into
+ *              parts that can be processed separately, such as the blocked
+ *              compression filter, use more than one thread.
+ *
+ *              The default is one thread.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_filter_threads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Check arguments */
+    if (nthreads < 1)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be at least one")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_XFER_FILTER_THREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_filter_threads() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_filter_threads
+ *
+ * Purpose:	Reads the value set with H5Pset_filter_threads().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_filter_threads(hid_t plist_id, unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Return value */
+    if (nthreads)
+        if (H5P_get(plist, H5D_XFER_FILTER_THREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_filter_threads() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_type_conv_cb
  *
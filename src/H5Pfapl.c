@@ -219,6 +219,11 @@
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_DEF  FALSE
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_ENC  H5P__encode_hbool_t
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_DEC  H5P__decode_hbool_t
+/* Definition for 'mdc log format' property */
+#define H5F_ACS_MDC_LOG_FORMAT_SIZE sizeof(H5F_mdc_log_format_t)
+#define H5F_ACS_MDC_LOG_FORMAT_DEF  H5F_MDC_LOG_FORMAT_JSON
+#define H5F_ACS_MDC_LOG_FORMAT_ENC  H5P__facc_mdc_log_format_enc
+#define H5F_ACS_MDC_LOG_FORMAT_DEC  H5P__facc_mdc_log_format_dec
 /* Definition for evict on close property */
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_SIZE sizeof(hbool_t)
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_DEF  FALSE
@@ -275,6 +280,21 @@
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF  0
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_ENC  H5P__encode_unsigned
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC  H5P__decode_unsigned
+/* Definition for page buffer replacement policy */
+#define H5F_ACS_PAGE_BUFFER_POLICY_SIZE sizeof(H5F_page_buf_policy_t)
+#define H5F_ACS_PAGE_BUFFER_POLICY_DEF  H5F_PAGE_BUF_POLICY_LRU
+#define H5F_ACS_PAGE_BUFFER_POLICY_ENC  H5P__facc_page_buf_policy_enc
+#define H5F_ACS_PAGE_BUFFER_POLICY_DEC  H5P__facc_page_buf_policy_dec
+/* Definition for page buffer raw data write-behind budget */
+#define H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_SIZE sizeof(size_t)
+#define H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_DEF  0
+#define H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_ENC  H5P__encode_size_t
+#define H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_DEC  H5P__decode_size_t
+/* Definition for page buffer raw data read-ahead */
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_SIZE sizeof(unsigned)
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_DEF  0
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_ENC  H5P__encode_unsigned
+#define H5F_ACS_PAGE_BUFFER_READ_AHEAD_DEC  H5P__decode_unsigned
 /* Definition for file VOL connector properties (ID, etc.) */
 #define H5F_ACS_VOL_CONN_SIZE sizeof(H5VL_connector_prop_t)
 #define H5F_ACS_VOL_CONN_DEF                                                                                 \
@@ -352,6 +372,8 @@ static herr_t H5P__facc_cache_config_dec(const void **_pp, void *value);
 static int    H5P__facc_cache_config_cmp(const void *value1, const void *value2, size_t size);
 static herr_t H5P__facc_fclose_degree_enc(const void *value, void **_pp, size_t *size);
 static herr_t H5P__facc_fclose_degree_dec(const void **pp, void *value);
+static herr_t H5P__facc_page_buf_policy_enc(const void *value, void **_pp, size_t *size);
+static herr_t H5P__facc_page_buf_policy_dec(const void **pp, void *value);
 static herr_t H5P__facc_multi_type_enc(const void *value, void **_pp, size_t *size);
 static herr_t H5P__facc_multi_type_dec(const void **_pp, void *value);
 static herr_t H5P__facc_libver_type_enc(const void *value, void **_pp, size_t *size);
@@ -364,6 +386,8 @@ static herr_t H5P__facc_mdc_log_location_del(hid_t prop_id, const char *name, si
 static herr_t H5P__facc_mdc_log_location_copy(const char *name, size_t size, void *value);
 static int    H5P__facc_mdc_log_location_cmp(const void *value1, const void *value2, size_t size);
 static herr_t H5P__facc_mdc_log_location_close(const char *name, size_t size, void *value);
+static herr_t H5P__facc_mdc_log_format_enc(const void *value, void **_pp, size_t *size);
+static herr_t H5P__facc_mdc_log_format_dec(const void **_pp, void *value);
 
 /* Metadata cache image property callbacks */
 static int    H5P__facc_cache_image_config_cmp(const void *_config1, const void *_config2,
@@ -484,6 +508,8 @@ static const hbool_t H5F_def_use_mdc_logging_g =
 static const char *  H5F_def_mdc_log_location_g = H5F_ACS_MDC_LOG_LOCATION_DEF; /* Default mdc log location */
 static const hbool_t H5F_def_start_mdc_log_on_access_g =
     H5F_ACS_START_MDC_LOG_ON_ACCESS_DEF; /* Default mdc log start on access flag */
+static const H5F_mdc_log_format_t H5F_def_mdc_log_format_g =
+    H5F_ACS_MDC_LOG_FORMAT_DEF; /* Default mdc log format */
 static const hbool_t H5F_def_evict_on_close_flag_g =
     H5F_ACS_EVICT_ON_CLOSE_FLAG_DEF; /* Default setting for evict on close property */
 #ifdef H5_HAVE_PARALLEL
@@ -501,6 +527,12 @@ static const unsigned H5F_def_page_buf_min_meta_perc_g =
     H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEF; /* Default page buffer minimum metadata size */
 static const unsigned H5F_def_page_buf_min_raw_perc_g =
     H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF; /* Default page buffer mininum raw data size */
+static const H5F_page_buf_policy_t H5F_def_page_buf_policy_g =
+    H5F_ACS_PAGE_BUFFER_POLICY_DEF; /* Default page buffer replacement policy */
+static const size_t   H5F_def_page_buf_write_behind_g =
+    H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_DEF; /* Default page buffer write-behind budget */
+static const unsigned H5F_def_page_buf_read_ahead_g =
+    H5F_ACS_PAGE_BUFFER_READ_AHEAD_DEF; /* Default page buffer read-ahead page count */
 static const hbool_t H5F_def_use_file_locking_g =
     H5F_ACS_USE_FILE_LOCKING_DEF; /* Default use file locking flag */
 static const hbool_t H5F_def_ignore_disabled_file_locks_g =
@@ -718,6 +750,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the mdc log format */
+    if (H5P__register_real(pclass, H5F_ACS_MDC_LOG_FORMAT_NAME, H5F_ACS_MDC_LOG_FORMAT_SIZE,
+                           &H5F_def_mdc_log_format_g, NULL, NULL, NULL, H5F_ACS_MDC_LOG_FORMAT_ENC,
+                           H5F_ACS_MDC_LOG_FORMAT_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the evict on close flag */
     if (H5P__register_real(pclass, H5F_ACS_EVICT_ON_CLOSE_FLAG_NAME, H5F_ACS_EVICT_ON_CLOSE_FLAG_SIZE,
                            &H5F_def_evict_on_close_flag_g, NULL, NULL, NULL, H5F_ACS_EVICT_ON_CLOSE_FLAG_ENC,
@@ -783,6 +821,26 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the page buffer replacement policy */
+    if (H5P__register_real(pclass, H5F_ACS_PAGE_BUFFER_POLICY_NAME, H5F_ACS_PAGE_BUFFER_POLICY_SIZE,
+                           &H5F_def_page_buf_policy_g, NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_POLICY_ENC,
+                           H5F_ACS_PAGE_BUFFER_POLICY_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the page buffer raw data write-behind budget */
+    if (H5P__register_real(pclass, H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_NAME,
+                           H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_SIZE, &H5F_def_page_buf_write_behind_g, NULL,
+                           NULL, NULL, H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_ENC,
+                           H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the page buffer raw data read-ahead page count */
+    if (H5P__register_real(pclass, H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME, H5F_ACS_PAGE_BUFFER_READ_AHEAD_SIZE,
+                           &H5F_def_page_buf_read_ahead_g, NULL, NULL, NULL,
+                           H5F_ACS_PAGE_BUFFER_READ_AHEAD_ENC, H5F_ACS_PAGE_BUFFER_READ_AHEAD_DEC, NULL, NULL,
+                           NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the file VOL connector ID & info */
     /* (Note: this property should not have an encode/decode callback -QAK) */
     if (H5P__register_real(pclass, H5F_ACS_VOL_CONN_NAME, H5F_ACS_VOL_CONN_SIZE, &def_vol_prop,
@@ -3906,6 +3964,72 @@ H5P__facc_fclose_degree_dec(const void **_pp, void *_value)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5P__facc_fclose_degree_dec() */
 
+/*-------------------------------------------------------------------------
+ * Function:       H5P__facc_page_buf_policy_enc
+ *
+ * Purpose:        Callback routine which is called whenever the page buffer
+ *                 replacement policy property in the file access property
+ *                 list is encoded.
+ *
+ * Return:       Success:    Non-negative
+ *           Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__facc_page_buf_policy_enc(const void *value, void **_pp, size_t *size)
+{
+    const H5F_page_buf_policy_t *policy =
+        (const H5F_page_buf_policy_t *)value; /* Create local alias for values */
+    uint8_t **pp = (uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(policy);
+    HDassert(size);
+
+    if (NULL != *pp)
+        /* Encode page buffer replacement policy */
+        *(*pp)++ = (uint8_t)*policy;
+
+    /* Size of page buffer replacement policy */
+    (*size)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__facc_page_buf_policy_enc() */
+
+/*-------------------------------------------------------------------------
+ * Function:       H5P__facc_page_buf_policy_dec
+ *
+ * Purpose:        Callback routine which is called whenever the page buffer
+ *                 replacement policy property in the file access property
+ *                 list is decoded.
+ *
+ * Return:       Success:    Non-negative
+ *           Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__facc_page_buf_policy_dec(const void **_pp, void *_value)
+{
+    H5F_page_buf_policy_t *policy = (H5F_page_buf_policy_t *)_value; /* Page buffer replacement policy */
+    const uint8_t **       pp     = (const uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(pp);
+    HDassert(*pp);
+    HDassert(policy);
+
+    /* Decode page buffer replacement policy */
+    *policy = (H5F_page_buf_policy_t) * (*pp)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__facc_page_buf_policy_dec() */
+
 /*-------------------------------------------------------------------------
  * Function:       H5P__facc_multi_type_enc
  *
@@ -4315,6 +4439,81 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_mdc_log_options() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_mdc_log_format
+ *
+ * Purpose:     Set the format of the metadata cache log enabled with
+ *              H5Pset_mdc_log_options().
+ *
+ *              H5F_MDC_LOG_FORMAT_JSON (the default) writes one
+ *              human-readable JSON object per cache operation.
+ *              H5F_MDC_LOG_FORMAT_BINARY writes compact fixed-size
+ *              records that are buffered in memory, which is cheap
+ *              enough to leave on in production.  Binary logs can be
+ *              summarized and replayed with the h5mdclog tool.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_mdc_log_format(hid_t plist_id, H5F_mdc_log_format_t format)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iFl", plist_id, format);
+
+    /* Check arguments */
+    if (H5P_DEFAULT == plist_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "can't modify default property list")
+    if (format < H5F_MDC_LOG_FORMAT_JSON || format >= H5F_MDC_LOG_FORMAT_NTYPES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid mdc log format")
+
+    /* Get the property list structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "plist_id is not a file access property list")
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_MDC_LOG_FORMAT_NAME, &format) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set log format")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_mdc_log_format() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_mdc_log_format
+ *
+ * Purpose:     Get the format of the metadata cache log.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mdc_log_format(hid_t plist_id, H5F_mdc_log_format_t *format)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*Fl", plist_id, format);
+
+    /* Get the property list structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "plist_id is not a file access property list")
+
+    /* Get value */
+    if (format)
+        if (H5P_get(plist, H5F_ACS_MDC_LOG_FORMAT_NAME, format) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get log format")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_mdc_log_format() */
+
 /*-------------------------------------------------------------------------
  * Function:       H5P__facc_mdc_log_location_enc
  *
@@ -4516,6 +4715,72 @@ H5P__facc_mdc_log_location_close(const char H5_ATTR_UNUSED *name, size_t H5_ATTR
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5P__facc_mdc_log_location_close() */
 
+/*-------------------------------------------------------------------------
+ * Function:       H5P__facc_mdc_log_format_enc
+ *
+ * Purpose:        Callback routine which is called whenever the metadata
+ *                 cache log format property in the file access property
+ *                 list is encoded.
+ *
+ * Return:       Success:    Non-negative
+ *           Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__facc_mdc_log_format_enc(const void *value, void **_pp, size_t *size)
+{
+    const H5F_mdc_log_format_t *format =
+        (const H5F_mdc_log_format_t *)value; /* Create local alias for values */
+    uint8_t **pp = (uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(format);
+    HDassert(size);
+
+    if (NULL != *pp)
+        /* Encode mdc log format */
+        *(*pp)++ = (uint8_t)*format;
+
+    /* Size of mdc log format */
+    (*size)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__facc_mdc_log_format_enc() */
+
+/*-------------------------------------------------------------------------
+ * Function:       H5P__facc_mdc_log_format_dec
+ *
+ * Purpose:        Callback routine which is called whenever the metadata
+ *                 cache log format property in the file access property
+ *                 list is decoded.
+ *
+ * Return:       Success:    Non-negative
+ *           Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__facc_mdc_log_format_dec(const void **_pp, void *_value)
+{
+    H5F_mdc_log_format_t *format = (H5F_mdc_log_format_t *)_value; /* Metadata cache log format */
+    const uint8_t **      pp     = (const uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(pp);
+    HDassert(*pp);
+    HDassert(format);
+
+    /* Decode mdc log format */
+    *format = (H5F_mdc_log_format_t) * (*pp)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__facc_mdc_log_format_dec() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_evict_on_close
  *
@@ -5498,6 +5763,156 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_page_buffer_size() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_page_buffer_policy
+ *
+ * Purpose:     Set the replacement policy used by the page buffer.
+ *
+ *              H5F_PAGE_BUF_POLICY_LRU (the default) evicts the least
+ *              recently used page.  H5F_PAGE_BUF_POLICY_2Q keeps pages
+ *              that have been referenced only once in a separate FIFO
+ *              queue, so that a large sequential scan can't push out the
+ *              frequently accessed (mostly metadata) pages.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_page_buffer_policy(hid_t plist_id, H5F_page_buf_policy_t policy)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iFp", plist_id, policy);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    if (policy < H5F_PAGE_BUF_POLICY_LRU || policy >= H5F_PAGE_BUF_POLICY_NTYPES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid page buffer replacement policy")
+
+    /* Set policy */
+    if (H5P_set(plist, H5F_ACS_PAGE_BUFFER_POLICY_NAME, &policy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer replacement policy")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_page_buffer_policy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_page_buffer_policy
+ *
+ * Purpose:     Retrieves the page buffer replacement policy.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_page_buffer_policy(hid_t plist_id, H5F_page_buf_policy_t *policy)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*Fp", plist_id, policy);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get policy */
+    if (policy)
+        if (H5P_get(plist, H5F_ACS_PAGE_BUFFER_POLICY_NAME, policy) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get page buffer replacement policy")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_page_buffer_policy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_page_buffer_raw_io
+ *
+ * Purpose:     Configure how the page buffer handles raw data pages.
+ *
+ *              WRITE_BEHIND is a budget, in bytes, for dirty raw data
+ *              pages.  Once that many bytes of raw data pages are dirty,
+ *              they are all written out in address order, with adjacent
+ *              pages combined into a single write of up to WRITE_BEHIND
+ *              bytes.  Zero (the default) writes each dirty raw data page
+ *              as it is evicted.  When non-zero, it must be at least the
+ *              file space page size and no more than the page buffer size.
+ *
+ *              READ_AHEAD is the maximum number of raw data pages read
+ *              with a single request once the page buffer detects that
+ *              raw data pages are being read sequentially.  Zero (the
+ *              default) disables read-ahead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_page_buffer_raw_io(hid_t plist_id, size_t write_behind, unsigned read_ahead)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "izIu", plist_id, write_behind, read_ahead);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set values */
+    if (H5P_set(plist, H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_NAME, &write_behind) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer write-behind size")
+    if (H5P_set(plist, H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME, &read_ahead) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer read-ahead")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_page_buffer_raw_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_page_buffer_raw_io
+ *
+ * Purpose:     Retrieves the page buffer raw data write-behind budget and
+ *              read-ahead page count.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_page_buffer_raw_io(hid_t plist_id, size_t *write_behind, unsigned *read_ahead)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i*z*Iu", plist_id, write_behind, read_ahead);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get values */
+    if (write_behind)
+        if (H5P_get(plist, H5F_ACS_PAGE_BUFFER_WRITE_BEHIND_NAME, write_behind) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get page buffer write-behind size")
+    if (read_ahead)
+        if (H5P_get(plist, H5F_ACS_PAGE_BUFFER_READ_AHEAD_NAME, read_ahead) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get page buffer read-ahead")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_page_buffer_raw_io() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5P_set_vol
  *
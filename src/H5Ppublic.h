@@ -359,6 +359,8 @@ H5_DLL herr_t      H5Pset_mdc_log_options(hid_t plist_id, hbool_t is_enabled, co
                                           hbool_t start_on_access);
 H5_DLL herr_t      H5Pget_mdc_log_options(hid_t plist_id, hbool_t *is_enabled, char *location,
                                           size_t *location_size, hbool_t *start_on_access);
+H5_DLL herr_t      H5Pset_mdc_log_format(hid_t plist_id, H5F_mdc_log_format_t format);
+H5_DLL herr_t      H5Pget_mdc_log_format(hid_t plist_id, H5F_mdc_log_format_t *format);
 H5_DLL herr_t      H5Pset_evict_on_close(hid_t fapl_id, hbool_t evict_on_close);
 H5_DLL herr_t      H5Pget_evict_on_close(hid_t fapl_id, hbool_t *evict_on_close);
 H5_DLL herr_t      H5Pset_file_locking(hid_t fapl_id, hbool_t use_file_locking, hbool_t ignore_when_disabled);
@@ -377,6 +379,10 @@ H5_DLL herr_t H5Pset_page_buffer_size(hid_t plist_id, size_t buf_size, unsigned
                                       unsigned min_raw_per);
 H5_DLL herr_t H5Pget_page_buffer_size(hid_t plist_id, size_t *buf_size, unsigned *min_meta_per,
                                       unsigned *min_raw_per);
+H5_DLL herr_t H5Pset_page_buffer_policy(hid_t plist_id, H5F_page_buf_policy_t policy);
+H5_DLL herr_t H5Pget_page_buffer_policy(hid_t plist_id, H5F_page_buf_policy_t *policy);
+H5_DLL herr_t H5Pset_page_buffer_raw_io(hid_t plist_id, size_t write_behind, unsigned read_ahead);
+H5_DLL herr_t H5Pget_page_buffer_raw_io(hid_t plist_id, size_t *write_behind, unsigned *read_ahead);
 
 /* Dataset creation property list (DCPL) routines */
 H5_DLL herr_t       H5Pset_layout(hid_t plist_id, H5D_layout_t layout);
@@ -399,7 +405,11 @@ H5_DLL herr_t       H5Pget_external(hid_t plist_id, unsigned idx, size_t name_si
 H5_DLL herr_t       H5Pset_szip(hid_t plist_id, unsigned options_mask, unsigned pixels_per_block);
 H5_DLL herr_t       H5Pset_shuffle(hid_t plist_id);
 H5_DLL herr_t       H5Pset_nbit(hid_t plist_id);
+H5_DLL herr_t       H5Pset_vlpack(hid_t plist_id);
 H5_DLL herr_t       H5Pset_scaleoffset(hid_t plist_id, H5Z_SO_scale_type_t scale_type, int scale_factor);
+H5_DLL herr_t       H5Pset_lz4(hid_t plist_id, unsigned block_size);
+H5_DLL herr_t       H5Pset_zstd(hid_t plist_id, int level, const void *dict, size_t dict_size);
+H5_DLL herr_t       H5Pset_blocked(hid_t plist_id, H5Z_filter_t codec, int level, unsigned block_size);
 H5_DLL herr_t       H5Pset_fill_value(hid_t plist_id, hid_t type_id, const void *value);
 H5_DLL herr_t       H5Pget_fill_value(hid_t plist_id, hid_t type_id, void *value /*out*/);
 H5_DLL herr_t       H5Pfill_value_defined(hid_t plist, H5D_fill_value_t *status);
@@ -418,6 +428,8 @@ H5_DLL herr_t  H5Pset_virtual_view(hid_t plist_id, H5D_vds_view_t view);
 H5_DLL herr_t  H5Pget_virtual_view(hid_t plist_id, H5D_vds_view_t *view);
 H5_DLL herr_t  H5Pset_virtual_printf_gap(hid_t plist_id, hsize_t gap_size);
 H5_DLL herr_t  H5Pget_virtual_printf_gap(hid_t plist_id, hsize_t *gap_size);
+H5_DLL herr_t  H5Pset_virtual_source_io(hid_t plist_id, hbool_t prefetch, size_t max_open);
+H5_DLL herr_t  H5Pget_virtual_source_io(hid_t plist_id, hbool_t *prefetch /*out*/, size_t *max_open /*out*/);
 H5_DLL herr_t  H5Pset_virtual_prefix(hid_t dapl_id, const char *prefix);
 H5_DLL ssize_t H5Pget_virtual_prefix(hid_t dapl_id, char *prefix /*out*/, size_t size);
 H5_DLL herr_t  H5Pset_append_flush(hid_t plist_id, unsigned ndims, const hsize_t boundary[],
@@ -437,6 +449,8 @@ H5_DLL int       H5Pget_preserve(hid_t plist_id);
 H5_DLL herr_t    H5Pset_edc_check(hid_t plist_id, H5Z_EDC_t check);
 H5_DLL H5Z_EDC_t H5Pget_edc_check(hid_t plist_id);
 H5_DLL herr_t    H5Pset_filter_callback(hid_t plist_id, H5Z_filter_func_t func, void *op_data);
+H5_DLL herr_t    H5Pset_filter_threads(hid_t plist_id, unsigned nthreads);
+H5_DLL herr_t    H5Pget_filter_threads(hid_t plist_id, unsigned *nthreads /*out*/);
 H5_DLL herr_t    H5Pset_btree_ratios(hid_t plist_id, double left, double middle, double right);
 H5_DLL herr_t    H5Pget_btree_ratios(hid_t plist_id, double *left /*out*/, double *middle /*out*/,
                                      double *right /*out*/);
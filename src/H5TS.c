@@ -16,6 +16,10 @@
 #include "H5Eprivate.h"  /*error handling              */
 #include "H5MMprivate.h" /*memory management functions    */
 
+#if defined(H5_HAVE_WORKER_THREADS) && !defined(H5_HAVE_THREADSAFE)
+#include <pthread.h>
+#endif
+
 #ifdef H5_HAVE_THREADSAFE
 
 /* Module specific data structures */
@@ -667,3 +671,126 @@ H5TS_create_thread(void *(*func)(void *), H5TS_attr_t *attr, void *udata)
 } /* H5TS_create_thread */
 
 #endif /* H5_HAVE_THREADSAFE */
+
+#ifdef H5_HAVE_WORKER_THREADS
+
+/* Shared state of the workers started by H5TS_run_tasks() */
+typedef struct H5TS_task_pool_t {
+    pthread_mutex_t  mutex;  /* Protects 'next' and 'status' */
+    size_t           next;   /* Next task to hand out */
+    size_t           ntasks; /* Total number of tasks */
+    H5TS_task_func_t func;   /* Task callback */
+    void *           udata;  /* Callback context */
+    herr_t           status; /* FAIL once any task has failed */
+} H5TS_task_pool_t;
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS__task_worker
+ *
+ * RETURNS
+ *    NULL
+ *
+ * DESCRIPTION
+ *    Runs tasks from the pool until none are left.  After a failure, no
+ *    further tasks are handed out.
+ *
+ *--------------------------------------------------------------------------
+ */
+static void *
+H5TS__task_worker(void *_pool)
+{
+    H5TS_task_pool_t *pool = (H5TS_task_pool_t *)_pool;
+    size_t            task;
+
+    while (1) {
+        pthread_mutex_lock(&pool->mutex);
+        if (pool->status < 0 || pool->next >= pool->ntasks) {
+            pthread_mutex_unlock(&pool->mutex);
+            break;
+        } /* end if */
+        task = pool->next++;
+        pthread_mutex_unlock(&pool->mutex);
+
+        if ((pool->func)(task, pool->udata) < 0) {
+            pthread_mutex_lock(&pool->mutex);
+            pool->status = FAIL;
+            pthread_mutex_unlock(&pool->mutex);
+        } /* end if */
+    }     /* end while */
+
+    return NULL;
+} /* H5TS__task_worker() */
+#endif /* H5_HAVE_WORKER_THREADS */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_run_tasks
+ *
+ * RETURNS
+ *    Non-negative if all tasks succeeded, negative otherwise.
+ *
+ * DESCRIPTION
+ *    Calls FUNC for each task number in [0, NTASKS), using the calling
+ *    thread plus up to MAX_THREADS - 1 short-lived worker threads, and
+ *    returns once all of them have finished.  Tasks may run in any order
+ *    and concurrently, so FUNC must not call into the library; errors must
+ *    be recorded in UDATA and reported by the caller.
+ *
+ *    When the library is built without worker threads, or a thread can't
+ *    be started, the remaining tasks run on fewer threads.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_run_tasks(unsigned max_threads, size_t ntasks, H5TS_task_func_t func, void *udata)
+{
+#ifdef H5_HAVE_WORKER_THREADS
+    H5TS_task_pool_t pool;
+    pthread_t *      threads  = NULL;
+    unsigned         nthreads = 0;
+    unsigned         u;
+#endif /* H5_HAVE_WORKER_THREADS */
+    size_t task;
+    herr_t ret_value = SUCCEED;
+
+    HDassert(func);
+
+#ifdef H5_HAVE_WORKER_THREADS
+    if ((size_t)max_threads > ntasks)
+        max_threads = (unsigned)ntasks;
+    if (max_threads > 1 && 0 == pthread_mutex_init(&pool.mutex, NULL)) {
+        pool.next   = 0;
+        pool.ntasks = ntasks;
+        pool.func   = func;
+        pool.udata  = udata;
+        pool.status = SUCCEED;
+
+        /* Start the helpers */
+        if (NULL != (threads = (pthread_t *)HDmalloc((size_t)(max_threads - 1) * sizeof(pthread_t))))
+            for (u = 0; u < max_threads - 1; u++) {
+                if (0 != pthread_create(&threads[nthreads], NULL, H5TS__task_worker, &pool))
+                    break;
+                nthreads++;
+            } /* end for */
+
+        /* Work alongside them (or alone, if none could be started) */
+        H5TS__task_worker(&pool);
+        for (u = 0; u < nthreads; u++)
+            pthread_join(threads[u], NULL);
+        HDfree(threads);
+        pthread_mutex_destroy(&pool.mutex);
+
+        return pool.status;
+    } /* end if */
+#else
+    (void)max_threads;
+#endif /* H5_HAVE_WORKER_THREADS */
+
+    /* Run the tasks on the calling thread */
+    for (task = 0; task < ntasks && ret_value >= 0; task++)
+        if ((func)(task, udata) < 0)
+            ret_value = FAIL;
+
+    return ret_value;
+} /* H5TS_run_tasks() */
@@ -132,4 +132,19 @@ H5_DLL H5TS_thread_t H5TS_create_thread(void *(*func)(void *), H5TS_attr_t *attr
 
 #endif /* H5_HAVE_THREADSAFE */
 
+/* Worker task callback for H5TS_run_tasks().  Tasks run on worker threads
+ * and must not call into the library (including the error stack).
+ */
+typedef herr_t (*H5TS_task_func_t)(size_t task, void *udata);
+
+#if defined c_plusplus || defined __cplusplus
+extern "C" {
+#endif /* c_plusplus || __cplusplus */
+
+H5_DLL herr_t H5TS_run_tasks(unsigned max_threads, size_t ntasks, H5TS_task_func_t func, void *udata);
+
+#if defined c_plusplus || defined __cplusplus
+}
+#endif /* c_plusplus || __cplusplus */
+
 #endif /* H5TSprivate_H_ */
@@ -1032,6 +1032,12 @@ done:
 /* Minimum size of variable-length conversion buffer */
 #define H5T_VLEN_MIN_CONF_BUF_SIZE 4096
 
+/* Maximum number of variable-length sequences read from the file in one batch */
+#define H5T_VLEN_BATCH_NELMTS 1024
+
+/* Maximum number of bytes of variable-length data read from the file in one batch */
+#define H5T_VLEN_BATCH_SIZE (1024 * 1024)
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -1059,6 +1065,20 @@ typedef struct H5T_conv_hw_t {
     size_t d_aligned; /*number destination elements aligned*/
 } H5T_conv_hw_t;
 
+/* Batch of variable-length sequences read from the file for H5T__conv_vlen() */
+typedef struct H5T_vlen_batch_t {
+    size_t       nalloc;    /* Number of sequences the arrays can hold */
+    size_t       nseq;      /* Number of sequences in the current batch */
+    size_t       next;      /* Index of the next sequence to consume */
+    hbool_t *    is_nil;    /* Whether each sequence is "nil" */
+    size_t *     seq_len;   /* Number of elements in each sequence */
+    const void **vl;        /* Location of each sequence's disk descriptor */
+    void **      buf;       /* Location of each sequence's data in the batch buffer */
+    size_t *     len;       /* Number of bytes of data for each sequence */
+    uint8_t *    data;      /* Buffer holding the data for all sequences in the batch */
+    size_t       data_size; /* Size of the data buffer in bytes */
+} H5T_vlen_batch_t;
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -1068,6 +1088,8 @@ typedef struct H5T_conv_hw_t {
 /********************/
 
 static herr_t H5T__reverse_order(uint8_t *rev, uint8_t *s, size_t size, H5T_order_t order);
+static herr_t H5T__conv_vlen_batch_fill(const H5T_t *src, size_t src_base_size, H5T_vlen_batch_t *batch,
+                                        uint8_t *s, ssize_t s_stride, size_t nelmts);
 
 /*********************/
 /* Public Variables */
@@ -3075,6 +3097,96 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_enum_numeric() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vlen_batch_fill
+ *
+ * Purpose:    Reads the next batch of variable-length sequences from the
+ *        file for H5T__conv_vlen().  Up to NELMTS source sequences,
+ *        starting at S and S_STRIDE bytes apart, are examined and
+ *        added to the batch until either the batch is full or its data
+ *        would exceed H5T_VLEN_BATCH_SIZE bytes.  The data for all
+ *        sequences in the batch is then read with a single call to the
+ *        VL class's 'read_multi' callback, so that each global heap
+ *        collection holding the data is only visited once per batch.
+ *
+ *        Because all the source descriptors are examined before any
+ *        destination element is written, the caller must take the
+ *        "nil" flag and length of each sequence from the batch instead
+ *        of the (possibly overwritten) source buffer.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_vlen_batch_fill(const H5T_t *src, size_t src_base_size, H5T_vlen_batch_t *batch, uint8_t *s,
+                          ssize_t s_stride, size_t nelmts)
+{
+    size_t total = 0;           /* Total bytes of data in the batch */
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(src);
+    HDassert(src->shared->u.vlen.cls->read_multi);
+    HDassert(batch);
+    HDassert(batch->nalloc > 0);
+    HDassert(s);
+    HDassert(nelmts > 0);
+
+    /* Examine the source sequences */
+    batch->nseq = 0;
+    batch->next = 0;
+    while (batch->nseq < MIN(nelmts, batch->nalloc)) {
+        size_t nbytes; /* Size of this sequence's data */
+
+        u = batch->nseq;
+
+        /* Check for "nil" source sequence */
+        if ((*(src->shared->u.vlen.cls->isnull))(src->shared->u.vlen.file, s, &batch->is_nil[u]) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check if VL data is 'nil'")
+        if (batch->is_nil[u])
+            batch->seq_len[u] = 0;
+        else if ((*(src->shared->u.vlen.cls->getlen))(src->shared->u.vlen.file, s, &batch->seq_len[u]) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "bad sequence length")
+        nbytes = batch->seq_len[u] * src_base_size;
+
+        /* Stop at the size limit, but always take at least one sequence */
+        if (u > 0 && (total + nbytes) > H5T_VLEN_BATCH_SIZE)
+            break;
+
+        batch->vl[u]  = s;
+        batch->len[u] = nbytes;
+        total += nbytes;
+        batch->nseq++;
+        s += s_stride;
+    } /* end while */
+
+    /* Make certain the data buffer is large enough */
+    if (total > batch->data_size) {
+        if (NULL == (batch->data = (uint8_t *)H5FL_BLK_REALLOC(vlen_seq, batch->data, total)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed for type conversion")
+        batch->data_size = total;
+    } /* end if */
+
+    /* Lay out the sequences' data in the buffer */
+    total = 0;
+    for (u = 0; u < batch->nseq; u++) {
+        batch->buf[u] = batch->len[u] > 0 ? batch->data + total : NULL;
+        total += batch->len[u];
+    } /* end for */
+
+    /* Read in the data for all the sequences */
+    if ((*(src->shared->u.vlen.cls->read_multi))(src->shared->u.vlen.file, batch->nseq, batch->vl, batch->buf,
+                                                 batch->len) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vlen_batch_fill() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_vlen
  *
@@ -3092,6 +3204,10 @@ done:
  *                6. Write dst VL data into dst heap
  *                7. Store (heap ID or pointer) and length in main dst buffer
  *
+ *        When reading from the file, the VL data for several elements
+ *        is read at once (see H5T__conv_vlen_batch_fill), instead of
+ *        one heap object at a time.
+ *
  * Return:    Non-negative on success/Negative on failure
  *
  * Programmer:    Quincey Koziol
@@ -3104,6 +3220,7 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
                size_t bkg_stride, void *buf, void *bkg)
 {
     H5T_vlen_alloc_info_t vl_alloc_info;              /* VL allocation info */
+    H5T_vlen_batch_t      batch;                      /* Batch of sequences read from the file */
     H5T_path_t *          tpath         = NULL;       /* Type conversion path             */
     hbool_t               noop_conv     = FALSE;      /* Flag to indicate a noop conversion */
     hbool_t               write_to_file = FALSE;      /* Flag to indicate writing to file */
@@ -3129,6 +3246,8 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
 
     FUNC_ENTER_PACKAGE
 
+    HDmemset(&batch, 0, sizeof(batch));
+
     switch (cdata->command) {
         case H5T_CONV_INIT:
             /*
@@ -3247,6 +3366,18 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
             if (write_to_file && parent_is_vlen && bkg != NULL)
                 nested = TRUE;
 
+            /* Read the sequences in batches when reading from the file */
+            if (!write_to_file && src->shared->u.vlen.cls->read_multi && nelmts > 1) {
+                batch.nalloc = MIN(nelmts, H5T_VLEN_BATCH_NELMTS);
+                if (NULL == (batch.is_nil = (hbool_t *)H5MM_malloc(batch.nalloc * sizeof(hbool_t))) ||
+                    NULL == (batch.seq_len = (size_t *)H5MM_malloc(batch.nalloc * sizeof(size_t))) ||
+                    NULL == (batch.vl = (const void **)H5MM_malloc(batch.nalloc * sizeof(void *))) ||
+                    NULL == (batch.buf = (void **)H5MM_malloc(batch.nalloc * sizeof(void *))) ||
+                    NULL == (batch.len = (size_t *)H5MM_malloc(batch.nalloc * sizeof(size_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                                "memory allocation failed for type conversion")
+            } /* end if */
+
             /* The outer loop of the type conversion macro, controlling which */
             /* direction the buffer is walked */
             while (nelmts > 0) {
@@ -3288,23 +3419,44 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
                     safe  = nelmts;
                 } /* end else */
 
+                /* Start a new batch for this pass */
+                batch.nseq = batch.next = 0;
+
                 for (elmtno = 0; elmtno < safe; elmtno++) {
-                    hbool_t is_nil; /* Whether sequence is "nil" */
+                    hbool_t is_nil;         /* Whether sequence is "nil" */
+                    size_t  seq_len = 0;    /* The number of elements in the current sequence */
+                    void *  seq_buf = NULL; /* Sequence data already read from the file */
+
+                    if (batch.nalloc > 0) {
+                        /* Read the next batch of sequences, if the current one is used up */
+                        if (batch.next == batch.nseq)
+                            if (H5T__conv_vlen_batch_fill(src, src_base_size, &batch, s, s_stride,
+                                                          safe - elmtno) < 0)
+                                HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
 
+                        /* Take this sequence from the batch */
+                        is_nil  = batch.is_nil[batch.next];
+                        seq_len = batch.seq_len[batch.next];
+                        seq_buf = batch.buf[batch.next];
+                        batch.next++;
+                    } /* end if */
                     /* Check for "nil" source sequence */
-                    if ((*(src->shared->u.vlen.cls->isnull))(src->shared->u.vlen.file, s, &is_nil) < 0)
+                    else if ((*(src->shared->u.vlen.cls->isnull))(src->shared->u.vlen.file, s, &is_nil) < 0)
                         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check if VL data is 'nil'")
-                    else if (is_nil) {
+
+                    if (is_nil) {
                         /* Write "nil" sequence to destination location */
                         if ((*(dst->shared->u.vlen.cls->setnull))(dst->shared->u.vlen.file, d, b) < 0)
                             HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't set VL data to 'nil'")
-                    } /* end else-if */
+                    } /* end if */
                     else {
-                        size_t seq_len; /* The number of elements in the current sequence */
+                        void *write_buf = NULL; /* Buffer to write the sequence from */
 
                         /* Get length of element sequences */
-                        if ((*(src->shared->u.vlen.cls->getlen))(src->shared->u.vlen.file, s, &seq_len) < 0)
-                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "bad sequence length")
+                        if (0 == batch.nalloc)
+                            if ((*(src->shared->u.vlen.cls->getlen))(src->shared->u.vlen.file, s, &seq_len) <
+                                0)
+                                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "bad sequence length")
 
                         /* If we are reading from memory and there is no conversion, just get the pointer to
                          * sequence */
@@ -3313,6 +3465,9 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
                             if (NULL == (conv_buf = (*(src->shared->u.vlen.cls->getptr))(s)))
                                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid source pointer")
                         } /* end if */
+                        /* If the sequence was read in a batch and there is no conversion, use it directly */
+                        else if (seq_buf && noop_conv && seq_len > 0)
+                            write_buf = seq_buf;
                         else {
                             size_t src_size, dst_size; /*source & destination total size in bytes*/
 
@@ -3338,11 +3493,17 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
                                 HDmemset(conv_buf, 0, conv_buf_size);
                             } /* end else-if */
 
-                            /* Read in VL sequence */
-                            if ((*(src->shared->u.vlen.cls->read))(src->shared->u.vlen.file, s, conv_buf,
-                                                                   src_size) < 0)
+                            /* Read in VL sequence, or copy it from the batch */
+                            if (batch.nalloc > 0) {
+                                if (src_size > 0)
+                                    H5MM_memcpy(conv_buf, seq_buf, src_size);
+                            } /* end if */
+                            else if ((*(src->shared->u.vlen.cls->read))(src->shared->u.vlen.file, s,
+                                                                        conv_buf, src_size) < 0)
                                 HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
                         } /* end else */
+                        if (!write_buf)
+                            write_buf = conv_buf;
 
                         if (!noop_conv) {
                             /* Check if temporary buffer is large enough, resize if necessary */
@@ -3399,7 +3560,7 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, si
 
                         /* Write sequence to destination location */
                         if ((*(dst->shared->u.vlen.cls->write))(dst->shared->u.vlen.file, &vl_alloc_info, d,
-                                                                conv_buf, b, seq_len, dst_base_size) < 0)
+                                                                write_buf, b, seq_len, dst_base_size) < 0)
                             HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
 
                         if (!noop_conv) {
@@ -3454,6 +3615,14 @@ done:
     /* Release the background buffer, if we have one */
     if (tmp_buf)
         tmp_buf = H5FL_BLK_FREE(vlen_seq, tmp_buf);
+    /* Release the batch of sequences read from the file */
+    if (batch.data)
+        batch.data = (uint8_t *)H5FL_BLK_FREE(vlen_seq, batch.data);
+    H5MM_xfree(batch.is_nil);
+    H5MM_xfree(batch.seq_len);
+    H5MM_xfree(batch.vl);
+    H5MM_xfree(batch.buf);
+    H5MM_xfree(batch.len);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_vlen() */
@@ -288,16 +288,19 @@ typedef herr_t (*H5T_vlen_read_func_t)(H5VL_object_t *file, void *_vl, void *buf
 typedef herr_t (*H5T_vlen_write_func_t)(H5VL_object_t *file, const H5T_vlen_alloc_info_t *vl_alloc_info,
                                         void *_vl, void *buf, void *_bg, size_t seq_len, size_t base_size);
 typedef herr_t (*H5T_vlen_delete_func_t)(H5VL_object_t *file, const void *_vl);
+typedef herr_t (*H5T_vlen_read_multi_func_t)(H5VL_object_t *file, size_t count, const void *_vl[], void *buf[],
+                                             const size_t len[]);
 
 /* VL datatype callbacks */
 typedef struct H5T_vlen_class_t {
-    H5T_vlen_getlen_func_t  getlen;  /* Function to get VL sequence size (in element units, not bytes) */
-    H5T_vlen_getptr_func_t  getptr;  /* Function to get VL sequence pointer */
-    H5T_vlen_isnull_func_t  isnull;  /* Function to check if VL value is NIL */
-    H5T_vlen_setnull_func_t setnull; /* Function to set a VL value to NIL */
-    H5T_vlen_read_func_t    read;    /* Function to read VL sequence into buffer */
-    H5T_vlen_write_func_t   write;   /* Function to write VL sequence from buffer */
-    H5T_vlen_delete_func_t  del;     /* Function to delete VL sequence */
+    H5T_vlen_getlen_func_t     getlen;     /* Function to get VL sequence size (in element units, not bytes) */
+    H5T_vlen_getptr_func_t     getptr;     /* Function to get VL sequence pointer */
+    H5T_vlen_isnull_func_t     isnull;     /* Function to check if VL value is NIL */
+    H5T_vlen_setnull_func_t    setnull;    /* Function to set a VL value to NIL */
+    H5T_vlen_read_func_t       read;       /* Function to read VL sequence into buffer */
+    H5T_vlen_write_func_t      write;      /* Function to write VL sequence from buffer */
+    H5T_vlen_delete_func_t     del;        /* Function to delete VL sequence */
+    H5T_vlen_read_multi_func_t read_multi; /* Function to read a batch of VL sequences into buffers */
 } H5T_vlen_class_t;
 
 /* A VL datatype */
@@ -35,6 +35,8 @@
 #include "H5Tpkg.h"      /* Datatypes            */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
 /****************/
 /* Local Macros */
 /****************/
@@ -77,6 +79,8 @@ static herr_t H5T__vlen_disk_read(H5VL_object_t *file, void *_vl, void *_buf, si
 static herr_t H5T__vlen_disk_write(H5VL_object_t *file, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl,
                                    void *_buf, void *_bg, size_t seq_len, size_t base_size);
 static herr_t H5T__vlen_disk_delete(H5VL_object_t *file, const void *_vl);
+static herr_t H5T__vlen_disk_read_multi(H5VL_object_t *file, size_t count, const void *_vl[], void *_buf[],
+                                        const size_t len[]);
 
 /*********************/
 /* Public Variables */
@@ -102,7 +106,8 @@ static const H5T_vlen_class_t H5T_vlen_mem_seq_g = {
     H5T__vlen_mem_seq_setnull, /* 'setnull' */
     H5T__vlen_mem_seq_read,    /* 'read' */
     H5T__vlen_mem_seq_write,   /* 'write' */
-    NULL                       /* 'delete' */
+    NULL,                      /* 'delete' */
+    NULL                       /* 'read_multi' */
 };
 
 /* Class for VL strings in memory */
@@ -113,18 +118,20 @@ static const H5T_vlen_class_t H5T_vlen_mem_str_g = {
     H5T__vlen_mem_str_setnull, /* 'setnull' */
     H5T__vlen_mem_str_read,    /* 'read' */
     H5T__vlen_mem_str_write,   /* 'write' */
-    NULL                       /* 'delete' */
+    NULL,                      /* 'delete' */
+    NULL                       /* 'read_multi' */
 };
 
 /* Class for both VL strings and sequences in file */
 static const H5T_vlen_class_t H5T_vlen_disk_g = {
-    H5T__vlen_disk_getlen,  /* 'getlen' */
-    NULL,                   /* 'getptr' */
-    H5T__vlen_disk_isnull,  /* 'isnull' */
-    H5T__vlen_disk_setnull, /* 'setnull' */
-    H5T__vlen_disk_read,    /* 'read' */
-    H5T__vlen_disk_write,   /* 'write' */
-    H5T__vlen_disk_delete   /* 'delete' */
+    H5T__vlen_disk_getlen,    /* 'getlen' */
+    NULL,                     /* 'getptr' */
+    H5T__vlen_disk_isnull,    /* 'isnull' */
+    H5T__vlen_disk_setnull,   /* 'setnull' */
+    H5T__vlen_disk_read,      /* 'read' */
+    H5T__vlen_disk_write,     /* 'write' */
+    H5T__vlen_disk_delete,    /* 'delete' */
+    H5T__vlen_disk_read_multi /* 'read_multi' */
 };
 
 /*-------------------------------------------------------------------------
@@ -928,6 +935,70 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__vlen_disk_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vlen_disk_read_multi
+ *
+ * Purpose:	Reads a batch of disk based VL elements into buffers.
+ *		Elements with a length of zero are skipped.  With the native
+ *		VOL connector, the elements are read from each global heap
+ *		collection in a single pass.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__vlen_disk_read_multi(H5VL_object_t *file, size_t count, const void *_vl[], void *_buf[],
+                          const size_t len[])
+{
+    const void **blob_id   = NULL;    /* Blob IDs of the elements */
+    hbool_t      is_native = FALSE;   /* Whether the file is using the native VOL connector */
+    size_t       u;                   /* Local index variable */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check parameters */
+    HDassert(file);
+    HDassert(_vl);
+    HDassert(_buf);
+    HDassert(len);
+
+    /* Check if using native VOL connector */
+    if (H5VL_object_is_native(file, &is_native) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't query if file uses native VOL connector")
+
+    if (is_native) {
+        H5F_t *f; /* Native file struct */
+
+        /* Retrieve file from VOL object */
+        if (NULL == (f = (H5F_t *)H5VL_object_data(file)))
+            HGOTO_ERROR(H5E_DATATYPE, H5E_BADTYPE, FAIL, "invalid VOL object")
+
+        /* Skip the length of each sequence */
+        if (NULL == (blob_id = (const void **)H5MM_malloc(count * sizeof(void *))))
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "memory allocation failed for blob IDs")
+        for (u = 0; u < count; u++)
+            blob_id[u] = (const uint8_t *)_vl[u] + 4;
+
+        /* Retrieve blobs */
+        if (H5VL_native_blob_get_multi(f, count, blob_id, _buf, len) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to get blobs")
+    } /* end if */
+    else
+        /* Retrieve blobs one at a time */
+        for (u = 0; u < count; u++)
+            if (len[u] > 0)
+                if (H5VL_blob_get(file, (const uint8_t *)_vl[u] + 4, _buf[u], len[u], NULL) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to get blob")
+
+done:
+    if (blob_id)
+        blob_id = (const void **)H5MM_xfree(blob_id);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__vlen_disk_read_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5T__vlen_disk_write
  *
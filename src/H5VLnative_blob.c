@@ -21,6 +21,7 @@
 #include "H5Eprivate.h"         /* Error handling                       */
 #include "H5Fprivate.h"         /* File access				*/
 #include "H5HGprivate.h"        /* Global Heaps				*/
+#include "H5MMprivate.h"        /* Memory management                    */
 #include "H5VLnative_private.h" /* Native VOL connector                 */
 
 /****************/
@@ -223,3 +224,59 @@ H5VL__native_blob_specific(void *obj, void *blob_id, H5VL_blob_specific_t specif
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VL__native_blob_specific() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL_native_blob_get_multi
+ *
+ * Purpose:     Retrieves a batch of blobs, reading each global heap
+ *              collection they are stored in only once.  Blobs with a
+ *              size of zero are skipped.
+ *
+ * Return:      SUCCEED / FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL_native_blob_get_multi(void *obj, size_t count, const void *blob_id[], void *buf[], const size_t size[])
+{
+    H5F_t *      f         = (H5F_t *)obj; /* Retrieve file pointer */
+    H5HG_read_t *objs      = NULL;         /* Heap objects to read */
+    size_t       nobjs     = 0;            /* Number of heap objects to read */
+    size_t       u;                        /* Local index variable */
+    herr_t       ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(blob_id);
+    HDassert(buf);
+    HDassert(size);
+
+    if (count > 0) {
+        if (NULL == (objs = (H5HG_read_t *)H5MM_malloc(count * sizeof(H5HG_read_t))))
+            HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "memory allocation failed for blob batch")
+
+        /* Get the heap information for each blob */
+        for (u = 0; u < count; u++)
+            if (size[u] > 0) {
+                const uint8_t *id = (const uint8_t *)blob_id[u]; /* Pointer to the disk blob ID */
+
+                H5F_addr_decode(f, &id, &objs[nobjs].hobj.addr);
+                UINT32DECODE(id, objs[nobjs].hobj.idx);
+                objs[nobjs].size = size[u];
+                objs[nobjs].buf  = buf[u];
+                nobjs++;
+            } /* end if */
+
+        /* Read the VL information from disk */
+        if (H5HG_read_multi(f, nobjs, objs) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_READERROR, FAIL, "unable to read VL information")
+    } /* end if */
+
+done:
+    if (objs)
+        objs = (H5HG_read_t *)H5MM_xfree(objs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL_native_blob_get_multi() */
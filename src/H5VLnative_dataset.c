@@ -587,6 +587,20 @@ H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type,
             break;
         }
 
+        /* H5Dread_mapped */
+        case H5VL_NATIVE_DATASET_READ_MAPPED: {
+            hid_t        mem_type_id = HDva_arg(arguments, hid_t);
+            const void **buf         = HDva_arg(arguments, const void **);
+            const H5T_t *mem_type;
+
+            if (NULL == (mem_type = (const H5T_t *)H5I_object_verify(mem_type_id, H5I_DATATYPE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+
+            if (H5D__contig_get_mapped(dset, mem_type, buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read mapped data")
+            break;
+        }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
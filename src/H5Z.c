@@ -50,6 +50,12 @@ typedef struct H5Z_object_t {
 #endif                  /* H5_HAVE_PARALLEL */
 } H5Z_object_t;
 
+/* Library filter that can use the pipeline's scratch buffer */
+typedef struct H5Z_scratch_filter_t {
+    const H5Z_class2_t *cls;  /* Class of the filter */
+    H5Z_scratch_func_t  func; /* Scratch buffer variant of the filter callback */
+} H5Z_scratch_filter_t;
+
 /* Enumerated type for dataset creation prelude callbacks */
 typedef enum {
     H5Z_PRELUDE_CAN_APPLY, /* Call "can apply" callback */
@@ -67,8 +73,37 @@ static H5Z_class2_t *H5Z_table_g       = NULL;
 static H5Z_stats_t *H5Z_stat_table_g = NULL;
 #endif /* H5Z_DEBUG */
 
+/* Scratch buffer kept by H5Z_pipeline() between calls, so that the library's
+ * filters don't allocate and free a chunk-sized buffer each time they run.
+ * (Calls into the library are serialized, so one buffer is enough.)
+ */
+static void * H5Z_scratch_g      = NULL;
+static size_t H5Z_scratch_size_g = 0;
+
+/* Largest scratch buffer kept between calls to H5Z_pipeline() */
+#define H5Z_SCRATCH_MAX_SIZE (16 * 1024 * 1024)
+
+/* Library filters with a scratch buffer variant of their callback */
+static const H5Z_scratch_filter_t H5Z_scratch_filters_g[] = {
+    {H5Z_SHUFFLE, H5Z__filter_shuffle_scratch},
+    {H5Z_FLETCHER32, H5Z__filter_fletcher32_scratch},
+    {H5Z_NBIT, H5Z__filter_nbit_scratch},
+    {H5Z_SCALEOFFSET, H5Z__filter_scaleoffset_scratch},
+    {H5Z_BLOCKED, H5Z__filter_blocked_scratch},
+#ifdef H5_HAVE_FILTER_DEFLATE
+    {H5Z_DEFLATE, H5Z__filter_deflate_scratch},
+#endif /* H5_HAVE_FILTER_DEFLATE */
+#ifdef H5_HAVE_FILTER_LZ4
+    {H5Z_LZ4, H5Z__filter_lz4_scratch},
+#endif /* H5_HAVE_FILTER_LZ4 */
+#ifdef H5_HAVE_FILTER_ZSTD
+    {H5Z_ZSTD, H5Z__filter_zstd_scratch},
+#endif /* H5_HAVE_FILTER_ZSTD */
+};
+
 /* Local functions */
-static int H5Z__find_idx(H5Z_filter_t id);
+static int                H5Z__find_idx(H5Z_filter_t id);
+static H5Z_scratch_func_t H5Z__find_scratch_func(const H5Z_class2_t *fclass);
 static int H5Z__check_unregister_dset_cb(void *obj_ptr, hid_t obj_id, void *key);
 static int H5Z__check_unregister_group_cb(void *obj_ptr, hid_t obj_id, void *key);
 static int H5Z__flush_file_cb(void *obj_ptr, hid_t obj_id, void *key);
@@ -97,6 +132,10 @@ H5Z__init_package(void)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register nbit filter")
     if (H5Z_register(H5Z_SCALEOFFSET) < 0)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register scaleoffset filter")
+    if (H5Z_register(H5Z_VLPACK) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register vlpack filter")
+    if (H5Z_register(H5Z_BLOCKED) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register blocked filter")
 
         /* External filters */
 #ifdef H5_HAVE_FILTER_DEFLATE
@@ -108,6 +147,14 @@ H5Z__init_package(void)
     if (H5Z_register(H5Z_SZIP) < 0)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register szip filter")
 #endif /* H5_HAVE_FILTER_SZIP */
+#ifdef H5_HAVE_FILTER_LZ4
+    if (H5Z_register(H5Z_LZ4) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register lz4 filter")
+#endif /* H5_HAVE_FILTER_LZ4 */
+#ifdef H5_HAVE_FILTER_ZSTD
+    if (H5Z_register(H5Z_ZSTD) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to register zstd filter")
+#endif /* H5_HAVE_FILTER_ZSTD */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -195,6 +242,21 @@ next:
             n++;
         } /* end if */
 
+        /* Free the pipeline's scratch buffer */
+        if (H5Z_scratch_g) {
+            H5Z_scratch_g      = H5MM_xfree(H5Z_scratch_g);
+            H5Z_scratch_size_g = 0;
+        } /* end if */
+
+#ifdef H5_HAVE_FILTER_DEFLATE
+        /* Free the deflate filter's streams */
+        H5Z__deflate_term();
+#endif /* H5_HAVE_FILTER_DEFLATE */
+#ifdef H5_HAVE_FILTER_ZSTD
+        /* Free the Zstandard filter's contexts */
+        H5Z__zstd_term();
+#endif /* H5_HAVE_FILTER_ZSTD */
+
         /* Mark interface as closed */
         if (0 == n)
             H5_PKG_INIT_VAR = FALSE;
@@ -998,7 +1060,8 @@ done:
  *      When the filters are optional (i.e., H5Z_FLAG_OPTIONAL is provided,)
  *      if any of the following conditions is met, the filters will be ignored:
  *          - dataspace is either H5S_NULL or H5S_SCALAR
- *          - datatype is variable-length (string or non-string)
+ *          - datatype is variable-length (string or non-string), unless
+ *            the first filter packs the variable-length data
  *      However, if any of these conditions exists and a filter is not
  *      optional, the function will produce an error.
  *
@@ -1031,8 +1094,11 @@ H5Z_ignore_filters(hid_t dcpl_id, const H5T_t *type, const H5S_t *space)
     type_class  = H5T_get_class(type, FALSE);
 
     /* These conditions are not suitable for filters */
-    bad_for_filters = (H5S_NULL == space_class || H5S_SCALAR == space_class || H5T_VLEN == type_class ||
-                       (H5T_STRING == type_class && TRUE == H5T_is_variable_str(type)));
+    /* (Variable-length data is, once packed into the chunks) */
+    bad_for_filters =
+        (H5S_NULL == space_class || H5S_SCALAR == space_class ||
+         ((H5T_VLEN == type_class || (H5T_STRING == type_class && TRUE == H5T_is_variable_str(type))) &&
+          !(pline.nused > 0 && H5Z_FILTER_VLPACK == pline.filter[0].id)));
 
     /* When these conditions occur, if there are required filters in pline,
        then report a failure, otherwise, set flag that they can be ignored */
@@ -1289,6 +1355,11 @@ done:
  *           then the pipeline function should free the original buffer
  *           and return a fresh buffer, adjusting BUF_SIZE accordingly.
  *
+ *           The library's own filters instead write their output to a
+ *           scratch buffer and exchange it with BUF, so the data moves
+ *           back and forth between two buffers.  The scratch buffer is
+ *           kept for the next call, and on return BUF may point to it.
+ *
  * Return:   Non-negative on success
  *           Negative on failure
  *-------------------------------------------------------------------------
@@ -1298,10 +1369,13 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
              H5Z_cb_t cb_struct, size_t *nbytes /*in,out*/, size_t *buf_size /*in,out*/,
              void **buf /*in,out*/)
 {
-    size_t        idx;
-    size_t        new_nbytes;
-    int           fclass_idx;    /* Index of filter class in global table */
-    H5Z_class2_t *fclass = NULL; /* Filter class pointer */
+    size_t             idx;
+    size_t             new_nbytes;
+    int                fclass_idx;          /* Index of filter class in global table */
+    H5Z_class2_t *     fclass       = NULL; /* Filter class pointer */
+    H5Z_scratch_func_t scratch_func = NULL; /* Scratch buffer variant of filter callback */
+    void *             scratch      = NULL; /* Scratch buffer for the library's filters */
+    size_t             scratch_size = 0;    /* Size of scratch buffer */
 #ifdef H5Z_DEBUG
     H5Z_stats_t * fstats = NULL; /* Filter stats pointer */
     H5_timer_t    timer;         /* Timer for filter operations */
@@ -1321,6 +1395,12 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
     HDassert(buf && *buf);
     HDassert(!pline || pline->nused < H5Z_MAX_NFILTERS);
 
+    /* Take over the scratch buffer left by the last call */
+    scratch            = H5Z_scratch_g;
+    scratch_size       = H5Z_scratch_size_g;
+    H5Z_scratch_g      = NULL;
+    H5Z_scratch_size_g = 0;
+
 #ifdef H5Z_DEBUG
     H5_timer_init(&timer);
 #endif
@@ -1378,8 +1458,13 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
 
             tmp_flags = flags | (pline->filter[idx].flags);
             tmp_flags |= (edc_read == H5Z_DISABLE_EDC) ? H5Z_FLAG_SKIP_EDC : 0;
-            new_nbytes = (fclass->filter)(tmp_flags, pline->filter[idx].cd_nelmts,
-                                          pline->filter[idx].cd_values, *nbytes, buf_size, buf);
+            if (NULL != (scratch_func = H5Z__find_scratch_func(fclass)))
+                new_nbytes = (scratch_func)(tmp_flags, pline->filter[idx].cd_nelmts,
+                                            pline->filter[idx].cd_values, *nbytes, buf_size, buf,
+                                            &scratch_size, &scratch);
+            else
+                new_nbytes = (fclass->filter)(tmp_flags, pline->filter[idx].cd_nelmts,
+                                              pline->filter[idx].cd_values, *nbytes, buf_size, buf);
 
 #ifdef H5Z_DEBUG
             H5_timer_stop(&timer);
@@ -1429,8 +1514,14 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
             H5_timer_start(&timer);
 #endif
 
-            new_nbytes = (fclass->filter)(flags | (pline->filter[idx].flags), pline->filter[idx].cd_nelmts,
-                                          pline->filter[idx].cd_values, *nbytes, buf_size, buf);
+            if (NULL != (scratch_func = H5Z__find_scratch_func(fclass)))
+                new_nbytes = (scratch_func)(flags | (pline->filter[idx].flags), pline->filter[idx].cd_nelmts,
+                                            pline->filter[idx].cd_values, *nbytes, buf_size, buf,
+                                            &scratch_size, &scratch);
+            else
+                new_nbytes = (fclass->filter)(flags | (pline->filter[idx].flags),
+                                              pline->filter[idx].cd_nelmts, pline->filter[idx].cd_values,
+                                              *nbytes, buf_size, buf);
 
 #ifdef H5Z_DEBUG
             H5_timer_stop(&timer);
@@ -1464,9 +1555,141 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags, unsigned *filter_mask /*i
     *filter_mask = failed;
 
 done:
+    /* Keep the scratch buffer for the next call, unless it's too large */
+    if (scratch) {
+        if (NULL == H5Z_scratch_g && scratch_size <= H5Z_SCRATCH_MAX_SIZE) {
+            H5Z_scratch_g      = scratch;
+            H5Z_scratch_size_g = scratch_size;
+        } /* end if */
+        else
+            H5MM_xfree(scratch);
+    } /* end if */
+
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function: H5Z__find_scratch_func
+ *
+ * Purpose:  Look up the scratch buffer variant of a filter's callback.
+ *           Only the library's own filters have one, and only while
+ *           they haven't been replaced by an application's filter with
+ *           the same ID.
+ *
+ * Return:   Pointer to callback, or NULL if the filter doesn't have one
+ *-------------------------------------------------------------------------
+ */
+static H5Z_scratch_func_t
+H5Z__find_scratch_func(const H5Z_class2_t *fclass)
+{
+    size_t             u;                /* Local index variable */
+    H5Z_scratch_func_t ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(fclass);
+
+    for (u = 0; u < NELMTS(H5Z_scratch_filters_g); u++)
+        if (fclass->filter == H5Z_scratch_filters_g[u].cls->filter) {
+            ret_value = H5Z_scratch_filters_g[u].func;
+            break;
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__find_scratch_func() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z__scratch_reserve
+ *
+ * Purpose:  Make sure a filter's scratch buffer holds at least NBYTES
+ *           bytes.  The contents of the buffer aren't preserved.
+ *
+ * Return:   Non-negative on success
+ *           Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Z__scratch_reserve(size_t nbytes, size_t *scratch_size, void **scratch)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(scratch_size);
+    HDassert(scratch);
+
+    if (*scratch_size < nbytes || NULL == *scratch) {
+        *scratch      = H5MM_xfree(*scratch);
+        *scratch_size = 0;
+        if (NULL == (*scratch = H5MM_malloc(nbytes)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for filter scratch buffer")
+        *scratch_size = nbytes;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__scratch_reserve() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z__scratch_swap
+ *
+ * Purpose:  Exchange a filter's data buffer with its scratch buffer,
+ *           once the filter's output has been written to the scratch
+ *           buffer.
+ *
+ * Return:   void
+ *-------------------------------------------------------------------------
+ */
+void
+H5Z__scratch_swap(size_t *buf_size, void **buf, size_t *scratch_size, void **scratch)
+{
+    void * tmp_buf;  /* Temporary buffer pointer */
+    size_t tmp_size; /* Temporary buffer size */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    tmp_buf       = *buf;
+    tmp_size      = *buf_size;
+    *buf          = *scratch;
+    *buf_size     = *scratch_size;
+    *scratch      = tmp_buf;
+    *scratch_size = tmp_size;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__scratch_swap() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5Z__filter_with_scratch
+ *
+ * Purpose:  Run the scratch buffer variant of a filter with a scratch
+ *           buffer of its own, for use as the filter's H5Z_func_t
+ *           callback.  Behaves like a filter that frees its input and
+ *           returns a fresh buffer.
+ *
+ * Return:   Success: Size of buffer filtered
+ *           Failure: 0
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5Z__filter_with_scratch(H5Z_scratch_func_t func, unsigned flags, size_t cd_nelmts,
+                         const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf)
+{
+    void * scratch      = NULL; /* Scratch buffer */
+    size_t scratch_size = 0;    /* Size of scratch buffer */
+    size_t ret_value    = 0;    /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(func);
+
+    ret_value = (func)(flags, cd_nelmts, cd_values, nbytes, buf_size, buf, &scratch_size, &scratch);
+
+    /* Release the scratch buffer, which holds the input if the filter swapped buffers */
+    H5MM_xfree(scratch);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_with_scratch() */
+
 /*-------------------------------------------------------------------------
  * Function: H5Z_filter_info
  *
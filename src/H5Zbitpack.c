@@ -0,0 +1,273 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Bit packing shared by the N-bit and scale-offset filters.
+ *
+ *          Both filters store a field of PRECISION bits from each element
+ *          of a fixed-size integer or floating-point type, the field
+ *          starting OFFSET bits above the least significant bit.  The
+ *          fields are written one after the other, most significant bit
+ *          first, with no padding between elements.  The filters used to
+ *          do this a bit field of a byte at a time; these routines work on
+ *          whole elements, loading a block of them into 64-bit words in a
+ *          loop the compiler can vectorize and then moving the words
+ *          through a 64-bit bit buffer 32 bits at a time.
+ */
+
+#include "H5Zmodule.h" /* This source code file is part of the H5Z module */
+
+#include "H5private.h"  /* Generic Functions			*/
+#include "H5Eprivate.h" /* Error handling		  	*/
+#include "H5Zpkg.h"     /* Data filters				*/
+
+/* Number of elements loaded into words at once */
+#define H5Z_BITPACK_BLOCK 256
+
+/* Load a block of elements of SIZE bytes into words */
+#define H5Z_BITPACK_LOAD(SIZE)                                                                               \
+    {                                                                                                        \
+        if (big_endian)                                                                                      \
+            for (u = 0; u < n; u++) {                                                                        \
+                const uint8_t *e = data + u * (SIZE);                                                        \
+                uint64_t       x = 0;                                                                        \
+                unsigned       b;                                                                            \
+                                                                                                             \
+                for (b = 0; b < (SIZE); b++)                                                                 \
+                    x = (x << 8) | e[b];                                                                     \
+                words[u] = (x >> offset) & mask;                                                             \
+            } /* end for */                                                                                  \
+        else                                                                                                 \
+            for (u = 0; u < n; u++) {                                                                        \
+                const uint8_t *e = data + u * (SIZE);                                                        \
+                uint64_t       x = 0;                                                                        \
+                unsigned       b;                                                                            \
+                                                                                                             \
+                for (b = (SIZE); b > 0; b--)                                                                 \
+                    x = (x << 8) | e[b - 1];                                                                 \
+                words[u] = (x >> offset) & mask;                                                             \
+            } /* end for */                                                                                  \
+    }
+
+/* Store a block of words into elements of SIZE bytes */
+#define H5Z_BITPACK_STORE(SIZE)                                                                              \
+    {                                                                                                        \
+        if (big_endian)                                                                                      \
+            for (u = 0; u < n; u++) {                                                                        \
+                uint8_t *e = data + u * (SIZE);                                                              \
+                uint64_t x = words[u] << offset;                                                             \
+                unsigned b;                                                                                  \
+                                                                                                             \
+                for (b = (SIZE); b > 0; b--, x >>= 8)                                                        \
+                    e[b - 1] = (uint8_t)x;                                                                   \
+            } /* end for */                                                                                  \
+        else                                                                                                 \
+            for (u = 0; u < n; u++) {                                                                        \
+                uint8_t *e = data + u * (SIZE);                                                              \
+                uint64_t x = words[u] << offset;                                                             \
+                unsigned b;                                                                                  \
+                                                                                                             \
+                for (b = 0; b < (SIZE); b++, x >>= 8)                                                        \
+                    e[b] = (uint8_t)x;                                                                       \
+            } /* end for */                                                                                  \
+    }
+
+/* Append the low NBITS (at most 32) bits of V to the bit buffer, writing
+ * out each 32 bits as they fill up
+ */
+#define H5Z_BITPACK_PUT(V, NBITS)                                                                            \
+    {                                                                                                        \
+        acc = (acc << (NBITS)) | (V);                                                                        \
+        nacc += (NBITS);                                                                                     \
+        if (nacc >= 32) {                                                                                    \
+            uint32_t w_;                                                                                     \
+                                                                                                             \
+            nacc -= 32;                                                                                      \
+            w_    = (uint32_t)(acc >> nacc);                                                                 \
+            out[0] = (uint8_t)(w_ >> 24);                                                                    \
+            out[1] = (uint8_t)(w_ >> 16);                                                                    \
+            out[2] = (uint8_t)(w_ >> 8);                                                                     \
+            out[3] = (uint8_t)w_;                                                                            \
+            out += 4;                                                                                        \
+        } /* end if */                                                                                       \
+    }
+
+/* Take the next NBITS (at most 32) bits from the bit buffer into V,
+ * refilling it 32 bits at a time while there are that many left in the
+ * input.  Bits past the end of the input read as zero.
+ */
+#define H5Z_BITPACK_GET(V, NBITS)                                                                            \
+    {                                                                                                        \
+        if (nacc < (NBITS)) {                                                                                \
+            if ((size_t)(in_end - in) >= 4) {                                                                \
+                acc = (acc << 32) | ((uint64_t)in[0] << 24) | ((uint64_t)in[1] << 16) |                     \
+                      ((uint64_t)in[2] << 8) | (uint64_t)in[3];                                             \
+                in += 4;                                                                                     \
+                nacc += 32;                                                                                  \
+            } /* end if */                                                                                   \
+            else                                                                                             \
+                while (nacc < (NBITS)) {                                                                     \
+                    acc = (acc << 8) | (in < in_end ? *in++ : 0);                                            \
+                    nacc += 8;                                                                               \
+                } /* end while */                                                                            \
+        } /* end if */                                                                                       \
+        nacc -= (NBITS);                                                                                     \
+        (V) = (acc >> nacc) & ((((uint64_t)1) << (NBITS)) - 1);                                              \
+    }
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__bitpack_encode
+ *
+ * Purpose:	Pack the PRECISION-bit field at OFFSET of each of NELMTS
+ *              elements of SIZE bytes into OUT.  OUT must have room for
+ *              NELMTS * PRECISION / 8 + 1 bytes.
+ *
+ * Return:	Number of bytes written to OUT, which is one more than
+ *              the number of whole bytes the fields fill.  Any bits left
+ *              over in the last byte are zero.
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5Z__bitpack_encode(const uint8_t *data, size_t nelmts, unsigned size, hbool_t big_endian, unsigned precision,
+                    unsigned offset, uint8_t *out)
+{
+    uint64_t words[H5Z_BITPACK_BLOCK]; /* Block of fields */
+    uint64_t mask;                     /* Mask for the fields */
+    uint64_t acc       = 0;            /* Bit buffer */
+    unsigned nacc      = 0;            /* Number of bits in the bit buffer */
+    uint8_t *out_start = out;          /* Start of the output */
+    size_t   ret_value = 0;            /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(size > 0 && size <= H5Z_BITPACK_MAX_SIZE);
+    HDassert(precision > 0 && precision + offset <= size * 8);
+
+    mask = (precision < 64) ? ((((uint64_t)1) << precision) - 1) : ~((uint64_t)0);
+
+    while (nelmts > 0) {
+        size_t n = MIN(nelmts, H5Z_BITPACK_BLOCK); /* Number of elements in this block */
+        size_t u;                                  /* Local index variable */
+
+        /* Extract the fields, with the element size fixed so the loop unrolls */
+        switch (size) {
+            case 1:
+                H5Z_BITPACK_LOAD(1)
+                break;
+            case 2:
+                H5Z_BITPACK_LOAD(2)
+                break;
+            case 4:
+                H5Z_BITPACK_LOAD(4)
+                break;
+            case 8:
+                H5Z_BITPACK_LOAD(8)
+                break;
+            default:
+                H5Z_BITPACK_LOAD(size)
+                break;
+        } /* end switch */
+
+        /* Pack them */
+        if (precision <= 32)
+            for (u = 0; u < n; u++)
+                H5Z_BITPACK_PUT(words[u], precision)
+        else
+            for (u = 0; u < n; u++) {
+                H5Z_BITPACK_PUT(words[u] >> 32, precision - 32)
+                H5Z_BITPACK_PUT(words[u] & 0xffffffff, 32)
+            } /* end for */
+
+        data += n * size;
+        nelmts -= n;
+    } /* end while */
+
+    /* Write out what's left, followed by the final, partly-filled byte */
+    while (nacc >= 8) {
+        nacc -= 8;
+        *out++ = (uint8_t)(acc >> nacc);
+    } /* end while */
+    *out++ = (uint8_t)((acc << (8 - nacc)) & 0xff);
+
+    ret_value = (size_t)(out - out_start);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__bitpack_encode() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__bitpack_decode
+ *
+ * Purpose:	Unpack NELMTS PRECISION-bit fields from the IN_SIZE bytes at
+ *              IN into the field at OFFSET of elements of SIZE bytes,
+ *              setting the other bits of the elements to zero.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5Z__bitpack_decode(const uint8_t *in, size_t in_size, size_t nelmts, unsigned size, hbool_t big_endian,
+                    unsigned precision, unsigned offset, uint8_t *data)
+{
+    uint64_t       words[H5Z_BITPACK_BLOCK]; /* Block of fields */
+    const uint8_t *in_end = in + in_size;    /* End of the input */
+    uint64_t       acc    = 0;               /* Bit buffer */
+    unsigned       nacc   = 0;               /* Number of bits in the bit buffer */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(size > 0 && size <= H5Z_BITPACK_MAX_SIZE);
+    HDassert(precision > 0 && precision + offset <= size * 8);
+
+    while (nelmts > 0) {
+        size_t n = MIN(nelmts, H5Z_BITPACK_BLOCK); /* Number of elements in this block */
+        size_t u;                                  /* Local index variable */
+
+        /* Unpack the fields */
+        if (precision <= 32)
+            for (u = 0; u < n; u++)
+                H5Z_BITPACK_GET(words[u], precision)
+        else
+            for (u = 0; u < n; u++) {
+                uint64_t hi, lo; /* Halves of the field */
+
+                H5Z_BITPACK_GET(hi, precision - 32)
+                H5Z_BITPACK_GET(lo, 32)
+                words[u] = (hi << 32) | lo;
+            } /* end for */
+
+        /* Place them in the elements, with the element size fixed so the loop unrolls */
+        switch (size) {
+            case 1:
+                H5Z_BITPACK_STORE(1)
+                break;
+            case 2:
+                H5Z_BITPACK_STORE(2)
+                break;
+            case 4:
+                H5Z_BITPACK_STORE(4)
+                break;
+            case 8:
+                H5Z_BITPACK_STORE(8)
+                break;
+            default:
+                H5Z_BITPACK_STORE(size)
+                break;
+        } /* end switch */
+
+        data += n * size;
+        nelmts -= n;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__bitpack_decode() */
@@ -0,0 +1,487 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The blocked compression filter.  Each chunk is split into blocks
+ *          of a fixed size which are compressed separately, with deflate,
+ *          LZ4 or Zstandard, so that the blocks of a single chunk can be
+ *          compressed and uncompressed by several threads at once (see
+ *          H5Pset_filter_threads).
+ *
+ *          The client data values are the filter ID of the compression
+ *          method, the compression level and the block size.  The output
+ *          starts with the size of the uncompressed data as a big-endian
+ *          64-bit value and the block size as a big-endian 32-bit value,
+ *          followed by the compressed size of each block as a big-endian
+ *          32-bit value, and then the compressed blocks.  A block that
+ *          doesn't get smaller is stored as is, and its compressed size is
+ *          its uncompressed size.
+ */
+
+#include "H5Zmodule.h" /* This source code file is part of the H5Z module */
+
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5CXprivate.h" /* API Contexts                         */
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5MMprivate.h" /* Memory management			*/
+#include "H5TSprivate.h" /* Threads                              */
+#include "H5Zpkg.h"      /* Data filters				*/
+
+#ifdef H5_HAVE_FILTER_DEFLATE
+#if defined(H5_HAVE_ZLIB_H) && !defined(H5_ZLIB_HEADER)
+#define H5_ZLIB_HEADER "zlib.h"
+#endif
+#if defined(H5_ZLIB_HEADER)
+#include H5_ZLIB_HEADER /* "zlib.h" */
+#endif
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
+#if defined(H5_HAVE_FILTER_LZ4) && defined(H5_HAVE_LZ4_H)
+#include "lz4.h"
+#endif
+
+#if defined(H5_HAVE_FILTER_ZSTD) && defined(H5_HAVE_ZSTD_H)
+#include "zstd.h"
+#endif
+
+/* Size of the header at the start of the filter's output */
+#define H5Z_BLOCKED_HDR_SIZE (8 + 4)
+
+/* Size of each block's entry in the header */
+#define H5Z_BLOCKED_BLOCK_HDR_SIZE 4
+
+/* Encode and decode the big-endian 32-bit values in the filter's output */
+#define H5Z_BLOCKED_ENCODE_32(P, V)                                                                          \
+    {                                                                                                        \
+        *(P)++ = (uint8_t)(((V) >> 24) & 0xff);                                                              \
+        *(P)++ = (uint8_t)(((V) >> 16) & 0xff);                                                              \
+        *(P)++ = (uint8_t)(((V) >> 8) & 0xff);                                                               \
+        *(P)++ = (uint8_t)((V)&0xff);                                                                        \
+    }
+#define H5Z_BLOCKED_DECODE_32(P, V)                                                                          \
+    {                                                                                                        \
+        (V) = ((uint32_t)(P)[0] << 24) | ((uint32_t)(P)[1] << 16) | ((uint32_t)(P)[2] << 8) |                \
+              (uint32_t)(P)[3];                                                                              \
+        (P) += 4;                                                                                            \
+    }
+
+/* Location of a block in the compressed data */
+typedef struct H5Z_blocked_block_t {
+    size_t offset; /* Offset of the compressed block */
+    size_t size;   /* Size of the compressed block */
+} H5Z_blocked_block_t;
+
+/* The work shared by the tasks that compress or uncompress the blocks of a
+ * chunk.  When compressing, block N is written at N * BLOCK_SIZE in DST,
+ * where it has as much space as its uncompressed size, and its compressed
+ * size is returned in BLOCKS.  When uncompressing, BLOCKS gives the
+ * location of each compressed block in SRC.
+ */
+typedef struct H5Z_blocked_work_t {
+    H5Z_filter_t         codec;      /* Compression method */
+    int                  level;      /* Compression level */
+    const uint8_t *      src;        /* Input */
+    uint8_t *            dst;        /* Output */
+    size_t               nbytes;     /* Size of the uncompressed data */
+    size_t               block_size; /* Size of an uncompressed block */
+    H5Z_blocked_block_t *blocks;     /* Compressed blocks */
+} H5Z_blocked_work_t;
+
+/* Local function prototypes */
+static size_t  H5Z__filter_blocked(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+                                   size_t nbytes, size_t *buf_size, void **buf);
+static hbool_t H5Z__blocked_codec_avail(H5Z_filter_t codec);
+static herr_t  H5Z__blocked_compress_task(size_t task, void *udata);
+static herr_t  H5Z__blocked_uncompress_task(size_t task, void *udata);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_BLOCKED[1] = {{
+    H5Z_CLASS_T_VERS,    /* H5Z_class_t version */
+    H5Z_FILTER_BLOCKED,  /* Filter id number		*/
+    1,                   /* encoder_present flag (set to true) */
+    1,                   /* decoder_present flag (set to true) */
+    "blocked",           /* Filter name for debugging	*/
+    NULL,                /* The "can apply" callback     */
+    NULL,                /* The "set local" callback     */
+    H5Z__filter_blocked, /* The actual filter function	*/
+}};
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__blocked_codec_avail
+ *
+ * Purpose:	Check whether the library was built with a compression
+ *              method for the blocked filter.
+ *
+ * Return:	TRUE if the method is available, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5Z__blocked_codec_avail(H5Z_filter_t codec)
+{
+    hbool_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (codec) {
+#ifdef H5_HAVE_FILTER_DEFLATE
+        case H5Z_FILTER_DEFLATE:
+#endif /* H5_HAVE_FILTER_DEFLATE */
+#ifdef H5_HAVE_FILTER_LZ4
+        case H5Z_FILTER_LZ4:
+#endif /* H5_HAVE_FILTER_LZ4 */
+#ifdef H5_HAVE_FILTER_ZSTD
+        case H5Z_FILTER_ZSTD:
+#endif /* H5_HAVE_FILTER_ZSTD */
+#if defined(H5_HAVE_FILTER_DEFLATE) || defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD)
+            ret_value = TRUE;
+            break;
+#endif
+
+        default:
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__blocked_codec_avail() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__blocked_compress_task
+ *
+ * Purpose:	Worker task that compresses one block.  Runs on a worker
+ *              thread and so must not call into the library.  A block
+ *              that can't be compressed into fewer bytes, for whatever
+ *              reason, is stored as is.
+ *
+ * Return:	SUCCEED
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__blocked_compress_task(size_t task, void *udata)
+{
+    H5Z_blocked_work_t *work = (H5Z_blocked_work_t *)udata; /* Work shared by the tasks */
+    size_t              offset;                              /* Offset of the block */
+    size_t              len;                                 /* Size of the block */
+    size_t              comp_size;                           /* Compressed size of the block */
+    const uint8_t *     src;                                 /* The block */
+    uint8_t *           dst;                                 /* Where to compress it */
+
+    offset    = task * work->block_size;
+    len       = MIN(work->block_size, work->nbytes - offset);
+    comp_size = len;
+    src       = work->src + offset;
+    dst       = work->dst + offset;
+
+    switch (work->codec) {
+#ifdef H5_HAVE_FILTER_DEFLATE
+        case H5Z_FILTER_DEFLATE: {
+            uLongf z_dst_len = (uLongf)len;
+
+            if (Z_OK == compress2((Bytef *)dst, &z_dst_len, (const Bytef *)src, (uLong)len, work->level))
+                comp_size = (size_t)z_dst_len;
+        } break;
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
+#ifdef H5_HAVE_FILTER_LZ4
+        case H5Z_FILTER_LZ4: {
+            int lz4_size = LZ4_compress_default((const char *)src, (char *)dst, (int)len, (int)len);
+
+            if (lz4_size > 0)
+                comp_size = (size_t)lz4_size;
+        } break;
+#endif /* H5_HAVE_FILTER_LZ4 */
+
+#ifdef H5_HAVE_FILTER_ZSTD
+        case H5Z_FILTER_ZSTD: {
+            size_t zstd_size = ZSTD_compress(dst, len, src, len, work->level);
+
+            if (!ZSTD_isError(zstd_size))
+                comp_size = zstd_size;
+        } break;
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+        default:
+            break;
+    } /* end switch */
+
+    /* Store blocks that don't get smaller as is */
+    if (comp_size >= len) {
+        HDmemcpy(dst, src, len);
+        comp_size = len;
+    } /* end if */
+
+    work->blocks[task].size = comp_size;
+
+    return SUCCEED;
+} /* end H5Z__blocked_compress_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__blocked_uncompress_task
+ *
+ * Purpose:	Worker task that uncompresses one block.  Runs on a worker
+ *              thread and so must not call into the library.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__blocked_uncompress_task(size_t task, void *udata)
+{
+    H5Z_blocked_work_t *work      = (H5Z_blocked_work_t *)udata; /* Work shared by the tasks */
+    size_t              offset;                                   /* Offset of the block */
+    size_t              len;                                      /* Size of the block */
+    size_t              comp_size;                                /* Compressed size of the block */
+    const uint8_t *     src;                                      /* The compressed block */
+    uint8_t *           dst;                                      /* Where to uncompress it */
+    herr_t              ret_value = FAIL;                         /* Return value */
+
+    offset    = task * work->block_size;
+    len       = MIN(work->block_size, work->nbytes - offset);
+    comp_size = work->blocks[task].size;
+    src       = work->src + work->blocks[task].offset;
+    dst       = work->dst + offset;
+
+    /* Blocks that didn't compress are stored as is */
+    if (comp_size == len) {
+        HDmemcpy(dst, src, len);
+        return SUCCEED;
+    } /* end if */
+
+    switch (work->codec) {
+#ifdef H5_HAVE_FILTER_DEFLATE
+        case H5Z_FILTER_DEFLATE: {
+            uLongf z_dst_len = (uLongf)len;
+
+            if (Z_OK == uncompress((Bytef *)dst, &z_dst_len, (const Bytef *)src, (uLong)comp_size) &&
+                (size_t)z_dst_len == len)
+                ret_value = SUCCEED;
+        } break;
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
+#ifdef H5_HAVE_FILTER_LZ4
+        case H5Z_FILTER_LZ4:
+            if (LZ4_decompress_safe((const char *)src, (char *)dst, (int)comp_size, (int)len) == (int)len)
+                ret_value = SUCCEED;
+            break;
+#endif /* H5_HAVE_FILTER_LZ4 */
+
+#ifdef H5_HAVE_FILTER_ZSTD
+        case H5Z_FILTER_ZSTD: {
+            size_t zstd_size = ZSTD_decompress(dst, len, src, comp_size);
+
+            if (!ZSTD_isError(zstd_size) && zstd_size == len)
+                ret_value = SUCCEED;
+        } break;
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+        default:
+            break;
+    } /* end switch */
+
+    return ret_value;
+} /* end H5Z__blocked_uncompress_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_blocked
+ *
+ * Purpose:	Implement an I/O filter that splits the data into blocks
+ *              which are compressed separately
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__filter_blocked(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                    size_t *buf_size, void **buf)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    ret_value = H5Z__filter_with_scratch(H5Z__filter_blocked_scratch, flags, cd_nelmts, cd_values, nbytes,
+                                         buf_size, buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_blocked() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_blocked_scratch
+ *
+ * Purpose:	Blocked compression filter, writing the [un]compressed data
+ *              to the pipeline's scratch buffer, which is then exchanged
+ *              with the input buffer.  When there is more than one block,
+ *              they are [un]compressed by as many threads as the dataset
+ *              transfer property list allows.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5Z__filter_blocked_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                            size_t *buf_size, void **buf, size_t *scratch_size, void **scratch)
+{
+    H5Z_blocked_work_t work;          /* Work shared by the tasks */
+    size_t             nblocks;       /* Number of blocks */
+    unsigned           nthreads  = 1; /* Number of threads to use */
+    const uint8_t *    src;           /* Pointer into the input */
+    uint8_t *          dst;           /* Pointer into the output */
+    size_t             u;             /* Local index variable */
+    size_t             ret_value = 0; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(*buf_size > 0);
+    HDassert(buf);
+    HDassert(*buf);
+
+    work.blocks = NULL;
+
+    /* Get the compression method */
+    if (cd_nelmts < H5Z_BLOCKED_USER_NPARMS)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "not enough parameters for blocked filter")
+    work.codec = (H5Z_filter_t)cd_values[H5Z_BLOCKED_PARM_CODEC];
+    work.level = (int)cd_values[H5Z_BLOCKED_PARM_LEVEL];
+    if (!H5Z__blocked_codec_avail(work.codec))
+        HGOTO_ERROR(H5E_PLINE, H5E_UNSUPPORTED, 0, "blocked filter's compression method %d is not available",
+                    (int)work.codec)
+
+    src = (const uint8_t *)*buf;
+
+    if (flags & H5Z_FLAG_REVERSE) {
+        /* Input; uncompress */
+        uint64_t orig_size;      /* Size of the uncompressed data */
+        uint32_t enc_block_size; /* Block size, as stored */
+        size_t   offset;         /* Offset of a compressed block */
+
+        /* Decode the header */
+        if (nbytes < H5Z_BLOCKED_HDR_SIZE)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "blocked data is too short")
+        orig_size = 0;
+        for (u = 0; u < 8; u++)
+            orig_size = (orig_size << 8) | (uint64_t)*src++;
+        H5Z_BLOCKED_DECODE_32(src, enc_block_size)
+        if (orig_size != (uint64_t)(size_t)orig_size || (orig_size > 0 && 0 == enc_block_size) ||
+            enc_block_size > H5Z_BLOCKED_MAX_BLOCK_SIZE)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "invalid blocked filter header")
+        work.nbytes     = (size_t)orig_size;
+        work.block_size = (size_t)enc_block_size;
+        nblocks         = (work.nbytes > 0) ? ((work.nbytes - 1) / work.block_size) + 1 : 0;
+        if ((nbytes - H5Z_BLOCKED_HDR_SIZE) / H5Z_BLOCKED_BLOCK_HDR_SIZE < nblocks)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "blocked data is truncated")
+
+        /* Locate the blocks */
+        if (NULL == (work.blocks = (H5Z_blocked_block_t *)H5MM_malloc(MAX(nblocks, 1) *
+                                                                       sizeof(H5Z_blocked_block_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for blocked filter")
+        offset = H5Z_BLOCKED_HDR_SIZE + nblocks * H5Z_BLOCKED_BLOCK_HDR_SIZE;
+        for (u = 0; u < nblocks; u++) {
+            uint32_t comp_size; /* Compressed size of the block */
+
+            H5Z_BLOCKED_DECODE_32(src, comp_size)
+            if ((size_t)comp_size > MIN(work.block_size, work.nbytes - u * work.block_size) ||
+                (size_t)comp_size > nbytes - offset)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "blocked data is truncated")
+            work.blocks[u].offset = offset;
+            work.blocks[u].size   = (size_t)comp_size;
+            offset += comp_size;
+        } /* end for */
+
+        /* Get space for the uncompressed data */
+        if (H5Z__scratch_reserve(MAX(work.nbytes, 1), scratch_size, scratch) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for blocked uncompression")
+
+        /* Uncompress the blocks */
+        if (nblocks > 1 && H5CX_get_filter_threads(&nthreads) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, 0, "can't get number of threads for filters")
+        work.src = (const uint8_t *)*buf;
+        work.dst = (uint8_t *)*scratch;
+        if (H5TS_run_tasks(nthreads, nblocks, H5Z__blocked_uncompress_task, &work) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "blocked uncompression failed")
+
+        /* Return the uncompressed data, keeping the input buffer as scratch space */
+        H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
+
+        /* Set return value */
+        ret_value = work.nbytes;
+    } /* end if */
+    else {
+        /* Output; compress */
+        uint64_t orig_size = (uint64_t)nbytes; /* Size of the uncompressed data */
+        size_t   hdr_size;                     /* Size of the header */
+
+        /* Get the block size */
+        work.nbytes     = nbytes;
+        work.block_size = H5Z_BLOCKED_DEF_BLOCK_SIZE;
+        if (cd_values[H5Z_BLOCKED_PARM_BLOCK_SIZE] > 0 &&
+            cd_values[H5Z_BLOCKED_PARM_BLOCK_SIZE] <= H5Z_BLOCKED_MAX_BLOCK_SIZE)
+            work.block_size = cd_values[H5Z_BLOCKED_PARM_BLOCK_SIZE];
+        if (work.block_size > nbytes)
+            work.block_size = MAX(nbytes, 1);
+        nblocks = (nbytes > 0) ? ((nbytes - 1) / work.block_size) + 1 : 0;
+
+        /* Get space for the compressed data, which is never larger than the
+         * header and the uncompressed data
+         */
+        hdr_size = H5Z_BLOCKED_HDR_SIZE + nblocks * H5Z_BLOCKED_BLOCK_HDR_SIZE;
+        if (H5Z__scratch_reserve(hdr_size + nbytes, scratch_size, scratch) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate blocked filter destination buffer")
+        if (NULL == (work.blocks = (H5Z_blocked_block_t *)H5MM_malloc(MAX(nblocks, 1) *
+                                                                       sizeof(H5Z_blocked_block_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for blocked filter")
+
+        /* Compress the blocks, each into the space its uncompressed data
+         * would take after the header
+         */
+        if (nblocks > 1 && H5CX_get_filter_threads(&nthreads) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, 0, "can't get number of threads for filters")
+        work.src = src;
+        work.dst = (uint8_t *)*scratch + hdr_size;
+        if (H5TS_run_tasks(nthreads, nblocks, H5Z__blocked_compress_task, &work) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "blocked compression failed")
+
+        /* Encode the header */
+        dst = (uint8_t *)*scratch;
+        for (u = 8; u > 0; u--)
+            *dst++ = (uint8_t)((orig_size >> (8 * (u - 1))) & 0xff);
+        H5Z_BLOCKED_ENCODE_32(dst, (uint32_t)work.block_size)
+        for (u = 0; u < nblocks; u++)
+            H5Z_BLOCKED_ENCODE_32(dst, (uint32_t)work.blocks[u].size)
+
+        /* Move the compressed blocks together */
+        for (u = 0; u < nblocks; u++) {
+            uint8_t *block = work.dst + u * work.block_size; /* Where the block was compressed */
+
+            if (dst != block)
+                HDmemmove(dst, block, work.blocks[u].size);
+            dst += work.blocks[u].size;
+        } /* end for */
+
+        /* Set return value */
+        ret_value = (size_t)(dst - (uint8_t *)*scratch);
+
+        /* Return the compressed data, keeping the input buffer as scratch space */
+        H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
+    } /* end else */
+
+done:
+    if (work.blocks)
+        H5MM_xfree(work.blocks);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_blocked_scratch() */
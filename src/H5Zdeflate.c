@@ -31,10 +31,17 @@
 #if defined(H5_ZLIB_HEADER)
 #include H5_ZLIB_HEADER /* "zlib.h" */
 #endif
+#ifdef H5_HAVE_LIBDEFLATE
+#include "libdeflate.h"
+#endif
 
 /* Local function prototypes */
 static size_t H5Z__filter_deflate(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
                                   size_t *buf_size, void **buf);
+#ifndef H5_HAVE_LIBDEFLATE
+static int H5Z__deflate_inflate_stream(void);
+#endif /* H5_HAVE_LIBDEFLATE */
+static int H5Z__deflate_deflate_stream(int aggression);
 
 /* This message derives from H5Z */
 const H5Z_class2_t H5Z_DEFLATE[1] = {{
@@ -50,6 +57,128 @@ const H5Z_class2_t H5Z_DEFLATE[1] = {{
 
 #define H5Z_DEFLATE_SIZE_ADJUST(s) (HDceil(((double)(s)) * (double)1.001f) + 12)
 
+/* zlib streams, kept between calls so that their state is only allocated
+ * and set up once rather than for every chunk.  The filters are only called
+ * while holding the library's lock, so a single pair of streams is enough.
+ */
+#ifndef H5_HAVE_LIBDEFLATE
+static z_stream H5Z_inflate_strm_g;              /* Stream for uncompressing */
+static hbool_t  H5Z_inflate_strm_init_g = FALSE; /* Whether H5Z_inflate_strm_g is set up */
+#endif                                           /* H5_HAVE_LIBDEFLATE */
+static z_stream H5Z_deflate_strm_g;              /* Stream for compressing */
+static int      H5Z_deflate_level_g = -1;        /* Level of H5Z_deflate_strm_g, or -1 if not set up */
+
+#ifdef H5_HAVE_LIBDEFLATE
+/* libdeflate state, likewise kept between calls */
+static struct libdeflate_decompressor *H5Z_libdeflate_d_g     = NULL; /* Decompressor */
+static struct libdeflate_compressor *  H5Z_libdeflate_c_g     = NULL; /* Compressor */
+static int                             H5Z_libdeflate_level_g = -1;   /* Level of H5Z_libdeflate_c_g */
+#endif /* H5_HAVE_LIBDEFLATE */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__deflate_term
+ *
+ * Purpose:	Free the zlib streams (and libdeflate state) kept between
+ *              calls to the filter.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5Z__deflate_term(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+#ifndef H5_HAVE_LIBDEFLATE
+    if (H5Z_inflate_strm_init_g) {
+        (void)inflateEnd(&H5Z_inflate_strm_g);
+        H5Z_inflate_strm_init_g = FALSE;
+    } /* end if */
+#endif /* H5_HAVE_LIBDEFLATE */
+    if (H5Z_deflate_level_g >= 0) {
+        (void)deflateEnd(&H5Z_deflate_strm_g);
+        H5Z_deflate_level_g = -1;
+    } /* end if */
+
+#ifdef H5_HAVE_LIBDEFLATE
+    if (H5Z_libdeflate_d_g) {
+        libdeflate_free_decompressor(H5Z_libdeflate_d_g);
+        H5Z_libdeflate_d_g = NULL;
+    } /* end if */
+    if (H5Z_libdeflate_c_g) {
+        libdeflate_free_compressor(H5Z_libdeflate_c_g);
+        H5Z_libdeflate_c_g     = NULL;
+        H5Z_libdeflate_level_g = -1;
+    } /* end if */
+#endif /* H5_HAVE_LIBDEFLATE */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__deflate_term() */
+
+#ifndef H5_HAVE_LIBDEFLATE
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__deflate_inflate_stream
+ *
+ * Purpose:	Get the cached stream ready for uncompressing a new buffer,
+ *              setting it up on first use and resetting it afterwards.
+ *
+ * Return:	zlib status
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5Z__deflate_inflate_stream(void)
+{
+    int ret_value = Z_OK; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (H5Z_inflate_strm_init_g)
+        ret_value = inflateReset(&H5Z_inflate_strm_g);
+    else {
+        HDmemset(&H5Z_inflate_strm_g, 0, sizeof(H5Z_inflate_strm_g));
+        if (Z_OK == (ret_value = inflateInit(&H5Z_inflate_strm_g)))
+            H5Z_inflate_strm_init_g = TRUE;
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__deflate_inflate_stream() */
+#endif /* H5_HAVE_LIBDEFLATE */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__deflate_deflate_stream
+ *
+ * Purpose:	Get the cached stream ready for compressing a new buffer at
+ *              the given level.  The stream is only set up again when the
+ *              level changes, so its output is the same as compress2()'s.
+ *
+ * Return:	zlib status
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5Z__deflate_deflate_stream(int aggression)
+{
+    int ret_value = Z_OK; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (H5Z_deflate_level_g == aggression)
+        ret_value = deflateReset(&H5Z_deflate_strm_g);
+    else {
+        if (H5Z_deflate_level_g >= 0) {
+            (void)deflateEnd(&H5Z_deflate_strm_g);
+            H5Z_deflate_level_g = -1;
+        } /* end if */
+        HDmemset(&H5Z_deflate_strm_g, 0, sizeof(H5Z_deflate_strm_g));
+        if (Z_OK == (ret_value = deflateInit(&H5Z_deflate_strm_g, aggression)))
+            H5Z_deflate_level_g = aggression;
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__deflate_deflate_stream() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5Z__filter_deflate
  *
@@ -68,11 +197,40 @@ static size_t
 H5Z__filter_deflate(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
                     size_t *buf_size, void **buf)
 {
-    void * outbuf = NULL; /* Pointer to new buffer */
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    ret_value = H5Z__filter_with_scratch(H5Z__filter_deflate_scratch, flags, cd_nelmts, cd_values, nbytes,
+                                         buf_size, buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_deflate() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_deflate_scratch
+ *
+ * Purpose:	Deflate filter, writing the [un]compressed data to the
+ *              pipeline's scratch buffer, which is then exchanged with the
+ *              input buffer.
+ *
+ *              When the library is built with libdeflate, it's used in
+ *              place of zlib, which is kept as a fallback for levels that
+ *              libdeflate doesn't support.  Both write the zlib format.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5Z__filter_deflate_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                            size_t *buf_size, void **buf, size_t *scratch_size, void **scratch)
+{
     int    status;        /* Status from zlib operation */
     size_t ret_value = 0; /* Return value */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_PACKAGE
 
     /* Sanity check */
     HDassert(*buf_size > 0);
@@ -85,117 +243,164 @@ H5Z__filter_deflate(unsigned flags, size_t cd_nelmts, const unsigned cd_values[]
 
     if (flags & H5Z_FLAG_REVERSE) {
         /* Input; uncompress */
-        z_stream z_strm;             /* zlib parameters */
-        size_t   nalloc = *buf_size; /* Number of bytes for output (compressed) buffer */
+#ifndef H5_HAVE_LIBDEFLATE
+        z_stream *z_strm = &H5Z_inflate_strm_g; /* zlib parameters */
+#endif                                          /* H5_HAVE_LIBDEFLATE */
+        size_t nalloc;                          /* Number of bytes for output (uncompressed) buffer */
 
-        /* Allocate space for the compressed buffer */
-        if (NULL == (outbuf = H5MM_malloc(nalloc)))
+        /* Get space for the uncompressed data, using all of the scratch buffer */
+        if (H5Z__scratch_reserve(*buf_size, scratch_size, scratch) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for deflate uncompression")
+        nalloc = *scratch_size;
 
-        /* Set the uncompression parameters */
-        HDmemset(&z_strm, 0, sizeof(z_strm));
-        z_strm.next_in = (Bytef *)*buf;
-        H5_CHECKED_ASSIGN(z_strm.avail_in, unsigned, nbytes, size_t);
-        z_strm.next_out = (Bytef *)outbuf;
-        H5_CHECKED_ASSIGN(z_strm.avail_out, unsigned, nalloc, size_t);
-
-        /* Initialize the uncompression routines */
-        if (Z_OK != inflateInit(&z_strm))
+#ifdef H5_HAVE_LIBDEFLATE
+        if (NULL == H5Z_libdeflate_d_g && NULL == (H5Z_libdeflate_d_g = libdeflate_alloc_decompressor()))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "can't allocate libdeflate decompressor")
+
+        /* Uncompress the whole buffer at once, growing the output until it fits */
+        while (1) {
+            size_t                 out_nbytes; /* Size of uncompressed data */
+            enum libdeflate_result result;     /* Result of libdeflate operation */
+
+            result = libdeflate_zlib_decompress(H5Z_libdeflate_d_g, *buf, nbytes, *scratch, nalloc,
+                                                &out_nbytes);
+            if (LIBDEFLATE_SUCCESS == result) {
+                ret_value = out_nbytes;
+                break;
+            } /* end if */
+            if (LIBDEFLATE_INSUFFICIENT_SPACE != result)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "libdeflate_zlib_decompress() failed")
+
+            /* Allocate a buffer twice as big */
+            nalloc *= 2;
+            if (H5Z__scratch_reserve(nalloc, scratch_size, scratch) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0,
+                            "memory allocation failed for deflate uncompression")
+            nalloc = *scratch_size;
+        } /* end while */
+#else  /* H5_HAVE_LIBDEFLATE */
+        /* Get the stream ready */
+        if (Z_OK != H5Z__deflate_inflate_stream())
             HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "inflateInit() failed")
 
+        /* Set the uncompression parameters */
+        z_strm->next_in = (Bytef *)*buf;
+        H5_CHECKED_ASSIGN(z_strm->avail_in, unsigned, nbytes, size_t);
+        z_strm->next_out = (Bytef *)*scratch;
+        H5_CHECKED_ASSIGN(z_strm->avail_out, unsigned, nalloc, size_t);
+
         /* Loop to uncompress the buffer */
         do {
             /* Uncompress some data */
-            status = inflate(&z_strm, Z_SYNC_FLUSH);
+            status = inflate(z_strm, Z_SYNC_FLUSH);
 
             /* Check if we are done uncompressing data */
             if (Z_STREAM_END == status)
                 break; /*done*/
 
             /* Check for error */
-            if (Z_OK != status) {
-                (void)inflateEnd(&z_strm);
+            if (Z_OK != status)
                 HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "inflate() failed")
-            }
             else {
                 /* If we're not done and just ran out of buffer space, get more */
-                if (0 == z_strm.avail_out) {
+                if (0 == z_strm->avail_out) {
                     void *new_outbuf; /* Pointer to new output buffer */
 
                     /* Allocate a buffer twice as big */
                     nalloc *= 2;
-                    if (NULL == (new_outbuf = H5MM_realloc(outbuf, nalloc))) {
-                        (void)inflateEnd(&z_strm);
+                    if (NULL == (new_outbuf = H5MM_realloc(*scratch, nalloc)))
                         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0,
                                     "memory allocation failed for deflate uncompression")
-                    } /* end if */
-                    outbuf = new_outbuf;
+                    *scratch      = new_outbuf;
+                    *scratch_size = nalloc;
 
                     /* Update pointers to buffer for next set of uncompressed data */
-                    z_strm.next_out  = (unsigned char *)outbuf + z_strm.total_out;
-                    z_strm.avail_out = (uInt)(nalloc - z_strm.total_out);
+                    z_strm->next_out  = (unsigned char *)(*scratch) + z_strm->total_out;
+                    z_strm->avail_out = (uInt)(nalloc - z_strm->total_out);
                 } /* end if */
             }     /* end else */
         } while (status == Z_OK);
 
-        /* Free the input buffer */
-        H5MM_xfree(*buf);
-
-        /* Set return values */
-        *buf      = outbuf;
-        outbuf    = NULL;
-        *buf_size = nalloc;
-        ret_value = z_strm.total_out;
+        /* Set return value */
+        ret_value = z_strm->total_out;
+#endif /* H5_HAVE_LIBDEFLATE */
 
-        /* Finish uncompressing the stream */
-        (void)inflateEnd(&z_strm);
+        /* Return the uncompressed data, keeping the input buffer as scratch space */
+        H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
     } /* end if */
     else {
         /*
          * Output; compress but fail if the result would be larger than the
-         * input.  The library doesn't provide in-place compression, so we
-         * must allocate a separate buffer for the result.
+         * input.  The library doesn't provide in-place compression, so the
+         * result goes to the scratch buffer.
          */
-        const Bytef *z_src = (const Bytef *)(*buf);
-        Bytef *      z_dst; /*destination buffer		*/
-        uLongf       z_dst_nbytes = (uLongf)H5Z_DEFLATE_SIZE_ADJUST(nbytes);
-        uLong        z_src_nbytes = (uLong)nbytes;
-        int          aggression; /* Compression aggression setting */
+        z_stream *z_strm       = &H5Z_deflate_strm_g; /* zlib parameters */
+        size_t    z_dst_nbytes = (size_t)H5Z_DEFLATE_SIZE_ADJUST(nbytes);
+        int       aggression; /* Compression aggression setting */
 
         /* Set the compression aggression level */
         H5_CHECKED_ASSIGN(aggression, int, cd_values[0], unsigned);
 
-        /* Allocate output (compressed) buffer */
-        if (NULL == (outbuf = H5MM_malloc(z_dst_nbytes)))
+#ifdef H5_HAVE_LIBDEFLATE
+        /* Get a compressor for this level, falling back to zlib for levels it doesn't support */
+        if (H5Z_libdeflate_level_g != aggression) {
+            if (H5Z_libdeflate_c_g)
+                libdeflate_free_compressor(H5Z_libdeflate_c_g);
+            H5Z_libdeflate_c_g     = libdeflate_alloc_compressor(aggression);
+            H5Z_libdeflate_level_g = aggression;
+        } /* end if */
+
+        if (H5Z_libdeflate_c_g) {
+            size_t out_nbytes; /* Size of compressed data */
+
+            z_dst_nbytes = libdeflate_zlib_compress_bound(H5Z_libdeflate_c_g, nbytes);
+            if (H5Z__scratch_reserve(z_dst_nbytes, scratch_size, scratch) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate deflate destination buffer")
+
+            if (0 == (out_nbytes = libdeflate_zlib_compress(H5Z_libdeflate_c_g, *buf, nbytes, *scratch,
+                                                            z_dst_nbytes)))
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "overflow")
+
+            /* Return the compressed data, keeping the input buffer as scratch space */
+            H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
+
+            HGOTO_DONE(out_nbytes)
+        } /* end if */
+#endif /* H5_HAVE_LIBDEFLATE */
+
+        /* Get space for the output (compressed) data */
+        if (H5Z__scratch_reserve(z_dst_nbytes, scratch_size, scratch) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate deflate destination buffer")
-        z_dst = (Bytef *)outbuf;
+
+        /* Get the stream ready */
+        if (Z_MEM_ERROR == (status = H5Z__deflate_deflate_stream(aggression)))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "deflate memory error")
+        else if (Z_OK != status)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "other deflate error")
 
         /* Perform compression from the source to the destination buffer */
-        status = compress2(z_dst, &z_dst_nbytes, z_src, z_src_nbytes, aggression);
+        z_strm->next_in = (Bytef *)*buf;
+        H5_CHECKED_ASSIGN(z_strm->avail_in, unsigned, nbytes, size_t);
+        z_strm->next_out = (Bytef *)*scratch;
+        H5_CHECKED_ASSIGN(z_strm->avail_out, unsigned, z_dst_nbytes, size_t);
+        status = deflate(z_strm, Z_FINISH);
 
         /* Check for various zlib errors */
-        if (Z_BUF_ERROR == status)
+        if (Z_OK == status || Z_BUF_ERROR == status)
             HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "overflow")
-        else if (Z_MEM_ERROR == status)
-            HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "deflate memory error")
-        else if (Z_OK != status)
+        else if (Z_STREAM_END != status)
             HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "other deflate error")
-        /* Successfully uncompressed the buffer */
+        /* Successfully compressed the buffer */
         else {
-            /* Free the input buffer */
-            H5MM_xfree(*buf);
-
-            /* Set return values */
-            *buf      = outbuf;
-            outbuf    = NULL;
-            *buf_size = nbytes;
-            ret_value = z_dst_nbytes;
+            /* Return the compressed data, keeping the input buffer as scratch space */
+            H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
+
+            /* Set return value */
+            ret_value = z_strm->total_out;
         } /* end else */
     }     /* end else */
 
 done:
-    if (outbuf)
-        H5MM_xfree(outbuf);
     FUNC_LEAVE_NOAPI(ret_value)
 }
 #endif /* H5_HAVE_FILTER_DEFLATE */
@@ -56,18 +56,45 @@ const H5Z_class2_t H5Z_FLETCHER32[1] = {{
  *-------------------------------------------------------------------------
  */
 static size_t
-H5Z__filter_fletcher32(unsigned flags, size_t H5_ATTR_UNUSED cd_nelmts,
-                       const unsigned H5_ATTR_UNUSED cd_values[], size_t nbytes, size_t *buf_size, void **buf)
+H5Z__filter_fletcher32(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                       size_t *buf_size, void **buf)
 {
-    void *         outbuf = NULL; /* Pointer to new buffer */
-    unsigned char *src    = (unsigned char *)(*buf);
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    ret_value = H5Z__filter_with_scratch(H5Z__filter_fletcher32_scratch, flags, cd_nelmts, cd_values, nbytes,
+                                         buf_size, buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_fletcher32() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_fletcher32_scratch
+ *
+ * Purpose:	Fletcher32 checksum filter.  The checksum is appended in
+ *              place when the buffer has room for it; otherwise the data
+ *              is copied to the pipeline's scratch buffer, which is then
+ *              exchanged with the input buffer.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5Z__filter_fletcher32_scratch(unsigned flags, size_t H5_ATTR_UNUSED cd_nelmts,
+                               const unsigned H5_ATTR_UNUSED cd_values[], size_t nbytes, size_t *buf_size,
+                               void **buf, size_t *scratch_size, void **scratch)
+{
+    unsigned char *src = (unsigned char *)(*buf);
     uint32_t       fletcher;          /* Checksum value */
     uint32_t       reversed_fletcher; /* Possible wrong checksum value */
     uint8_t        c[4];
     uint8_t        tmp;
     size_t         ret_value = 0; /* Return value */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_PACKAGE
 
     HDassert(sizeof(uint32_t) >= 4);
 
@@ -122,31 +149,26 @@ H5Z__filter_fletcher32(unsigned flags, size_t H5_ATTR_UNUSED cd_nelmts,
         /* Compute checksum (can't fail) */
         fletcher = H5_checksum_fletcher32(src, nbytes);
 
-        if (NULL == (outbuf = H5MM_malloc(nbytes + FLETCHER_LEN)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0,
-                        "unable to allocate Fletcher32 checksum destination buffer")
+        /* Move the raw data to the scratch buffer if there's no room for the checksum */
+        if (*buf_size < nbytes + FLETCHER_LEN) {
+            if (H5Z__scratch_reserve(nbytes + FLETCHER_LEN, scratch_size, scratch) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0,
+                            "unable to allocate Fletcher32 checksum destination buffer")
 
-        dst = (unsigned char *)outbuf;
+            /* Copy raw data */
+            H5MM_memcpy(*scratch, *buf, nbytes);
 
-        /* Copy raw data */
-        H5MM_memcpy((void *)dst, (void *)(*buf), nbytes);
+            H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
+        } /* end if */
 
         /* Append checksum to raw data for storage */
-        dst += nbytes;
+        dst = (unsigned char *)(*buf) + nbytes;
         UINT32ENCODE(dst, fletcher);
 
-        /* Free input buffer */
-        H5MM_xfree(*buf);
-
         /* Set return values */
-        *buf_size = nbytes + FLETCHER_LEN;
-        *buf      = outbuf;
-        outbuf    = NULL;
-        ret_value = *buf_size;
+        ret_value = nbytes + FLETCHER_LEN;
     }
 
 done:
-    if (outbuf)
-        H5MM_xfree(outbuf);
     FUNC_LEAVE_NOAPI(ret_value)
 }
@@ -0,0 +1,248 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The LZ4 filter.  The data is split into blocks which are
+ *          compressed separately with the LZ4 block format.  The output
+ *          starts with the size of the uncompressed data as a big-endian
+ *          64-bit value and the block size as a big-endian 32-bit value,
+ *          followed by each block's compressed size as a big-endian 32-bit
+ *          value and its compressed bytes.  A block that doesn't get
+ *          smaller is stored as is, and its compressed size is the block
+ *          size.  This is the format written by The HDF Group's LZ4
+ *          plugin, which uses the same filter ID.
+ */
+
+#include "H5Zmodule.h" /* This source code file is part of the H5Z module */
+
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5MMprivate.h" /* Memory management			*/
+#include "H5Zpkg.h"      /* Data filters				*/
+
+#ifdef H5_HAVE_FILTER_LZ4
+
+#ifdef H5_HAVE_LZ4_H
+#include "lz4.h"
+#endif
+
+/* Size of the header at the start of the filter's output */
+#define H5Z_LZ4_HDR_SIZE (8 + 4)
+
+/* Size of the prefix of each compressed block */
+#define H5Z_LZ4_BLOCK_HDR_SIZE 4
+
+/* Encode and decode the big-endian values in the filter's output */
+#define H5Z_LZ4_ENCODE_32(P, V)                                                                              \
+    {                                                                                                        \
+        *(P)++ = (uint8_t)(((V) >> 24) & 0xff);                                                              \
+        *(P)++ = (uint8_t)(((V) >> 16) & 0xff);                                                              \
+        *(P)++ = (uint8_t)(((V) >> 8) & 0xff);                                                               \
+        *(P)++ = (uint8_t)((V)&0xff);                                                                        \
+    }
+#define H5Z_LZ4_DECODE_32(P, V)                                                                              \
+    {                                                                                                        \
+        (V) = ((uint32_t)(P)[0] << 24) | ((uint32_t)(P)[1] << 16) | ((uint32_t)(P)[2] << 8) |                \
+              (uint32_t)(P)[3];                                                                              \
+        (P) += 4;                                                                                            \
+    }
+
+/* Local function prototypes */
+static size_t H5Z__filter_lz4(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                              size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_LZ4[1] = {{
+    H5Z_CLASS_T_VERS, /* H5Z_class_t version */
+    H5Z_FILTER_LZ4,   /* Filter id number		*/
+    1,                /* encoder_present flag (set to true) */
+    1,                /* decoder_present flag (set to true) */
+    "lz4",            /* Filter name for debugging	*/
+    NULL,             /* The "can apply" callback     */
+    NULL,             /* The "set local" callback     */
+    H5Z__filter_lz4,  /* The actual filter function	*/
+}};
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_lz4
+ *
+ * Purpose:	Implement an I/O filter around the LZ4 block compression
+ *              algorithm in liblz4
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__filter_lz4(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                size_t *buf_size, void **buf)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    ret_value =
+        H5Z__filter_with_scratch(H5Z__filter_lz4_scratch, flags, cd_nelmts, cd_values, nbytes, buf_size, buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_lz4() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_lz4_scratch
+ *
+ * Purpose:	LZ4 filter, writing the [un]compressed data to the
+ *              pipeline's scratch buffer, which is then exchanged with the
+ *              input buffer.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5Z__filter_lz4_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                        size_t *buf_size, void **buf, size_t *scratch_size, void **scratch)
+{
+    const uint8_t *src;           /* Pointer into the input */
+    uint8_t *      dst;           /* Pointer into the output */
+    size_t         block_size;    /* Size of an uncompressed block */
+    size_t         ret_value = 0; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(*buf_size > 0);
+    HDassert(buf);
+    HDassert(*buf);
+
+    src = (const uint8_t *)*buf;
+
+    if (flags & H5Z_FLAG_REVERSE) {
+        /* Input; uncompress */
+        const uint8_t *src_end = src + nbytes; /* End of the compressed data */
+        uint64_t       orig_size;              /* Size of the uncompressed data */
+        uint32_t       enc_block_size;         /* Block size, as stored */
+        size_t         done_size;              /* Amount of data uncompressed */
+        unsigned       u;                      /* Local index variable */
+
+        /* Decode the header */
+        if (nbytes < H5Z_LZ4_HDR_SIZE)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "LZ4 data is too short")
+        orig_size = 0;
+        for (u = 0; u < 8; u++)
+            orig_size = (orig_size << 8) | (uint64_t)*src++;
+        H5Z_LZ4_DECODE_32(src, enc_block_size)
+        if (orig_size != (uint64_t)(size_t)orig_size || (orig_size > 0 && 0 == enc_block_size) ||
+            enc_block_size > (uint32_t)LZ4_MAX_INPUT_SIZE)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "invalid LZ4 header")
+
+        /* Get space for the uncompressed data */
+        if (H5Z__scratch_reserve(MAX((size_t)orig_size, 1), scratch_size, scratch) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for LZ4 uncompression")
+        dst = (uint8_t *)*scratch;
+
+        /* Uncompress each block */
+        block_size = (size_t)enc_block_size;
+        for (done_size = 0; done_size < (size_t)orig_size; done_size += block_size) {
+            uint32_t comp_size; /* Compressed size of the block */
+
+            /* The last block may be short */
+            if (block_size > (size_t)orig_size - done_size)
+                block_size = (size_t)orig_size - done_size;
+
+            if ((size_t)(src_end - src) < H5Z_LZ4_BLOCK_HDR_SIZE)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "LZ4 data is truncated")
+            H5Z_LZ4_DECODE_32(src, comp_size)
+            if ((size_t)comp_size > (size_t)(src_end - src))
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "LZ4 data is truncated")
+
+            /* Blocks that didn't compress are stored as is */
+            if ((size_t)comp_size == block_size)
+                H5MM_memcpy(dst + done_size, src, block_size);
+            else if (LZ4_decompress_safe((const char *)src, (char *)(dst + done_size), (int)comp_size,
+                                         (int)block_size) != (int)block_size)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "LZ4 uncompression failed")
+
+            src += comp_size;
+        } /* end for */
+
+        /* Return the uncompressed data, keeping the input buffer as scratch space */
+        H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
+
+        /* Set return value */
+        ret_value = (size_t)orig_size;
+    } /* end if */
+    else {
+        /* Output; compress */
+        uint64_t orig_size = (uint64_t)nbytes; /* Size of the uncompressed data */
+        size_t   nblocks;                      /* Number of blocks */
+        size_t   out_size;                     /* Largest size of the output */
+        size_t   offset;                       /* Offset of the block in the input */
+        unsigned u;                            /* Local index variable */
+
+        /* Get the block size */
+        block_size = H5Z_LZ4_MAX_BLOCK_SIZE;
+        if (cd_nelmts > 0 && cd_values[0] > 0 && cd_values[0] < H5Z_LZ4_MAX_BLOCK_SIZE)
+            block_size = cd_values[0];
+        if (block_size > nbytes)
+            block_size = nbytes;
+        nblocks = (nbytes > 0) ? ((nbytes - 1) / block_size) + 1 : 0;
+
+        /* Get space for the compressed data */
+        out_size = H5Z_LZ4_HDR_SIZE +
+                   nblocks * (H5Z_LZ4_BLOCK_HDR_SIZE + (size_t)LZ4_COMPRESSBOUND((int)block_size));
+        if (H5Z__scratch_reserve(out_size, scratch_size, scratch) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate LZ4 destination buffer")
+        dst = (uint8_t *)*scratch;
+
+        /* Encode the header */
+        for (u = 8; u > 0; u--)
+            *dst++ = (uint8_t)((orig_size >> (8 * (u - 1))) & 0xff);
+        H5Z_LZ4_ENCODE_32(dst, (uint32_t)block_size)
+
+        /* Compress each block */
+        for (offset = 0; offset < nbytes; offset += block_size) {
+            uint8_t *comp_size_p = dst; /* Where to store the compressed size */
+            int      comp_size;         /* Compressed size of the block */
+
+            /* The last block may be short */
+            if (block_size > nbytes - offset)
+                block_size = nbytes - offset;
+
+            dst += H5Z_LZ4_BLOCK_HDR_SIZE;
+            comp_size = LZ4_compress_default((const char *)(src + offset), (char *)dst, (int)block_size,
+                                             LZ4_COMPRESSBOUND((int)block_size));
+            if (comp_size <= 0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "LZ4 compression failed")
+
+            /* Store blocks that don't get smaller as is */
+            if ((size_t)comp_size >= block_size) {
+                H5MM_memcpy(dst, src + offset, block_size);
+                comp_size = (int)block_size;
+            } /* end if */
+
+            H5Z_LZ4_ENCODE_32(comp_size_p, (uint32_t)comp_size)
+            dst += comp_size;
+        } /* end for */
+
+        /* Set return value */
+        ret_value = (size_t)(dst - (uint8_t *)*scratch);
+
+        /* Return the compressed data, keeping the input buffer as scratch space */
+        H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_lz4_scratch() */
+#endif /* H5_HAVE_FILTER_LZ4 */
@@ -70,7 +70,7 @@ static herr_t H5Z__nbit_decompress_one_compound(unsigned char *data, size_t data
                                                 unsigned char *buffer, size_t *j, size_t *buf_len,
                                                 const unsigned parms[], unsigned *parms_index);
 static herr_t H5Z__nbit_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
-                                   const unsigned parms[]);
+                                   size_t buffer_size, const unsigned parms[]);
 static void   H5Z__nbit_compress_one_nooptype(unsigned char *data, size_t data_offset, unsigned char *buffer,
                                               size_t *j, size_t *buf_len, unsigned size);
 static void   H5Z__nbit_compress_one_array(unsigned char *data, size_t data_offset, unsigned char *buffer,
@@ -82,6 +82,9 @@ static void   H5Z__nbit_compress_one_compound(unsigned char *data, size_t data_o
 static void   H5Z__nbit_compress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
                                  size_t *buffer_size, const unsigned parms[]);
 
+static hbool_t H5Z__nbit_get_packable(const unsigned parms[], unsigned d_nelmts, parms_atomic *p,
+                                      size_t *nelmts);
+
 /* This message derives from H5Z */
 H5Z_class2_t H5Z_NBIT[1] = {{
     H5Z_CLASS_T_VERS,    /* H5Z_class_t version */
@@ -949,12 +952,37 @@ static size_t
 H5Z__filter_nbit(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
                  size_t *buf_size, void **buf)
 {
-    unsigned char *outbuf;        /* pointer to new output buffer */
-    size_t         size_out  = 0; /* size of output buffer */
-    unsigned       d_nelmts  = 0; /* number of elements in the chunk */
-    size_t         ret_value = 0; /* return value */
+    size_t ret_value = 0; /* return value */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_STATIC_NOERR
+
+    ret_value = H5Z__filter_with_scratch(H5Z__filter_nbit_scratch, flags, cd_nelmts, cd_values, nbytes,
+                                         buf_size, buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_nbit() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_nbit_scratch
+ *
+ * Purpose:	N-bit filter, writing the packed or unpacked data to the
+ *              pipeline's scratch buffer, which is then exchanged with the
+ *              input buffer.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5Z__filter_nbit_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                         size_t *buf_size, void **buf, size_t *scratch_size, void **scratch)
+{
+    size_t   size_out  = 0; /* size of output buffer */
+    unsigned d_nelmts  = 0; /* number of elements in the chunk */
+    size_t   ret_value = 0; /* return value */
+
+    FUNC_ENTER_PACKAGE
 
     /* check arguments
      * cd_values[0] stores actual number of parameters in cd_values[]
@@ -975,12 +1003,13 @@ H5Z__filter_nbit(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], s
     if (flags & H5Z_FLAG_REVERSE) {
         size_out = d_nelmts * cd_values[4]; /* cd_values[4] stores datatype size */
 
-        /* allocate memory space for decompressed buffer */
-        if (NULL == (outbuf = (unsigned char *)H5MM_malloc(size_out)))
+        /* get memory space for decompressed buffer */
+        if (H5Z__scratch_reserve(size_out, scratch_size, scratch) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for nbit decompression")
 
         /* decompress the buffer */
-        if (H5Z__nbit_decompress(outbuf, d_nelmts, (unsigned char *)*buf, cd_values) < 0)
+        if (H5Z__nbit_decompress((unsigned char *)*scratch, d_nelmts, (unsigned char *)*buf, nbytes,
+                                 cd_values) < 0)
             HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "can't decompress buffer")
     } /* end if */
     /* output; compress */
@@ -989,20 +1018,18 @@ H5Z__filter_nbit(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], s
 
         size_out = nbytes;
 
-        /* allocate memory space for compressed buffer */
-        if (NULL == (outbuf = (unsigned char *)H5MM_malloc(size_out)))
+        /* get memory space for compressed buffer */
+        if (H5Z__scratch_reserve(size_out, scratch_size, scratch) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for nbit compression")
 
         /* compress the buffer, size_out will be changed */
-        H5Z__nbit_compress((unsigned char *)*buf, d_nelmts, outbuf, &size_out, cd_values);
+        H5Z__nbit_compress((unsigned char *)*buf, d_nelmts, (unsigned char *)*scratch, &size_out, cd_values);
     } /* end else */
 
-    /* free the input buffer */
-    H5MM_xfree(*buf);
+    /* return the output buffer, keeping the input buffer as scratch space */
+    H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
 
-    /* set return values */
-    *buf      = outbuf;
-    *buf_size = size_out;
+    /* set return value */
     ret_value = size_out;
 
 done:
@@ -1274,8 +1301,44 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+/* Check whether the data is made up of fixed-size integers or floating-point
+ * numbers, on their own or in an array, which H5Z__bitpack_encode() and
+ * H5Z__bitpack_decode() can handle a whole element at a time.  If so, get
+ * their parameters and the number of them.
+ */
+static hbool_t
+H5Z__nbit_get_packable(const unsigned parms[], unsigned d_nelmts, parms_atomic *p, size_t *nelmts)
+{
+    unsigned parms_index; /* index of the atomic type's parameters */
+    size_t   n = 1;       /* number of atomic elements in each data element */
+
+    if (parms[3] == H5Z_NBIT_ATOMIC)
+        parms_index = 4;
+    else if (parms[3] == H5Z_NBIT_ARRAY && parms[5] == H5Z_NBIT_ATOMIC) {
+        if (0 == parms[6] || parms[4] % parms[6] != 0)
+            return FALSE;
+        n           = parms[4] / parms[6];
+        parms_index = 6;
+    }
+    else
+        return FALSE;
+
+    p->size      = parms[parms_index];
+    p->order     = parms[parms_index + 1];
+    p->precision = parms[parms_index + 2];
+    p->offset    = parms[parms_index + 3];
+    if (p->size > H5Z_BITPACK_MAX_SIZE || 0 == p->precision || p->precision > p->size * 8 ||
+        (p->precision + p->offset) > p->size * 8)
+        return FALSE;
+
+    *nelmts = n * d_nelmts;
+
+    return TRUE;
+}
+
 static herr_t
-H5Z__nbit_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer, const unsigned parms[])
+H5Z__nbit_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer, size_t buffer_size,
+                     const unsigned parms[])
 {
     /* i: index of data, j: index of buffer,
        buf_len: number of bits to be filled in current byte */
@@ -1288,6 +1351,13 @@ H5Z__nbit_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buff
 
     FUNC_ENTER_STATIC
 
+    /* fixed-size integers and floating-point numbers are unpacked a whole element at a time */
+    if (H5Z__nbit_get_packable(parms, d_nelmts, &p, &size)) {
+        H5Z__bitpack_decode(buffer, buffer_size, size, p.size, (hbool_t)(p.order == H5Z_NBIT_ORDER_BE),
+                            p.precision, p.offset, data);
+        HGOTO_DONE(SUCCEED)
+    }
+
     /* may not have to initialize to zeros */
     HDmemset(data, 0, d_nelmts * parms[4]);
 
@@ -1558,6 +1628,13 @@ H5Z__nbit_compress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer
     parms_atomic p;
     unsigned     parms_index; /* index in array parms used by compression/decompression functions */
 
+    /* fixed-size integers and floating-point numbers are packed a whole element at a time */
+    if (H5Z__nbit_get_packable(parms, d_nelmts, &p, &size)) {
+        *buffer_size = H5Z__bitpack_encode(data, size, p.size, (hbool_t)(p.order == H5Z_NBIT_ORDER_BE),
+                                           p.precision, p.offset, buffer);
+        return;
+    }
+
     /* must initialize buffer to be zeros */
     HDmemset(buffer, 0, *buffer_size);
 
@@ -21,21 +21,66 @@
 /* Include private header file */
 #include "H5Zprivate.h" /* Filter functions                */
 
+/**************************/
+/* Package Private Macros */
+/**************************/
+
+/* Largest element, in bytes, handled by H5Z__bitpack_encode/decode() */
+#define H5Z_BITPACK_MAX_SIZE 8
+
+/****************************/
+/* Package Private Typedefs */
+/****************************/
+
+/*
+ * Filter callback used by the library's own filters in place of H5Z_func_t.
+ * The arguments are the same, plus a scratch buffer of *scratch_size bytes
+ * owned by the pipeline.  A filter that can't work in place writes its
+ * result to the scratch buffer (reserving space with H5Z__scratch_reserve())
+ * and exchanges it with *buf with H5Z__scratch_swap(), rather than allocating
+ * a new buffer and freeing the input.  The pipeline keeps the scratch buffer
+ * from one filter, and one call, to the next.
+ */
+typedef size_t (*H5Z_scratch_func_t)(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+                                     size_t nbytes, size_t *buf_size, void **buf, size_t *scratch_size,
+                                     void **scratch);
+
 /********************/
 /* Internal filters */
 /********************/
 
 /* Shuffle filter */
 H5_DLLVAR const H5Z_class2_t H5Z_SHUFFLE[1];
+H5_DLL size_t H5Z__filter_shuffle_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+                                          size_t nbytes, size_t *buf_size, void **buf, size_t *scratch_size,
+                                          void **scratch);
 
 /* Fletcher32 filter */
 H5_DLLVAR const H5Z_class2_t H5Z_FLETCHER32[1];
+H5_DLL size_t H5Z__filter_fletcher32_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+                                             size_t nbytes, size_t *buf_size, void **buf,
+                                             size_t *scratch_size, void **scratch);
 
 /* n-bit filter */
 H5_DLLVAR H5Z_class2_t H5Z_NBIT[1];
+H5_DLL size_t H5Z__filter_nbit_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+                                       size_t nbytes, size_t *buf_size, void **buf, size_t *scratch_size,
+                                       void **scratch);
 
 /* Scale/offset filter */
 H5_DLLVAR H5Z_class2_t H5Z_SCALEOFFSET[1];
+H5_DLL size_t H5Z__filter_scaleoffset_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+                                              size_t nbytes, size_t *buf_size, void **buf,
+                                              size_t *scratch_size, void **scratch);
+
+/* Variable-length packing filter */
+H5_DLLVAR const H5Z_class2_t H5Z_VLPACK[1];
+
+/* Blocked compression filter */
+H5_DLLVAR const H5Z_class2_t H5Z_BLOCKED[1];
+H5_DLL size_t H5Z__filter_blocked_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+                                          size_t nbytes, size_t *buf_size, void **buf, size_t *scratch_size,
+                                          void **scratch);
 
 /********************/
 /* External filters */
@@ -44,6 +89,10 @@ H5_DLLVAR H5Z_class2_t H5Z_SCALEOFFSET[1];
 /* Deflate filter */
 #ifdef H5_HAVE_FILTER_DEFLATE
 H5_DLLVAR const H5Z_class2_t H5Z_DEFLATE[1];
+H5_DLL size_t H5Z__filter_deflate_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+                                          size_t nbytes, size_t *buf_size, void **buf, size_t *scratch_size,
+                                          void **scratch);
+H5_DLL void   H5Z__deflate_term(void);
 #endif /* H5_HAVE_FILTER_DEFLATE */
 
 /* szip filter */
@@ -51,7 +100,33 @@ H5_DLLVAR const H5Z_class2_t H5Z_DEFLATE[1];
 H5_DLLVAR H5Z_class2_t H5Z_SZIP[1];
 #endif /* H5_HAVE_FILTER_SZIP */
 
+/* LZ4 filter */
+#ifdef H5_HAVE_FILTER_LZ4
+H5_DLLVAR const H5Z_class2_t H5Z_LZ4[1];
+H5_DLL size_t H5Z__filter_lz4_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+                                      size_t nbytes, size_t *buf_size, void **buf, size_t *scratch_size,
+                                      void **scratch);
+#endif /* H5_HAVE_FILTER_LZ4 */
+
+/* Zstandard filter */
+#ifdef H5_HAVE_FILTER_ZSTD
+H5_DLLVAR const H5Z_class2_t H5Z_ZSTD[1];
+H5_DLL size_t H5Z__filter_zstd_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+                                       size_t nbytes, size_t *buf_size, void **buf, size_t *scratch_size,
+                                       void **scratch);
+H5_DLL void   H5Z__zstd_term(void);
+#endif /* H5_HAVE_FILTER_ZSTD */
+
 /* Package internal routines */
 H5_DLL herr_t H5Z__unregister(H5Z_filter_t filter_id);
+H5_DLL herr_t H5Z__scratch_reserve(size_t nbytes, size_t *scratch_size, void **scratch);
+H5_DLL void   H5Z__scratch_swap(size_t *buf_size, void **buf, size_t *scratch_size, void **scratch);
+H5_DLL size_t H5Z__filter_with_scratch(H5Z_scratch_func_t func, unsigned flags, size_t cd_nelmts,
+                                       const unsigned cd_values[], size_t nbytes, size_t *buf_size,
+                                       void **buf);
+H5_DLL size_t H5Z__bitpack_encode(const uint8_t *data, size_t nelmts, unsigned size, hbool_t big_endian,
+                                  unsigned precision, unsigned offset, uint8_t *out);
+H5_DLL void   H5Z__bitpack_decode(const uint8_t *in, size_t in_size, size_t nelmts, unsigned size,
+                                  hbool_t big_endian, unsigned precision, unsigned offset, uint8_t *data);
 
 #endif /* _H5Zpkg_H */
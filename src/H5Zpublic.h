@@ -39,8 +39,17 @@ typedef int H5Z_filter_t;
 #define H5Z_FILTER_SZIP        4    /*szip compression              */
 #define H5Z_FILTER_NBIT        5    /*nbit compression              */
 #define H5Z_FILTER_SCALEOFFSET 6    /*scale+offset compression      */
+#define H5Z_FILTER_VLPACK      7    /*packed variable-length data   */
+#define H5Z_FILTER_BLOCKED     8    /*blocked compression           */
 #define H5Z_FILTER_RESERVED    256  /*filter ids below this value are reserved for library use */
 
+/* Filter IDs registered with The HDF Group for filters that are also
+ * available as plugins.  The library's own versions of these filters
+ * read and write the same format as the plugins.
+ */
+#define H5Z_FILTER_LZ4  32004 /*LZ4 compression                */
+#define H5Z_FILTER_ZSTD 32015 /*Zstandard compression          */
+
 #define H5Z_FILTER_MAX 65535 /*maximum filter id		*/
 
 /* General macros */
@@ -91,6 +100,30 @@ typedef int H5Z_filter_t;
 /* Macros for the scale offset filter */
 #define H5Z_SCALEOFFSET_USER_NPARMS 2 /* Number of parameters that users can set */
 
+/* Macros for the variable-length packing filter */
+#define H5Z_VLPACK_USER_NPARMS  0 /* Number of parameters that users can set */
+#define H5Z_VLPACK_TOTAL_NPARMS 1 /* Total number of parameters for filter */
+
+/* Macros for the LZ4 filter */
+#define H5Z_LZ4_USER_NPARMS    1          /* Number of parameters that users can set */
+#define H5Z_LZ4_MAX_BLOCK_SIZE (1U << 30) /* Largest block size, and the default */
+
+/* Macros for the Zstandard filter */
+#define H5Z_ZSTD_USER_NPARMS    1           /* Number of parameters, without a dictionary */
+#define H5Z_ZSTD_PARM_LEVEL     0           /* Parameter for the compression level */
+#define H5Z_ZSTD_PARM_DICT_SIZE 1           /* Parameter for the size of the dictionary */
+#define H5Z_ZSTD_PARM_DICT      2           /* First parameter holding the dictionary */
+#define H5Z_ZSTD_MAX_LEVEL      22          /* Highest compression level */
+#define H5Z_ZSTD_MAX_DICT_SIZE  (32 * 1024) /* Largest dictionary stored with the filter */
+
+/* Macros for the blocked compression filter */
+#define H5Z_BLOCKED_USER_NPARMS     3          /* Number of parameters that users can set */
+#define H5Z_BLOCKED_PARM_CODEC      0          /* Parameter for the compression filter's ID */
+#define H5Z_BLOCKED_PARM_LEVEL      1          /* Parameter for the compression level */
+#define H5Z_BLOCKED_PARM_BLOCK_SIZE 2          /* Parameter for the block size */
+#define H5Z_BLOCKED_DEF_BLOCK_SIZE  (1U << 20) /* Default block size */
+#define H5Z_BLOCKED_MAX_BLOCK_SIZE  (1U << 30) /* Largest block size */
+
 /* Special parameters for ScaleOffset filter*/
 #define H5Z_SO_INT_MINBITS_DEFAULT 0
 typedef enum H5Z_SO_scale_type_t {
@@ -85,7 +85,7 @@ static void   H5Z__scaleoffset_compress_one_atomic(unsigned char *data, size_t d
                                                    unsigned char *buffer, size_t *j, unsigned *buf_len,
                                                    parms_atomic p);
 static void   H5Z__scaleoffset_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
-                                          parms_atomic p);
+                                          size_t buffer_size, parms_atomic p);
 static void   H5Z__scaleoffset_compress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer,
                                         size_t buffer_size, parms_atomic p);
 
@@ -1110,6 +1110,32 @@ done:
 static size_t
 H5Z__filter_scaleoffset(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
                         size_t *buf_size, void **buf)
+{
+    size_t ret_value = 0; /* return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    ret_value = H5Z__filter_with_scratch(H5Z__filter_scaleoffset_scratch, flags, cd_nelmts, cd_values, nbytes,
+                                         buf_size, buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_scaleoffset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__filter_scaleoffset_scratch
+ *
+ * Purpose:    Scale/offset filter, writing the packed or unpacked data to
+ *              the pipeline's scratch buffer, which is then exchanged with
+ *              the input buffer.
+ *
+ * Return:    Success: Size of buffer filtered
+ *        Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5Z__filter_scaleoffset_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                                size_t *buf_size, void **buf, size_t *scratch_size, void **scratch)
 {
     size_t                 ret_value = 0; /* return value */
     size_t                 size_out  = 0; /* size of output buffer */
@@ -1124,12 +1150,12 @@ H5Z__filter_scaleoffset(unsigned flags, size_t cd_nelmts, const unsigned cd_valu
     unsigned long long     minval       = 0;                   /* minimum value of input buffer */
     enum H5Z_scaleoffset_t type;                 /* memory type corresponding to dataset datatype */
     int                    need_convert = FALSE; /* flag indicating conversion of byte order */
-    unsigned char *        outbuf       = NULL;  /* pointer to new output buffer */
+    unsigned char *        outbuf       = NULL;  /* pointer to output (scratch) buffer */
     unsigned               buf_offset   = 21;    /* buffer offset because of parameters stored in file */
     unsigned               i;                    /* index */
     parms_atomic           p;                    /* parameters needed for compress/decompress functions */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_PACKAGE
 
     /* check arguments */
     if (cd_nelmts != H5Z_SCALEOFFSET_TOTAL_NPARMS)
@@ -1245,31 +1271,30 @@ H5Z__filter_scaleoffset(unsigned flags, size_t cd_nelmts, const unsigned cd_valu
         /* calculate size of output buffer after decompression */
         size_out = d_nelmts * p.size;
 
-        /* allocate memory space for decompressed buffer */
-        if (NULL == (outbuf = (unsigned char *)H5MM_malloc(size_out)))
+        /* get memory space for decompressed buffer */
+        if (H5Z__scratch_reserve(size_out, scratch_size, scratch) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0,
                         "memory allocation failed for scaleoffset decompression")
+        outbuf = (unsigned char *)*scratch;
 
         /* special case: minbits equal to full precision */
         if (minbits == p.size * 8) {
             H5MM_memcpy(outbuf, (unsigned char *)(*buf) + buf_offset, size_out);
-            /* free the original buffer */
-            H5MM_xfree(*buf);
 
             /* convert to dataset datatype endianness order if needed */
             if (need_convert)
                 H5Z__scaleoffset_convert(outbuf, d_nelmts, p.size);
 
-            *buf      = outbuf;
-            outbuf    = NULL;
-            *buf_size = size_out;
+            /* keep the original buffer as scratch space */
+            H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
             ret_value = size_out;
             goto done;
         }
 
         /* decompress the buffer if minbits not equal to zero */
         if (minbits != 0)
-            H5Z__scaleoffset_decompress(outbuf, d_nelmts, (unsigned char *)(*buf) + buf_offset, p);
+            H5Z__scaleoffset_decompress(outbuf, d_nelmts, (unsigned char *)(*buf) + buf_offset,
+                                        nbytes > buf_offset ? nbytes - buf_offset : 0, p);
         else {
             /* fill value is not defined and all data elements have the same value */
             for (i = 0; i < size_out; i++)
@@ -1326,9 +1351,10 @@ H5Z__filter_scaleoffset(unsigned flags, size_t cd_nelmts, const unsigned cd_valu
         p.minbits = minbits;
         size_out  = buf_offset + nbytes * p.minbits / (p.size * 8) + 1; /* may be 1 larger */
 
-        /* allocate memory space for compressed buffer */
-        if (NULL == (outbuf = (unsigned char *)H5MM_malloc(size_out)))
+        /* get memory space for compressed buffer */
+        if (H5Z__scratch_reserve(size_out, scratch_size, scratch) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for scaleoffset compression")
+        outbuf = (unsigned char *)*scratch;
 
         /* store minbits and minval in the front of output compressed buffer
          * store byte by byte from least significant byte to most significant byte
@@ -1353,12 +1379,9 @@ H5Z__filter_scaleoffset(unsigned flags, size_t cd_nelmts, const unsigned cd_valu
         /* special case: minbits equal to full precision */
         if (minbits == p.size * 8) {
             H5MM_memcpy(outbuf + buf_offset, *buf, nbytes);
-            /* free the original buffer */
-            H5MM_xfree(*buf);
 
-            *buf      = outbuf;
-            outbuf    = NULL;
-            *buf_size = size_out;
+            /* keep the original buffer as scratch space */
+            H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
             ret_value = buf_offset + nbytes;
             goto done;
         }
@@ -1372,18 +1395,13 @@ H5Z__filter_scaleoffset(unsigned flags, size_t cd_nelmts, const unsigned cd_valu
                                       size_out - buf_offset, p);
     }
 
-    /* free the input buffer */
-    H5MM_xfree(*buf);
+    /* return the output buffer, keeping the input buffer as scratch space */
+    H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
 
-    /* set return values */
-    *buf      = outbuf;
-    outbuf    = NULL;
-    *buf_size = size_out;
+    /* set return value */
     ret_value = size_out;
 
 done:
-    if (outbuf)
-        H5MM_xfree(outbuf);
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
@@ -1674,13 +1692,21 @@ H5Z__scaleoffset_decompress_one_atomic(unsigned char *data, size_t data_offset,
 }
 
 static void
-H5Z__scaleoffset_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer, parms_atomic p)
+H5Z__scaleoffset_decompress(unsigned char *data, unsigned d_nelmts, unsigned char *buffer, size_t buffer_size,
+                            parms_atomic p)
 {
     /* i: index of data, j: index of buffer,
        buf_len: number of bits to be filled in current byte */
     size_t   i, j;
     unsigned buf_len;
 
+    /* unpack a whole element at a time */
+    if (p.size <= H5Z_BITPACK_MAX_SIZE) {
+        H5Z__bitpack_decode(buffer, buffer_size, d_nelmts, p.size,
+                            (hbool_t)(p.mem_order == H5Z_SCALEOFFSET_ORDER_BE), p.minbits, 0, data);
+        return;
+    }
+
     /* must initialize to zeros */
     for (i = 0; i < d_nelmts * p.size; i++)
         data[i] = 0;
@@ -1765,6 +1791,14 @@ H5Z__scaleoffset_compress(unsigned char *data, unsigned d_nelmts, unsigned char
     size_t   i, j;
     unsigned buf_len;
 
+    /* pack a whole element at a time, which fills the buffer exactly */
+    if (p.size <= H5Z_BITPACK_MAX_SIZE) {
+        j = H5Z__bitpack_encode(data, d_nelmts, p.size, (hbool_t)(p.mem_order == H5Z_SCALEOFFSET_ORDER_BE),
+                                p.minbits, 0, buffer);
+        HDassert(j == buffer_size);
+        return;
+    }
+
     /* must initialize buffer to be zeros */
     for (j = 0; j < buffer_size; j++)
         buffer[j] = 0;
@@ -114,6 +114,32 @@ done:
 static size_t
 H5Z__filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
                     size_t *buf_size, void **buf)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    ret_value = H5Z__filter_with_scratch(H5Z__filter_shuffle_scratch, flags, cd_nelmts, cd_values, nbytes,
+                                         buf_size, buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_shuffle() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_shuffle_scratch
+ *
+ * Purpose:	Shuffle filter, writing the [un]shuffled bytes to the
+ *              pipeline's scratch buffer, which is then exchanged with the
+ *              input buffer.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5Z__filter_shuffle_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                            size_t *buf_size, void **buf, size_t *scratch_size, void **scratch)
 {
     void *         dest  = NULL;  /* Buffer to deposit [un]shuffled bytes into */
     unsigned char *_src  = NULL;  /* Alias for source buffer */
@@ -127,7 +153,7 @@ H5Z__filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[]
     size_t leftover;      /* Extra bytes at end of buffer */
     size_t ret_value = 0; /* Return value */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_PACKAGE
 
     /* Check arguments */
     if (cd_nelmts != H5Z_SHUFFLE_TOTAL_NPARMS || cd_values[H5Z_SHUFFLE_PARM_SIZE] == 0)
@@ -144,9 +170,10 @@ H5Z__filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[]
         /* Compute the leftover bytes if there are any */
         leftover = nbytes % bytesoftype;
 
-        /* Allocate the destination buffer */
-        if (NULL == (dest = H5MM_malloc(nbytes)))
+        /* Get the destination buffer */
+        if (H5Z__scratch_reserve(nbytes, scratch_size, scratch) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for shuffle buffer")
+        dest = *scratch;
 
         if (flags & H5Z_FLAG_REVERSE) {
             /* Get the pointer to the source buffer */
@@ -291,12 +318,8 @@ H5Z__filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[]
             }
         } /* end else */
 
-        /* Free the input buffer */
-        H5MM_xfree(*buf);
-
-        /* Set the buffer information to return */
-        *buf      = dest;
-        *buf_size = nbytes;
+        /* Return the destination buffer, keeping the input buffer as scratch space */
+        H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
     } /* end else */
 
     /* Set the return value */
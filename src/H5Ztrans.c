@@ -54,10 +54,41 @@ typedef struct H5Z_node {
     H5Z_num_val      value;
 } H5Z_node;
 
+/* Instructions for the compiled form of a transform expression */
+typedef enum {
+    H5Z_XFORM_OP_LOAD,         /* Push a copy of the data values                  */
+    H5Z_XFORM_OP_PLUS,         /* Pop two operands, push their sum                */
+    H5Z_XFORM_OP_MINUS,        /* Pop two operands, push their difference         */
+    H5Z_XFORM_OP_MULT,         /* Pop two operands, push their product            */
+    H5Z_XFORM_OP_DIVIDE,       /* Pop two operands, push their quotient           */
+    H5Z_XFORM_OP_PLUS_CONST,   /* top = top + val                                 */
+    H5Z_XFORM_OP_MULT_CONST,   /* top = top * val                                 */
+    H5Z_XFORM_OP_DIVIDE_CONST, /* top = top / val                                 */
+    H5Z_XFORM_OP_CONST_MINUS,  /* top = val - top                                 */
+    H5Z_XFORM_OP_CONST_DIVIDE, /* top = val / top                                 */
+    H5Z_XFORM_OP_MULT_PLUS,    /* top = (top * val) + val2, rounded as two steps  */
+    H5Z_XFORM_OP_DIVIDE_PLUS   /* top = (top / val) + val2, rounded as two steps  */
+} H5Z_xform_opcode_t;
+
+typedef struct {
+    H5Z_xform_opcode_t op;   /* Operation to perform        */
+    double             val;  /* Constant operand            */
+    double             val2; /* Second constant (fused ops) */
+} H5Z_xform_instr_t;
+
+/* Postfix program evaluated over blocks of the data buffer */
+typedef struct {
+    H5Z_xform_instr_t *instrs;  /* Instructions, NULL if the tree could not be compiled */
+    size_t             ninstrs; /* Number of instructions                               */
+    unsigned           depth;   /* Maximum depth of the operand stack                   */
+    unsigned           nloads;  /* Number of H5Z_XFORM_OP_LOAD instructions             */
+} H5Z_xform_prog_t;
+
 struct H5Z_data_xform_t {
     char *           xform_exp;
     H5Z_node *       parse_root;
     H5Z_datval_ptrs *dat_val_pointers;
+    H5Z_xform_prog_t prog;
 };
 
 typedef struct result {
@@ -97,6 +128,11 @@ static void *     H5Z__xform_parse(const char *expression, H5Z_datval_ptrs *dat_
 static void *     H5Z__xform_copy_tree(H5Z_node *tree, H5Z_datval_ptrs *dat_val_pointers,
                                        H5Z_datval_ptrs *new_dat_val_pointers);
 static void       H5Z__xform_reduce_tree(H5Z_node *tree);
+static size_t     H5Z__xform_count_nodes(const H5Z_node *tree);
+static hbool_t    H5Z__xform_compile_node(const H5Z_node *tree, H5Z_xform_prog_t *prog, unsigned *depth);
+static herr_t     H5Z__xform_compile(H5Z_data_xform_t *data_xform_prop);
+static herr_t     H5Z__xform_eval_prog(const H5Z_xform_prog_t *prog, void *array, size_t array_size,
+                                       hid_t array_type);
 
 /* PGCC (11.8-0) has trouble with the command *p++ = *p OP tree_val. It increments P first before
  * doing the operation.  So I break down the command into two lines:
@@ -366,6 +402,154 @@ static void       H5Z__xform_reduce_tree(H5Z_node *tree);
         }                                                                                                    \
     }
 
+/* Number of elements evaluated at a time by a compiled transform.  Each slot of the
+ * operand stack holds one block, so the working set of a program stays in cache.
+ */
+#define H5Z_XFORM_BLOCK_NELMTS 512
+
+/* The H5Z_XFORM_BLOCK_OP macros apply one instruction of a compiled transform to a
+ * block of values, rounding each result to TYPE exactly as H5Z_XFORM_DO_OP1 does.
+ */
+/* top = top OP val */
+#define H5Z_XFORM_BLOCK_OP1(TYPE, P, OP, VAL, N)                                                             \
+    {                                                                                                        \
+        double c = (VAL);                                                                                    \
+        size_t u;                                                                                            \
+                                                                                                             \
+        for (u = 0; u < (N); u++)                                                                            \
+            (P)[u] = (TYPE)((double)(P)[u] OP c);                                                            \
+    }
+
+/* top = val OP top */
+#define H5Z_XFORM_BLOCK_OP2(TYPE, P, OP, VAL, N)                                                             \
+    {                                                                                                        \
+        double c = (VAL);                                                                                    \
+        size_t u;                                                                                            \
+                                                                                                             \
+        for (u = 0; u < (N); u++)                                                                            \
+            (P)[u] = (TYPE)(c OP(double)(P)[u]);                                                             \
+    }
+
+/* Pop the top two operands and push (next OP top), computed in TYPE */
+#define H5Z_XFORM_BLOCK_OP3(TYPE, P, OP, N)                                                                  \
+    {                                                                                                        \
+        size_t u;                                                                                            \
+                                                                                                             \
+        (P) -= H5Z_XFORM_BLOCK_NELMTS;                                                                       \
+        for (u = 0; u < (N); u++)                                                                            \
+            (P)[u] = (TYPE)((P)[u] OP(P)[u + H5Z_XFORM_BLOCK_NELMTS]);                                       \
+    }
+
+/* top = (top OP val) + val2, with the intermediate result rounded to TYPE */
+#define H5Z_XFORM_BLOCK_OP4(TYPE, P, OP, VAL, VAL2, N)                                                       \
+    {                                                                                                        \
+        double c  = (VAL);                                                                                   \
+        double c2 = (VAL2);                                                                                  \
+        size_t u;                                                                                            \
+                                                                                                             \
+        for (u = 0; u < (N); u++) {                                                                          \
+            TYPE t = (TYPE)((double)(P)[u] OP c);                                                            \
+                                                                                                             \
+            (P)[u] = (TYPE)((double)t + c2);                                                                 \
+        }                                                                                                    \
+    }
+
+/* Run the instructions of a compiled transform over the N elements of the
+ * current block.  The macro is expanded once with N constant, for full
+ * blocks, so the compiler can vectorize the loops without a remainder.
+ */
+#define H5Z_XFORM_RUN_PROG(TYPE, N)                                                                          \
+    {                                                                                                        \
+        size_t v;                                                                                            \
+                                                                                                             \
+        for (v = 0; v < prog->ninstrs; v++) {                                                                \
+            const H5Z_xform_instr_t *instr = &prog->instrs[v];                                               \
+                                                                                                             \
+            switch (instr->op) {                                                                             \
+                case H5Z_XFORM_OP_LOAD:                                                                      \
+                    if (NULL == stack)                                                                       \
+                        top = buf + off;                                                                     \
+                    else {                                                                                   \
+                        top = (top ? top + H5Z_XFORM_BLOCK_NELMTS : stack);                                  \
+                        H5MM_memcpy(top, buf + off, (N) * sizeof(TYPE));                                     \
+                    }                                                                                        \
+                    break;                                                                                   \
+                                                                                                             \
+                case H5Z_XFORM_OP_PLUS:                                                                      \
+                    H5Z_XFORM_BLOCK_OP3(TYPE, top, +, (N))                                                   \
+                    break;                                                                                   \
+                                                                                                             \
+                case H5Z_XFORM_OP_MINUS:                                                                     \
+                    H5Z_XFORM_BLOCK_OP3(TYPE, top, -, (N))                                                   \
+                    break;                                                                                   \
+                                                                                                             \
+                case H5Z_XFORM_OP_MULT:                                                                      \
+                    H5Z_XFORM_BLOCK_OP3(TYPE, top, *, (N))                                                   \
+                    break;                                                                                   \
+                                                                                                             \
+                case H5Z_XFORM_OP_DIVIDE:                                                                    \
+                    H5Z_XFORM_BLOCK_OP3(TYPE, top, /, (N))                                                   \
+                    break;                                                                                   \
+                                                                                                             \
+                case H5Z_XFORM_OP_PLUS_CONST:                                                                \
+                    H5Z_XFORM_BLOCK_OP1(TYPE, top, +, instr->val, (N))                                       \
+                    break;                                                                                   \
+                                                                                                             \
+                case H5Z_XFORM_OP_MULT_CONST:                                                                \
+                    H5Z_XFORM_BLOCK_OP1(TYPE, top, *, instr->val, (N))                                       \
+                    break;                                                                                   \
+                                                                                                             \
+                case H5Z_XFORM_OP_DIVIDE_CONST:                                                              \
+                    H5Z_XFORM_BLOCK_OP1(TYPE, top, /, instr->val, (N))                                       \
+                    break;                                                                                   \
+                                                                                                             \
+                case H5Z_XFORM_OP_CONST_MINUS:                                                               \
+                    H5Z_XFORM_BLOCK_OP2(TYPE, top, -, instr->val, (N))                                       \
+                    break;                                                                                   \
+                                                                                                             \
+                case H5Z_XFORM_OP_CONST_DIVIDE:                                                              \
+                    H5Z_XFORM_BLOCK_OP2(TYPE, top, /, instr->val, (N))                                       \
+                    break;                                                                                   \
+                                                                                                             \
+                case H5Z_XFORM_OP_MULT_PLUS:                                                                 \
+                    H5Z_XFORM_BLOCK_OP4(TYPE, top, *, instr->val, instr->val2, (N))                          \
+                    break;                                                                                   \
+                                                                                                             \
+                case H5Z_XFORM_OP_DIVIDE_PLUS:                                                               \
+                    H5Z_XFORM_BLOCK_OP4(TYPE, top, /, instr->val, instr->val2, (N))                          \
+                    break;                                                                                   \
+                                                                                                             \
+                default:                                                                                     \
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid data transform instruction")          \
+            } /* end switch */                                                                               \
+        }     /* end for */                                                                                  \
+    }
+
+/* Run a compiled transform over the whole array, one block at a time.  When the
+ * expression uses "x" only once, the program works directly on the array;
+ * otherwise operands live in the scratch stack and each result block is copied
+ * back to the array once the program finishes with it.
+ */
+#define H5Z_XFORM_DO_PROG(TYPE)                                                                              \
+    {                                                                                                        \
+        TYPE * buf   = (TYPE *)array;                                                                        \
+        TYPE * stack = (TYPE *)scratch;                                                                      \
+        size_t off, nelmts;                                                                                  \
+                                                                                                             \
+        for (off = 0; off < array_size; off += nelmts) {                                                     \
+            TYPE *top = NULL;                                                                                \
+                                                                                                             \
+            nelmts = MIN(array_size - off, H5Z_XFORM_BLOCK_NELMTS);                                          \
+            if (nelmts == H5Z_XFORM_BLOCK_NELMTS)                                                            \
+                H5Z_XFORM_RUN_PROG(TYPE, H5Z_XFORM_BLOCK_NELMTS)                                             \
+            else                                                                                             \
+                H5Z_XFORM_RUN_PROG(TYPE, nelmts)                                                             \
+                                                                                                             \
+            if (stack)                                                                                       \
+                H5MM_memcpy(buf + off, stack, nelmts * sizeof(TYPE));                                        \
+        } /* end for */                                                                                      \
+    }
+
 /*
  *  Programmer: Bill Wendling
  *              25. August 2003
@@ -1063,6 +1247,11 @@ H5Z_xform_eval(H5Z_data_xform_t *data_xform_prop, void *array, size_t array_size
 #endif
 
     } /* end if */
+    /* Run the compiled form of the transform, when there is one */
+    else if (data_xform_prop->prog.instrs) {
+        if (H5Z__xform_eval_prog(&data_xform_prop->prog, array, array_size, array_type) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
+    } /* end if */
     /* Otherwise, do the full data transform */
     else {
         /* Optimization for linear transform: */
@@ -1210,6 +1399,79 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5Z__xform_eval_full() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__xform_eval_prog
+ *
+ * Purpose:     Applies a compiled transform to array, evaluating the
+ *              program over one block of elements at a time.  Produces
+ *              the same values as H5Z__xform_eval_full, without making a
+ *              copy of the whole array for each "x" in the expression.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__xform_eval_prog(const H5Z_xform_prog_t *prog, void *array, size_t array_size, hid_t array_type)
+{
+    void * scratch   = NULL;    /* Operand stack, when "x" appears more than once */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(prog);
+    HDassert(prog->instrs);
+    HDassert(prog->nloads > 0);
+
+    /* A program with several loads needs a block of storage for each level of the operand stack */
+    if (prog->nloads > 1)
+        if (NULL == (scratch = H5MM_malloc((size_t)prog->depth * H5Z_XFORM_BLOCK_NELMTS *
+                                           H5T_get_size((H5T_t *)H5I_object(array_type)))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL,
+                        "Ran out of memory trying to allocate space for data in data transform")
+
+    if (array_type == H5T_NATIVE_CHAR)
+        H5Z_XFORM_DO_PROG(char)
+#if CHAR_MIN >= 0
+    else if (array_type == H5T_NATIVE_SCHAR)
+        H5Z_XFORM_DO_PROG(signed char)
+#else  /* CHAR_MIN >= 0 */
+    else if (array_type == H5T_NATIVE_UCHAR)
+        H5Z_XFORM_DO_PROG(unsigned char)
+#endif /* CHAR_MIN >= 0 */
+    else if (array_type == H5T_NATIVE_SHORT)
+        H5Z_XFORM_DO_PROG(short)
+    else if (array_type == H5T_NATIVE_USHORT)
+        H5Z_XFORM_DO_PROG(unsigned short)
+    else if (array_type == H5T_NATIVE_INT)
+        H5Z_XFORM_DO_PROG(int)
+    else if (array_type == H5T_NATIVE_UINT)
+        H5Z_XFORM_DO_PROG(unsigned int)
+    else if (array_type == H5T_NATIVE_LONG)
+        H5Z_XFORM_DO_PROG(long)
+    else if (array_type == H5T_NATIVE_ULONG)
+        H5Z_XFORM_DO_PROG(unsigned long)
+    else if (array_type == H5T_NATIVE_LLONG)
+        H5Z_XFORM_DO_PROG(long long)
+    else if (array_type == H5T_NATIVE_ULLONG)
+        H5Z_XFORM_DO_PROG(unsigned long long)
+    else if (array_type == H5T_NATIVE_FLOAT)
+        H5Z_XFORM_DO_PROG(float)
+    else if (array_type == H5T_NATIVE_DOUBLE)
+        H5Z_XFORM_DO_PROG(double)
+#if H5_SIZEOF_LONG_DOUBLE != 0
+    else if (array_type == H5T_NATIVE_LDOUBLE)
+        H5Z_XFORM_DO_PROG(long double)
+#endif
+
+done:
+    if (scratch)
+        H5MM_xfree(scratch);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__xform_eval_prog() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Z_find_type
  *
@@ -1498,6 +1760,192 @@ H5Z__do_op(H5Z_node *tree)
     FUNC_LEAVE_NOAPI_VOID;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__xform_count_nodes
+ *
+ * Purpose:     Counts the nodes in a parse tree, which bounds the number
+ *              of instructions the tree compiles to.
+ *
+ * Return:      Number of nodes in the tree
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__xform_count_nodes(const H5Z_node *tree)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (tree)
+        ret_value = 1 + H5Z__xform_count_nodes(tree->lchild) + H5Z__xform_count_nodes(tree->rchild);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__xform_count_nodes() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__xform_compile_node
+ *
+ * Purpose:     Appends the postfix instructions for a (reduced) parse
+ *              tree to prog.  An operation with a constant operand
+ *              becomes a single instruction that works on the top of the
+ *              operand stack.  An addition of a constant right after a
+ *              multiplication or division by a constant is folded into
+ *              that instruction.  *depth tracks the current depth of the
+ *              operand stack.
+ *
+ * Return:      TRUE if the tree was compiled, FALSE if it has a shape
+ *              that only H5Z__xform_eval_full handles
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5Z__xform_compile_node(const H5Z_node *tree, H5Z_xform_prog_t *prog, unsigned *depth)
+{
+    H5Z_xform_instr_t *instr;            /* Instruction being emitted */
+    const H5Z_node *   cnode;            /* Constant operand node */
+    double             cval;             /* Value of constant operand */
+    hbool_t            lconst, rconst;   /* Whether each operand is constant */
+    hbool_t            ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(tree);
+
+    if (tree->type == H5Z_XFORM_SYMBOL) {
+        instr     = &prog->instrs[prog->ninstrs++];
+        instr->op = H5Z_XFORM_OP_LOAD;
+        prog->nloads++;
+        if (++(*depth) > prog->depth)
+            prog->depth = *depth;
+        HGOTO_DONE(TRUE)
+    } /* end if */
+
+    if (tree->type != H5Z_XFORM_PLUS && tree->type != H5Z_XFORM_MINUS && tree->type != H5Z_XFORM_MULT &&
+        tree->type != H5Z_XFORM_DIVIDE)
+        HGOTO_DONE(FALSE)
+    if (NULL == tree->rchild)
+        HGOTO_DONE(FALSE)
+
+    /* A missing left operand (as in -x or +x) counts as the constant 0 */
+    lconst = (NULL == tree->lchild || tree->lchild->type == H5Z_XFORM_INTEGER ||
+              tree->lchild->type == H5Z_XFORM_FLOAT);
+    rconst = (tree->rchild->type == H5Z_XFORM_INTEGER || tree->rchild->type == H5Z_XFORM_FLOAT);
+
+    /* Both operands depend on the data */
+    if (!lconst && !rconst) {
+        if (!H5Z__xform_compile_node(tree->lchild, prog, depth) ||
+            !H5Z__xform_compile_node(tree->rchild, prog, depth))
+            HGOTO_DONE(FALSE)
+
+        instr = &prog->instrs[prog->ninstrs++];
+        if (tree->type == H5Z_XFORM_PLUS)
+            instr->op = H5Z_XFORM_OP_PLUS;
+        else if (tree->type == H5Z_XFORM_MINUS)
+            instr->op = H5Z_XFORM_OP_MINUS;
+        else if (tree->type == H5Z_XFORM_MULT)
+            instr->op = H5Z_XFORM_OP_MULT;
+        else
+            instr->op = H5Z_XFORM_OP_DIVIDE;
+        (*depth)--;
+        HGOTO_DONE(TRUE)
+    } /* end if */
+
+    /* Constant operations are folded by H5Z__xform_reduce_tree */
+    if (lconst && rconst)
+        HGOTO_DONE(FALSE)
+
+    /* Emit the operand that depends on the data, then apply the constant to it */
+    if (!H5Z__xform_compile_node(lconst ? tree->rchild : tree->lchild, prog, depth))
+        HGOTO_DONE(FALSE)
+    cnode = lconst ? tree->lchild : tree->rchild;
+    if (NULL == cnode)
+        cval = 0;
+    else
+        cval = (cnode->type == H5Z_XFORM_INTEGER ? (double)cnode->value.int_val : cnode->value.float_val);
+
+    /* Addition and multiplication by a constant are exact in either operand order,
+     * and subtracting a constant is the same as adding its negation.
+     */
+    if (tree->type == H5Z_XFORM_PLUS || (tree->type == H5Z_XFORM_MINUS && !lconst)) {
+        if (tree->type == H5Z_XFORM_MINUS)
+            cval = -cval;
+
+        /* Fold into a preceding multiplication or division by a constant */
+        instr = &prog->instrs[prog->ninstrs - 1];
+        if (instr->op == H5Z_XFORM_OP_MULT_CONST || instr->op == H5Z_XFORM_OP_DIVIDE_CONST) {
+            instr->op   = (instr->op == H5Z_XFORM_OP_MULT_CONST ? H5Z_XFORM_OP_MULT_PLUS
+                                                                 : H5Z_XFORM_OP_DIVIDE_PLUS);
+            instr->val2 = cval;
+            HGOTO_DONE(TRUE)
+        } /* end if */
+
+        instr     = &prog->instrs[prog->ninstrs++];
+        instr->op = H5Z_XFORM_OP_PLUS_CONST;
+    } /* end if */
+    else {
+        instr = &prog->instrs[prog->ninstrs++];
+        if (tree->type == H5Z_XFORM_MINUS)
+            instr->op = H5Z_XFORM_OP_CONST_MINUS;
+        else if (tree->type == H5Z_XFORM_MULT)
+            instr->op = H5Z_XFORM_OP_MULT_CONST;
+        else
+            instr->op = (lconst ? H5Z_XFORM_OP_CONST_DIVIDE : H5Z_XFORM_OP_DIVIDE_CONST);
+    } /* end else */
+    instr->val = cval;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__xform_compile_node() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__xform_compile
+ *
+ * Purpose:     Compiles the parse tree of a data transform into the
+ *              postfix program that H5Z_xform_eval runs.  Constant
+ *              expressions are not compiled, since H5Z_xform_eval fills
+ *              the buffer for them directly.  If the tree can't be
+ *              compiled, no program is stored and H5Z_xform_eval falls
+ *              back to H5Z__xform_eval_full.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__xform_compile(H5Z_data_xform_t *data_xform_prop)
+{
+    H5Z_xform_prog_t *prog      = &data_xform_prop->prog;
+    unsigned          depth     = 0;       /* Current depth of operand stack */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(data_xform_prop->parse_root);
+    HDassert(NULL == prog->instrs);
+
+    if (data_xform_prop->parse_root->type == H5Z_XFORM_INTEGER ||
+        data_xform_prop->parse_root->type == H5Z_XFORM_FLOAT)
+        HGOTO_DONE(SUCCEED)
+
+    if (NULL == (prog->instrs = (H5Z_xform_instr_t *)H5MM_calloc(
+                     H5Z__xform_count_nodes(data_xform_prop->parse_root) * sizeof(H5Z_xform_instr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate memory for compiled data transform")
+    prog->ninstrs = 0;
+    prog->depth   = 0;
+    prog->nloads  = 0;
+
+    if (!H5Z__xform_compile_node(data_xform_prop->parse_root, prog, &depth)) {
+        prog->instrs  = (H5Z_xform_instr_t *)H5MM_xfree(prog->instrs);
+        prog->ninstrs = 0;
+    } /* end if */
+    else
+        HDassert(depth == 1);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__xform_compile() */
+
 /*-------------------------------------------------------------------------
  * Function: H5Z_xform_create
  *
@@ -1568,6 +2016,10 @@ H5Z_xform_create(const char *expr)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL,
                     "error copying the parse tree, did not find correct number of \"variables\"")
 
+    /* Compile the expression, so that it doesn't have to be interpreted for each buffer */
+    if (H5Z__xform_compile(data_xform_prop) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "unable to compile data transform")
+
     /* Assign return value */
     ret_value = data_xform_prop;
 
@@ -1579,6 +2031,8 @@ done:
                 H5Z__xform_destroy_parse_tree(data_xform_prop->parse_root);
             if (data_xform_prop->xform_exp)
                 H5MM_xfree(data_xform_prop->xform_exp);
+            if (data_xform_prop->prog.instrs)
+                H5MM_xfree(data_xform_prop->prog.instrs);
             if (count > 0 && data_xform_prop->dat_val_pointers->ptr_dat_val)
                 H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val);
             if (data_xform_prop->dat_val_pointers)
@@ -1617,6 +2071,9 @@ H5Z_xform_destroy(H5Z_data_xform_t *data_xform_prop)
         /* Free the expression */
         H5MM_xfree(data_xform_prop->xform_exp);
 
+        /* Free the compiled expression */
+        H5MM_xfree(data_xform_prop->prog.instrs);
+
         /* Free the pointers to the temp. arrays, if there are any */
         if (data_xform_prop->dat_val_pointers->num_ptrs > 0)
             H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val);
@@ -1703,6 +2160,10 @@ H5Z_xform_copy(H5Z_data_xform_t **data_xform_prop)
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL,
                         "error copying the parse tree, did not find correct number of \"variables\"")
 
+        /* Compile the copied parse tree */
+        if (H5Z__xform_compile(new_data_xform_prop) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, FAIL, "unable to compile data transform")
+
         /* Copy new information on top of old information */
         *data_xform_prop = new_data_xform_prop;
     } /* end if */
@@ -1715,6 +2176,8 @@ done:
                 H5Z__xform_destroy_parse_tree(new_data_xform_prop->parse_root);
             if (new_data_xform_prop->xform_exp)
                 H5MM_xfree(new_data_xform_prop->xform_exp);
+            if (new_data_xform_prop->prog.instrs)
+                H5MM_xfree(new_data_xform_prop->prog.instrs);
             H5MM_xfree(new_data_xform_prop);
         } /* end if */
     }     /* end if */
@@ -0,0 +1,241 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "H5Zmodule.h" /* This source code file is part of the H5Z module */
+
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5Dprivate.h"  /* Datasets				*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5Fprivate.h"  /* Files				*/
+#include "H5Iprivate.h"  /* IDs			  		*/
+#include "H5Oprivate.h"  /* Object headers                       */
+#include "H5Pprivate.h"  /* Property lists                       */
+#include "H5Tprivate.h"  /* Datatypes         			*/
+#include "H5Zpkg.h"      /* Data filters				*/
+
+/* Local function prototypes */
+static htri_t H5Z__can_apply_vlpack(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+static herr_t H5Z__set_local_vlpack(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+static size_t H5Z__filter_vlpack(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                                 size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_VLPACK[1] = {{
+    H5Z_CLASS_T_VERS,      /* H5Z_class_t version */
+    H5Z_FILTER_VLPACK,     /* Filter id number		*/
+    1,                     /* encoder_present flag (set to true) */
+    1,                     /* decoder_present flag (set to true) */
+    "vlpack",              /* Filter name for debugging	*/
+    H5Z__can_apply_vlpack, /* The "can apply" callback     */
+    H5Z__set_local_vlpack, /* The "set local" callback     */
+    H5Z__filter_vlpack,    /* The actual filter function	*/
+}};
+
+/* Local macros */
+#define H5Z_VLPACK_PARM_SIZE 0 /* "Local" parameter for the size of a sequence element */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__can_apply_vlpack
+ *
+ * Purpose:	Check the parameters for variable-length packing for
+ *              validity and whether they fit a particular dataset.
+ *
+ *              The chunks of a packed dataset hold the element data in
+ *              place of global heap IDs, which the rest of the library
+ *              (fill values, early allocation, unfiltered edge chunks)
+ *              knows nothing about, so those options are rejected, as
+ *              are sequences of variable-length data.  Packing must be
+ *              the first filter in the pipeline.
+ *
+ * Return:	Success: Non-negative
+ *		Failure: Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5Z__can_apply_vlpack(hid_t dcpl_id, hid_t type_id, hid_t H5_ATTR_UNUSED space_id)
+{
+    H5P_genplist_t * dcpl_plist;       /* Property list pointer */
+    const H5T_t *    type;             /* Datatype */
+    H5T_t *          super = NULL;     /* Base type of the datatype */
+    htri_t           is_vl_storage;    /* Whether the base type is stored as VL data */
+    H5O_pline_t      pline;            /* Filter pipeline */
+    H5O_fill_t       fill;             /* Fill value info */
+    H5D_fill_value_t fill_status;      /* Whether/how the fill value is defined */
+    H5O_layout_t     layout;           /* Layout info */
+    htri_t           ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Get the plist structure */
+    if (NULL == (dcpl_plist = H5P_object_verify(dcpl_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get datatype */
+    if (NULL == (type = (const H5T_t *)H5I_object_verify(type_id, H5I_DATATYPE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+
+    /* Only variable-length strings and sequences of fixed-size data can be packed */
+    if (H5T_get_class(type, TRUE) != H5T_VLEN)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FALSE, "datatype class not supported by vlpack")
+    if (NULL == (super = H5T_get_super(type)))
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get base datatype")
+    if ((is_vl_storage = H5T_is_vl_storage(super)) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't check base datatype")
+    if (is_vl_storage || H5T_detect_class(super, H5T_REFERENCE, FALSE) > 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FALSE, "base datatype not supported by vlpack")
+
+    /* Packing must come before any other filter */
+    if (H5P_peek(dcpl_plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get pipeline")
+    if (0 == pline.nused || pline.filter[0].id != H5Z_FILTER_VLPACK)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FALSE, "vlpack must be the first filter in the pipeline")
+
+    /* Packed chunks can't hold fill values */
+    if (H5P_peek(dcpl_plist, H5D_CRT_FILL_VALUE_NAME, &fill) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get fill value")
+    if (H5P_is_fill_value_defined(&fill, &fill_status) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+    if (fill_status == H5D_FILL_VALUE_USER_DEFINED)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FALSE, "vlpack doesn't support fill values")
+    if (fill.alloc_time == H5D_ALLOC_TIME_EARLY)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FALSE, "vlpack doesn't support early allocation")
+
+    /* Every chunk must go through the filter pipeline */
+    if (H5P_peek(dcpl_plist, H5D_CRT_LAYOUT_NAME, &layout) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get layout")
+    if (layout.type == H5D_CHUNKED &&
+        (layout.u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS))
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FALSE, "vlpack requires partial edge chunks to be filtered")
+
+done:
+    if (super && H5T_close_real(super) < 0)
+        HDONE_ERROR(H5E_PLINE, H5E_CANTCLOSEOBJ, FAIL, "can't close base datatype")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__can_apply_vlpack() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__set_local_vlpack
+ *
+ * Purpose:	Set the "local" dataset parameter for variable-length
+ *              packing to be the size of a sequence element.
+ *
+ * Return:	Success: Non-negative
+ *		Failure: Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__set_local_vlpack(hid_t dcpl_id, hid_t type_id, hid_t H5_ATTR_UNUSED space_id)
+{
+    H5P_genplist_t *dcpl_plist;                         /* Property list pointer */
+    const H5T_t *   type;                               /* Datatype */
+    H5T_t *         super = NULL;                       /* Base type of the datatype */
+    unsigned        flags;                              /* Filter flags */
+    size_t          cd_nelmts = H5Z_VLPACK_USER_NPARMS; /* Number of filter parameters */
+    unsigned        cd_values[H5Z_VLPACK_TOTAL_NPARMS]; /* Filter parameters */
+    herr_t          ret_value = SUCCEED;                /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Get the plist structure */
+    if (NULL == (dcpl_plist = H5P_object_verify(dcpl_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get datatype */
+    if (NULL == (type = (const H5T_t *)H5I_object_verify(type_id, H5I_DATATYPE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+
+    /* Get the filter's current parameters */
+    if (H5P_get_filter_by_id(dcpl_plist, H5Z_FILTER_VLPACK, &flags, &cd_nelmts, cd_values, (size_t)0, NULL,
+                             NULL) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get vlpack parameters")
+
+    /* Set "local" parameter for this dataset */
+    if (NULL == (super = H5T_get_super(type)))
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get base datatype")
+    if ((cd_values[H5Z_VLPACK_PARM_SIZE] = (unsigned)H5T_get_size(super)) == 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FAIL, "bad datatype size")
+
+    /* Modify the filter's parameters for this dataset */
+    if (H5P_modify_filter(dcpl_plist, H5Z_FILTER_VLPACK, flags, (size_t)H5Z_VLPACK_TOTAL_NPARMS, cd_values) <
+        0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTSET, FAIL, "can't set local vlpack parameters")
+
+done:
+    if (super && H5T_close_real(super) < 0)
+        HDONE_ERROR(H5E_PLINE, H5E_CANTCLOSEOBJ, FAIL, "can't close base datatype")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__set_local_vlpack() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_vlpack
+ *
+ * Purpose:	Implement the variable-length packing filter.  Chunks are
+ *              packed and unpacked by the dataset code, which has the
+ *              datatype conversion machinery at hand; in either direction
+ *              this filter only checks that the buffer is a well-formed
+ *              packed chunk, so that damaged data is caught before it is
+ *              unpacked or compressed.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__filter_vlpack(unsigned H5_ATTR_UNUSED flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                   size_t H5_ATTR_UNUSED *buf_size, void **buf)
+{
+    const uint8_t *p = (const uint8_t *)*buf; /* Pointer into the header */
+    size_t         nelmts;                    /* Number of elements in chunk */
+    size_t         hdr_size;                  /* Size of the chunk's header */
+    size_t         data_size;                 /* Size of the element data */
+    uint32_t       end      = 0;              /* End of an element's data */
+    uint32_t       prev_end = 0;              /* End of the previous element's data */
+    size_t         u;                         /* Local index variable */
+    size_t         ret_value = 0;             /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments */
+    if (cd_nelmts != H5Z_VLPACK_TOTAL_NPARMS || cd_values[H5Z_VLPACK_PARM_SIZE] == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid vlpack parameters")
+
+    /* Check the header */
+    if (nbytes < 4)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "packed chunk is too small")
+    UINT32DECODE(p, nelmts);
+    if (nelmts > (nbytes - 4) / 4)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "packed chunk is too small")
+    hdr_size = 4 + (4 * nelmts) + ((nelmts + 7) / 8);
+    if (nbytes < hdr_size)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "packed chunk is too small")
+    data_size = nbytes - hdr_size;
+
+    /* Check the element offsets */
+    for (u = 0; u < nelmts; u++) {
+        UINT32DECODE(p, end);
+        if (end < prev_end)
+            HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "packed element offsets out of order")
+        prev_end = end;
+    } /* end for */
+    if ((size_t)end != data_size)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, 0, "packed element data has wrong size")
+
+    ret_value = nbytes;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_vlpack() */
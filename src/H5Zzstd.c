@@ -0,0 +1,403 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The Zstandard filter.  Each chunk is compressed into a single
+ *          Zstandard frame that records the size of the uncompressed data,
+ *          which is the format written by The HDF Group's Zstandard plugin
+ *          with the same filter ID.
+ *
+ *          The first client data value is the compression level.  If a
+ *          dictionary is used, the second value is its size in bytes and
+ *          the following values hold its bytes, four to a value starting
+ *          with the least significant byte.  Data compressed with a
+ *          dictionary can only be read with the same dictionary, so not
+ *          by the plugin, which ignores the values after the level.
+ */
+
+#include "H5Zmodule.h" /* This source code file is part of the H5Z module */
+
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5MMprivate.h" /* Memory management			*/
+#include "H5Zpkg.h"      /* Data filters				*/
+
+#ifdef H5_HAVE_FILTER_ZSTD
+
+#ifdef H5_HAVE_ZSTD_H
+#include "zstd.h"
+#endif
+
+/* Local macros */
+#define H5Z_ZSTD_NDICTS 4 /* Number of dictionaries whose digested forms are cached */
+
+/* Local typedefs */
+
+/* A dictionary, with the digested forms built from it for compression and
+ * decompression.  The dictionary is identified by the client data values
+ * that hold it, starting with its size.
+ */
+typedef struct H5Z_zstd_dict_t {
+    unsigned *  values;  /* Copy of the client data values holding the dictionary */
+    size_t      nvalues; /* Number of values */
+    ZSTD_CDict *cdict;   /* Dictionary digested for compression, or NULL */
+    int         clevel;  /* Compression level 'cdict' was built for */
+    ZSTD_DDict *ddict;   /* Dictionary digested for decompression, or NULL */
+} H5Z_zstd_dict_t;
+
+/* Local function prototypes */
+static size_t H5Z__filter_zstd(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                               size_t *buf_size, void **buf);
+static void   H5Z__zstd_dict_free(H5Z_zstd_dict_t *dict);
+static herr_t H5Z__zstd_find_dict(size_t cd_nelmts, const unsigned cd_values[], H5Z_zstd_dict_t **dict);
+static void * H5Z__zstd_unpack_dict(const H5Z_zstd_dict_t *dict, size_t *dict_size);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_ZSTD[1] = {{
+    H5Z_CLASS_T_VERS, /* H5Z_class_t version */
+    H5Z_FILTER_ZSTD,  /* Filter id number		*/
+    1,                /* encoder_present flag (set to true) */
+    1,                /* decoder_present flag (set to true) */
+    "zstd",           /* Filter name for debugging	*/
+    NULL,             /* The "can apply" callback     */
+    NULL,             /* The "set local" callback     */
+    H5Z__filter_zstd, /* The actual filter function	*/
+}};
+
+/* Compression and decompression contexts, kept between calls so that
+ * their work space is only allocated once.
+ */
+static ZSTD_CCtx *H5Z_zstd_cctx_g = NULL;
+static ZSTD_DCtx *H5Z_zstd_dctx_g = NULL;
+
+/* Recently used dictionaries, most recently used first, so that each is
+ * only unpacked and digested once rather than for every chunk.
+ */
+static H5Z_zstd_dict_t H5Z_zstd_dicts_g[H5Z_ZSTD_NDICTS];
+static size_t          H5Z_zstd_ndicts_g = 0;
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__zstd_term
+ *
+ * Purpose:	Free the Zstandard contexts and dictionaries kept between
+ *              calls to the filter.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5Z__zstd_term(void)
+{
+    size_t u; /* Local index variable */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (H5Z_zstd_cctx_g) {
+        ZSTD_freeCCtx(H5Z_zstd_cctx_g);
+        H5Z_zstd_cctx_g = NULL;
+    } /* end if */
+    if (H5Z_zstd_dctx_g) {
+        ZSTD_freeDCtx(H5Z_zstd_dctx_g);
+        H5Z_zstd_dctx_g = NULL;
+    } /* end if */
+    for (u = 0; u < H5Z_zstd_ndicts_g; u++)
+        H5Z__zstd_dict_free(&H5Z_zstd_dicts_g[u]);
+    H5Z_zstd_ndicts_g = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__zstd_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__zstd_dict_free
+ *
+ * Purpose:	Free a cached dictionary and its digested forms.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__zstd_dict_free(H5Z_zstd_dict_t *dict)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    if (dict->cdict)
+        ZSTD_freeCDict(dict->cdict);
+    if (dict->ddict)
+        ZSTD_freeDDict(dict->ddict);
+    H5MM_xfree(dict->values);
+    HDmemset(dict, 0, sizeof(*dict));
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__zstd_dict_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__zstd_find_dict
+ *
+ * Purpose:	Look up the dictionary stored in the filter's client data
+ *              values, if there is one, among the cached dictionaries,
+ *              adding it to the cache if it isn't there.  The least
+ *              recently used dictionary is evicted when the cache is
+ *              full.
+ *
+ *              *DICT is set to NULL if there is no dictionary.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__zstd_find_dict(size_t cd_nelmts, const unsigned cd_values[], H5Z_zstd_dict_t **dict)
+{
+    const unsigned *values;              /* Client data values holding the dictionary */
+    size_t          nvalues;             /* Number of values */
+    size_t          dict_size;           /* Size of the dictionary */
+    H5Z_zstd_dict_t found;               /* Dictionary found or added */
+    size_t          u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    *dict = NULL;
+
+    if (cd_nelmts <= H5Z_ZSTD_PARM_DICT_SIZE || 0 == cd_values[H5Z_ZSTD_PARM_DICT_SIZE])
+        HGOTO_DONE(SUCCEED)
+
+    dict_size = cd_values[H5Z_ZSTD_PARM_DICT_SIZE];
+    if (dict_size > (cd_nelmts - H5Z_ZSTD_PARM_DICT) * 4)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FAIL, "Zstandard dictionary is truncated")
+    values  = cd_values + H5Z_ZSTD_PARM_DICT_SIZE;
+    nvalues = 1 + (dict_size + 3) / 4;
+
+    /* Look for the dictionary among the cached ones */
+    for (u = 0; u < H5Z_zstd_ndicts_g; u++)
+        if (H5Z_zstd_dicts_g[u].nvalues == nvalues &&
+            0 == HDmemcmp(H5Z_zstd_dicts_g[u].values, values, nvalues * sizeof(unsigned)))
+            break;
+
+    if (u < H5Z_zstd_ndicts_g)
+        found = H5Z_zstd_dicts_g[u];
+    else {
+        /* Make room for the dictionary, evicting the least recently used one */
+        if (H5Z_zstd_ndicts_g == H5Z_ZSTD_NDICTS)
+            H5Z__zstd_dict_free(&H5Z_zstd_dicts_g[H5Z_ZSTD_NDICTS - 1]);
+        else
+            H5Z_zstd_ndicts_g++;
+        u = H5Z_zstd_ndicts_g - 1;
+
+        HDmemset(&found, 0, sizeof(found));
+        if (NULL == (found.values = (unsigned *)H5MM_malloc(nvalues * sizeof(unsigned)))) {
+            /* Drop the free slot at the end again */
+            H5Z_zstd_ndicts_g--;
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for Zstandard dictionary")
+        } /* end if */
+        H5MM_memcpy(found.values, values, nvalues * sizeof(unsigned));
+        found.nvalues = nvalues;
+    } /* end else */
+
+    /* Move the dictionary to the front of the cache */
+    HDmemmove(&H5Z_zstd_dicts_g[1], &H5Z_zstd_dicts_g[0], u * sizeof(H5Z_zstd_dict_t));
+    H5Z_zstd_dicts_g[0] = found;
+
+    *dict = &H5Z_zstd_dicts_g[0];
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__zstd_find_dict() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__zstd_unpack_dict
+ *
+ * Purpose:	Unpack the bytes of a cached dictionary from its client
+ *              data values, to digest them.
+ *
+ * Return:	Success: Pointer to the dictionary, which the caller must
+ *                       free
+ *		Failure: NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5Z__zstd_unpack_dict(const H5Z_zstd_dict_t *dict, size_t *dict_size)
+{
+    uint8_t *p;                /* Pointer into the dictionary */
+    size_t   u;                /* Local index variable */
+    void *   ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    *dict_size = dict->values[0];
+    if (NULL == (ret_value = H5MM_malloc(*dict_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for Zstandard dictionary")
+    p = (uint8_t *)ret_value;
+    for (u = 0; u < *dict_size; u++)
+        p[u] = (uint8_t)((dict->values[1 + u / 4] >> (8 * (u % 4))) & 0xff);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__zstd_unpack_dict() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_zstd
+ *
+ * Purpose:	Implement an I/O filter around the Zstandard compression
+ *              algorithm in libzstd
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z__filter_zstd(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                 size_t *buf_size, void **buf)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    ret_value = H5Z__filter_with_scratch(H5Z__filter_zstd_scratch, flags, cd_nelmts, cd_values, nbytes,
+                                         buf_size, buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_zstd() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__filter_zstd_scratch
+ *
+ * Purpose:	Zstandard filter, writing the [un]compressed data to the
+ *              pipeline's scratch buffer, which is then exchanged with the
+ *              input buffer.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5Z__filter_zstd_scratch(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
+                         size_t *buf_size, void **buf, size_t *scratch_size, void **scratch)
+{
+    H5Z_zstd_dict_t *dict      = NULL; /* Dictionary */
+    void *           dict_buf  = NULL; /* Unpacked dictionary, to digest it */
+    size_t           dict_size = 0;    /* Size of dictionary */
+    size_t           status;           /* Status from Zstandard operation */
+    size_t           ret_value = 0;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(*buf_size > 0);
+    HDassert(buf);
+    HDassert(*buf);
+
+    /* Get the dictionary, if there is one */
+    if (H5Z__zstd_find_dict(cd_nelmts, cd_values, &dict) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, 0, "can't get Zstandard dictionary")
+
+    if (flags & H5Z_FLAG_REVERSE) {
+        /* Input; uncompress */
+        unsigned long long orig_size; /* Size of the uncompressed data */
+
+        /* Get the size of the uncompressed data from the frame header */
+        orig_size = ZSTD_getFrameContentSize(*buf, nbytes);
+        if (ZSTD_CONTENTSIZE_ERROR == orig_size || ZSTD_CONTENTSIZE_UNKNOWN == orig_size ||
+            orig_size != (unsigned long long)(size_t)orig_size)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "invalid Zstandard frame header")
+
+        /* Get space for the uncompressed data */
+        if (H5Z__scratch_reserve(MAX((size_t)orig_size, 1), scratch_size, scratch) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for Zstandard uncompression")
+
+        if (NULL == H5Z_zstd_dctx_g && NULL == (H5Z_zstd_dctx_g = ZSTD_createDCtx()))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "can't create Zstandard decompression context")
+
+        /* Digest the dictionary for decompression, if that hasn't been done yet */
+        if (dict && NULL == dict->ddict) {
+            if (NULL == (dict_buf = H5Z__zstd_unpack_dict(dict, &dict_size)))
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, 0, "can't unpack Zstandard dictionary")
+            if (NULL == (dict->ddict = ZSTD_createDDict(dict_buf, dict_size)))
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "can't create Zstandard decompression dictionary")
+        } /* end if */
+
+        /* Uncompress the frame */
+        if (dict)
+            status = ZSTD_decompress_usingDDict(H5Z_zstd_dctx_g, *scratch, (size_t)orig_size, *buf, nbytes,
+                                                dict->ddict);
+        else
+            status = ZSTD_decompressDCtx(H5Z_zstd_dctx_g, *scratch, (size_t)orig_size, *buf, nbytes);
+        if (ZSTD_isError(status))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "Zstandard uncompression failed: %s",
+                        ZSTD_getErrorName(status))
+        if (status != (size_t)orig_size)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "Zstandard data is truncated")
+
+        /* Return the uncompressed data, keeping the input buffer as scratch space */
+        H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
+
+        /* Set return value */
+        ret_value = (size_t)orig_size;
+    } /* end if */
+    else {
+        /* Output; compress */
+        int    level = 0; /* Compression level, or 0 for the default */
+        size_t out_size;  /* Largest size of the compressed data */
+
+        if (cd_nelmts > H5Z_ZSTD_PARM_LEVEL)
+            level = (int)cd_values[H5Z_ZSTD_PARM_LEVEL];
+
+        /* Get space for the compressed data */
+        out_size = ZSTD_compressBound(nbytes);
+        if (H5Z__scratch_reserve(out_size, scratch_size, scratch) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "unable to allocate Zstandard destination buffer")
+
+        if (NULL == H5Z_zstd_cctx_g && NULL == (H5Z_zstd_cctx_g = ZSTD_createCCtx()))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "can't create Zstandard compression context")
+
+        /* Digest the dictionary for compression at this level, if that hasn't been done yet */
+        if (dict && (NULL == dict->cdict || dict->clevel != level)) {
+            if (dict->cdict) {
+                ZSTD_freeCDict(dict->cdict);
+                dict->cdict = NULL;
+            } /* end if */
+            if (NULL == (dict_buf = H5Z__zstd_unpack_dict(dict, &dict_size)))
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, 0, "can't unpack Zstandard dictionary")
+            if (NULL == (dict->cdict = ZSTD_createCDict(dict_buf, dict_size, level)))
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, 0, "can't create Zstandard compression dictionary")
+            dict->clevel = level;
+        } /* end if */
+
+        /* Compress the data into a single frame */
+        if (dict)
+            status = ZSTD_compress_usingCDict(H5Z_zstd_cctx_g, *scratch, out_size, *buf, nbytes,
+                                              dict->cdict);
+        else
+            status = ZSTD_compressCCtx(H5Z_zstd_cctx_g, *scratch, out_size, *buf, nbytes, level);
+        if (ZSTD_isError(status))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, 0, "Zstandard compression failed: %s",
+                        ZSTD_getErrorName(status))
+
+        /* Return the compressed data, keeping the input buffer as scratch space */
+        H5Z__scratch_swap(buf_size, buf, scratch_size, scratch);
+
+        /* Set return value */
+        ret_value = status;
+    } /* end else */
+
+done:
+    if (dict_buf)
+        H5MM_xfree(dict_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_zstd_scratch() */
+#endif /* H5_HAVE_FILTER_ZSTD */
@@ -138,6 +138,10 @@
 #include <sys/ioctl.h>
 #endif
 
+#ifdef H5_HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
 /*
  * System information. These are needed on the DEC Alpha to turn off fixing
  * of unaligned accesses by the operating system during detection of
@@ -378,6 +382,7 @@
 #endif
 #ifdef H5_HAVE_NETINET_IN_H
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #endif
 #ifdef H5_HAVE_SYS_SOCKET_H
 #include <sys/socket.h>
@@ -1217,9 +1222,15 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDmktime
 #define HDmktime(T) mktime(T)
 #endif /* HDmktime */
+#ifndef HDmmap
+#define HDmmap(A, L, P, F, D, O) mmap(A, L, P, F, D, O)
+#endif /* HDmmap */
 #ifndef HDmodf
 #define HDmodf(X, Y) modf(X, Y)
 #endif /* HDmodf */
+#ifndef HDmunmap
+#define HDmunmap(A, L) munmap(A, L)
+#endif /* HDmunmap */
 #ifndef HDnanosleep
 #define HDnanosleep(N, O) nanosleep(N, O)
 #endif /* HDnanosleep */
@@ -1247,6 +1258,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpipe
 #define HDpipe(F) pipe(F)
 #endif /* HDpipe */
+#ifndef HDposix_fadvise
+#define HDposix_fadvise(F, O, L, A) posix_fadvise(F, O, L, A)
+#endif /* HDposix_fadvise */
 #ifndef HDpow
 #define HDpow(X, Y) pow(X, Y)
 #endif /* HDpow */
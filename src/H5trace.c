@@ -963,6 +963,33 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                         }     /* end else */
                         break;
 
+                    case 'l':
+                        if (ptr) {
+                            if (vp)
+                                HDfprintf(out, "0x%p", vp);
+                            else
+                                HDfprintf(out, "NULL");
+                        } /* end if */
+                        else {
+                            H5F_mdc_log_format_t format = (H5F_mdc_log_format_t)HDva_arg(ap, int);
+
+                            switch (format) {
+                                case H5F_MDC_LOG_FORMAT_JSON:
+                                    HDfprintf(out, "H5F_MDC_LOG_FORMAT_JSON");
+                                    break;
+
+                                case H5F_MDC_LOG_FORMAT_BINARY:
+                                    HDfprintf(out, "H5F_MDC_LOG_FORMAT_BINARY");
+                                    break;
+
+                                case H5F_MDC_LOG_FORMAT_NTYPES:
+                                default:
+                                    HDfprintf(out, "%ld", (long)format);
+                                    break;
+                            } /* end switch */
+                        }     /* end else */
+                        break;
+
                     case 'm':
                         if (ptr) {
                             if (vp)
@@ -1014,6 +1041,33 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                         }     /* end else */
                         break;
 
+                    case 'p':
+                        if (ptr) {
+                            if (vp)
+                                HDfprintf(out, "0x%p", vp);
+                            else
+                                HDfprintf(out, "NULL");
+                        } /* end if */
+                        else {
+                            H5F_page_buf_policy_t policy = (H5F_page_buf_policy_t)HDva_arg(ap, int);
+
+                            switch (policy) {
+                                case H5F_PAGE_BUF_POLICY_LRU:
+                                    HDfprintf(out, "H5F_PAGE_BUF_POLICY_LRU");
+                                    break;
+
+                                case H5F_PAGE_BUF_POLICY_2Q:
+                                    HDfprintf(out, "H5F_PAGE_BUF_POLICY_2Q");
+                                    break;
+
+                                case H5F_PAGE_BUF_POLICY_NTYPES:
+                                default:
+                                    HDfprintf(out, "%ld", (long)policy);
+                                    break;
+                            } /* end switch */
+                        }     /* end else */
+                        break;
+
                     case 's':
                         if (ptr) {
                             if (vp)
@@ -3291,6 +3345,9 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                                 case H5VL_NATIVE_DATASET_GET_OFFSET:
                                     HDfprintf(out, "H5VL_NATIVE_DATASET_GET_OFFSET");
                                     break;
+                                case H5VL_NATIVE_DATASET_READ_MAPPED:
+                                    HDfprintf(out, "H5VL_NATIVE_DATASET_READ_MAPPED");
+                                    break;
                                 default:
                                     HDfprintf(out, "%ld", (long)optional);
                                     break;
@@ -365,6 +365,7 @@ set (test_CLEANFILES
     earray_tmp.h5
     efc*.h5
     log_vfd_out.log
+    log_vfd_out.bin
     log_ros3_out.log
     log_s3comms_out.log
     new_multi_file_v16-r.h5
@@ -394,6 +395,9 @@ set (test_CLEANFILES
     test_swmr*.h5
     cache_logging.h5
     cache_logging.out
+    cache_logging.bin
+    cache_logging_evict.h5
+    cache_logging_evict.bin
     vds_swmr.h5
     vds_swmr_src_*.h5
     swmr*.h5
@@ -409,6 +413,7 @@ set (test_CLEANFILES
     splitter.log
     mirror_rw/*
     mirror_wo/*
+    ros3_server.log
 )
 
 # Remove any output file left over from previous test run
@@ -428,6 +433,12 @@ set (H5TEST_SEPARATE_TESTS
     flush2
     vds_env
 )
+if (H5_HAVE_MIRROR_VFD)
+  list (APPEND H5TEST_SEPARATE_TESTS mirror_vfd)
+endif ()
+if (H5_HAVE_ROS3_VFD)
+  list (APPEND H5TEST_SEPARATE_TESTS ros3)
+endif ()
 foreach (h5_test ${H5_TESTS})
   if (NOT h5_test IN_LIST H5TEST_SEPARATE_TESTS)
     if (HDF5_ENABLE_USING_MEMCHECKER)
@@ -465,6 +476,14 @@ foreach (h5_test ${H5_TESTS})
   endif ()
 endforeach ()
 
+# The binary metadata cache log written by cache_logging is read by the
+# h5mdclog tests
+set_tests_properties (H5TEST-cache_logging PROPERTIES FIXTURES_SETUP mdc_binary_log)
+
+# The binary log written by the log VFD test in vfd is read by the h5fdlog
+# tests
+set_tests_properties (H5TEST-vfd PROPERTIES FIXTURES_SETUP vfd_binary_log)
+
 set_tests_properties (H5TEST-fheap PROPERTIES TIMEOUT ${CTEST_VERY_LONG_TIMEOUT})
 set_tests_properties (H5TEST-big PROPERTIES TIMEOUT ${CTEST_VERY_LONG_TIMEOUT})
 set_tests_properties (H5TEST-btree2 PROPERTIES TIMEOUT ${CTEST_VERY_LONG_TIMEOUT})
@@ -643,6 +662,75 @@ set_tests_properties (H5TEST-flush2 PROPERTIES
     DEPENDS H5TEST-flush1
 )
 
+#-- Adding test for mirror_vfd, using the Mirror Server that
+#-- utils/mirror_vfd starts on the loopback interface
+if (H5_HAVE_MIRROR_VFD)
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME H5TEST-mirror_vfd COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:mirror_vfd>)
+  else ()
+    add_test (NAME H5TEST-mirror_vfd COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:mirror_vfd>"
+        -D "TEST_ARGS:STRING="
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=mirror_vfd.txt"
+        -D "TEST_FOLDER=${HDF5_TEST_BINARY_DIR}/H5TEST"
+        -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (H5TEST-mirror_vfd PROPERTIES
+      FIXTURES_REQUIRED "clear_H5TEST;mirror_server"
+      RESOURCE_LOCK mirror_server_port
+      ENVIRONMENT "srcdir=${HDF5_TEST_BINARY_DIR}/H5TEST"
+      WORKING_DIRECTORY ${HDF5_TEST_BINARY_DIR}/H5TEST
+  )
+endif ()
+
+#-- Adding test for ros3, with the block cache tests reading a reference
+#-- file from a local HTTP server that honors Range requests
+if (H5_HAVE_ROS3_VFD)
+  set (ROS3_SERVER_PORT 3080)
+  add_test (NAME H5TEST-ros3_server-start
+      COMMAND sh -c "\"$<TARGET_FILE:ros3_server>\" --port=${ROS3_SERVER_PORT} > ros3_server.log 2>&1 & sleep 1"
+      WORKING_DIRECTORY ${HDF5_TEST_BINARY_DIR}/H5TEST
+  )
+  set_tests_properties (H5TEST-ros3_server-start PROPERTIES
+      FIXTURES_SETUP ros3_server
+      FIXTURES_REQUIRED clear_H5TEST
+      RESOURCE_LOCK ros3_server_port
+  )
+  add_test (NAME H5TEST-ros3_server-stop
+      COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:ros3_server> --port=${ROS3_SERVER_PORT} --stop
+  )
+  set_tests_properties (H5TEST-ros3_server-stop PROPERTIES
+      FIXTURES_CLEANUP ros3_server
+      RESOURCE_LOCK ros3_server_port
+      WORKING_DIRECTORY ${HDF5_TEST_BINARY_DIR}/H5TEST
+  )
+
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME H5TEST-ros3 COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:ros3>)
+  else ()
+    add_test (NAME H5TEST-ros3 COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:ros3>"
+        -D "TEST_ARGS:STRING="
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=ros3.txt"
+        -D "TEST_FOLDER=${HDF5_TEST_BINARY_DIR}/H5TEST"
+        -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (H5TEST-ros3 PROPERTIES
+      FIXTURES_REQUIRED "clear_H5TEST;ros3_server"
+      RESOURCE_LOCK ros3_server_port
+      ENVIRONMENT "srcdir=${HDF5_TEST_BINARY_DIR}/H5TEST;HDF5_ROS3_TEST_CACHE_URL=http://127.0.0.1:${ROS3_SERVER_PORT}/le_data.h5"
+      WORKING_DIRECTORY ${HDF5_TEST_BINARY_DIR}/H5TEST
+  )
+endif ()
+
 #-- Adding test for tcheck_version
 add_test (NAME H5TEST-tcheck_version-major COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:tcheck_version> "-tM")
 set_tests_properties (H5TEST-tcheck_version-major PROPERTIES
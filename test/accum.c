@@ -41,6 +41,12 @@ const char *FILENAME[] = {"accum", "accum_swmr_big", NULL};
 #define RAND_SEG_LEN        (1024)
 #define RANDOM_BASE_OFF     (1024 * 1024)
 
+/* Multiple accumulator test values */
+#define MULTI_LOW_OFF  (64 * 1024)
+#define MULTI_HIGH_OFF (4 * 1024 * 1024)
+#define MULTI_SEG_LEN  256
+#define MULTI_BIG_LEN  ((1024 * 1024) - 1)
+
 /* Function Prototypes */
 unsigned test_write_read(H5F_t *f);
 unsigned test_write_read_nonacc_front(H5F_t *f);
@@ -54,10 +60,12 @@ unsigned test_read_after(H5F_t *f);
 unsigned test_free(H5F_t *f);
 unsigned test_big(H5F_t *f);
 unsigned test_random_write(H5F_t *f);
+unsigned test_multiple_accum(H5F_t *f);
 unsigned test_swmr_write_big(hbool_t newest_format);
 
 /* Helper Function Prototypes */
-void accum_printf(const H5F_t *f);
+void                    accum_printf(const H5F_t *f);
+const H5F_meta_accum_t *accum_at(const H5F_t *f, haddr_t loc);
 
 /* Private Test H5Faccum Function Wrappers */
 #define accum_write(a, s, b) H5F_block_write(f, H5FD_MEM_DEFAULT, (haddr_t)(a), (size_t)(s), (b))
@@ -137,6 +145,7 @@ main(void)
     nerrors += test_free(f);
     nerrors += test_big(f);
     nerrors += test_random_write(f);
+    nerrors += test_multiple_accum(f);
 
     /* Pop API context */
     if (api_ctx_pushed && H5CX_pop() < 0)
@@ -2071,6 +2080,144 @@ error:
     return 1;
 } /* end test_random_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_multiple_accum
+ *
+ * Purpose:     This test interleaves metadata writes to distant parts of
+ *		the file, which should be held in separate accumulators,
+ *		and checks that the accumulators stay disjoint and within
+ *		their shared memory limit.
+ *
+ * Return:      Success: SUCCEED
+ *              Failure: FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned
+test_multiple_accum(H5F_t *f)
+{
+    const H5F_meta_accum_t *accum;       /* Accumulator to check */
+    uint8_t *               wbuf, *rbuf; /* Buffers for reading & writing */
+    size_t                  total;       /* Total size of accumulator buffers */
+    unsigned                u;           /* Local index variable */
+
+    /* Allocate space for the write & read buffers */
+    wbuf = (uint8_t *)HDmalloc((size_t)MULTI_BIG_LEN);
+    HDassert(wbuf);
+    rbuf = (uint8_t *)HDcalloc((size_t)MULTI_BIG_LEN, (size_t)1);
+    HDassert(rbuf);
+
+    /* Initialize write buffer */
+    for (u = 0; u < MULTI_BIG_LEN; u++)
+        wbuf[u] = (uint8_t)(u % 251);
+
+    TESTING("interleaved writes to multiple accumulators");
+
+    /* Alternate between writes to the low & high parts of the file */
+    for (u = 0; u < 4; u++) {
+        if (accum_write(MULTI_LOW_OFF + (u * MULTI_SEG_LEN), MULTI_SEG_LEN, wbuf + (u * MULTI_SEG_LEN)) < 0)
+            FAIL_STACK_ERROR;
+        if (accum_write(MULTI_HIGH_OFF + (u * MULTI_SEG_LEN), MULTI_SEG_LEN, wbuf + (u * MULTI_SEG_LEN)) < 0)
+            FAIL_STACK_ERROR;
+    } /* end for */
+
+    /* Each region should have built up in its own (still dirty) accumulator */
+    if (NULL == (accum = accum_at(f, MULTI_LOW_OFF)) || accum->size != 4 * MULTI_SEG_LEN || !accum->dirty)
+        TEST_ERROR;
+    if (NULL == (accum = accum_at(f, MULTI_HIGH_OFF)) || accum->size != 4 * MULTI_SEG_LEN || !accum->dirty)
+        TEST_ERROR;
+
+    /* Read both regions back */
+    if (accum_read(MULTI_LOW_OFF, 4 * MULTI_SEG_LEN, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(wbuf, rbuf, (size_t)(4 * MULTI_SEG_LEN)) != 0)
+        TEST_ERROR;
+    if (accum_read(MULTI_HIGH_OFF, 4 * MULTI_SEG_LEN, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(wbuf, rbuf, (size_t)(4 * MULTI_SEG_LEN)) != 0)
+        TEST_ERROR;
+
+    /* Start a third accumulator a little past the low region */
+    if (accum_write(MULTI_LOW_OFF + (16 * MULTI_SEG_LEN), MULTI_SEG_LEN, wbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (NULL == accum_at(f, MULTI_LOW_OFF + (16 * MULTI_SEG_LEN)))
+        TEST_ERROR;
+
+    /* Extend the low region's accumulator over the third one, which must
+     * be written out and dropped so the accumulators stay disjoint.
+     */
+    if (accum_write(MULTI_LOW_OFF + (2 * MULTI_SEG_LEN), 15 * MULTI_SEG_LEN, wbuf + (2 * MULTI_SEG_LEN)) < 0)
+        FAIL_STACK_ERROR;
+    if (NULL == (accum = accum_at(f, MULTI_LOW_OFF)) || accum->size != 17 * MULTI_SEG_LEN)
+        TEST_ERROR;
+    if (NULL != accum_at(f, MULTI_LOW_OFF + (16 * MULTI_SEG_LEN)))
+        TEST_ERROR;
+
+    /* Flush all the accumulators, which should leave them clean */
+    if (accum_flush(f) < 0)
+        FAIL_STACK_ERROR;
+    for (u = 0; u < H5F_ACCUM_NUM; u++)
+        if (f->shared->accum[u].dirty)
+            TEST_ERROR;
+
+    /* Verify the data from the file */
+    if (accum_reset(f) < 0)
+        FAIL_STACK_ERROR;
+    if (accum_read(MULTI_LOW_OFF, 17 * MULTI_SEG_LEN, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(wbuf, rbuf, (size_t)(17 * MULTI_SEG_LEN)) != 0)
+        TEST_ERROR;
+    if (accum_read(MULTI_HIGH_OFF, 4 * MULTI_SEG_LEN, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(wbuf, rbuf, (size_t)(4 * MULTI_SEG_LEN)) != 0)
+        TEST_ERROR;
+    if (accum_reset(f) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Fill two accumulators up to the shared memory limit, then start a
+     * third, which should release the least recently used one.
+     */
+    if (accum_write(MULTI_LOW_OFF, MULTI_BIG_LEN, wbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (accum_write(MULTI_HIGH_OFF, MULTI_BIG_LEN, wbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (accum_write(2 * MULTI_HIGH_OFF, MULTI_SEG_LEN, wbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (NULL != accum_at(f, MULTI_LOW_OFF))
+        TEST_ERROR;
+    if (NULL == accum_at(f, MULTI_HIGH_OFF) || NULL == accum_at(f, 2 * MULTI_HIGH_OFF))
+        TEST_ERROR;
+    for (u = 0, total = 0; u < H5F_ACCUM_NUM; u++)
+        total += f->shared->accum[u].alloc_size;
+    if (total > 2 * (MULTI_BIG_LEN + 1))
+        TEST_ERROR;
+
+    /* The released accumulator's data must have reached the file */
+    HDmemset(rbuf, 0, (size_t)MULTI_BIG_LEN);
+    if (accum_read(MULTI_LOW_OFF, MULTI_BIG_LEN, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (HDmemcmp(wbuf, rbuf, (size_t)MULTI_BIG_LEN) != 0)
+        TEST_ERROR;
+
+    if (accum_reset(f) < 0)
+        FAIL_STACK_ERROR;
+
+    PASSED();
+
+    /* Release memory */
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 0;
+
+error:
+    /* Release memory */
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 1;
+} /* end test_multiple_accum() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_swmr_write_big
  *
@@ -2316,33 +2463,60 @@ error:
 void
 accum_printf(const H5F_t *f)
 {
-    H5F_meta_accum_t *accum = &f->shared->accum;
-
-    HDprintf("\n");
-    HDprintf("Current contents of accumulator:\n");
-    if (accum->alloc_size == 0) {
-        HDprintf("=====================================================\n");
-        HDprintf(" No accumulator allocated.\n");
-        HDprintf("=====================================================\n");
-    }
-    else {
-        HDprintf("=====================================================\n");
-        HDprintf(" accumulator allocated size == %zu\n", accum->alloc_size);
-        HDprintf(" accumulated data size      == %zu\n", accum->size);
-        HDfprintf(stdout, " accumulator dirty?         == %s\n", accum->dirty ? "TRUE" : "FALSE");
-        HDprintf("=====================================================\n");
-        HDfprintf(stdout, " start of accumulated data, loc = %" PRIuHADDR "\n", accum->loc);
-        if (accum->dirty) {
-            HDfprintf(stdout, " start of dirty region, loc = %" PRIuHADDR "\n",
-                      (haddr_t)(accum->loc + accum->dirty_off));
-            HDfprintf(stdout, " end of dirty region,   loc = %" PRIuHADDR "\n",
-                      (haddr_t)(accum->loc + accum->dirty_off + accum->dirty_len));
-        } /* end if */
-        HDfprintf(stdout, " end of accumulated data,   loc = %" PRIuHADDR "\n",
-                  (haddr_t)(accum->loc + accum->size));
-        HDfprintf(stdout, " end of accumulator allocation,   loc = %" PRIuHADDR "\n",
-                  (haddr_t)(accum->loc + accum->alloc_size));
-        HDprintf("=====================================================\n");
-    }
+    unsigned u;
+
+    for (u = 0; u < H5F_ACCUM_NUM; u++) {
+        const H5F_meta_accum_t *accum = &f->shared->accum[u];
+
+        HDprintf("\n");
+        HDprintf("Current contents of accumulator #%u:\n", u);
+        if (accum->alloc_size == 0) {
+            HDprintf("=====================================================\n");
+            HDprintf(" No accumulator allocated.\n");
+            HDprintf("=====================================================\n");
+        }
+        else {
+            HDprintf("=====================================================\n");
+            HDprintf(" accumulator allocated size == %zu\n", accum->alloc_size);
+            HDprintf(" accumulated data size      == %zu\n", accum->size);
+            HDfprintf(stdout, " accumulator dirty?         == %s\n", accum->dirty ? "TRUE" : "FALSE");
+            HDprintf("=====================================================\n");
+            HDfprintf(stdout, " start of accumulated data, loc = %" PRIuHADDR "\n", accum->loc);
+            if (accum->dirty) {
+                HDfprintf(stdout, " start of dirty region, loc = %" PRIuHADDR "\n",
+                          (haddr_t)(accum->loc + accum->dirty_off));
+                HDfprintf(stdout, " end of dirty region,   loc = %" PRIuHADDR "\n",
+                          (haddr_t)(accum->loc + accum->dirty_off + accum->dirty_len));
+            } /* end if */
+            HDfprintf(stdout, " end of accumulated data,   loc = %" PRIuHADDR "\n",
+                      (haddr_t)(accum->loc + accum->size));
+            HDfprintf(stdout, " end of accumulator allocation,   loc = %" PRIuHADDR "\n",
+                      (haddr_t)(accum->loc + accum->alloc_size));
+            HDprintf("=====================================================\n");
+        }
+    } /* end for */
     HDprintf("\n\n");
 } /* accum_printf() */
+
+/*-------------------------------------------------------------------------
+ * Function:    accum_at
+ *
+ * Purpose:     Look up the accumulator holding metadata starting at a
+ *              given file address.
+ *
+ * Return:      Success: Pointer to the accumulator
+ *              Failure: NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+const H5F_meta_accum_t *
+accum_at(const H5F_t *f, haddr_t loc)
+{
+    unsigned u;
+
+    for (u = 0; u < H5F_ACCUM_NUM; u++)
+        if (f->shared->accum[u].size > 0 && f->shared->accum[u].loc == loc)
+            return &f->shared->accum[u];
+
+    return NULL;
+} /* accum_at() */
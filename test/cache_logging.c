@@ -14,9 +14,18 @@
 /* Purpose: Tests the metadata cache logging framework */
 
 #include "h5test.h"
+#include "H5Clog.h"
 
-#define LOG_LOCATION "cache_logging.out"
-#define FILE_NAME    "cache_logging"
+#define LOG_LOCATION        "cache_logging.out"
+#define BINARY_LOG_LOCATION "cache_logging.bin"
+#define EVICT_LOG_LOCATION  "cache_logging_evict.bin"
+#define FILE_NAME           "cache_logging"
+#define EVICT_FILE_NAME     "cache_logging_evict"
+
+/* Metadata cache size for the eviction log, too small for the object
+ * headers of all the groups
+ */
+#define EVICT_CACHE_SIZE 1024
 
 #define N_GROUPS 100
 
@@ -134,6 +143,297 @@ error:
     return 1;
 } /* test_logging_api() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_logging_binary
+ *
+ * Purpose:     Tests the binary mdc log format: the property list calls
+ *              and the layout of the log file
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_logging_binary(void)
+{
+    hid_t                fapl = -1;
+    hid_t                fid  = -1;
+    hid_t                gid  = -1;
+    H5F_mdc_log_format_t format;
+    herr_t               ret;
+    FILE *               log_file = NULL;
+    uint8_t              header[H5C_LOG_BINARY_HEADER_SIZE];
+    uint8_t              record[H5C_LOG_BINARY_RECORD_SIZE];
+    const uint8_t *      p;
+    unsigned             version;
+    unsigned             record_size;
+    unsigned             n_records  = 0;
+    unsigned             n_protects = 0;
+    unsigned             n_hits     = 0;
+    unsigned             n_inserts  = 0;
+    unsigned             op         = H5C_LOG_BINARY_NOPS;
+    char                 group_name[12];
+    char                 filename[1024];
+    int                  i;
+
+    TESTING("binary metadata cache log");
+
+    fapl = h5_fileaccess();
+    h5_fixname(FILE_NAME, fapl, filename, sizeof filename);
+
+    /* The default format is JSON */
+    if (H5Pget_mdc_log_format(fapl, &format) < 0)
+        TEST_ERROR;
+    if (format != H5F_MDC_LOG_FORMAT_JSON)
+        TEST_ERROR;
+
+    /* Invalid formats are rejected */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_mdc_log_format(fapl, H5F_MDC_LOG_FORMAT_NTYPES);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR;
+
+    /* Set up binary metadata cache logging, starting on file create */
+    if (H5Pset_mdc_log_options(fapl, TRUE, BINARY_LOG_LOCATION, TRUE) < 0)
+        TEST_ERROR;
+    if (H5Pset_mdc_log_format(fapl, H5F_MDC_LOG_FORMAT_BINARY) < 0)
+        TEST_ERROR;
+    if (H5Pget_mdc_log_format(fapl, &format) < 0)
+        TEST_ERROR;
+    if (format != H5F_MDC_LOG_FORMAT_BINARY)
+        TEST_ERROR;
+
+    /* Create a file and perform some manipulations */
+    if (H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
+        TEST_ERROR;
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < N_GROUPS; i++) {
+        HDsnprintf(group_name, sizeof(group_name), "%d", i);
+        if ((gid = H5Gcreate2(fid, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Gclose(gid) < 0)
+            TEST_ERROR;
+    }
+
+    /* Closing the file writes out the buffered records */
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    /* Check the header */
+    if (NULL == (log_file = HDfopen(BINARY_LOG_LOCATION, "rb")))
+        TEST_ERROR;
+    if (1 != HDfread(header, sizeof(header), 1, log_file))
+        TEST_ERROR;
+    if (HDmemcmp(header, H5C_LOG_BINARY_SIGNATURE, (size_t)H5C_LOG_BINARY_SIGNATURE_LEN) != 0)
+        TEST_ERROR;
+    p = header + H5C_LOG_BINARY_SIGNATURE_LEN;
+    UINT32DECODE(p, version);
+    UINT32DECODE(p, record_size);
+    if (version != H5C_LOG_BINARY_VERSION || record_size != H5C_LOG_BINARY_RECORD_SIZE)
+        TEST_ERROR;
+
+    /* Check the records: logging starts and stops, and entries are
+     * inserted and protected, mostly while resident
+     */
+    while (1 == HDfread(record, sizeof(record), 1, log_file)) {
+        /* The operation and status bytes follow the timestamp, address
+         * and value (see H5Clog.h)
+         */
+        op = record[24];
+        if (op >= H5C_LOG_BINARY_NOPS)
+            TEST_ERROR;
+        if (n_records == 0 && op != H5C_LOG_BINARY_START)
+            TEST_ERROR;
+        if (op == H5C_LOG_BINARY_INSERT)
+            n_inserts++;
+        if (op == H5C_LOG_BINARY_PROTECT && !(record[26] & H5C_LOG_BINARY_FAILED)) {
+            n_protects++;
+            if (record[26] & H5C_LOG_BINARY_HIT)
+                n_hits++;
+        }
+        n_records++;
+    }
+    if (!HDfeof(log_file))
+        TEST_ERROR;
+    if (op != H5C_LOG_BINARY_STOP)
+        TEST_ERROR;
+    if (n_inserts == 0 || n_protects < N_GROUPS || n_hits == 0)
+        TEST_ERROR;
+    if (HDfclose(log_file) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    if (log_file)
+        HDfclose(log_file);
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+    return 1;
+} /* test_logging_binary() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_logging_binary_evict
+ *
+ * Purpose:     Tests the binary mdc log of a cache too small for the
+ *              file's metadata: protects that miss, and the records of
+ *              cache flushes and evictions
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_logging_binary_evict(void)
+{
+    hid_t               fapl = -1;
+    hid_t               fid  = -1;
+    hid_t               gid  = -1;
+    H5AC_cache_config_t mdc_config;
+    FILE *              log_file = NULL;
+    uint8_t             record[H5C_LOG_BINARY_RECORD_SIZE];
+    unsigned            n_protects = 0;
+    unsigned            n_misses   = 0;
+    unsigned            n_flushes  = 0;
+    unsigned            n_evicts   = 0;
+    char                group_name[12];
+    char                filename[1024];
+    int                 pass;
+    int                 i;
+
+    TESTING("binary metadata cache log of a small cache");
+
+    fapl = h5_fileaccess();
+    h5_fixname(EVICT_FILE_NAME, fapl, filename, sizeof filename);
+    if (H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
+        TEST_ERROR;
+
+    /* Create the groups without logging */
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < N_GROUPS; i++) {
+        HDsnprintf(group_name, sizeof(group_name), "%d", i);
+        if ((gid = H5Gcreate2(fid, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Gclose(gid) < 0)
+            TEST_ERROR;
+    }
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /* Reopen with a fixed size cache that holds only a few object headers */
+    mdc_config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    if (H5Pget_mdc_config(fapl, &mdc_config) < 0)
+        TEST_ERROR;
+    mdc_config.set_initial_size = TRUE;
+    mdc_config.initial_size     = EVICT_CACHE_SIZE;
+    mdc_config.min_size         = EVICT_CACHE_SIZE;
+    mdc_config.max_size         = EVICT_CACHE_SIZE;
+    mdc_config.incr_mode        = H5C_incr__off;
+    mdc_config.flash_incr_mode  = H5C_flash_incr__off;
+    mdc_config.decr_mode        = H5C_decr__off;
+    if (H5Pset_mdc_config(fapl, &mdc_config) < 0)
+        TEST_ERROR;
+    if (H5Pset_mdc_log_options(fapl, TRUE, EVICT_LOG_LOCATION, TRUE) < 0)
+        TEST_ERROR;
+    if (H5Pset_mdc_log_format(fapl, H5F_MDC_LOG_FORMAT_BINARY) < 0)
+        TEST_ERROR;
+    if ((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+        TEST_ERROR;
+
+    /* Visit the groups twice, each visit evicting earlier object headers */
+    for (pass = 0; pass < 2; pass++)
+        for (i = 0; i < N_GROUPS; i++) {
+            HDsnprintf(group_name, sizeof(group_name), "%d", i);
+            if ((gid = H5Gopen2(fid, group_name, H5P_DEFAULT)) < 0)
+                TEST_ERROR;
+            if (H5Gclose(gid) < 0)
+                TEST_ERROR;
+        }
+
+    /* Flush the cache, then evict everything that is not pinned */
+    if (H5Fflush(fid, H5F_SCOPE_LOCAL) < 0)
+        TEST_ERROR;
+    if (H5Fstart_swmr_write(fid) < 0)
+        TEST_ERROR;
+
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    fid = -1;
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+    fapl = -1;
+
+    /* Count the records, skipping the header (see test_logging_binary) */
+    if (NULL == (log_file = HDfopen(EVICT_LOG_LOCATION, "rb")))
+        TEST_ERROR;
+    if (HDfseek(log_file, (long)H5C_LOG_BINARY_HEADER_SIZE, SEEK_SET) < 0)
+        TEST_ERROR;
+    while (1 == HDfread(record, sizeof(record), 1, log_file)) {
+        if (record[26] & H5C_LOG_BINARY_FAILED)
+            TEST_ERROR;
+        switch (record[24]) {
+            case H5C_LOG_BINARY_PROTECT:
+                n_protects++;
+                if (!(record[26] & H5C_LOG_BINARY_HIT))
+                    n_misses++;
+                break;
+
+            case H5C_LOG_BINARY_FLUSH:
+                n_flushes++;
+                break;
+
+            case H5C_LOG_BINARY_EVICT_CACHE:
+                n_evicts++;
+                break;
+
+            default:
+                break;
+        }
+    }
+    if (!HDfeof(log_file))
+        TEST_ERROR;
+    if (HDfclose(log_file) < 0)
+        TEST_ERROR;
+    log_file = NULL;
+
+    /* Every group's object header is read at least once per pass; the
+     * explicit flush and the one on close are both logged, and the
+     * eviction once
+     */
+    if (n_misses < 2 * N_GROUPS || n_misses >= n_protects)
+        TEST_ERROR;
+    if (n_flushes < 2)
+        TEST_ERROR;
+    if (n_evicts != 1)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    if (log_file)
+        HDfclose(log_file);
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+    return 1;
+} /* test_logging_binary_evict() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -155,6 +455,8 @@ main(void)
     HDprintf("Testing basic metadata cache logging functionality.\n");
 
     nerrors += test_logging_api();
+    nerrors += test_logging_binary();
+    nerrors += test_logging_binary_evict();
 
     if (nerrors) {
         HDprintf("***** %d Metadata cache logging TEST%s FAILED! *****\n", nerrors, nerrors > 1 ? "S" : "");
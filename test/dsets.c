@@ -104,6 +104,11 @@ const char *FILENAME[] = {"dataset",             /* 0 */
 #define DSET_CONV_BUF_NAME        "conv_buf"
 #define DSET_TCONV_NAME           "tconv"
 #define DSET_DEFLATE_NAME         "deflate"
+#define DSET_LZ4_NAME             "lz4"
+#define DSET_ZSTD_NAME            "zstd"
+#define DSET_ZSTD_DICT_NAME       "zstd_dict"
+#define DSET_BLOCKED_NAME         "blocked"
+#define DSET_BLOCKED_THREADS_NAME "blocked_threads"
 #define DSET_SHUFFLE_NAME         "shuffle"
 #define DSET_FLETCHER32_NAME      "fletcher32"
 #define DSET_FLETCHER32_NAME_2    "fletcher32_2"
@@ -204,6 +209,15 @@ const char *FILENAME[] = {"dataset",             /* 0 */
 #define DIM3 10   /* Dim. Size of data member # 3 */
 
 /* Parameters for internal filter test */
+/* Compression method for testing the blocked compression filter */
+#if defined(H5_HAVE_FILTER_DEFLATE)
+#define BLOCKED_CODEC H5Z_FILTER_DEFLATE
+#elif defined(H5_HAVE_FILTER_LZ4)
+#define BLOCKED_CODEC H5Z_FILTER_LZ4
+#elif defined(H5_HAVE_FILTER_ZSTD)
+#define BLOCKED_CODEC H5Z_FILTER_ZSTD
+#endif
+
 #define FILTER_CHUNK_DIM1 2
 #define FILTER_CHUNK_DIM2 25
 #define FILTER_HS_OFFSET1 7
@@ -2399,6 +2413,24 @@ test_get_filter_info(void)
         TEST_ERROR
 #endif
 
+#ifdef H5_HAVE_FILTER_LZ4
+    if (H5Zget_filter_info(H5Z_FILTER_LZ4, &flags) < 0)
+        TEST_ERROR
+
+    if (((flags & H5Z_FILTER_CONFIG_ENCODE_ENABLED) == 0) ||
+        ((flags & H5Z_FILTER_CONFIG_DECODE_ENABLED) == 0))
+        TEST_ERROR
+#endif
+
+#ifdef H5_HAVE_FILTER_ZSTD
+    if (H5Zget_filter_info(H5Z_FILTER_ZSTD, &flags) < 0)
+        TEST_ERROR
+
+    if (((flags & H5Z_FILTER_CONFIG_ENCODE_ENABLED) == 0) ||
+        ((flags & H5Z_FILTER_CONFIG_DECODE_ENABLED) == 0))
+        TEST_ERROR
+#endif
+
 #ifdef H5_HAVE_FILTER_SZIP
     if (H5Zget_filter_info(H5Z_FILTER_SZIP, &flags) < 0)
         TEST_ERROR
@@ -2456,6 +2488,22 @@ test_filters(hid_t file, hid_t
     hsize_t deflate_size; /* Size of dataset with deflate filter */
 #endif                    /* H5_HAVE_FILTER_DEFLATE */
 
+#ifdef H5_HAVE_FILTER_LZ4
+    hsize_t lz4_size; /* Size of dataset with LZ4 filter */
+#endif                /* H5_HAVE_FILTER_LZ4 */
+
+#ifdef H5_HAVE_FILTER_ZSTD
+    hsize_t       zstd_size;          /* Size of dataset with Zstandard filter */
+    unsigned char zstd_dict[256];     /* Zstandard dictionary */
+    unsigned      zstd_cd_values[66]; /* Zstandard filter parameters */
+    size_t        zstd_cd_nelmts;     /* Number of Zstandard filter parameters */
+    size_t        u;                  /* Local index variable */
+#endif                                /* H5_HAVE_FILTER_ZSTD */
+
+#ifdef BLOCKED_CODEC
+    hsize_t blocked_size; /* Size of dataset with blocked filter */
+#endif                    /* BLOCKED_CODEC */
+
 #ifdef H5_HAVE_FILTER_SZIP
     hsize_t  szip_size; /* Size of dataset with szip filter */
     unsigned szip_options_mask     = H5_SZIP_NN_OPTION_MASK;
@@ -2575,6 +2623,113 @@ test_filters(hid_t file, hid_t
     HDputs("    Deflate filter not enabled");
 #endif /* H5_HAVE_FILTER_DEFLATE */
 
+        /*----------------------------------------------------------
+         * STEP 2a: Test LZ4 compression by itself, with several
+         *          blocks in each chunk.
+         *----------------------------------------------------------
+         */
+#ifdef H5_HAVE_FILTER_LZ4
+    HDputs("Testing lz4 filter");
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+        goto error;
+    if (H5Pset_lz4(dc, 64) < 0)
+        goto error;
+
+    if (test_filter_internal(file, DSET_LZ4_NAME, dc, DISABLE_FLETCHER32, DATA_NOT_CORRUPTED, &lz4_size) <
+        0)
+        goto error;
+    /* Clean up objects used for this test */
+    if (H5Pclose(dc) < 0)
+        goto error;
+#else  /* H5_HAVE_FILTER_LZ4 */
+    TESTING("lz4 filter");
+    SKIPPED();
+    HDputs("    LZ4 filter not enabled");
+#endif /* H5_HAVE_FILTER_LZ4 */
+
+        /*----------------------------------------------------------
+         * STEP 2b: Test Zstandard compression by itself, without and
+         *          with a dictionary.
+         *----------------------------------------------------------
+         */
+#ifdef H5_HAVE_FILTER_ZSTD
+    HDputs("Testing zstd filter");
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+        goto error;
+    if (H5Pset_zstd(dc, 3, NULL, (size_t)0) < 0)
+        goto error;
+
+    if (test_filter_internal(file, DSET_ZSTD_NAME, dc, DISABLE_FLETCHER32, DATA_NOT_CORRUPTED, &zstd_size) <
+        0)
+        goto error;
+    /* Clean up objects used for this test */
+    if (H5Pclose(dc) < 0)
+        goto error;
+
+    HDputs("Testing zstd filter with a dictionary");
+    for (u = 0; u < sizeof(zstd_dict); u++)
+        zstd_dict[u] = (unsigned char)(u * 7);
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+        goto error;
+    if (H5Pset_zstd(dc, 19, zstd_dict, sizeof(zstd_dict)) < 0)
+        goto error;
+
+    /* Check that the dictionary is stored with the filter's parameters */
+    zstd_cd_nelmts = NELMTS(zstd_cd_values);
+    if (H5Pget_filter_by_id2(dc, H5Z_FILTER_ZSTD, NULL, &zstd_cd_nelmts, zstd_cd_values, (size_t)0, NULL,
+                             NULL) < 0)
+        goto error;
+    if (zstd_cd_nelmts != 2 + sizeof(zstd_dict) / 4 || zstd_cd_values[0] != 19 ||
+        zstd_cd_values[1] != sizeof(zstd_dict) || zstd_cd_values[2] != 0x150e0700) {
+        H5_FAILED();
+        HDputs("    Zstandard dictionary not stored correctly.");
+        goto error;
+    } /* end if */
+
+    if (test_filter_internal(file, DSET_ZSTD_DICT_NAME, dc, DISABLE_FLETCHER32, DATA_NOT_CORRUPTED,
+                             &zstd_size) < 0)
+        goto error;
+    /* Clean up objects used for this test */
+    if (H5Pclose(dc) < 0)
+        goto error;
+#else  /* H5_HAVE_FILTER_ZSTD */
+    TESTING("zstd filter");
+    SKIPPED();
+    HDputs("    Zstandard filter not enabled");
+#endif /* H5_HAVE_FILTER_ZSTD */
+
+        /*----------------------------------------------------------
+         * STEP 2c: Test blocked compression by itself, with several
+         *          blocks in each chunk.
+         *----------------------------------------------------------
+         */
+#ifdef BLOCKED_CODEC
+    HDputs("Testing blocked filter");
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dc, 2, chunk_size) < 0)
+        goto error;
+    if (H5Pset_blocked(dc, BLOCKED_CODEC, BLOCKED_CODEC == H5Z_FILTER_LZ4 ? 0 : 6, 64) < 0)
+        goto error;
+
+    if (test_filter_internal(file, DSET_BLOCKED_NAME, dc, DISABLE_FLETCHER32, DATA_NOT_CORRUPTED,
+                             &blocked_size) < 0)
+        goto error;
+    /* Clean up objects used for this test */
+    if (H5Pclose(dc) < 0)
+        goto error;
+#else  /* BLOCKED_CODEC */
+    TESTING("blocked filter");
+    SKIPPED();
+    HDputs("    Blocked filter not enabled");
+#endif /* BLOCKED_CODEC */
+
         /*----------------------------------------------------------
          * STEP 3: Test szip compression by itself.
          *----------------------------------------------------------
@@ -3121,6 +3276,167 @@ error:
     return FAIL;
 } /* end test_onebyte_shuffle() */
 
+/*-------------------------------------------------------------------------
+ * Function:  test_blocked_filter_threads
+ *
+ * Purpose:   Tests the blocked compression filter on chunks that hold
+ *            many blocks, writing and reading them with several filter
+ *            threads and reading them back with a single thread.
+ *
+ * Return:    Success:    0
+ *            Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_blocked_filter_threads(hid_t
+#ifndef BLOCKED_CODEC
+                                H5_ATTR_UNUSED
+#endif /* BLOCKED_CODEC */
+                                    file)
+{
+#ifdef BLOCKED_CODEC
+    hid_t          dataset = H5I_INVALID_HID, space = H5I_INVALID_HID;
+    hid_t          dc = H5I_INVALID_HID, dxpl = H5I_INVALID_HID;
+    const hsize_t  size[1]         = {512 * 1024};
+    const hsize_t  chunk_size[1]   = {256 * 1024};
+    hsize_t        chunk_offset[1] = {0};
+    int           *orig_data       = NULL;
+    int           *new_data        = NULL;
+    unsigned char *chunk           = NULL;
+    unsigned char  hdr[12];
+    uint32_t       filter_mask = 0;
+    unsigned       nthreads;
+    unsigned       seed = 1;
+    size_t         i;
+    herr_t         ret;
+#endif /* BLOCKED_CODEC */
+
+    TESTING("blocked filter with several threads");
+
+#ifdef BLOCKED_CODEC
+    if (NULL == (orig_data = (int *)HDmalloc(size[0] * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (new_data = (int *)HDmalloc(size[0] * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (chunk = (unsigned char *)HDmalloc(2 * chunk_size[0] * sizeof(int))))
+        TEST_ERROR
+
+    /* Mix runs of compressible data with runs of noise, so that some blocks are
+     * compressed and some are stored as they are */
+    for (i = 0; i < size[0]; i++) {
+        if ((i / 20000) % 3 == 2) {
+            seed         = seed * 1103515245 + 12345;
+            orig_data[i] = (int)seed;
+        }
+        else
+            orig_data[i] = (int)(i % 1000);
+    }
+
+    /* Check the filter thread property */
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+    if (H5Pget_filter_threads(dxpl, &nthreads) < 0)
+        TEST_ERROR
+    if (nthreads != 1)
+        TEST_ERROR
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_filter_threads(dxpl, 0);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+    if (H5Pset_filter_threads(dxpl, 4) < 0)
+        TEST_ERROR
+    if (H5Pget_filter_threads(dxpl, &nthreads) < 0)
+        TEST_ERROR
+    if (nthreads != 4)
+        TEST_ERROR
+
+    /* Create the dataset */
+    if ((space = H5Screate_simple(1, size, NULL)) < 0)
+        TEST_ERROR
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dc, 1, chunk_size) < 0)
+        TEST_ERROR
+    if (H5Pset_blocked(dc, BLOCKED_CODEC, BLOCKED_CODEC == H5Z_FILTER_LZ4 ? 0 : 1, 64 * 1024) < 0)
+        TEST_ERROR
+    if ((dataset = H5Dcreate2(file, DSET_BLOCKED_THREADS_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dc,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Write the data with several threads */
+    if (H5Dwrite(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, orig_data) < 0)
+        TEST_ERROR
+    if (H5Dclose(dataset) < 0)
+        TEST_ERROR
+    if ((dataset = H5Dopen2(file, DSET_BLOCKED_THREADS_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Check the header of the first chunk */
+    if (H5Dread_chunk(dataset, H5P_DEFAULT, chunk_offset, &filter_mask, chunk) < 0)
+        TEST_ERROR
+    if (filter_mask != 0)
+        TEST_ERROR
+    HDmemset(hdr, 0, sizeof(hdr));
+    hdr[5]  = 0x10; /* 1 MiB of uncompressed data */
+    hdr[9]  = 0x01; /* 64 KiB blocks */
+    if (HDmemcmp(chunk, hdr, sizeof(hdr)) != 0)
+        TEST_ERROR
+
+    /* Read the data back with a single thread */
+    HDmemset(new_data, 0, size[0] * sizeof(int));
+    if (H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+        TEST_ERROR
+    if (HDmemcmp(orig_data, new_data, size[0] * sizeof(int)) != 0)
+        TEST_ERROR
+
+    /* Read the data back with several threads */
+    HDmemset(new_data, 0, size[0] * sizeof(int));
+    if (H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, new_data) < 0)
+        TEST_ERROR
+    if (HDmemcmp(orig_data, new_data, size[0] * sizeof(int)) != 0)
+        TEST_ERROR
+
+    /* Cleanup */
+    if (H5Dclose(dataset) < 0)
+        TEST_ERROR
+    if (H5Pclose(dc) < 0)
+        TEST_ERROR
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR
+    if (H5Sclose(space) < 0)
+        TEST_ERROR
+    HDfree(orig_data);
+    HDfree(new_data);
+    HDfree(chunk);
+
+    PASSED();
+#else  /* BLOCKED_CODEC */
+    SKIPPED();
+    HDputs("    Blocked filter not enabled");
+#endif /* BLOCKED_CODEC */
+
+    return SUCCEED;
+
+#ifdef BLOCKED_CODEC
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dataset);
+        H5Pclose(dc);
+        H5Pclose(dxpl);
+        H5Sclose(space);
+    }
+    H5E_END_TRY;
+    HDfree(orig_data);
+    HDfree(new_data);
+    HDfree(chunk);
+    return FAIL;
+#endif /* BLOCKED_CODEC */
+} /* end test_blocked_filter_threads() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_nbit_int
  *
@@ -15211,6 +15527,7 @@ main(void)
                 nerrors += (test_tconv(file) < 0 ? 1 : 0);
                 nerrors += (test_filters(file, my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_onebyte_shuffle(file) < 0 ? 1 : 0);
+                nerrors += (test_blocked_filter_threads(file) < 0 ? 1 : 0);
                 nerrors += (test_nbit_int(file) < 0 ? 1 : 0);
                 nerrors += (test_nbit_float(file) < 0 ? 1 : 0);
                 nerrors += (test_nbit_double(file) < 0 ? 1 : 0);
@@ -17,11 +17,15 @@
 #define COLS      18
 #define FLOAT_TOL 0.0001F
 
+/* Larger than several of the blocks the library evaluates transforms in, with a partial block at the end */
+#define MULTIBLOCK_NELMTS 2000
+
 static int init_test(hid_t file_id);
 static int test_copy(const hid_t dxpl_id_c_to_f_copy, const hid_t dxpl_id_polynomial_copy);
 static int test_trivial(const hid_t dxpl_id_simple);
 static int test_poly(const hid_t dxpl_id_polynomial);
 static int test_specials(hid_t file);
+static int test_multiblock(hid_t file);
 static int test_set(void);
 static int test_getset(const hid_t dxpl_id_simple);
 
@@ -388,6 +392,8 @@ main(void)
         TEST_ERROR;
     if (test_specials(file_id) < 0)
         TEST_ERROR;
+    if (test_multiblock(file_id) < 0)
+        TEST_ERROR;
 
     /* Close the objects we opened/created */
     if (H5Dclose(dset_id_int) < 0)
@@ -717,6 +723,81 @@ error:
     return -1;
 }
 
+static int
+test_multiblock(hid_t file)
+{
+    hid_t       dataspace = -1;
+    hid_t       dxpl_id   = -1;
+    hid_t       dset_id   = -1;
+    hsize_t     dim[1]    = {MULTIBLOCK_NELMTS};
+    int *       data      = NULL;
+    int *       read_buf  = NULL;
+    size_t      u;
+    const char *linear     = "2*x+3";
+    const char *polynomial = "(x+1)*(x-2)-x/3";
+
+    TESTING("data transform of a multi-block buffer")
+
+    if (NULL == (data = (int *)HDmalloc(MULTIBLOCK_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (read_buf = (int *)HDmalloc(MULTIBLOCK_NELMTS * sizeof(int))))
+        TEST_ERROR
+    for (u = 0; u < MULTIBLOCK_NELMTS; u++)
+        data[u] = (int)(u % 97) - 48;
+
+    if ((dataspace = H5Screate_simple(1, dim, NULL)) < 0)
+        TEST_ERROR
+    if ((dset_id = H5Dcreate2(file, "/multiblock", H5T_NATIVE_INT, dataspace, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        TEST_ERROR
+    if ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+
+    /* "x" used once: the transform is applied in place */
+    if (H5Pset_data_transform(dxpl_id, linear) < 0)
+        TEST_ERROR
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl_id, read_buf) < 0)
+        TEST_ERROR
+    for (u = 0; u < MULTIBLOCK_NELMTS; u++)
+        if (read_buf[u] != 2 * data[u] + 3)
+            FAIL_PUTS_ERROR("    ERROR: Linear transform failed to match computed data\n")
+
+    /* "x" used several times: the operands are staged a block at a time */
+    if (H5Pset_data_transform(dxpl_id, polynomial) < 0)
+        TEST_ERROR
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl_id, read_buf) < 0)
+        TEST_ERROR
+    for (u = 0; u < MULTIBLOCK_NELMTS; u++)
+        if (read_buf[u] != (data[u] + 1) * (data[u] - 2) - data[u] / 3)
+            FAIL_PUTS_ERROR("    ERROR: Polynomial transform failed to match computed data\n")
+
+    if (H5Pclose(dxpl_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(dataspace) < 0)
+        TEST_ERROR
+    HDfree(data);
+    HDfree(read_buf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl_id);
+        H5Dclose(dset_id);
+        H5Sclose(dataspace);
+    }
+    H5E_END_TRY
+    HDfree(data);
+    HDfree(read_buf);
+    return -1;
+}
+
 static int
 test_copy(const hid_t dxpl_id_c_to_f_copy, const hid_t dxpl_id_polynomial_copy)
 {
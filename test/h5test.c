@@ -1034,6 +1034,20 @@ h5_get_vfd_fapl(hid_t fapl)
          */
         if (H5Pset_fapl_direct(fapl, 1024, 4096, 8 * 4096) < 0)
             goto error;
+#endif
+#ifdef H5_HAVE_SYS_MMAN_H
+    }
+    else if (!HDstrcmp(tok, "mmap")) {
+        /* Memory-mapped file I/O */
+        if (H5Pset_fapl_mmap(fapl) < 0)
+            goto error;
+#endif
+#ifdef H5_HAVE_IOURING_VFD
+    }
+    else if (!HDstrcmp(tok, "iouring")) {
+        /* Linux io_uring asynchronous I/O */
+        if (H5Pset_fapl_iouring(fapl, NULL) < 0)
+            goto error;
 #endif
     }
     else {
@@ -1383,6 +1397,12 @@ h5_get_file_size(const char *filename, hid_t fapl)
 #ifdef H5_HAVE_DIRECT
             driver == H5FD_DIRECT ||
 #endif /* H5_HAVE_DIRECT */
+#ifdef H5_HAVE_SYS_MMAN_H
+            driver == H5FD_MMAP ||
+#endif /* H5_HAVE_SYS_MMAN_H */
+#ifdef H5_HAVE_IOURING_VFD
+            driver == H5FD_IOURING ||
+#endif /* H5_HAVE_IOURING_VFD */
             driver == H5FD_LOG) {
             /* Get the file's statistics */
             if (0 == HDstat(filename, &sb))
@@ -48,6 +48,10 @@
 
 #define CONCURRENT_COUNT 3 /* Number of files in concurrent test */
 
+/* Transport settings used by create_mirroring_split_fapl() */
+static unsigned g_pipeline_depth = H5FD_MIRROR_DEFAULT_PIPELINE_DEPTH;
+static size_t   g_coalesce_size  = H5FD_MIRROR_DEFAULT_COALESCE_SIZE;
+
 /* Macro: LOGPRINT()
  * Prints logging and debugging messages to the output stream based
  * on the level of verbosity.
@@ -230,14 +234,20 @@ error:
 static int
 test_fapl_configuration(void)
 {
-    hid_t              fapl_id;
-    H5FD_mirror_fapl_t mirror_conf = {
+    hid_t               fapl_id;
+    H5FD_mirror_fapl_t  mirror_conf = {
         H5FD_MIRROR_FAPL_MAGIC,          /* magic */
         H5FD_MIRROR_CURR_FAPL_T_VERSION, /* version */
         SERVER_HANDSHAKE_PORT,           /* handhake_port */
         SERVER_IP_ADDRESS,               /* remote_ip "IP address" */
+        4,                               /* pipeline_depth */
+        512,                             /* coalesce_size */
     };
-    H5FD_mirror_fapl_t fa_out = {0, 0, 0, ""};
+    H5FD_mirror_fapl_t  fa_out = {0, H5FD_MIRROR_CURR_FAPL_T_VERSION, 0, "", 0, 0};
+    H5FD_mirror_fapl_t  fa_v1_buf[1]; /* storage for a short structure */
+    H5FD_mirror_fapl_t *fa_v1       = fa_v1_buf;
+    unsigned char *     fa_v1_bytes = (unsigned char *)fa_v1_buf;
+    size_t              u;
 
     TESTING("Mirror fapl configuration (set/get)");
 
@@ -265,6 +275,69 @@ test_fapl_configuration(void)
     if (HDstrncmp(SERVER_IP_ADDRESS, (const char *)fa_out.remote_ip, H5FD_MIRROR_MAX_IP_LEN)) {
         TEST_ERROR;
     }
+    if (4 != fa_out.pipeline_depth || 512 != fa_out.coalesce_size) {
+        TEST_ERROR;
+    }
+
+    /* A version 1 structure takes the default transport settings */
+    mirror_conf.version = 1;
+    if (H5Pset_fapl_mirror(fapl_id, &mirror_conf) == FAIL) {
+        TEST_ERROR;
+    }
+    if (H5Pget_fapl_mirror(fapl_id, &fa_out) == FAIL) {
+        TEST_ERROR;
+    }
+    if (H5FD_MIRROR_CURR_FAPL_T_VERSION != fa_out.version) {
+        TEST_ERROR;
+    }
+    if (H5FD_MIRROR_DEFAULT_PIPELINE_DEPTH != fa_out.pipeline_depth ||
+        H5FD_MIRROR_DEFAULT_COALESCE_SIZE != fa_out.coalesce_size) {
+        TEST_ERROR;
+    }
+
+    /* A version 1 structure is read back without touching the bytes past
+     * its end
+     */
+    HDmemset(fa_v1_bytes, 0xA5, sizeof(fa_v1_buf));
+    fa_v1->version = 1;
+    if (H5Pget_fapl_mirror(fapl_id, fa_v1) == FAIL) {
+        TEST_ERROR;
+    }
+    if (H5FD_MIRROR_FAPL_MAGIC != fa_v1->magic || 1 != fa_v1->version) {
+        TEST_ERROR;
+    }
+    if (SERVER_HANDSHAKE_PORT != fa_v1->handshake_port) {
+        TEST_ERROR;
+    }
+    if (HDstrncmp(SERVER_IP_ADDRESS, (const char *)fa_v1->remote_ip, H5FD_MIRROR_MAX_IP_LEN)) {
+        TEST_ERROR;
+    }
+    for (u = offsetof(H5FD_mirror_fapl_t, pipeline_depth); u < sizeof(fa_v1_buf); u++) {
+        if (0xA5 != fa_v1_bytes[u]) {
+            TEST_ERROR;
+        }
+    }
+
+    /* The structure to fill in must name a known version */
+    fa_out.version = H5FD_MIRROR_CURR_FAPL_T_VERSION + 1;
+    H5E_BEGIN_TRY
+    {
+        if (H5Pget_fapl_mirror(fapl_id, &fa_out) != FAIL) {
+            TEST_ERROR;
+        }
+    }
+    H5E_END_TRY;
+
+    /* A pipeline must hold at least one command */
+    mirror_conf.version        = H5FD_MIRROR_CURR_FAPL_T_VERSION;
+    mirror_conf.pipeline_depth = 0;
+    H5E_BEGIN_TRY
+    {
+        if (H5Pset_fapl_mirror(fapl_id, &mirror_conf) != FAIL) {
+            TEST_ERROR;
+        }
+    }
+    H5E_END_TRY;
 
     if (H5Pclose(fapl_id) == FAIL) {
         TEST_ERROR;
@@ -1259,6 +1332,7 @@ create_mirroring_split_fapl(const char *_basename, struct mirrortest_filenames *
     splitter_config.magic          = H5FD_SPLITTER_MAGIC;
     splitter_config.version        = H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION;
     splitter_config.ignore_wo_errs = FALSE;
+    splitter_config.wo_queue_size  = 0;
 
     /* Create Splitter R/W channel driver (sec2)
      */
@@ -1275,6 +1349,8 @@ create_mirroring_split_fapl(const char *_basename, struct mirrortest_filenames *
     mirror_conf.magic          = H5FD_MIRROR_FAPL_MAGIC;
     mirror_conf.version        = H5FD_MIRROR_CURR_FAPL_T_VERSION;
     mirror_conf.handshake_port = SERVER_HANDSHAKE_PORT;
+    mirror_conf.pipeline_depth = g_pipeline_depth;
+    mirror_conf.coalesce_size  = g_coalesce_size;
     if (HDstrncpy(mirror_conf.remote_ip, SERVER_IP_ADDRESS, H5FD_MIRROR_MAX_IP_LEN) == NULL) {
         TEST_ERROR;
     }
@@ -2578,7 +2654,11 @@ error:
 int
 main(void)
 {
-    int nerrors = 0;
+    /* Transport settings: lock-step without coalescing, then the defaults */
+    const unsigned pipeline_depths[2] = {1, H5FD_MIRROR_DEFAULT_PIPELINE_DEPTH};
+    const size_t   coalesce_sizes[2]  = {0, H5FD_MIRROR_DEFAULT_COALESCE_SIZE};
+    int            i;
+    int            nerrors = 0;
 
     h5_reset();
 
@@ -2609,12 +2689,18 @@ main(void)
     if (nerrors == 0) {
         nerrors -= test_fapl_configuration();
         nerrors -= test_xmit_encode_decode();
-        nerrors -= test_create_and_close();
-        nerrors -= test_basic_dataset_write();
-        nerrors -= test_chunked_dataset_write();
-        nerrors -= test_on_disk_zoo();
-        nerrors -= test_vanishing_datasets();
-        nerrors -= test_concurrent_access();
+        for (i = 0; i < 2; i++) {
+            g_pipeline_depth = pipeline_depths[i];
+            g_coalesce_size  = coalesce_sizes[i];
+            HDprintf("Pipeline depth %u, coalescing writes below %zu bytes:\n", g_pipeline_depth,
+                     g_coalesce_size);
+            nerrors -= test_create_and_close();
+            nerrors -= test_basic_dataset_write();
+            nerrors -= test_chunked_dataset_write();
+            nerrors -= test_on_disk_zoo();
+            nerrors -= test_vanishing_datasets();
+            nerrors -= test_concurrent_access();
+        }
     }
 
     if (nerrors) {
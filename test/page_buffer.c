@@ -49,6 +49,8 @@ static unsigned verify_page_buffering_disabled(hid_t orig_fapl, const char *env_
 static unsigned test_args(hid_t fapl, const char *env_h5_drvr);
 static unsigned test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr);
 static unsigned test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr);
+static unsigned test_2q_processing(hid_t orig_fapl, const char *env_h5_drvr);
+static unsigned test_raw_io_processing(hid_t orig_fapl, const char *env_h5_drvr);
 static unsigned test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr);
 static unsigned test_stats_collection(hid_t orig_fapl, const char *env_h5_drvr);
 
@@ -608,7 +610,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
      * Get the number of pages inserted, and verify that it is the
      * the expected value.
      */
-    base_page_cnt = H5SL_count(f->shared->page_buf->slist_ptr);
+    base_page_cnt = f->shared->page_buf->index_len;
     if (base_page_cnt != 1)
         TEST_ERROR;
 
@@ -634,7 +636,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
 
     page_count++;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* update elements 300 - 450, with values 300 -  - this will
@@ -644,7 +646,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 300), sizeof(int) * 150, data) < 0)
         FAIL_STACK_ERROR;
     page_count += 2;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* update elements 100 - 300, this will go to disk but also update
@@ -653,7 +655,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
         data[i] = i + 100;
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 100), sizeof(int) * 200, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* Update elements 225-300 - this will update an existing page in the PB */
@@ -662,7 +664,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
         data[i] = i + 450;
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 450), sizeof(int) * 150, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* Do a full page write to block 600-800 - should bypass the PB */
@@ -670,7 +672,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
         data[i] = i + 600;
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 600), sizeof(int) * 200, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* read elements 800 - 1200, this should not affect the PB, and should read -1s */
@@ -682,7 +684,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
             FAIL_STACK_ERROR;
         }
     }
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* read elements 1200 - 1201, this should read -1 and bring in an
@@ -697,7 +699,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
         }
     }
     page_count++;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     /* read elements 175 - 225, this should use the PB existing pages */
@@ -711,7 +713,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
             TEST_ERROR;
         }
     }
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     /* read elements 0 - 800 using the VFD.. this should result in -1s
@@ -740,7 +742,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
      */
     if (H5F_block_read(f, H5FD_MEM_DRAW, addr, sizeof(int) * 800, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         TEST_ERROR;
     for (i = 0; i < 800; i++) {
         if (data[i] != i) {
@@ -758,7 +760,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 400), sizeof(int) * 1000, data) < 0)
         FAIL_STACK_ERROR;
     page_count -= 2;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     /* read elements 0 - 1000.. this should go to disk then update the
@@ -782,7 +784,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
         }
         i++;
     }
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     if (H5Fclose(file_id) < 0)
@@ -852,6 +854,7 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
     int     num_elements = 2000;
     haddr_t addr         = HADDR_UNDEF;
     haddr_t search_addr  = HADDR_UNDEF;
+    hbool_t page_exists  = FALSE;
     int *   data         = NULL;
     H5F_t * f            = NULL;
 
@@ -892,7 +895,7 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
      * Get the number of pages inserted, and verify that it is the
      * the expected value.
      */
-    base_page_cnt = H5SL_count(f->shared->page_buf->slist_ptr);
+    base_page_cnt = f->shared->page_buf->index_len;
     if (base_page_cnt != 1)
         TEST_ERROR;
 
@@ -919,7 +922,7 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
 
     page_count++;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->index_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     /* update elements 300 - 450, with values 300 - 449 - this will
@@ -936,20 +939,26 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
     /* at this point, the page buffer entry created at file open should
      * have been evicted -- thus no further need to consider base_page_cnt.
      */
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     /* The two pages should be the ones with address 100 and 200; 0
        should have been evicted */
     /* Changes: 200, 400 */
     search_addr = addr;
-    if (NULL != H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (H5PB_page_exists(f->shared, search_addr, &page_exists) < 0)
+        FAIL_STACK_ERROR;
+    if (page_exists)
         FAIL_STACK_ERROR;
     search_addr = addr + sizeof(int) * 200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (H5PB_page_exists(f->shared, search_addr, &page_exists) < 0)
+        FAIL_STACK_ERROR;
+    if (!page_exists)
         FAIL_STACK_ERROR;
     search_addr = addr + sizeof(int) * 400;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (H5PB_page_exists(f->shared, search_addr, &page_exists) < 0)
+        FAIL_STACK_ERROR;
+    if (!page_exists)
         FAIL_STACK_ERROR;
 
     /* update elements 150-151, this will update existing pages in the
@@ -959,7 +968,7 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
         data[i] = i + 300;
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 300), sizeof(int) * 1, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     /* read elements 600 - 601, this should read -1 and bring in an
@@ -973,22 +982,28 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
             TEST_ERROR;
         } /* end if */
     }     /* end for */
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     /* Changes: 400 */
     search_addr = addr + sizeof(int) * 400;
-    if (NULL != H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (H5PB_page_exists(f->shared, search_addr, &page_exists) < 0)
+        FAIL_STACK_ERROR;
+    if (page_exists)
         FAIL_STACK_ERROR;
 
     /* Changes: 200 */
     search_addr = addr + sizeof(int) * 200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (H5PB_page_exists(f->shared, search_addr, &page_exists) < 0)
+        FAIL_STACK_ERROR;
+    if (!page_exists)
         FAIL_STACK_ERROR;
 
     /* Changes: 1200 */
     search_addr = addr + sizeof(int) * 1200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (H5PB_page_exists(f->shared, search_addr, &page_exists) < 0)
+        FAIL_STACK_ERROR;
+    if (!page_exists)
         FAIL_STACK_ERROR;
     /* read elements 175 - 225, this should move 100 to the top, evict 600 and bring in 200 */
     /* Changes: 350 - 450; 200, 1200, 400 */
@@ -1000,22 +1015,28 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
             TEST_ERROR;
         } /* end if */
     }     /* end for */
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     /* Changes: 1200 */
     search_addr = addr + sizeof(int) * 1200;
-    if (NULL != H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (H5PB_page_exists(f->shared, search_addr, &page_exists) < 0)
+        FAIL_STACK_ERROR;
+    if (page_exists)
         FAIL_STACK_ERROR;
 
     /* Changes: 200 */
     search_addr = addr + sizeof(int) * 200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (H5PB_page_exists(f->shared, search_addr, &page_exists) < 0)
+        FAIL_STACK_ERROR;
+    if (!page_exists)
         FAIL_STACK_ERROR;
 
     /* Changes: 400 */
     search_addr = addr + sizeof(int) * 400;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (H5PB_page_exists(f->shared, search_addr, &page_exists) < 0)
+        FAIL_STACK_ERROR;
+    if (!page_exists)
         FAIL_STACK_ERROR;
 
     /* update elements 200 - 700 to value 0, this will go to disk but
@@ -1026,17 +1047,21 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 400), sizeof(int) * 1000, data) < 0)
         FAIL_STACK_ERROR;
     page_count -= 1;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     /* Changes: 200 */
     search_addr = addr + sizeof(int) * 200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (H5PB_page_exists(f->shared, search_addr, &page_exists) < 0)
+        FAIL_STACK_ERROR;
+    if (!page_exists)
         FAIL_STACK_ERROR;
 
     /* Changes: 400 */
     search_addr = addr + sizeof(int) * 400;
-    if (NULL != H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (H5PB_page_exists(f->shared, search_addr, &page_exists) < 0)
+        FAIL_STACK_ERROR;
+    if (page_exists)
         FAIL_STACK_ERROR;
 
     if (H5Fclose(file_id) < 0)
@@ -1063,6 +1088,370 @@ error:
     return 1;
 } /* test_lru_processing */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_2q_processing()
+ *
+ * Purpose:     Verify that the 2Q replacement policy is scan resistant:
+ *              pages that have been referenced repeatedly survive a
+ *              sequential scan that is larger than the page buffer,
+ *              while the same sequence of accesses pushes them out of
+ *              the page buffer when the LRU policy is in use.
+ *
+ *              Also checks the policy property and the per memory type
+ *              statistics.
+ *
+ * Return:      0 if test is sucessful
+ *              1 if test fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_2q_processing(hid_t orig_fapl, const char *env_h5_drvr)
+{
+    char                  filename[FILENAME_LEN]; /* Filename to use */
+    hid_t                 file_id   = -1;         /* File ID */
+    hid_t                 fcpl      = -1;
+    hid_t                 fapl      = -1;
+    hid_t                 fapl2     = -1;
+    size_t                page_size = sizeof(int) * 200;
+    int                   num_pages = 40;
+    int                   i;
+    int                   data;
+    haddr_t               addr = HADDR_UNDEF;
+    hbool_t               page_exists;
+    H5F_page_buf_policy_t policy;
+    H5PB_type_stats_t     stats;
+    int *                 buf = NULL;
+    H5F_t *               f   = NULL;
+    herr_t                ret;
+
+    TESTING("2Q Processing");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+
+    if ((fapl = H5Pcopy(orig_fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    if (set_multi_split(env_h5_drvr, fapl, (hsize_t)page_size) != 0)
+        TEST_ERROR;
+
+    if ((buf = (int *)HDcalloc((size_t)num_pages * 200, sizeof(int))) == NULL)
+        TEST_ERROR;
+
+    if ((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 0, (hsize_t)1) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_file_space_page_size(fcpl, (hsize_t)page_size) < 0)
+        FAIL_STACK_ERROR;
+
+    /* keep 8 pages at max in the page buffer */
+    if (H5Pset_page_buffer_size(fapl, page_size * 8, 0, 0) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Check the policy property */
+    if (H5Pget_page_buffer_policy(fapl, &policy) < 0)
+        FAIL_STACK_ERROR;
+    if (policy != H5F_PAGE_BUF_POLICY_LRU)
+        TEST_ERROR;
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_page_buffer_policy(fapl, H5F_PAGE_BUF_POLICY_NTYPES);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR;
+
+    for (policy = H5F_PAGE_BUF_POLICY_LRU; policy < H5F_PAGE_BUF_POLICY_NTYPES; policy++) {
+        H5F_page_buf_policy_t file_policy;
+
+        if (H5Pset_page_buffer_policy(fapl, policy) < 0)
+            FAIL_STACK_ERROR;
+
+        if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl)) < 0)
+            FAIL_STACK_ERROR;
+
+        /* The policy in use should be reported by the file's fapl */
+        if ((fapl2 = H5Fget_access_plist(file_id)) < 0)
+            FAIL_STACK_ERROR;
+        if (H5Pget_page_buffer_policy(fapl2, &file_policy) < 0)
+            FAIL_STACK_ERROR;
+        if (file_policy != policy)
+            TEST_ERROR;
+        if (H5Pclose(fapl2) < 0)
+            FAIL_STACK_ERROR;
+
+        /* Get a pointer to the internal file object */
+        if (NULL == (f = (H5F_t *)H5VL_object(file_id)))
+            FAIL_STACK_ERROR;
+
+        /* Allocate and initialize the raw data pages, bypassing the page buffer */
+        if (HADDR_UNDEF == (addr = H5MF_alloc(f, H5FD_MEM_DRAW, page_size * (size_t)num_pages)))
+            FAIL_STACK_ERROR;
+        for (i = 0; i < num_pages * 200; i++)
+            buf[i] = i;
+        if (H5F_block_write(f, H5FD_MEM_DRAW, addr, page_size * (size_t)num_pages, buf) < 0)
+            FAIL_STACK_ERROR;
+
+        if (H5PB_reset_stats(f->shared->page_buf) < 0)
+            FAIL_STACK_ERROR;
+
+        /* Touch pages 0-9, which overflows the page buffer, then pages 0 and 1
+         * again: these two are now the "hot" pages.
+         */
+        for (i = 0; i < 10; i++)
+            if (H5F_block_read(f, H5FD_MEM_DRAW, addr + page_size * (size_t)i, sizeof(int), &data) < 0)
+                FAIL_STACK_ERROR;
+        for (i = 0; i < 2; i++)
+            if (H5F_block_read(f, H5FD_MEM_DRAW, addr + page_size * (size_t)i, sizeof(int), &data) < 0)
+                FAIL_STACK_ERROR;
+
+        /* Scan the remaining pages once */
+        for (i = 10; i < num_pages; i++) {
+            if (H5F_block_read(f, H5FD_MEM_DRAW, addr + page_size * (size_t)i, sizeof(int), &data) < 0)
+                FAIL_STACK_ERROR;
+            if (data != i * 200)
+                TEST_ERROR;
+        } /* end for */
+
+        /* The hot pages survive the scan only with the 2Q policy */
+        for (i = 0; i < 2; i++) {
+            if (H5PB_page_exists(f->shared, addr + page_size * (size_t)i, &page_exists) < 0)
+                FAIL_STACK_ERROR;
+            if (page_exists != (policy == H5F_PAGE_BUF_POLICY_2Q))
+                TEST_ERROR;
+        } /* end for */
+        if (f->shared->page_buf->index_len != 8)
+            TEST_ERROR;
+
+        /* Check the raw data statistics: every page was read from the file */
+        if (H5PB_get_type_stats(f->shared->page_buf, H5FD_MEM_DRAW, &stats) < 0)
+            FAIL_STACK_ERROR;
+        if (stats.accesses != (unsigned)num_pages + 2 || stats.misses != (unsigned)num_pages + 2 ||
+            stats.hits != 0 || stats.bypasses != 0)
+            TEST_ERROR;
+        if (stats.evictions == 0)
+            TEST_ERROR;
+
+        /* Reading a hot page again is a hit with the 2Q policy only */
+        if (H5F_block_read(f, H5FD_MEM_DRAW, addr, sizeof(int), &data) < 0)
+            FAIL_STACK_ERROR;
+        if (data != 0)
+            TEST_ERROR;
+        if (H5PB_get_type_stats(f->shared->page_buf, H5FD_MEM_DRAW, &stats) < 0)
+            FAIL_STACK_ERROR;
+        if (stats.hits != (policy == H5F_PAGE_BUF_POLICY_2Q ? 1U : 0U))
+            TEST_ERROR;
+
+        if (H5Fclose(file_id) < 0)
+            FAIL_STACK_ERROR;
+    } /* end for */
+
+    if (H5Pclose(fcpl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+    HDfree(buf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl2);
+        H5Pclose(fapl);
+        H5Pclose(fcpl);
+        H5Fclose(file_id);
+        if (buf)
+            HDfree(buf);
+    }
+    H5E_END_TRY;
+    return 1;
+} /* test_2q_processing */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_raw_io_processing()
+ *
+ * Purpose:     Verify the raw data write-behind and read-ahead done by
+ *              the page buffer:
+ *
+ *              - dirty raw data pages are written out, in batches of
+ *                adjacent pages, whenever they use up the write-behind
+ *                budget;
+ *
+ *              - once raw data pages are read sequentially, the pages
+ *                that follow are read in ahead of time.
+ *
+ * Return:      0 if test is sucessful
+ *              1 if test fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_raw_io_processing(hid_t orig_fapl, const char *env_h5_drvr)
+{
+    char              filename[FILENAME_LEN]; /* Filename to use */
+    hid_t             file_id   = -1;         /* File ID */
+    hid_t             fcpl      = -1;
+    hid_t             fapl      = -1;
+    hid_t             fapl2     = -1;
+    size_t            page_size = sizeof(int) * 200;
+    int               num_pages = 20;
+    int               i;
+    int               data;
+    size_t            write_behind;
+    unsigned          read_ahead;
+    haddr_t           addr = HADDR_UNDEF;
+    H5PB_type_stats_t stats;
+    int *             buf = NULL;
+    H5F_t *           f   = NULL;
+
+    TESTING("Raw Data Write-behind and Read-ahead");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+
+    if ((fapl = H5Pcopy(orig_fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    if (set_multi_split(env_h5_drvr, fapl, (hsize_t)page_size) != 0)
+        TEST_ERROR;
+
+    if ((buf = (int *)HDcalloc((size_t)num_pages * 200, sizeof(int))) == NULL)
+        TEST_ERROR;
+
+    if ((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 0, (hsize_t)1) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_file_space_page_size(fcpl, (hsize_t)page_size) < 0)
+        FAIL_STACK_ERROR;
+
+    /* keep 16 pages at max in the page buffer */
+    if (H5Pset_page_buffer_size(fapl, page_size * 16, 0, 0) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Write-behind and read-ahead are off by default */
+    if (H5Pget_page_buffer_raw_io(fapl, &write_behind, &read_ahead) < 0)
+        FAIL_STACK_ERROR;
+    if (write_behind != 0 || read_ahead != 0)
+        TEST_ERROR;
+
+    /* A write-behind budget smaller than a page or larger than the page
+     * buffer should fail file creation
+     */
+    if (H5Pset_page_buffer_raw_io(fapl, page_size - 1, 0) < 0)
+        FAIL_STACK_ERROR;
+    H5E_BEGIN_TRY
+    {
+        file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl);
+    }
+    H5E_END_TRY;
+    if (file_id >= 0)
+        TEST_ERROR;
+    if (H5Pset_page_buffer_raw_io(fapl, page_size * 17, 0) < 0)
+        FAIL_STACK_ERROR;
+    H5E_BEGIN_TRY
+    {
+        file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl);
+    }
+    H5E_END_TRY;
+    if (file_id >= 0)
+        TEST_ERROR;
+
+    /* Write behind 4 pages at a time, read ahead up to 4 pages */
+    if (H5Pset_page_buffer_raw_io(fapl, page_size * 4, 4) < 0)
+        FAIL_STACK_ERROR;
+
+    if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* The settings in use should be reported by the file's fapl */
+    if ((fapl2 = H5Fget_access_plist(file_id)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pget_page_buffer_raw_io(fapl2, &write_behind, &read_ahead) < 0)
+        FAIL_STACK_ERROR;
+    if (write_behind != page_size * 4 || read_ahead != 4)
+        TEST_ERROR;
+    if (H5Pclose(fapl2) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Get a pointer to the internal file object */
+    if (NULL == (f = (H5F_t *)H5VL_object(file_id)))
+        FAIL_STACK_ERROR;
+
+    if (HADDR_UNDEF == (addr = H5MF_alloc(f, H5FD_MEM_DRAW, page_size * (size_t)num_pages)))
+        FAIL_STACK_ERROR;
+    for (i = 0; i < num_pages * 200; i++)
+        buf[i] = i;
+
+    /* Write the first half of each page, so the writes go through the page
+     * buffer.  The dirty pages should be written out after every 4th page.
+     */
+    for (i = 0; i < num_pages; i++) {
+        if (H5F_block_write(f, H5FD_MEM_DRAW, addr + page_size * (size_t)i, page_size / 2, buf + (i * 200)) <
+            0)
+            FAIL_STACK_ERROR;
+
+        if (f->shared->page_buf->dirty_raw_count != (size_t)((i + 1) % 4))
+            TEST_ERROR;
+        if (f->shared->page_buf->batched_writes != (unsigned)((i + 1) / 4))
+            TEST_ERROR;
+    } /* end for */
+
+    if (H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Re-open the file and read one value from each page in turn */
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if (NULL == (f = (H5F_t *)H5VL_object(file_id)))
+        FAIL_STACK_ERROR;
+    if (H5PB_reset_stats(f->shared->page_buf) < 0)
+        FAIL_STACK_ERROR;
+
+    for (i = 0; i < 16; i++) {
+        if (H5F_block_read(f, H5FD_MEM_DRAW, addr + page_size * (size_t)i + sizeof(int) * 50, sizeof(int),
+                           &data) < 0)
+            FAIL_STACK_ERROR;
+        if (data != i * 200 + 50)
+            TEST_ERROR;
+    } /* end for */
+
+    /* Pages 0 and 1 are read individually.  The miss on page 1 is the start
+     * of a sequential scan, so pages 2-5 are read ahead, then pages 7-10
+     * after the miss on page 6, and pages 12-15 after the miss on page 11.
+     */
+    if (H5PB_get_type_stats(f->shared->page_buf, H5FD_MEM_DRAW, &stats) < 0)
+        FAIL_STACK_ERROR;
+    if (stats.accesses != 16 || stats.misses != 4 || stats.hits != 12 || stats.read_aheads != 12)
+        TEST_ERROR;
+
+    if (H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(fcpl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+    HDfree(buf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl2);
+        H5Pclose(fapl);
+        H5Pclose(fcpl);
+        H5Fclose(file_id);
+        if (buf)
+            HDfree(buf);
+    }
+    H5E_END_TRY;
+    return 1;
+} /* test_raw_io_processing */
+
 /*-------------------------------------------------------------------------
  * Function:    test_min_threshold()
  *
@@ -1203,7 +1592,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
 
     page_count += 5;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->raw_count != 5 - base_meta_cnt)
@@ -1225,7 +1614,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_read(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 800), sizeof(int) * 50, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->meta_count != 5)
@@ -1253,7 +1642,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 900), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->meta_count != 5)
@@ -1334,7 +1723,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
 
     page_count += 5;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
     if (page_buf->meta_count != 5 - base_raw_cnt)
         TEST_ERROR;
@@ -1355,7 +1744,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 800), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->raw_count != 5)
@@ -1383,7 +1772,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_read(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 900), sizeof(int) * 50, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->raw_count != 5)
@@ -1468,7 +1857,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
 
     page_count += 5;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         TEST_ERROR;
 
     if (f->shared->page_buf->raw_count != 5 - base_meta_cnt)
@@ -1484,7 +1873,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 400), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 3)
@@ -1595,7 +1984,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
 
     page_count += 5;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     /* add 2 meta entries evicting 2 raw entries */
@@ -1605,7 +1994,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 200), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 2)
@@ -1628,7 +2017,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 100), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 1)
@@ -1643,7 +2032,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 300), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 1)
@@ -1658,7 +2047,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 500), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->index_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 1)
@@ -2173,6 +2562,8 @@ main(void)
     nerrors += test_args(fapl, env_h5_drvr);
     nerrors += test_raw_data_handling(fapl, env_h5_drvr);
     nerrors += test_lru_processing(fapl, env_h5_drvr);
+    nerrors += test_2q_processing(fapl, env_h5_drvr);
+    nerrors += test_raw_io_processing(fapl, env_h5_drvr);
     nerrors += test_min_threshold(fapl, env_h5_drvr);
     nerrors += test_stats_collection(fapl, env_h5_drvr);
 
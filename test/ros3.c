@@ -392,6 +392,13 @@ static char    url_missing[S3_TEST_MAX_URL_SIZE]         = "";
 static char    s3_test_bucket_url[S3_TEST_MAX_URL_SIZE]  = "";
 static hbool_t s3_test_bucket_defined                    = FALSE;
 
+/* Resource read by the block cache tests: any file on an HTTP server that
+ * honors Range requests, such as the local stand-in started by ctest, or
+ * else the public text resource in the test bucket.
+ */
+static char    url_cache[S3_TEST_MAX_URL_SIZE] = "";
+static hbool_t s3_test_cache_defined           = FALSE;
+
 /* Global variables for aws test profile.
  * An attempt is made to read ~/.aws/credentials and ~/.aws/config upon test
  * startup -- if unable to open either file or cannot load region, id, and key,
@@ -1346,6 +1353,288 @@ error:
 
 } /* test_read */
 
+/*---------------------------------------------------------------------------
+ *
+ * Function: test_cache_config()
+ *
+ * Purpose:
+ *
+ *     Test setting, validating and retrieving the block cache configuration
+ *     through `H5Pset_fapl_ros3_cache` and `H5Pget_fapl_ros3_cache`.
+ *
+ * Return:
+ *
+ *     PASSED : 0
+ *     FAILED : 1
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+test_cache_config(void)
+{
+    struct testcase {
+        const char *             msg;
+        herr_t                   expected;
+        H5FD_ros3_cache_config_t config;
+    };
+
+    struct testcase cases[] = {
+        {
+            "typical configuration",
+            SUCCEED,
+            {H5FD_CURR_ROS3_CACHE_CONFIG_VERSION, 4096, 64, 8, 4},
+        },
+        {
+            "cache disabled, other fields ignored",
+            SUCCEED,
+            {H5FD_CURR_ROS3_CACHE_CONFIG_VERSION, 0, 0, 0, 0},
+        },
+        {
+            "single block, no read-ahead",
+            SUCCEED,
+            {H5FD_CURR_ROS3_CACHE_CONFIG_VERSION, 512, 1, 0, 1},
+        },
+        {
+            "invalid version",
+            FAIL,
+            {H5FD_CURR_ROS3_CACHE_CONFIG_VERSION + 1, 4096, 64, 8, 4},
+        },
+        {
+            "empty cache",
+            FAIL,
+            {H5FD_CURR_ROS3_CACHE_CONFIG_VERSION, 4096, 0, 0, 4},
+        },
+        {
+            "read-ahead as large as the cache",
+            FAIL,
+            {H5FD_CURR_ROS3_CACHE_CONFIG_VERSION, 4096, 8, 8, 4},
+        },
+        {
+            "no requests allowed",
+            FAIL,
+            {H5FD_CURR_ROS3_CACHE_CONFIG_VERSION, 4096, 64, 8, 0},
+        },
+    };
+    H5FD_ros3_cache_config_t fetched;
+    unsigned                 ncases  = (unsigned)(sizeof(cases) / sizeof(cases[0]));
+    unsigned                 i       = 0;
+    herr_t                   ret     = FAIL;
+    hid_t                    fapl_id = -1;
+    hid_t                    fapl_cp = -1;
+
+    TESTING("ROS3 block cache configuration");
+
+    /* defaults are reported before any configuration is set */
+    fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    FAIL_IF(fapl_id < 0)
+    JSVERIFY(SUCCEED, H5Pget_fapl_ros3_cache(fapl_id, &fetched), "unable to get default cache config")
+    JSVERIFY(H5FD_CURR_ROS3_CACHE_CONFIG_VERSION, fetched.version, "invalid version number")
+    JSVERIFY(H5FD_ROS3_DEFAULT_BLOCK_SIZE, fetched.block_size, "default block size")
+    JSVERIFY(H5FD_ROS3_DEFAULT_MAX_BLOCKS, fetched.max_blocks, "default cache size")
+    JSVERIFY(H5FD_ROS3_DEFAULT_MAX_READ_AHEAD, fetched.max_read_ahead, "default read-ahead")
+    JSVERIFY(H5FD_ROS3_DEFAULT_MAX_REQUESTS, fetched.max_requests, "default request count")
+
+    for (i = 0; i < ncases; i++) {
+        const struct testcase *tc = &cases[i];
+
+        H5E_BEGIN_TRY { ret = H5Pset_fapl_ros3_cache(fapl_id, &tc->config); }
+        H5E_END_TRY;
+        JSVERIFY(tc->expected, ret, tc->msg)
+
+        if (ret == SUCCEED) {
+            HDmemset(&fetched, 0, sizeof(fetched));
+            JSVERIFY(SUCCEED, H5Pget_fapl_ros3_cache(fapl_id, &fetched), "unable to get cache config")
+            JSVERIFY(tc->config.block_size, fetched.block_size, tc->msg)
+            JSVERIFY(tc->config.max_blocks, fetched.max_blocks, tc->msg)
+            JSVERIFY(tc->config.max_read_ahead, fetched.max_read_ahead, tc->msg)
+            JSVERIFY(tc->config.max_requests, fetched.max_requests, tc->msg)
+        }
+    }
+
+    /* the last accepted configuration survives failed attempts, setting the
+     * driver, and copying the property list
+     */
+    FAIL_IF(FAIL == H5Pset_fapl_ros3(fapl_id, &anonymous_fa))
+    fapl_cp = H5Pcopy(fapl_id);
+    FAIL_IF(fapl_cp < 0)
+    HDmemset(&fetched, 0, sizeof(fetched));
+    JSVERIFY(SUCCEED, H5Pget_fapl_ros3_cache(fapl_cp, &fetched), "unable to get copied cache config")
+    JSVERIFY(512, fetched.block_size, "copied block size")
+    JSVERIFY(1, fetched.max_blocks, "copied cache size")
+
+    H5E_BEGIN_TRY { ret = H5Pset_fapl_ros3_cache(fapl_id, NULL); }
+    H5E_END_TRY;
+    JSVERIFY(FAIL, ret, "NULL configuration accepted")
+
+    FAIL_IF(FAIL == H5Pclose(fapl_cp))
+    fapl_cp = -1;
+    FAIL_IF(FAIL == H5Pclose(fapl_id))
+    fapl_id = -1;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (fapl_cp >= 0)
+            (void)H5Pclose(fapl_cp);
+        if (fapl_id >= 0)
+            (void)H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+
+} /* test_cache_config */
+
+/*---------------------------------------------------------------------------
+ *
+ * Function: test_cache_read()
+ *
+ * Purpose:
+ *
+ *     Verify that reads through the block cache return the same bytes as
+ *     uncached range-gets, across block sizes, cache sizes, read-ahead and
+ *     concurrency settings, and sequential, backward, and cache-bypassing
+ *     access patterns.
+ *
+ *     Reads the resource at HDF5_ROS3_TEST_CACHE_URL anonymously, or the
+ *     public text resource if only the bucket url is defined.
+ *
+ * Return:
+ *
+ *     PASSED : 0
+ *     FAILED : 1
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+test_cache_read(void)
+{
+    H5FD_ros3_cache_config_t configs[] = {
+        {H5FD_CURR_ROS3_CACHE_CONFIG_VERSION, 64, 16, 8, 4},  /* many small blocks, concurrent  */
+        {H5FD_CURR_ROS3_CACHE_CONFIG_VERSION, 100, 3, 2, 1},  /* unaligned, tiny cache, serial */
+        {H5FD_CURR_ROS3_CACHE_CONFIG_VERSION, 1000, 1, 0, 2}, /* single block                  */
+        {H5FD_CURR_ROS3_CACHE_CONFIG_VERSION, H5FD_ROS3_DEFAULT_BLOCK_SIZE, H5FD_ROS3_DEFAULT_MAX_BLOCKS,
+         H5FD_ROS3_DEFAULT_MAX_READ_AHEAD, H5FD_ROS3_DEFAULT_MAX_REQUESTS}, /* defaults */
+    };
+    H5FD_ros3_cache_config_t no_cache = {H5FD_CURR_ROS3_CACHE_CONFIG_VERSION, 0, 0, 0, 0};
+    unsigned                 nconfigs = (unsigned)(sizeof(configs) / sizeof(configs[0]));
+    char *                   expected = NULL;
+    char *                   buffer   = NULL;
+    haddr_t                  eof      = 0;
+    haddr_t                  addr     = 0;
+    size_t                   len      = 0;
+    unsigned                 i        = 0;
+    H5FD_t *                 file     = NULL;
+    hid_t                    fapl_id  = -1;
+
+    TESTING("ROS3 VFD block cache reads");
+
+    if (FALSE == s3_test_cache_defined) {
+        SKIPPED();
+        HDputs("    environment variables HDF5_ROS3_TEST_CACHE_URL and "
+               "HDF5_ROS3_TEST_BUCKET_URL not defined");
+        HDfflush(stdout);
+        return 0;
+    }
+
+    /*********
+     * SETUP *
+     *********/
+
+    fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    FAIL_IF(fapl_id < 0)
+    FAIL_IF(FAIL == H5Pset_fapl_ros3(fapl_id, &anonymous_fa))
+
+    /* reference contents, one range-get per read */
+    FAIL_IF(FAIL == H5Pset_fapl_ros3_cache(fapl_id, &no_cache))
+    file = H5FDopen(url_cache, H5F_ACC_RDONLY, fapl_id, HADDR_UNDEF);
+    FAIL_IF(NULL == file)
+    eof = H5FDget_eof(file, H5FD_MEM_DEFAULT);
+    FAIL_IF(HADDR_UNDEF == eof || 0 == eof)
+    FAIL_IF(FAIL == H5FDset_eoa(file, H5FD_MEM_DEFAULT, eof))
+    expected = (char *)HDmalloc((size_t)eof);
+    buffer   = (char *)HDmalloc((size_t)eof);
+    FAIL_IF(NULL == expected || NULL == buffer)
+    FAIL_IF(FAIL == H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, 0, (size_t)eof, expected))
+    FAIL_IF(FAIL == H5FDclose(file))
+    file = NULL;
+
+    /*********
+     * TESTS *
+     *********/
+
+    for (i = 0; i < nconfigs; i++) {
+        FAIL_IF(FAIL == H5Pset_fapl_ros3_cache(fapl_id, &configs[i]))
+        file = H5FDopen(url_cache, H5F_ACC_RDONLY, fapl_id, HADDR_UNDEF);
+        FAIL_IF(NULL == file)
+        FAIL_IF(FAIL == H5FDset_eoa(file, H5FD_MEM_DEFAULT, eof))
+
+        /* sequential reads, growing the read-ahead window */
+        HDmemset(buffer, 0, (size_t)eof);
+        for (addr = 0; addr < eof; addr += len) {
+            len = (size_t)MIN(37, eof - addr);
+            FAIL_IF(FAIL == H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, addr, len, buffer + addr))
+        }
+        JSVERIFY(0, HDmemcmp(expected, buffer, (size_t)eof), "sequential reads differ")
+
+        /* backward reads, defeating read-ahead and cycling the cache */
+        HDmemset(buffer, 0, (size_t)eof);
+        for (addr = eof; addr > 0; addr -= len) {
+            len = (size_t)MIN(211, addr);
+            FAIL_IF(FAIL == H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, addr - len, len, buffer + addr - len))
+        }
+        JSVERIFY(0, HDmemcmp(expected, buffer, (size_t)eof), "backward reads differ")
+
+        /* whole file at once, bypassing the cache */
+        HDmemset(buffer, 0, (size_t)eof);
+        FAIL_IF(FAIL == H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, 0, (size_t)eof, buffer))
+        JSVERIFY(0, HDmemcmp(expected, buffer, (size_t)eof), "whole-file read differs")
+
+        /* reads past the end of the file still fail */
+        H5E_BEGIN_TRY
+        {
+            JSVERIFY(FAIL, H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, eof - 10, 20, buffer),
+                     "read past EOF succeeded")
+        }
+        H5E_END_TRY;
+
+        FAIL_IF(FAIL == H5FDclose(file))
+        file = NULL;
+    }
+
+    /************
+     * TEARDOWN *
+     ************/
+
+    HDfree(expected);
+    HDfree(buffer);
+    FAIL_IF(FAIL == H5Pclose(fapl_id))
+    fapl_id = -1;
+
+    PASSED();
+    return 0;
+
+error:
+    /***********
+     * CLEANUP *
+     ***********/
+
+    if (file)
+        (void)H5FDclose(file);
+    if (fapl_id >= 0) {
+        H5E_BEGIN_TRY { (void)H5Pclose(fapl_id); }
+        H5E_END_TRY;
+    }
+    HDfree(expected);
+    HDfree(buffer);
+
+    return 1;
+
+} /* test_cache_read */
+
 /*---------------------------------------------------------------------------
  *
  * Function: test_noops_and_autofails()
@@ -1726,6 +2015,7 @@ main(void)
 #ifdef H5_HAVE_ROS3_VFD
     int         nerrors        = 0;
     const char *bucket_url_env = NULL;
+    const char *cache_url_env  = NULL;
 
 #endif /* H5_HAVE_ROS3_VFD */
 
@@ -1772,6 +2062,17 @@ main(void)
         return 1;
     }
 
+    cache_url_env = HDgetenv("HDF5_ROS3_TEST_CACHE_URL");
+    if (cache_url_env != NULL && cache_url_env[0] != '\0') {
+        HDstrncpy(url_cache, cache_url_env, S3_TEST_MAX_URL_SIZE);
+        url_cache[S3_TEST_MAX_URL_SIZE - 1] = '\0';
+        s3_test_cache_defined               = TRUE;
+    }
+    else if (s3_test_bucket_defined) {
+        HDstrncpy(url_cache, url_text_public, S3_TEST_MAX_URL_SIZE);
+        s3_test_cache_defined = TRUE;
+    }
+
     /**************************************
      * load credentials and prepare fapls *
      **************************************/
@@ -1807,6 +2108,8 @@ main(void)
     nerrors += test_eof_eoa();
     nerrors += test_H5FDread_without_eoa_set_fails();
     nerrors += test_read();
+    nerrors += test_cache_config();
+    nerrors += test_cache_read();
     nerrors += test_noops_and_autofails();
     nerrors += test_cmp();
     nerrors += test_H5F_integration();
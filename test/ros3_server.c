@@ -0,0 +1,523 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Minimal HTTP/1.1 server for testing the ros3 VFD without
+ *              access to S3.
+ *
+ *              Serves the files in its working directory to HEAD and GET
+ *              requests on the loopback interface, honoring single
+ *              "Range: bytes=first-[last]" headers.  Each connection is
+ *              handled by a forked child, so that concurrent range-gets
+ *              from a curl multi handle are answered concurrently.
+ *
+ *              Run with `--stop` to shut down a running server.
+ */
+
+#include "H5private.h" /* System compatability call-wrapper macros */
+
+#ifdef H5_HAVE_ROS3_VFD
+
+#define R3S_DEFAULT_IP     "127.0.0.1"
+#define R3S_DEFAULT_PORTNO 3080
+#define R3S_REQUEST_SIZE   4096  /* bytes allowed in a request line and headers */
+#define R3S_IO_SIZE        65536 /* bytes copied from file to socket at a time  */
+#define R3S_SHUTDOWN_PATH  "/shutdown"
+
+/* ----------------------------------------------------------------------------
+ * Structure:   struct r3s_opts
+ *
+ * Purpose:     Convenience structure to hold options as parsed from the
+ *              command line.
+ *
+ * `help` (int)
+ *      Flag that the help argument was present.
+ *
+ * `stop` (int)
+ *      Flag to shut down a running server instead of starting one.
+ *
+ * `portno` (int)
+ *      Port number to listen on, or of the server to stop.
+ *
+ * ----------------------------------------------------------------------------
+ */
+struct r3s_opts {
+    int help;
+    int stop;
+    int portno;
+};
+
+/* ----------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Print usage message to stdout.
+ * ----------------------------------------------------------------------------
+ */
+static void
+usage(void)
+{
+    HDprintf("ros3_server [options]\n"
+             "Serve the files in the working directory over HTTP on %s,\n"
+             "honoring Range requests, for the ros3 VFD tests.\n"
+             "\n"
+             "Options:\n"
+             "    -h | --help Print this usage message and exit.\n"
+             "    --port=PORT Port to listen on (default %d)\n"
+             "    --stop      Shut down the server listening on PORT\n",
+             R3S_DEFAULT_IP, R3S_DEFAULT_PORTNO);
+} /* end usage() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    parse_args
+ *
+ * Purpose:     Parse command-line arguments, populating the options struct
+ *              pointer as appropriate.
+ *              Default values will be set for unspecified options.
+ *
+ * Return:      0 on success, negative (-1) if error.
+ * ----------------------------------------------------------------------------
+ */
+static int
+parse_args(int argc, char **argv, struct r3s_opts *opts)
+{
+    int i = 0;
+
+    opts->help   = 0;
+    opts->stop   = 0;
+    opts->portno = R3S_DEFAULT_PORTNO;
+
+    for (i = 1; i < argc; i++) {
+        if (!HDstrncmp(argv[i], "-h", 3) || !HDstrncmp(argv[i], "--help", 7)) {
+            opts->help = 1;
+        }
+        else if (!HDstrncmp(argv[i], "--stop", 7)) {
+            opts->stop = 1;
+        }
+        else if (!HDstrncmp(argv[i], "--port=", 7)) {
+            opts->portno = HDatoi(argv[i] + 7);
+        }
+        else {
+            HDprintf("Unrecognized option: '%s'\n", argv[i]);
+            usage();
+            return -1;
+        }
+    } /* end for each argument from command line */
+
+    return 0;
+} /* end parse_args() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    write_all
+ *
+ * Purpose:     Write all `size` bytes of `buf` to the socket.
+ *
+ * Return:      0 on success, negative (-1) if error.
+ * ----------------------------------------------------------------------------
+ */
+static int
+write_all(int sock, const char *buf, size_t size)
+{
+    ssize_t n = 0;
+
+    while (size > 0) {
+        if ((n = HDwrite(sock, buf, size)) < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        buf += n;
+        size -= (size_t)n;
+    }
+
+    return 0;
+} /* end write_all() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    read_request
+ *
+ * Purpose:     Read one request, up to and including the blank line ending
+ *              its headers, into `buf`.  Bytes read past the end of the
+ *              request are kept at the start of `buf` for the next one, with
+ *              their count stored in `*pending`.
+ *
+ * Return:      Length of the request on success, 0 if the client closed
+ *              the connection, negative (-1) if error.
+ * ----------------------------------------------------------------------------
+ */
+static ssize_t
+read_request(int sock, char *buf, size_t *pending)
+{
+    char *  end  = NULL;
+    size_t  used = *pending;
+    ssize_t n    = 0;
+
+    *pending = 0;
+    for (;;) {
+        buf[used] = '\0';
+        if (NULL != (end = HDstrstr(buf, "\r\n\r\n")))
+            break;
+        if (used == R3S_REQUEST_SIZE)
+            return -1;
+        if ((n = HDread(sock, buf + used, R3S_REQUEST_SIZE - used)) < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        if (n == 0)
+            return (used == 0) ? 0 : -1;
+        used += (size_t)n;
+    }
+
+    end += 4;
+    *pending = used - (size_t)(end - buf);
+    return (ssize_t)(end - buf);
+} /* end read_request() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    send_status
+ *
+ * Purpose:     Send a response without a body.
+ *
+ * Return:      0 on success, negative (-1) if error.
+ * ----------------------------------------------------------------------------
+ */
+static int
+send_status(int sock, const char *status, const char *extra)
+{
+    char head[256];
+    int  len = 0;
+
+    len = HDsnprintf(head, sizeof(head), "HTTP/1.1 %s\r\n%sContent-Length: 0\r\n\r\n", status, extra);
+    if (len < 0 || (size_t)len >= sizeof(head))
+        return -1;
+
+    return write_all(sock, head, (size_t)len);
+} /* end send_status() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    send_file
+ *
+ * Purpose:     Respond to a HEAD or GET request for `path`, relative to the
+ *              working directory, with the whole file or the single byte
+ *              range given in `range` (the value of a Range header, or NULL).
+ *
+ * Return:      0 on success, negative (-1) if the connection must be
+ *              closed.
+ * ----------------------------------------------------------------------------
+ */
+static int
+send_file(int sock, const char *path, const char *range, hbool_t head_only)
+{
+    char               head[256];
+    char               extra[128];
+    char *             buf = NULL;
+    h5_stat_t          sb;
+    unsigned long long first = 0;
+    unsigned long long last  = 0;
+    unsigned long long left  = 0;
+    int                fd    = -1;
+    int                len   = 0;
+    int                ret   = -1;
+
+    /* Only plain file names are served, never anything above the directory */
+    if (*path == '\0' || HDstrchr(path, '/') || HDstrstr(path, ".."))
+        return send_status(sock, "404 Not Found", "");
+
+    if ((fd = HDopen(path, O_RDONLY)) < 0 || HDfstat(fd, &sb) < 0 || !S_ISREG(sb.st_mode)) {
+        if (fd >= 0)
+            HDclose(fd);
+        return send_status(sock, "404 Not Found", "");
+    }
+
+    last = (unsigned long long)sb.st_size - 1;
+    if (range != NULL) {
+        char *end = NULL;
+
+        /* Suffix ranges ("bytes=-N") and range lists are not supported */
+        if (HDstrncmp(range, "bytes=", 6) || range[6] < '0' || range[6] > '9')
+            goto bad_range;
+        first = HDstrtoull(range + 6, &end, 10);
+        if (*end != '-')
+            goto bad_range;
+        range = end + 1;
+        if (*range >= '0' && *range <= '9') {
+            last = HDstrtoull(range, &end, 10);
+            if (last < first)
+                goto bad_range;
+            if (last >= (unsigned long long)sb.st_size)
+                last = (unsigned long long)sb.st_size - 1;
+        }
+        if (first >= (unsigned long long)sb.st_size)
+            goto bad_range;
+
+        HDsnprintf(extra, sizeof(extra), "Content-Range: bytes %llu-%llu/%llu\r\n", first, last,
+                   (unsigned long long)sb.st_size);
+    }
+    else
+        extra[0] = '\0';
+
+    left = (sb.st_size == 0) ? 0 : last - first + 1;
+    len  = HDsnprintf(head, sizeof(head),
+                     "HTTP/1.1 %s\r\nAccept-Ranges: bytes\r\n%sContent-Length: %llu\r\n\r\n",
+                     range ? "206 Partial Content" : "200 OK", extra, left);
+    if (write_all(sock, head, (size_t)len) < 0)
+        goto done;
+
+    if (!head_only && left > 0) {
+        if (NULL == (buf = (char *)HDmalloc(R3S_IO_SIZE)))
+            goto done;
+        if (HDlseek(fd, (HDoff_t)first, SEEK_SET) < 0)
+            goto done;
+        while (left > 0) {
+            ssize_t n = HDread(fd, buf, (size_t)MIN(left, R3S_IO_SIZE));
+
+            if (n <= 0)
+                goto done;
+            if (write_all(sock, buf, (size_t)n) < 0)
+                goto done;
+            left -= (unsigned long long)n;
+        }
+    }
+
+    ret = 0;
+
+done:
+    HDfree(buf);
+    HDclose(fd);
+    return ret;
+
+bad_range:
+    HDclose(fd);
+    HDsnprintf(extra, sizeof(extra), "Content-Range: bytes */%llu\r\n", (unsigned long long)sb.st_size);
+    return send_status(sock, "416 Range Not Satisfiable", extra);
+} /* end send_file() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    serve_connection
+ *
+ * Purpose:     Answer the requests arriving on one connection until the
+ *              client closes it.  A request for the shutdown path stops
+ *              the listening (parent) process.
+ * ----------------------------------------------------------------------------
+ */
+static void
+serve_connection(int sock)
+{
+    char    buf[R3S_REQUEST_SIZE + 1];
+    size_t  pending = 0;
+    ssize_t len     = 0;
+
+    while ((len = read_request(sock, buf, &pending)) > 0) {
+        char *  method = buf;
+        char *  path   = NULL;
+        char *  range  = NULL;
+        char *  line   = NULL;
+        hbool_t head_only;
+        int     ret;
+
+        buf[len - 2] = '\0'; /* terminate last header line */
+
+        if (NULL == (path = HDstrchr(method, ' ')))
+            break;
+        *path++ = '\0';
+        if (NULL == (line = HDstrchr(path, ' ')))
+            break;
+        *line = '\0';
+
+        /* Find the Range header, if any */
+        line = HDstrstr(line + 1, "\r\n");
+        while (line != NULL && line[2] != '\0') {
+            line += 2;
+            if (!HDstrncmp(line, "Range:", 6)) {
+                range = line + 6;
+                while (*range == ' ')
+                    range++;
+                range[HDstrcspn(range, "\r")] = '\0';
+                break;
+            }
+            line = HDstrstr(line, "\r\n");
+        }
+
+        head_only = !HDstrcmp(method, "HEAD");
+        if (!HDstrcmp(path, R3S_SHUTDOWN_PATH)) {
+            send_status(sock, "200 OK", "");
+            HDkill(HDgetppid(), SIGTERM);
+            break;
+        }
+        else if (*path != '/')
+            ret = send_status(sock, "400 Bad Request", "");
+        else if (head_only || !HDstrcmp(method, "GET"))
+            ret = send_file(sock, path + 1, range, head_only);
+        else
+            ret = send_status(sock, "405 Method Not Allowed", "");
+        if (ret < 0)
+            break;
+
+        HDmemmove(buf, buf + len, pending);
+    }
+
+    HDclose(sock);
+} /* end serve_connection() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    run_server
+ *
+ * Purpose:     Listen on the loopback interface, forking a child to serve
+ *              each accepted connection.  Returns only on error.
+ *
+ * Return:      Negative (-1).
+ * ----------------------------------------------------------------------------
+ */
+static int
+run_server(const struct r3s_opts *opts)
+{
+    struct sockaddr_in addr;
+    int                listen_sock = -1;
+    int                opt         = 1;
+
+    /* Let children be reaped automatically */
+    HDsignal(SIGCHLD, SIG_IGN);
+
+    if ((listen_sock = HDsocket(AF_INET, SOCK_STREAM, 0)) < 0) {
+        HDprintf("ERROR socket() (%d)\n%s\n", errno, HDstrerror(errno));
+        return -1;
+    }
+    HDsetsockopt(listen_sock, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+
+    addr.sin_family      = AF_INET;
+    addr.sin_port        = HDhtons((uint16_t)opts->portno);
+    addr.sin_addr.s_addr = HDinet_addr(R3S_DEFAULT_IP);
+    HDmemset(addr.sin_zero, '\0', sizeof(addr.sin_zero));
+
+    if (HDbind(listen_sock, (struct sockaddr *)&addr, (socklen_t)sizeof(addr)) < 0) {
+        HDprintf("ERROR bind() (%d)\n%s\n", errno, HDstrerror(errno));
+        return -1;
+    }
+    if (HDlisten(listen_sock, 64) < 0) {
+        HDprintf("ERROR listen() (%d)\n%s\n", errno, HDstrerror(errno));
+        return -1;
+    }
+
+    HDprintf("Serving on %s:%d\n", R3S_DEFAULT_IP, opts->portno);
+    HDfflush(stdout);
+
+    for (;;) {
+        int   sock = HDaccept(listen_sock, NULL, NULL);
+        pid_t pid;
+
+        if (sock < 0) {
+            if (errno == EINTR)
+                continue;
+            HDprintf("ERROR accept() (%d)\n%s\n", errno, HDstrerror(errno));
+            return -1;
+        }
+
+        /* Headers and body are written separately, don't delay the body */
+        HDsetsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt));
+
+        if ((pid = HDfork()) == 0) {
+            HDclose(listen_sock);
+            serve_connection(sock);
+            HD_exit(EXIT_SUCCESS);
+        }
+        if (pid < 0)
+            HDprintf("ERROR fork() (%d)\n%s\n", errno, HDstrerror(errno));
+        HDclose(sock);
+    }
+} /* end run_server() */
+
+/* ----------------------------------------------------------------------------
+ * Function:    send_shutdown
+ *
+ * Purpose:     Request the shutdown path from a running server.
+ *
+ * Return:      0 on success, negative (-1) if error.
+ * ----------------------------------------------------------------------------
+ */
+static int
+send_shutdown(const struct r3s_opts *opts)
+{
+    const char         request[] = "GET " R3S_SHUTDOWN_PATH " HTTP/1.1\r\nHost: " R3S_DEFAULT_IP "\r\n\r\n";
+    char               reply[64];
+    struct sockaddr_in target_addr;
+    int                live_socket;
+
+    if ((live_socket = HDsocket(AF_INET, SOCK_STREAM, 0)) < 0) {
+        HDprintf("ERROR socket()\n");
+        return -1;
+    }
+
+    target_addr.sin_family      = AF_INET;
+    target_addr.sin_port        = HDhtons((uint16_t)opts->portno);
+    target_addr.sin_addr.s_addr = HDinet_addr(R3S_DEFAULT_IP);
+    HDmemset(target_addr.sin_zero, '\0', sizeof(target_addr.sin_zero));
+
+    if (HDconnect(live_socket, (struct sockaddr *)&target_addr, (socklen_t)sizeof(target_addr)) < 0) {
+        HDprintf("ERROR connect() (%d)\n%s\n", errno, HDstrerror(errno));
+        return -1;
+    }
+    if (write_all(live_socket, request, sizeof(request) - 1) < 0) {
+        HDprintf("ERROR write() (%d)\n%s\n", errno, HDstrerror(errno));
+        return -1;
+    }
+
+    /* Wait for the server to acknowledge and close the connection */
+    while (HDread(live_socket, reply, sizeof(reply)) > 0)
+        ;
+
+    if (HDclose(live_socket) < 0) {
+        HDprintf("ERROR close() can't close socket\n");
+        return -1;
+    }
+
+    return 0;
+} /* end send_shutdown() */
+
+/* ------------------------------------------------------------------------- */
+int
+main(int argc, char **argv)
+{
+    struct r3s_opts opts;
+
+    if (parse_args(argc, argv, &opts) < 0) {
+        HDprintf("Unable to parse arguments\n");
+        HDexit(EXIT_FAILURE);
+    }
+
+    if (opts.help) {
+        usage();
+        HDexit(EXIT_FAILURE);
+    }
+
+    if (opts.stop) {
+        if (send_shutdown(&opts) < 0) {
+            HDprintf("Unable to send shutdown command\n");
+            HDexit(EXIT_FAILURE);
+        }
+        HDexit(EXIT_SUCCESS);
+    }
+
+    run_server(&opts);
+    HDexit(EXIT_FAILURE);
+} /* end main() */
+
+#else /* H5_HAVE_ROS3_VFD */
+
+/* ------------------------------------------------------------------------- */
+int
+main(void)
+{
+    HDprintf("ros3 VFD not built -- no server to run.\n");
+    HDexit(EXIT_FAILURE);
+}
+
+#endif /* H5_HAVE_ROS3_VFD */
@@ -133,6 +133,8 @@ float attr_data5 = -5.123F; /* Test data for 5th attribute */
 #define NATTR_MANY_OLD 350
 #define NATTR_MANY_NEW 35000
 
+#define NATTR_COMPACT_BY_NAME 64
+
 #define BUG2_NATTR  100
 #define BUG2_NATTR2 16
 
@@ -4341,6 +4343,200 @@ test_attr_many(hbool_t new_format, hid_t fcpl, hid_t fapl)
     CHECK(ret, FAIL, "H5Sclose");
 } /* test_attr_many() */
 
+/****************************************************************
+**
+**  test_attr_compact_by_name_check(): Test basic H5A (attribute) code.
+**      Checks that an attribute can be found & opened by name and
+**      has the expected value
+**
+****************************************************************/
+static void
+test_attr_compact_by_name_check(hid_t loc_id, const char *attrname, unsigned expected)
+{
+    hid_t    aid;    /* Attribute ID            */
+    htri_t   exists; /* Whether the attribute exists or not */
+    unsigned value;  /* Attribute value */
+    herr_t   ret;    /* Generic return value        */
+
+    exists = H5Aexists(loc_id, attrname);
+    VERIFY(exists, TRUE, "H5Aexists");
+
+    aid = H5Aopen(loc_id, attrname, H5P_DEFAULT);
+    CHECK(aid, FAIL, "H5Aopen");
+
+    ret = H5Aread(aid, H5T_NATIVE_UINT, &value);
+    CHECK(ret, FAIL, "H5Aread");
+    VERIFY(value, expected, "H5Aread");
+
+    ret = H5Aclose(aid);
+    CHECK(ret, FAIL, "H5Aclose");
+} /* test_attr_compact_by_name_check() */
+
+/****************************************************************
+**
+**  test_attr_compact_by_name(): Test basic H5A (attribute) code.
+**      Tests by-name operations on many compact attributes while
+**      they are renamed, deleted & re-created
+**
+****************************************************************/
+static void
+test_attr_compact_by_name(hid_t fcpl, hid_t fapl)
+{
+    hid_t    fid;                           /* HDF5 File ID            */
+    hid_t    gcpl;                          /* Group creation property list ID */
+    hid_t    gid;                           /* Group ID            */
+    hid_t    sid;                           /* Dataspace ID            */
+    hid_t    aid;                           /* Attribute ID            */
+    char     attrname[NAME_BUF_SIZE];       /* Name of attribute */
+    char     newname[NAME_BUF_SIZE];        /* New name of attribute */
+    unsigned nattr = NATTR_COMPACT_BY_NAME; /* Number of attributes */
+    htri_t   is_dense;                      /* Are attributes stored densely? */
+    htri_t   exists;                        /* Whether the attribute exists or not */
+    unsigned u;                             /* Local index variable */
+    herr_t   ret;                           /* Generic return value        */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing By-Name Operations on Compact Attributes\n"));
+
+    /* Create file */
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    /* Create dataspace for attribute */
+    sid = H5Screate(H5S_SCALAR);
+    CHECK(sid, FAIL, "H5Screate");
+
+    /* Keep all the attributes in compact storage */
+    gcpl = H5Pcreate(H5P_GROUP_CREATE);
+    CHECK(gcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_attr_phase_change(gcpl, 2 * nattr, nattr);
+    CHECK(ret, FAIL, "H5Pset_attr_phase_change");
+
+    /* Create group for attributes */
+    gid = H5Gcreate2(fid, GROUP1_NAME, H5P_DEFAULT, gcpl, H5P_DEFAULT);
+    CHECK(gid, FAIL, "H5Gcreate2");
+
+    /* Create attributes, looking each one up by name as it is created */
+    for (u = 0; u < nattr; u++) {
+        HDsprintf(attrname, "attr %03u", u);
+
+        exists = H5Aexists(gid, attrname);
+        VERIFY(exists, FALSE, "H5Aexists");
+
+        aid = H5Acreate2(gid, attrname, H5T_NATIVE_UINT, sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(aid, FAIL, "H5Acreate2");
+
+        ret = H5Awrite(aid, H5T_NATIVE_UINT, &u);
+        CHECK(ret, FAIL, "H5Awrite");
+
+        ret = H5Aclose(aid);
+        CHECK(ret, FAIL, "H5Aclose");
+
+        test_attr_compact_by_name_check(gid, attrname, u);
+    } /* end for */
+
+    /* Verify the attributes are stored compactly */
+    is_dense = H5O__is_attr_dense_test(gid);
+    VERIFY(is_dense, FALSE, "H5O__is_attr_dense_test");
+
+    /* Rename the attributes, alternating between names of the same length
+     * (renamed in place) and longer names (moved within the header)
+     */
+    for (u = 0; u < nattr; u++) {
+        HDsprintf(attrname, "attr %03u", u);
+        if (u % 2)
+            HDsprintf(newname, "renamed attr %03u", u);
+        else
+            HDsprintf(newname, "ATTR %03u", u);
+
+        ret = H5Arename(gid, attrname, newname);
+        CHECK(ret, FAIL, "H5Arename");
+
+        exists = H5Aexists(gid, attrname);
+        VERIFY(exists, FALSE, "H5Aexists");
+
+        test_attr_compact_by_name_check(gid, newname, u);
+    } /* end for */
+
+    /* Delete every third attribute */
+    for (u = 0; u < nattr; u += 3) {
+        if (u % 2)
+            HDsprintf(newname, "renamed attr %03u", u);
+        else
+            HDsprintf(newname, "ATTR %03u", u);
+
+        ret = H5Adelete(gid, newname);
+        CHECK(ret, FAIL, "H5Adelete");
+
+        exists = H5Aexists(gid, newname);
+        VERIFY(exists, FALSE, "H5Aexists");
+    } /* end for */
+
+    /* Re-create the deleted attributes under their original names */
+    for (u = 0; u < nattr; u += 3) {
+        unsigned value = u + nattr; /* Attribute value */
+
+        HDsprintf(attrname, "attr %03u", u);
+        aid = H5Acreate2(gid, attrname, H5T_NATIVE_UINT, sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(aid, FAIL, "H5Acreate2");
+
+        ret = H5Awrite(aid, H5T_NATIVE_UINT, &value);
+        CHECK(ret, FAIL, "H5Awrite");
+
+        ret = H5Aclose(aid);
+        CHECK(ret, FAIL, "H5Aclose");
+    } /* end for */
+
+    /* Close group */
+    ret = H5Gclose(gid);
+    CHECK(ret, FAIL, "H5Gclose");
+
+    /* Close file */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Re-open the file and check on the attributes */
+    fid = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl);
+    CHECK(fid, FAIL, "H5Fopen");
+
+    gid = H5Gopen2(fid, GROUP1_NAME, H5P_DEFAULT);
+    CHECK(gid, FAIL, "H5Gopen2");
+
+    for (u = 0; u < nattr; u++) {
+        if (u % 3 == 0) {
+            HDsprintf(attrname, "attr %03u", u);
+            test_attr_compact_by_name_check(gid, attrname, u + nattr);
+        } /* end if */
+        else {
+            if (u % 2)
+                HDsprintf(newname, "renamed attr %03u", u);
+            else
+                HDsprintf(newname, "ATTR %03u", u);
+            test_attr_compact_by_name_check(gid, newname, u);
+
+            HDsprintf(attrname, "attr %03u", u);
+            exists = H5Aexists(gid, attrname);
+            VERIFY(exists, FALSE, "H5Aexists");
+        } /* end else */
+    }     /* end for */
+
+    /* Close group */
+    ret = H5Gclose(gid);
+    CHECK(ret, FAIL, "H5Gclose");
+
+    /* Close file */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Close property list */
+    ret = H5Pclose(gcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    /* Close dataspace */
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+} /* test_attr_compact_by_name() */
+
 /****************************************************************
 **
 **  test_attr_corder_create_empty(): Test basic H5A (attribute) code.
@@ -11243,6 +11439,7 @@ test_attr(void)
                 test_attr_null_space(my_fcpl, my_fapl);       /* Test storing attribute with NULL dataspace */
                 test_attr_deprec(fcpl, my_fapl);              /* Test deprecated API routines */
                 test_attr_many(new_format, my_fcpl, my_fapl); /* Test storing lots of attributes */
+                test_attr_compact_by_name(my_fcpl, my_fapl);  /* Test compact attribute name index */
                 test_attr_info_null_info_pointer(my_fcpl,
                                                  my_fapl); /* Test passing a NULL attribute info pointer to
                                                               H5Aget_info(_by_name/_by_idx) */
@@ -330,6 +330,13 @@ typedef struct {
 #define MISC35_SPACE_DIM3 13
 #define MISC35_NPOINTS    10
 
+/* Definitions for misc. test #36 */
+#define MISC36_FILE       "tmisc36.h5"
+#define MISC36_DSETNAME   "dset"
+#define MISC36_DIM0       64
+#define MISC36_DIM1       256
+#define MISC36_SIEVE_SIZE 2048
+
 /****************************************************************
 **
 **  test_misc1(): test unlinking a dataset from a group and immediately
@@ -5752,6 +5759,155 @@ test_misc35(void)
 
 } /* end test_misc35() */
 
+/****************************************************************
+**
+**  test_misc36_access(): Helper routine to write or read a
+**      block of a dataset and keep the in-memory copy in sync
+**      (for writes) or compare against it (for reads).
+**
+****************************************************************/
+static void
+test_misc36_access(hid_t dset, int *model, hbool_t do_write, hsize_t row, hsize_t col, hsize_t nrows,
+                   hsize_t ncols, int value)
+{
+    hid_t   fspace, mspace;
+    hsize_t start[2], count[2], mdims[1];
+    int *   buf;
+    hsize_t u, v;
+    herr_t  ret;
+
+    buf = (int *)HDmalloc((size_t)(nrows * ncols) * sizeof(int));
+    CHECK_PTR(buf, "HDmalloc");
+
+    fspace = H5Dget_space(dset);
+    CHECK(fspace, FAIL, "H5Dget_space");
+    start[0] = row;
+    start[1] = col;
+    count[0] = nrows;
+    count[1] = ncols;
+    ret      = H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, NULL, count, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    mdims[0] = nrows * ncols;
+    mspace   = H5Screate_simple(1, mdims, NULL);
+    CHECK(mspace, FAIL, "H5Screate_simple");
+
+    if (do_write) {
+        for (u = 0; u < nrows; u++)
+            for (v = 0; v < ncols; v++) {
+                buf[u * ncols + v]                         = value + (int)(u * ncols + v);
+                model[(row + u) * MISC36_DIM1 + (col + v)] = value + (int)(u * ncols + v);
+            } /* end for */
+        ret = H5Dwrite(dset, H5T_NATIVE_INT, mspace, fspace, H5P_DEFAULT, buf);
+        CHECK(ret, FAIL, "H5Dwrite");
+    } /* end if */
+    else {
+        ret = H5Dread(dset, H5T_NATIVE_INT, mspace, fspace, H5P_DEFAULT, buf);
+        CHECK(ret, FAIL, "H5Dread");
+        for (u = 0; u < nrows; u++)
+            for (v = 0; v < ncols; v++)
+                if (buf[u * ncols + v] != model[(row + u) * MISC36_DIM1 + (col + v)]) {
+                    TestErrPrintf("%d: value read at [%llu][%llu] = %d, expected %d\n", __LINE__,
+                                  (unsigned long long)(row + u), (unsigned long long)(col + v),
+                                  buf[u * ncols + v], model[(row + u) * MISC36_DIM1 + (col + v)]);
+                    u = nrows;
+                    break;
+                } /* end if */
+    }             /* end else */
+
+    ret = H5Sclose(mspace);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(fspace);
+    CHECK(ret, FAIL, "H5Sclose");
+    HDfree(buf);
+} /* end test_misc36_access() */
+
+/****************************************************************
+**
+**  test_misc36(): Test that interleaved and strided access to
+**      several regions of a contiguous dataset through the
+**      (multi-window) data sieve buffer is coherent.
+**
+****************************************************************/
+static void
+test_misc36(void)
+{
+    hid_t   fid, fapl, sid, dset;
+    hsize_t dims[2] = {MISC36_DIM0, MISC36_DIM1};
+    hsize_t u;
+    int *   model;
+    herr_t  ret;
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing interleaved access through the data sieve buffer\n"));
+
+    model = (int *)HDcalloc(MISC36_DIM0 * MISC36_DIM1, sizeof(int));
+    CHECK_PTR(model, "HDcalloc");
+
+    /* Use a sieve buffer of only a couple of rows */
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl, FAIL, "H5Pcreate");
+    ret = H5Pset_sieve_buf_size(fapl, (size_t)MISC36_SIEVE_SIZE);
+    CHECK(ret, FAIL, "H5Pset_sieve_buf_size");
+
+    fid = H5Fcreate(MISC36_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+    sid = H5Screate_simple(2, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    dset = H5Dcreate2(fid, MISC36_DSETNAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dset, FAIL, "H5Dcreate2");
+    test_misc36_access(dset, model, TRUE, 0, 0, MISC36_DIM0, MISC36_DIM1, 0);
+
+    /* Interleave single element writes to three regions of the dataset */
+    for (u = 0; u < MISC36_DIM0 / 4; u++) {
+        test_misc36_access(dset, model, TRUE, u, 3, 1, 1, 1000 + (int)u);
+        test_misc36_access(dset, model, TRUE, u + MISC36_DIM0 / 2, 7, 1, 1, 2000 + (int)u);
+        test_misc36_access(dset, model, TRUE, MISC36_DIM0 - 1 - u, 11, 1, 2, 3000 + (int)u);
+    } /* end for */
+
+    /* Interleave reads and writes of the same regions */
+    for (u = 0; u < MISC36_DIM0 / 4; u++) {
+        test_misc36_access(dset, model, FALSE, u, 0, 1, 8, 0);
+        test_misc36_access(dset, model, TRUE, u + MISC36_DIM0 / 2, 100, 1, 3, 4000 + (int)u);
+        test_misc36_access(dset, model, FALSE, MISC36_DIM0 - 1 - u, 8, 1, 8, 0);
+    } /* end for */
+
+    /* Write blocks that straddle the regions, both smaller and larger than the sieve buffer */
+    test_misc36_access(dset, model, TRUE, 10, 150, 1, 100, 5000);
+    test_misc36_access(dset, model, TRUE, 12, 0, 30, MISC36_DIM1, 6000);
+
+    /* Strided column reads across the whole dataset */
+    test_misc36_access(dset, model, FALSE, 0, 3, MISC36_DIM0, 1, 0);
+    test_misc36_access(dset, model, FALSE, 0, 7, MISC36_DIM0, 2, 0);
+    test_misc36_access(dset, model, FALSE, 0, 100, MISC36_DIM0, 3, 0);
+
+    /* Strided column writes, then read the dataset back in one piece */
+    for (u = 0; u < 8; u++)
+        test_misc36_access(dset, model, TRUE, 0, u * 31, MISC36_DIM0, 1, 7000 + (int)u * 100);
+    test_misc36_access(dset, model, FALSE, 0, 0, MISC36_DIM0, MISC36_DIM1, 0);
+
+    ret = H5Dclose(dset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Verify the data made it to the file */
+    fid = H5Fopen(MISC36_FILE, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fopen");
+    dset = H5Dopen2(fid, MISC36_DSETNAME, H5P_DEFAULT);
+    CHECK(dset, FAIL, "H5Dopen2");
+    test_misc36_access(dset, model, FALSE, 0, 0, MISC36_DIM0, MISC36_DIM1, 0);
+    ret = H5Dclose(dset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    ret = H5Pclose(fapl);
+    CHECK(ret, FAIL, "H5Pclose");
+    HDfree(model);
+} /* end test_misc36() */
+
 /****************************************************************
 **
 **  test_misc(): Main misc. test routine.
@@ -5803,6 +5959,7 @@ test_misc(void)
     test_misc33();  /* Test to verify that H5HL_offset_into() returns error if offset exceeds heap block */
     test_misc34();  /* Test behavior of 0 and NULL in H5MM API calls */
     test_misc35();  /* Test behavior of free-list & allocation statistics API calls */
+    test_misc36();  /* Test interleaved access through the data sieve buffer */
 
 } /* test_misc() */
 
@@ -5858,4 +6015,5 @@ cleanup_misc(void)
 #ifndef H5_NO_DEPRECATED_SYMBOLS
     HDremove(MISC31_FILE);
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
+    HDremove(MISC36_FILE);
 } /* end cleanup_misc() */
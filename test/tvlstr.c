@@ -24,6 +24,7 @@
 #define DATAFILE  "tvlstr.h5"
 #define DATAFILE2 "tvlstr2.h5"
 #define DATAFILE3 "sel2el.h5"
+#define DATAFILE4 "tvlstr_batch.h5"
 
 #define DATASET "1Darray"
 
@@ -37,6 +38,19 @@
 /* Definitions for the VL re-writing test */
 #define REWRITE_NDATASETS 32
 
+/* Definitions for the batched VL string reading test */
+#define BATCH_NSTRINGS   3000
+#define BATCH_BIG_SIZE   (1536 * 1024)
+#define BATCH_ARENA_SIZE (4 * 1024 * 1024)
+
+/* Arena for the batched VL string reading test */
+typedef struct {
+    unsigned char *buf;   /* Arena memory */
+    size_t         size;  /* Size of arena */
+    size_t         used;  /* Bytes handed out from the arena */
+    unsigned       nfree; /* Number of calls to the free routine */
+} vlstr_arena_t;
+
 /* String for testing attributes */
 static const char *string_att       = "This is the string for the attribute";
 static char *      string_att_write = NULL;
@@ -101,6 +115,45 @@ test_vlstr_free_custom(void *_mem, void *info)
     } /* end if */
 }
 
+/****************************************************************
+**
+**  test_vlstr_alloc_arena(): Test VL datatype custom memory
+**      allocation routines.  This routine hands out memory from
+**      a single arena, which is released all at once.
+**
+****************************************************************/
+static void *
+test_vlstr_alloc_arena(size_t size, void *info)
+{
+    vlstr_arena_t *arena = (vlstr_arena_t *)info;
+    size_t         align = MAX(sizeof(void *), sizeof(size_t));
+    void *         ret_value;
+
+    size = ((size + align - 1) / align) * align;
+    if (arena->used + size > arena->size)
+        return NULL;
+    ret_value = arena->buf + arena->used;
+    arena->used += size;
+
+    return ret_value;
+}
+
+/****************************************************************
+**
+**  test_vlstr_free_arena(): Test VL datatype custom memory
+**      allocation routines.  Memory from the arena isn't released
+**      individually, so this routine just counts the calls.
+**
+****************************************************************/
+static void
+test_vlstr_free_arena(void *mem, void *info)
+{
+    vlstr_arena_t *arena = (vlstr_arena_t *)info;
+
+    if (mem != NULL)
+        arena->nfree++;
+}
+
 /****************************************************************
 **
 **  test_vlstrings_basic(): Test basic VL string code.
@@ -962,6 +1015,164 @@ test_write_same_element(void)
     CHECK(ret, FAIL, "H5Fclose");
 } /* test_write_same_element */
 
+/****************************************************************
+**
+**  test_vlstrings_batch(): Test reading many VL strings, spread
+**      across several global heap collections and including nil,
+**      empty and very large strings, which the library reads from
+**      the file in batches.  Also reads the strings into a
+**      caller-provided arena.
+**
+****************************************************************/
+static void
+test_vlstrings_batch(void)
+{
+    char **       wdata = NULL;            /* Information to write */
+    char **       rdata = NULL;            /* Information read in */
+    char *        big   = NULL;            /* Very large string */
+    vlstr_arena_t arena = {NULL, 0, 0, 0}; /* Arena for reading strings */
+    hid_t         fid;                     /* HDF5 File ID */
+    hid_t         dataset;                 /* Dataset ID */
+    hid_t         sid;                     /* Dataspace ID */
+    hid_t         mem_sid;                 /* Memory dataspace ID */
+    hid_t         tid;                     /* Datatype ID */
+    hid_t         xfer_pid;                /* Dataset transfer property list ID */
+    hsize_t       dims[] = {BATCH_NSTRINGS};
+    hsize_t       start, stride, count;    /* Hyperslab parameters */
+    size_t        len;                     /* String length */
+    unsigned      i, j;                    /* Local index variables */
+    herr_t        ret;                     /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Batched Reads of VL Strings\n"));
+
+    /* Set up the strings, with nil, empty and one very large string mixed in */
+    wdata = (char **)HDcalloc(BATCH_NSTRINGS, sizeof(char *));
+    CHECK_PTR(wdata, "HDcalloc");
+    rdata = (char **)HDcalloc(BATCH_NSTRINGS, sizeof(char *));
+    CHECK_PTR(rdata, "HDcalloc");
+    for (i = 0; i < BATCH_NSTRINGS; i++) {
+        if (i % 7 == 3)
+            continue;
+        len      = (i % 11 == 5) ? 0 : (i * 37) % 300 + 1;
+        wdata[i] = (char *)HDmalloc(len + 1);
+        CHECK_PTR(wdata[i], "HDmalloc");
+        for (j = 0; j < len; j++)
+            wdata[i][j] = (char)('a' + (i + j) % 26);
+        wdata[i][len] = '\0';
+    } /* end for */
+    big = (char *)HDmalloc(BATCH_BIG_SIZE + 1);
+    CHECK_PTR(big, "HDmalloc");
+    HDmemset(big, 'Z', BATCH_BIG_SIZE);
+    big[BATCH_BIG_SIZE] = '\0';
+    HDfree(wdata[BATCH_NSTRINGS / 2]);
+    wdata[BATCH_NSTRINGS / 2] = big;
+
+    /* Create file */
+    fid = H5Fcreate(DATAFILE4, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    sid = H5Screate_simple(1, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+
+    tid = H5Tcopy(H5T_C_S1);
+    CHECK(tid, FAIL, "H5Tcopy");
+    ret = H5Tset_size(tid, H5T_VARIABLE);
+    CHECK(ret, FAIL, "H5Tset_size");
+
+    dataset = H5Dcreate2(fid, "Dataset", tid, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dcreate2");
+
+    ret = H5Dwrite(dataset, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Re-open the file, so the strings are read from the file */
+    fid = H5Fopen(DATAFILE4, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fopen");
+
+    dataset = H5Dopen2(fid, "Dataset", H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dopen2");
+
+    /* Read all the strings with the default memory routines */
+    ret = H5Dread(dataset, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata);
+    CHECK(ret, FAIL, "H5Dread");
+
+    for (i = 0; i < BATCH_NSTRINGS; i++) {
+        if (wdata[i] == NULL) {
+            if (rdata[i] != NULL)
+                TestErrPrintf("VL string %u should be nil\n", i);
+        } /* end if */
+        else if (rdata[i] == NULL || HDstrcmp(wdata[i], rdata[i]) != 0)
+            TestErrPrintf("VL data values don't match!, element %u\n", i);
+    } /* end for */
+
+    ret = H5Treclaim(tid, sid, H5P_DEFAULT, rdata);
+    CHECK(ret, FAIL, "H5Treclaim");
+
+    /* Read every third string into the arena */
+    arena.size = BATCH_ARENA_SIZE;
+    arena.buf  = (unsigned char *)HDmalloc(arena.size);
+    CHECK_PTR(arena.buf, "HDmalloc");
+
+    xfer_pid = H5Pcreate(H5P_DATASET_XFER);
+    CHECK(xfer_pid, FAIL, "H5Pcreate");
+    ret = H5Pset_vlen_mem_manager(xfer_pid, test_vlstr_alloc_arena, &arena, test_vlstr_free_arena, &arena);
+    CHECK(ret, FAIL, "H5Pset_vlen_mem_manager");
+
+    start  = 1;
+    stride = 3;
+    count  = BATCH_NSTRINGS / 3;
+    ret    = H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, &stride, &count, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    mem_sid = H5Screate_simple(1, &count, NULL);
+    CHECK(mem_sid, FAIL, "H5Screate_simple");
+
+    HDmemset(rdata, 0, BATCH_NSTRINGS * sizeof(char *));
+    ret = H5Dread(dataset, tid, mem_sid, sid, xfer_pid, rdata);
+    CHECK(ret, FAIL, "H5Dread");
+
+    for (i = 0; i < count; i++) {
+        char *expect = wdata[start + i * stride];
+
+        if (expect == NULL) {
+            if (rdata[i] != NULL)
+                TestErrPrintf("VL string %u should be nil\n", i);
+        } /* end if */
+        else if (rdata[i] == NULL || HDstrcmp(expect, rdata[i]) != 0)
+            TestErrPrintf("VL data values don't match!, element %u\n", i);
+        else if ((unsigned char *)rdata[i] < arena.buf || (unsigned char *)rdata[i] >= arena.buf + arena.used)
+            TestErrPrintf("VL string %u not allocated from the arena\n", i);
+    } /* end for */
+
+    /* Release the strings all at once, by dropping the arena */
+    VERIFY(arena.nfree, 0, "H5Dread");
+    HDfree(arena.buf);
+
+    ret = H5Pclose(xfer_pid);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Sclose(mem_sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Tclose(tid);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    for (i = 0; i < BATCH_NSTRINGS; i++)
+        HDfree(wdata[i]);
+    HDfree(wdata);
+    HDfree(rdata);
+} /* end test_vlstrings_batch() */
+
 /****************************************************************
 **
 **  test_vlstrings(): Main VL string testing routine.
@@ -988,6 +1199,8 @@ test_vlstrings(void)
     test_vl_rewrite();
     /* Test writing to the same element more than once using H5Sselect_elements */
     test_write_same_element();
+    /* Test reading many VL strings, which are read in batches */
+    test_vlstrings_batch();
 } /* test_vlstrings() */
 
 /*-------------------------------------------------------------------------
@@ -1010,4 +1223,5 @@ cleanup_vlstrings(void)
     HDremove(DATAFILE);
     HDremove(DATAFILE2);
     HDremove(DATAFILE3);
+    HDremove(DATAFILE4);
 }
@@ -41,6 +41,11 @@
 #define SPACE4_DIM_SMALL 128
 #define SPACE4_DIM_LARGE (H5D_TEMP_BUF_SIZE / 64)
 
+/* 1-D dataspace and chunk size used in test_vltypes_packed() */
+#define PACKED_DIM1  50
+#define PACKED_DIM2  80
+#define PACKED_CHUNK 8
+
 void *test_vltypes_alloc_custom(size_t size, void *info);
 void  test_vltypes_free_custom(void *mem, void *info);
 
@@ -3195,6 +3200,272 @@ test_vltypes_fill_value(void)
     HDfree(rbuf);
 } /* end test_vltypes_fill_value() */
 
+/****************************************************************
+**
+**  test_vltypes_packed(): Test datasets that store their VL
+**      strings and sequences packed inside the chunks.
+**
+****************************************************************/
+static void
+test_vltypes_packed(void)
+{
+    char         wstr_buf[PACKED_DIM1][32]; /* Storage for strings to write */
+    char *       wstr[PACKED_DIM1];         /* Strings to write */
+    char *       rstr[PACKED_DIM2];         /* Strings read in */
+    hvl_t        wseq[PACKED_DIM1];         /* Sequences to write */
+    hvl_t        rseq[PACKED_DIM1];         /* Sequences read in */
+    hid_t        fid;                       /* HDF5 File ID */
+    hid_t        str_did, seq_did;          /* Dataset IDs */
+    hid_t        copy_did;                  /* Dataset ID of copied dataset */
+    hid_t        sid;                       /* Dataspace ID */
+    hid_t        str_tid, seq_tid, ll_tid;  /* Datatype IDs */
+    hid_t        dcpl;                      /* Dataset creation property list ID */
+    hid_t        xfer;                      /* Dataset transfer property list ID */
+    hid_t        ret_id;                    /* Generic hid_t return value */
+    hsize_t      dims[1]    = {PACKED_DIM1};
+    hsize_t      maxdims[1] = {H5S_UNLIMITED};
+    hsize_t      chunk[1]   = {PACKED_CHUNK};
+    hsize_t      start[1], count[1];
+    H5Z_filter_t filter;       /* Filter ID */
+    unsigned     flags;        /* Filter flags */
+    size_t       cd_nelmts;    /* Number of filter parameters */
+    unsigned     cd_values[1]; /* Filter parameters */
+    size_t       mem_used = 0; /* Memory used during allocation */
+    size_t       expected;     /* Memory expected to be used */
+    unsigned     i, j;         /* Local index variables */
+    herr_t       ret;          /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Packed VL Datasets\n"));
+
+    /* Set up the data to write: nil, empty and a variety of lengths */
+    for (i = 0; i < PACKED_DIM1; i++) {
+        if (i % 7 == 3)
+            wstr[i] = NULL;
+        else {
+            wstr[i] = wstr_buf[i];
+            if (i % 7 == 5)
+                wstr[i][0] = '\0';
+            else
+                HDsnprintf(wstr[i], sizeof(wstr_buf[i]), "string %u%.*s", i, (int)(i % 9), "xxxxxxxxx");
+        } /* end else */
+
+        wseq[i].len = i % 5;
+        wseq[i].p   = wseq[i].len ? HDmalloc(wseq[i].len * sizeof(int)) : NULL;
+        for (j = 0; j < wseq[i].len; j++)
+            ((int *)wseq[i].p)[j] = (int)(i * 100 + j) - 1000;
+    } /* end for */
+
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    sid = H5Screate_simple(1, dims, maxdims);
+    CHECK(sid, FAIL, "H5Screate_simple");
+
+    str_tid = H5Tcopy(H5T_C_S1);
+    CHECK(str_tid, FAIL, "H5Tcopy");
+    ret = H5Tset_size(str_tid, H5T_VARIABLE);
+    CHECK(ret, FAIL, "H5Tset_size");
+
+    seq_tid = H5Tvlen_create(H5T_NATIVE_INT);
+    CHECK(seq_tid, FAIL, "H5Tvlen_create");
+
+    /* Packing has to be the first filter */
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_chunk(dcpl, 1, chunk);
+    CHECK(ret, FAIL, "H5Pset_chunk");
+    ret = H5Pset_shuffle(dcpl);
+    CHECK(ret, FAIL, "H5Pset_shuffle");
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_vlpack(dcpl);
+    }
+    H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Pset_vlpack");
+    ret = H5Premove_filter(dcpl, H5Z_FILTER_ALL);
+    CHECK(ret, FAIL, "H5Premove_filter");
+    ret = H5Pset_vlpack(dcpl);
+    CHECK(ret, FAIL, "H5Pset_vlpack");
+    if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0) {
+        ret = H5Pset_deflate(dcpl, 6);
+        CHECK(ret, FAIL, "H5Pset_deflate");
+    } /* end if */
+
+    /* Packing only applies to variable-length data */
+    H5E_BEGIN_TRY
+    {
+        ret_id = H5Dcreate2(fid, "Packed int", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    VERIFY(ret_id, FAIL, "H5Dcreate2");
+
+    str_did = H5Dcreate2(fid, "Packed strings", str_tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(str_did, FAIL, "H5Dcreate2");
+    seq_did = H5Dcreate2(fid, "Packed sequences", seq_tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(seq_did, FAIL, "H5Dcreate2");
+
+    ret = H5Dwrite(str_did, str_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, wstr);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Dwrite(seq_did, seq_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, wseq);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    /* Overwrite part of the strings, across a chunk boundary */
+    for (i = 10; i < 20; i++)
+        HDsnprintf(wstr_buf[i], sizeof(wstr_buf[i]), "replaced %u", i);
+    wstr[14] = NULL;
+    wstr[17] = wstr_buf[17];
+    start[0] = 10;
+    count[0] = 10;
+    ret      = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    {
+        hid_t msid = H5Screate_simple(1, count, NULL); /* Memory dataspace */
+
+        CHECK(msid, FAIL, "H5Screate_simple");
+        ret = H5Dwrite(str_did, str_tid, msid, sid, H5P_DEFAULT, &wstr[10]);
+        CHECK(ret, FAIL, "H5Dwrite");
+        ret = H5Sclose(msid);
+        CHECK(ret, FAIL, "H5Sclose");
+    }
+    ret = H5Sselect_all(sid);
+    CHECK(ret, FAIL, "H5Sselect_all");
+
+    /* Make a copy of the sequences */
+    ret = H5Ocopy(fid, "Packed sequences", fid, "Packed copy", H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(ret, FAIL, "H5Ocopy");
+
+    ret = H5Dclose(str_did);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Dclose(seq_did);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    fid = H5Fopen(FILENAME, H5F_ACC_RDWR, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fopen");
+    str_did = H5Dopen2(fid, "Packed strings", H5P_DEFAULT);
+    CHECK(str_did, FAIL, "H5Dopen2");
+
+    /* The packing filter is recorded in the dataset's pipeline */
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    dcpl = H5Dget_create_plist(str_did);
+    CHECK(dcpl, FAIL, "H5Dget_create_plist");
+    cd_nelmts = 1;
+    filter    = H5Pget_filter2(dcpl, 0, &flags, &cd_nelmts, cd_values, 0, NULL, NULL);
+    VERIFY(filter, H5Z_FILTER_VLPACK, "H5Pget_filter2");
+    VERIFY(cd_nelmts, 1, "H5Pget_filter2");
+    VERIFY(cd_values[0], 1, "H5Pget_filter2");
+
+    /* Read the strings back, with the custom allocator */
+    xfer = H5Pcreate(H5P_DATASET_XFER);
+    CHECK(xfer, FAIL, "H5Pcreate");
+    ret = H5Pset_vlen_mem_manager(xfer, test_vltypes_alloc_custom, &mem_used, test_vltypes_free_custom,
+                                  &mem_used);
+    CHECK(ret, FAIL, "H5Pset_vlen_mem_manager");
+
+    ret = H5Dread(str_did, str_tid, H5S_ALL, H5S_ALL, xfer, rstr);
+    CHECK(ret, FAIL, "H5Dread");
+    for (i = 0, expected = 0; i < PACKED_DIM1; i++) {
+        if (NULL == wstr[i] || NULL == rstr[i]) {
+            if (wstr[i] != rstr[i])
+                TestErrPrintf("%d: string %u nil mismatch\n", __LINE__, i);
+        } /* end if */
+        else {
+            if (HDstrcmp(wstr[i], rstr[i]) != 0)
+                TestErrPrintf("%d: string %u is '%s', should be '%s'\n", __LINE__, i, rstr[i], wstr[i]);
+            expected += HDstrlen(wstr[i]) + 1;
+        } /* end else */
+    }     /* end for */
+    VERIFY(mem_used, expected, "H5Dread");
+    ret = H5Treclaim(str_tid, sid, xfer, rstr);
+    CHECK(ret, FAIL, "H5Treclaim");
+    VERIFY(mem_used, 0, "H5Treclaim");
+
+    /* Shrink the dataset into the middle of a chunk, then grow it again */
+    dims[0] = PACKED_DIM1 - 5;
+    ret     = H5Dset_extent(str_did, dims);
+    CHECK(ret, FAIL, "H5Dset_extent");
+    dims[0] = PACKED_DIM2;
+    ret     = H5Dset_extent(str_did, dims);
+    CHECK(ret, FAIL, "H5Dset_extent");
+
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    sid = H5Dget_space(str_did);
+    CHECK(sid, FAIL, "H5Dget_space");
+    ret = H5Dread(str_did, str_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, rstr);
+    CHECK(ret, FAIL, "H5Dread");
+    for (i = 0; i < PACKED_DIM2; i++) {
+        const char *expect = (i < PACKED_DIM1 - 5) ? wstr[i] : NULL; /* Expected string */
+
+        if (NULL == expect || NULL == rstr[i]) {
+            if (expect != rstr[i])
+                TestErrPrintf("%d: string %u nil mismatch\n", __LINE__, i);
+        } /* end if */
+        else if (HDstrcmp(expect, rstr[i]) != 0)
+            TestErrPrintf("%d: string %u is '%s', should be '%s'\n", __LINE__, i, rstr[i], expect);
+    } /* end for */
+    ret = H5Treclaim(str_tid, sid, H5P_DEFAULT, rstr);
+    CHECK(ret, FAIL, "H5Treclaim");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Read the sequences, and their copy, converting to a wider integer type */
+    ll_tid = H5Tvlen_create(H5T_NATIVE_LLONG);
+    CHECK(ll_tid, FAIL, "H5Tvlen_create");
+    for (j = 0; j < 2; j++) {
+        copy_did = H5Dopen2(fid, j ? "Packed copy" : "Packed sequences", H5P_DEFAULT);
+        CHECK(copy_did, FAIL, "H5Dopen2");
+        sid = H5Dget_space(copy_did);
+        CHECK(sid, FAIL, "H5Dget_space");
+
+        ret = H5Dread(copy_did, ll_tid, H5S_ALL, H5S_ALL, xfer, rseq);
+        CHECK(ret, FAIL, "H5Dread");
+        for (i = 0, expected = 0; i < PACKED_DIM1; i++) {
+            unsigned k;
+
+            if (rseq[i].len != wseq[i].len) {
+                TestErrPrintf("%d: sequence %u has length %u, should be %u\n", __LINE__, i,
+                              (unsigned)rseq[i].len, (unsigned)wseq[i].len);
+                continue;
+            } /* end if */
+            for (k = 0; k < rseq[i].len; k++)
+                if (((long long *)rseq[i].p)[k] != ((int *)wseq[i].p)[k])
+                    TestErrPrintf("%d: sequence %u element %u mismatch\n", __LINE__, i, k);
+            expected += rseq[i].len * sizeof(long long);
+        } /* end for */
+        VERIFY(mem_used, expected, "H5Dread");
+        ret = H5Treclaim(ll_tid, sid, xfer, rseq);
+        CHECK(ret, FAIL, "H5Treclaim");
+        VERIFY(mem_used, 0, "H5Treclaim");
+
+        ret = H5Sclose(sid);
+        CHECK(ret, FAIL, "H5Sclose");
+        ret = H5Dclose(copy_did);
+        CHECK(ret, FAIL, "H5Dclose");
+    } /* end for */
+
+    /* Release resources */
+    for (i = 0; i < PACKED_DIM1; i++)
+        HDfree(wseq[i].p);
+    ret = H5Pclose(xfer);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Tclose(ll_tid);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Tclose(seq_tid);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Tclose(str_tid);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Dclose(str_did);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+} /* end test_vltypes_packed() */
+
 /****************************************************************
 **
 **  test_vltypes(): Main VL datatype testing routine.
@@ -3222,6 +3493,7 @@ test_vltypes(void)
     test_vltypes_compound_vlen_vlen();          /* Test compound datatypes with VL atomic components */
     test_vltypes_compound_vlstr();              /* Test data rewritten of nested VL data */
     test_vltypes_fill_value();                  /* Test fill value for VL data */
+    test_vltypes_packed();                      /* Test VL data packed in chunks */
 } /* test_vltypes() */
 
 /*-------------------------------------------------------------------------
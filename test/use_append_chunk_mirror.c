@@ -173,6 +173,8 @@ main(int argc, char *argv[])
     mirr_fa.magic          = H5FD_MIRROR_FAPL_MAGIC;
     mirr_fa.version        = H5FD_MIRROR_CURR_FAPL_T_VERSION;
     mirr_fa.handshake_port = SERVER_PORT;
+    mirr_fa.pipeline_depth = H5FD_MIRROR_DEFAULT_PIPELINE_DEPTH;
+    mirr_fa.coalesce_size  = H5FD_MIRROR_DEFAULT_COALESCE_SIZE;
     HDstrncpy(mirr_fa.remote_ip, SERVER_IP, H5FD_MIRROR_MAX_IP_LEN);
 
     split_fa.wo_fapl_id       = H5I_INVALID_HID;
@@ -181,6 +183,7 @@ main(int argc, char *argv[])
     split_fa.version          = H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION;
     split_fa.log_file_path[0] = '\0'; /* none */
     split_fa.ignore_wo_errs   = FALSE;
+    split_fa.wo_queue_size    = 0;
     HDstrncpy(split_fa.wo_path, MIRROR_FILE_NAME, H5FD_SPLITTER_PATH_MAX);
 
     /* Determine the need to send/wait message file*/
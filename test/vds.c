@@ -31,7 +31,9 @@ typedef enum {
 
 const char *FILENAME[] = {"vds_virt_0", "vds_virt_1", "vds_src_0",  "vds_src_1", "vds%%_src",
                           "vds_dapl",   "vds_virt_2", "vds_virt_3", "vds_src_2", "vds_src_3",
-                          "vds%%_src2", "vds_dapl2",  NULL};
+                          "vds%%_src2", "vds_dapl2",  "vds_many",   "vds_sio",    "vds_sio_src0",
+                          "vds_sio_src1", "vds_sio_src2", "vds_sio_src3", "vds_pc",     "vds_pc_0",
+                          "vds_pc_1",   "vds_pc_2",   "vds_pc_3",   NULL};
 
 /* I/O test config flags */
 #define TEST_IO_CLOSE_SRC      0x01u
@@ -45,6 +47,27 @@ const char *FILENAME[] = {"vds_virt_0", "vds_virt_1", "vds_src_0",  "vds_src_1",
 
 #define TMPDIR "tmp_vds/"
 
+/* Parameters for test_source_io() */
+#define SOURCE_IO_NSRC 4
+#define SOURCE_IO_SIZE 16
+
+/* Parameters for test_printf_source_cache() */
+#define SOURCE_CACHE_NSRC 4
+#define SOURCE_CACHE_SIZE 4
+
+/* Parameters for test_many_mappings() */
+#define MANY_MAP_DIM           64
+#define MANY_MAP_BLOCK         4
+#define MANY_MAP_OVERLAP_START 8
+#define MANY_MAP_OVERLAP_END   16
+#define MANY_MAP_EXPECTED(I, J)                                                                              \
+    (((I) >= MANY_MAP_DIM - MANY_MAP_BLOCK && (J) >= MANY_MAP_DIM - MANY_MAP_BLOCK)                          \
+         ? -1                                                                                                \
+         : (((I) >= MANY_MAP_OVERLAP_START && (I) < MANY_MAP_OVERLAP_END && (J) >= MANY_MAP_OVERLAP_START && \
+             (J) < MANY_MAP_OVERLAP_END)                                                                     \
+                ? -((I)*MANY_MAP_DIM) - (J)-2                                                                \
+                : ((I)*MANY_MAP_DIM) + (J)))
+
 /*-------------------------------------------------------------------------
  * Function:    vds_select_equal
  *
@@ -12213,6 +12236,621 @@ error:
     return 1;
 } /* end test_dapl_values() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_many_mappings
+ *
+ * Purpose:     Tests I/O on a virtual dataset with enough mappings for the
+ *              library to build its spatial index over them.  Checks full
+ *              and partial reads, reads of unmapped regions, overlapping
+ *              mappings (the last one wins) and writes, before and after
+ *              reopening the file.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *-------------------------------------------------------------------------
+ */
+static int
+test_many_mappings(hid_t fapl)
+{
+    char    filename[FILENAME_BUF_SIZE];
+    hid_t   file       = -1;                           /* File */
+    hid_t   dcpl       = -1;                           /* Dataset creation property list */
+    hid_t   srcspace   = -1;                           /* Source dataspace */
+    hid_t   vspace     = -1;                           /* Virtual dataspace */
+    hid_t   memspace   = -1;                           /* Memory dataspace */
+    hid_t   srcdset[2] = {-1, -1};                     /* Source datasets */
+    hid_t   vdset      = -1;                           /* Virtual dataset */
+    hsize_t dims[2]    = {MANY_MAP_DIM, MANY_MAP_DIM}; /* Dataset dimensions */
+    hsize_t start[2];                                  /* Hyperslab start */
+    hsize_t count[2];                                  /* Hyperslab count */
+    int     buf[MANY_MAP_DIM][MANY_MAP_DIM];           /* Write/read buffer */
+    int     sbuf[5][7];                                /* Buffer for partial reads */
+    int     fill = -1;                                 /* Fill value */
+    int     reopen;                                    /* Whether the file has been reopened */
+    int     i, j;                                      /* Local index variables */
+
+    TESTING("virtual dataset I/O with many mappings");
+
+    h5_fixname(FILENAME[12], fapl, filename, sizeof(filename));
+
+    /* Create the file and the source datasets.  "src0" holds positive values,
+     * "src1" negative ones. */
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if ((srcspace = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if ((srcdset[0] = H5Dcreate2(file, "src0", H5T_NATIVE_INT, srcspace, H5P_DEFAULT, H5P_DEFAULT,
+                                 H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if ((srcdset[1] = H5Dcreate2(file, "src1", H5T_NATIVE_INT, srcspace, H5P_DEFAULT, H5P_DEFAULT,
+                                 H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for (i = 0; i < MANY_MAP_DIM; i++)
+        for (j = 0; j < MANY_MAP_DIM; j++)
+            buf[i][j] = (i * MANY_MAP_DIM) + j;
+    if (H5Dwrite(srcdset[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        TEST_ERROR
+    for (i = 0; i < MANY_MAP_DIM; i++)
+        for (j = 0; j < MANY_MAP_DIM; j++)
+            buf[i][j] = -(i * MANY_MAP_DIM) - j - 2;
+    if (H5Dwrite(srcdset[1], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        TEST_ERROR
+
+    /* Map every block of the virtual dataset except the last to the same
+     * block of "src0", then map the blocks in MANY_MAP_OVERLAP_START to
+     * MANY_MAP_OVERLAP_END (in each dimension) again to "src1" */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0)
+        TEST_ERROR
+    if ((vspace = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    count[0] = MANY_MAP_BLOCK;
+    count[1] = MANY_MAP_BLOCK;
+    for (i = 0; i < MANY_MAP_DIM / MANY_MAP_BLOCK; i++)
+        for (j = 0; j < MANY_MAP_DIM / MANY_MAP_BLOCK; j++) {
+            if ((i == (MANY_MAP_DIM / MANY_MAP_BLOCK) - 1) && (j == (MANY_MAP_DIM / MANY_MAP_BLOCK) - 1))
+                continue;
+            start[0] = (hsize_t)(i * MANY_MAP_BLOCK);
+            start[1] = (hsize_t)(j * MANY_MAP_BLOCK);
+            if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                TEST_ERROR
+            if (H5Sselect_hyperslab(srcspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                TEST_ERROR
+            if (H5Pset_virtual(dcpl, vspace, ".", "src0", srcspace) < 0)
+                TEST_ERROR
+        } /* end for */
+    start[0] = MANY_MAP_OVERLAP_START;
+    start[1] = MANY_MAP_OVERLAP_START;
+    count[0] = MANY_MAP_OVERLAP_END - MANY_MAP_OVERLAP_START;
+    count[1] = MANY_MAP_OVERLAP_END - MANY_MAP_OVERLAP_START;
+    if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    if (H5Sselect_hyperslab(srcspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    if (H5Pset_virtual(dcpl, vspace, ".", "src1", srcspace) < 0)
+        TEST_ERROR
+    if (H5Sselect_all(vspace) < 0)
+        TEST_ERROR
+
+    if ((vdset = H5Dcreate2(file, "v", H5T_NATIVE_INT, vspace, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    for (reopen = 0; reopen < 2; reopen++) {
+        if (reopen) {
+            /* Close and reopen the file so the mappings are decoded from the
+             * layout message */
+            if (H5Dclose(vdset) < 0)
+                TEST_ERROR
+            vdset = -1;
+            if (H5Dclose(srcdset[0]) < 0)
+                TEST_ERROR
+            srcdset[0] = -1;
+            if (H5Dclose(srcdset[1]) < 0)
+                TEST_ERROR
+            srcdset[1] = -1;
+            if (H5Fclose(file) < 0)
+                TEST_ERROR
+            file = -1;
+            if ((file = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+                TEST_ERROR
+            if ((vdset = H5Dopen2(file, "v", H5P_DEFAULT)) < 0)
+                TEST_ERROR
+        } /* end if */
+
+        /* Read the whole virtual dataset.  The overlapping mappings are
+         * counted twice, which hides the unmapped block from the fill value
+         * check, so preset the buffer to the fill value. */
+        for (i = 0; i < MANY_MAP_DIM; i++)
+            for (j = 0; j < MANY_MAP_DIM; j++)
+                buf[i][j] = fill;
+        if (H5Dread(vdset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            TEST_ERROR
+        for (i = 0; i < MANY_MAP_DIM; i++)
+            for (j = 0; j < MANY_MAP_DIM; j++)
+                if (buf[i][j] != MANY_MAP_EXPECTED(i, j))
+                    TEST_ERROR
+
+        /* Read small regions touching several mappings, the overlapping
+         * mappings and the unmapped block */
+        count[0] = 5;
+        count[1] = 7;
+        if ((memspace = H5Screate_simple(2, count, NULL)) < 0)
+            TEST_ERROR
+        for (i = 0; i < 3; i++) {
+            start[0] = (hsize_t)(i == 0 ? 2 : (i == 1 ? MANY_MAP_OVERLAP_START - 2 : MANY_MAP_DIM - 5));
+            start[1] = (hsize_t)(i == 0 ? 3 : (i == 1 ? MANY_MAP_OVERLAP_END - 3 : MANY_MAP_DIM - 7));
+            if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                TEST_ERROR
+            HDmemset(sbuf, 0, sizeof(sbuf));
+            if (H5Dread(vdset, H5T_NATIVE_INT, memspace, vspace, H5P_DEFAULT, sbuf) < 0)
+                TEST_ERROR
+            for (j = 0; j < 5 * 7; j++)
+                if (sbuf[j / 7][j % 7] != MANY_MAP_EXPECTED((int)start[0] + (j / 7), (int)start[1] + (j % 7)))
+                    TEST_ERROR
+        } /* end for */
+
+        /* Write a small region spanning several non-overlapping mappings and
+         * read it back */
+        start[0] = 9;
+        start[1] = (hsize_t)(MANY_MAP_OVERLAP_END + 1);
+        if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        for (j = 0; j < 5 * 7; j++)
+            sbuf[j / 7][j % 7] = MANY_MAP_EXPECTED((int)start[0] + (j / 7), (int)start[1] + (j % 7)) * 3;
+        if (H5Dwrite(vdset, H5T_NATIVE_INT, memspace, vspace, H5P_DEFAULT, sbuf) < 0)
+            TEST_ERROR
+        HDmemset(sbuf, 0, sizeof(sbuf));
+        if (H5Dread(vdset, H5T_NATIVE_INT, memspace, vspace, H5P_DEFAULT, sbuf) < 0)
+            TEST_ERROR
+        for (j = 0; j < 5 * 7; j++)
+            if (sbuf[j / 7][j % 7] != MANY_MAP_EXPECTED((int)start[0] + (j / 7), (int)start[1] + (j % 7)) * 3)
+                TEST_ERROR
+
+        /* Restore the original values */
+        for (j = 0; j < 5 * 7; j++)
+            sbuf[j / 7][j % 7] = MANY_MAP_EXPECTED((int)start[0] + (j / 7), (int)start[1] + (j % 7));
+        if (H5Dwrite(vdset, H5T_NATIVE_INT, memspace, vspace, H5P_DEFAULT, sbuf) < 0)
+            TEST_ERROR
+
+        if (H5Sclose(memspace) < 0)
+            TEST_ERROR
+        memspace = -1;
+    } /* end for */
+
+    /* Close */
+    if (H5Dclose(vdset) < 0)
+        TEST_ERROR
+    vdset = -1;
+    if (H5Fclose(file) < 0)
+        TEST_ERROR
+    file = -1;
+    if (H5Sclose(srcspace) < 0)
+        TEST_ERROR
+    srcspace = -1;
+    if (H5Sclose(vspace) < 0)
+        TEST_ERROR
+    vspace = -1;
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR
+    dcpl = -1;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(vdset);
+        H5Dclose(srcdset[0]);
+        H5Dclose(srcdset[1]);
+        H5Fclose(file);
+        H5Sclose(srcspace);
+        H5Sclose(vspace);
+        H5Sclose(memspace);
+        H5Pclose(dcpl);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_many_mappings() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_source_io
+ *
+ * Purpose:     Tests the source dataset I/O options set with
+ *              H5Pset_virtual_source_io: read-ahead hints and closing
+ *              the least recently used source datasets.  Reads and writes
+ *              a virtual dataset whose mappings each use a source dataset
+ *              in a different file, with only one source dataset allowed
+ *              to stay open.  Every other source dataset is chunked, so
+ *              hints are issued for both contiguous and chunked storage.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *-------------------------------------------------------------------------
+ */
+static int
+test_source_io(hid_t fapl)
+{
+    char     vfilename[FILENAME_BUF_SIZE];
+    char     srcfilename[SOURCE_IO_NSRC][FILENAME_BUF_SIZE];
+    hid_t    vfile    = -1;                               /* Virtual file */
+    hid_t    srcfile  = -1;                               /* Source file */
+    hid_t    dcpl     = -1;                               /* Dataset creation property list */
+    hid_t    srcdcpl  = -1;                               /* Chunked source dataset creation property list */
+    hid_t    dapl     = -1;                               /* Dataset access property list */
+    hid_t    dapl2    = -1;                               /* Dataset access property list from dataset */
+    hid_t    srcspace = -1;                               /* Source dataspace */
+    hid_t    vspace   = -1;                               /* Virtual dataspace */
+    hid_t    memspace = -1;                               /* Memory dataspace */
+    hid_t    srcdset  = -1;                               /* Source dataset */
+    hid_t    vdset    = -1;                               /* Virtual dataset */
+    hsize_t  dims     = SOURCE_IO_NSRC * SOURCE_IO_SIZE;  /* Virtual dataset dimensions */
+    hsize_t  srcdims  = SOURCE_IO_SIZE;                   /* Source dataset dimensions */
+    hsize_t  start;                                       /* Hyperslab start */
+    hsize_t  count;                                       /* Hyperslab count */
+    hsize_t  chunk    = 5;                                /* Source dataset chunk size */
+    int      buf[SOURCE_IO_NSRC * SOURCE_IO_SIZE];        /* Write/read buffer */
+    hbool_t  prefetch;                                    /* Read-ahead */
+    size_t   max_open;                                    /* Max. open source datasets */
+    int      i, j;                                        /* Local index variables */
+
+    TESTING("virtual dataset source I/O options");
+
+    h5_fixname(FILENAME[13], fapl, vfilename, sizeof(vfilename));
+    for (i = 0; i < SOURCE_IO_NSRC; i++)
+        h5_fixname(FILENAME[14 + i], fapl, srcfilename[i], sizeof(srcfilename[i]));
+
+    /* Check the defaults and setting the property */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pget_virtual_source_io(dapl, &prefetch, &max_open) < 0)
+        TEST_ERROR
+    if (prefetch != FALSE || max_open != 0)
+        TEST_ERROR
+    if (H5Pset_virtual_source_io(dapl, TRUE, 1) < 0)
+        TEST_ERROR
+    if (H5Pget_virtual_source_io(dapl, &prefetch, &max_open) < 0)
+        TEST_ERROR
+    if (prefetch != TRUE || max_open != 1)
+        TEST_ERROR
+
+    /* Create the source datasets, one per file, alternating between
+     * contiguous and chunked storage */
+    if ((srcspace = H5Screate_simple(1, &srcdims, NULL)) < 0)
+        TEST_ERROR
+    if ((srcdcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(srcdcpl, 1, &chunk) < 0)
+        TEST_ERROR
+    for (i = 0; i < SOURCE_IO_NSRC; i++) {
+        for (j = 0; j < SOURCE_IO_SIZE; j++)
+            buf[j] = (i * SOURCE_IO_SIZE) + j;
+        if ((srcfile = H5Fcreate(srcfilename[i], H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+            TEST_ERROR
+        if ((srcdset = H5Dcreate2(srcfile, "src", H5T_NATIVE_INT, srcspace, H5P_DEFAULT,
+                                  (i % 2) ? srcdcpl : H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if (H5Dwrite(srcdset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            TEST_ERROR
+        if (H5Dclose(srcdset) < 0)
+            TEST_ERROR
+        srcdset = -1;
+        if (H5Fclose(srcfile) < 0)
+            TEST_ERROR
+        srcfile = -1;
+    } /* end for */
+
+    /* Create the virtual dataset, mapping each block to its own source
+     * file */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if ((vspace = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR
+    count = SOURCE_IO_SIZE;
+    for (i = 0; i < SOURCE_IO_NSRC; i++) {
+        start = (hsize_t)(i * SOURCE_IO_SIZE);
+        if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+            TEST_ERROR
+        if (H5Pset_virtual(dcpl, vspace, srcfilename[i], "src", srcspace) < 0)
+            TEST_ERROR
+    } /* end for */
+    if (H5Sselect_all(vspace) < 0)
+        TEST_ERROR
+    if ((vfile = H5Fcreate(vfilename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if ((vdset = H5Dcreate2(vfile, "v", H5T_NATIVE_INT, vspace, H5P_DEFAULT, dcpl, dapl)) < 0)
+        TEST_ERROR
+
+    /* Check that the options are reported by the dataset */
+    if ((dapl2 = H5Dget_access_plist(vdset)) < 0)
+        TEST_ERROR
+    if (H5Pget_virtual_source_io(dapl2, &prefetch, &max_open) < 0)
+        TEST_ERROR
+    if (prefetch != TRUE || max_open != 1)
+        TEST_ERROR
+    if (H5Pclose(dapl2) < 0)
+        TEST_ERROR
+    dapl2 = -1;
+
+    /* Read everything several times, so the source datasets are closed and
+     * reopened */
+    for (i = 0; i < 3; i++) {
+        HDmemset(buf, 0, sizeof(buf));
+        if (H5Dread(vdset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            TEST_ERROR
+        for (j = 0; j < SOURCE_IO_NSRC * SOURCE_IO_SIZE; j++)
+            if (buf[j] != j)
+                TEST_ERROR
+    } /* end for */
+
+    /* Write and read back a region spanning all blocks except the first and
+     * the last, then read each block on its own in reverse order */
+    count = (SOURCE_IO_NSRC - 2) * SOURCE_IO_SIZE + 2;
+    start = SOURCE_IO_SIZE - 1;
+    if ((memspace = H5Screate_simple(1, &count, NULL)) < 0)
+        TEST_ERROR
+    if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+        TEST_ERROR
+    for (j = 0; j < (int)count; j++)
+        buf[j] = -((int)start + j);
+    if (H5Dwrite(vdset, H5T_NATIVE_INT, memspace, vspace, H5P_DEFAULT, buf) < 0)
+        TEST_ERROR
+    if (H5Sclose(memspace) < 0)
+        TEST_ERROR
+    memspace = -1;
+    count = SOURCE_IO_SIZE;
+    if ((memspace = H5Screate_simple(1, &count, NULL)) < 0)
+        TEST_ERROR
+    for (i = SOURCE_IO_NSRC - 1; i >= 0; i--) {
+        start = (hsize_t)(i * SOURCE_IO_SIZE);
+        if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+            TEST_ERROR
+        HDmemset(buf, 0, sizeof(buf));
+        if (H5Dread(vdset, H5T_NATIVE_INT, memspace, vspace, H5P_DEFAULT, buf) < 0)
+            TEST_ERROR
+        for (j = 0; j < SOURCE_IO_SIZE; j++) {
+            int idx = (i * SOURCE_IO_SIZE) + j;
+
+            if (buf[j] != ((idx >= SOURCE_IO_SIZE - 1 && idx <= (SOURCE_IO_NSRC - 1) * SOURCE_IO_SIZE)
+                               ? -idx
+                               : idx))
+                TEST_ERROR
+        } /* end for */
+    }     /* end for */
+
+    /* Close */
+    if (H5Sclose(memspace) < 0)
+        TEST_ERROR
+    memspace = -1;
+    if (H5Dclose(vdset) < 0)
+        TEST_ERROR
+    vdset = -1;
+    if (H5Fclose(vfile) < 0)
+        TEST_ERROR
+    vfile = -1;
+    if (H5Sclose(srcspace) < 0)
+        TEST_ERROR
+    srcspace = -1;
+    if (H5Sclose(vspace) < 0)
+        TEST_ERROR
+    vspace = -1;
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR
+    dcpl = -1;
+    if (H5Pclose(srcdcpl) < 0)
+        TEST_ERROR
+    srcdcpl = -1;
+    if (H5Pclose(dapl) < 0)
+        TEST_ERROR
+    dapl = -1;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(vdset);
+        H5Dclose(srcdset);
+        H5Fclose(vfile);
+        H5Fclose(srcfile);
+        H5Sclose(srcspace);
+        H5Sclose(vspace);
+        H5Sclose(memspace);
+        H5Pclose(dcpl);
+        H5Pclose(srcdcpl);
+        H5Pclose(dapl);
+        H5Pclose(dapl2);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_source_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_printf_source_cache
+ *
+ * Purpose:     Tests that a virtual dataset with a "printf" source file
+ *              mapping picks up source files created after it found them
+ *              missing, including files filling a gap, while its extent
+ *              is evaluated and the dataset refreshed repeatedly.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *-------------------------------------------------------------------------
+ */
+static int
+test_printf_source_cache(hid_t fapl)
+{
+    char        vfilename[FILENAME_BUF_SIZE];
+    char        srcfilename[SOURCE_CACHE_NSRC][FILENAME_BUF_SIZE];
+    char        srcfilename_map[FILENAME_BUF_SIZE];
+    const int   order[SOURCE_CACHE_NSRC]   = {0, 2, 1, 3};   /* Order in which source files are created */
+    const int   extent[SOURCE_CACHE_NSRC]  = {4, 12, 12, 16}; /* Extent after each source file is created */
+    hbool_t     created[SOURCE_CACHE_NSRC] = {FALSE, FALSE, FALSE, FALSE}; /* Source files created so far */
+    hid_t       vfile    = -1;                                 /* Virtual file */
+    hid_t       srcfile  = -1;                                 /* Source file */
+    hid_t       dcpl     = -1;                                 /* Dataset creation property list */
+    hid_t       dapl     = -1;                                 /* Dataset access property list */
+    hid_t       srcspace = -1;                                 /* Source dataspace */
+    hid_t       vspace   = -1;                                 /* Virtual dataspace */
+    hid_t       memspace = -1;                                 /* Memory dataspace */
+    hid_t       filespace = -1;                                /* Dataspace of the virtual dataset */
+    hid_t       srcdset  = -1;                                 /* Source dataset */
+    hid_t       vdset    = -1;                                 /* Virtual dataset */
+    hsize_t     dims     = 0;                                  /* Virtual dataset dimensions */
+    hsize_t     mdims    = H5S_UNLIMITED;                      /* Virtual dataset max. dimensions */
+    hsize_t     srcdims  = SOURCE_CACHE_SIZE;                  /* Source dataset dimensions */
+    hsize_t     start    = 0;                                  /* Hyperslab start */
+    hsize_t     stride   = SOURCE_CACHE_SIZE;                  /* Hyperslab stride */
+    hsize_t     count    = H5S_UNLIMITED;                      /* Hyperslab count */
+    hsize_t     block    = SOURCE_CACHE_SIZE;                  /* Hyperslab block */
+    int         buf[SOURCE_CACHE_NSRC * SOURCE_CACHE_SIZE];    /* Write/read buffer */
+    int         fill = -1;                                     /* Fill value */
+    int         i, j, k;                                       /* Local index variables */
+
+    TESTING("virtual dataset printf source files created over time");
+
+    h5_fixname(FILENAME[18], fapl, vfilename, sizeof(vfilename));
+    for (i = 0; i < SOURCE_CACHE_NSRC; i++)
+        h5_fixname(FILENAME[19 + i], fapl, srcfilename[i], sizeof(srcfilename[i]));
+    h5_fixname_printf("vds_pc_%b", fapl, srcfilename_map, sizeof(srcfilename_map));
+
+    /* Make sure no source files are left from an earlier run */
+    H5E_BEGIN_TRY
+    {
+        for (i = 0; i < SOURCE_CACHE_NSRC; i++)
+            H5Fdelete(srcfilename[i], fapl);
+    }
+    H5E_END_TRY;
+
+    /* Create the virtual dataset, with one mapping of unlimited blocks to
+     * source files "vds_pc_<block>" */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0)
+        TEST_ERROR
+    if ((vspace = H5Screate_simple(1, &dims, &mdims)) < 0)
+        TEST_ERROR
+    if ((srcspace = H5Screate_simple(1, &srcdims, NULL)) < 0)
+        TEST_ERROR
+    if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, &start, &stride, &count, &block) < 0)
+        TEST_ERROR
+    if (H5Pset_virtual(dcpl, vspace, srcfilename_map, "src", srcspace) < 0)
+        TEST_ERROR
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_virtual_view(dapl, H5D_VDS_LAST_AVAILABLE) < 0)
+        TEST_ERROR
+    if (H5Pset_virtual_printf_gap(dapl, (hsize_t)1) < 0)
+        TEST_ERROR
+    if ((vfile = H5Fcreate(vfilename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    if ((vdset = H5Dcreate2(vfile, "v", H5T_NATIVE_INT, vspace, H5P_DEFAULT, dcpl, dapl)) < 0)
+        TEST_ERROR
+
+    /* No source files yet */
+    if ((filespace = H5Dget_space(vdset)) < 0)
+        TEST_ERROR
+    if (H5Sget_simple_extent_dims(filespace, &dims, NULL) < 0)
+        TEST_ERROR
+    if (dims != 0)
+        TEST_ERROR
+    if (H5Sclose(filespace) < 0)
+        TEST_ERROR
+    filespace = -1;
+
+    /* Create the source files one at a time, out of order */
+    for (i = 0; i < SOURCE_CACHE_NSRC; i++) {
+        for (j = 0; j < SOURCE_CACHE_SIZE; j++)
+            buf[j] = (order[i] * SOURCE_CACHE_SIZE) + j;
+        if ((srcfile = H5Fcreate(srcfilename[order[i]], H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+            TEST_ERROR
+        if ((srcdset = H5Dcreate2(srcfile, "src", H5T_NATIVE_INT, srcspace, H5P_DEFAULT, H5P_DEFAULT,
+                                  H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if (H5Dwrite(srcdset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            TEST_ERROR
+        if (H5Dclose(srcdset) < 0)
+            TEST_ERROR
+        srcdset = -1;
+        if (H5Fclose(srcfile) < 0)
+            TEST_ERROR
+        srcfile = -1;
+        created[order[i]] = TRUE;
+
+        /* Evaluate the extent and refresh a few times, as a live reader
+         * would, then read everything */
+        for (k = 0; k < 3; k++) {
+            if (H5Drefresh(vdset) < 0)
+                TEST_ERROR
+            if ((filespace = H5Dget_space(vdset)) < 0)
+                TEST_ERROR
+            if (H5Sget_simple_extent_dims(filespace, &dims, NULL) < 0)
+                TEST_ERROR
+            if (dims != (hsize_t)extent[i])
+                TEST_ERROR
+        } /* end for */
+        if ((memspace = H5Screate_simple(1, &dims, NULL)) < 0)
+            TEST_ERROR
+        HDmemset(buf, 0, sizeof(buf));
+        if (H5Dread(vdset, H5T_NATIVE_INT, memspace, filespace, H5P_DEFAULT, buf) < 0)
+            TEST_ERROR
+        for (j = 0; j < (int)dims; j++)
+            if (buf[j] != (created[j / SOURCE_CACHE_SIZE] ? j : fill))
+                TEST_ERROR
+        if (H5Sclose(memspace) < 0)
+            TEST_ERROR
+        memspace = -1;
+        if (H5Sclose(filespace) < 0)
+            TEST_ERROR
+        filespace = -1;
+    } /* end for */
+
+    /* Close */
+    if (H5Dclose(vdset) < 0)
+        TEST_ERROR
+    vdset = -1;
+    if (H5Fclose(vfile) < 0)
+        TEST_ERROR
+    vfile = -1;
+    if (H5Sclose(srcspace) < 0)
+        TEST_ERROR
+    srcspace = -1;
+    if (H5Sclose(vspace) < 0)
+        TEST_ERROR
+    vspace = -1;
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR
+    dcpl = -1;
+    if (H5Pclose(dapl) < 0)
+        TEST_ERROR
+    dapl = -1;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(vdset);
+        H5Dclose(srcdset);
+        H5Fclose(vfile);
+        H5Fclose(srcfile);
+        H5Sclose(srcspace);
+        H5Sclose(vspace);
+        H5Sclose(memspace);
+        H5Sclose(filespace);
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_printf_source_cache() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -12288,6 +12926,9 @@ main(void)
             }
 
             nerrors += test_dapl_values(my_fapl);
+            nerrors += test_many_mappings(my_fapl);
+            nerrors += test_source_io(my_fapl);
+            nerrors += test_printf_source_cache(my_fapl);
 
             /* Verify symbol table messages are cached */
             nerrors += (h5_verify_cached_stabs(FILENAME, my_fapl) < 0 ? 1 : 0);
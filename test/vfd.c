@@ -19,11 +19,15 @@
  */
 
 #include "h5test.h"
+#include "H5Fprivate.h"
 
 #define KB            1024U
 #define FAMILY_NUMBER 4
 #define FAMILY_SIZE   (1 * KB)
 #define FAMILY_SIZE2  (5 * KB)
+
+#define FAMILY_IO_MEMB_SIZE (256 * KB)
+#define FAMILY_IO_NELMTS    (1024 * 1024)
 #define MULTI_SIZE    128
 #define SPLITTER_SIZE 8 /* dimensions of a dataset */
 
@@ -62,9 +66,13 @@ const char *FILENAME[] = {"sec2_file",          /*0*/
                           "splitter_rw_file",   /*11*/
                           "splitter_wo_file",   /*12*/
                           "splitter.log",       /*13*/
+                          "mmap_file",          /*14*/
+                          "iouring_file",       /*15*/
+                          "family_io_file",     /*16*/
                           NULL};
 
-#define LOG_FILENAME "log_vfd_out.log"
+#define LOG_FILENAME        "log_vfd_out.log"
+#define LOG_BINARY_FILENAME "log_vfd_out.bin"
 
 #define COMPAT_BASENAME       "family_v16_"
 #define MULTI_COMPAT_BASENAME "multi_file_v16"
@@ -99,7 +107,7 @@ static int splitter_create_single_file_at(const char *filename, hid_t fapl_id,
                                           const struct splitter_dataset_def *data);
 static int splitter_compare_expected_data(hid_t file_id, const struct splitter_dataset_def *data);
 static int run_splitter_test(const struct splitter_dataset_def *data, hbool_t ignore_wo_errors,
-                             hbool_t provide_logfile_path, hid_t sub_fapl_ids[2]);
+                             hbool_t provide_logfile_path, hid_t sub_fapl_ids[2], size_t wo_queue_size);
 static int splitter_RO_test(const struct splitter_dataset_def *data, hid_t child_fapl_id);
 static int splitter_tentative_open_test(hid_t child_fapl_id);
 static int file_exists(const char *filename, hid_t fapl_id);
@@ -1310,6 +1318,223 @@ error:
     return FAIL;
 } /* end test_family_member_fapl() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_family_io
+ *
+ * Purpose:     Tests the family driver with parallel member I/O and with
+ *              members opened on demand (H5Pset_fapl_family_io).
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_family_io(void)
+{
+    hid_t    file     = H5I_INVALID_HID;
+    hid_t    fapl     = H5I_INVALID_HID;
+    hid_t    def_fapl = H5I_INVALID_HID;
+    hid_t    dcpl     = H5I_INVALID_HID;
+    hid_t    space    = H5I_INVALID_HID;
+    hid_t    mspace   = H5I_INVALID_HID;
+    hid_t    dset     = H5I_INVALID_HID;
+    char     filename[1024];
+    int *    wbuf  = NULL;
+    int *    rbuf  = NULL;
+    hsize_t  dims  = FAMILY_IO_NELMTS;
+    hsize_t  start = FAMILY_IO_NELMTS / 8;
+    hsize_t  count = FAMILY_IO_NELMTS / 2;
+    hsize_t  size1 = 0, size2 = 0;
+    unsigned max_threads, max_open;
+    unsigned i, j;
+    herr_t   ret;
+
+    /* Threads and open-member limits to test: parallel, parallel with
+     * members opened on demand, and members opened on demand with
+     * evictions (which makes I/O sequential) */
+    const unsigned configs[4][2] = {{4, 0}, {4, 32}, {1, 3}, {4, 3}};
+
+    TESTING("Family file driver parallel I/O and lazy open");
+
+    if (NULL == (wbuf = (int *)HDmalloc(FAMILY_IO_NELMTS * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf = (int *)HDmalloc(FAMILY_IO_NELMTS * sizeof(int))))
+        TEST_ERROR;
+
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if ((def_fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+
+    /* Must be set after H5Pset_fapl_family() */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_fapl_family_io(fapl, 4, 0);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR;
+
+    if (H5Pset_fapl_family(def_fapl, (hsize_t)FAMILY_IO_MEMB_SIZE, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (H5Pget_fapl_family_io(def_fapl, &max_threads, &max_open) < 0)
+        TEST_ERROR;
+    if (max_threads != H5FD_FAMILY_DEFAULT_THREADS || max_open != 0)
+        TEST_ERROR;
+
+    /* Check invalid settings */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_fapl_family_io(def_fapl, 0, 0);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_fapl_family_io(def_fapl, 1, 1);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR;
+
+    if ((space = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((mspace = H5Screate_simple(1, &count, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0)
+        TEST_ERROR;
+
+    for (i = 0; i < 4; i++) {
+        if (H5Pset_fapl_family(fapl, (hsize_t)FAMILY_IO_MEMB_SIZE, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        if (H5Pset_fapl_family_io(fapl, configs[i][0], configs[i][1]) < 0)
+            TEST_ERROR;
+        if (H5Pget_fapl_family_io(fapl, &max_threads, &max_open) < 0)
+            TEST_ERROR;
+        if (max_threads != configs[i][0] || max_open != configs[i][1])
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[16], fapl, filename, sizeof(filename));
+
+        /* Write a dataset that spans about 16 members */
+        for (j = 0; j < FAMILY_IO_NELMTS; j++)
+            wbuf[j] = (int)(j * 7 + i);
+        if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+            TEST_ERROR;
+        if ((dset = H5Dcreate2(file, "dset", H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            TEST_ERROR;
+        HDmemset(rbuf, 0, FAMILY_IO_NELMTS * sizeof(int));
+        if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR;
+        if (HDmemcmp(wbuf, rbuf, FAMILY_IO_NELMTS * sizeof(int)) != 0)
+            TEST_ERROR;
+        if (H5Dclose(dset) < 0)
+            TEST_ERROR;
+        if (H5Fget_filesize(file, &size1) < 0)
+            TEST_ERROR;
+        if (H5Fclose(file) < 0)
+            TEST_ERROR;
+
+        /* Overwrite part of it, spanning several members */
+        if ((file = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+            TEST_ERROR;
+        if ((dset = H5Dopen2(file, "dset", H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Sselect_hyperslab(space, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+            TEST_ERROR;
+        for (j = 0; j < count; j++)
+            wbuf[start + j] = -(int)j;
+        if (H5Dwrite(dset, H5T_NATIVE_INT, mspace, space, H5P_DEFAULT, wbuf + start) < 0)
+            TEST_ERROR;
+        if (H5Sselect_all(space) < 0)
+            TEST_ERROR;
+        if (H5Dclose(dset) < 0)
+            TEST_ERROR;
+        if (H5Fclose(file) < 0)
+            TEST_ERROR;
+
+        /* Verify with the default settings */
+        if ((file = H5Fopen(filename, H5F_ACC_RDONLY, def_fapl)) < 0)
+            TEST_ERROR;
+        if ((dset = H5Dopen2(file, "dset", H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        HDmemset(rbuf, 0, FAMILY_IO_NELMTS * sizeof(int));
+        if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR;
+        if (HDmemcmp(wbuf, rbuf, FAMILY_IO_NELMTS * sizeof(int)) != 0)
+            TEST_ERROR;
+        if (H5Dclose(dset) < 0)
+            TEST_ERROR;
+        if (H5Fget_filesize(file, &size2) < 0)
+            TEST_ERROR;
+        if (size1 != size2)
+            TEST_ERROR;
+        if (H5Fclose(file) < 0)
+            TEST_ERROR;
+
+        /* Verify with the settings under test */
+        if ((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+            TEST_ERROR;
+        if ((dset = H5Dopen2(file, "dset", H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        HDmemset(rbuf, 0, FAMILY_IO_NELMTS * sizeof(int));
+        if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR;
+        if (HDmemcmp(wbuf, rbuf, FAMILY_IO_NELMTS * sizeof(int)) != 0)
+            TEST_ERROR;
+        if (H5Dclose(dset) < 0)
+            TEST_ERROR;
+        if (H5Fget_filesize(file, &size2) < 0)
+            TEST_ERROR;
+        if (size1 != size2)
+            TEST_ERROR;
+        if (H5Fclose(file) < 0)
+            TEST_ERROR;
+
+        h5_delete_test_file(FILENAME[16], fapl);
+    } /* end for */
+
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+    if (H5Pclose(def_fapl) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+        H5Fclose(file);
+        H5Pclose(dcpl);
+        H5Sclose(mspace);
+        H5Sclose(space);
+        H5Pclose(def_fapl);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return FAIL;
+} /* end test_family_io() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_multi_opens
  *
@@ -1906,6 +2131,154 @@ error:
     return -1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_log_binary
+ *
+ * Purpose:     Tests the binary mode of the LOG file driver: the log file
+ *              holds a header followed by fixed-size records for the
+ *              selected operations.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_log_binary(void)
+{
+    hid_t          file   = -1;
+    hid_t          fapl   = -1;
+    hid_t          space  = -1;
+    hid_t          dset   = -1;
+    FILE *         log_fp = NULL;
+    char           filename[1024];
+    int            wbuf[DSET1_DIM1];
+    hsize_t        dims[1] = {DSET1_DIM1};
+    uint8_t        header[H5FD_LOG_BINARY_HEADER_SIZE];
+    uint8_t        record[H5FD_LOG_BINARY_RECORD_SIZE];
+    const uint8_t *p;
+    unsigned       version, record_size;
+    unsigned       op       = H5FD_LOG_NOPS;
+    unsigned       n_opens  = 0;
+    unsigned       n_allocs = 0;
+    hbool_t        raw_write = FALSE;
+    size_t         n_records = 0;
+    int            i;
+
+    TESTING("LOG file driver, binary mode");
+
+    /* Record reads, writes and allocations, with a buffer of only 4 records
+     * so that it gets written out several times
+     */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_log(fapl, LOG_BINARY_FILENAME, H5FD_LOG_BINARY | H5FD_LOG_LOC_IO | H5FD_LOG_ALLOC,
+                        4 * H5FD_LOG_BINARY_RECORD_SIZE) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[6], fapl, filename, sizeof filename);
+
+    /* Create the test file with a contiguous dataset */
+    for (i = 0; i < DSET1_DIM1; i++)
+        wbuf[i] = i;
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    if ((space = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+
+    /* Closing the file writes out the buffered records */
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Check the header */
+    if (NULL == (log_fp = HDfopen(LOG_BINARY_FILENAME, "rb")))
+        TEST_ERROR;
+    if (1 != HDfread(header, sizeof(header), 1, log_fp))
+        TEST_ERROR;
+    if (HDmemcmp(header, H5FD_LOG_BINARY_SIGNATURE, (size_t)H5FD_LOG_BINARY_SIGNATURE_LEN) != 0)
+        TEST_ERROR;
+    p = header + H5FD_LOG_BINARY_SIGNATURE_LEN;
+    UINT32DECODE(p, version);
+    UINT32DECODE(p, record_size);
+    if (version != H5FD_LOG_BINARY_VERSION || record_size != H5FD_LOG_BINARY_RECORD_SIZE)
+        TEST_ERROR;
+
+    /* Check the records: the log starts with the open, ends with the close,
+     * and includes the allocation and write of the raw data
+     */
+    while (1 == HDfread(record, sizeof(record), 1, log_fp)) {
+        uint64_t size;
+        unsigned type;
+
+        /* The size follows the timestamp and address, and the operation,
+         * memory type and status follow the duration (see H5FDlog.h)
+         */
+        p = record + 16;
+        UINT64DECODE(p, size);
+        op   = record[28];
+        type = record[29];
+        if (op >= H5FD_LOG_NOPS || (record[30] & H5FD_LOG_STATUS_FAILED))
+            TEST_ERROR;
+        if (type != 0xff && type >= H5FD_MEM_NTYPES)
+            TEST_ERROR;
+        if ((n_records == 0) != (op == H5FD_LOG_OP_OPEN))
+            TEST_ERROR;
+        if (op == H5FD_LOG_OP_OPEN)
+            n_opens++;
+        if (op == H5FD_LOG_OP_ALLOC)
+            n_allocs++;
+        if (op == H5FD_LOG_OP_WRITE && type == H5FD_MEM_DRAW && size == sizeof(wbuf))
+            raw_write = TRUE;
+        n_records++;
+    }
+    if (!HDfeof(log_fp))
+        TEST_ERROR;
+    if (op != H5FD_LOG_OP_CLOSE || n_opens != 1 || n_allocs == 0 || !raw_write)
+        TEST_ERROR;
+    if (HDfclose(log_fp) < 0)
+        TEST_ERROR;
+    log_fp = NULL;
+
+    /* A log file name is required in binary mode */
+    if (H5Pset_fapl_log(fapl, NULL, H5FD_LOG_BINARY | H5FD_LOG_LOC_IO, 0) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY
+    {
+        file = H5Fopen(filename, H5F_ACC_RDONLY, fapl);
+    }
+    H5E_END_TRY;
+    if (file >= 0)
+        TEST_ERROR;
+
+    h5_delete_test_file(FILENAME[6], fapl);
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    if (log_fp)
+        HDfclose(log_fp);
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(file);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+    return -1;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    test_stdio
  *
@@ -2013,6 +2386,471 @@ error:
     return -1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_mmap
+ *
+ * Purpose:     Tests the memory-mapped file driver, including zero-copy
+ *              access to contiguous datasets with H5Dread_mapped().
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_mmap(void)
+{
+#ifdef H5_HAVE_SYS_MMAN_H
+    hid_t         file = -1, fapl = -1, access_fapl = -1, dcpl = -1;
+    hid_t         dset1 = -1, dset2 = -1, space = -1;
+    hid_t         driver_id    = -1; /* ID for this VFD              */
+    unsigned long driver_flags = 0;  /* VFD feature flags            */
+    char          filename[1024];
+    int *         fhandle = NULL;
+    hsize_t       dims[2]       = {DSET1_DIM1, DSET1_DIM2};
+    hsize_t       chunk_dims[2] = {DSET1_DIM1 / 4, DSET1_DIM2};
+    const void *  mapped        = NULL;
+    int *         points = NULL, *check = NULL;
+    herr_t        ret;
+    int           i;
+#endif /* H5_HAVE_SYS_MMAN_H */
+
+    TESTING("MMAP file driver");
+
+#ifndef H5_HAVE_SYS_MMAN_H
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_SYS_MMAN_H */
+
+    /* Set property list and file name for MMAP driver. */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_mmap(fapl) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[14], fapl, filename, sizeof filename);
+
+    /* Check that the VFD feature flags are correct */
+    if ((driver_id = H5Pget_driver(fapl)) < 0)
+        TEST_ERROR
+    if (H5FDdriver_query(driver_id, &driver_flags) < 0)
+        TEST_ERROR
+    /* Data sieving would only add a copy on top of the mapping */
+    if (driver_flags & H5FD_FEAT_DATA_SIEVE)
+        TEST_ERROR
+    if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA |
+                         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_POSIX_COMPAT_HANDLE |
+                         H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+        TEST_ERROR
+
+    /* Allocate memory for data set */
+    if (NULL == (points = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (check = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    /* Create a file with a contiguous and a chunked dataset; the file grows
+     * while it is written, so reading it back exercises remapping.
+     */
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+
+    /* Retrieve the access property list and check that the driver is correct */
+    if ((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+    if (H5FD_MMAP != H5Pget_driver(access_fapl))
+        TEST_ERROR;
+    if (H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+
+    /* Check file handle API */
+    if (H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
+        TEST_ERROR;
+    if (NULL == fhandle || *fhandle < 0)
+        TEST_ERROR;
+
+    if ((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0)
+        TEST_ERROR;
+    if ((dset1 = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        TEST_ERROR;
+    if ((dset2 = H5Dcreate2(file, DSET3_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+
+    /* Read the data back through the mapping of a file open for writing */
+    HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+        TEST_ERROR;
+
+    /* Pointers into the mapping are not handed out for writable files */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dread_mapped(dset1, H5T_NATIVE_INT, &mapped);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR;
+
+    if (H5Dclose(dset1) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset2) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Reopen the file read-only */
+    if ((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+    if ((dset1 = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((dset2 = H5Dopen2(file, DSET3_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* Regular reads */
+    HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(dset1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+        TEST_ERROR;
+    HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+        TEST_ERROR;
+
+    /* Zero-copy read of the contiguous dataset */
+    if (H5Dread_mapped(dset1, H5T_NATIVE_INT, &mapped) < 0)
+        TEST_ERROR;
+    if (NULL == mapped)
+        TEST_ERROR;
+    if (HDmemcmp(points, mapped, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+        TEST_ERROR;
+
+    /* Datasets that need conversion or are chunked can't be mapped */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dread_mapped(dset1, H5T_NATIVE_DOUBLE, &mapped);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dread_mapped(dset2, H5T_NATIVE_INT, &mapped);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR;
+
+    if (H5Dclose(dset1) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset2) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR;
+
+    HDfree(points);
+    HDfree(check);
+
+    /* Close and delete the file */
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[14], fapl);
+
+    /* Close the fapl */
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl);
+        H5Pclose(access_fapl);
+        H5Pclose(dcpl);
+        H5Sclose(space);
+        H5Dclose(dset1);
+        H5Dclose(dset2);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+
+    HDfree(points);
+    HDfree(check);
+
+    return -1;
+#endif /* H5_HAVE_SYS_MMAN_H */
+} /* end test_mmap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring
+ *
+ * Purpose:     Tests the file handle interface for the io_uring driver.
+ *              A small queue depth and I/O size are used so that requests
+ *              are split and queue slots are recycled.  The file is
+ *              checked by reopening it with the sec2 driver.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_iouring(void)
+{
+#ifdef H5_HAVE_IOURING_VFD
+    hid_t               file = -1, fapl = -1, sec2_fapl = -1, access_fapl = -1, dcpl = -1;
+    hid_t               dset1 = -1, dset2 = -1, space = -1;
+    hid_t               driver_id    = -1; /* ID for this VFD              */
+    unsigned long       driver_flags = 0;  /* VFD feature flags            */
+    H5FD_iouring_fapl_t fa, fa_out;
+    char                filename[1024];
+    int *               fhandle       = NULL;
+    hsize_t             dims[2]       = {DSET1_DIM1, DSET1_DIM2};
+    hsize_t             chunk_dims[2] = {DSET1_DIM1 / 4, DSET1_DIM2};
+    int *               points = NULL, *check = NULL;
+    herr_t              ret;
+    int                 i, direct;
+#endif /* H5_HAVE_IOURING_VFD */
+
+    TESTING("IOURING file driver");
+
+#ifndef H5_HAVE_IOURING_VFD
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_IOURING_VFD */
+
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if ((sec2_fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_sec2(sec2_fapl) < 0)
+        TEST_ERROR;
+
+    /* Invalid configurations are rejected */
+    fa.version     = H5FD_CURR_IOURING_FAPL_T_VERSION;
+    fa.queue_depth = 0;
+    fa.io_size     = 1024;
+    fa.direct_io   = FALSE;
+    fa.alignment   = 4096;
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_fapl_iouring(fapl, &fa);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR;
+    fa.queue_depth = 4;
+    fa.direct_io   = TRUE;
+    fa.alignment   = 1000;
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_fapl_iouring(fapl, &fa);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR;
+
+    /* Check that the VFD feature flags are correct */
+    if (H5Pset_fapl_iouring(fapl, NULL) < 0)
+        TEST_ERROR;
+    if ((driver_id = H5Pget_driver(fapl)) < 0)
+        TEST_ERROR
+    if (H5FDdriver_query(driver_id, &driver_flags) < 0)
+        TEST_ERROR
+    /* Queued writes may complete out of order, so no SWMR */
+    if (driver_flags & H5FD_FEAT_SUPPORTS_SWMR_IO)
+        TEST_ERROR
+    if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
+                         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_POSIX_COMPAT_HANDLE |
+                         H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+        TEST_ERROR
+    if (H5Pget_fapl_iouring(fapl, &fa_out) < 0)
+        TEST_ERROR;
+    if (fa_out.queue_depth != H5FD_IOURING_DEFAULT_QUEUE_DEPTH ||
+        fa_out.io_size != H5FD_IOURING_DEFAULT_IO_SIZE || fa_out.direct_io)
+        TEST_ERROR;
+
+    /* Allocate memory for data set */
+    if (NULL == (points = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (check = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    if ((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+
+    /* Run with buffered I/O, then with O_DIRECT if the file system has it */
+    for (direct = 0; direct < 2; direct++) {
+        fa.queue_depth = 4;
+        fa.io_size     = 1024;
+        fa.direct_io   = (hbool_t)direct;
+        fa.alignment   = 4096;
+        if (H5Pset_fapl_iouring(fapl, &fa) < 0)
+            TEST_ERROR;
+        HDmemset(&fa_out, 0, sizeof(fa_out));
+        if (H5Pget_fapl_iouring(fapl, &fa_out) < 0)
+            TEST_ERROR;
+        if (HDmemcmp(&fa, &fa_out, sizeof(fa)) != 0)
+            TEST_ERROR;
+        h5_fixname(FILENAME[15], fapl, filename, sizeof filename);
+
+        if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+            TEST_ERROR;
+
+        /* Retrieve the access property list and check that the driver is correct */
+        if ((access_fapl = H5Fget_access_plist(file)) < 0)
+            TEST_ERROR;
+        if (H5FD_IOURING != H5Pget_driver(access_fapl))
+            TEST_ERROR;
+        if (H5Pclose(access_fapl) < 0)
+            TEST_ERROR;
+
+        /* Check file handle API */
+        if (H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
+            TEST_ERROR;
+        if (NULL == fhandle || *fhandle < 0)
+            TEST_ERROR;
+
+        /* Write a contiguous and a chunked dataset */
+        if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            TEST_ERROR;
+        if ((dset1 = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(dset1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+            TEST_ERROR;
+        if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+            TEST_ERROR;
+        if ((dset2 = H5Dcreate2(file, DSET3_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+            TEST_ERROR;
+
+        /* Read back while writes may still be queued */
+        HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        if (HDmemcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+            TEST_ERROR;
+
+        /* Overwrite part of the contiguous dataset so that a queued write
+         * overlaps the earlier one
+         */
+        for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+            points[i] = -i;
+        if (H5Dwrite(dset1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+            TEST_ERROR;
+
+        if (H5Dclose(dset1) < 0)
+            TEST_ERROR;
+        if (H5Dclose(dset2) < 0)
+            TEST_ERROR;
+        if (H5Pclose(dcpl) < 0)
+            TEST_ERROR;
+        if (H5Fclose(file) < 0)
+            TEST_ERROR;
+
+        /* Check the file with the sec2 driver */
+        if ((file = H5Fopen(filename, H5F_ACC_RDONLY, sec2_fapl)) < 0)
+            TEST_ERROR;
+        if ((dset1 = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if ((dset2 = H5Dopen2(file, DSET3_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        if (HDmemcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+            TEST_ERROR;
+        HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+            if (check[i] != i)
+                TEST_ERROR;
+        if (H5Dclose(dset1) < 0)
+            TEST_ERROR;
+        if (H5Dclose(dset2) < 0)
+            TEST_ERROR;
+        if (H5Fclose(file) < 0)
+            TEST_ERROR;
+
+        /* Read the file again through the io_uring driver */
+        if ((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+            TEST_ERROR;
+        if ((dset2 = H5Dopen2(file, DSET3_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+            if (check[i] != i)
+                TEST_ERROR;
+        if (H5Dclose(dset2) < 0)
+            TEST_ERROR;
+        if (H5Fclose(file) < 0)
+            TEST_ERROR;
+
+        for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+            points[i] = i;
+
+        h5_delete_test_file(FILENAME[15], fapl);
+    } /* end for */
+
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+
+    HDfree(points);
+    HDfree(check);
+
+    /* Close the fapls */
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+    if (H5Pclose(sec2_fapl) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl);
+        H5Pclose(sec2_fapl);
+        H5Pclose(access_fapl);
+        H5Pclose(dcpl);
+        H5Sclose(space);
+        H5Dclose(dset1);
+        H5Dclose(dset2);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+
+    HDfree(points);
+    HDfree(check);
+
+    return -1;
+#endif /* H5_HAVE_IOURING_VFD */
+} /* end test_iouring() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_windows
  *
@@ -2310,6 +3148,9 @@ compare_splitter_config_info(hid_t fapl_id, H5FD_splitter_vfd_config_t *info)
         HEXPRINT(H5FD_SPLITTER_PATH_MAX, fetched_info->wo_path);
         SPLITTER_TEST_FAULT("Write-Only file path mismatch\n");
     }
+    if (info->wo_queue_size != fetched_info->wo_queue_size) {
+        SPLITTER_TEST_FAULT("Write-Only queue size mismatch\n");
+    }
 
 done:
     HDfree(fetched_info);
@@ -2336,7 +3177,7 @@ done:
  */
 static int
 run_splitter_test(const struct splitter_dataset_def *data, hbool_t ignore_wo_errors,
-                  hbool_t provide_logfile_path, hid_t sub_fapl_ids[2])
+                  hbool_t provide_logfile_path, hid_t sub_fapl_ids[2], size_t wo_queue_size)
 {
     hid_t                       file_id     = H5I_INVALID_HID;
     hid_t                       fapl_id     = H5I_INVALID_HID;
@@ -2357,6 +3198,7 @@ run_splitter_test(const struct splitter_dataset_def *data, hbool_t ignore_wo_err
     vfd_config->magic          = H5FD_SPLITTER_MAGIC;
     vfd_config->version        = H5FD_CURR_SPLITTER_VFD_CONFIG_VERSION;
     vfd_config->ignore_wo_errs = ignore_wo_errors;
+    vfd_config->wo_queue_size  = wo_queue_size;
     vfd_config->rw_fapl_id     = sub_fapl_ids[0];
     vfd_config->wo_fapl_id     = sub_fapl_ids[1];
 
@@ -2442,6 +3284,16 @@ run_splitter_test(const struct splitter_dataset_def *data, hbool_t ignore_wo_err
         SPLITTER_TEST_FAULT("can't write data to dataset\n");
     }
 
+    /* Queued writes to the W/O channel must be complete after a flush */
+    if (wo_queue_size > 0) {
+        if (H5Fflush(file_id, H5F_SCOPE_GLOBAL) < 0) {
+            SPLITTER_TEST_FAULT("can't flush file\n");
+        }
+        if (h5_compare_file_bytes(filename_rw, vfd_config->wo_path) < 0) {
+            SPLITTER_TEST_FAULT("files are not byte-for-byte equivalent after flush\n");
+        }
+    }
+
     /* Close everything */
     if (H5Dclose(dset_id) < 0) {
         SPLITTER_TEST_FAULT("can't close dset\n");
@@ -3214,10 +4066,12 @@ static herr_t
 test_splitter(void)
 {
     int                         buf[SPLITTER_SIZE][SPLITTER_SIZE];
-    hsize_t                     dims[2]       = {SPLITTER_SIZE, SPLITTER_SIZE};
-    hid_t                       child_fapl_id = H5I_INVALID_HID;
-    int                         i             = 0;
-    int                         j             = 0;
+    hsize_t                     dims[2]           = {SPLITTER_SIZE, SPLITTER_SIZE};
+    hid_t                       child_fapl_id     = H5I_INVALID_HID;
+    size_t                      wo_queue_sizes[3] = {0, 64, 1024 * KB};
+    int                         i                 = 0;
+    int                         j                 = 0;
+    int                         k                 = 0;
     struct splitter_dataset_def data;
 
     TESTING("SPLITTER file driver");
@@ -3264,26 +4118,32 @@ test_splitter(void)
     }
 
     /* Test file creation, utilizing different child FAPLs (default vs.
-     * specified), logfile, and Write Channel error ignoring behavior.
+     * specified), logfile, Write Channel error ignoring behavior, and
+     * Write Channel write-behind queue sizes (none, smaller than some of
+     * the writes, larger than all of them).
      */
-    for (i = 0; i < 4; i++) {
-        hbool_t ignore_wo_errors     = (i & 1) ? TRUE : FALSE;
-        hbool_t provide_logfile_path = (i & 2) ? TRUE : FALSE;
-        hid_t   child_fapl_ids[2]    = {H5P_DEFAULT, H5P_DEFAULT};
+    for (k = 0; k < 3; k++) {
+        for (i = 0; i < 4; i++) {
+            hbool_t ignore_wo_errors     = (i & 1) ? TRUE : FALSE;
+            hbool_t provide_logfile_path = (i & 2) ? TRUE : FALSE;
+            hid_t   child_fapl_ids[2]    = {H5P_DEFAULT, H5P_DEFAULT};
 
-        /* Test child driver definition/default combination */
-        for (j = 0; j < 4; j++) {
+            /* Test child driver definition/default combination */
+            for (j = 0; j < 4; j++) {
 
-            child_fapl_ids[0] = (j & 1) ? child_fapl_id : H5P_DEFAULT;
-            child_fapl_ids[1] = (j & 2) ? child_fapl_id : H5P_DEFAULT;
+                child_fapl_ids[0] = (j & 1) ? child_fapl_id : H5P_DEFAULT;
+                child_fapl_ids[1] = (j & 2) ? child_fapl_id : H5P_DEFAULT;
 
-            if (run_splitter_test(&data, ignore_wo_errors, provide_logfile_path, child_fapl_ids) < 0) {
-                TEST_ERROR;
-            }
+                if (run_splitter_test(&data, ignore_wo_errors, provide_logfile_path, child_fapl_ids,
+                                      wo_queue_sizes[k]) < 0) {
+                    TEST_ERROR;
+                }
+
+            } /* end for child fapl definition/pairing */
 
-        } /* end for child fapl definition/pairing */
+        } /* end for behavior-flag loops */
 
-    } /* end for behavior-flag loops */
+    } /* end for W/O queue sizes */
 
     /* TODO: SWMR open? */
     /* Concurrent opens with both drivers using the Splitter */
@@ -3328,10 +4188,14 @@ main(void)
     nerrors += test_family() < 0 ? 1 : 0;
     nerrors += test_family_compat() < 0 ? 1 : 0;
     nerrors += test_family_member_fapl() < 0 ? 1 : 0;
+    nerrors += test_family_io() < 0 ? 1 : 0;
     nerrors += test_multi() < 0 ? 1 : 0;
     nerrors += test_multi_compat() < 0 ? 1 : 0;
     nerrors += test_log() < 0 ? 1 : 0;
+    nerrors += test_log_binary() < 0 ? 1 : 0;
     nerrors += test_stdio() < 0 ? 1 : 0;
+    nerrors += test_mmap() < 0 ? 1 : 0;
+    nerrors += test_iouring() < 0 ? 1 : 0;
     nerrors += test_windows() < 0 ? 1 : 0;
     nerrors += test_ros3() < 0 ? 1 : 0;
     nerrors += test_splitter() < 0 ? 1 : 0;
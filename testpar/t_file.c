@@ -218,7 +218,7 @@ test_page_buffer_access(void)
         ret = H5F_block_write(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * (size_t)num_elements, data);
         VRFY((ret == 0), "");
 
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* update the first 50 elements */
         for (i = 0; i < 50; i++)
@@ -229,7 +229,7 @@ test_page_buffer_access(void)
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
         page_count += 2;
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* update the second 50 elements */
         for (i = 0; i < 50; i++)
@@ -238,7 +238,7 @@ test_page_buffer_access(void)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 50), sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* update 100 - 200 */
         for (i = 0; i < 100; i++)
@@ -247,7 +247,7 @@ test_page_buffer_access(void)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 100), sizeof(int) * 100, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         ret = H5PB_flush(f->shared);
         VRFY((ret == 0), "");
@@ -255,24 +255,24 @@ test_page_buffer_access(void)
         /* read elements 0 - 200 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 200, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 200; i++)
             VRFY((data[i] == i), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 200, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 200; i++)
             VRFY((data[i] == i), "Read different values than written");
 
         /* read elements 0 - 50 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == i), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == i), "Read different values than written");
 
@@ -326,7 +326,7 @@ test_page_buffer_access(void)
         ret = H5F_block_write(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * (size_t)num_elements, data);
         VRFY((ret == 0), "");
 
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* update the first 50 elements */
         for (i = 0; i < 50; i++)
@@ -335,7 +335,7 @@ test_page_buffer_access(void)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* update the second 50 elements */
         for (i = 0; i < 50; i++)
@@ -344,7 +344,7 @@ test_page_buffer_access(void)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 50), sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* update 100 - 200 */
         for (i = 0; i < 100; i++)
@@ -353,7 +353,7 @@ test_page_buffer_access(void)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 100), sizeof(int) * 100, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         ret = H5Fflush(file_id, H5F_SCOPE_GLOBAL);
         VRFY((ret == 0), "");
@@ -361,25 +361,25 @@ test_page_buffer_access(void)
         /* read elements 0 - 200 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 200, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 200; i++)
             VRFY((data[i] == i), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 200, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 200; i++)
             VRFY((data[i] == i), "Read different values than written");
 
         /* read elements 0 - 50 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == i), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
         page_count += 1;
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == i), "Read different values than written");
 
@@ -389,20 +389,20 @@ test_page_buffer_access(void)
             data[i] = -1;
         ret = H5F_block_write(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
 
         /* read elements 0 - 50 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == -1), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->index_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == -1), "Read different values than written");
 
@@ -82,6 +82,7 @@ const char *volnames[] = {
  */
 const char *drivernames[] = {
     "sec2", "direct", "log", "windows", "stdio", "core", "family", "split", "multi", "mpio", "ros3", "hdfs",
+    "mmap", "iouring",
 };
 
 #define NUM_VOLS    (sizeof(volnames) / sizeof(volnames[0]))
@@ -566,6 +567,24 @@ h5tools_set_fapl_vfd(hid_t fapl_id, h5tools_vfd_info_t *vfd_info)
             H5TOOLS_GOTO_ERROR(FAIL, "H5Pset_fapl_hdfs() failed");
 #else
         H5TOOLS_GOTO_ERROR(FAIL, "The HDFS VFD is not enabled");
+#endif
+    }
+    else if (!HDstrcmp(vfd_info->name, drivernames[MMAP_VFD_IDX])) {
+#ifdef H5_HAVE_SYS_MMAN_H
+        /* Memory-mapped Driver */
+        if (H5Pset_fapl_mmap(fapl_id) < 0)
+            H5TOOLS_GOTO_ERROR(FAIL, "H5Pset_fapl_mmap failed");
+#else
+        H5TOOLS_GOTO_ERROR(FAIL, "The memory-mapped VFD is not enabled");
+#endif
+    }
+    else if (!HDstrcmp(vfd_info->name, drivernames[IOURING_VFD_IDX])) {
+#ifdef H5_HAVE_IOURING_VFD
+        /* io_uring Driver */
+        if (H5Pset_fapl_iouring(fapl_id, (const H5FD_iouring_fapl_t *)vfd_info->info) < 0)
+            H5TOOLS_GOTO_ERROR(FAIL, "H5Pset_fapl_iouring failed");
+#else
+        H5TOOLS_GOTO_ERROR(FAIL, "The io_uring VFD is not enabled");
 #endif
     }
     else
@@ -802,6 +821,14 @@ h5tools_get_vfd_name(hid_t fapl_id, char *drivername, size_t drivername_size)
 #ifdef H5_HAVE_LIBHDFS
         else if (driver_id == H5FD_HDFS)
             driver_name = drivernames[HDFS_VFD_IDX];
+#endif
+#ifdef H5_HAVE_SYS_MMAN_H
+        else if (driver_id == H5FD_MMAP)
+            driver_name = drivernames[MMAP_VFD_IDX];
+#endif
+#ifdef H5_HAVE_IOURING_VFD
+        else if (driver_id == H5FD_IOURING)
+            driver_name = drivernames[IOURING_VFD_IDX];
 #endif
         else
             driver_name = "unknown";
@@ -598,6 +598,8 @@ typedef enum {
     MPIO_VFD_IDX,
     ROS3_VFD_IDX,
     HDFS_VFD_IDX,
+    MMAP_VFD_IDX,
+    IOURING_VFD_IDX,
 } driver_idx;
 
 /* The following include, h5tools_str.h, must be after the
@@ -0,0 +1,727 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: A tool that reads a binary I/O log written by the log VFD (when
+ *          the file access property list was set up with H5Pset_fapl_log()
+ *          and the H5FD_LOG_BINARY flag) and prints:
+ *
+ *      (1) the number of operations of each kind
+ *      (2) the reads and writes per file memory type (H5FD_mem_t), with the
+ *          bytes moved, the time spent and the resulting bandwidth
+ *      (3) a histogram of the seek distances between consecutive reads and
+ *          writes, in power-of-two buckets
+ *      (4) the file blocks that receive the most small reads and writes
+ *          ("hot spots"), which are candidates for caching, aggregation or
+ *          a larger page/sieve buffer
+ */
+#include "hdf5.h"
+#include "H5private.h"
+#include "H5Fprivate.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+/* Name of tool */
+#define PROGRAMNAME "h5fdlog"
+
+/* Defaults for the hot spot report */
+#define DEFAULT_SMALL_SIZE 4096
+#define DEFAULT_BLOCK_SIZE (64 * 1024)
+#define DEFAULT_NHOT       10
+
+/* Index of the "no memory type" row in the per-type tables */
+#define TYPE_NONE H5FD_MEM_NTYPES
+
+/* Number of seek distance buckets on each side of zero: one for each power
+ * of two from 2^0 to 2^63
+ */
+#define NSEEK_BUCKETS 64
+
+/* A decoded log record */
+typedef struct fdlog_record_t {
+    uint64_t timestamp; /* Start time of the operation (microseconds) */
+    haddr_t  addr;      /* File address */
+    uint64_t size;      /* Size of the operation */
+    uint32_t duration;  /* Duration of the operation (microseconds) */
+    unsigned op;        /* H5FD_LOG_OP_* */
+    unsigned type;      /* H5FD_mem_t, 0xff when there is none */
+    unsigned status;    /* H5FD_LOG_STATUS_FAILED */
+} fdlog_record_t;
+
+/* Totals for reads or writes of one memory type */
+typedef struct fdlog_io_stats_t {
+    uint64_t count;    /* Number of operations */
+    uint64_t bytes;    /* Bytes moved */
+    uint64_t duration; /* Time spent (microseconds) */
+} fdlog_io_stats_t;
+
+/* A small read or write, for the hot spot report */
+typedef struct fdlog_small_io_t {
+    uint64_t block; /* File block (address / block size) */
+    uint64_t size;  /* Size of the operation */
+    hbool_t  write; /* Whether the operation was a write */
+} fdlog_small_io_t;
+
+/* A file block with small I/O, for the hot spot report */
+typedef struct fdlog_hot_block_t {
+    uint64_t block;  /* File block (address / block size) */
+    uint64_t reads;  /* Number of small reads */
+    uint64_t writes; /* Number of small writes */
+    uint64_t bytes;  /* Bytes moved by the small reads and writes */
+} fdlog_hot_block_t;
+
+/* Names of the logged operations, indexed by H5FD_LOG_OP_* */
+static const char *op_names_g[H5FD_LOG_NOPS] = {"open",     "close", "read", "write",
+                                                 "truncate", "alloc", "free"};
+
+/* Names of the memory types, indexed by H5FD_mem_t */
+static const char *type_names_g[H5FD_MEM_NTYPES + 1] = {"default", "super", "btree", "draw",
+                                                        "gheap",   "lheap", "ohdr",  "(none)"};
+
+static char *   fname_g      = NULL;
+static uint64_t small_size_g = DEFAULT_SMALL_SIZE;
+static uint64_t block_size_g = DEFAULT_BLOCK_SIZE;
+static unsigned nhot_g       = DEFAULT_NHOT;
+
+/*
+ * Command-line options: The user can specify short or long-named
+ * parameters.
+ */
+static const char *        s_opts   = "hVs:b:n:";
+static struct long_options l_opts[] = {{"help", no_arg, 'h'},
+                                       {"hel", no_arg, 'h'},
+                                       {"he", no_arg, 'h'},
+                                       {"version", no_arg, 'V'},
+                                       {"versio", no_arg, 'V'},
+                                       {"versi", no_arg, 'V'},
+                                       {"vers", no_arg, 'V'},
+                                       {"small", require_arg, 's'},
+                                       {"smal", require_arg, 's'},
+                                       {"sma", require_arg, 's'},
+                                       {"sm", require_arg, 's'},
+                                       {"block", require_arg, 'b'},
+                                       {"bloc", require_arg, 'b'},
+                                       {"blo", require_arg, 'b'},
+                                       {"bl", require_arg, 'b'},
+                                       {"hot", require_arg, 'n'},
+                                       {"ho", require_arg, 'n'},
+                                       {NULL, 0, '\0'}};
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Prints a usage message
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS] log_file\n", prog);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "   -h, --help                Print a usage message and exit\n");
+    HDfprintf(stdout, "   -V, --version             Print version number and exit\n");
+    HDfprintf(stdout, "   -s S, --small=S           Count reads and writes smaller than S bytes as\n");
+    HDfprintf(stdout, "                             small I/O in the hot spot report (default 4K)\n");
+    HDfprintf(stdout, "   -b B, --block=B           Group small I/O into file blocks of B bytes in\n");
+    HDfprintf(stdout, "                             the hot spot report (default 64K)\n");
+    HDfprintf(stdout, "   -n N, --hot=N             Report the N blocks with the most small I/O\n");
+    HDfprintf(stdout, "                             (default 10, 0 for no report)\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "  Sizes are in bytes and may have a K, M or G suffix.\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "  log_file is an I/O log written by the log VFD in the binary format, see\n");
+    HDfprintf(stdout, "  H5Pset_fapl_log() and H5FD_LOG_BINARY.\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "Examples of use:\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "h5fdlog io.log\n");
+    HDfprintf(stdout, "  Summarize the I/O recorded in io.log.\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "h5fdlog -s 1K -b 4K -n 20 io.log\n");
+    HDfprintf(stdout, "  Report the 20 4 KiB blocks that receive the most I/O smaller than 1 KiB.\n");
+} /* usage() */
+
+/*-------------------------------------------------------------------------
+ * Function:    parse_size
+ *
+ * Purpose:     Parse a size in bytes, with an optional K, M or G suffix
+ *
+ * Return:      Success:    0, with *size_out set
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+parse_size(const char *str, uint64_t *size_out)
+{
+    char *             end;
+    unsigned long long size;
+
+    size = HDstrtoull(str, &end, 10);
+    if (end == str)
+        goto error;
+    switch (*end) {
+        case 'k':
+        case 'K':
+            size *= 1024;
+            end++;
+            break;
+
+        case 'm':
+        case 'M':
+            size *= 1024 * 1024;
+            end++;
+            break;
+
+        case 'g':
+        case 'G':
+            size *= 1024 * 1024 * 1024;
+            end++;
+            break;
+
+        default:
+            break;
+    } /* end switch */
+    if (size == 0 || *end != '\0')
+        goto error;
+
+    *size_out = (uint64_t)size;
+    return 0;
+
+error:
+    error_msg("invalid size \"%s\"\n", str);
+    return -1;
+} /* parse_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    parse_command_line
+ *
+ * Purpose:     Parses command line and sets up global variables
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+parse_command_line(int argc, const char **argv)
+{
+    int opt;
+
+    /* no arguments */
+    if (argc == 1) {
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    }
+
+    /* parse command line options */
+    while ((opt = get_option(argc, argv, s_opts, l_opts)) != EOF) {
+        switch ((char)opt) {
+            case 'h':
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 'V':
+                print_version(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 's':
+                if (parse_size(opt_arg, &small_size_g) < 0) {
+                    h5tools_setstatus(EXIT_FAILURE);
+                    goto error;
+                }
+                break;
+
+            case 'b':
+                if (parse_size(opt_arg, &block_size_g) < 0) {
+                    h5tools_setstatus(EXIT_FAILURE);
+                    goto error;
+                }
+                break;
+
+            case 'n':
+                nhot_g = (unsigned)HDatoi(opt_arg);
+                break;
+
+            default:
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_FAILURE);
+                goto error;
+        } /* end switch */
+    }     /* end while */
+
+    /* check for file name to be processed */
+    if (argc <= opt_ind) {
+        error_msg("missing file name\n");
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    } /* end if */
+
+    fname_g = HDstrdup(argv[opt_ind]);
+
+done:
+    return 0;
+
+error:
+    return -1;
+} /* parse_command_line() */
+
+/*-------------------------------------------------------------------------
+ * Function:    read_log
+ *
+ * Purpose:     Read and decode all the records of a binary I/O log
+ *
+ * Return:      Success:    0, with *records_out (to be freed by the
+ *                          caller) and *nrecords_out set
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+read_log(const char *name, fdlog_record_t **records_out, size_t *nrecords_out)
+{
+    FILE *          f = NULL;
+    uint8_t         header[H5FD_LOG_BINARY_HEADER_SIZE];
+    uint8_t         buf[H5FD_LOG_BINARY_RECORD_SIZE];
+    const uint8_t * p;
+    unsigned        version;
+    unsigned        record_size;
+    fdlog_record_t *records  = NULL;
+    size_t          nalloc   = 0;
+    size_t          nrecords = 0;
+
+    if (NULL == (f = HDfopen(name, "rb"))) {
+        error_msg("unable to open log file \"%s\"\n", name);
+        goto error;
+    }
+
+    /* Check the header */
+    if (1 != HDfread(header, sizeof(header), 1, f) ||
+        HDmemcmp(header, H5FD_LOG_BINARY_SIGNATURE, (size_t)H5FD_LOG_BINARY_SIGNATURE_LEN) != 0) {
+        error_msg("\"%s\" is not a binary I/O log\n", name);
+        goto error;
+    }
+    p = header + H5FD_LOG_BINARY_SIGNATURE_LEN;
+    UINT32DECODE(p, version);
+    UINT32DECODE(p, record_size);
+    if (version != H5FD_LOG_BINARY_VERSION || record_size != H5FD_LOG_BINARY_RECORD_SIZE) {
+        error_msg("unsupported log version %u (record size %u)\n", version, record_size);
+        goto error;
+    }
+
+    /* Decode the records.  A partial record at the end of the file (e.g. from
+     * an application that crashed) is ignored.
+     */
+    while (1 == HDfread(buf, sizeof(buf), 1, f)) {
+        fdlog_record_t *rec;
+
+        if (nrecords == nalloc) {
+            fdlog_record_t *tmp;
+
+            nalloc = nalloc ? 2 * nalloc : 4096;
+            if (NULL == (tmp = (fdlog_record_t *)HDrealloc(records, nalloc * sizeof(fdlog_record_t)))) {
+                error_msg("unable to allocate memory for log records\n");
+                goto error;
+            }
+            records = tmp;
+        }
+        rec = &records[nrecords++];
+
+        p = buf;
+        UINT64DECODE(p, rec->timestamp);
+        UINT64DECODE(p, rec->addr);
+        UINT64DECODE(p, rec->size);
+        UINT32DECODE(p, rec->duration);
+        rec->op     = *p++;
+        rec->type   = *p++;
+        rec->status = *p++;
+    } /* end while */
+
+    HDfclose(f);
+
+    *records_out  = records;
+    *nrecords_out = nrecords;
+    return 0;
+
+error:
+    if (f)
+        HDfclose(f);
+    if (records)
+        HDfree(records);
+    return -1;
+} /* read_log() */
+
+/*-------------------------------------------------------------------------
+ * Function:    print_bytes
+ *
+ * Purpose:     Print a byte count or rate scaled to a readable unit
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+print_bytes(double bytes, const char *suffix)
+{
+    const char *units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+    unsigned    u       = 0;
+
+    while (bytes >= 1024.0 && u < NELMTS(units) - 1) {
+        bytes /= 1024.0;
+        u++;
+    }
+    HDfprintf(stdout, "%9.2f %-3s%s", bytes, units[u], suffix);
+} /* print_bytes() */
+
+/*-------------------------------------------------------------------------
+ * Function:    print_operations
+ *
+ * Purpose:     Print the number of operations of each kind and the reads
+ *              and writes per memory type
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+print_operations(const fdlog_record_t *records, size_t nrecords)
+{
+    uint64_t         op_count[H5FD_LOG_NOPS];
+    uint64_t         op_failed[H5FD_LOG_NOPS];
+    fdlog_io_stats_t io[2][H5FD_MEM_NTYPES + 1]; /* [0] reads, [1] writes */
+    uint64_t         unknown = 0;
+    unsigned         w;
+    size_t           u;
+
+    HDmemset(op_count, 0, sizeof(op_count));
+    HDmemset(op_failed, 0, sizeof(op_failed));
+    HDmemset(io, 0, sizeof(io));
+
+    for (u = 0; u < nrecords; u++) {
+        const fdlog_record_t *rec = &records[u];
+
+        if (rec->op >= H5FD_LOG_NOPS) {
+            unknown++;
+            continue;
+        }
+        op_count[rec->op]++;
+        if (rec->status & H5FD_LOG_STATUS_FAILED)
+            op_failed[rec->op]++;
+        else if (rec->op == H5FD_LOG_OP_READ || rec->op == H5FD_LOG_OP_WRITE) {
+            fdlog_io_stats_t *st =
+                &io[rec->op == H5FD_LOG_OP_WRITE][rec->type < H5FD_MEM_NTYPES ? rec->type : TYPE_NONE];
+
+            st->count++;
+            st->bytes += rec->size;
+            st->duration += rec->duration;
+        }
+    } /* end for */
+
+    HDfprintf(stdout, "Records: %zu", nrecords);
+    if (nrecords > 1)
+        HDfprintf(stdout, " over %.3f seconds",
+                  (double)(records[nrecords - 1].timestamp - records[0].timestamp) / 1000000.0);
+    HDfprintf(stdout, "\n");
+    if (unknown)
+        HDfprintf(stdout, "Unknown records: %" PRIu64 "\n", unknown);
+
+    HDfprintf(stdout, "\nOperations:\n");
+    HDfprintf(stdout, "    %-12s %12s %12s\n", "operation", "count", "failed");
+    for (u = 0; u < H5FD_LOG_NOPS; u++)
+        if (op_count[u])
+            HDfprintf(stdout, "    %-12s %12" PRIu64 " %12" PRIu64 "\n", op_names_g[u], op_count[u],
+                      op_failed[u]);
+
+    for (w = 0; w < 2; w++) {
+        HDfprintf(stdout, "\n%s by memory type:\n", w ? "Writes" : "Reads");
+        if (0 == op_count[w ? H5FD_LOG_OP_WRITE : H5FD_LOG_OP_READ]) {
+            HDfprintf(stdout, "    n/a (none recorded)\n");
+            continue;
+        }
+        HDfprintf(stdout, "    %-8s %12s %13s %12s %15s %13s\n", "type", "count", "bytes", "time (s)",
+                  "bandwidth", "mean size");
+        for (u = 0; u <= H5FD_MEM_NTYPES; u++) {
+            const fdlog_io_stats_t *st = &io[w][u];
+
+            if (0 == st->count)
+                continue;
+            HDfprintf(stdout, "    %-8s %12" PRIu64 " ", type_names_g[u], st->count);
+            print_bytes((double)st->bytes, "");
+            HDfprintf(stdout, " %12.6f ", (double)st->duration / 1000000.0);
+            if (st->duration)
+                print_bytes((double)st->bytes * 1000000.0 / (double)st->duration, "/s");
+            else
+                HDfprintf(stdout, "%15s", "n/a");
+            HDfprintf(stdout, " ");
+            print_bytes((double)st->bytes / (double)st->count, "");
+            HDfprintf(stdout, "\n");
+        } /* end for */
+    }     /* end for */
+} /* print_operations() */
+
+/*-------------------------------------------------------------------------
+ * Function:    print_seeks
+ *
+ * Purpose:     Print a histogram of the distances from the end of each
+ *              read or write to the start of the next one
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+print_seeks(const fdlog_record_t *records, size_t nrecords)
+{
+    uint64_t backward[NSEEK_BUCKETS];
+    uint64_t forward[NSEEK_BUCKETS];
+    uint64_t sequential = 0;
+    uint64_t nseeks     = 0;
+    haddr_t  prev_end   = HADDR_UNDEF;
+    int      u;
+    size_t   v;
+
+    HDmemset(backward, 0, sizeof(backward));
+    HDmemset(forward, 0, sizeof(forward));
+
+    for (v = 0; v < nrecords; v++) {
+        const fdlog_record_t *rec = &records[v];
+        uint64_t              dist;
+        unsigned              bucket = 0;
+
+        if (rec->op != H5FD_LOG_OP_READ && rec->op != H5FD_LOG_OP_WRITE)
+            continue;
+
+        if (prev_end != HADDR_UNDEF) {
+            nseeks++;
+            if (rec->addr == prev_end)
+                sequential++;
+            else {
+                dist = rec->addr > prev_end ? rec->addr - prev_end : prev_end - rec->addr;
+                while (dist >>= 1)
+                    bucket++;
+                if (rec->addr > prev_end)
+                    forward[bucket]++;
+                else
+                    backward[bucket]++;
+            }
+        }
+        prev_end = rec->addr + rec->size;
+    } /* end for */
+
+    HDfprintf(stdout, "\nSeek distances between consecutive reads/writes:\n");
+    if (0 == nseeks) {
+        HDfprintf(stdout, "    n/a (fewer than two reads/writes)\n");
+        return;
+    }
+    HDfprintf(stdout, "    %-28s %12s %8s\n", "distance (bytes)", "count", "percent");
+    for (u = NSEEK_BUCKETS - 1; u >= 0; u--)
+        if (backward[u])
+            HDfprintf(stdout, "    -[%12" PRIu64 ", %12" PRIu64 ") %12" PRIu64 " %7.2f%%\n", (uint64_t)1 << u,
+                      u == NSEEK_BUCKETS - 1 ? UINT64_MAX : (uint64_t)1 << (u + 1), backward[u],
+                      100.0 * (double)backward[u] / (double)nseeks);
+    HDfprintf(stdout, "    %-28s %12" PRIu64 " %7.2f%%\n", "0 (sequential)", sequential,
+              100.0 * (double)sequential / (double)nseeks);
+    for (u = 0; u < NSEEK_BUCKETS; u++)
+        if (forward[u])
+            HDfprintf(stdout, "    +[%12" PRIu64 ", %12" PRIu64 ") %12" PRIu64 " %7.2f%%\n", (uint64_t)1 << u,
+                      u == NSEEK_BUCKETS - 1 ? UINT64_MAX : (uint64_t)1 << (u + 1), forward[u],
+                      100.0 * (double)forward[u] / (double)nseeks);
+} /* print_seeks() */
+
+/*-------------------------------------------------------------------------
+ * Function:    cmp_small_io / cmp_hot_block
+ *
+ * Purpose:     qsort() callbacks ordering small I/O by file block and hot
+ *              blocks by decreasing number of small I/O operations
+ *
+ * Return:      <0, 0, >0
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+cmp_small_io(const void *_a, const void *_b)
+{
+    const fdlog_small_io_t *a = (const fdlog_small_io_t *)_a;
+    const fdlog_small_io_t *b = (const fdlog_small_io_t *)_b;
+
+    return (a->block > b->block) - (a->block < b->block);
+} /* cmp_small_io() */
+
+static int
+cmp_hot_block(const void *_a, const void *_b)
+{
+    const fdlog_hot_block_t *a  = (const fdlog_hot_block_t *)_a;
+    const fdlog_hot_block_t *b  = (const fdlog_hot_block_t *)_b;
+    uint64_t                 na = a->reads + a->writes;
+    uint64_t                 nb = b->reads + b->writes;
+
+    if (na != nb)
+        return (na < nb) - (na > nb);
+    return (a->block > b->block) - (a->block < b->block);
+} /* cmp_hot_block() */
+
+/*-------------------------------------------------------------------------
+ * Function:    print_hot_spots
+ *
+ * Purpose:     Print the file blocks that receive the most small reads
+ *              and writes
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+print_hot_spots(const fdlog_record_t *records, size_t nrecords)
+{
+    fdlog_small_io_t * small   = NULL;
+    fdlog_hot_block_t *blocks  = NULL;
+    size_t             nsmall  = 0;
+    size_t             nblocks = 0;
+    size_t             u;
+
+    if (0 == nhot_g)
+        return 0;
+
+    /* Collect the small reads and writes */
+    if (nrecords > 0 && NULL == (small = (fdlog_small_io_t *)HDmalloc(nrecords * sizeof(fdlog_small_io_t))))
+        goto error;
+    for (u = 0; u < nrecords; u++) {
+        const fdlog_record_t *rec = &records[u];
+
+        if ((rec->op == H5FD_LOG_OP_READ || rec->op == H5FD_LOG_OP_WRITE) &&
+            !(rec->status & H5FD_LOG_STATUS_FAILED) && rec->size < small_size_g) {
+            small[nsmall].block = rec->addr / block_size_g;
+            small[nsmall].size  = rec->size;
+            small[nsmall].write = (hbool_t)(rec->op == H5FD_LOG_OP_WRITE);
+            nsmall++;
+        }
+    } /* end for */
+
+    HDfprintf(stdout, "\nSmall (< %" PRIu64 " bytes) I/O hot spots, in %" PRIu64 " byte blocks:\n",
+              small_size_g, block_size_g);
+    if (0 == nsmall) {
+        HDfprintf(stdout, "    n/a (no small reads/writes)\n");
+        goto done;
+    }
+
+    /* Group them by block */
+    HDqsort(small, nsmall, sizeof(fdlog_small_io_t), cmp_small_io);
+    if (NULL == (blocks = (fdlog_hot_block_t *)HDcalloc(nsmall, sizeof(fdlog_hot_block_t))))
+        goto error;
+    for (u = 0; u < nsmall; u++) {
+        if (0 == u || small[u].block != blocks[nblocks - 1].block)
+            blocks[nblocks++].block = small[u].block;
+        if (small[u].write)
+            blocks[nblocks - 1].writes++;
+        else
+            blocks[nblocks - 1].reads++;
+        blocks[nblocks - 1].bytes += small[u].size;
+    } /* end for */
+
+    /* Print the busiest blocks */
+    HDqsort(blocks, nblocks, sizeof(fdlog_hot_block_t), cmp_hot_block);
+    HDfprintf(stdout, "    %zu small reads/writes in %zu blocks\n", nsmall, nblocks);
+    HDfprintf(stdout, "    %-20s %12s %12s %13s\n", "block address", "reads", "writes", "bytes");
+    for (u = 0; u < nblocks && u < nhot_g; u++) {
+        HDfprintf(stdout, "    %20" PRIu64 " %12" PRIu64 " %12" PRIu64 " ", blocks[u].block * block_size_g,
+                  blocks[u].reads, blocks[u].writes);
+        print_bytes((double)blocks[u].bytes, "\n");
+    } /* end for */
+
+done:
+    if (small)
+        HDfree(small);
+    if (blocks)
+        HDfree(blocks);
+    return 0;
+
+error:
+    error_msg("unable to allocate memory for the hot spot report\n");
+    if (small)
+        HDfree(small);
+    if (blocks)
+        HDfree(blocks);
+    return -1;
+} /* print_hot_spots() */
+
+/*-------------------------------------------------------------------------
+ * Function:    leave
+ *
+ * Purpose:     Close the tools library and exit
+ *
+ * Return:      Does not return
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+leave(int ret)
+{
+    h5tools_close();
+    HDexit(ret);
+} /* leave() */
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Summarize the access patterns in a binary I/O log
+ *
+ * Return:      Success: 0
+ *              Failure: 1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, const char *argv[])
+{
+    fdlog_record_t *records  = NULL;
+    size_t          nrecords = 0;
+
+    h5tools_setprogname(PROGRAMNAME);
+    h5tools_setstatus(EXIT_SUCCESS);
+
+    /* initialize h5tools lib */
+    h5tools_init();
+
+    /* Parse command line options */
+    if (parse_command_line(argc, argv) < 0)
+        goto done;
+
+    if (fname_g == NULL)
+        goto done;
+
+    if (read_log(fname_g, &records, &nrecords) < 0) {
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+
+    HDfprintf(stdout, "File: %s\n", fname_g);
+    print_operations(records, nrecords);
+    print_seeks(records, nrecords);
+    if (print_hot_spots(records, nrecords) < 0)
+        h5tools_setstatus(EXIT_FAILURE);
+
+done:
+    if (records)
+        HDfree(records);
+    if (fname_g)
+        HDfree(fname_g);
+
+    leave(h5tools_getstatus());
+} /* main() */
@@ -0,0 +1,927 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: A tool that reads a binary metadata cache log (written when the
+ *          file access property list was set up with H5Pset_mdc_log_options()
+ *          and H5Pset_mdc_log_format(..., H5F_MDC_LOG_FORMAT_BINARY)) and:
+ *
+ *      (1) prints a summary of the logged operations, per entry type, and
+ *          the protect hit rate that the cache actually achieved
+ *      (2) -s, --sizes=LIST:   replays the log against a model of the
+ *          metadata cache for each of the given maximum cache sizes and
+ *          prints the predicted hit rate, so that a cache configuration
+ *          can be chosen without re-running the application
+ */
+#include "hdf5.h"
+#include "H5private.h"
+#include "H5ACprivate.h"
+#include "H5Clog.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+/* Name of tool */
+#define PROGRAMNAME "h5mdclog"
+
+/* Maximum number of cache sizes to replay */
+#define MAX_SIZES 32
+
+/* Number of buckets in the replay model's entry index (same as H5C) */
+#define SIM_HASH_TABLE_LEN (64 * 1024)
+#define SIM_HASH_FCN(a)    ((size_t)(((a) >> 3) & (SIM_HASH_TABLE_LEN - 1)))
+
+/* A decoded log record */
+typedef struct mdclog_record_t {
+    uint64_t timestamp; /* Time of the operation (microseconds) */
+    haddr_t  addr;      /* Entry address */
+    uint64_t value;     /* Operation-specific value (see H5Clog.h) */
+    unsigned op;        /* H5C_log_binary_op_t */
+    unsigned type_id;   /* Entry type ID, 0xff when there is no entry */
+    unsigned status;    /* H5C_LOG_BINARY_HIT / H5C_LOG_BINARY_FAILED */
+    unsigned flags;     /* Flags passed to the operation */
+} mdclog_record_t;
+
+/* An entry in the replay model */
+typedef struct sim_entry_t {
+    haddr_t             addr;          /* Entry address */
+    uint64_t            size;          /* Entry size */
+    unsigned            protect_count; /* Number of outstanding protects */
+    hbool_t             pinned;        /* Whether the entry is pinned */
+    hbool_t             in_lru;        /* Whether the entry is on the LRU list (evictable) */
+    struct sim_entry_t *ht_next;       /* Next entry in the hash bucket */
+    struct sim_entry_t *prev;          /* Previous (more recently used) entry on the LRU list */
+    struct sim_entry_t *next;          /* Next (less recently used) entry on the LRU list */
+} sim_entry_t;
+
+/* The replay model: a size-limited LRU cache in which protected and pinned
+ * entries can't be evicted, as in H5C
+ */
+typedef struct sim_cache_t {
+    uint64_t      max_size;   /* Maximum size of the cache */
+    uint64_t      index_size; /* Total size of the resident entries */
+    uint64_t      peak_size;  /* Largest value of index_size */
+    sim_entry_t **index;      /* Hash table of resident entries */
+    sim_entry_t * lru_head;   /* Most recently used evictable entry */
+    sim_entry_t * lru_tail;   /* Least recently used evictable entry */
+    uint64_t      accesses;   /* Number of successful protects */
+    uint64_t      hits;       /* Number of protects of resident entries */
+    uint64_t      evictions;  /* Number of entries evicted to make space */
+} sim_cache_t;
+
+/* Names of the logged operations, indexed by H5C_log_binary_op_t */
+static const char *op_names_g[H5C_LOG_BINARY_NOPS] = {"start logging",
+                                                      "stop logging",
+                                                      "create cache",
+                                                      "destroy cache",
+                                                      "evict cache",
+                                                      "expunge",
+                                                      "flush",
+                                                      "insert",
+                                                      "mark dirty",
+                                                      "mark clean",
+                                                      "mark unserialized",
+                                                      "mark serialized",
+                                                      "move",
+                                                      "pin",
+                                                      "create flush dep",
+                                                      "protect",
+                                                      "resize",
+                                                      "unpin",
+                                                      "destroy flush dep",
+                                                      "unprotect",
+                                                      "set config",
+                                                      "remove"};
+
+/* Names of the entry types, indexed by H5AC_type_t */
+static const char *type_names_g[H5AC_NTYPES] = {"B-tree node",
+                                                "symbol table node",
+                                                "local heap prefix",
+                                                "local heap data block",
+                                                "global heap",
+                                                "object header",
+                                                "object header chunk",
+                                                "v2 B-tree header",
+                                                "v2 B-tree internal node",
+                                                "v2 B-tree leaf node",
+                                                "fractal heap header",
+                                                "fractal heap direct block",
+                                                "fractal heap indirect block",
+                                                "free space header",
+                                                "free space sections",
+                                                "SOHM master table",
+                                                "SOHM list",
+                                                "extensible array header",
+                                                "extensible array index block",
+                                                "extensible array super block",
+                                                "extensible array data block",
+                                                "extensible array data block page",
+                                                "fixed array header",
+                                                "fixed array data block",
+                                                "fixed array data block page",
+                                                "superblock",
+                                                "driver info block",
+                                                "epoch marker",
+                                                "proxy entry",
+                                                "prefetched entry"};
+
+static char *   fname_g = NULL;
+static uint64_t sizes_g[MAX_SIZES];
+static unsigned nsizes_g = 0;
+
+/*
+ * Command-line options: The user can specify short or long-named
+ * parameters.
+ */
+static const char *        s_opts   = "hVs:";
+static struct long_options l_opts[] = {{"help", no_arg, 'h'},
+                                       {"hel", no_arg, 'h'},
+                                       {"he", no_arg, 'h'},
+                                       {"version", no_arg, 'V'},
+                                       {"versio", no_arg, 'V'},
+                                       {"versi", no_arg, 'V'},
+                                       {"vers", no_arg, 'V'},
+                                       {"sizes", require_arg, 's'},
+                                       {"size", require_arg, 's'},
+                                       {"siz", require_arg, 's'},
+                                       {"si", require_arg, 's'},
+                                       {NULL, 0, '\0'}};
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Prints a usage message
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS] log_file\n", prog);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "   -h, --help                Print a usage message and exit\n");
+    HDfprintf(stdout, "   -V, --version             Print version number and exit\n");
+    HDfprintf(stdout, "   -s L, --sizes=L           Replay the log against a cache of each of the\n");
+    HDfprintf(stdout, "                             maximum sizes in the comma separated list L and\n");
+    HDfprintf(stdout, "                             print the predicted protect hit rates.  Sizes\n");
+    HDfprintf(stdout, "                             are in bytes and may have a K, M or G suffix.\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "  log_file is a metadata cache log written in the binary format, see\n");
+    HDfprintf(stdout, "  H5Pset_mdc_log_options() and H5Pset_mdc_log_format().\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "Examples of use:\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "h5mdclog mdc.log\n");
+    HDfprintf(stdout, "  Summarize the cache operations recorded in mdc.log.\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "h5mdclog -s 1M,2M,4M,32M mdc.log\n");
+    HDfprintf(stdout, "  Also predict the hit rates of 1, 2, 4 and 32 MiB caches.\n");
+} /* usage() */
+
+/*-------------------------------------------------------------------------
+ * Function:    parse_sizes
+ *
+ * Purpose:     Parse a comma separated list of cache sizes into sizes_g
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+parse_sizes(const char *str)
+{
+    const char *p = str;
+
+    while (*p) {
+        char *             end;
+        unsigned long long size;
+
+        if (nsizes_g == MAX_SIZES) {
+            error_msg("too many cache sizes (at most %d)\n", MAX_SIZES);
+            return -1;
+        }
+
+        size = HDstrtoull(p, &end, 10);
+        if (end == p) {
+            error_msg("invalid cache size list \"%s\"\n", str);
+            return -1;
+        }
+        switch (*end) {
+            case 'k':
+            case 'K':
+                size *= 1024;
+                end++;
+                break;
+
+            case 'm':
+            case 'M':
+                size *= 1024 * 1024;
+                end++;
+                break;
+
+            case 'g':
+            case 'G':
+                size *= 1024 * 1024 * 1024;
+                end++;
+                break;
+
+            default:
+                break;
+        } /* end switch */
+        if (size == 0 || (*end != ',' && *end != '\0')) {
+            error_msg("invalid cache size list \"%s\"\n", str);
+            return -1;
+        }
+
+        sizes_g[nsizes_g++] = (uint64_t)size;
+        p                   = (*end == ',') ? end + 1 : end;
+    } /* end while */
+
+    return 0;
+} /* parse_sizes() */
+
+/*-------------------------------------------------------------------------
+ * Function:    parse_command_line
+ *
+ * Purpose:     Parses command line and sets up global variables
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+parse_command_line(int argc, const char **argv)
+{
+    int opt;
+
+    /* no arguments */
+    if (argc == 1) {
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    }
+
+    /* parse command line options */
+    while ((opt = get_option(argc, argv, s_opts, l_opts)) != EOF) {
+        switch ((char)opt) {
+            case 'h':
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 'V':
+                print_version(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 's':
+                if (parse_sizes(opt_arg) < 0) {
+                    h5tools_setstatus(EXIT_FAILURE);
+                    goto error;
+                }
+                break;
+
+            default:
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_FAILURE);
+                goto error;
+        } /* end switch */
+    }     /* end while */
+
+    /* check for file name to be processed */
+    if (argc <= opt_ind) {
+        error_msg("missing file name\n");
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    } /* end if */
+
+    fname_g = HDstrdup(argv[opt_ind]);
+
+done:
+    return 0;
+
+error:
+    return -1;
+} /* parse_command_line() */
+
+/*-------------------------------------------------------------------------
+ * Function:    read_log
+ *
+ * Purpose:     Read and decode all the records of a binary cache log
+ *
+ * Return:      Success:    0, with *records_out (to be freed by the
+ *                          caller) and *nrecords_out set
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+read_log(const char *name, mdclog_record_t **records_out, size_t *nrecords_out)
+{
+    FILE *           f = NULL;
+    uint8_t          header[H5C_LOG_BINARY_HEADER_SIZE];
+    uint8_t          buf[H5C_LOG_BINARY_RECORD_SIZE];
+    const uint8_t *  p;
+    unsigned         version;
+    unsigned         record_size;
+    mdclog_record_t *records  = NULL;
+    size_t           nalloc   = 0;
+    size_t           nrecords = 0;
+
+    if (NULL == (f = HDfopen(name, "rb"))) {
+        error_msg("unable to open log file \"%s\"\n", name);
+        goto error;
+    }
+
+    /* Check the header */
+    if (1 != HDfread(header, sizeof(header), 1, f) ||
+        HDmemcmp(header, H5C_LOG_BINARY_SIGNATURE, (size_t)H5C_LOG_BINARY_SIGNATURE_LEN) != 0) {
+        error_msg("\"%s\" is not a binary metadata cache log\n", name);
+        goto error;
+    }
+    p = header + H5C_LOG_BINARY_SIGNATURE_LEN;
+    UINT32DECODE(p, version);
+    UINT32DECODE(p, record_size);
+    if (version != H5C_LOG_BINARY_VERSION || record_size != H5C_LOG_BINARY_RECORD_SIZE) {
+        error_msg("unsupported log version %u (record size %u)\n", version, record_size);
+        goto error;
+    }
+
+    /* Decode the records.  A partial record at the end of the file (e.g. from
+     * an application that crashed) is ignored.
+     */
+    while (1 == HDfread(buf, sizeof(buf), 1, f)) {
+        mdclog_record_t *rec;
+
+        if (nrecords == nalloc) {
+            mdclog_record_t *tmp;
+
+            nalloc = nalloc ? 2 * nalloc : 4096;
+            if (NULL == (tmp = (mdclog_record_t *)HDrealloc(records, nalloc * sizeof(mdclog_record_t)))) {
+                error_msg("unable to allocate memory for log records\n");
+                goto error;
+            }
+            records = tmp;
+        }
+        rec = &records[nrecords++];
+
+        p = buf;
+        UINT64DECODE(p, rec->timestamp);
+        UINT64DECODE(p, rec->addr);
+        UINT64DECODE(p, rec->value);
+        rec->op      = *p++;
+        rec->type_id = *p++;
+        rec->status  = *p++;
+        p++; /* reserved */
+        UINT32DECODE(p, rec->flags);
+    } /* end while */
+
+    HDfclose(f);
+
+    *records_out  = records;
+    *nrecords_out = nrecords;
+    return 0;
+
+error:
+    if (f)
+        HDfclose(f);
+    if (records)
+        HDfree(records);
+    return -1;
+} /* read_log() */
+
+/*-------------------------------------------------------------------------
+ * Function:    print_summary
+ *
+ * Purpose:     Print the number of operations of each kind and the
+ *              protects per entry type recorded in the log
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+print_summary(const mdclog_record_t *records, size_t nrecords)
+{
+    uint64_t op_count[H5C_LOG_BINARY_NOPS];
+    uint64_t op_failed[H5C_LOG_BINARY_NOPS];
+    uint64_t type_protects[H5AC_NTYPES];
+    uint64_t type_hits[H5AC_NTYPES];
+    uint64_t protects = 0;
+    uint64_t hits     = 0;
+    uint64_t unknown  = 0;
+    size_t   u;
+
+    HDmemset(op_count, 0, sizeof(op_count));
+    HDmemset(op_failed, 0, sizeof(op_failed));
+    HDmemset(type_protects, 0, sizeof(type_protects));
+    HDmemset(type_hits, 0, sizeof(type_hits));
+
+    for (u = 0; u < nrecords; u++) {
+        const mdclog_record_t *rec = &records[u];
+
+        if (rec->op >= H5C_LOG_BINARY_NOPS) {
+            unknown++;
+            continue;
+        }
+        op_count[rec->op]++;
+        if (rec->status & H5C_LOG_BINARY_FAILED)
+            op_failed[rec->op]++;
+        else if (rec->op == H5C_LOG_BINARY_PROTECT) {
+            hbool_t hit = (rec->status & H5C_LOG_BINARY_HIT) ? TRUE : FALSE;
+
+            protects++;
+            if (hit)
+                hits++;
+            if (rec->type_id < H5AC_NTYPES) {
+                type_protects[rec->type_id]++;
+                if (hit)
+                    type_hits[rec->type_id]++;
+            }
+        }
+    } /* end for */
+
+    HDfprintf(stdout, "Records: %zu", nrecords);
+    if (nrecords > 1)
+        HDfprintf(stdout, " over %.3f seconds",
+                  (double)(records[nrecords - 1].timestamp - records[0].timestamp) / 1000000.0);
+    HDfprintf(stdout, "\n");
+    if (unknown)
+        HDfprintf(stdout, "Unknown records: %" PRIu64 "\n", unknown);
+
+    HDfprintf(stdout, "\nOperations:\n");
+    HDfprintf(stdout, "    %-20s %12s %12s\n", "operation", "count", "failed");
+    for (u = 0; u < H5C_LOG_BINARY_NOPS; u++)
+        if (op_count[u])
+            HDfprintf(stdout, "    %-20s %12" PRIu64 " %12" PRIu64 "\n", op_names_g[u], op_count[u],
+                      op_failed[u]);
+
+    HDfprintf(stdout, "\nProtects by entry type:\n");
+    HDfprintf(stdout, "    %-34s %12s %12s %9s\n", "entry type", "protects", "hits", "hit rate");
+    for (u = 0; u < H5AC_NTYPES; u++)
+        if (type_protects[u])
+            HDfprintf(stdout, "    %-34s %12" PRIu64 " %12" PRIu64 " %8.2f%%\n", type_names_g[u],
+                      type_protects[u], type_hits[u],
+                      100.0 * (double)type_hits[u] / (double)type_protects[u]);
+
+    HDfprintf(stdout, "\nLogged protect hit rate: ");
+    if (protects)
+        HDfprintf(stdout, "%.2f%% (%" PRIu64 " hits in %" PRIu64 " protects)\n",
+                  100.0 * (double)hits / (double)protects, hits, protects);
+    else
+        HDfprintf(stdout, "n/a (no protects)\n");
+} /* print_summary() */
+
+/*-------------------------------------------------------------------------
+ * Function:    sim_lru_remove / sim_lru_insert_head
+ *
+ * Purpose:     Maintain the replay model's LRU list of evictable entries
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+sim_lru_remove(sim_cache_t *cache, sim_entry_t *entry)
+{
+    if (!entry->in_lru)
+        return;
+
+    if (entry->prev)
+        entry->prev->next = entry->next;
+    else
+        cache->lru_head = entry->next;
+    if (entry->next)
+        entry->next->prev = entry->prev;
+    else
+        cache->lru_tail = entry->prev;
+    entry->prev   = NULL;
+    entry->next   = NULL;
+    entry->in_lru = FALSE;
+} /* sim_lru_remove() */
+
+static void
+sim_lru_insert_head(sim_cache_t *cache, sim_entry_t *entry)
+{
+    HDassert(!entry->in_lru);
+
+    entry->prev = NULL;
+    entry->next = cache->lru_head;
+    if (cache->lru_head)
+        cache->lru_head->prev = entry;
+    else
+        cache->lru_tail = entry;
+    cache->lru_head = entry;
+    entry->in_lru   = TRUE;
+} /* sim_lru_insert_head() */
+
+/*-------------------------------------------------------------------------
+ * Function:    sim_touch
+ *
+ * Purpose:     Make an entry the most recently used one if it can be
+ *              evicted, or take it off the LRU list if it can't
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+sim_touch(sim_cache_t *cache, sim_entry_t *entry)
+{
+    sim_lru_remove(cache, entry);
+    if (entry->protect_count == 0 && !entry->pinned)
+        sim_lru_insert_head(cache, entry);
+} /* sim_touch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    sim_find
+ *
+ * Purpose:     Look up a resident entry by address
+ *
+ * Return:      The entry, or NULL if it isn't resident
+ *
+ *-------------------------------------------------------------------------
+ */
+static sim_entry_t *
+sim_find(const sim_cache_t *cache, haddr_t addr)
+{
+    sim_entry_t *entry = cache->index[SIM_HASH_FCN(addr)];
+
+    while (entry && entry->addr != addr)
+        entry = entry->ht_next;
+
+    return entry;
+} /* sim_find() */
+
+/*-------------------------------------------------------------------------
+ * Function:    sim_unlink
+ *
+ * Purpose:     Remove an entry from the replay model's index and LRU list,
+ *              without freeing it
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+sim_unlink(sim_cache_t *cache, sim_entry_t *entry)
+{
+    sim_entry_t **pp = &cache->index[SIM_HASH_FCN(entry->addr)];
+
+    while (*pp != entry)
+        pp = &(*pp)->ht_next;
+    *pp            = entry->ht_next;
+    entry->ht_next = NULL;
+
+    sim_lru_remove(cache, entry);
+} /* sim_unlink() */
+
+/*-------------------------------------------------------------------------
+ * Function:    sim_remove
+ *
+ * Purpose:     Remove an entry from the replay model and free it
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+sim_remove(sim_cache_t *cache, sim_entry_t *entry)
+{
+    sim_unlink(cache, entry);
+    cache->index_size -= entry->size;
+    HDfree(entry);
+} /* sim_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    sim_make_space
+ *
+ * Purpose:     Evict least recently used entries until an entry of the
+ *              given size fits, or nothing more can be evicted
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+sim_make_space(sim_cache_t *cache, uint64_t space_needed)
+{
+    while (cache->lru_tail && cache->index_size + space_needed > cache->max_size) {
+        sim_remove(cache, cache->lru_tail);
+        cache->evictions++;
+    }
+} /* sim_make_space() */
+
+/*-------------------------------------------------------------------------
+ * Function:    sim_add
+ *
+ * Purpose:     Make space for and add a new entry to the replay model
+ *
+ * Return:      Success:    The new entry
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static sim_entry_t *
+sim_add(sim_cache_t *cache, haddr_t addr, uint64_t size)
+{
+    sim_entry_t *entry;
+    size_t       bucket = SIM_HASH_FCN(addr);
+
+    sim_make_space(cache, size);
+
+    if (NULL == (entry = (sim_entry_t *)HDcalloc(1, sizeof(sim_entry_t))))
+        return NULL;
+    entry->addr          = addr;
+    entry->size          = size;
+    entry->ht_next       = cache->index[bucket];
+    cache->index[bucket] = entry;
+    cache->index_size += size;
+    if (cache->index_size > cache->peak_size)
+        cache->peak_size = cache->index_size;
+
+    return entry;
+} /* sim_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    sim_clear
+ *
+ * Purpose:     Remove entries from the replay model: all of them, or only
+ *              those that are neither pinned nor protected
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+sim_clear(sim_cache_t *cache, hbool_t all)
+{
+    size_t u;
+
+    for (u = 0; u < SIM_HASH_TABLE_LEN; u++) {
+        sim_entry_t *entry = cache->index[u];
+
+        while (entry) {
+            sim_entry_t *next = entry->ht_next;
+
+            if (all || (entry->protect_count == 0 && !entry->pinned))
+                sim_remove(cache, entry);
+            entry = next;
+        }
+    } /* end for */
+} /* sim_clear() */
+
+/*-------------------------------------------------------------------------
+ * Function:    replay
+ *
+ * Purpose:     Replay the log against a model of the metadata cache with
+ *              the given maximum size.
+ *
+ *              The model is an LRU cache of the logged entries that
+ *              honors entry sizes, pins, protects, moves, resizes and
+ *              removals, like H5C.  It doesn't model the automatic cache
+ *              resizing, the flushing of dirty entries, or the clean and
+ *              dirty LRU lists of H5C, so its results are a prediction.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+replay(const mdclog_record_t *records, size_t nrecords, sim_cache_t *cache)
+{
+    size_t u;
+
+    for (u = 0; u < nrecords; u++) {
+        const mdclog_record_t *rec = &records[u];
+        sim_entry_t *          entry;
+
+        /* Failed operations didn't change the cache */
+        if (rec->status & H5C_LOG_BINARY_FAILED)
+            continue;
+
+        switch (rec->op) {
+            case H5C_LOG_BINARY_INSERT:
+                if (NULL == (entry = sim_find(cache, rec->addr))) {
+                    if (NULL == (entry = sim_add(cache, rec->addr, rec->value)))
+                        return -1;
+                }
+                if (rec->flags & H5C__PIN_ENTRY_FLAG)
+                    entry->pinned = TRUE;
+                sim_touch(cache, entry);
+                break;
+
+            case H5C_LOG_BINARY_PROTECT:
+                cache->accesses++;
+                if (NULL != (entry = sim_find(cache, rec->addr))) {
+                    cache->hits++;
+                    if (rec->value != entry->size) {
+                        cache->index_size = cache->index_size - entry->size + rec->value;
+                        entry->size       = rec->value;
+                    }
+                }
+                else if (NULL == (entry = sim_add(cache, rec->addr, rec->value)))
+                    return -1;
+                entry->protect_count++;
+                sim_touch(cache, entry);
+                break;
+
+            case H5C_LOG_BINARY_UNPROTECT:
+                if (NULL != (entry = sim_find(cache, rec->addr))) {
+                    if (entry->protect_count > 0)
+                        entry->protect_count--;
+                    if (rec->flags & H5C__DELETED_FLAG)
+                        sim_remove(cache, entry);
+                    else {
+                        if (rec->flags & H5C__PIN_ENTRY_FLAG)
+                            entry->pinned = TRUE;
+                        if (rec->flags & H5C__UNPIN_ENTRY_FLAG)
+                            entry->pinned = FALSE;
+                        sim_touch(cache, entry);
+                    }
+                    sim_make_space(cache, 0);
+                }
+                break;
+
+            case H5C_LOG_BINARY_PIN:
+                if (NULL != (entry = sim_find(cache, rec->addr))) {
+                    entry->pinned = TRUE;
+                    sim_touch(cache, entry);
+                }
+                break;
+
+            case H5C_LOG_BINARY_UNPIN:
+                if (NULL != (entry = sim_find(cache, rec->addr))) {
+                    entry->pinned = FALSE;
+                    sim_touch(cache, entry);
+                    sim_make_space(cache, 0);
+                }
+                break;
+
+            case H5C_LOG_BINARY_RESIZE:
+                if (NULL != (entry = sim_find(cache, rec->addr))) {
+                    cache->index_size = cache->index_size - entry->size + rec->value;
+                    entry->size       = rec->value;
+                    if (cache->index_size > cache->peak_size)
+                        cache->peak_size = cache->index_size;
+                }
+                break;
+
+            case H5C_LOG_BINARY_MOVE:
+                if ((haddr_t)rec->value != rec->addr && NULL != (entry = sim_find(cache, rec->addr))) {
+                    size_t       bucket = SIM_HASH_FCN((haddr_t)rec->value);
+                    sim_entry_t *stale;
+
+                    /* Drop any entry the model still holds at the new
+                     * address, e.g. one the logged cache had evicted but a
+                     * larger model kept, so it can't shadow the moved entry */
+                    if (NULL != (stale = sim_find(cache, (haddr_t)rec->value)))
+                        sim_remove(cache, stale);
+
+                    sim_unlink(cache, entry);
+                    entry->addr          = (haddr_t)rec->value;
+                    entry->ht_next       = cache->index[bucket];
+                    cache->index[bucket] = entry;
+                    sim_touch(cache, entry);
+                }
+                break;
+
+            case H5C_LOG_BINARY_EXPUNGE:
+            case H5C_LOG_BINARY_REMOVE:
+                if (NULL != (entry = sim_find(cache, rec->addr)))
+                    sim_remove(cache, entry);
+                break;
+
+            case H5C_LOG_BINARY_EVICT_CACHE:
+                sim_clear(cache, FALSE);
+                break;
+
+            case H5C_LOG_BINARY_DESTROY_CACHE:
+                sim_clear(cache, TRUE);
+                break;
+
+            default:
+                /* No effect on residency */
+                break;
+        } /* end switch */
+    }     /* end for */
+
+    return 0;
+} /* replay() */
+
+/*-------------------------------------------------------------------------
+ * Function:    leave
+ *
+ * Purpose:     Close the tools library and exit
+ *
+ * Return:      Does not return
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+leave(int ret)
+{
+    h5tools_close();
+    HDexit(ret);
+} /* leave() */
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Summarize a binary metadata cache log and, with -s, predict
+ *              the hit rates of other cache sizes by replaying it
+ *
+ * Return:      Success: 0
+ *              Failure: 1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, const char *argv[])
+{
+    mdclog_record_t *records  = NULL;
+    size_t           nrecords = 0;
+    sim_cache_t      cache;
+    unsigned         u;
+
+    h5tools_setprogname(PROGRAMNAME);
+    h5tools_setstatus(EXIT_SUCCESS);
+
+    /* initialize h5tools lib */
+    h5tools_init();
+
+    HDmemset(&cache, 0, sizeof(cache));
+
+    /* Parse command line options */
+    if (parse_command_line(argc, argv) < 0)
+        goto done;
+
+    if (fname_g == NULL)
+        goto done;
+
+    if (read_log(fname_g, &records, &nrecords) < 0) {
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+
+    HDfprintf(stdout, "File: %s\n", fname_g);
+    print_summary(records, nrecords);
+
+    if (nsizes_g > 0) {
+        if (NULL == (cache.index = (sim_entry_t **)HDcalloc(SIM_HASH_TABLE_LEN, sizeof(sim_entry_t *)))) {
+            error_msg("unable to allocate memory for the cache model\n");
+            h5tools_setstatus(EXIT_FAILURE);
+            goto done;
+        }
+
+        HDfprintf(stdout, "\nReplay (LRU model of the metadata cache):\n");
+        HDfprintf(stdout, "    %14s %12s %12s %9s %12s %14s\n", "max size", "protects", "hits", "hit rate",
+                  "evictions", "peak size");
+        for (u = 0; u < nsizes_g; u++) {
+            cache.max_size = sizes_g[u];
+            if (replay(records, nrecords, &cache) < 0) {
+                error_msg("unable to allocate memory for the cache model\n");
+                h5tools_setstatus(EXIT_FAILURE);
+                goto done;
+            }
+            HDfprintf(stdout, "    %14" PRIu64 " %12" PRIu64 " %12" PRIu64 " ", cache.max_size,
+                      cache.accesses, cache.hits);
+            if (cache.accesses)
+                HDfprintf(stdout, "%8.2f%%", 100.0 * (double)cache.hits / (double)cache.accesses);
+            else
+                HDfprintf(stdout, "%9s", "n/a");
+            HDfprintf(stdout, " %12" PRIu64 " %14" PRIu64 "\n", cache.evictions, cache.peak_size);
+
+            /* Reset the model for the next size */
+            sim_clear(&cache, TRUE);
+            cache.index_size = cache.peak_size = 0;
+            cache.accesses = cache.hits = cache.evictions = 0;
+        } /* end for */
+    }     /* end if */
+
+done:
+    if (cache.index) {
+        sim_clear(&cache, TRUE);
+        HDfree(cache.index);
+    }
+    if (records)
+        HDfree(records);
+    if (fname_g)
+        HDfree(fname_g);
+
+    leave(h5tools_getstatus());
+} /* main() */
@@ -0,0 +1,68 @@
+#
+# Copyright by The HDF Group.
+# All rights reserved.
+#
+# This file is part of HDF5.  The full HDF5 copyright notice, including
+# terms governing use, modification, and redistribution, is contained in
+# the COPYING file, which can be found at the root of the source code
+# distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.
+# If you do not have access to either file, you may request a copy from
+# help@hdfgroup.org.
+#
+
+##############################################################################
+##############################################################################
+###           T E S T I N G                                                ###
+##############################################################################
+##############################################################################
+
+  # The binary log of the log VFD is written by the vfd test (H5TEST-vfd),
+  # which sets up the vfd_binary_log fixture
+  set (H5FDLOG_LOG_FILE "${HDF5_TEST_BINARY_DIR}/H5TEST/log_vfd_out.bin")
+
+  # make test dir
+  file (MAKE_DIRECTORY "${PROJECT_BINARY_DIR}/testfiles")
+
+##############################################################################
+##############################################################################
+###           T H E   T E S T S  M A C R O S                               ###
+##############################################################################
+##############################################################################
+
+  macro (ADD_H5FDLOG_TEST resultfile result_check)
+    if (HDF5_ENABLE_USING_MEMCHECKER)
+      add_test (
+          NAME H5FDLOG-${resultfile}
+          COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:h5fdlog${tgt_file_ext}> ${ARGN}
+      )
+    else ()
+      add_test (
+          NAME H5FDLOG-${resultfile}
+          COMMAND "${CMAKE_COMMAND}"
+              -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+              -D "TEST_PROGRAM=$<TARGET_FILE:h5fdlog${tgt_file_ext}>"
+              -D "TEST_ARGS:STRING=${ARGN}"
+              -D "TEST_FOLDER=${PROJECT_BINARY_DIR}/testfiles"
+              -D "TEST_OUTPUT=${resultfile}.out"
+              -D "TEST_EXPECT=0"
+              -D "TEST_REFERENCE=${result_check}"
+              -P "${HDF_RESOURCES_EXT_DIR}/grepTest.cmake"
+      )
+    endif ()
+    set_tests_properties (H5FDLOG-${resultfile} PROPERTIES
+        FIXTURES_REQUIRED vfd_binary_log
+        WORKING_DIRECTORY "${PROJECT_BINARY_DIR}/testfiles"
+    )
+  endmacro ()
+
+##############################################################################
+##############################################################################
+###           T H E   T E S T S                                            ###
+##############################################################################
+##############################################################################
+
+  # The logged run writes one 4 KiB block of raw data
+  ADD_H5FDLOG_TEST (h5fdlog_summary "draw                1      4.00 KiB" ${H5FDLOG_LOG_FILE})
+
+  # The whole file fits in one 1 MiB block of the hot spot report
+  ADD_H5FDLOG_TEST (h5fdlog_hotspots " small reads/writes in 1 blocks" --block=1M ${H5FDLOG_LOG_FILE})
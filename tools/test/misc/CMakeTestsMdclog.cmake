@@ -0,0 +1,81 @@
+#
+# Copyright by The HDF Group.
+# All rights reserved.
+#
+# This file is part of HDF5.  The full HDF5 copyright notice, including
+# terms governing use, modification, and redistribution, is contained in
+# the COPYING file, which can be found at the root of the source code
+# distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.
+# If you do not have access to either file, you may request a copy from
+# help@hdfgroup.org.
+#
+
+##############################################################################
+##############################################################################
+###           T E S T I N G                                                ###
+##############################################################################
+##############################################################################
+
+  # The binary metadata cache log is written by the cache_logging test
+  # (H5TEST-cache_logging), which sets up the mdc_binary_log fixture
+  set (H5MDCLOG_LOG_FILE "${HDF5_TEST_BINARY_DIR}/H5TEST/cache_logging.bin")
+  # The second log comes from a 1 KB cache, too small for the file's metadata
+  set (H5MDCLOG_EVICT_LOG_FILE "${HDF5_TEST_BINARY_DIR}/H5TEST/cache_logging_evict.bin")
+
+  # make test dir
+  file (MAKE_DIRECTORY "${PROJECT_BINARY_DIR}/testfiles")
+
+##############################################################################
+##############################################################################
+###           T H E   T E S T S  M A C R O S                               ###
+##############################################################################
+##############################################################################
+
+  macro (ADD_H5MDCLOG_TEST resultfile result_check)
+    if (HDF5_ENABLE_USING_MEMCHECKER)
+      add_test (
+          NAME H5MDCLOG-${resultfile}
+          COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:h5mdclog${tgt_file_ext}> ${ARGN}
+      )
+    else ()
+      add_test (
+          NAME H5MDCLOG-${resultfile}
+          COMMAND "${CMAKE_COMMAND}"
+              -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+              -D "TEST_PROGRAM=$<TARGET_FILE:h5mdclog${tgt_file_ext}>"
+              -D "TEST_ARGS:STRING=${ARGN}"
+              -D "TEST_FOLDER=${PROJECT_BINARY_DIR}/testfiles"
+              -D "TEST_OUTPUT=${resultfile}.out"
+              -D "TEST_EXPECT=0"
+              -D "TEST_REFERENCE=${result_check}"
+              -P "${HDF_RESOURCES_EXT_DIR}/grepTest.cmake"
+      )
+    endif ()
+    set_tests_properties (H5MDCLOG-${resultfile} PROPERTIES
+        FIXTURES_REQUIRED mdc_binary_log
+        WORKING_DIRECTORY "${PROJECT_BINARY_DIR}/testfiles"
+    )
+  endmacro ()
+
+##############################################################################
+##############################################################################
+###           T H E   T E S T S                                            ###
+##############################################################################
+##############################################################################
+
+  # The logged run never misses in the cache
+  ADD_H5MDCLOG_TEST (h5mdclog_summary "Logged protect hit rate: 100.00%" ${H5MDCLOG_LOG_FILE})
+
+  # Replayed against a cache large enough to hold every entry, all protects
+  # must hit and nothing is evicted.  The log includes moved entries, which
+  # are then only found if the model relinks them under the new address.
+  ADD_H5MDCLOG_TEST (h5mdclog_replay "100.00%            0" --sizes=1G ${H5MDCLOG_LOG_FILE})
+
+  # The small cache misses on about half of its protects, and the log holds
+  # the single eviction of the whole cache
+  ADD_H5MDCLOG_TEST (h5mdclog_evict_summary "Logged protect hit rate: 50.15%" ${H5MDCLOG_EVICT_LOG_FILE})
+  ADD_H5MDCLOG_TEST (h5mdclog_evict_ops "evict cache                     1            0" ${H5MDCLOG_EVICT_LOG_FILE})
+
+  # Replayed at the logged size, the model evicts entries and predicts the
+  # logged hit rate
+  ADD_H5MDCLOG_TEST (h5mdclog_evict_replay "1024         2393         1200    50.15%         1187" --sizes=1K ${H5MDCLOG_EVICT_LOG_FILE})
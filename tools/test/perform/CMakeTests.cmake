@@ -50,6 +50,8 @@ if (HDF5_TEST_SERIAL)
           zip_perf-h.txt.err
           zip_perf.txt
           zip_perf.txt.err
+          filter_perf.txt
+          filter_perf.txt.err
   )
 
   if (HDF5_ENABLE_USING_MEMCHECKER)
@@ -189,6 +191,25 @@ if (HDF5_TEST_SERIAL)
   set_tests_properties (PERFORM_zip_perf PROPERTIES
       DEPENDS "PERFORM_zip_perf_help;PERFORM_h5perform-clearall-objects"
   )
+
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_filter_perf COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:filter_perf> -s 4)
+  else ()
+    add_test (NAME PERFORM_filter_perf COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:filter_perf>"
+        -D "TEST_ARGS:STRING=-s;4"
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=filter_perf.txt"
+        #-D "TEST_REFERENCE=filter_perf.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_filter_perf PROPERTIES
+      DEPENDS "PERFORM_h5perform-clearall-objects"
+  )
 endif ()
 
 if (H5_HAVE_PARALLEL AND HDF5_TEST_PARALLEL)
@@ -0,0 +1,291 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *  Purpose: check the speed of the N-bit and scale-offset filters on
+ *           integer and floating-point data.  The datasets are written
+ *           to and read from a file held in memory, so the times are
+ *           those of the filters rather than of the storage.
+ */
+#include "hdf5.h"
+#include "H5private.h"
+
+#define FILENAME "filter_perf.h5"
+
+/* Default amount of data written to each dataset, in MB */
+#define DATA_SIZE_MB 64
+
+/* Size of each chunk, in bytes */
+#define CHUNK_SIZE (1024 * 1024)
+
+#define ONE_MB (1024.0 * 1024.0)
+
+/* Filters */
+typedef enum { FILTER_NBIT, FILTER_SO_INT, FILTER_SO_FLOAT } filter_t;
+
+/* Description of one test */
+typedef struct {
+    const char *name;      /* Description */
+    filter_t    filter;    /* Filter to use */
+    hid_t       mem_type;  /* Memory datatype */
+    hid_t       base_type; /* Base of the dataset datatype */
+    size_t      precision; /* N-bit: precision of the dataset datatype */
+    size_t      offset;    /* N-bit: offset of the dataset datatype */
+    int         scale;     /* Scale-offset: scale factor */
+    unsigned    bits;      /* Number of significant bits in the data */
+} test_t;
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Print a usage message and exit.
+ *
+ * Return:      Doesn't return
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    HDfprintf(stdout, "usage: %s [-s MB]\n", prog);
+    HDfprintf(stdout, "    -s MB   amount of data written to each dataset [default: %d]\n", DATA_SIZE_MB);
+    HDfprintf(stdout, "    -h      print this message\n");
+    HDexit(EXIT_SUCCESS);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    fill_data
+ *
+ * Purpose:     Fill BUF with NELMTS pseudo-random values of the test's
+ *              memory datatype, with BITS significant bits.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+fill_data(const test_t *test, void *buf, size_t nelmts)
+{
+    unsigned long long seed = 1;
+    unsigned long long mask = (test->bits < 64) ? ((1ULL << test->bits) - 1) : ~0ULL;
+    size_t             size = H5Tget_size(test->mem_type);
+    size_t             u;
+
+    for (u = 0; u < nelmts; u++) {
+        unsigned long long val;
+
+        /* A smooth signal with some noise, like a sensor's */
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        val  = (((u / 16) + (seed >> 60)) & mask) << test->offset;
+
+        if (test->filter == FILTER_SO_FLOAT) {
+            if (size == sizeof(float))
+                ((float *)buf)[u] = (float)val / 100.0F;
+            else
+                ((double *)buf)[u] = (double)val / 100.0;
+        }
+        else if (size == 1)
+            ((uint8_t *)buf)[u] = (uint8_t)val;
+        else if (size == 2)
+            ((uint16_t *)buf)[u] = (uint16_t)val;
+        else if (size == 4)
+            ((uint32_t *)buf)[u] = (uint32_t)val;
+        else
+            ((uint64_t *)buf)[u] = (uint64_t)val;
+    }
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    run_test
+ *
+ * Purpose:     Write and read back one dataset, and print the times and
+ *              compression ratio.
+ *
+ * Return:      0 on success, -1 on failure
+ *-------------------------------------------------------------------------
+ */
+static int
+run_test(hid_t fid, const test_t *test, size_t data_size)
+{
+    size_t  size   = H5Tget_size(test->mem_type);
+    size_t  nelmts = data_size / size;
+    hsize_t dims[1];
+    hsize_t chunk_dims[1];
+    hid_t   file_type = H5I_INVALID_HID;
+    hid_t   mem_type  = test->mem_type;
+    hid_t   sid       = H5I_INVALID_HID;
+    hid_t   dcpl      = H5I_INVALID_HID;
+    hid_t   did       = H5I_INVALID_HID;
+    void *  wbuf      = NULL;
+    void *  rbuf      = NULL;
+    double  start, write_time, read_time;
+    hsize_t storage_size;
+
+    dims[0]       = (hsize_t)nelmts;
+    chunk_dims[0] = (hsize_t)(CHUNK_SIZE / size);
+
+    if (NULL == (wbuf = HDmalloc(nelmts * size)) || NULL == (rbuf = HDmalloc(nelmts * size)))
+        goto error;
+    fill_data(test, wbuf, nelmts);
+
+    if ((file_type = H5Tcopy(test->base_type)) < 0)
+        goto error;
+    if (test->filter == FILTER_NBIT) {
+        if (H5Tset_precision(file_type, test->precision) < 0 || H5Tset_offset(file_type, test->offset) < 0)
+            goto error;
+
+        /* Leave out the time to convert to and from a native type */
+        mem_type = file_type;
+    }
+
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dcpl, 1, chunk_dims) < 0)
+        goto error;
+    if (test->filter == FILTER_NBIT) {
+        if (H5Pset_nbit(dcpl) < 0)
+            goto error;
+    }
+    else if (H5Pset_scaleoffset(dcpl, test->filter == FILTER_SO_INT ? H5Z_SO_INT : H5Z_SO_FLOAT_DSCALE,
+                                test->scale) < 0)
+        goto error;
+
+    if ((did = H5Dcreate2(fid, test->name, file_type, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+
+    start = H5_get_time();
+    if (H5Dwrite(did, mem_type, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        goto error;
+    if (H5Fflush(fid, H5F_SCOPE_LOCAL) < 0)
+        goto error;
+    write_time = H5_get_time() - start;
+
+    /* Evict the chunks so that they're read back through the filter */
+    if (H5Dclose(did) < 0)
+        goto error;
+    if ((did = H5Dopen2(fid, test->name, H5P_DEFAULT)) < 0)
+        goto error;
+
+    start = H5_get_time();
+    if (H5Dread(did, mem_type, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        goto error;
+    read_time = H5_get_time() - start;
+
+    /* Integers come back unchanged */
+    if (test->filter != FILTER_SO_FLOAT && HDmemcmp(wbuf, rbuf, nelmts * size) != 0) {
+        HDfprintf(stderr, "%s: data read back differs from data written\n", test->name);
+        goto error;
+    }
+
+    storage_size = H5Dget_storage_size(did);
+
+    HDfprintf(stdout, "%-32s %8.2f %12.2f %12.2f\n", test->name,
+              (double)(nelmts * size) / (double)MAX(storage_size, 1),
+              (double)(nelmts * size) / ONE_MB / MAX(write_time, 1e-9),
+              (double)(nelmts * size) / ONE_MB / MAX(read_time, 1e-9));
+
+    H5Dclose(did);
+    H5Pclose(dcpl);
+    H5Sclose(sid);
+    H5Tclose(file_type);
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Tclose(file_type);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return -1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Run each test and print a table of results.
+ *
+ * Return:      EXIT_SUCCESS or EXIT_FAILURE
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    test_t tests[] = {
+        {"nbit int8, 5 bits", FILTER_NBIT, H5T_NATIVE_UINT8, H5T_STD_U8LE, 5, 0, 0, 5},
+        {"nbit int16, 12 bits", FILTER_NBIT, H5T_NATIVE_UINT16, H5T_STD_U16LE, 12, 0, 0, 12},
+        {"nbit int16, 10 bits at 2", FILTER_NBIT, H5T_NATIVE_UINT16, H5T_STD_U16LE, 10, 2, 0, 10},
+        {"nbit int32, 20 bits", FILTER_NBIT, H5T_NATIVE_UINT32, H5T_STD_U32LE, 20, 0, 0, 20},
+        {"nbit int32, 16 bits", FILTER_NBIT, H5T_NATIVE_UINT32, H5T_STD_U32LE, 16, 0, 0, 16},
+        {"nbit int64, 40 bits", FILTER_NBIT, H5T_NATIVE_UINT64, H5T_STD_U64LE, 40, 0, 0, 40},
+        {"scaleoffset int16", FILTER_SO_INT, H5T_NATIVE_UINT16, H5T_STD_U16LE, 0, 0, 0, 11},
+        {"scaleoffset int32", FILTER_SO_INT, H5T_NATIVE_UINT32, H5T_STD_U32LE, 0, 0, 0, 14},
+        {"scaleoffset int64", FILTER_SO_INT, H5T_NATIVE_UINT64, H5T_STD_U64LE, 0, 0, 0, 21},
+        {"scaleoffset float, D=2", FILTER_SO_FLOAT, H5T_NATIVE_FLOAT, H5T_IEEE_F32LE, 0, 0, 2, 16},
+        {"scaleoffset double, D=2", FILTER_SO_FLOAT, H5T_NATIVE_DOUBLE, H5T_IEEE_F64LE, 0, 0, 2, 24},
+    };
+    size_t   data_size = (size_t)DATA_SIZE_MB * 1024 * 1024;
+    hid_t    fapl      = H5I_INVALID_HID;
+    hid_t    fid       = H5I_INVALID_HID;
+    int      nerrors   = 0;
+    unsigned u;
+    int      i;
+
+    for (i = 1; i < argc; i++) {
+        if (!HDstrcmp(argv[i], "-s") && i + 1 < argc && HDatoi(argv[i + 1]) > 0)
+            data_size = (size_t)HDatoi(argv[++i]) * 1024 * 1024;
+        else
+            usage(argv[0]);
+    }
+
+    /* Keep the file in memory */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto error;
+    if (H5Pset_fapl_core(fapl, (size_t)(16 * 1024 * 1024), FALSE) < 0)
+        goto error;
+    if ((fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+
+    HDfprintf(stdout, "Data size: %zu MB, chunk size: %d KB\n\n", data_size / (1024 * 1024),
+              CHUNK_SIZE / 1024);
+    HDfprintf(stdout, "%-32s %8s %12s %12s\n", "Test", "Ratio", "Write MB/s", "Read MB/s");
+    for (u = 0; u < NELMTS(tests); u++)
+        if (run_test(fid, &tests[u], data_size) < 0) {
+            HDfprintf(stderr, "%s: failed\n", tests[u].name);
+            nerrors++;
+        }
+
+    if (H5Fclose(fid) < 0)
+        goto error;
+    if (H5Pclose(fapl) < 0)
+        goto error;
+
+    return nerrors ? EXIT_FAILURE : EXIT_SUCCESS;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+
+    return EXIT_FAILURE;
+}
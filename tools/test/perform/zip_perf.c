@@ -12,11 +12,10 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 /* ===========================================================================
- * Usage:  zip_perf [-d] [-f] [-h] [-1 to -9] [files...]
- *   -d : decompress
- *   -f : compress with Z_FILTERED
- *   -h : compress with Z_HUFFMAN_ONLY
- *   -1 to -9 : compression level
+ * Usage:  zip_perf [-h] [-z codec] [-0 to -9] [options...]
+ *   -h : print usage
+ *   -z : compression library to use (deflate, lz4 or zstd)
+ *   -0 to -9 : compression level
  */
 
 /* our header files */
@@ -24,9 +23,17 @@
 #include "h5tools.h"
 #include "h5tools_utils.h"
 
-#ifdef H5_HAVE_FILTER_DEFLATE
+#if defined(H5_HAVE_FILTER_DEFLATE) || defined(H5_HAVE_FILTER_LZ4) || defined(H5_HAVE_FILTER_ZSTD)
 
+#ifdef H5_HAVE_FILTER_DEFLATE
 #include <zlib.h>
+#endif
+#ifdef H5_HAVE_FILTER_LZ4
+#include <lz4.h>
+#endif
+#ifdef H5_HAVE_FILTER_ZSTD
+#include <zstd.h>
+#endif
 
 #define ONE_KB 1024
 #define ONE_MB (ONE_KB * ONE_KB)
@@ -50,23 +57,43 @@
 #define S_IRWXU (_S_IREAD | _S_IWRITE)
 #endif
 
+/* compression libraries */
+typedef enum { ZIP_DEFLATE, ZIP_LZ4, ZIP_ZSTD } zip_codec_t;
+
+static const char *codec_names[] = {"deflate", "lz4", "zstd"};
+
 /* internal variables */
 static const char *prog             = NULL;
 static const char *option_prefix    = NULL;
 static char *      filename         = NULL;
 static int         compress_percent = 0;
-static int         compress_level   = Z_DEFAULT_COMPRESSION;
+static int         compress_level   = -1; /* -1 for the library's default level */
 static int         output, random_test = FALSE;
 static int         report_once_flag;
 static double      compression_time;
+static double      decompression_time;
+#if defined(H5_HAVE_FILTER_DEFLATE)
+static zip_codec_t codec = ZIP_DEFLATE;
+#elif defined(H5_HAVE_FILTER_ZSTD)
+static zip_codec_t codec = ZIP_ZSTD;
+#else
+static zip_codec_t codec = ZIP_LZ4;
+#endif
 
 /* internal functions */
-static void error(const char *fmt, ...);
-static void compress_buffer(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen);
+static void   error(const char *fmt, ...);
+static size_t compress_bound(size_t sourceLen);
+static void   compress_buffer(unsigned char *dest, size_t *destLen, const unsigned char *source,
+                              size_t sourceLen);
+static void   uncompress_buffer(unsigned char *dest, size_t destLen, const unsigned char *source,
+                                size_t sourceLen);
 
 /* commandline options : long and short form */
-static const char *        s_opts   = "hB:b:c:p:rs:0123456789";
+static const char *        s_opts   = "hB:b:c:p:rs:z:0123456789";
 static struct long_options l_opts[] = {{"help", no_arg, 'h'},
+                                       {"codec", require_arg, 'z'},
+                                       {"code", require_arg, 'z'},
+                                       {"cod", require_arg, 'z'},
                                        {"compressability", require_arg, 'c'},
                                        {"compressabilit", require_arg, 'c'},
                                        {"compressabili", require_arg, 'c'},
@@ -161,18 +188,17 @@ cleanup(void)
 }
 
 static void
-write_file(Bytef *source, uLongf sourceLen)
+write_file(unsigned char *source, size_t sourceLen)
 {
-    Bytef *        d_ptr, *dest;
-    uLongf         d_len, destLen;
+    unsigned char *d_ptr, *dest, *check;
+    size_t         d_len, destLen;
     struct timeval timer_start, timer_stop;
 
-    /* destination buffer needs to be at least 0.1% larger than sourceLen
-     * plus 12 bytes */
-    destLen = (uLongf)((double)sourceLen + ((double)sourceLen * (double)0.1F)) + 12;
-    dest    = (Bytef *)HDmalloc(destLen);
+    destLen = compress_bound(sourceLen);
+    dest    = (unsigned char *)HDmalloc(destLen);
+    check   = (unsigned char *)HDmalloc(sourceLen);
 
-    if (!dest)
+    if (!dest || !check)
         error("out of memory");
 
     HDgettimeofday(&timer_start, NULL);
@@ -182,7 +208,20 @@ write_file(Bytef *source, uLongf sourceLen)
     compression_time += ((double)timer_stop.tv_sec + ((double)timer_stop.tv_usec) / (double)MICROSECOND) -
                         ((double)timer_start.tv_sec + ((double)timer_start.tv_usec) / (double)MICROSECOND);
 
+    /* time reading the data back, since readers see the decompression speed */
+    HDgettimeofday(&timer_start, NULL);
+    uncompress_buffer(check, sourceLen, dest, destLen);
+    HDgettimeofday(&timer_stop, NULL);
+
+    decompression_time += ((double)timer_stop.tv_sec + ((double)timer_stop.tv_usec) / (double)MICROSECOND) -
+                          ((double)timer_start.tv_sec + ((double)timer_start.tv_usec) / (double)MICROSECOND);
+
     if (report_once_flag) {
+        if (HDmemcmp(check, source, sourceLen) != 0) {
+            cleanup();
+            error("decompressed data differs from the original data");
+        }
+
         HDfprintf(stdout, "\tCompression Ratio: %g\n", ((double)destLen) / (double)sourceLen);
         report_once_flag = 0;
     }
@@ -204,64 +243,160 @@ write_file(Bytef *source, uLongf sourceLen)
         d_ptr += rc;
     }
 
+    HDfree(check);
     HDfree(dest);
 }
 
+/*
+ * Function:    compress_bound
+ * Purpose:     Get the largest size of the compressed data.
+ * Returns:     The size needed for the compressed buffer
+ */
+static size_t
+compress_bound(size_t sourceLen)
+{
+    switch (codec) {
+#ifdef H5_HAVE_FILTER_LZ4
+        case ZIP_LZ4:
+            return (size_t)LZ4_compressBound((int)sourceLen);
+#endif
+#ifdef H5_HAVE_FILTER_ZSTD
+        case ZIP_ZSTD:
+            return ZSTD_compressBound(sourceLen);
+#endif
+        case ZIP_DEFLATE:
+        default:
+            /* destination buffer needs to be at least 0.1% larger than sourceLen
+             * plus 12 bytes */
+            return (size_t)((double)sourceLen + ((double)sourceLen * (double)0.1F)) + 12;
+    }
+}
+
 /*
  * Function:    compress_buffer
- * Purpose:     Compress the buffer.
- * Returns:     Z_OK            - success
- *              Z_MEM_ERROR     - not enough memory
- *              Z_BUF_ERROR     - not enough room in the output buffer
- *              Z_STREAM_ERROR  - level parameter is invalid
+ * Purpose:     Compress the buffer with the selected library, exiting if
+ *              it fails.
+ * Returns:     Nothing
  * Programmer:  Bill Wendling, 05. June 2002
  * Modifications:
  */
 static void
-compress_buffer(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen)
+compress_buffer(unsigned char *dest, size_t *destLen, const unsigned char *source, size_t sourceLen)
 {
-    int rc = compress2(dest, destLen, source, sourceLen, compress_level);
+    switch (codec) {
+#ifdef H5_HAVE_FILTER_DEFLATE
+        case ZIP_DEFLATE: {
+            uLongf z_len = (uLongf)*destLen;
+            int    rc    = compress2(dest, &z_len, source, (uLong)sourceLen, compress_level);
+
+            if (rc != Z_OK) {
+                /* compress2 failed - cleanup and tell why */
+                cleanup();
+
+                switch (rc) {
+                    case Z_MEM_ERROR:
+                        error("not enough memory");
+                        break;
+                    case Z_BUF_ERROR:
+                        error("not enough room in the output buffer");
+                        break;
+                    case Z_STREAM_ERROR:
+                        error("level parameter (%d) is invalid", compress_level);
+                        break;
+                    default:
+                        error("unknown compression error");
+                        break;
+                }
+            }
 
-    if (rc != Z_OK) {
-        /* compress2 failed - cleanup and tell why */
-        cleanup();
+            *destLen = (size_t)z_len;
+            break;
+        }
+#endif
+#ifdef H5_HAVE_FILTER_LZ4
+        case ZIP_LZ4: {
+            int rc = LZ4_compress_default((const char *)source, (char *)dest, (int)sourceLen, (int)*destLen);
 
-        switch (rc) {
-            case Z_MEM_ERROR:
-                error("not enough memory");
-                break;
-            case Z_BUF_ERROR:
-                error("not enough room in the output buffer");
-                break;
-            case Z_STREAM_ERROR:
-                error("level parameter (%d) is invalid", compress_level);
-                break;
-            default:
-                error("unknown compression error");
-                break;
+            if (rc <= 0) {
+                cleanup();
+                error("LZ4 compression failed");
+            }
+
+            *destLen = (size_t)rc;
+            break;
         }
+#endif
+#ifdef H5_HAVE_FILTER_ZSTD
+        case ZIP_ZSTD: {
+            int    level = (compress_level < 0) ? 0 : compress_level;
+            size_t rc    = ZSTD_compress(dest, *destLen, source, sourceLen, level);
+
+            if (ZSTD_isError(rc)) {
+                cleanup();
+                error("Zstandard compression failed: %s", ZSTD_getErrorName(rc));
+            }
+
+            *destLen = rc;
+            break;
+        }
+#endif
+        default:
+            cleanup();
+            error("%s was not configured", codec_names[codec]);
+            break;
     }
 }
 
-#ifdef LATER
 /*
  * Function:    uncompress_buffer
- * Purpose:     Uncompress the buffer.
- * Returns:     Z_OK            - success
- *              Z_MEM_ERROR     - not enough memory
- *              Z_BUF_ERROR     - not enough room in the output buffer
- *              Z_DATA_ERROR    - the input data was corrupted
+ * Purpose:     Uncompress the buffer with the selected library, exiting if
+ *              it fails.
+ * Returns:     Nothing
  * Programmer:  Bill Wendling, 05. June 2002
  * Modifications:
  */
-static int
-uncompress_buffer(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen)
+static void
+uncompress_buffer(unsigned char *dest, size_t destLen, const unsigned char *source, size_t sourceLen)
 {
-    int rc = uncompress(dest, destLen, source, sourceLen);
+    size_t len = 0;
+
+    switch (codec) {
+#ifdef H5_HAVE_FILTER_DEFLATE
+        case ZIP_DEFLATE: {
+            uLongf z_len = (uLongf)destLen;
 
-    return rc;
+            if (uncompress(dest, &z_len, source, (uLong)sourceLen) == Z_OK)
+                len = (size_t)z_len;
+            break;
+        }
+#endif
+#ifdef H5_HAVE_FILTER_LZ4
+        case ZIP_LZ4: {
+            int rc = LZ4_decompress_safe((const char *)source, (char *)dest, (int)sourceLen, (int)destLen);
+
+            if (rc > 0)
+                len = (size_t)rc;
+            break;
+        }
+#endif
+#ifdef H5_HAVE_FILTER_ZSTD
+        case ZIP_ZSTD: {
+            size_t rc = ZSTD_decompress(dest, destLen, source, sourceLen);
+
+            if (!ZSTD_isError(rc))
+                len = rc;
+            break;
+        }
+#endif
+        default:
+            break;
+    }
+
+    if (len != destLen) {
+        cleanup();
+        error("%s decompression failed", codec_names[codec]);
+    }
 }
-#endif /* LATER */
 
 /*
  * Function:    get_unique_name
@@ -386,15 +521,15 @@ parse_size_directive(const char *size)
 }
 
 static void
-fill_with_random_data(Bytef *src, uLongf src_len)
+fill_with_random_data(unsigned char *src, size_t src_len)
 {
     register unsigned u;
     h5_stat_t         stat_buf;
 
     if (HDstat("/dev/urandom", &stat_buf) == 0) {
-        uLongf len = src_len;
-        Bytef *buf = src;
-        int    fd  = HDopen("/dev/urandom", O_RDONLY, 0);
+        size_t         len = src_len;
+        unsigned char *buf = src;
+        int            fd  = HDopen("/dev/urandom", O_RDONLY, 0);
 
         HDfprintf(stdout, "Using /dev/urandom for random data\n");
 
@@ -419,11 +554,11 @@ fill_with_random_data(Bytef *src, uLongf src_len)
         HDfprintf(stdout, "Using random() for random data\n");
 
         for (u = 0; u < src_len; ++u)
-            src[u] = (Bytef)(0xff & HDrandom());
+            src[u] = (unsigned char)(0xff & HDrandom());
     }
 
     if (compress_percent) {
-        size_t s = (size_t)((src_len * (uLongf)compress_percent) / 100);
+        size_t s = (src_len * (size_t)compress_percent) / 100;
 
         HDmemset(src, '\0', s);
     }
@@ -432,23 +567,24 @@ fill_with_random_data(Bytef *src, uLongf src_len)
 static void
 do_write_test(unsigned long file_size, unsigned long min_buf_size, unsigned long max_buf_size)
 {
-    uLongf         src_len, total_len;
+    size_t         src_len, total_len;
     struct timeval timer_start, timer_stop;
     double         total_time;
-    Bytef *        src;
+    unsigned char *src;
 
     for (src_len = min_buf_size; src_len <= max_buf_size; src_len <<= 1) {
         register unsigned long i, iters;
 
         iters = file_size / src_len;
-        src   = (Bytef *)HDcalloc(1, sizeof(Bytef) * src_len);
+        src   = (unsigned char *)HDcalloc(1, src_len);
 
         if (!src) {
             cleanup();
             error("out of memory");
         }
 
-        compression_time = 0.0F;
+        compression_time   = 0.0F;
+        decompression_time = 0.0F;
 
         if (random_test)
             fill_with_random_data(src, src_len);
@@ -477,8 +613,8 @@ do_write_test(unsigned long file_size, unsigned long min_buf_size, unsigned long
             error(HDstrerror(errno));
 
         for (i = 0; i <= iters; ++i) {
-            Bytef *s_ptr = src;
-            uLong  s_len = src_len;
+            unsigned char *s_ptr = src;
+            size_t         s_len = src_len;
 
             /* loop to make sure we write everything out that we want to write */
             for (;;) {
@@ -527,6 +663,10 @@ do_write_test(unsigned long file_size, unsigned long min_buf_size, unsigned long
         HDfprintf(stdout, "\tCompressed Write Time: %.2fs\n", total_time);
         HDfprintf(stdout, "\tCompressed Write Throughput: %.2fMB/s\n", MB_PER_SEC(file_size, total_time));
         HDfprintf(stdout, "\tCompression Time: %gs\n", compression_time);
+        HDfprintf(stdout, "\tCompression Throughput: %.2fMB/s\n", MB_PER_SEC(file_size, compression_time));
+        HDfprintf(stdout, "\tDecompression Time: %gs\n", decompression_time);
+        HDfprintf(stdout, "\tDecompression Throughput: %.2fMB/s\n",
+                  MB_PER_SEC(file_size, decompression_time));
 
         HDunlink(filename);
         HDfree(src);
@@ -590,6 +730,16 @@ main(int argc, const char *argv[])
             case 's':
                 file_size = parse_size_directive(opt_arg);
                 break;
+            case 'z':
+                if (!HDstrcmp(opt_arg, "deflate"))
+                    codec = ZIP_DEFLATE;
+                else if (!HDstrcmp(opt_arg, "lz4"))
+                    codec = ZIP_LZ4;
+                else if (!HDstrcmp(opt_arg, "zstd"))
+                    codec = ZIP_ZSTD;
+                else
+                    error("unknown compression library '%s'", opt_arg);
+                break;
             case '?':
                 usage();
                 exit(EXIT_FAILURE);
@@ -607,8 +757,11 @@ main(int argc, const char *argv[])
 
     HDfprintf(stdout, "Filesize: %ld\n", file_size);
 
-    if (compress_level == Z_DEFAULT_COMPRESSION)
-        HDfprintf(stdout, "Compression Level: 6\n");
+    HDfprintf(stdout, "Compression Library: %s\n", codec_names[codec]);
+    if (codec == ZIP_LZ4)
+        HDfprintf(stdout, "Compression Level: not used\n");
+    else if (compress_level < 0)
+        HDfprintf(stdout, "Compression Level: default\n");
     else
         HDfprintf(stdout, "Compression Level: %d\n", compress_level);
 
@@ -623,7 +776,7 @@ main(int argc, const char *argv[])
 /*
  * Function:    main
  * Purpose:     Dummy main() function for if HDF5 was configured without
- *              zlib stuff.
+ *              any of the compression libraries.
  * Return:      EXIT_SUCCESS
  * Programmer:  Bill Wendling, 10. June 2002
  * Modifications:
@@ -631,8 +784,8 @@ main(int argc, const char *argv[])
 int
 main(void)
 {
-    HDfprintf(stdout, "No compression IO performance because zlib was not configured\n");
+    HDfprintf(stdout, "No compression IO performance because no compression library was configured\n");
     return EXIT_SUCCESS;
 }
 
-#endif /* !H5_HAVE_FILTER_DEFLATE */
+#endif /* H5_HAVE_FILTER_DEFLATE || H5_HAVE_FILTER_LZ4 || H5_HAVE_FILTER_ZSTD */
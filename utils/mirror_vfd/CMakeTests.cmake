@@ -0,0 +1,39 @@
+#
+# Copyright by The HDF Group.
+# All rights reserved.
+#
+# This file is part of HDF5.  The full HDF5 copyright notice, including
+# terms governing use, modification, and redistribution, is contained in
+# the COPYING file, which can be found at the root of the source code
+# distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.
+# If you do not have access to either file, you may request a copy from
+# help@hdfgroup.org.
+#
+
+##############################################################################
+##############################################################################
+###           T E S T I N G                                                ###
+##############################################################################
+##############################################################################
+
+# The Mirror Server is run in the background from the directory of the
+# H5TEST tests, so that the files written by its Writers land next to
+# those of the test's R/W channel.  H5TEST-mirror_vfd requires the
+# mirror_server fixture.
+set (MIRROR_TEST_DIR ${HDF5_BINARY_DIR}/test/H5TEST)
+
+add_test (NAME MIRROR_VFD-mirror_server-start
+    COMMAND sh -c "\"$<TARGET_FILE:mirror_server>\" > mirror_server.log 2>&1 & sleep 1"
+    WORKING_DIRECTORY ${MIRROR_TEST_DIR}
+)
+set_tests_properties (MIRROR_VFD-mirror_server-start PROPERTIES
+    FIXTURES_SETUP mirror_server
+    RESOURCE_LOCK mirror_server_port
+)
+
+add_test (NAME MIRROR_VFD-mirror_server-stop COMMAND $<TARGET_FILE:mirror_server_stop>)
+set_tests_properties (MIRROR_VFD-mirror_server-stop PROPERTIES
+    FIXTURES_CLEANUP mirror_server
+    RESOURCE_LOCK mirror_server_port
+    WORKING_DIRECTORY ${MIRROR_TEST_DIR}
+)
@@ -206,4 +206,38 @@ mirror_log_term(loginfo_t *info)
     return SUCCEED;
 } /* end mirror_log_term() */
 
+/* ---------------------------------------------------------------------------
+ * Function:    mirror_read_bytes
+ *
+ * Purpose:     Read exactly `size` bytes from the socket into `buf`,
+ *              continuing after partial or interrupted reads.
+ *              Stops early only if the peer closes the connection.
+ *
+ * Return:      Success: Number of bytes read; less than `size` only at
+ *                       end-of-stream.
+ *              Failure: -1.
+ * ----------------------------------------------------------------------------
+ */
+ssize_t
+mirror_read_bytes(int fd, void *buf, size_t size)
+{
+    unsigned char *ptr   = (unsigned char *)buf;
+    size_t         nread = 0;
+    ssize_t        ret   = 0;
+
+    while (nread < size) {
+        ret = HDread(fd, ptr + nread, size - nread);
+        if (ret < 0) {
+            if (EINTR == errno)
+                continue;
+            return -1;
+        }
+        if (0 == ret)
+            break; /* end-of-stream */
+        nread += (size_t)ret;
+    }
+
+    return (ssize_t)nread;
+} /* end mirror_read_bytes() */
+
 #endif /* H5_HAVE_MIRROR_VFD */
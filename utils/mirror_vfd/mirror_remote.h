@@ -45,6 +45,8 @@ void       mirror_log_bytes(loginfo_t *info, unsigned int level, size_t n_bytes,
 loginfo_t *mirror_log_init(char *path, char *prefix, unsigned int verbosity);
 int        mirror_log_term(loginfo_t *loginfo);
 
+ssize_t mirror_read_bytes(int fd, void *buf, size_t size);
+
 herr_t run_writer(int socketfd, H5FD_mirror_xmit_open_t *xmit_open);
 
 #endif /* H5_HAVE_MIRROR_VFD */
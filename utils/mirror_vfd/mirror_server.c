@@ -521,7 +521,7 @@ handle_requests(struct server_run *run)
         /* Read handshake from port connection.
          */
 
-        ret = (int)HDread(connfd, &mybuf, H5FD_MIRROR_XMIT_OPEN_SIZE);
+        ret = (int)mirror_read_bytes(connfd, &mybuf, H5FD_MIRROR_XMIT_OPEN_SIZE);
         if (-1 == ret) {
             mirror_log(run->loginfo, V_ERR, "read:%d", ret);
             goto error;
@@ -57,9 +57,10 @@
  *      guard against commands from the wrong entity.
  *
  * xmit_count (uint32_t)
- *      Record of trasmissions received from the Driver. While the transmission
+ *      Record of commands received from the Driver. While the transmission
  *      protocol should be trustworthy, this serves as an additional guard.
- *      Starts a 0 and should be incremented for each one-way transmission.
+ *      Starts a 0 and is incremented for each command received; a reply
+ *      carries the count of the command it answers.
  *
  * file (H5FD_t *)
  *      Virtual File handle for the hdf5 file.
@@ -348,13 +349,15 @@ static int
 _xmit_reply(struct mirror_session *session)
 {
     unsigned char             xmit_buf[H5FD_MIRROR_XMIT_REPLY_SIZE];
-    H5FD_mirror_xmit_reply_t *reply = &(session->reply);
+    size_t                    nbytes = 0;
+    H5FD_mirror_xmit_reply_t *reply  = &(session->reply);
 
     HDassert(session && (session->magic == MW_SESSION_MAGIC));
 
     mirror_log(session->loginfo, V_ALL, "_xmit_reply()");
 
-    reply->pub.xmit_count = session->xmit_count++;
+    /* Answer the command most recently received */
+    reply->pub.xmit_count = session->xmit_count - 1;
     if (H5FD_mirror_xmit_encode_reply(xmit_buf, (const H5FD_mirror_xmit_reply_t *)reply) !=
         H5FD_MIRROR_XMIT_REPLY_SIZE) {
         mirror_log(session->loginfo, V_ERR, "can't encode reply");
@@ -365,9 +368,16 @@ _xmit_reply(struct mirror_session *session)
     mirror_log_bytes(session->loginfo, V_ALL, H5FD_MIRROR_XMIT_REPLY_SIZE, (const unsigned char *)xmit_buf);
     mirror_log(session->loginfo, V_ALL, "```");
 
-    if (HDwrite(session->sockfd, xmit_buf, H5FD_MIRROR_XMIT_REPLY_SIZE) < 0) {
-        mirror_log(session->loginfo, V_ERR, "can't write reply to Driver");
-        return -1;
+    while (nbytes < H5FD_MIRROR_XMIT_REPLY_SIZE) {
+        ssize_t ret = HDwrite(session->sockfd, xmit_buf + nbytes, H5FD_MIRROR_XMIT_REPLY_SIZE - nbytes);
+
+        if (ret < 0 && EINTR == errno)
+            continue;
+        if (ret < 0) {
+            mirror_log(session->loginfo, V_ERR, "can't write reply to Driver");
+            return -1;
+        }
+        nbytes += (size_t)ret;
     }
 
     return 0;
@@ -524,6 +534,9 @@ do_open(struct mirror_session *session, const H5FD_mirror_xmit_open_t *xmit_open
 
     mirror_log(session->loginfo, V_INFO, "do_open()");
 
+    /* The OPEN was received by the Server, and is command 0 */
+    session->xmit_count = 1;
+
     if (0 != xmit_open->pub.xmit_count) {
         mirror_log(session->loginfo, V_ERR, "open with xmit count not zero!");
         reply_error(session, "initial transmission count not zero");
@@ -535,7 +548,6 @@ do_open(struct mirror_session *session, const H5FD_mirror_xmit_open_t *xmit_open
         goto error;
     }
 
-    session->xmit_count              = 1;
     session->token                   = xmit_open->pub.session_token;
     session->reply.pub.session_token = session->token;
 
@@ -630,10 +642,12 @@ do_set_eoa(struct mirror_session *session, const unsigned char *xmit_buf)
 
     mirror_log(session->loginfo, V_INFO, "set EOA addr %d", xmit_seoa.eoa_addr);
 
+    /* The Driver may have more commands in flight; report the failure in
+     * the reply and keep the session in step with it.
+     */
     if (H5FDset_eoa(session->file, (H5FD_mem_t)xmit_seoa.type, (haddr_t)xmit_seoa.eoa_addr) < 0) {
         mirror_log(session->loginfo, V_ERR, "H5FDset_eoa()");
-        reply_error(session, "remote H5FDset_eoa() failure");
-        return -1;
+        return reply_error(session, "remote H5FDset_eoa() failure");
     }
 
     if (reply_ok(session) < 0) {
@@ -711,12 +725,13 @@ do_unlock(struct mirror_session *session)
  * Function:    do_write
  *
  * Purpose:     Handle a WRITE operation.
- *              Receives command, replies; receives & writes data, replies.
+ *              The data to write immediately follows the command; it is
+ *              received and written in pieces of at most
+ *              H5FD_MIRROR_DATA_BUFFER_MAX bytes, and the command is
+ *              answered once all of it is written.
  *
- *              It is known that this results in suboptimal performance,
- *              but handling both small and very, very large write buffers
- *              with a single "over the wire" exchange
- *              poses design challenges not worth tackling as of March 2020.
+ *              A failed write is reported in the reply without ending the
+ *              session, as the Driver may already have sent more commands.
  *
  * Return:      0 on success, -1 if error.
  * ---------------------------------------------------------------------------
@@ -729,7 +744,9 @@ do_write(struct mirror_session *session, const unsigned char *xmit_buf)
     haddr_t                  sum_bytes_written = 0;
     H5FD_mem_t               type              = 0;
     char *                   buf               = NULL;
-    ssize_t                  nbytes_in_packet  = 0;
+    size_t                   buf_size          = 0;
+    size_t                   nbytes            = 0;
+    const char *             write_err         = NULL;
     H5FD_mirror_xmit_write_t xmit_write;
 
     HDassert(session && (session->magic == MW_SESSION_MAGIC) && xmit_buf);
@@ -760,20 +777,14 @@ do_write(struct mirror_session *session, const unsigned char *xmit_buf)
 
     /* Allocate the buffer once -- re-use between loops.
      */
-    buf = (char *)HDmalloc(sizeof(char) * H5FD_MIRROR_DATA_BUFFER_MAX);
+    buf_size = (size_t)MIN(xmit_write.size, H5FD_MIRROR_DATA_BUFFER_MAX);
+    buf      = (char *)HDmalloc(sizeof(char) * MAX(buf_size, 1));
     if (NULL == buf) {
         mirror_log(session->loginfo, V_ERR, "can't allocate databuffer");
         reply_error(session, "can't allocate buffer for receiving data");
         return -1;
     }
 
-    /* got write signal; ready for data */
-    if (reply_ok(session) < 0) {
-        mirror_log(session->loginfo, V_ERR, "can't reply");
-        reply_error(session, "ok reply failed; session contaminated");
-        return -1;
-    }
-
     mirror_log(session->loginfo, V_INFO, "to write %zu bytes at %zu", xmit_write.size, addr);
 
     /* The given write may be:
@@ -784,37 +795,39 @@ do_write(struct mirror_session *session, const unsigned char *xmit_buf)
      * and writing that part to the file.
      */
     sum_bytes_written = 0;
-    do {
-        nbytes_in_packet = HDread(session->sockfd, buf, H5FD_MIRROR_DATA_BUFFER_MAX);
-        if (-1 == nbytes_in_packet) {
+    while (sum_bytes_written < xmit_write.size) {
+        nbytes = (size_t)MIN(xmit_write.size - sum_bytes_written, buf_size);
+        if (mirror_read_bytes(session->sockfd, buf, nbytes) != (ssize_t)nbytes) {
             mirror_log(session->loginfo, V_ERR, "can't read into databuffer");
             reply_error(session, "can't read data buffer");
+            HDfree(buf);
             return -1;
         }
 
-        mirror_log(session->loginfo, V_INFO, "received %zd bytes", nbytes_in_packet);
+        mirror_log(session->loginfo, V_INFO, "received %zu bytes", nbytes);
         if (HEXDUMP_WRITEDATA) {
             mirror_log(session->loginfo, V_ALL, "DATA:\n```");
-            mirror_log_bytes(session->loginfo, V_ALL, nbytes_in_packet, (const unsigned char *)buf);
+            mirror_log_bytes(session->loginfo, V_ALL, nbytes, (const unsigned char *)buf);
             mirror_log(session->loginfo, V_ALL, "```");
         }
 
-        mirror_log(session->loginfo, V_INFO, "writing %zd bytes at %zu", nbytes_in_packet,
-                   (addr + sum_bytes_written));
+        mirror_log(session->loginfo, V_INFO, "writing %zu bytes at %zu", nbytes, (addr + sum_bytes_written));
 
-        if (H5FDwrite(session->file, type, H5P_DEFAULT, (addr + sum_bytes_written), (size_t)nbytes_in_packet,
-                      buf) < 0) {
+        /* Keep consuming the data after a failure, to stay in step */
+        if (NULL == write_err &&
+            H5FDwrite(session->file, type, H5P_DEFAULT, (addr + sum_bytes_written), nbytes, buf) < 0) {
             mirror_log(session->loginfo, V_ERR, "H5FDwrite()");
-            reply_error(session, "remote H5FDwrite() failure");
-            return -1;
+            write_err = "remote H5FDwrite() failure";
         }
 
-        sum_bytes_written += (haddr_t)nbytes_in_packet;
-
-    } while (sum_bytes_written < xmit_write.size); /* end while ingesting */
+        sum_bytes_written += (haddr_t)nbytes;
+    } /* end while ingesting */
 
     HDfree(buf);
 
+    if (write_err)
+        return reply_error(session, write_err);
+
     /* signal that we're done here and a-ok */
     if (reply_ok(session) < 0) {
         mirror_log(session->loginfo, V_ERR, "can't reply");
@@ -830,6 +843,9 @@ do_write(struct mirror_session *session, const unsigned char *xmit_buf)
  *
  * Purpose:     Accept bytes from the socket, check for emergency shutdown, and
  *              sanity-check received bytes.
+ *              The header is read first; the rest of the xmit, whose size
+ *              depends on the operation, is then read so that the next
+ *              command (or a write's data) is left in the socket.
  *              The raw bytes read are stored in the sock_comm structure at
  *              comm->raw.
  *              The raw bytes are decoded and a xmit_t (header) struct pointer
@@ -843,7 +859,8 @@ receive_communique(struct mirror_session *session, struct sock_comm *comm)
 {
     ssize_t             read_ret = 0;
     size_t              decode_ret;
-    H5FD_mirror_xmit_t *X = comm->xmit_recd;
+    size_t              xmit_size = H5FD_MIRROR_XMIT_HEADER_SIZE;
+    H5FD_mirror_xmit_t *X         = comm->xmit_recd;
 
     HDassert((session != NULL) && (session->magic == MW_SESSION_MAGIC) && (comm != NULL) &&
              (comm->magic == MW_SOCK_COMM_MAGIC) && (comm->xmit_recd != NULL) && (comm->raw != NULL) &&
@@ -856,18 +873,13 @@ receive_communique(struct mirror_session *session, struct sock_comm *comm)
 
     mirror_log(session->loginfo, V_INFO, "ready to receive"); /* TODO */
 
-    read_ret = HDread(session->sockfd, comm->raw, H5FD_MIRROR_XMIT_BUFFER_MAX);
+    read_ret = mirror_read_bytes(session->sockfd, comm->raw, H5FD_MIRROR_XMIT_HEADER_SIZE);
     if (-1 == read_ret) {
         mirror_log(session->loginfo, V_ERR, "read:%zd", read_ret);
         goto error;
     }
 
     mirror_log(session->loginfo, V_INFO, "received %zd bytes", read_ret);
-    if (HEXDUMP_XMITS) {
-        mirror_log(session->loginfo, V_ALL, "```", read_ret);
-        mirror_log_bytes(session->loginfo, V_ALL, (size_t)read_ret, (const unsigned char *)comm->raw);
-        mirror_log(session->loginfo, V_ALL, "```");
-    } /* end if hexdump transmissions received */
 
     /* old-fashioned manual kill (for debugging) */
     if (!HDstrncmp("GOODBYE", comm->raw, 7)) {
@@ -876,6 +888,11 @@ receive_communique(struct mirror_session *session, struct sock_comm *comm)
         goto done;
     }
 
+    if (H5FD_MIRROR_XMIT_HEADER_SIZE != read_ret) {
+        mirror_log(session->loginfo, V_ERR, "connection closed mid-header");
+        goto error;
+    }
+
     decode_ret = H5FD_mirror_xmit_decode_header(X, (const unsigned char *)comm->raw);
     if (H5FD_MIRROR_XMIT_HEADER_SIZE != decode_ret) {
         mirror_log(session->loginfo, V_ERR, "header decode size mismatch: expected (%z), got (%z)",
@@ -909,6 +926,39 @@ receive_communique(struct mirror_session *session, struct sock_comm *comm)
 
     session->xmit_count++;
 
+    switch (X->op) {
+        case H5FD_MIRROR_OP_LOCK:
+            xmit_size = H5FD_MIRROR_XMIT_LOCK_SIZE;
+            break;
+        case H5FD_MIRROR_OP_OPEN:
+            xmit_size = H5FD_MIRROR_XMIT_OPEN_SIZE;
+            break;
+        case H5FD_MIRROR_OP_SET_EOA:
+            xmit_size = H5FD_MIRROR_XMIT_EOA_SIZE;
+            break;
+        case H5FD_MIRROR_OP_WRITE:
+            xmit_size = H5FD_MIRROR_XMIT_WRITE_SIZE;
+            break;
+        default:
+            break;
+    } /* end switch (X->op) */
+
+    if (xmit_size > H5FD_MIRROR_XMIT_HEADER_SIZE) {
+        read_ret = mirror_read_bytes(session->sockfd, comm->raw + H5FD_MIRROR_XMIT_HEADER_SIZE,
+                                     xmit_size - H5FD_MIRROR_XMIT_HEADER_SIZE);
+        if (read_ret != (ssize_t)(xmit_size - H5FD_MIRROR_XMIT_HEADER_SIZE)) {
+            mirror_log(session->loginfo, V_ERR, "can't read xmit body:%zd", read_ret);
+            reply_error(session, "xmit size mismatch");
+            goto error;
+        }
+    }
+
+    if (HEXDUMP_XMITS) {
+        mirror_log(session->loginfo, V_ALL, "```");
+        mirror_log_bytes(session->loginfo, V_ALL, xmit_size, (const unsigned char *)comm->raw);
+        mirror_log(session->loginfo, V_ALL, "```");
+    } /* end if hexdump transmissions received */
+
 done:
     return 0;
 